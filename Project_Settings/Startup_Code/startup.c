@@ -79,6 +79,7 @@ static volatile uint32_t * const s_vectors[NUMBER_OF_CORES] = FEATURE_INTERRUPT_
  * - Copy initialized data from ROM to RAM.
  * - Copy code that should reside in RAM from ROM
  * - Clear the zero-initialized data section.
+ * - Clear the zero-initialized SRAM_L data section (mem_ultis.h).
  *
  * Tool Chains:
  *   __GNUC__           : GNU Compiler Collection
@@ -105,6 +106,8 @@ void init_data_bss(void)
     const uint8_t * data_rom, * data_rom_end;
     const uint8_t * code_rom, * code_rom_end;
     const uint8_t * bss_end;
+    uint8_t * bss_sram_l_start;
+    const uint8_t * bss_sram_l_end;
     const uint8_t * custom_rom, * custom_rom_end;
 #endif
     /* Addresses for VECTOR_TABLE and VECTOR_RAM come from the linker file */
@@ -135,6 +138,9 @@ void init_data_bss(void)
     /* BSS */
     bss_start       = __section_begin(".bss");
     bss_end         = __section_end(".bss");
+    /* No SRAM_L block in the IAR linker file */
+    bss_sram_l_start = (uint8_t *)0;
+    bss_sram_l_end   = (const uint8_t *)0;
 
     custom_ram      = __section_begin(".customSection");
     custom_rom      = __section_begin(".customSection_init");
@@ -157,6 +163,9 @@ void init_data_bss(void)
     extern uint32_t __BSS_START[];
     extern uint32_t __BSS_END[];
 
+    extern uint32_t __BSS_SRAM_L_START[];
+    extern uint32_t __BSS_SRAM_L_END[];
+
     extern uint32_t __CUSTOM_ROM[];
     extern uint32_t __CUSTOM_END[];
 
@@ -171,6 +180,8 @@ void init_data_bss(void)
     /* BSS */
     bss_start       = (uint8_t *)__BSS_START;
     bss_end         = (uint8_t *)__BSS_END;
+    bss_sram_l_start = (uint8_t *)__BSS_SRAM_L_START;
+    bss_sram_l_end   = (uint8_t *)__BSS_SRAM_L_END;
 
 	/* Custom section */
     custom_ram      = CUSTOMSECTION_SECTION_START;
@@ -203,6 +214,13 @@ void init_data_bss(void)
         bss_start++;
     }
 
+    /* Clear the zero-initialized SRAM_L data section */
+    while(bss_sram_l_end != bss_sram_l_start)
+    {
+        *bss_sram_l_start = 0;
+        bss_sram_l_start++;
+    }
+
     /* Copy customsection rom to ram */
     while(custom_rom_end != custom_rom)
     {
@@ -18,69 +18,317 @@
 #include "../../service/clock_srv/clock_srv.h"
 #include "../../service/gpio_srv/gpio_srv.h"
 #include "../../service/port_srv/port_srv.h"
+#include "../../service/res_srv/res_srv.h"
+#include "../../service/nvm_srv/nvm_srv.h"
+#include "../../service/boot_srv/boot_srv.h"
+#include "../../service/trgmux_srv/trgmux_srv.h"
+#include "../../service/wdog_srv/wdog_srv.h"
+#include "../../service/co_srv/co_srv.h"
+#include "../../service/uds_srv/uds_srv.h"
+#include "../../service/secoc_srv/secoc_srv.h"
+#include "../../service/tsyn_srv/tsyn_srv.h"
+#include "../../service/fft_srv/fft_srv.h"
+#include "../../service/scope_srv/scope_srv.h"
+#include "../../service/isotp_srv/isotp_srv.h"
+#include "../../service/lut_srv/lut_srv_cal.h"
+#include "../../service/cache_srv/cache_srv.h"
 #include "../../driver/adc/adc.h"
+#include "../../driver/gpio/gpio_fast.h"
 #include "../../driver/nvic/nvic.h"
+#include "../../driver/ultis/dwt_ultis.h"
+#include "../../driver/ultis/mem_ultis.h"
 #include <string.h>
 
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* LEDs bound at build time: APP_B1_LedRed_Toggle() is one store to PTOR */
+GPIO_FAST_PIN(APP_B1_LedRed, APP_B1_LED_RED_PORT, APP_B1_LED_RED_PIN)
+GPIO_FAST_PIN(APP_B1_LedGreen, APP_B1_LED_GREEN_PORT, APP_B1_LED_GREEN_PIN)
+
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
 static app_b1_state_t s_app_state = APP_B1_STATE_IDLE;
-static volatile bool s_adc_sample_request = false;
+static volatile bool s_adc_sample_ready = false;    /* Set by the ADC sequence callback */
 static volatile uint32_t s_sample_count = 0;
 static volatile uint16_t s_last_adc_value = 0;
+static volatile uint16_t s_pending_period_ms = 0;  /* Set from CAN, applied in Process */
+static volatile bool s_boot_request = false;       /* Set from CAN, handled in Process */
+static uint8_t s_secoc_cmd_pdu = SECOC_SRV_NO_PDU;
+
+/* Shared with Board 2 (APP_B2_SECOC_KEY) */
+static const uint8_t s_secoc_key[SECOC_SRV_KEY_SIZE] = APP_B1_SECOC_KEY;
+
+/* Supervised task (wdog_srv) */
+static uint8_t s_wdog_sample_task = WDOG_SRV_NO_TASK;
+
+/* Runtime configuration (loaded from nvm_srv) */
+static uint32_t s_cmd_id = APP_B1_CMD_ID;
+static uint32_t s_data_id = APP_B1_DATA_ID;
+
+/* Own TX mailbox for data and spectrum frames (can_srv) */
+static uint8_t s_tx_mb = 0;
 
-/* ADC and LPIT configuration */
-static adc_srv_config_t s_adc_cfg;
+/* ADC sequence and LPIT configuration */
+static adc_srv_sequence_config_t s_adc_seq_cfg;
 static lpit_srv_config_t s_lpit_cfg;
+static uint32_t s_sample_period_us = 0;     /* Normal mode, restored after spectrum mode */
+static uint16_t s_interval_ms = 0;          /* Timer period that ends at the next sample */
+
+/* Adaptive sampling: period between the minimum and s_sample_period_us */
+static bool s_adaptive = false;
+static bool s_adaptive_primed = false;      /* First sample seeds the statistics */
+static uint16_t s_adaptive_min_ms = APP_B1_ADAPTIVE_MIN_PERIOD_MS;
+static uint16_t s_adaptive_slope = APP_B1_ADAPTIVE_SLOPE;
+static uint16_t s_adaptive_deviation = APP_B1_ADAPTIVE_DEVIATION;
+static uint16_t s_adaptive_quiet = 0;       /* Quiet samples since the last change */
+static uint16_t s_adaptive_prev = 0;
+static int32_t s_adaptive_mean_q4 = 0;      /* Running mean, 1/16 count */
+static int32_t s_adaptive_var = 0;          /* Running variance, counts^2 */
+
+/* Spectrum mode: the ADC interrupt fills one block while Process analyses the other */
+static uint16_t s_spectrum_block[2][APP_B1_SPECTRUM_SIZE] MEM_STREAM;
+static uint32_t s_spectrum_work[APP_B1_SPECTRUM_SIZE] MEM_HOT;     /* FFT in place */
+static volatile uint16_t s_spectrum_fill = 0;
+static volatile uint8_t s_spectrum_write = 0;      /* Block filled by the interrupt */
+static volatile bool s_spectrum_ready = false;     /* Other block complete */
+static volatile uint32_t s_spectrum_overruns = 0;  /* Blocks dropped, Process too slow */
+static uint32_t s_spectrum_blocks = 0;
+static can_srv_message_t s_spectrum_tx[APP_B1_SPECTRUM_PEAKS];   /* Peaks of the last block */
+static uint8_t s_spectrum_tx_count = 0;
+static uint8_t s_spectrum_tx_next = 0;             /* Next peak waiting for the mailbox */
+
+/* Capture mode: history written by the ADC interrupt, sent over ISO-TP */
+static uint16_t s_capture_history[APP_B1_CAPTURE_SIZE] MEM_STREAM;
+static uint8_t s_capture_tx[APP_B1_CAPTURE_HEADER +
+                            SCOPE_SRV_PACKED_SIZE(APP_B1_CAPTURE_PRE + APP_B1_CAPTURE_POST)] MEM_STREAM;
+static uint8_t s_capture_rx[8];                 /* Nothing is expected but flow control */
+static uint8_t s_capture_channel = ISOTP_SRV_NO_CHANNEL;
+static scope_srv_arm_t s_capture_arm;
+static uint32_t s_captures_sent = 0;
+
+/* CANopen objects: RPDO1 writes the period here, applied in Process */
+static volatile uint16_t s_co_period_ms = 0;
+
+/* Object dictionary, sorted by index/subindex */
+static const co_srv_od_entry_t s_co_od[] = {
+    CO_SRV_OD_VAR(0x2000U, 0x00U, CO_SRV_OD_RO, s_sample_count),
+    CO_SRV_OD_VAR(0x2001U, 0x00U, CO_SRV_OD_WO, s_co_period_ms),
+    CO_SRV_OD_VAR(0x6401U, 0x01U, CO_SRV_OD_RO, s_last_adc_value),     /* CiA 401 analog input 1 */
+};
+
+/* TPDO1 (every SYNC): latest sample and counter in 4 bytes */
+static const co_srv_pdo_map_t s_co_tpdo1_map[] = {
+    { 0x6401U, 0x01U, APP_B1_CO_ADC_BITS },
+    { 0x2000U, 0x00U, APP_B1_CO_COUNT_BITS },
+};
+
+/* RPDO1 (event): sample period in ms */
+static const co_srv_pdo_map_t s_co_rpdo1_map[] = {
+    { 0x2001U, 0x00U, 16U },
+};
+
+/* Sampling jitter: ADC interrupt timestamps against the LPIT period */
+static uint32_t s_cycles_per_us = 0;
+static volatile uint32_t s_expected_cycles = 0;     /* 0 = not measured */
+static volatile uint32_t s_last_sample_cycles = 0;
+static volatile uint32_t s_jitter_max_cycles = 0;
+static volatile bool s_jitter_armed = false;
 
 /*******************************************************************************
  * Private Function Prototypes
  ******************************************************************************/
-static void APP_B1_CANCallback(uint8_t instance, can_srv_event_t event, 
-                               const can_srv_message_t *message);
+static void APP_B1_CommandCallback(uint8_t pdu, const uint8_t *data, uint32_t freshness);
+static app_b1_status_t APP_B1_InitSecOC(void);
 static void APP_B1_LPITCallback(void);
+static void APP_B1_ADCSequenceCallback(const uint16_t *raw, uint8_t count);
 static void APP_B1_ProcessCommand(uint8_t command);
 static void APP_B1_StartADCSampling(void);
 static void APP_B1_StopADCSampling(void);
 static void APP_B1_ReadAndSendADC(void);
-static void APP_B1_SendADCData(uint16_t adc_value);
+static void APP_B1_SendADCData(uint16_t adc_value, uint16_t period_ms);
+static app_b1_status_t APP_B1_StartAdaptive(uint16_t min_period_ms, uint16_t slope, uint16_t deviation);
+static void APP_B1_StopAdaptive(void);
+static void APP_B1_AdaptPeriod(uint16_t sample, uint16_t interval_ms);
+static void APP_B1_ApplySamplePeriod(uint16_t period_ms);
+static void APP_B1_ConfigTimer(uint32_t period_us, uint32_t deadline_ms);
+static app_b1_status_t APP_B1_StartSpectrum(uint16_t period_us);
+static void APP_B1_ProcessSpectrum(void);
+static void APP_B1_SendSpectrumPeaks(void);
+static app_b1_status_t APP_B1_InitCapture(void);
+static app_b1_status_t APP_B1_StartCapture(const scope_srv_arm_t *arm, uint16_t period_us);
+static void APP_B1_ProcessCapture(void);
+static void APP_B1_CaptureReceive(uint8_t channel, const uint8_t *data, uint16_t length, bool functional);
+static void APP_B1_TriggerCallback(uint8_t instance, can_srv_event_t event, const can_srv_message_t *message);
+static app_b1_status_t APP_B1_InitCANopen(void);
+static void APP_B1_CONmtCallback(co_srv_nmt_state_t state);
+static void APP_B1_CORpdoCallback(uint8_t pdo);
+static app_b1_status_t APP_B1_InitDiagnostics(void);
+static void APP_B1_ResetJitter(void);
+static void APP_B1_PutU32(uint8_t *out, uint32_t value);
+static void APP_B1_DidReadPeriod(uint8_t *out);
+static uint8_t APP_B1_DidWritePeriod(const uint8_t *in);
+static void APP_B1_DidReadJitter(uint8_t *out);
+static void APP_B1_DidReadRequestTime(uint8_t *out);
+static void APP_B1_DidReadSampleTime(uint8_t *out);
+static void APP_B1_DidReadTimeSync(uint8_t *out);
+static void APP_B1_DidReadInput(uint8_t *out);
+static uint8_t APP_B1_RoutineSampling(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                      uint8_t *result, uint16_t *result_length);
+static uint8_t APP_B1_RoutineResetJitter(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                         uint8_t *result, uint16_t *result_length);
+static uint8_t APP_B1_RoutineSpectrum(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                      uint8_t *result, uint16_t *result_length);
+static uint8_t APP_B1_RoutineCapture(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                     uint8_t *result, uint16_t *result_length);
+static uint8_t APP_B1_RoutineAdaptive(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                      uint8_t *result, uint16_t *result_length);
+
+/* Diagnostic data identifiers (tables follow the handler prototypes) */
+static const uds_srv_did_t s_uds_dids[] = {
+    UDS_SRV_DID_VAR(APP_B1_DID_ADC_VALUE, UDS_SRV_DID_READ, s_last_adc_value),
+    UDS_SRV_DID_VAR(APP_B1_DID_SAMPLE_COUNT, UDS_SRV_DID_READ, s_sample_count),
+    UDS_SRV_DID_FN(APP_B1_DID_SAMPLE_PERIOD, 2U, UDS_SRV_DID_RW | UDS_SRV_DID_EXTENDED,
+                   APP_B1_DidReadPeriod, APP_B1_DidWritePeriod),
+    UDS_SRV_DID_FN(APP_B1_DID_SAMPLE_JITTER, 4U, UDS_SRV_DID_READ, APP_B1_DidReadJitter, NULL),
+    UDS_SRV_DID_FN(APP_B1_DID_UDS_REQUEST_TIME, 4U, UDS_SRV_DID_READ, APP_B1_DidReadRequestTime, NULL),
+    UDS_SRV_DID_FN(APP_B1_DID_SAMPLE_TIME, 8U, UDS_SRV_DID_READ, APP_B1_DidReadSampleTime, NULL),
+    UDS_SRV_DID_FN(APP_B1_DID_TIME_SYNC, 9U, UDS_SRV_DID_READ, APP_B1_DidReadTimeSync, NULL),
+    UDS_SRV_DID_FN(APP_B1_DID_ADC_INPUT, 4U, UDS_SRV_DID_READ, APP_B1_DidReadInput, NULL),
+};
+
+/* Diagnostic routines */
+static const uds_srv_routine_t s_uds_routines[] = {
+    { APP_B1_RID_SAMPLING, true, APP_B1_RoutineSampling },
+    { APP_B1_RID_RESET_JITTER, false, APP_B1_RoutineResetJitter },
+    { APP_B1_RID_SPECTRUM, true, APP_B1_RoutineSpectrum },
+    { APP_B1_RID_CAPTURE, true, APP_B1_RoutineCapture },
+    { APP_B1_RID_ADAPTIVE, true, APP_B1_RoutineAdaptive },
+};
 
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
 #define CHECK_LPIT_DELAY
 /**
- * @brief CAN receive callback
- * @details Processes commands from Board 2
+ * @brief Authentic command received (main loop, SECOC_SRV_Process())
+ * @details Processes commands from Board 2. Frames with a wrong MAC or an
+ *          old freshness value never get here.
  */
-static void APP_B1_CANCallback(uint8_t instance, can_srv_event_t event, 
-                               const can_srv_message_t *message)
+static void APP_B1_CommandCallback(uint8_t pdu, const uint8_t *data, uint32_t freshness)
 {
-    if (event == CAN_SRV_EVENT_RX_COMPLETE && message != NULL) {
-        /* Check if this is a command message */
-        if (message->id == APP_B1_CMD_ID && message->dlc >= 1) {
-            GPIO_SRV_Toggle(APP_B1_LED_RED_PORT, APP_B1_LED_RED_PIN);  /* Toggle LED on CAN RX */
-            APP_B1_ProcessCommand(message->data[0]);
-        }
+    (void)pdu;
+    
+    APP_B1_LedRed_Toggle();  /* Toggle LED on CAN RX */
+    
+    if (data[0] == APP_B1_CMD_SET_PERIOD) {
+        s_pending_period_ms = (uint16_t)(((uint16_t)data[1] << 8) | data[2]);
+    } else if (data[0] == APP_B1_CMD_ENTER_BOOT) {
+        s_boot_request = true;
+    } else {
+        APP_B1_ProcessCommand(data[0]);
     }
+    
+    /* A replay of this frame stays rejected after a reset */
+    NVM_SRV_Write(NVM_SRV_KEY_SECOC_RX_FRESHNESS, freshness);
+}
+
+/**
+ * @brief Accept commands only as authenticated SecOC frames
+ */
+static app_b1_status_t APP_B1_InitSecOC(void)
+{
+    secoc_srv_config_t secoc_cfg;
+    secoc_srv_pdu_config_t pdu_cfg;
+    uint32_t freshness;
+    
+    secoc_cfg.key = s_secoc_key;
+    secoc_cfg.engine = SECOC_SRV_ENGINE_AUTO;
+    if (SECOC_SRV_Init(&secoc_cfg) != SECOC_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    pdu_cfg.can_id = s_cmd_id;
+    pdu_cfg.extended = false;
+    pdu_cfg.direction = SECOC_SRV_DIR_RX;
+    pdu_cfg.data_id = APP_B1_SECOC_DATA_ID;
+    pdu_cfg.data_length = APP_B1_SECOC_CMD_BYTES;
+    pdu_cfg.fv_bytes = APP_B1_SECOC_FV_BYTES;
+    pdu_cfg.mac_bytes = APP_B1_SECOC_MAC_BYTES;
+    pdu_cfg.on_rx = APP_B1_CommandCallback;
+    if (SECOC_SRV_AddPdu(&pdu_cfg, &s_secoc_cmd_pdu) != SECOC_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    if (NVM_SRV_Read(NVM_SRV_KEY_SECOC_RX_FRESHNESS, &freshness) == NVM_SRV_SUCCESS) {
+        SECOC_SRV_SetFreshness(s_secoc_cmd_pdu, freshness);
+    }
+    
+    return APP_B1_SUCCESS;
 }
 
 /**
  * @brief LPIT timer callback (1 second periodic)
- * @details Triggers ADC sampling every 1 second
+ * @details The conversion itself is started in hardware: the LPIT channel
+ *          triggers PDB0 through TRGMUX, so this ISR only drives the LED
  */
 static void APP_B1_LPITCallback(void)
 {
     if (s_app_state == APP_B1_STATE_SAMPLING) {
-        s_adc_sample_request = true;
 #ifdef CHECK_LPIT_DELAY
-        GPIO_SRV_Toggle(APP_B1_LED_GREEN_PORT, APP_B1_LED_GREEN_PIN);  /* Toggle LED on CAN RX */
+        APP_B1_LedGreen_Toggle();  /* Toggle LED on CAN RX */
 
 #endif
     }
 }
 
+/**
+ * @brief ADC conversion complete (ADC0 interrupt)
+ */
+static void APP_B1_ADCSequenceCallback(const uint16_t *raw, uint8_t count)
+{
+    uint32_t now = DWT_GetCycles();
+    uint32_t deviation;
+
+    /* Conversions are hardware-timed, so any spread here is interrupt latency */
+    if (s_jitter_armed && s_expected_cycles != 0U) {
+        deviation = now - s_last_sample_cycles;
+        deviation = (deviation > s_expected_cycles) ? (deviation - s_expected_cycles)
+                                                    : (s_expected_cycles - deviation);
+        if (deviation > s_jitter_max_cycles) {
+            s_jitter_max_cycles = deviation;
+        }
+    }
+    s_last_sample_cycles = now;
+    s_jitter_armed = true;
+
+    s_last_adc_value = raw[0];
+
+    if (s_app_state == APP_B1_STATE_CAPTURE) {
+        SCOPE_SRV_PushBlock(raw, count);
+        return;
+    }
+
+    if (s_app_state != APP_B1_STATE_SPECTRUM) {
+        s_adc_sample_ready = true;
+        return;
+    }
+
+    s_spectrum_block[s_spectrum_write][s_spectrum_fill] = raw[0];
+    if (++s_spectrum_fill == APP_B1_SPECTRUM_SIZE) {
+        s_spectrum_fill = 0;
+        if (s_spectrum_ready) {
+            /* Refill the same block, the previous one is still in use */
+            s_spectrum_overruns++;
+        } else {
+            s_spectrum_write ^= 1U;
+            s_spectrum_ready = true;
+        }
+    }
+}
+
 /**
  * @brief Process command from Board 2
  */
@@ -106,12 +354,19 @@ static void APP_B1_ProcessCommand(uint8_t command)
  */
 static void APP_B1_StartADCSampling(void)
 {
+    if (s_app_state == APP_B1_STATE_SPECTRUM || s_app_state == APP_B1_STATE_CAPTURE) {
+        APP_B1_StopADCSampling();
+    }
+    
     if (s_app_state != APP_B1_STATE_SAMPLING) {
         /* Reset counter */
         s_sample_count = 0;
+        APP_B1_ResetJitter();
+        s_interval_ms = (uint16_t)(s_lpit_cfg.period_us / 1000U);
         
         /* Start LPIT timer (1 second periodic) */
         LPIT_SRV_Start(&s_lpit_cfg);
+        WDOG_SRV_Resume(s_wdog_sample_task);
         
         /* Update state */
         s_app_state = APP_B1_STATE_SAMPLING;
@@ -123,57 +378,66 @@ static void APP_B1_StartADCSampling(void)
  */
 static void APP_B1_StopADCSampling(void)
 {
-    if (s_app_state == APP_B1_STATE_SAMPLING) {
+    if (s_app_state == APP_B1_STATE_SAMPLING || s_app_state == APP_B1_STATE_SPECTRUM ||
+        s_app_state == APP_B1_STATE_CAPTURE) {
         /* Stop LPIT timer */
         LPIT_SRV_Stop(&s_lpit_cfg);
+        WDOG_SRV_Suspend(s_wdog_sample_task);
 #ifdef CHECK_LPIT_DELAY
-        GPIO_SRV_WritePin(APP_B1_LED_GREEN_PORT, APP_B1_LED_GREEN_PIN, 1);  /* Toggle LED on CAN RX */
+        APP_B1_LedGreen_Set();  /* Toggle LED on CAN RX */
 
 #endif
+        SCOPE_SRV_Disarm();
+        
+        /* Back to the normal sample period */
+        if (s_app_state != APP_B1_STATE_SAMPLING || s_adaptive) {
+            s_adaptive = false;
+            APP_B1_ConfigTimer(s_sample_period_us,
+                               (s_sample_period_us / 1000U) * APP_B1_WDOG_SAMPLE_PERIODS);
+        }
+        
         /* Update state */
         s_app_state = APP_B1_STATE_IDLE;
     }
 }
 
 /**
- * @brief Read ADC and send via CAN
+ * @brief Send the latest hardware-timed sample via CAN
  */
 static void APP_B1_ReadAndSendADC(void)
 {
-    adc_srv_status_t status;
+    uint16_t sample = s_last_adc_value;
+    uint16_t interval_ms = s_interval_ms;
     
-    /* Start ADC conversion (blocking mode - value is read automatically) */
-    ADC_SRV_Start(&s_adc_cfg);
-    status = ADC_SRV_Read(&s_adc_cfg);
-    if (status == ADC_SRV_SUCCESS) {
-        /* In blocking mode, raw_value is already populated by ADC_SRV_Start() */
-        s_last_adc_value = s_adc_cfg.raw_value;
-        s_sample_count++;
-        
-        /* Send via CAN - always send even if value is 0 to verify communication works */
-        APP_B1_SendADCData(s_adc_cfg.raw_value);
-        
-        /* Toggle LED to show ADC read attempt */
-        GPIO_SRV_Toggle(APP_B1_LED_RED_PORT, APP_B1_LED_RED_PIN);
-    }
-    else {
-        /* ADC failed - send error code 0xFFFF */
-        APP_B1_SendADCData(0xFFFF);
+    s_sample_count++;
+    WDOG_SRV_CheckIn(s_wdog_sample_task);
+    
+    /* The timer reloaded at this sample with the period written before it */
+    s_interval_ms = (uint16_t)(s_lpit_cfg.period_us / 1000U);
+    if (s_adaptive) {
+        APP_B1_AdaptPeriod(sample, interval_ms);
     }
+    
+    /* Send via CAN - always send even if value is 0 to verify communication works */
+    APP_B1_SendADCData(sample, interval_ms);
+    
+    /* Toggle LED to show ADC read attempt */
+    APP_B1_LedRed_Toggle();
 }
 
 /**
  * @brief Send ADC data via CAN
- * @details Format: byte0-byte7 = ADC value in BCD
- *          Example: ADC=456 -> [0,0,0,0,0,4,5,6]
+ * @details Format: byte0-byte3 = period since the previous sample in ms,
+ *          byte4-byte7 = ADC value, both in BCD
+ *          Example: ADC=456 after 10 ms -> [0,0,1,0,0,4,5,6]
  */
-static void APP_B1_SendADCData(uint16_t adc_value)
+static void APP_B1_SendADCData(uint16_t adc_value, uint16_t period_ms)
 {
     can_srv_message_t msg;
     uint16_t temp = adc_value;
     
     /* Prepare CAN message */
-    msg.id = APP_B1_DATA_ID;
+    msg.id = s_data_id;
     msg.dlc = 8;
     msg.isExtended = false;
     msg.isRemote = false;
@@ -181,14 +445,769 @@ static void APP_B1_SendADCData(uint16_t adc_value)
     /* Convert ADC value to BCD format (right-aligned in 8 bytes) */
     memset(msg.data, 0, 8);
     
-    for (int8_t i = 7; i >= 0 && temp > 0; i--) {
+    for (int8_t i = 7; i >= 4 && temp > 0; i--) {
         msg.data[i] = temp % 10;
         temp /= 10;
     }
     
-    /* Send message */
-    CAN_SRV_Send(&msg);
-    GPIO_SRV_Toggle(APP_B1_LED_RED_PORT, APP_B1_LED_RED_PIN);  /* Toggle LED on CAN TX */
+    temp = (period_ms > APP_B1_DATA_MAX_PERIOD_MS) ? APP_B1_DATA_MAX_PERIOD_MS : period_ms;
+    for (int8_t i = 3; i >= 0 && temp > 0; i--) {
+        msg.data[i] = temp % 10;
+        temp /= 10;
+    }
+    
+    /* Send message - dropped if the previous sample is still waiting for the bus */
+    if (CAN_SRV_SendOn(s_tx_mb, &msg) == CAN_SRV_SUCCESS) {
+        APP_B1_LedRed_Toggle();  /* Toggle LED on CAN TX */
+    }
+}
+
+/**
+ * @brief NMT state change (CAN interrupt)
+ */
+static void APP_B1_CONmtCallback(co_srv_nmt_state_t state)
+{
+    if (state == CO_SRV_NMT_OPERATIONAL) {
+        APP_B1_StartADCSampling();
+    } else {
+        APP_B1_StopADCSampling();
+    }
+}
+
+/**
+ * @brief RPDO received (CAN interrupt)
+ */
+static void APP_B1_CORpdoCallback(uint8_t pdo)
+{
+    if (pdo == 0U) {
+        /* Same path as APP_B1_CMD_SET_PERIOD */
+        s_pending_period_ms = s_co_period_ms;
+    }
+}
+
+/**
+ * @brief Join the CANopen network
+ * @details Runs next to the legacy command/data IDs: a SYNC samples the
+ *          latest conversion into TPDO1 without touching the main loop.
+ */
+static app_b1_status_t APP_B1_InitCANopen(void)
+{
+    co_srv_config_t co_cfg;
+    co_srv_pdo_config_t pdo_cfg;
+    
+    co_cfg.node_id = APP_B1_CO_NODE_ID;
+    co_cfg.od = s_co_od;
+    co_cfg.od_count = (uint16_t)(sizeof(s_co_od) / sizeof(s_co_od[0]));
+    co_cfg.heartbeat_ms = APP_B1_CO_HEARTBEAT_MS;
+    co_cfg.auto_start = false;
+    co_cfg.on_nmt = APP_B1_CONmtCallback;
+    co_cfg.on_rpdo = APP_B1_CORpdoCallback;
+    
+    if (CO_SRV_Init(&co_cfg) != CO_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    pdo_cfg.cob_id = 0U;
+    pdo_cfg.transmission = 1U;
+    pdo_cfg.count = (uint8_t)(sizeof(s_co_tpdo1_map) / sizeof(s_co_tpdo1_map[0]));
+    pdo_cfg.map = s_co_tpdo1_map;
+    if (CO_SRV_ConfigTpdo(0U, &pdo_cfg) != CO_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    pdo_cfg.transmission = CO_SRV_PDO_EVENT;
+    pdo_cfg.count = (uint8_t)(sizeof(s_co_rpdo1_map) / sizeof(s_co_rpdo1_map[0]));
+    pdo_cfg.map = s_co_rpdo1_map;
+    if (CO_SRV_ConfigRpdo(0U, &pdo_cfg) != CO_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    /* Boot-up message, then pre-operational until the master starts us */
+    if (CO_SRV_Start() != CO_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    return APP_B1_SUCCESS;
+}
+
+/**
+ * @brief Restart the sampling jitter measurement
+ * @details The first interval after a (re)start is not compared. Periods
+ *          that overflow the 32-bit cycle counter are not measured.
+ */
+static void APP_B1_ResetJitter(void)
+{
+    uint32_t period_us = s_lpit_cfg.period_us;
+    
+    s_jitter_armed = false;
+    s_jitter_max_cycles = 0U;
+    s_expected_cycles = (s_cycles_per_us != 0U && period_us < (0xFFFFFFFFUL / s_cycles_per_us))
+                        ? period_us * s_cycles_per_us : 0U;
+}
+
+static void APP_B1_PutU32(uint8_t *out, uint32_t value)
+{
+    out[0] = (uint8_t)(value >> 24);
+    out[1] = (uint8_t)(value >> 16);
+    out[2] = (uint8_t)(value >> 8);
+    out[3] = (uint8_t)value;
+}
+
+/**
+ * @brief DID 0x0102 read: active sample period in ms
+ */
+static void APP_B1_DidReadPeriod(uint8_t *out)
+{
+    uint32_t period_ms = s_sample_period_us / 1000U;
+    
+    out[0] = (uint8_t)(period_ms >> 8);
+    out[1] = (uint8_t)period_ms;
+}
+
+/**
+ * @brief DID 0x0102 write: same path as APP_B1_CMD_SET_PERIOD
+ */
+static uint8_t APP_B1_DidWritePeriod(const uint8_t *in)
+{
+    uint16_t period_ms = (uint16_t)(((uint16_t)in[0] << 8) | in[1]);
+    
+    if (period_ms == 0U) {
+        return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+    }
+    
+    s_pending_period_ms = period_ms;
+    
+    return UDS_SRV_NRC_OK;
+}
+
+/**
+ * @brief DID 0x0103 read: worst sample interval deviation in us
+ */
+static void APP_B1_DidReadJitter(uint8_t *out)
+{
+    APP_B1_PutU32(out, (s_cycles_per_us != 0U) ? (s_jitter_max_cycles / s_cycles_per_us) : 0U);
+}
+
+/**
+ * @brief DID 0x0104 read: worst UDS request handling time in us
+ */
+static void APP_B1_DidReadRequestTime(uint8_t *out)
+{
+    uds_srv_stats_t stats;
+    
+    if (UDS_SRV_GetStats(&stats) != UDS_SRV_SUCCESS) {
+        stats.max_request_us = 0U;
+    }
+    APP_B1_PutU32(out, stats.max_request_us);
+}
+
+/**
+ * @brief DID 0x0105 read: network time of the latest sample
+ * @details The ADC interrupt only keeps its cycle stamp, converted here.
+ */
+static void APP_B1_DidReadSampleTime(uint8_t *out)
+{
+    tsyn_srv_time_t time = {0};
+    
+    if (s_sample_count == 0U ||
+        TSYN_SRV_ToNetworkTime(TSYN_SRV_GetLocalTimeAt(s_last_sample_cycles), &time) != TSYN_SRV_SUCCESS) {
+        time.seconds = 0U;
+        time.nanoseconds = 0U;
+    }
+    APP_B1_PutU32(&out[0], time.seconds);
+    APP_B1_PutU32(&out[4], time.nanoseconds);
+}
+
+/**
+ * @brief DID 0x0106 read: synchronized, last and worst sync error in ns
+ */
+static void APP_B1_DidReadTimeSync(uint8_t *out)
+{
+    tsyn_srv_stats_t stats = {0};
+    
+    (void)TSYN_SRV_GetStats(&stats);
+    out[0] = TSYN_SRV_IsSynchronized() ? 1U : 0U;
+    APP_B1_PutU32(&out[1], (uint32_t)stats.last_error_ns);
+    APP_B1_PutU32(&out[5], stats.max_error_ns);
+}
+
+/**
+ * @brief DID 0x0107 read: latest sample through the channel's calibration table
+ */
+static void APP_B1_DidReadInput(uint8_t *out)
+{
+    int32_t value = 0;
+    
+    (void)LUT_SRV_Convert(APP_B1_ADC_CHANNEL, s_last_adc_value, &value);
+    APP_B1_PutU32(out, (uint32_t)value);
+}
+
+/**
+ * @brief Routine 0x0200: start/stop sampling, results = state + sample count
+ */
+static uint8_t APP_B1_RoutineSampling(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                      uint8_t *result, uint16_t *result_length)
+{
+    (void)option;
+    (void)option_length;
+    
+    switch (control) {
+        case UDS_SRV_ROUTINE_START:
+            APP_B1_StartADCSampling();
+            break;
+            
+        case UDS_SRV_ROUTINE_STOP:
+            APP_B1_StopADCSampling();
+            break;
+            
+        default:
+            result[0] = (uint8_t)s_app_state;
+            APP_B1_PutU32(&result[1], s_sample_count);
+            *result_length = 5U;
+            break;
+    }
+    
+    return UDS_SRV_NRC_OK;
+}
+
+/**
+ * @brief Routine 0x0201: restart the jitter measurement
+ */
+static uint8_t APP_B1_RoutineResetJitter(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                         uint8_t *result, uint16_t *result_length)
+{
+    (void)option;
+    (void)option_length;
+    (void)result;
+    (void)result_length;
+    
+    if (control != UDS_SRV_ROUTINE_START) {
+        return UDS_SRV_NRC_SUBFUNCTION_NOT_SUPPORTED;
+    }
+    
+    APP_B1_ResetJitter();
+    
+    return UDS_SRV_NRC_OK;
+}
+
+/**
+ * @brief Routine 0x0202: spectrum mode, results = state + blocks + overruns
+ */
+static uint8_t APP_B1_RoutineSpectrum(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                      uint8_t *result, uint16_t *result_length)
+{
+    uint16_t period_us = APP_B1_SPECTRUM_PERIOD_US;
+    
+    switch (control) {
+        case UDS_SRV_ROUTINE_START:
+            if (option_length >= 2U) {
+                period_us = (uint16_t)(((uint16_t)option[0] << 8) | option[1]);
+            }
+            if (APP_B1_StartSpectrum(period_us) != APP_B1_SUCCESS) {
+                return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+            }
+            break;
+            
+        case UDS_SRV_ROUTINE_STOP:
+            if (s_app_state == APP_B1_STATE_SPECTRUM) {
+                APP_B1_StopADCSampling();
+            }
+            break;
+            
+        default:
+            result[0] = (uint8_t)s_app_state;
+            APP_B1_PutU32(&result[1], s_spectrum_blocks);
+            APP_B1_PutU32(&result[5], s_spectrum_overruns);
+            *result_length = 9U;
+            break;
+    }
+    
+    return UDS_SRV_NRC_OK;
+}
+
+/**
+ * @brief Routine 0x0203: capture mode, results = state + captures sent
+ */
+static uint8_t APP_B1_RoutineCapture(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                     uint8_t *result, uint16_t *result_length)
+{
+    scope_srv_arm_t arm;
+    uint16_t period_us = APP_B1_CAPTURE_PERIOD_US;
+    
+    switch (control) {
+        case UDS_SRV_ROUTINE_START:
+            if (option_length < 4U || option[0] > (uint8_t)SCOPE_SRV_TRIGGER_EXTERNAL) {
+                return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+            }
+            arm.type = (scope_srv_trigger_t)option[0];
+            arm.falling = (option[1] != 0U);
+            arm.threshold = (uint16_t)(((uint16_t)option[2] << 8) | option[3]);
+            if (option_length >= 6U) {
+                period_us = (uint16_t)(((uint16_t)option[4] << 8) | option[5]);
+            }
+            if (APP_B1_StartCapture(&arm, period_us) != APP_B1_SUCCESS) {
+                return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+            }
+            break;
+            
+        case UDS_SRV_ROUTINE_STOP:
+            if (s_app_state == APP_B1_STATE_CAPTURE) {
+                APP_B1_StopADCSampling();
+            }
+            break;
+            
+        default:
+            result[0] = (uint8_t)s_app_state;
+            APP_B1_PutU32(&result[1], s_captures_sent);
+            *result_length = 5U;
+            break;
+    }
+    
+    return UDS_SRV_NRC_OK;
+}
+
+/**
+ * @brief Routine 0x0204: adaptive sampling, results = state, adaptive, period and sample count
+ */
+static uint8_t APP_B1_RoutineAdaptive(uint8_t control, const uint8_t *option, uint16_t option_length,
+                                      uint8_t *result, uint16_t *result_length)
+{
+    uint16_t min_period_ms = APP_B1_ADAPTIVE_MIN_PERIOD_MS;
+    uint16_t slope = APP_B1_ADAPTIVE_SLOPE;
+    uint16_t deviation = APP_B1_ADAPTIVE_DEVIATION;
+    
+    switch (control) {
+        case UDS_SRV_ROUTINE_START:
+            if (option_length >= 2U) {
+                min_period_ms = (uint16_t)(((uint16_t)option[0] << 8) | option[1]);
+            }
+            if (option_length >= 6U) {
+                slope = (uint16_t)(((uint16_t)option[2] << 8) | option[3]);
+                deviation = (uint16_t)(((uint16_t)option[4] << 8) | option[5]);
+            }
+            if (APP_B1_StartAdaptive(min_period_ms, slope, deviation) != APP_B1_SUCCESS) {
+                return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+            }
+            break;
+            
+        case UDS_SRV_ROUTINE_STOP:
+            APP_B1_StopAdaptive();
+            break;
+            
+        default:
+            result[0] = (uint8_t)s_app_state;
+            result[1] = s_adaptive ? 1U : 0U;
+            result[2] = (uint8_t)(s_interval_ms >> 8);
+            result[3] = (uint8_t)s_interval_ms;
+            APP_B1_PutU32(&result[4], s_sample_count);
+            *result_length = 8U;
+            break;
+    }
+    
+    return UDS_SRV_NRC_OK;
+}
+
+/**
+ * @brief Start the diagnostic server
+ * @details Requests are served from APP_B1_Process(); the CAN interrupt
+ *          only copies frames, so a tester polling DIDs does not delay
+ *          the ADC interrupt. DID 0x0103 reports the resulting jitter.
+ */
+static app_b1_status_t APP_B1_InitDiagnostics(void)
+{
+    clock_srv_frequencies_t freq;
+    uds_srv_config_t uds_cfg;
+    
+    if (CLOCK_SRV_GetFrequencies(&freq) != CLOCK_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    s_cycles_per_us = freq.core_hz / 1000000U;
+    DWT_CycleCounterStart();
+    APP_B1_ResetJitter();
+    
+    uds_cfg.rx_id = APP_B1_UDS_RX_ID;
+    uds_cfg.tx_id = APP_B1_UDS_TX_ID;
+    uds_cfg.functional_id = APP_B1_UDS_FUNCTIONAL_ID;
+    uds_cfg.dids = s_uds_dids;
+    uds_cfg.did_count = (uint8_t)(sizeof(s_uds_dids) / sizeof(s_uds_dids[0]));
+    uds_cfg.routines = s_uds_routines;
+    uds_cfg.routine_count = (uint8_t)(sizeof(s_uds_routines) / sizeof(s_uds_routines[0]));
+    uds_cfg.on_session = NULL;
+    
+    if (UDS_SRV_Init(&uds_cfg) != UDS_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    return APP_B1_SUCCESS;
+}
+
+/**
+ * @brief Change the sample period and persist it
+ * @details Restarts the LPIT channel when sampling is active.
+ */
+static void APP_B1_ApplySamplePeriod(uint16_t period_ms)
+{
+    if (period_ms == 0U) {
+        return;
+    }
+    
+    s_sample_period_us = (uint32_t)period_ms * 1000U;
+    
+    /* Spectrum and capture modes keep their rate, the new period applies when they stop */
+    if (s_app_state == APP_B1_STATE_IDLE || s_app_state == APP_B1_STATE_SAMPLING) {
+        if (s_lpit_cfg.is_running) {
+            LPIT_SRV_Stop(&s_lpit_cfg);
+        }
+        
+        APP_B1_ConfigTimer(s_sample_period_us, (uint32_t)period_ms * APP_B1_WDOG_SAMPLE_PERIODS);
+        s_interval_ms = period_ms;
+        
+        if (s_app_state == APP_B1_STATE_SAMPLING) {
+            LPIT_SRV_Start(&s_lpit_cfg);
+        }
+        
+        /* Adaptive mode restarts from the new normal period */
+        if (s_adaptive) {
+            s_expected_cycles = 0U;
+            s_adaptive_quiet = 0U;
+        }
+    }
+    
+    /* Deferred - written to FlexRAM by NVM_SRV_Process() */
+    NVM_SRV_Write(NVM_SRV_KEY_SAMPLE_PERIOD_MS, period_ms);
+}
+
+/**
+ * @brief Reprogram the stopped LPIT channel and the sampling deadline
+ * @param deadline_ms 0 keeps the current deadline (task left suspended)
+ */
+static void APP_B1_ConfigTimer(uint32_t period_us, uint32_t deadline_ms)
+{
+    s_lpit_cfg.period_us = period_us;
+    LPIT_SRV_Config(&s_lpit_cfg, APP_B1_LPITCallback);
+    APP_B1_ResetJitter();
+    if (deadline_ms != 0U) {
+        WDOG_SRV_SetDeadline(s_wdog_sample_task, deadline_ms);
+    }
+}
+
+/**
+ * @brief Sample at a rate that follows the input activity
+ * @details Starts normal sampling if needed. The period only moves between
+ *          min_period_ms and the normal period, so the sampling deadline
+ *          of the normal period still holds.
+ * @param slope Counts per second between two samples that count as activity
+ * @param deviation Standard deviation in counts that counts as activity
+ */
+static app_b1_status_t APP_B1_StartAdaptive(uint16_t min_period_ms, uint16_t slope, uint16_t deviation)
+{
+    if (min_period_ms == 0U || ((uint32_t)min_period_ms * 1000U) > s_sample_period_us) {
+        return APP_B1_INVALID_PARAM;
+    }
+    
+    if (s_app_state != APP_B1_STATE_SAMPLING) {
+        APP_B1_StartADCSampling();
+    }
+    
+    s_adaptive_min_ms = min_period_ms;
+    s_adaptive_slope = slope;
+    s_adaptive_deviation = deviation;
+    s_adaptive_quiet = 0U;
+    s_adaptive_primed = false;
+    s_adaptive = true;
+    
+    /* The interval varies on purpose, it is not compared */
+    s_expected_cycles = 0U;
+    
+    return APP_B1_SUCCESS;
+}
+
+/**
+ * @brief Back to the normal period, sampling continues
+ */
+static void APP_B1_StopAdaptive(void)
+{
+    if (!s_adaptive) {
+        return;
+    }
+    
+    s_adaptive = false;
+    if (s_app_state == APP_B1_STATE_SAMPLING) {
+        LPIT_SRV_SetPeriod(&s_lpit_cfg, s_sample_period_us);
+        APP_B1_ResetJitter();
+    }
+}
+
+/**
+ * @brief Pick the period after this sample (fast attack, slow release)
+ * @details Activity is a step faster than the slope threshold or a running
+ *          variance above deviation^2. The new period is written to the
+ *          running timer, which loads it at the next trigger: the rate
+ *          changes between two samples, without a gap.
+ * @param interval_ms Period that ended at this sample
+ */
+static void APP_B1_AdaptPeriod(uint16_t sample, uint16_t interval_ms)
+{
+    uint32_t period_ms = s_lpit_cfg.period_us / 1000U;
+    uint32_t max_ms = s_sample_period_us / 1000U;
+    uint32_t next_ms = period_ms;
+    uint32_t step;
+    int32_t diff;
+    bool active;
+    
+    if (!s_adaptive_primed) {
+        s_adaptive_prev = sample;
+        s_adaptive_mean_q4 = (int32_t)sample << 4;
+        s_adaptive_var = 0;
+        s_adaptive_primed = true;
+        return;
+    }
+    
+    step = (sample > s_adaptive_prev) ? (uint32_t)(sample - s_adaptive_prev)
+                                      : (uint32_t)(s_adaptive_prev - sample);
+    s_adaptive_prev = sample;
+    
+    /* Exponential averages over 2^APP_B1_ADAPTIVE_SHIFT samples */
+    s_adaptive_mean_q4 += (((int32_t)sample << 4) - s_adaptive_mean_q4) >> APP_B1_ADAPTIVE_SHIFT;
+    diff = (int32_t)sample - (s_adaptive_mean_q4 >> 4);
+    s_adaptive_var += ((diff * diff) - s_adaptive_var) >> APP_B1_ADAPTIVE_SHIFT;
+    
+    /* step / interval > slope / 1000, without dividing */
+    active = ((step * 1000U) > ((uint32_t)s_adaptive_slope * interval_ms)) ||
+             ((uint32_t)s_adaptive_var > ((uint32_t)s_adaptive_deviation * s_adaptive_deviation));
+    
+    if (active) {
+        s_adaptive_quiet = 0U;
+        next_ms = s_adaptive_min_ms;
+    } else if (++s_adaptive_quiet >= APP_B1_ADAPTIVE_HOLD) {
+        s_adaptive_quiet = 0U;
+        next_ms = period_ms * 2U;
+    }
+    
+    if (next_ms > max_ms) {
+        next_ms = max_ms;
+    }
+    
+    if (next_ms != period_ms) {
+        LPIT_SRV_SetPeriod(&s_lpit_cfg, next_ms * 1000U);
+    }
+}
+
+/**
+ * @brief Sample blocks at period_us and send their FFT peaks
+ * @details Same LPIT -> PDB0 -> ADC chain as normal sampling, only faster;
+ *          the ADC interrupt stores samples instead of flagging each one.
+ */
+static app_b1_status_t APP_B1_StartSpectrum(uint16_t period_us)
+{
+    uint32_t block_ms;
+    
+    if (period_us < APP_B1_SPECTRUM_MIN_PERIOD_US) {
+        return APP_B1_INVALID_PARAM;
+    }
+    
+    APP_B1_StopADCSampling();
+    
+    s_spectrum_fill = 0;
+    s_spectrum_write = 0;
+    s_spectrum_ready = false;
+    s_spectrum_overruns = 0;
+    s_spectrum_blocks = 0;
+    s_sample_count = 0;
+    
+    /* The supervised step is a block, rounded up to 1 ms */
+    block_ms = (((uint32_t)period_us * APP_B1_SPECTRUM_SIZE) + 999U) / 1000U;
+    APP_B1_ConfigTimer(period_us, block_ms * APP_B1_WDOG_SAMPLE_PERIODS);
+    
+    s_app_state = APP_B1_STATE_SPECTRUM;
+    LPIT_SRV_Start(&s_lpit_cfg);
+    WDOG_SRV_Resume(s_wdog_sample_task);
+    
+    return APP_B1_SUCCESS;
+}
+
+/**
+ * @brief Analyse a complete block and send its peaks
+ */
+static void APP_B1_ProcessSpectrum(void)
+{
+    fft_srv_peak_t peaks[APP_B1_SPECTRUM_PEAKS];
+    can_srv_message_t *msg;
+    uint32_t frequency;
+    uint8_t count;
+    
+    /* Copy out first so the block can be refilled during the transform */
+    FFT_SRV_LoadSamples(s_spectrum_block[s_spectrum_write ^ 1U], APP_B1_SPECTRUM_SIZE,
+                        FFT_SRV_WINDOW_HANN, s_spectrum_work);
+    s_spectrum_ready = false;
+    
+    s_sample_count += APP_B1_SPECTRUM_SIZE;
+    s_spectrum_blocks++;
+    WDOG_SRV_CheckIn(s_wdog_sample_task);
+    
+    FFT_SRV_Transform(s_spectrum_work, APP_B1_SPECTRUM_SIZE);
+    count = FFT_SRV_FindPeaks(s_spectrum_work, APP_B1_SPECTRUM_SIZE, FFT_SRV_WINDOW_HANN,
+                              APP_B1_SPECTRUM_MIN_AMPLITUDE, peaks, APP_B1_SPECTRUM_PEAKS);
+    
+    /* Peaks of the previous block not sent by now are replaced */
+    for (uint8_t i = 0; i < count; i++) {
+        /* bins / 256 * fs / N, fs = 10^7 / period_us in 0.1 Hz */
+        frequency = (uint32_t)(((uint64_t)peaks[i].bin_q8 * 10000000ULL) /
+                               ((uint64_t)s_lpit_cfg.period_us * APP_B1_SPECTRUM_SIZE * 256U));
+        
+        msg = &s_spectrum_tx[i];
+        msg->id = APP_B1_SPECTRUM_ID;
+        msg->dlc = 7;
+        msg->isExtended = false;
+        msg->isRemote = false;
+        msg->data[0] = (uint8_t)s_spectrum_blocks;
+        msg->data[1] = (uint8_t)((i << 4) | count);
+        msg->data[2] = (uint8_t)(frequency >> 16);
+        msg->data[3] = (uint8_t)(frequency >> 8);
+        msg->data[4] = (uint8_t)frequency;
+        msg->data[5] = (uint8_t)(peaks[i].amplitude >> 8);
+        msg->data[6] = (uint8_t)peaks[i].amplitude;
+    }
+    s_spectrum_tx_count = count;
+    s_spectrum_tx_next = 0;
+    
+    APP_B1_SendSpectrumPeaks();
+}
+
+/**
+ * @brief Send staged peaks while the mailbox is free, the rest on later passes
+ */
+static void APP_B1_SendSpectrumPeaks(void)
+{
+    while (s_spectrum_tx_next < s_spectrum_tx_count &&
+           CAN_SRV_SendOn(s_tx_mb, &s_spectrum_tx[s_spectrum_tx_next]) == CAN_SRV_SUCCESS) {
+        s_spectrum_tx_next++;
+    }
+}
+
+/**
+ * @brief Any frame on APP_B1_CAPTURE_TRIGGER_ID triggers a capture (CAN interrupt)
+ */
+static void APP_B1_TriggerCallback(uint8_t instance, can_srv_event_t event, const can_srv_message_t *message)
+{
+    (void)instance;
+    
+    if (event == CAN_SRV_EVENT_RX_COMPLETE && message != NULL &&
+        message->id == APP_B1_CAPTURE_TRIGGER_ID && !message->isExtended) {
+        SCOPE_SRV_ForceTrigger();
+    }
+}
+
+/**
+ * @brief Capture channel receive (nothing is defined, ignored)
+ */
+static void APP_B1_CaptureReceive(uint8_t channel, const uint8_t *data, uint16_t length, bool functional)
+{
+    (void)channel;
+    (void)data;
+    (void)length;
+    (void)functional;
+}
+
+/**
+ * @brief Set up the capture buffer, its ISO-TP channel and the CAN trigger
+ */
+static app_b1_status_t APP_B1_InitCapture(void)
+{
+    scope_srv_config_t scope_cfg;
+    isotp_srv_config_t tp_cfg;
+    
+    scope_cfg.buffer = s_capture_history;
+    scope_cfg.size = APP_B1_CAPTURE_SIZE;
+    scope_cfg.pre = APP_B1_CAPTURE_PRE;
+    scope_cfg.post = APP_B1_CAPTURE_POST;
+    if (SCOPE_SRV_Init(&scope_cfg) != SCOPE_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    tp_cfg.rx_id = APP_B1_CAPTURE_RX_ID;
+    tp_cfg.tx_id = APP_B1_CAPTURE_TX_ID;
+    tp_cfg.functional_id = 0U;
+    tp_cfg.block_size = 0U;
+    tp_cfg.st_min = 0U;
+    tp_cfg.rx_buffer = s_capture_rx;
+    tp_cfg.rx_size = sizeof(s_capture_rx);
+    tp_cfg.on_receive = APP_B1_CaptureReceive;
+    tp_cfg.on_tx_done = NULL;
+    if (ISOTP_SRV_Open(&tp_cfg, &s_capture_channel) != ISOTP_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    if (CAN_SRV_AddRxFilter(APP_B1_CAPTURE_TRIGGER_ID, 0x7FFU, false) != CAN_SRV_SUCCESS ||
+        CAN_SRV_RegisterCallback(APP_B1_TriggerCallback) != CAN_SRV_SUCCESS) {
+        return APP_B1_ERROR;
+    }
+    
+    return APP_B1_SUCCESS;
+}
+
+/**
+ * @brief Sample at period_us and send a window around each trigger
+ * @details Not supervised per sample: a trigger may never come.
+ */
+static app_b1_status_t APP_B1_StartCapture(const scope_srv_arm_t *arm, uint16_t period_us)
+{
+    if (period_us < APP_B1_SPECTRUM_MIN_PERIOD_US) {
+        return APP_B1_INVALID_PARAM;
+    }
+    
+    APP_B1_StopADCSampling();
+    
+    s_capture_arm = *arm;
+    if (SCOPE_SRV_Arm(&s_capture_arm) != SCOPE_SRV_SUCCESS) {
+        return APP_B1_INVALID_PARAM;
+    }
+    s_captures_sent = 0;
+    s_sample_count = 0;
+    
+    APP_B1_ConfigTimer(period_us, 0U);
+    
+    s_app_state = APP_B1_STATE_CAPTURE;
+    LPIT_SRV_Start(&s_lpit_cfg);
+    
+    return APP_B1_SUCCESS;
+}
+
+/**
+ * @brief Send a frozen capture and re-arm
+ * @details Waits while the previous capture is still being sent; the
+ *          history is packed into the TX buffer first, so re-arming right
+ *          after does not disturb the transfer.
+ */
+static void APP_B1_ProcessCapture(void)
+{
+    scope_srv_capture_t info;
+    uint16_t length;
+    
+    if (SCOPE_SRV_GetState() != SCOPE_SRV_STATE_DONE || ISOTP_SRV_IsBusy(s_capture_channel)) {
+        return;
+    }
+    
+    length = SCOPE_SRV_ReadPacked(&s_capture_tx[APP_B1_CAPTURE_HEADER],
+                                  (uint16_t)(sizeof(s_capture_tx) - APP_B1_CAPTURE_HEADER), &info);
+    SCOPE_SRV_Arm(&s_capture_arm);
+    if (length == 0U) {
+        return;
+    }
+    
+    s_captures_sent++;
+    s_sample_count += (uint32_t)info.pre + info.post;
+    
+    s_capture_tx[0] = (uint8_t)info.source;
+    s_capture_tx[1] = (uint8_t)s_captures_sent;
+    s_capture_tx[2] = (uint8_t)(info.pre >> 8);
+    s_capture_tx[3] = (uint8_t)info.pre;
+    s_capture_tx[4] = (uint8_t)(info.post >> 8);
+    s_capture_tx[5] = (uint8_t)info.post;
+    s_capture_tx[6] = (uint8_t)(s_lpit_cfg.period_us >> 8);
+    s_capture_tx[7] = (uint8_t)s_lpit_cfg.period_us;
+    
+    ISOTP_SRV_Send(s_capture_channel, s_capture_tx, (uint16_t)(APP_B1_CAPTURE_HEADER + length));
 }
 
 /*******************************************************************************
@@ -197,12 +1216,14 @@ static void APP_B1_SendADCData(uint16_t adc_value)
 
 app_b1_status_t APP_B1_Init(void)
 {
-    can_srv_config_t can_cfg;
     port_srv_pin_config_t port_cfg;
     
     /* Initialize clock system (160 MHz) */
     CLOCK_SRV_InitPreset(RUN_160MHz);
     
+    /* Code cache: flash runs with wait states at 160 MHz */
+    CACHE_SRV_Init();
+    
     /* Enable peripheral clocks */
     CLOCK_SRV_EnablePeripheral(CLOCK_SRV_FLEXCAN0, CLOCK_SRV_PCS_NONE);
     CLOCK_SRV_EnablePeripheral(CLOCK_SRV_ADC0, CLOCK_SRV_PCS_SOSCDIV2);
@@ -222,6 +1243,31 @@ app_b1_status_t APP_B1_Init(void)
         return APP_B1_ERROR;
     }
     
+    /* Stored settings - on failure the compile-time defaults are used */
+    NVM_SRV_Init();
+    
+    /* Configure CAN0 pins - PTE4 (RX) and PTE5 (TX) as ALT5 */
+    port_cfg.port = 4;  /* Port E */
+    port_cfg.pin = 4;   /* PTE4 - CAN0_RX */
+    port_cfg.mux = PORT_SRV_MUX_ALT5;
+    port_cfg.pull = PORT_SRV_PULL_DISABLE;
+    port_cfg.interrupt = PORT_SRV_INT_DISABLE;
+    PORT_SRV_ConfigPin(&port_cfg);
+    
+    port_cfg.pin = 5;   /* PTE5 - CAN0_TX */
+    PORT_SRV_ConfigPin(&port_cfg);
+    
+    return APP_B1_InitComponent();
+}
+
+app_b1_status_t APP_B1_InitComponent(void)
+{
+    can_srv_config_t can_cfg;
+    port_srv_pin_config_t port_cfg;
+    trgmux_srv_route_t route;
+    tsyn_srv_config_t tsyn_cfg;
+    uint8_t lpit_channel;
+    
     /* Configure Red LED (PTD15) */
     port_cfg.port = APP_B1_LED_RED_PORT;
     port_cfg.pin = APP_B1_LED_RED_PIN;
@@ -256,33 +1302,28 @@ app_b1_status_t APP_B1_Init(void)
     }
 
 #endif
-    /* Configure CAN0 pins - PTE4 (RX) and PTE5 (TX) as ALT5 */
-    port_cfg.port = 4;  /* Port E */
-    port_cfg.pin = 4;   /* PTE4 - CAN0_RX */
-    port_cfg.mux = PORT_SRV_MUX_ALT5;
-    port_cfg.pull = PORT_SRV_PULL_DISABLE;
-    port_cfg.interrupt = PORT_SRV_INT_DISABLE;
-    PORT_SRV_ConfigPin(&port_cfg);
-    
-    port_cfg.pin = 5;   /* PTE5 - CAN0_TX */
-    PORT_SRV_ConfigPin(&port_cfg);
+
+    /* Load runtime settings */
+    s_cmd_id = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_CMD_ID, APP_B1_CMD_ID);
+    s_data_id = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_DATA_ID, APP_B1_DATA_ID);
     
     /* Initialize CAN (receive commands, send data) */
-    can_cfg.baudrate = APP_B1_CAN_BAUDRATE;
-    can_cfg.filter_id = APP_B1_CMD_ID;      /* Primary: Accept command messages */
-    can_cfg.filter_mask = 0x7FF;            /* Match exact ID */
+    can_cfg.baudrate = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_CAN_BAUDRATE, APP_B1_CAN_BAUDRATE);
+    can_cfg.filter_id = s_cmd_id;           /* Primary: Accept command messages */
+    can_cfg.filter_mask = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_CAN_FILTER_MASK, 0x7FF);
     can_cfg.filter_extended = false;
-    can_cfg.filter_id2 = APP_B1_DATA_ID;    /* Secondary: Accept data messages (for future use) */
-    can_cfg.filter_mask2 = 0x7FF;           /* Match exact ID */
+    can_cfg.filter_id2 = s_data_id;         /* Secondary: Accept data messages (for future use) */
+    can_cfg.filter_mask2 = can_cfg.filter_mask;
     can_cfg.mode = CAN_MODE_NORMAL;         /* Normal mode for real bus */
     
-    if (CAN_SRV_Init(&can_cfg) != CAN_SRV_SUCCESS) {
+    if (CAN_SRV_Init(&can_cfg) != CAN_SRV_SUCCESS ||
+        CAN_SRV_AllocTxMailbox(&s_tx_mb) != CAN_SRV_SUCCESS) {
         s_app_state = APP_B1_STATE_ERROR;
         return APP_B1_ERROR;
     }
     
-    /* Register CAN callback */
-    if (CAN_SRV_RegisterCallback(APP_B1_CANCallback) != CAN_SRV_SUCCESS) {
+    /* Commands from Board 2 (authenticated) */
+    if (APP_B1_InitSecOC() != APP_B1_SUCCESS) {
         s_app_state = APP_B1_STATE_ERROR;
         return APP_B1_ERROR;
     }
@@ -293,11 +1334,20 @@ app_b1_status_t APP_B1_Init(void)
         return APP_B1_ERROR;
     }
     
-    /* Configure ADC (channel 0, blocking mode) */
-    s_adc_cfg.channel = APP_B1_ADC_CHANNEL;
-    s_adc_cfg.interrupt = ADC_CONVERSION_INTERRUPT_DISABLE;  /* Disable interrupt for blocking mode */
-    s_adc_cfg.is_calibrated = false;
-    s_adc_cfg.user_callback = NULL;
+    /* One-slot sequence: PDB0 starts the conversion a fixed delay after
+       each LPIT trigger, the result arrives by ADC interrupt */
+    memset(&s_adc_seq_cfg, 0, sizeof(s_adc_seq_cfg));
+    s_adc_seq_cfg.channels[0] = APP_B1_ADC_CHANNEL;
+    s_adc_seq_cfg.delay_ns[0] = APP_B1_ADC_TRIGGER_DELAY_NS;
+    s_adc_seq_cfg.count = 1U;
+    s_adc_seq_cfg.period_us = 0U;                       /* One conversion per trigger */
+    s_adc_seq_cfg.trigger = ADC_SRV_TRIGGER_INPUT;
+    s_adc_seq_cfg.callback = APP_B1_ADCSequenceCallback;
+    
+    if (ADC_SRV_StartSequence(&s_adc_seq_cfg) != ADC_SRV_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
     
     /* Initialize LPIT service */
     if (LPIT_SRV_Init() != LPIT_SRV_SUCCESS) {
@@ -305,9 +1355,25 @@ app_b1_status_t APP_B1_Init(void)
         return APP_B1_ERROR;
     }
     
+    /* Take a free LPIT channel from the shared registry */
+    if (RES_SRV_Alloc(RES_SRV_LPIT_CHANNEL, APP_B1_RES_OWNER, &lpit_channel) != RES_SRV_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
+    
+    /* LPIT channel -> PDB0 trigger input, no ISR in the sampling path */
+    route.source = (trgmux_source_t)(TRGMUX_SOURCE_LPIT_CH0 + lpit_channel);
+    route.target = TRGMUX_TARGET_PDB0_TRG_IN;
+    if (TRGMUX_SRV_Apply(&route, 1U, false) != TRGMUX_SRV_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
+    
     /* Configure LPIT (1 second timer) */
-    s_lpit_cfg.channel = 0;  /* Channel 0 */
-    s_lpit_cfg.period_us = APP_B1_ADC_SAMPLE_PERIOD_MS * 1000;  /* 1 second */
+    s_lpit_cfg.channel = lpit_channel;
+    s_sample_period_us = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_SAMPLE_PERIOD_MS,
+                                               APP_B1_ADC_SAMPLE_PERIOD_MS) * 1000U;
+    s_lpit_cfg.period_us = s_sample_period_us;
     s_lpit_cfg.is_running = false;
     
     if (LPIT_SRV_Config(&s_lpit_cfg, APP_B1_LPITCallback) != LPIT_SRV_SUCCESS) {
@@ -315,9 +1381,57 @@ app_b1_status_t APP_B1_Init(void)
         return APP_B1_ERROR;
     }
     
-    /* Enable LPIT0 Channel 0 interrupt in NVIC */
-    NVIC_EnableInterrupt(LPIT0_Ch0_IRQn);  /* LPIT0_Ch0_IRQn = 48 */
-    NVIC_SetPriority(LPIT0_Ch0_IRQn, 2);
+    /* Enable LPIT0 channel interrupt in NVIC (channel IRQs are consecutive) */
+    NVIC_EnableInterrupt((IRQn_Type)(LPIT0_Ch0_IRQn + lpit_channel));
+    NVIC_SetPriority((IRQn_Type)(LPIT0_Ch0_IRQn + lpit_channel), 2);
+    
+    /* Supervised once wdog_srv runs (app_node), only while sampling. CAN
+       commands arrive at no fixed rate, so their handling is covered by
+       the main loop reaching WDOG_SRV_Process() rather than by a task. */
+    WDOG_SRV_RegisterTask("b1_sampling", (s_lpit_cfg.period_us / 1000U) * APP_B1_WDOG_SAMPLE_PERIODS,
+                          &s_wdog_sample_task);
+    WDOG_SRV_Suspend(s_wdog_sample_task);
+    
+    if (APP_B1_InitCANopen() != APP_B1_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
+    
+    if (APP_B1_InitDiagnostics() != APP_B1_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
+    
+    /* Network time for sample timestamps (DID 0x0105) */
+    tsyn_cfg.role = TSYN_SRV_ROLE_SLAVE;
+    tsyn_cfg.can_id = APP_B1_TSYN_ID;
+    tsyn_cfg.domain = APP_B1_TSYN_DOMAIN;
+    tsyn_cfg.period_ms = 0U;
+    tsyn_cfg.timeout_ms = APP_B1_TSYN_TIMEOUT_MS;
+    
+    if (TSYN_SRV_Init(&tsyn_cfg) != TSYN_SRV_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
+    
+    /* Engineering units of the sampled input (DID 0x0107) */
+    if (LUT_SRV_Init() != LUT_SRV_SUCCESS ||
+        LUT_SRV_Attach(APP_B1_ADC_CHANNEL, &APP_B1_ADC_CALIBRATION) != LUT_SRV_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
+    
+    /* Spectrum mode (routine 0x0202) */
+    if (FFT_SRV_Init() != FFT_SRV_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
+    
+    /* Capture mode (routine 0x0203) */
+    if (APP_B1_InitCapture() != APP_B1_SUCCESS) {
+        s_app_state = APP_B1_STATE_ERROR;
+        return APP_B1_ERROR;
+    }
     
     /* Set initial state */
     s_app_state = APP_B1_STATE_IDLE;
@@ -325,15 +1439,54 @@ app_b1_status_t APP_B1_Init(void)
     return APP_B1_SUCCESS;
 }
 
+void APP_B1_Process(void)
+{
+    uint16_t period_ms;
+    
+    /* Authenticated commands and diagnostic requests, applied below */
+    SECOC_SRV_Process();
+    UDS_SRV_Process();
+    TSYN_SRV_Process();
+    
+    /* Update requested - flushes pending settings and resets */
+    if (s_boot_request) {
+        s_boot_request = false;
+        APP_B1_StopADCSampling();
+        BOOT_SRV_RequestUpdate();
+    }
+    
+    /* Apply a period change received over CAN */
+    period_ms = s_pending_period_ms;
+    if (period_ms != 0U) {
+        s_pending_period_ms = 0;
+        APP_B1_ApplySamplePeriod(period_ms);
+    }
+    
+    /* Send a sample converted since the last pass */
+    if (s_adc_sample_ready) {
+        s_adc_sample_ready = false;
+        APP_B1_ReadAndSendADC();
+    }
+    
+    /* Send the peaks of a block completed since the last pass */
+    if (s_spectrum_ready) {
+        APP_B1_ProcessSpectrum();
+    } else {
+        APP_B1_SendSpectrumPeaks();
+    }
+    
+    /* Send a frozen capture */
+    if (s_app_state == APP_B1_STATE_CAPTURE) {
+        APP_B1_ProcessCapture();
+    }
+}
+
 void APP_B1_Run(void)
 {
     /* Main loop - all work done in interrupts */
     while (1) {
-        /* Check if ADC sampling requested by timer */
-        if (s_adc_sample_request) {
-            s_adc_sample_request = false;
-            APP_B1_ReadAndSendADC();
-        }
+        APP_B1_Process();
+        NVM_SRV_Process();
         
         /* Could add low power mode here */
         /* __WFI(); */
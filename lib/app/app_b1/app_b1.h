@@ -2,9 +2,18 @@
  * @file    app_b1.h
  * @brief   Board 1 Application API
  * @details Board 1 receives commands via CAN and controls ADC sampling
- *          - Receives START/STOP commands from Board 2
- *          - Reads ADC value every 1 second when enabled
+ *          - Receives START/STOP commands from Board 2 (SecOC authenticated)
+ *          - Reads ADC value every 1 second when enabled (PDB0-timed
+ *            conversion, result by interrupt)
  *          - Sends ADC data to Board 2 via CAN
+ *          - Serves UDS diagnostics (live DIDs, sampling routines)
+ *          - Follows the network time of Board 2 to timestamp samples
+ *          - Spectrum mode: samples blocks at a high rate and sends only
+ *            the strongest FFT peaks (fft_srv)
+ *          - Capture mode: sends the samples around a trigger as one
+ *            ISO-TP message (scope_srv)
+ *          - Adaptive sampling: samples fast while the input moves and
+ *            slows back down to the normal period when it is quiet
  * 
  * @author  PhucPH32
  * @date    07/12/2025
@@ -28,17 +37,93 @@
 /** @brief CAN communication settings */
 #define APP_B1_CAN_BAUDRATE         (500000U)       /* 500 Kbps */
 
-/** @brief CAN Message IDs */
+/** @brief CAN Message IDs (defaults, overridden by values stored in nvm_srv) */
 #define APP_B1_CMD_ID               (0x100U)        /* Command from Board 2 */
-#define APP_B1_DATA_ID              (0x200U)        /* ADC data to Board 2 */
+#define APP_B1_DATA_ID              (0x200U)        /* ADC data to Board 2: [period ms (4 BCD digits), value (4 BCD digits)] */
 
 /** @brief Commands from Board 2 */
 #define APP_B1_CMD_START_ADC        (0x01U)         /* Start ADC sampling */
 #define APP_B1_CMD_STOP_ADC         (0x02U)         /* Stop ADC sampling */
+#define APP_B1_CMD_SET_PERIOD       (0x03U)         /* data[1..2] = period ms (big-endian), persisted */
+#define APP_B1_CMD_ENTER_BOOT       (0x04U)         /* Reset into the CAN bootloader (boot_srv) */
 
-/** @brief ADC sampling settings */
+/** @brief Command authentication (secoc_srv): [cmd, arg hi, arg lo | FV 2 | MAC 3] */
+#define APP_B1_SECOC_DATA_ID        (0x0100U)
+#define APP_B1_SECOC_CMD_BYTES      (3U)
+#define APP_B1_SECOC_FV_BYTES       (2U)
+#define APP_B1_SECOC_MAC_BYTES      (3U)
+
+/** @brief Development AES-128 key, must match APP_B2_SECOC_KEY */
+#define APP_B1_SECOC_KEY            { 0x5EU, 0x0CU, 0x8AU, 0x31U, 0xD2U, 0x47U, 0xB9U, 0x16U, \
+                                      0x63U, 0xF0U, 0x2DU, 0xA8U, 0x74U, 0xC5U, 0x1BU, 0x9EU }
+
+/** @brief CANopen-lite (co_srv): NMT start/stop also start/stop sampling */
+#define APP_B1_CO_NODE_ID           (0x01U)         /* TPDO1 0x181, RPDO1 0x201, heartbeat 0x701 */
+#define APP_B1_CO_HEARTBEAT_MS      (1000U)
+#define APP_B1_CO_ADC_BITS          (12U)           /* TPDO1: ADC bits 0-11, sample count bits 12-27 */
+#define APP_B1_CO_COUNT_BITS        (16U)
+
+/** @brief UDS diagnostics (uds_srv over ISO-TP) */
+#define APP_B1_UDS_RX_ID            (0x7E0U)        /* Physical request */
+#define APP_B1_UDS_TX_ID            (0x7E8U)        /* Response */
+#define APP_B1_UDS_FUNCTIONAL_ID    (0x7DFU)        /* Functional request */
+
+/** @brief Data identifiers (0x22 / 0x2E) */
+#define APP_B1_DID_ADC_VALUE        (0x0100U)       /* Latest raw sample, 2 bytes */
+#define APP_B1_DID_SAMPLE_COUNT     (0x0101U)       /* Samples since START, 4 bytes */
+#define APP_B1_DID_SAMPLE_PERIOD    (0x0102U)       /* Period in ms, 2 bytes, writable in extended session */
+#define APP_B1_DID_SAMPLE_JITTER    (0x0103U)       /* Worst sample interval deviation in us, 4 bytes */
+#define APP_B1_DID_UDS_REQUEST_TIME (0x0104U)       /* Worst UDS request handling time in us, 4 bytes */
+#define APP_B1_DID_SAMPLE_TIME      (0x0105U)       /* Network time of the latest sample: s, ns (8 bytes, 0 = none) */
+#define APP_B1_DID_TIME_SYNC        (0x0106U)       /* Synchronized, last and worst sync error in ns (9 bytes) */
+#define APP_B1_DID_ADC_INPUT        (0x0107U)       /* Latest sample in APP_B1_ADC_CALIBRATION units, signed 4 bytes */
+
+/** @brief Network time (tsyn_srv slave of APP_B2_TSYN_x) */
+#define APP_B1_TSYN_ID              (0x060U)
+#define APP_B1_TSYN_DOMAIN          (0U)
+#define APP_B1_TSYN_TIMEOUT_MS      (3000U)         /* Three missed SYNC periods */
+
+/** @brief Routine identifiers (0x31) */
+#define APP_B1_RID_SAMPLING         (0x0200U)       /* Start/stop sampling, results = state + count */
+#define APP_B1_RID_RESET_JITTER     (0x0201U)       /* Restart the jitter measurement */
+#define APP_B1_RID_SPECTRUM         (0x0202U)       /* Start option = period us (2 bytes, optional), results = state + blocks + overruns */
+#define APP_B1_RID_CAPTURE          (0x0203U)       /* Start option = type, falling, threshold (2)[, period us (2)], results = state + captures */
+#define APP_B1_RID_ADAPTIVE         (0x0204U)       /* Start option = min period ms (2)[, slope (2), deviation (2)], results = state, adaptive, period ms (2), count (4) */
+
+/** @brief Spectrum mode: one frame per peak on APP_B1_SPECTRUM_ID
+ *         [block seq, rank << 4 | count, frequency 0.1 Hz (3), amplitude counts (2)] */
+#define APP_B1_SPECTRUM_ID          (0x210U)
+#define APP_B1_SPECTRUM_SIZE        (512U)          /* Samples per block and FFT points */
+#define APP_B1_SPECTRUM_PERIOD_US   (500U)          /* Default 2 kHz: 256 ms blocks, 1000 Hz span */
+#define APP_B1_SPECTRUM_MIN_PERIOD_US (50U)         /* ADC interrupt per sample */
+#define APP_B1_SPECTRUM_PEAKS       (4U)
+#define APP_B1_SPECTRUM_MIN_AMPLITUDE (8U)          /* Counts, smaller peaks are not sent */
+
+/** @brief Capture mode: ISO-TP message on APP_B1_CAPTURE_TX_ID
+ *         [source, capture seq, pre (2), post (2), period us (2) | 12-bit samples packed] */
+#define APP_B1_CAPTURE_TX_ID        (0x7E9U)
+#define APP_B1_CAPTURE_RX_ID        (0x7E1U)        /* Flow control from the receiver */
+#define APP_B1_CAPTURE_TRIGGER_ID   (0x220U)        /* Any frame: external trigger */
+#define APP_B1_CAPTURE_SIZE         (1024U)         /* History, power of two */
+#define APP_B1_CAPTURE_PRE          (256U)
+#define APP_B1_CAPTURE_POST         (768U)
+#define APP_B1_CAPTURE_PERIOD_US    (100U)          /* Default 10 kHz */
+#define APP_B1_CAPTURE_HEADER       (8U)
+
+/** @brief Adaptive sampling: any activity drops the period to the minimum, every
+ *         APP_B1_ADAPTIVE_HOLD quiet samples double it back up to the normal period */
+#define APP_B1_ADAPTIVE_MIN_PERIOD_MS (10U)
+#define APP_B1_ADAPTIVE_SLOPE       (500U)          /* Counts per second between two samples */
+#define APP_B1_ADAPTIVE_DEVIATION   (16U)           /* Counts, standard deviation around the running mean */
+#define APP_B1_ADAPTIVE_HOLD        (8U)
+#define APP_B1_ADAPTIVE_SHIFT       (3U)            /* Mean and variance average over 2^3 samples */
+#define APP_B1_DATA_MAX_PERIOD_MS   (9999U)         /* Largest period a data frame can carry */
+
+/** @brief ADC sampling settings (defaults, overridden by values stored in nvm_srv) */
 #define APP_B1_ADC_CHANNEL          (12U)            /* ADC channel 0 */
 #define APP_B1_ADC_SAMPLE_PERIOD_MS (1000U)         /* Sample every 1 second */
+#define APP_B1_ADC_TRIGGER_DELAY_NS (1000U)         /* PDB0 pre-trigger delay after the trigger */
+#define APP_B1_ADC_CALIBRATION      LUT_SRV_CAL_MILLIVOLT_5V   /* lut_srv_cal.h table of the input sensor */
 
 /** @brief LED pin definitions */
 #define APP_B1_LED_RED_PORT         (3U)            /* Port D */
@@ -48,6 +133,12 @@
 #define APP_B1_LED_GREEN_PORT         (3U)            /* Port D */
 #define APP_B1_LED_GREEN_PIN          (16U)           /* Red LED - PTD15 */
 
+/** @brief Owner ID used when claiming shared resources (LPIT channel, ...) */
+#define APP_B1_RES_OWNER            (0x10U)
+
+/** @brief Watchdog supervision (wdog_srv) */
+#define APP_B1_WDOG_SAMPLE_PERIODS  (2U)            /* Sampling deadline, one missed sample tolerated */
+
 /*******************************************************************************
  * Type Definitions
  ******************************************************************************/
@@ -68,6 +159,8 @@ typedef enum {
 typedef enum {
     APP_B1_STATE_IDLE = 0,      /**< Idle, waiting for command */
     APP_B1_STATE_SAMPLING,      /**< ADC sampling active */
+    APP_B1_STATE_SPECTRUM,      /**< Block sampling, FFT peaks sent */
+    APP_B1_STATE_CAPTURE,       /**< Triggered capture, windows sent */
     APP_B1_STATE_ERROR          /**< Error state */
 } app_b1_state_t;
 
@@ -99,6 +192,26 @@ typedef enum {
  */
 app_b1_status_t APP_B1_Init(void);
 
+/**
+ * @brief Initialize the sampler component on an already initialized board
+ * @details Used when several components share one node (see app_node).
+ *          Expects clocks, PORT/GPIO services and CAN pins to be set up
+ *          already. Joins the CAN service, allocates an LPIT channel from
+ *          the resource registry and configures the ADC.
+ * 
+ * @return app_b1_status_t
+ *         - APP_B1_SUCCESS: Component ready
+ *         - APP_B1_ERROR: A service or resource could not be obtained
+ */
+app_b1_status_t APP_B1_InitComponent(void);
+
+/**
+ * @brief Run one pass of the Board 1 main loop
+ * @details Non-blocking. Performs a pending ADC sample and returns.
+ *          Called repeatedly by APP_B1_Run() or by the node scheduler.
+ */
+void APP_B1_Process(void);
+
 /**
  * @brief Run Board 1 application main loop
  * @details Processes CAN commands and manages ADC sampling state.
@@ -12,6 +12,10 @@
  * Includes
  ******************************************************************************/
 #include "app_b2.h"
+#include "../../service/res_srv/res_srv.h"
+#include "../../service/nvm_srv/nvm_srv.h"
+#include "../../service/secoc_srv/secoc_srv.h"
+#include "../../service/tsyn_srv/tsyn_srv.h"
 #include "../../driver/nvic/nvic.h"
 #include <stdio.h>
 #include <string.h>
@@ -24,12 +28,21 @@ static volatile bool s_btn1_pressed = false;
 static volatile bool s_btn2_pressed = false;
 static app_b2_stats_t s_stats = {0};
 
+/* Runtime configuration (loaded from nvm_srv) */
+static uint32_t s_cmd_id = APP_B2_CMD_ID;
+static uint32_t s_data_id = APP_B2_DATA_ID;
+
+/* Authenticated commands to Board 1 (secoc_srv) */
+static uint8_t s_secoc_cmd_pdu = SECOC_SRV_NO_PDU;
+static const uint8_t s_secoc_key[SECOC_SRV_KEY_SIZE] = APP_B2_SECOC_KEY;
+
 /*******************************************************************************
  * Private Function Prototypes
  ******************************************************************************/
 static void APP_B2_CANCallback(uint8_t instance, can_srv_event_t event, 
                                const can_srv_message_t *message);
 static void APP_B2_ButtonCallback(uint8_t port, uint8_t pin);
+static bool APP_B2_SendCommand(uint8_t cmd);
 static void APP_B2_SendStartCommand(void);
 static void APP_B2_SendStopCommand(void);
 static void APP_B2_ForwardADCToUART(const can_srv_message_t *message);
@@ -62,7 +75,7 @@ static void APP_B2_CANCallback(uint8_t instance, can_srv_event_t event,
 {
     if (event == CAN_SRV_EVENT_RX_COMPLETE && message != NULL) {
         /* Check if this is ADC data message */
-        if (message->id == APP_B2_DATA_ID) {
+        if (message->id == s_data_id) {
             s_stats.can_rx_count++;
             APP_B2_ForwardADCToUART(message);
         }
@@ -88,19 +101,28 @@ static void APP_B2_ButtonCallback(uint8_t port, uint8_t pin)
 }
 
 /**
- * @brief Send START command to Board 1
+ * @brief Send an authenticated command to Board 1
+ * @details The freshness value is stored so Board 1 keeps rejecting
+ *          frames recorded before a reset of this board.
  */
-static void APP_B2_SendStartCommand(void)
+static bool APP_B2_SendCommand(uint8_t cmd)
 {
-    can_srv_message_t msg;
+    uint8_t data[APP_B2_SECOC_CMD_BYTES] = {cmd, 0U, 0U};
     
-    msg.id = APP_B2_CMD_ID;
-    msg.dlc = 1;
-    msg.isExtended = false;
-    msg.isRemote = false;
-    msg.data[0] = APP_B2_CMD_START_ADC;
+    if (SECOC_SRV_Send(s_secoc_cmd_pdu, data) != SECOC_SRV_SUCCESS) {
+        return false;
+    }
     
-    if (CAN_SRV_Send(&msg) == CAN_SRV_SUCCESS) {
+    NVM_SRV_Write(NVM_SRV_KEY_SECOC_TX_FRESHNESS, SECOC_SRV_GetFreshness(s_secoc_cmd_pdu));
+    return true;
+}
+
+/**
+ * @brief Send START command to Board 1
+ */
+static void APP_B2_SendStartCommand(void)
+{
+    if (APP_B2_SendCommand(APP_B2_CMD_START_ADC)) {
         s_app_state = APP_B2_STATE_FORWARDING;
         GPIO_SRV_Toggle(APP_B2_LED_GREEN_PORT, APP_B2_LED_GREEN_PIN);  /* Toggle LED on CAN TX */
         UART_SRV_SendString(APP_B2_UART_INSTANCE, 
@@ -115,15 +137,7 @@ static void APP_B2_SendStartCommand(void)
  */
 static void APP_B2_SendStopCommand(void)
 {
-    can_srv_message_t msg;
-    
-    msg.id = APP_B2_CMD_ID;
-    msg.dlc = 1;
-    msg.isExtended = false;
-    msg.isRemote = false;
-    msg.data[0] = APP_B2_CMD_STOP_ADC;
-    
-    if (CAN_SRV_Send(&msg) == CAN_SRV_SUCCESS) {
+    if (APP_B2_SendCommand(APP_B2_CMD_STOP_ADC)) {
         s_app_state = APP_B2_STATE_IDLE;
         GPIO_SRV_Toggle(APP_B2_LED_GREEN_PORT, APP_B2_LED_GREEN_PIN);  /* Toggle LED on CAN TX */
         UART_SRV_SendString(APP_B2_UART_INSTANCE,
@@ -135,20 +149,23 @@ static void APP_B2_SendStopCommand(void)
 
 /**
  * @brief Forward ADC data to PC via UART
- * @details Converts BCD format to decimal and sends formatted string
+ * @details Converts BCD format to decimal and sends formatted string.
+ *          Bytes 0-3 carry the sampling period in ms, bytes 4-7 the value.
  */
 static void APP_B2_ForwardADCToUART(const can_srv_message_t *message)
 {
     char buffer[64];
+    uint32_t period_ms = 0;
     uint32_t adc_value = 0;
     
     /* Convert BCD to decimal */
-    for (uint8_t i = 0; i < 8; i++) {
-        adc_value = adc_value * 10 + message->data[i];
+    for (uint8_t i = 0; i < 4; i++) {
+        period_ms = period_ms * 10 + message->data[i];
+        adc_value = adc_value * 10 + message->data[i + 4];
     }
     
     /* Format and send via UART */
-    sprintf(buffer, "[ADC] Value: %lu (0x%03lX)\r\n", adc_value, adc_value);
+    sprintf(buffer, "[ADC] Value: %lu (0x%03lX) @ %lu ms\r\n", adc_value, adc_value, period_ms);
     UART_SRV_SendString(APP_B2_UART_INSTANCE, buffer);
     
     GPIO_SRV_Toggle(APP_B2_LED_GREEN_PORT, APP_B2_LED_GREEN_PIN);  /* Toggle LED on CAN RX */
@@ -184,7 +201,6 @@ static void APP_B2_PrintWelcomeMessage(void)
 
 app_b2_status_t APP_B2_Init(void)
 {
-    can_srv_config_t can_cfg;
     port_srv_pin_config_t port_cfg;
     
     /* Initialize clock system (160 MHz) */
@@ -207,14 +223,8 @@ app_b2_status_t APP_B2_Init(void)
         return APP_B2_ERROR;
     }
     
-    /* Initialize UART (9600 baud to PC) */
-    if (UART_SRV_Init(APP_B2_UART_INSTANCE, APP_B2_UART_BAUDRATE) != UART_SRV_SUCCESS) {
-        s_app_state = APP_B2_STATE_ERROR;
-        return APP_B2_ERROR;
-    }
-    
-    /* Print welcome message */
-    APP_B2_PrintWelcomeMessage();
+    /* Stored settings - on failure the compile-time defaults are used */
+    NVM_SRV_Init();
     
     /* Configure CAN0 pins - PTE4 (RX) and PTE5 (TX) as ALT5 */
     port_cfg.port = 4;  /* Port E */
@@ -227,13 +237,44 @@ app_b2_status_t APP_B2_Init(void)
     port_cfg.pin = 5;   /* PTE5 - CAN0_TX */
     PORT_SRV_ConfigPin(&port_cfg);
     
+    return APP_B2_InitComponent();
+}
+
+app_b2_status_t APP_B2_InitComponent(void)
+{
+    can_srv_config_t can_cfg;
+    port_srv_pin_config_t port_cfg;
+    secoc_srv_config_t secoc_cfg;
+    secoc_srv_pdu_config_t pdu_cfg;
+    tsyn_srv_config_t tsyn_cfg;
+    
+    /* Claim the PC-side UART so no other component drives it */
+    if (RES_SRV_Claim(RES_SRV_UART_INSTANCE, APP_B2_UART_INSTANCE, APP_B2_RES_OWNER) != RES_SRV_SUCCESS) {
+        s_app_state = APP_B2_STATE_ERROR;
+        return APP_B2_ERROR;
+    }
+    
+    /* Load runtime settings */
+    s_cmd_id = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_CMD_ID, APP_B2_CMD_ID);
+    s_data_id = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_DATA_ID, APP_B2_DATA_ID);
+    
+    /* Initialize UART (9600 baud to PC) */
+    if (UART_SRV_Init(APP_B2_UART_INSTANCE,
+                      NVM_SRV_ReadOrDefault(NVM_SRV_KEY_UART_BAUDRATE, APP_B2_UART_BAUDRATE)) != UART_SRV_SUCCESS) {
+        s_app_state = APP_B2_STATE_ERROR;
+        return APP_B2_ERROR;
+    }
+    
+    /* Print welcome message */
+    APP_B2_PrintWelcomeMessage();
+    
     /* Initialize CAN (receive ADC data, send commands) */
-    can_cfg.baudrate = APP_B2_CAN_BAUDRATE;
-    can_cfg.filter_id = APP_B2_DATA_ID;     /* Primary: Accept ADC data messages */
-    can_cfg.filter_mask = 0x7FF;            /* Match exact ID */
+    can_cfg.baudrate = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_CAN_BAUDRATE, APP_B2_CAN_BAUDRATE);
+    can_cfg.filter_id = s_data_id;          /* Primary: Accept ADC data messages */
+    can_cfg.filter_mask = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_CAN_FILTER_MASK, 0x7FF);
     can_cfg.filter_extended = false;
-    can_cfg.filter_id2 = APP_B2_CMD_ID;     /* Secondary: Accept command messages (for future use) */
-    can_cfg.filter_mask2 = 0x7FF;           /* Match exact ID */
+    can_cfg.filter_id2 = s_cmd_id;          /* Secondary: Accept command messages (for future use) */
+    can_cfg.filter_mask2 = can_cfg.filter_mask;
     can_cfg.mode = CAN_MODE_NORMAL;         /* Normal mode for real bus */
     
     if (CAN_SRV_Init(&can_cfg) != CAN_SRV_SUCCESS) {
@@ -249,6 +290,40 @@ app_b2_status_t APP_B2_Init(void)
         return APP_B2_ERROR;
     }
     
+    /* Commands to Board 1 are authenticated (SecOC) */
+    secoc_cfg.key = s_secoc_key;
+    secoc_cfg.engine = SECOC_SRV_ENGINE_AUTO;
+    pdu_cfg.can_id = s_cmd_id;
+    pdu_cfg.extended = false;
+    pdu_cfg.direction = SECOC_SRV_DIR_TX;
+    pdu_cfg.data_id = APP_B2_SECOC_DATA_ID;
+    pdu_cfg.data_length = APP_B2_SECOC_CMD_BYTES;
+    pdu_cfg.fv_bytes = APP_B2_SECOC_FV_BYTES;
+    pdu_cfg.mac_bytes = APP_B2_SECOC_MAC_BYTES;
+    pdu_cfg.on_rx = NULL;
+    
+    if (SECOC_SRV_Init(&secoc_cfg) != SECOC_SRV_SUCCESS ||
+        SECOC_SRV_AddPdu(&pdu_cfg, &s_secoc_cmd_pdu) != SECOC_SRV_SUCCESS) {
+        UART_SRV_SendString(APP_B2_UART_INSTANCE, "[ERROR] SecOC initialization failed\r\n");
+        s_app_state = APP_B2_STATE_ERROR;
+        return APP_B2_ERROR;
+    }
+    SECOC_SRV_SetFreshness(s_secoc_cmd_pdu,
+                           NVM_SRV_ReadOrDefault(NVM_SRV_KEY_SECOC_TX_FRESHNESS, 0U));
+    
+    /* Network time for the sampling nodes */
+    tsyn_cfg.role = TSYN_SRV_ROLE_MASTER;
+    tsyn_cfg.can_id = APP_B2_TSYN_ID;
+    tsyn_cfg.domain = APP_B2_TSYN_DOMAIN;
+    tsyn_cfg.period_ms = APP_B2_TSYN_PERIOD_MS;
+    tsyn_cfg.timeout_ms = 0U;
+    
+    if (TSYN_SRV_Init(&tsyn_cfg) != TSYN_SRV_SUCCESS) {
+        UART_SRV_SendString(APP_B2_UART_INSTANCE, "[ERROR] Time sync initialization failed\r\n");
+        s_app_state = APP_B2_STATE_ERROR;
+        return APP_B2_ERROR;
+    }
+    
     /* Configure Button 1 (START) - PORT and GPIO */
     port_cfg.port = APP_B2_BTN1_PORT;
     port_cfg.pin = APP_B2_BTN1_PIN;
@@ -332,29 +407,38 @@ app_b2_status_t APP_B2_Init(void)
     return APP_B2_SUCCESS;
 }
 
+void APP_B2_Process(void)
+{
+    /* SYNC/FUP pair when due */
+    TSYN_SRV_Process();
+    
+    /* Check Button 1 (START) */
+    if (s_btn1_pressed) {
+        s_btn1_pressed = false;
+        
+        /* Small delay for debounce */
+//        for (volatile uint32_t i = 0; i < 100000; i++);
+        
+        APP_B2_SendStartCommand();
+    }
+    
+    /* Check Button 2 (STOP) */
+    if (s_btn2_pressed) {
+        s_btn2_pressed = false;
+        
+        /* Small delay for debounce */
+//        for (volatile uint32_t i = 0; i < 100000; i++);
+        
+        APP_B2_SendStopCommand();
+    }
+}
+
 void APP_B2_Run(void)
 {
     /* Main loop - process button events */
     while (1) {
-        /* Check Button 1 (START) */
-        if (s_btn1_pressed) {
-        	s_btn1_pressed = false;
-            
-            /* Small delay for debounce */
-//            for (volatile uint32_t i = 0; i < 100000; i++);
-            
-            APP_B2_SendStartCommand();
-        }
-        
-        /* Check Button 2 (STOP) */
-        if (s_btn2_pressed) {
-            s_btn2_pressed = false;
-            
-            /* Small delay for debounce */
-//            for (volatile uint32_t i = 0; i < 100000; i++);
-            
-            APP_B2_SendStopCommand();
-        }
+        APP_B2_Process();
+        NVM_SRV_Process();
         
         /* Could add low power mode here */
         /* __WFI(); */
@@ -2,10 +2,11 @@
  * @file    app_b2.h
  * @brief   Board 2 Application API
  * @details Board 2 acts as gateway between Board 1 and PC
- *          - Button 1: Send START command to Board 1 via CAN
+ *          - Button 1: Send START command to Board 1 via CAN (SecOC authenticated)
  *          - Button 2: Send STOP command to Board 1 via CAN
  *          - Receives ADC data from Board 1 via CAN
  *          - Forwards ADC data to PC via UART (9600 baud)
+ *          - Network time master for the Board 1 nodes (tsyn_srv)
  * 
  * @author  PhucPH32
  * @date    07/12/2025
@@ -33,11 +34,11 @@
 /** @brief CAN communication settings */
 #define APP_B2_CAN_BAUDRATE         (500000U)       /* 500 Kbps */
 
-/** @brief UART communication settings */
+/** @brief UART communication settings (baudrate overridden by nvm_srv) */
 #define APP_B2_UART_BAUDRATE        (9600U)         /* 9600 baud */
 #define APP_B2_UART_INSTANCE        (1U)            /* LPUART1 */
 
-/** @brief CAN Message IDs */
+/** @brief CAN Message IDs (defaults, overridden by values stored in nvm_srv) */
 #define APP_B2_CMD_ID               (0x100U)        /* Commands to Board 1 */
 #define APP_B2_DATA_ID              (0x200U)        /* ADC data from Board 1 */
 
@@ -45,6 +46,21 @@
 #define APP_B2_CMD_START_ADC        (0x01U)         /* Start ADC sampling */
 #define APP_B2_CMD_STOP_ADC         (0x02U)         /* Stop ADC sampling */
 
+/** @brief Command authentication (secoc_srv), same layout as APP_B1_SECOC_x */
+#define APP_B2_SECOC_DATA_ID        (0x0100U)
+#define APP_B2_SECOC_CMD_BYTES      (3U)
+#define APP_B2_SECOC_FV_BYTES       (2U)
+#define APP_B2_SECOC_MAC_BYTES      (3U)
+
+/** @brief Development AES-128 key, must match APP_B1_SECOC_KEY */
+#define APP_B2_SECOC_KEY            { 0x5EU, 0x0CU, 0x8AU, 0x31U, 0xD2U, 0x47U, 0xB9U, 0x16U, \
+                                      0x63U, 0xF0U, 0x2DU, 0xA8U, 0x74U, 0xC5U, 0x1BU, 0x9EU }
+
+/** @brief Network time master (tsyn_srv), same ID and domain as APP_B1_TSYN_x */
+#define APP_B2_TSYN_ID              (0x060U)        /* SYNC and FUP */
+#define APP_B2_TSYN_DOMAIN          (0U)
+#define APP_B2_TSYN_PERIOD_MS       (1000U)
+
 /** @brief Button pin definitions */
 #define APP_B2_BTN1_PORT            (2U)            /* Port C */
 #define APP_B2_BTN1_PIN             (12U)           /* SW2 - Start button */
@@ -55,6 +71,9 @@
 #define APP_B2_LED_GREEN_PORT       (3U)            /* Port D */
 #define APP_B2_LED_GREEN_PIN        (16U)           /* Green LED - PTD16 */
 
+/** @brief Owner ID used when claiming shared resources (UART instance, ...) */
+#define APP_B2_RES_OWNER            (0x20U)
+
 /*******************************************************************************
  * Type Definitions
  ******************************************************************************/
@@ -116,6 +135,26 @@ typedef struct {
  */
 app_b2_status_t APP_B2_Init(void);
 
+/**
+ * @brief Initialize the gateway component on an already initialized board
+ * @details Used when several components share one node (see app_node).
+ *          Expects clocks, PORT/GPIO services and CAN pins to be set up
+ *          already. Claims the UART instance from the resource registry,
+ *          joins the CAN service and configures buttons and LED.
+ * 
+ * @return app_b2_status_t
+ *         - APP_B2_SUCCESS: Component ready
+ *         - APP_B2_ERROR: A service or resource could not be obtained
+ */
+app_b2_status_t APP_B2_InitComponent(void);
+
+/**
+ * @brief Run one pass of the Board 2 main loop
+ * @details Non-blocking. Sends START/STOP for pending button presses and
+ *          returns. Called repeatedly by APP_B2_Run() or by the node scheduler.
+ */
+void APP_B2_Process(void);
+
 /**
  * @brief Run Board 2 application main loop
  * @details Processes button presses, CAN data, and UART transmission.
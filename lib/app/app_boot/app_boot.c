@@ -0,0 +1,186 @@
+/**
+ * @file    app_boot.c
+ * @brief   Resident Bootloader Application Implementation
+ * @details Board bring-up, stay-resident decision and application start
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "app_boot.h"
+#include "../../service/boot_srv/boot_srv.h"
+#include "../../service/can_srv/can_srv.h"
+#include "../../service/clock_srv/clock_srv.h"
+#include "../../service/crc_srv/crc_srv.h"
+#include "../../service/lpit_srv/lpit_srv.h"
+#include "../../service/port_srv/port_srv.h"
+#include "../../service/res_srv/res_srv.h"
+#include "../../service/nvm_srv/nvm_srv.h"
+#include "../../driver/nvic/nvic.h"
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static volatile uint32_t s_tick_ms = 0;
+static lpit_srv_config_t s_lpit_cfg;
+static bool s_stay_resident = true;
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static void APP_BOOT_LPITCallback(void);
+static void APP_BOOT_StartApp(void);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief 1 ms tick
+ */
+static void APP_BOOT_LPITCallback(void)
+{
+    s_tick_ms++;
+}
+
+/**
+ * @brief Release the tick and hand over to the application
+ * @details Returns only if the image turned out to be invalid; the
+ *          bootloader then stays resident.
+ */
+static void APP_BOOT_StartApp(void)
+{
+    LPIT_SRV_Stop(&s_lpit_cfg);
+    NVIC_DisableInterrupt((IRQn_Type)(LPIT0_Ch0_IRQn + s_lpit_cfg.channel));
+
+    if (BOOT_SRV_JumpToApp() != BOOT_SRV_SUCCESS) {
+        s_stay_resident = true;
+        LPIT_SRV_Start(&s_lpit_cfg);
+        NVIC_EnableInterrupt((IRQn_Type)(LPIT0_Ch0_IRQn + s_lpit_cfg.channel));
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+app_boot_status_t APP_BOOT_Init(void)
+{
+    port_srv_pin_config_t port_cfg;
+    can_srv_config_t can_cfg;
+    uint8_t lpit_channel;
+
+    /* Initialize clock system (160 MHz) */
+    CLOCK_SRV_InitPreset(RUN_160MHz);
+
+    /* Enable peripheral clocks */
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_FLEXCAN0, CLOCK_SRV_PCS_NONE);
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_LPIT, CLOCK_SRV_PCS_FIRCDIV2);
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_PORTE, CLOCK_SRV_PCS_NONE);
+
+    if (PORT_SRV_Init() != PORT_SRV_SUCCESS) {
+        return APP_BOOT_ERROR;
+    }
+
+    /* Image record and update request live in nvm_srv */
+    if (NVM_SRV_Init() != NVM_SRV_SUCCESS) {
+        return APP_BOOT_ERROR;
+    }
+
+    /* Configure CAN0 pins - PTE4 (RX) and PTE5 (TX) as ALT5 */
+    port_cfg.port = 4;  /* Port E */
+    port_cfg.pin = 4;   /* PTE4 - CAN0_RX */
+    port_cfg.mux = PORT_SRV_MUX_ALT5;
+    port_cfg.pull = PORT_SRV_PULL_DISABLE;
+    port_cfg.interrupt = PORT_SRV_INT_DISABLE;
+    PORT_SRV_ConfigPin(&port_cfg);
+
+    port_cfg.pin = 5;   /* PTE5 - CAN0_TX */
+    PORT_SRV_ConfigPin(&port_cfg);
+
+    /* CAN on the stored bus rate, boot_srv adds its own filters */
+    can_cfg.baudrate = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_CAN_BAUDRATE, APP_BOOT_CAN_BAUDRATE);
+    can_cfg.filter_id = BOOT_SRV_CMD_ID;
+    can_cfg.filter_mask = 0x7FF;
+    can_cfg.filter_extended = false;
+    can_cfg.filter_id2 = 0;
+    can_cfg.filter_mask2 = 0;
+    can_cfg.mode = CAN_MODE_NORMAL;
+
+    if (CAN_SRV_Init(&can_cfg) != CAN_SRV_SUCCESS) {
+        return APP_BOOT_ERROR;
+    }
+
+    /* Image checks run on the CRC peripheral */
+    if (CRC_SRV_Init() != CRC_SRV_SUCCESS) {
+        return APP_BOOT_ERROR;
+    }
+
+    if (BOOT_SRV_Init() != BOOT_SRV_SUCCESS) {
+        return APP_BOOT_ERROR;
+    }
+
+    /* 1 ms tick for the listen window */
+    if (LPIT_SRV_Init() != LPIT_SRV_SUCCESS) {
+        return APP_BOOT_ERROR;
+    }
+
+    if (RES_SRV_Alloc(RES_SRV_LPIT_CHANNEL, APP_BOOT_RES_OWNER, &lpit_channel) != RES_SRV_SUCCESS) {
+        return APP_BOOT_ERROR;
+    }
+
+    s_lpit_cfg.channel = lpit_channel;
+    s_lpit_cfg.period_us = 1000U;
+    s_lpit_cfg.is_running = false;
+
+    if (LPIT_SRV_Config(&s_lpit_cfg, APP_BOOT_LPITCallback) != LPIT_SRV_SUCCESS) {
+        return APP_BOOT_ERROR;
+    }
+
+    NVIC_EnableInterrupt((IRQn_Type)(LPIT0_Ch0_IRQn + lpit_channel));
+    NVIC_SetPriority((IRQn_Type)(LPIT0_Ch0_IRQn + lpit_channel), 3);
+    LPIT_SRV_Start(&s_lpit_cfg);
+
+    /* Stay for an explicit request or when there is nothing to start */
+    s_stay_resident = BOOT_SRV_ConsumeUpdateRequest() || !BOOT_SRV_IsAppValid();
+
+    return APP_BOOT_SUCCESS;
+}
+
+void APP_BOOT_Run(void)
+{
+    uint32_t go_tick = 0;
+    bool go_pending = false;
+
+    while (1) {
+        BOOT_SRV_Process();
+        NVM_SRV_Process();
+
+        /* Host asked for the application */
+        if (BOOT_SRV_IsStartRequested() && !go_pending) {
+            BOOT_SRV_ClearStartRequest();
+            go_pending = true;
+            go_tick = s_tick_ms;
+        }
+
+        if (go_pending && (s_tick_ms - go_tick) >= APP_BOOT_GO_DELAY_MS) {
+            go_pending = false;
+            APP_BOOT_StartApp();
+        }
+
+        /* No host showed up within the window */
+        if (!s_stay_resident && BOOT_SRV_GetState() == BOOT_SRV_STATE_IDLE &&
+            s_tick_ms >= APP_BOOT_WINDOW_MS) {
+            APP_BOOT_StartApp();
+        }
+
+        /* Any update activity keeps the bootloader resident */
+        if (BOOT_SRV_GetState() != BOOT_SRV_STATE_IDLE) {
+            s_stay_resident = true;
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file    app_boot.h
+ * @brief   Resident Bootloader Application API
+ * @details Built with BUILD_BOOTLOADER and linked with
+ *          S32K144_64_flash_boot.ld (0x0000-0x7FFF). At reset it:
+ *          - Stays resident when the application asked for an update
+ *            (BOOT_SRV_RequestUpdate()) or no verified image is stored
+ *          - Otherwise listens APP_BOOT_WINDOW_MS for a START command,
+ *            then starts the application at 0x8000
+ *          The application itself is linked with S32K144_64_flash_app.ld.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef APP_BOOT_H
+#define APP_BOOT_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief CAN bus baudrate when none is stored in nvm_srv */
+#define APP_BOOT_CAN_BAUDRATE       (500000U)
+
+/** @brief Time to wait for a host before starting a valid application */
+#define APP_BOOT_WINDOW_MS          (200U)
+
+/** @brief Delay between the GO response and the jump (lets the frame out) */
+#define APP_BOOT_GO_DELAY_MS        (5U)
+
+/** @brief Owner ID used when claiming shared resources */
+#define APP_BOOT_RES_OWNER          (0x30U)
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Bootloader application status codes
+ */
+typedef enum {
+    APP_BOOT_SUCCESS = 0,       /**< Operation successful */
+    APP_BOOT_ERROR              /**< General error */
+} app_boot_status_t;
+
+/*******************************************************************************
+ * Public Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the bootloader
+ * @details Brings up clocks, CAN and nvm_srv and decides whether to stay
+ *          resident.
+ * @return app_boot_status_t Status of initialization
+ */
+app_boot_status_t APP_BOOT_Init(void);
+
+/**
+ * @brief Run the bootloader
+ * @details Services the update protocol and starts the application when
+ *          the host sends GO or the listen window expires. Never returns.
+ */
+void APP_BOOT_Run(void);
+
+#endif /* APP_BOOT_H */
@@ -0,0 +1,211 @@
+/**
+ * @file    app_node.c
+ * @brief   Node Application Implementation
+ * @details Board bring-up, capability resolution and cooperative scheduler
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "app_node.h"
+#include "../app_b1/app_b1.h"
+#include "../app_b2/app_b2.h"
+#include "../../service/clock_srv/clock_srv.h"
+#include "../../service/gpio_srv/gpio_srv.h"
+#include "../../service/port_srv/port_srv.h"
+#include "../../service/nvm_srv/nvm_srv.h"
+#include "../../service/wdog_srv/wdog_srv.h"
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static uint32_t s_node_caps = 0;
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static app_node_status_t APP_NODE_InitBoard(void);
+static uint32_t APP_NODE_ReadCapabilities(void);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Board bring-up shared by all components
+ * @details Enables the union of the clocks needed by every component so
+ *          the capability set can be resolved before any component runs.
+ */
+static app_node_status_t APP_NODE_InitBoard(void)
+{
+    port_srv_pin_config_t port_cfg;
+
+    /* Initialize clock system (160 MHz) */
+    CLOCK_SRV_InitPreset(RUN_160MHz);
+
+    /* Enable peripheral clocks */
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_FLEXCAN0, CLOCK_SRV_PCS_NONE);
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_ADC0, CLOCK_SRV_PCS_SOSCDIV2);
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_LPIT, CLOCK_SRV_PCS_FIRCDIV2);
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_LPUART1, CLOCK_SRV_SOURCE_SOSC);
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_PORTC, CLOCK_SRV_PCS_NONE);
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_PORTD, CLOCK_SRV_PCS_NONE);
+    CLOCK_SRV_EnablePeripheral(CLOCK_SRV_PORTE, CLOCK_SRV_PCS_NONE);
+
+    /* Initialize PORT service */
+    if (PORT_SRV_Init() != PORT_SRV_SUCCESS) {
+        return APP_NODE_ERROR;
+    }
+
+    /* Initialize GPIO service */
+    if (GPIO_SRV_Init() != GPIO_SRV_SUCCESS) {
+        return APP_NODE_ERROR;
+    }
+
+    /* Stored settings - on failure the compile-time defaults are used */
+    NVM_SRV_Init();
+
+    /* Configure CAN0 pins - PTE4 (RX) and PTE5 (TX) as ALT5 */
+    port_cfg.port = 4;  /* Port E */
+    port_cfg.pin = 4;   /* PTE4 - CAN0_RX */
+    port_cfg.mux = PORT_SRV_MUX_ALT5;
+    port_cfg.pull = PORT_SRV_PULL_DISABLE;
+    port_cfg.interrupt = PORT_SRV_INT_DISABLE;
+    PORT_SRV_ConfigPin(&port_cfg);
+
+    port_cfg.pin = 5;   /* PTE5 - CAN0_TX */
+    PORT_SRV_ConfigPin(&port_cfg);
+
+    /* Strap pins as inputs with pull-up */
+    port_cfg.port = APP_NODE_STRAP_PORT;
+    port_cfg.mux = PORT_SRV_MUX_GPIO;
+    port_cfg.pull = PORT_SRV_PULL_UP;
+
+    port_cfg.pin = APP_NODE_STRAP_SAMPLER_PIN;
+    if (PORT_SRV_ConfigPin(&port_cfg) != PORT_SRV_SUCCESS) {
+        return APP_NODE_ERROR;
+    }
+    GPIO_SRV_ConfigInput(APP_NODE_STRAP_PORT, APP_NODE_STRAP_SAMPLER_PIN);
+
+    port_cfg.pin = APP_NODE_STRAP_GATEWAY_PIN;
+    if (PORT_SRV_ConfigPin(&port_cfg) != PORT_SRV_SUCCESS) {
+        return APP_NODE_ERROR;
+    }
+    GPIO_SRV_ConfigInput(APP_NODE_STRAP_PORT, APP_NODE_STRAP_GATEWAY_PIN);
+
+    return APP_NODE_SUCCESS;
+}
+
+/**
+ * @brief Resolve the capability set
+ * @details A strap pin pulled low enables its component. With no strap
+ *          fitted the stored set applies, then the build default.
+ */
+static uint32_t APP_NODE_ReadCapabilities(void)
+{
+    uint32_t caps = 0;
+
+    if (GPIO_SRV_Read(APP_NODE_STRAP_PORT, APP_NODE_STRAP_SAMPLER_PIN) == 0U) {
+        caps |= APP_NODE_CAP_SAMPLER;
+    }
+
+    if (GPIO_SRV_Read(APP_NODE_STRAP_PORT, APP_NODE_STRAP_GATEWAY_PIN) == 0U) {
+        caps |= APP_NODE_CAP_GATEWAY;
+    }
+
+    if (caps == 0U) {
+        caps = NVM_SRV_ReadOrDefault(NVM_SRV_KEY_NODE_CAPS, APP_NODE_DEFAULT_CAPS);
+        caps &= (APP_NODE_CAP_SAMPLER | APP_NODE_CAP_GATEWAY);
+    }
+
+    return caps;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+app_node_status_t APP_NODE_Init(void)
+{
+    wdog_srv_config_t wdog_cfg;
+
+    if (APP_NODE_InitBoard() != APP_NODE_SUCCESS) {
+        return APP_NODE_ERROR;
+    }
+
+    s_node_caps = APP_NODE_ReadCapabilities();
+    if (s_node_caps == 0U) {
+        return APP_NODE_NO_ROLE;
+    }
+
+    /* Gateway first so its UART banner is out before sampling can start */
+    if ((s_node_caps & APP_NODE_CAP_GATEWAY) != 0U) {
+        if (APP_B2_InitComponent() != APP_B2_SUCCESS) {
+            return APP_NODE_ERROR;
+        }
+    }
+
+    if ((s_node_caps & APP_NODE_CAP_SAMPLER) != 0U) {
+        if (APP_B1_InitComponent() != APP_B1_SUCCESS) {
+            return APP_NODE_ERROR;
+        }
+    }
+
+    /* Started after the components so the UART banner is not supervised.
+       Locked: nothing in the node image reconfigures the WDOG, and the
+       reset that enters the bootloader also unlocks it. */
+    wdog_cfg.timeout_ms = APP_NODE_WDOG_TIMEOUT_MS;
+    wdog_cfg.window_ms = APP_NODE_WDOG_WINDOW_MS;
+    wdog_cfg.lock = true;
+    wdog_cfg.on_miss = NULL;
+    if (WDOG_SRV_Init(&wdog_cfg) != WDOG_SRV_SUCCESS) {
+        return APP_NODE_ERROR;
+    }
+
+    return APP_NODE_SUCCESS;
+}
+
+void APP_NODE_Run(void)
+{
+    /* Cooperative loop - every process function returns promptly */
+    while (1) {
+        if ((s_node_caps & APP_NODE_CAP_GATEWAY) != 0U) {
+            APP_B2_Process();
+        }
+
+        if ((s_node_caps & APP_NODE_CAP_SAMPLER) != 0U) {
+            APP_B1_Process();
+        }
+
+        /* Deferred configuration writes */
+        NVM_SRV_Process();
+
+        /* Refresh only while the loop runs and sampling keeps up */
+        WDOG_SRV_Process();
+
+        /* Could add low power mode here */
+        /* __WFI(); */
+    }
+}
+
+uint32_t APP_NODE_GetCapabilities(void)
+{
+    return s_node_caps;
+}
+
+app_node_status_t APP_NODE_StoreCapabilities(uint32_t caps)
+{
+    if ((caps & ~(APP_NODE_CAP_SAMPLER | APP_NODE_CAP_GATEWAY)) != 0U || caps == 0U) {
+        return APP_NODE_ERROR;
+    }
+
+    if (NVM_SRV_Write(NVM_SRV_KEY_NODE_CAPS, caps) != NVM_SRV_SUCCESS) {
+        return APP_NODE_ERROR;
+    }
+
+    return APP_NODE_SUCCESS;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file    app_node.h
+ * @brief   Node Application API - Runtime Role Selection
+ * @details One firmware image for every board. The node reads its
+ *          capabilities at startup and runs the enabled components
+ *          (ADC sampler from app_b1, CAN/UART gateway from app_b2) on a
+ *          single cooperative loop:
+ *          - Capabilities come from two strap pins (active low)
+ *          - Unstrapped boards use the set stored in nvm_srv
+ *            (NVM_SRV_KEY_NODE_CAPS), then APP_NODE_DEFAULT_CAPS
+ *          - Shared hardware (CAN mailboxes, LPIT channels, UART) is
+ *            handed out by the resource registry (res_srv)
+ *          - The windowed watchdog (wdog_srv) is started last and only
+ *            refreshed while every component task meets its deadline
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef APP_NODE_H
+#define APP_NODE_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Capability bits */
+#define APP_NODE_CAP_SAMPLER        (1U << 0)       /* ADC sampler (app_b1) */
+#define APP_NODE_CAP_GATEWAY        (1U << 1)       /* CAN/UART gateway (app_b2) */
+
+/** @brief Capabilities used when no strap pin is pulled low and none is stored */
+#ifndef APP_NODE_DEFAULT_CAPS
+#define APP_NODE_DEFAULT_CAPS       (APP_NODE_CAP_SAMPLER)
+#endif
+
+/** @brief Strap pins (internal pull-up, tie to GND to select) */
+#define APP_NODE_STRAP_PORT         (4U)            /* Port E */
+#define APP_NODE_STRAP_SAMPLER_PIN  (10U)           /* PTE10 low = sampler */
+#define APP_NODE_STRAP_GATEWAY_PIN  (11U)           /* PTE11 low = gateway */
+
+/** @brief Watchdog (wdog_srv) */
+#define APP_NODE_WDOG_TIMEOUT_MS    (250U)
+#define APP_NODE_WDOG_WINDOW_MS     (25U)           /* Earliest refresh after the previous one */
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Node status codes
+ */
+typedef enum {
+    APP_NODE_SUCCESS = 0,       /**< Operation successful */
+    APP_NODE_ERROR,             /**< General error */
+    APP_NODE_NO_ROLE            /**< No capability selected */
+} app_node_status_t;
+
+/*******************************************************************************
+ * Public Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the node
+ * @details Brings up clocks, PORT/GPIO and CAN pins once, resolves the
+ *          capability set and initializes each enabled component.
+ *
+ * @return app_node_status_t
+ *         - APP_NODE_SUCCESS: All enabled components initialized
+ *         - APP_NODE_ERROR: Board or component initialization failed
+ *         - APP_NODE_NO_ROLE: Capability set is empty
+ *
+ * @par Example:
+ * @code
+ * if (APP_NODE_Init() != APP_NODE_SUCCESS) {
+ *     while(1);
+ * }
+ * APP_NODE_Run();
+ * @endcode
+ */
+app_node_status_t APP_NODE_Init(void);
+
+/**
+ * @brief Run the node scheduler
+ * @details Calls the process function of every enabled component in turn.
+ *          This function never returns.
+ */
+void APP_NODE_Run(void);
+
+/**
+ * @brief Get the capability set selected at startup
+ * @return uint32_t Bitwise OR of APP_NODE_CAP_x
+ */
+uint32_t APP_NODE_GetCapabilities(void);
+
+/**
+ * @brief Store the capability set used by unstrapped boards
+ * @details Takes effect at the next reset. The write is deferred to the
+ *          scheduler loop like every other nvm_srv write.
+ * @param caps Bitwise OR of APP_NODE_CAP_x
+ * @return app_node_status_t Status of operation
+ */
+app_node_status_t APP_NODE_StoreCapabilities(uint32_t caps);
+
+#endif /* APP_NODE_H */
@@ -13,6 +13,11 @@ static uint32_t s_referenceVoltage = 0U;
 /* Callback storage for each ADC instance */
 static adc_callback_t s_adcCallbacks[2] = {NULL, NULL}; /* ADC0, ADC1 */
 
+/* Hardware-triggered sequences */
+static adc_sequence_callback_t s_adcSequenceCallbacks[2] = {NULL, NULL};
+static uint8_t s_adcSequenceCount[2] = {0U, 0U};
+static uint16_t s_adcSequenceResults[2][ADC_SC1_COUNT];
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
@@ -72,13 +77,60 @@ adc_status_t ADC_RegisterCallback(ADC_Type *adc, adc_callback_t callback) {
     return ADC_STATUS_SUCCESS;
 }
 
+adc_status_t ADC_SetHardwareTrigger(ADC_Type *adc, bool hardware) {
+    if (hardware) {
+        adc->SC2 |= ADC_SC2_ADTRG_MASK;
+    } else {
+        adc->SC2 &= ~ADC_SC2_ADTRG_MASK;
+    }
+    return ADC_STATUS_SUCCESS;
+}
+
+adc_status_t ADC_ConfigSlot(ADC_Type *adc, uint8_t slot, uint32_t channel, adc_interrupt_t interruptCfg) {
+    if (slot >= ADC_SC1_COUNT) {
+        return ADC_STATUS_INVALID_PARAM;
+    }
+    adc->SC1[slot] = (channel & ADC_CHANNEL_MASK) | ((uint32_t)interruptCfg << ADC_SC1_AIEN_SHIFT);
+    return ADC_STATUS_SUCCESS;
+}
+
+uint16_t ADC_ReadSlot(ADC_Type *adc, uint8_t slot) {
+    return (uint16_t)adc->R[slot & (ADC_R_COUNT - 1U)];
+}
+
+adc_status_t ADC_RegisterSequenceCallback(ADC_Type *adc, uint8_t count, adc_sequence_callback_t callback) {
+    uint8_t instance = ADC_GetInstance(adc);
+
+    if (instance == 0xFFU || count > ADC_SC1_COUNT || (callback != NULL && count == 0U)) {
+        return ADC_STATUS_INVALID_PARAM;
+    }
+
+    s_adcSequenceCount[instance] = count;
+    s_adcSequenceCallbacks[instance] = callback;
+    return ADC_STATUS_SUCCESS;
+}
+
 void ADC_IRQHandler(ADC_Type *adc) {
     uint8_t instance = ADC_GetInstance(adc);
+    uint8_t count;
     
     if (instance == 0xFFU) {
         return;
     }
     
+    /* Sequence: only the last slot interrupts; reading R[] clears COCO
+       before the next pre-trigger */
+    if (s_adcSequenceCallbacks[instance] != NULL) {
+        count = s_adcSequenceCount[instance];
+        if ((adc->SC1[count - 1U] & ADC_SC1_COCO_MASK) != 0U) {
+            for (uint8_t i = 0U; i < count; i++) {
+                s_adcSequenceResults[instance][i] = (uint16_t)adc->R[i];
+            }
+            s_adcSequenceCallbacks[instance](adc, s_adcSequenceResults[instance], count);
+        }
+        return;
+    }
+    
     /* Check if conversion is complete */
     if ((adc->SC1[0U] & ADC_SC1_COCO_MASK) != 0U) {
         /* Get channel and raw value */
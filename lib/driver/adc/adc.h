@@ -11,6 +11,7 @@
 #else
 #include "adc_reg.h"
 #endif
+#include <stdbool.h>
 
 /* Constants */
 #define ADC_0 ADC0
@@ -99,6 +100,14 @@ typedef union {
  */
 typedef void (*adc_callback_t)(ADC_Type *adc, adc_channel_t channel, uint16_t rawValue);
 
+/**
+ * @brief Hardware-triggered sequence complete callback
+ * @param adc Pointer to ADC peripheral instance
+ * @param results Raw values of SC1[0..count-1]
+ * @param count Number of slots in the sequence
+ */
+typedef void (*adc_sequence_callback_t)(ADC_Type *adc, const uint16_t *results, uint8_t count);
+
 /* API Functions */
 adc_status_t ADC_Config(ADC_Type *adc, adc_module_config_1_t *cfg, uint32_t refVoltage);
 adc_status_t ADC_ModuleDisable(ADC_Type *adc);
@@ -115,6 +124,46 @@ adc_status_t ADC_InterruptCheck(ADC_Type *adc);
  */
 adc_status_t ADC_RegisterCallback(ADC_Type *adc, adc_callback_t callback);
 
+/**
+ * @brief Select the conversion trigger
+ * @param adc Pointer to ADC peripheral instance
+ * @param hardware true: SC1[n] converts on PDB pre-trigger n (ADTRG),
+ *        false: writing SC1[0] starts a conversion
+ * @return adc_status_t Status of operation
+ */
+adc_status_t ADC_SetHardwareTrigger(ADC_Type *adc, bool hardware);
+
+/**
+ * @brief Program one conversion slot
+ * @details In hardware trigger mode the write only arms the slot.
+ * @param adc Pointer to ADC peripheral instance
+ * @param slot SC1 index (0-15)
+ * @param channel Input channel, ADC_CHANNEL_MASK disables the slot
+ * @param interruptCfg Conversion complete interrupt of this slot
+ * @return adc_status_t Status of operation
+ */
+adc_status_t ADC_ConfigSlot(ADC_Type *adc, uint8_t slot, uint32_t channel, adc_interrupt_t interruptCfg);
+
+/**
+ * @brief Read the result of one slot (clears its COCO)
+ * @param adc Pointer to ADC peripheral instance
+ * @param slot SC1 index (0-15)
+ * @return uint16_t Raw value
+ */
+uint16_t ADC_ReadSlot(ADC_Type *adc, uint8_t slot);
+
+/**
+ * @brief Register a sequence callback
+ * @details While registered, the interrupt handler waits for the last
+ *          slot, reads slots 0..count-1 and reports them together. The
+ *          interrupt must be enabled on the last slot only.
+ * @param adc Pointer to ADC peripheral instance
+ * @param count Slots in the sequence (1-16), 0 with NULL to remove
+ * @param callback Callback function pointer
+ * @return adc_status_t Status of registration
+ */
+adc_status_t ADC_RegisterSequenceCallback(ADC_Type *adc, uint8_t count, adc_sequence_callback_t callback);
+
 /**
  * @brief ADC interrupt handler - should be called from ISR
  * @param adc Pointer to ADC peripheral instance
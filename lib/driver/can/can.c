@@ -14,6 +14,7 @@
 #include "can.h"
 #include "../nvic/nvic.h"
 #include "../pcc/pcc.h"
+#include "devassert.h"
 #include <stddef.h>
 
 /*******************************************************************************
@@ -134,9 +135,10 @@ status_t CAN_Init(const can_config_t *config)
         base->MCR &= ~CAN_MCR_RFEN_MASK;
     }
     
-    /* Set maximum number of MBs */
+    /* Set maximum number of MBs, one RXIMR mask per MB */
     base->MCR = (base->MCR & ~CAN_MCR_MAXMB_MASK) | 
-                ((CAN_MB_COUNT - 1U) << CAN_MCR_MAXMB_SHIFT);
+                ((CAN_MB_COUNT - 1U) << CAN_MCR_MAXMB_SHIFT) |
+                CAN_MCR_IRMQ_MASK;
     
     /* Initialize all Message Buffers */
     CAN_InitMessageBuffers(base);
@@ -192,23 +194,11 @@ status_t CAN_Send(uint8_t instance, uint8_t mbIndex, const can_message_t *messag
     uint32_t mbOffset;
     uint32_t cs, id;
     
-    /* Validate parameters */
-    if (instance >= CAN_INSTANCE_COUNT || message == NULL) {
-        return STATUS_INVALID_PARAM;
-    }
-    
-    if (!s_canInitialized[instance]) {
-        return STATUS_NOT_INITIALIZED;
-    }
-    
-    if (mbIndex < CAN_TX_MB_START ||
-        mbIndex >= (CAN_TX_MB_START + CAN_TX_MB_COUNT)) {
-        return STATUS_INVALID_PARAM;
-    }
-    
-    if (message->dataLength > CAN_MAX_DATA_LENGTH) {
-        return STATUS_INVALID_PARAM;
-    }
+    /* Hot path: arguments are checked in the checked profile only */
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT && message != NULL);
+    DEV_ASSERT(s_canInitialized[instance]);
+    DEV_ASSERT(mbIndex >= CAN_TX_MB_START && mbIndex < (CAN_TX_MB_START + CAN_TX_MB_COUNT));
+    DEV_ASSERT(message->dataLength <= CAN_MAX_DATA_LENGTH);
     
     base = s_canBases[instance];
     mbOffset = mbIndex * MSG_BUF_SIZE;
@@ -301,18 +291,10 @@ status_t CAN_Receive(uint8_t instance, uint8_t mbIndex, can_message_t *message)
     uint32_t data0, data1;
     uint32_t dummy;
     
-    /* Validate parameters */
-    if (instance >= CAN_INSTANCE_COUNT || message == NULL) {
-        return STATUS_INVALID_PARAM;
-    }
-    
-    if (!s_canInitialized[instance]) {
-        return STATUS_NOT_INITIALIZED;
-    }
-    
-    if (mbIndex < CAN_RX_MB_START || mbIndex >= CAN_MB_COUNT) {
-        return STATUS_INVALID_PARAM;
-    }
+    /* Hot path: arguments are checked in the checked profile only */
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT && message != NULL);
+    DEV_ASSERT(s_canInitialized[instance]);
+    DEV_ASSERT(mbIndex >= CAN_RX_MB_START && mbIndex < CAN_MB_COUNT);
     
     base = s_canBases[instance];
     mbMask = (1UL << mbIndex);
@@ -340,6 +322,7 @@ status_t CAN_Receive(uint8_t instance, uint8_t mbIndex, can_message_t *message)
     
     message->frameType = (cs & CAN_WMBn_CS_RTR_MASK) ? CAN_FRAME_REMOTE : CAN_FRAME_DATA;
     message->dataLength = (cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT;
+    message->timeStamp = (uint16_t)(cs & CAN_CS_TIME_STAMP_MASK);
     
     /* Read data words */
     data0 = base->RAMn[mbOffset + 2];
@@ -381,14 +364,9 @@ status_t CAN_ReceiveBlocking(uint8_t instance, uint8_t mbIndex,
     uint32_t timeoutCount = 0;
     uint32_t mbMask;
     
-    /* Validate parameters */
-    if (instance >= CAN_INSTANCE_COUNT || message == NULL) {
-        return STATUS_INVALID_PARAM;
-    }
-    
-    if (!s_canInitialized[instance]) {
-        return STATUS_NOT_INITIALIZED;
-    }
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT && message != NULL);
+    DEV_ASSERT(s_canInitialized[instance]);
+    DEV_ASSERT(mbIndex >= CAN_RX_MB_START && mbIndex < CAN_MB_COUNT);
     
     base = s_canBases[instance];
     mbMask = (1UL << mbIndex);
@@ -412,7 +390,8 @@ status_t CAN_ConfigRxFilter(uint8_t instance, uint8_t mbIndex,
 {
     CAN_Type *base;
     uint32_t mbOffset;
-    uint32_t cs, id;
+    uint32_t cs, id, mask;
+    status_t status;
     
     /* Validate parameters */
     if (instance >= CAN_INSTANCE_COUNT || filter == NULL) {
@@ -430,11 +409,13 @@ status_t CAN_ConfigRxFilter(uint8_t instance, uint8_t mbIndex,
     base = s_canBases[instance];
     mbOffset = mbIndex * MSG_BUF_SIZE;
     
-    /* Configure ID word */
+    /* Configure ID word; the mask has the same layout */
     if (filter->idType == CAN_ID_EXT) {
         id = (filter->id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
+        mask = (filter->mask << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
     } else {
         id = (filter->id << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
+        mask = (filter->mask << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
     }
     base->RAMn[mbOffset + 1] = id;
     
@@ -447,8 +428,17 @@ status_t CAN_ConfigRxFilter(uint8_t instance, uint8_t mbIndex,
     
     base->RAMn[mbOffset + 0] = cs;
     
-    /* Configure individual mask */
-    base->RXIMR[mbIndex] = filter->mask;
+    /* RXIMR is only writable in freeze mode. IDE is always compared
+       (CTRL2[EACEN] = 0), RTR never is */
+    status = CAN_EnterFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    base->RXIMR[mbIndex] = mask;
+    status = CAN_ExitFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
     
     /* Enable interrupt for this MB */
     base->IMASK1 |= (1UL << mbIndex);
@@ -500,9 +490,7 @@ status_t CAN_GetErrorState(uint8_t instance, can_error_state_t *errorState)
     CAN_Type *base;
     uint32_t fltConf;
     
-    if (instance >= CAN_INSTANCE_COUNT || errorState == NULL) {
-        return STATUS_INVALID_PARAM;
-    }
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT && errorState != NULL);
     
     base = s_canBases[instance];
     
@@ -527,10 +515,7 @@ status_t CAN_GetErrorCounters(uint8_t instance,
 {
     CAN_Type *base;
     
-    if (instance >= CAN_INSTANCE_COUNT || 
-        txErrorCount == NULL || rxErrorCount == NULL) {
-        return STATUS_INVALID_PARAM;
-    }
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT && txErrorCount != NULL && rxErrorCount != NULL);
     
     base = s_canBases[instance];
     
@@ -548,9 +533,7 @@ status_t CAN_AbortTransmission(uint8_t instance, uint8_t mbIndex)
     CAN_Type *base;
     uint32_t mbOffset;
     
-    if (instance >= CAN_INSTANCE_COUNT || mbIndex >= CAN_MB_COUNT) {
-        return STATUS_INVALID_PARAM;
-    }
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT && mbIndex < CAN_MB_COUNT);
     
     base = s_canBases[instance];
     mbOffset = mbIndex * MSG_BUF_SIZE;
@@ -571,10 +554,7 @@ status_t CAN_IsMbBusy(uint8_t instance, uint8_t mbIndex, bool *isBusy)
     uint32_t cs;
     uint32_t code;
     
-    if (instance >= CAN_INSTANCE_COUNT || 
-        mbIndex >= CAN_MB_COUNT || isBusy == NULL) {
-        return STATUS_INVALID_PARAM;
-    }
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT && mbIndex < CAN_MB_COUNT && isBusy != NULL);
     
     base = s_canBases[instance];
     mbOffset = mbIndex * MSG_BUF_SIZE;
@@ -588,6 +568,19 @@ status_t CAN_IsMbBusy(uint8_t instance, uint8_t mbIndex, bool *isBusy)
     return STATUS_SUCCESS;
 }
 
+/**
+ * @brief Read the free running timer
+ */
+status_t CAN_GetTimer(uint8_t instance, uint16_t *timer)
+{
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT && timer != NULL);
+    DEV_ASSERT(s_canInitialized[instance]);
+    
+    *timer = (uint16_t)(s_canBases[instance]->TIMER & CAN_TIMER_TIMER_MASK);
+    
+    return STATUS_SUCCESS;
+}
+
 /**
  * @brief Calculate timing parameters
  */
@@ -715,9 +708,10 @@ static status_t CAN_SoftReset(CAN_Type *base)
  */
 static void CAN_EnableClock(uint8_t instance, can_clk_src_t clockSource)
 {
-//	DEV_ASSERT(instance > 2U);
     CAN_Type *base;
     
+    DEV_ASSERT(instance < CAN_INSTANCE_COUNT);
+    
     base = s_canBases[instance];
     // /* Get PCC register address */
     // if (instance == 0U) {
@@ -756,8 +750,8 @@ static void CAN_InitMessageBuffers(CAN_Type *base)
         base->RAMn[i] = 0;
     }
     
-    /* In FRZ mode, init CAN 16 msg buf filters */
-    for (i = 0; i < 16; i++) {
+    /* In FRZ mode, init the individual mask of every msg buf */
+    for (i = 0; i < CAN_MB_COUNT; i++) {
         /* Check all ID bits for incoming messages */
         base->RXIMR[i] = 0xFFFFFFFFUL;
     }
@@ -853,7 +847,7 @@ void CAN_IRQHandler(CAN_Type *instance)
     
     can_event_t event = CAN_EVENT_NONE;
     can_event_data_t eventData = {0};
-    can_message_t rxMessage = {0};
+    can_message_t message = {0};
     
     /* Check MB interrupts (TX/RX) */
     uint32_t iflag1 = instance->IFLAG1;
@@ -871,6 +865,18 @@ void CAN_IRQHandler(CAN_Type *instance)
                     event = CAN_EVENT_TX_COMPLETE;
                     eventData.mbIndex = mbIdx;
                     
+                    /* ID and bus time of the sent frame (time synchronization) */
+                    uint32_t idReg = CAN_ReadMbId(instance, mbIdx);
+                    if ((cs & CAN_WMBn_CS_IDE_MASK) != 0) {
+                        message.idType = CAN_ID_EXT;
+                        message.id = (idReg & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
+                    } else {
+                        message.idType = CAN_ID_STD;
+                        message.id = (idReg & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
+                    }
+                    message.timeStamp = (uint16_t)(cs & CAN_CS_TIME_STAMP_MASK);
+                    eventData.message = &message;
+                    
                     /* Clear flag */
                     instance->IFLAG1 = (1UL << mbIdx);
                     
@@ -881,26 +887,28 @@ void CAN_IRQHandler(CAN_Type *instance)
                     
                     /* Extract message data */
                     uint8_t dlc = (cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT;
-                    rxMessage.dataLength = (dlc > 8U) ? 8U : dlc;
+                    message.dataLength = (dlc > 8U) ? 8U : dlc;
                     
                     /* Extract ID */
                     uint32_t idReg = CAN_ReadMbId(instance, mbIdx);
                     if ((cs & CAN_WMBn_CS_IDE_MASK) != 0) {
-                        rxMessage.idType = CAN_ID_EXT;
-                        rxMessage.id = (idReg & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
+                        message.idType = CAN_ID_EXT;
+                        message.id = (idReg & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
                     } else {
-                        rxMessage.idType = CAN_ID_STD;
-                        rxMessage.id = (idReg & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
+                        message.idType = CAN_ID_STD;
+                        message.id = (idReg & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
                     }
                     
                     /* Extract frame type */
-                    rxMessage.frameType = ((cs & CAN_WMBn_CS_RTR_MASK) != 0) ? 
-                                         CAN_FRAME_REMOTE : CAN_FRAME_DATA;
+                    message.frameType = ((cs & CAN_WMBn_CS_RTR_MASK) != 0) ? 
+                                       CAN_FRAME_REMOTE : CAN_FRAME_DATA;
+                    
+                    message.timeStamp = (uint16_t)(cs & CAN_CS_TIME_STAMP_MASK);
                     
                     /* Copy data */
-                    CAN_CopyDataFromMb(instance, mbIdx, rxMessage.data, rxMessage.dataLength);
+                    CAN_CopyDataFromMb(instance, mbIdx, message.data, message.dataLength);
                     
-                    eventData.message = &rxMessage;
+                    eventData.message = &message;
                     
                     /* Clear flag (after reading data) */
                     instance->IFLAG1 = (1UL << mbIdx);
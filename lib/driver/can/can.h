@@ -75,6 +75,7 @@
 // #define CAN_CS_RTR_MASK                  (0x00100000U)
 // #define CAN_CS_DLC_SHIFT                 (16U)
 // #define CAN_CS_DLC_MASK                  (0x000F0000U)
+#define CAN_CS_TIME_STAMP_MASK           (0x0000FFFFU)    /* Free running timer at the identifier field */
 
 /* MB CODE values */
 #define CAN_CS_CODE_TX_INACTIVE          (0x08U)
@@ -340,6 +341,7 @@ typedef struct {
     can_frame_type_t frameType;         /**< Frame type (Data or Remote) */
     uint8_t dataLength;                 /**< Number of data bytes (0-8) */
     uint8_t data[CAN_MAX_DATA_LENGTH];  /**< Payload data bytes */
+    uint16_t timeStamp;                 /**< Free running timer when the identifier was on the bus (CAN bit times) */
 } can_message_t;
 
 /**
@@ -418,7 +420,7 @@ typedef enum {
  */
 typedef struct {
     uint8_t mbIndex;                    /**< Message buffer index */
-    can_message_t *message;             /**< Pointer to received message (for RX events) */
+    can_message_t *message;             /**< RX: received message, TX: ID and timeStamp of the sent frame */
     uint32_t errorFlags;                /**< Error flags (for error events) */
 } can_event_data_t;
 
@@ -663,6 +665,8 @@ status_t CAN_ReceiveBlocking(uint8_t instance, uint8_t mbIndex,
  * @note Mask bit interpretation:
  *       - Mask bit = 1: Corresponding ID bit must match
  *       - Mask bit = 0: Corresponding ID bit is "don't care"
+ * @note The mask is written in freeze mode, so the bus is paused for a
+ *       few bit times. Configure filters at start-up.
  * 
  * @par Examples:
  * @code
@@ -868,6 +872,25 @@ status_t CAN_AbortTransmission(uint8_t instance, uint8_t mbIndex);
  */
 status_t CAN_IsMbBusy(uint8_t instance, uint8_t mbIndex, bool *isBusy);
 
+/**
+ * @brief Read the free running timer
+ * @details The 16-bit timer counts CAN bit times and wraps every 65536 bits
+ *          (131 ms at 500 Kbps). Message Buffers capture it in their
+ *          timeStamp when the identifier field of their frame is on the bus,
+ *          so (timer - timeStamp) is the age of a frame in bit times.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[out] timer Pointer to store the timer value
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Timer read successfully
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, invalid instance)
+ *         - STATUS_NOT_INITIALIZED: CAN module not initialized
+ * 
+ * @note Reading the timer also releases a locked RX Message Buffer.
+ */
+status_t CAN_GetTimer(uint8_t instance, uint16_t *timer);
+
 /**
  * @brief Calculate bit timing parameters for target baudrate
  * @details Automatically calculates optimal timing parameters (prescaler, phase segments)
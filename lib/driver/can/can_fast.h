@@ -0,0 +1,158 @@
+/**
+ * @file    can_fast.h
+ * @brief   FlexCAN Instance-Bound Fast Paths
+ * @details Unchecked inline send / receive for code that already knows
+ *          its instance at build time. CAN_FAST_DEFINE(prefix, base)
+ *          generates prefix_FastSend(), prefix_FastReceive(),
+ *          prefix_FastIsMbBusy() bound to one controller: the base address
+ *          is a literal, so with a constant mailbox index the RAMn address
+ *          of every word folds into the instruction and no instance table,
+ *          range check or init flag is read.
+ *
+ *          The caller guarantees what CAN_Send() / CAN_Receive() check on
+ *          every call: the instance is initialized (CAN_Init()), the
+ *          mailbox was configured for its direction, dataLength <= 8.
+ *          Validate once at configuration time, then use these.
+ *
+ *          CAN0 (the one the CAN service drives) is predefined.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef CAN_FAST_H
+#define CAN_FAST_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "can.h"
+
+/*******************************************************************************
+ * Inline Helper Functions
+ ******************************************************************************/
+
+/**
+ * @brief Load a TX mailbox and start the transmission (CAN_Send() body)
+ */
+static inline __attribute__((always_inline))
+void CAN_FastSend(CAN_Type *base, uint8_t mbIndex, const can_message_t *message)
+{
+    uint32_t offset = CAN_GetMbOffset(mbIndex);
+    uint32_t cs = (CAN_CS_CODE_TX_DATA << CAN_CS_CODE_SHIFT) |
+                  ((uint32_t)message->dataLength << CAN_WMBn_CS_DLC_SHIFT);
+
+    base->IFLAG1 = (1UL << mbIndex);
+
+    base->RAMn[offset + 2U] = ((uint32_t)message->data[0] << 24) | ((uint32_t)message->data[1] << 16) |
+                              ((uint32_t)message->data[2] << 8) | (uint32_t)message->data[3];
+    base->RAMn[offset + 3U] = ((uint32_t)message->data[4] << 24) | ((uint32_t)message->data[5] << 16) |
+                              ((uint32_t)message->data[6] << 8) | (uint32_t)message->data[7];
+
+    if (message->idType == CAN_ID_STD) {
+        base->RAMn[offset + 1U] = (message->id << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
+        cs |= CAN_WMBn_CS_SRR_MASK;
+    } else {
+        base->RAMn[offset + 1U] = (message->id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
+        cs |= CAN_WMBn_CS_IDE_MASK;
+    }
+
+    if (message->frameType == CAN_FRAME_REMOTE) {
+        cs |= CAN_WMBn_CS_RTR_MASK;
+    }
+
+    base->RAMn[offset + 0U] = cs;
+}
+
+/**
+ * @brief Read a full RX mailbox and release it (CAN_Receive() body)
+ * @return false if the mailbox holds no new frame
+ */
+static inline __attribute__((always_inline))
+bool CAN_FastReceive(CAN_Type *base, uint8_t mbIndex, can_message_t *message)
+{
+    uint32_t offset = CAN_GetMbOffset(mbIndex);
+    uint32_t mask = (1UL << mbIndex);
+    uint32_t cs;
+    uint32_t id;
+    uint32_t data0;
+    uint32_t data1;
+
+    if ((base->IFLAG1 & mask) == 0U) {
+        return false;
+    }
+
+    /* CS read locks the mailbox, TIMER read unlocks it */
+    cs = base->RAMn[offset + 0U];
+    id = base->RAMn[offset + 1U];
+    data0 = base->RAMn[offset + 2U];
+    data1 = base->RAMn[offset + 3U];
+    (void)base->TIMER;
+
+    base->IFLAG1 = mask;
+
+    if ((cs & CAN_WMBn_CS_IDE_MASK) != 0U) {
+        message->idType = CAN_ID_EXT;
+        message->id = (id & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
+    } else {
+        message->idType = CAN_ID_STD;
+        message->id = (id & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
+    }
+
+    message->frameType = ((cs & CAN_WMBn_CS_RTR_MASK) != 0U) ? CAN_FRAME_REMOTE : CAN_FRAME_DATA;
+    message->dataLength = (uint8_t)((cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT);
+    message->timeStamp = (uint16_t)(cs & CAN_CS_TIME_STAMP_MASK);
+
+    message->data[0] = (uint8_t)(data0 >> 24);
+    message->data[1] = (uint8_t)(data0 >> 16);
+    message->data[2] = (uint8_t)(data0 >> 8);
+    message->data[3] = (uint8_t)data0;
+    message->data[4] = (uint8_t)(data1 >> 24);
+    message->data[5] = (uint8_t)(data1 >> 16);
+    message->data[6] = (uint8_t)(data1 >> 8);
+    message->data[7] = (uint8_t)data1;
+
+    return true;
+}
+
+/**
+ * @brief Mailbox still transmitting or receiving (CAN_IsMbBusy() body)
+ */
+static inline __attribute__((always_inline))
+bool CAN_FastIsMbBusy(CAN_Type *base, uint8_t mbIndex)
+{
+    uint32_t code = (CAN_ReadMbCs(base, mbIndex) & CAN_CS_CODE_MASK) >> CAN_CS_CODE_SHIFT;
+
+    return (code != CAN_CS_CODE_TX_INACTIVE) && (code != CAN_CS_CODE_RX_INACTIVE);
+}
+
+/*******************************************************************************
+ * Instance Binding
+ ******************************************************************************/
+
+/**
+ * @brief Generate the fast paths of one controller
+ * @param prefix Function name prefix (prefix_FastSend...)
+ * @param base Controller base (CAN0, CAN1, CAN2)
+ */
+#define CAN_FAST_DEFINE(prefix, base)                                                       \
+    static inline __attribute__((always_inline))                                            \
+    void prefix##_FastSend(uint8_t mbIndex, const can_message_t *message)                   \
+    {                                                                                       \
+        CAN_FastSend((base), mbIndex, message);                                             \
+    }                                                                                       \
+    static inline __attribute__((always_inline))                                            \
+    bool prefix##_FastReceive(uint8_t mbIndex, can_message_t *message)                      \
+    {                                                                                       \
+        return CAN_FastReceive((base), mbIndex, message);                                   \
+    }                                                                                       \
+    static inline __attribute__((always_inline))                                            \
+    bool prefix##_FastIsMbBusy(uint8_t mbIndex)                                             \
+    {                                                                                       \
+        return CAN_FastIsMbBusy((base), mbIndex);                                           \
+    }
+
+CAN_FAST_DEFINE(CAN0, CAN0)
+
+#endif /* CAN_FAST_H */
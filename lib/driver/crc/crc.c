@@ -0,0 +1,128 @@
+/**
+ * @file    crc.c
+ * @brief   CRC Driver Implementation for S32K144
+ * @details Engine configuration and data feeding
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "crc.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* Word writes need the byte order reversed on top of the stream setting */
+#define CRC_WORD_TRANSPOSE(t)   ((uint32_t)(t) ^ (uint32_t)CRC_TRANSPOSE_BYTES)
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Feed bytes through DATA_8.LL
+ * @details CTRL holds the word transposition. Byte swapping applies to the
+ *          whole 32-bit register, so it would move an LL write to another
+ *          lane; bytes run with the stream transposition instead.
+ */
+static void CRC_WriteBytes(const uint8_t *data, uint32_t length)
+{
+    uint32_t ctrl = CRC->CTRL;
+
+    CRC->CTRL = ctrl ^ CRC_CTRL_TOT(CRC_TRANSPOSE_BYTES);
+    while (length > 0U) {
+        CRC->DATAu.DATA_8.LL = *data++;
+        length--;
+    }
+    CRC->CTRL = ctrl;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void CRC_Init(const crc_config_t *config)
+{
+    uint32_t ctrl;
+
+    if (config == NULL) {
+        return;
+    }
+
+    ctrl = CRC_CTRL_TCRC(config->width) |
+           CRC_CTRL_TOT(CRC_WORD_TRANSPOSE(config->writeTranspose)) |
+           CRC_CTRL_TOTR(config->readTranspose) |
+           CRC_CTRL_FXOR(config->complementChecksum ? 1U : 0U);
+
+    CRC->CTRL = ctrl;
+    CRC->GPOLY = (config->width == CRC_WIDTH_16BIT) ?
+                 (config->polynomial & 0xFFFFU) : config->polynomial;
+
+    CRC_SetSeed(config->seed);
+}
+
+void CRC_SetSeed(uint32_t seed)
+{
+    uint32_t ctrl = CRC->CTRL;
+
+    /* Seed goes in as-is: no write transposition while WAS is set */
+    CRC->CTRL = (ctrl & ~CRC_CTRL_TOT_MASK) | CRC_CTRL_WAS_MASK;
+    CRC->DATAu.DATA = seed;
+    CRC->CTRL = ctrl;
+}
+
+void CRC_WriteData(const uint8_t *data, uint32_t length)
+{
+    const uint32_t *words;
+    uint32_t head;
+
+    if (data == NULL) {
+        return;
+    }
+
+    /* Head: bytes until word aligned */
+    head = (4U - ((uint32_t)data & 3U)) & 3U;
+    if (head > length) {
+        head = length;
+    }
+    if (head > 0U) {
+        CRC_WriteBytes(data, head);
+        data += head;
+        length -= head;
+    }
+
+    /* Body: one bus write per 4 bytes */
+    words = (const uint32_t *)data;
+    while (length >= 4U) {
+        CRC->DATAu.DATA = *words++;
+        length -= 4U;
+    }
+
+    /* Tail */
+    if (length > 0U) {
+        CRC_WriteBytes((const uint8_t *)words, length);
+    }
+}
+
+uint32_t CRC_GetResult(void)
+{
+    uint32_t ctrl = CRC->CTRL;
+    uint32_t result = CRC->DATAu.DATA;
+    uint32_t totr = (ctrl & CRC_CTRL_TOTR_MASK) >> CRC_CTRL_TOTR_SHIFT;
+
+    if ((ctrl & CRC_CTRL_TCRC_MASK) == 0U) {
+        /* 16-bit: byte-transposing reads move the result to the upper half */
+        if (totr == (uint32_t)CRC_TRANSPOSE_BITS_AND_BYTES || totr == (uint32_t)CRC_TRANSPOSE_BYTES) {
+            result >>= 16;
+        }
+        result &= 0xFFFFU;
+    }
+
+    return result;
+}
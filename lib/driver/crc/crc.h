@@ -0,0 +1,120 @@
+/**
+ * @file    crc.h
+ * @brief   CRC Driver API for S32K144
+ * @details Programmable 16/32-bit CRC engine:
+ *
+ * Features:
+ * - Any 16-bit or 32-bit polynomial (CRC16-CCITT, CRC32, ...)
+ * - Configurable seed, input/output transposition and final XOR
+ * - Data fed with 32-bit writes; only unaligned head/tail bytes use
+ *   8-bit writes
+ * - Data register address exported as a DMA destination
+ *
+ * Transposition is given in byte-stream terms: CRC_TRANSPOSE_BITS means
+ * "reflect each input byte" (reflected CRCs such as CRC32). The driver
+ * adds the byte swap needed because 32-bit words are read little-endian
+ * from memory while the engine consumes them most significant byte first.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef CRC_H
+#define CRC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "crc_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief CRC width
+ */
+typedef enum {
+    CRC_WIDTH_16BIT = 0U,
+    CRC_WIDTH_32BIT = 1U
+} crc_width_t;
+
+/**
+ * @brief Transposition (CTRL TOT/TOTR encoding)
+ */
+typedef enum {
+    CRC_TRANSPOSE_NONE           = 0U,  /**< No transposition */
+    CRC_TRANSPOSE_BITS           = 1U,  /**< Bits in bytes reversed */
+    CRC_TRANSPOSE_BITS_AND_BYTES = 2U,  /**< Bits in bytes and bytes reversed */
+    CRC_TRANSPOSE_BYTES          = 3U   /**< Bytes reversed */
+} crc_transpose_t;
+
+/**
+ * @brief CRC configuration
+ */
+typedef struct {
+    crc_width_t width;              /**< 16 or 32 bit */
+    uint32_t polynomial;            /**< Generator polynomial (normal form) */
+    uint32_t seed;                  /**< Initial register value */
+    crc_transpose_t writeTranspose; /**< Input transposition (byte-stream terms) */
+    crc_transpose_t readTranspose;  /**< Result transposition */
+    bool complementChecksum;        /**< XOR the result with all ones */
+} crc_config_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Configure the engine and load the seed
+ * @details The CRC clock must be enabled by the caller.
+ * @param config CRC configuration
+ */
+void CRC_Init(const crc_config_t *config);
+
+/**
+ * @brief Load a new seed, keeping polynomial and transposition
+ * @param seed Raw register value
+ */
+void CRC_SetSeed(uint32_t seed);
+
+/**
+ * @brief Feed data
+ * @details 8-bit writes until the buffer is word aligned, 32-bit writes
+ *          for the body, 8-bit writes for the tail. The 8-bit writes run
+ *          with the stream transposition, CTRL is restored afterwards.
+ * @param data Data
+ * @param length Length in bytes
+ */
+void CRC_WriteData(const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Feed one little-endian word read from memory
+ * @param word Data word
+ */
+static inline void CRC_WriteWord(uint32_t word)
+{
+    CRC->DATAu.DATA = word;
+}
+
+/**
+ * @brief Read the result
+ * @details Applies the read transposition and final XOR. 16-bit results
+ *          are returned in the low half-word.
+ * @return uint32_t CRC value
+ */
+uint32_t CRC_GetResult(void);
+
+/**
+ * @brief Address of the data register (32-bit DMA destination)
+ * @return uint32_t Register address
+ */
+static inline uint32_t CRC_GetDataAddress(void)
+{
+    return (uint32_t)&CRC->DATAu.DATA;
+}
+
+#endif /* CRC_H */
@@ -0,0 +1,86 @@
+/*
+ * @file    crc_reg.h
+ * @brief   CRC Register Definitions for S32K144
+ */
+
+#ifndef CRC_REG_H_
+#define CRC_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+/**
+*   IO Type Qualifiers are used
+*   \li to specify the access to peripheral variables.
+*   \li for automatic generation of peripheral register debug information.
+*/
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- CRC Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup CRC_Peripheral_Access_Layer CRC Peripheral Access Layer
+ * @{
+ */
+
+/** CRC - Register Layout Typedef */
+typedef struct {
+  union {                                          /* offset: 0x0 */
+    struct {                                         /* offset: 0x0 */
+      __IO uint8_t LL;                             /**< CRC_LL register, offset: 0x0 */
+      __IO uint8_t LU;                             /**< CRC_LU register, offset: 0x1 */
+      __IO uint8_t HL;                             /**< CRC_HL register, offset: 0x2 */
+      __IO uint8_t HU;                             /**< CRC_HU register, offset: 0x3 */
+    } DATA_8;
+    struct {                                         /* offset: 0x0 */
+      __IO uint16_t L;                             /**< CRC_L register, offset: 0x0 */
+      __IO uint16_t H;                             /**< CRC_H register, offset: 0x2 */
+    } DATA_16;
+    __IO uint32_t DATA;                              /**< CRC Data register, offset: 0x0 */
+  } DATAu;
+  __IO uint32_t GPOLY;                             /**< CRC Polynomial register, offset: 0x4 */
+  __IO uint32_t CTRL;                              /**< CRC Control register, offset: 0x8 */
+} CRC_Type, *CRC_MemMapPtr;
+
+/** Number of instances of the CRC module. */
+#define CRC_INSTANCE_COUNT                       (1u)
+
+/* CRC - Peripheral instance base addresses */
+/** Peripheral CRC base address */
+#define CRC_BASE                                 (0x40032000u)
+/** Peripheral CRC base pointer */
+#define CRC                                      ((CRC_Type *)CRC_BASE)
+
+/* ----------------------------------------------------------------------------
+   -- CRC Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*! @name CTRL - CRC Control register */
+/*! @{ */
+#define CRC_CTRL_TCRC_MASK                       (0x1000000U)
+#define CRC_CTRL_TCRC_SHIFT                      (24U)
+#define CRC_CTRL_TCRC(x)                         (((uint32_t)(((uint32_t)(x)) << CRC_CTRL_TCRC_SHIFT)) & CRC_CTRL_TCRC_MASK)
+#define CRC_CTRL_WAS_MASK                        (0x2000000U)
+#define CRC_CTRL_WAS_SHIFT                       (25U)
+#define CRC_CTRL_FXOR_MASK                       (0x4000000U)
+#define CRC_CTRL_FXOR_SHIFT                      (26U)
+#define CRC_CTRL_FXOR(x)                         (((uint32_t)(((uint32_t)(x)) << CRC_CTRL_FXOR_SHIFT)) & CRC_CTRL_FXOR_MASK)
+#define CRC_CTRL_TOTR_MASK                       (0x30000000U)
+#define CRC_CTRL_TOTR_SHIFT                      (28U)
+#define CRC_CTRL_TOTR(x)                         (((uint32_t)(((uint32_t)(x)) << CRC_CTRL_TOTR_SHIFT)) & CRC_CTRL_TOTR_MASK)
+#define CRC_CTRL_TOT_MASK                        (0xC0000000U)
+#define CRC_CTRL_TOT_SHIFT                       (30U)
+#define CRC_CTRL_TOT(x)                          (((uint32_t)(((uint32_t)(x)) << CRC_CTRL_TOT_SHIFT)) & CRC_CTRL_TOT_MASK)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group CRC_Peripheral_Access_Layer */
+
+#endif /* CRC_REG_H_ */
@@ -0,0 +1,138 @@
+/**
+ * @file    csec.c
+ * @brief   CSEc Driver Implementation for S32K144
+ * @details Implementation of CSEc command sequences (copy method)
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "csec.h"
+#include "../ftfc/ftfc.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static uint16_t s_last_error = CSEC_ERC_NO_ERROR;
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static void CSEC_WriteBytes(uint32_t word, const uint8_t *data, uint32_t length);
+static void CSEC_ReadBytes(uint32_t word, uint8_t *data, uint32_t length);
+static csec_status_t CSEC_Run(uint32_t header);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Copy bytes into CSE_PRAM starting at a word, zero padded
+ */
+static void CSEC_WriteBytes(uint32_t word, const uint8_t *data, uint32_t length)
+{
+    uint32_t value;
+
+    for (uint32_t i = 0; i < length; i += 4U) {
+        value = 0U;
+        for (uint32_t j = 0; j < 4U; j++) {
+            value <<= 8;
+            if ((i + j) < length) {
+                value |= data[i + j];
+            }
+        }
+        CSE_PRAM->RAMn[word + (i / 4U)] = value;
+    }
+}
+
+static void CSEC_ReadBytes(uint32_t word, uint8_t *data, uint32_t length)
+{
+    uint32_t value = 0U;
+
+    for (uint32_t i = 0; i < length; i++) {
+        if ((i & 3U) == 0U) {
+            value = CSE_PRAM->RAMn[word + (i / 4U)];
+        }
+        data[i] = (uint8_t)(value >> 24);
+        value <<= 8;
+    }
+}
+
+/**
+ * @brief Launch a command by writing its header and wait for completion
+ */
+static csec_status_t CSEC_Run(uint32_t header)
+{
+    CSE_PRAM->RAMn[0] = header;
+
+    while (!FTFC_IsIdle()) {
+    }
+
+    s_last_error = (uint16_t)(CSE_PRAM->RAMn[CSE_PRAM_ERROR_WORD] >> CSE_PRAM_ERROR_SHIFT);
+
+    if (s_last_error == CSEC_ERC_NO_ERROR) {
+        return CSEC_STATUS_SUCCESS;
+    }
+
+    if ((s_last_error & (CSEC_ERC_KEY_NOT_AVAILABLE | CSEC_ERC_KEY_INVALID | CSEC_ERC_KEY_EMPTY)) != 0U) {
+        return CSEC_STATUS_KEY_ERROR;
+    }
+
+    return CSEC_STATUS_ERROR;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+csec_status_t CSEC_LoadPlainKey(const uint8_t *key)
+{
+    if (key == NULL) {
+        return CSEC_STATUS_INVALID_PARAM;
+    }
+
+    if (!FTFC_IsIdle()) {
+        return CSEC_STATUS_BUSY;
+    }
+
+    CSEC_WriteBytes(CSE_PRAM_PAGE_WORDS, key, CSEC_KEY_SIZE);
+
+    return CSEC_Run(CSE_PRAM_HDR(CSEC_CMD_LOAD_PLAIN_KEY, CSEC_FORMAT_COPY, CSEC_CALL_FIRST, 0U));
+}
+
+csec_status_t CSEC_GenerateMac(uint8_t keyId, const uint8_t *msg, uint32_t length, uint8_t *mac)
+{
+    csec_status_t status;
+
+    if ((msg == NULL && length != 0U) || mac == NULL || length > CSEC_MAC_MAX_MESSAGE) {
+        return CSEC_STATUS_INVALID_PARAM;
+    }
+
+    if (!FTFC_IsIdle()) {
+        return CSEC_STATUS_BUSY;
+    }
+
+    /* Length in bits in word 3, message from page 1 */
+    CSE_PRAM->RAMn[CSE_PRAM_MSG_LEN_WORD] = length * 8U;
+    CSEC_WriteBytes(CSE_PRAM_PAGE_WORDS, msg, length);
+
+    status = CSEC_Run(CSE_PRAM_HDR(CSEC_CMD_GENERATE_MAC, CSEC_FORMAT_COPY, CSEC_CALL_FIRST, keyId));
+    if (status != CSEC_STATUS_SUCCESS) {
+        return status;
+    }
+
+    /* MAC is returned in page 2 */
+    CSEC_ReadBytes(2U * CSE_PRAM_PAGE_WORDS, mac, CSEC_MAC_SIZE);
+
+    return CSEC_STATUS_SUCCESS;
+}
+
+uint16_t CSEC_GetLastError(void)
+{
+    return s_last_error;
+}
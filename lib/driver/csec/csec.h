@@ -0,0 +1,107 @@
+/**
+ * @file    csec.h
+ * @brief   CSEc Driver API for S32K144
+ * @details Command interface of the Cryptographic Services Engine (SHE
+ *          compatible) built into the flash controller:
+ *
+ * Features:
+ * - Plain key load into the volatile RAM_KEY slot
+ * - AES-128 CMAC generation with any key slot (copy method, messages up
+ *   to 112 bytes in one command call)
+ *
+ * Commands are written to CSE_PRAM and complete when FSTAT.CCIF is set
+ * again, so they share the FTFC command controller with flash and EEE
+ * operations: a command is refused with CSEC_STATUS_BUSY while one of
+ * those is in progress. CSEc must have been enabled once by partitioning
+ * FlexNVM with a key size (FTFC_ProgramPartition()).
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef CSEC_H
+#define CSEC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "csec_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Command codes (FuncID) */
+#define CSEC_CMD_ENC_ECB            (0x01U)
+#define CSEC_CMD_GENERATE_MAC       (0x05U)
+#define CSEC_CMD_VERIFY_MAC         (0x06U)
+#define CSEC_CMD_LOAD_PLAIN_KEY     (0x08U)
+
+/** @brief Function format: data copied through CSE_PRAM */
+#define CSEC_FORMAT_COPY            (0x00U)
+
+/** @brief Call sequence */
+#define CSEC_CALL_FIRST             (0x00U)
+#define CSEC_CALL_SUBSEQUENT        (0x01U)
+
+/** @brief Key slots */
+#define CSEC_KEY_1                  (0x04U)         /* First non-volatile user key */
+#define CSEC_KEY_RAM                (0x0FU)         /* Volatile, loaded with CSEC_LoadPlainKey() */
+
+/** @brief Error bits returned in CSE_PRAM word 1 */
+#define CSEC_ERC_NO_ERROR           (0x0001U)
+#define CSEC_ERC_SEQUENCE_ERROR     (0x0002U)
+#define CSEC_ERC_KEY_NOT_AVAILABLE  (0x0004U)
+#define CSEC_ERC_KEY_INVALID        (0x0008U)
+#define CSEC_ERC_KEY_EMPTY          (0x0010U)
+#define CSEC_ERC_GENERAL_ERROR      (0x0800U)
+
+/** @brief Sizes */
+#define CSEC_KEY_SIZE               (16U)
+#define CSEC_MAC_SIZE               (16U)
+#define CSEC_MAC_MAX_MESSAGE        (7U * CSE_PRAM_PAGE_SIZE)   /* Pages 1-7 */
+
+/**
+ * @brief CSEc driver status codes
+ */
+typedef enum {
+    CSEC_STATUS_SUCCESS = 0,        /**< Command completed */
+    CSEC_STATUS_ERROR,              /**< Command failed (see CSEC_GetLastError()) */
+    CSEC_STATUS_BUSY,               /**< Flash controller busy */
+    CSEC_STATUS_KEY_ERROR,          /**< Key slot empty, invalid or not usable */
+    CSEC_STATUS_INVALID_PARAM       /**< Invalid parameter */
+} csec_status_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Load a key into the RAM_KEY slot
+ * @param key 16-byte AES key
+ * @return csec_status_t Status of operation
+ */
+csec_status_t CSEC_LoadPlainKey(const uint8_t *key);
+
+/**
+ * @brief Compute an AES-128 CMAC
+ * @details Blocks until the engine finishes (a few microseconds for one
+ *          block).
+ * @param keyId Key slot (CSEC_KEY_RAM, CSEC_KEY_1, ...)
+ * @param msg Message
+ * @param length Message length in bytes, up to CSEC_MAC_MAX_MESSAGE
+ * @param mac Receives the 16-byte MAC
+ * @return csec_status_t Status of operation
+ */
+csec_status_t CSEC_GenerateMac(uint8_t keyId, const uint8_t *msg, uint32_t length, uint8_t *mac);
+
+/**
+ * @brief Error bits of the last command
+ * @return uint16_t CSEC_ERC_x flags
+ */
+uint16_t CSEC_GetLastError(void);
+
+#endif /* CSEC_H */
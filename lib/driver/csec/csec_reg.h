@@ -0,0 +1,88 @@
+/*
+ * @file    csec_reg.h
+ * @brief   CSEc (Cryptographic Services Engine) Register Definitions for S32K144
+ */
+
+#ifndef CSEC_REG_H_
+#define CSEC_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+/**
+*   IO Type Qualifiers are used
+*   \li to specify the access to peripheral variables.
+*   \li for automatic generation of peripheral register debug information.
+*/
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- CSE_PRAM Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup CSE_PRAM_Peripheral_Access_Layer CSE_PRAM Peripheral Access Layer
+ * @{
+ */
+
+/** CSE_PRAM - Size of Registers Arrays */
+#define CSE_PRAM_RAMn_COUNT                      32u
+
+/**
+ * CSE_PRAM - Register Layout Typedef
+ * 8 pages of 16 bytes. Each 32-bit word holds 4 command bytes, first byte
+ * in the most significant position. Writing word 0 (the command header)
+ * launches the command.
+ */
+typedef struct {
+  __IO uint32_t RAMn[CSE_PRAM_RAMn_COUNT];         /**< CSE PRAM word, array offset: 0x0, array step: 0x4 */
+} CSE_PRAM_Type, *CSE_PRAM_MemMapPtr;
+
+/** Number of instances of the CSE_PRAM module. */
+#define CSE_PRAM_INSTANCE_COUNT                  (1u)
+
+/* CSE_PRAM - Peripheral instance base addresses */
+/** Peripheral CSE_PRAM base address */
+#define CSE_PRAM_BASE                            (0x14001000u)
+/** Peripheral CSE_PRAM base pointer */
+#define CSE_PRAM                                 ((CSE_PRAM_Type *)CSE_PRAM_BASE)
+
+/* ----------------------------------------------------------------------------
+   -- CSE_PRAM Layout
+   ---------------------------------------------------------------------------- */
+
+#define CSE_PRAM_PAGE_SIZE                       (16u)       /**< Bytes per page */
+#define CSE_PRAM_PAGE_WORDS                      (4u)
+
+/*! @name Word 0 - Command header */
+/*! @{ */
+#define CSE_PRAM_HDR_FUNC_ID_SHIFT               (24U)
+#define CSE_PRAM_HDR_FUNC_FORMAT_SHIFT           (16U)
+#define CSE_PRAM_HDR_CALL_SEQ_SHIFT              (8U)
+#define CSE_PRAM_HDR_KEY_ID_SHIFT                (0U)
+#define CSE_PRAM_HDR(func, format, seq, key)     (((uint32_t)(func) << CSE_PRAM_HDR_FUNC_ID_SHIFT) | \
+                                                  ((uint32_t)(format) << CSE_PRAM_HDR_FUNC_FORMAT_SHIFT) | \
+                                                  ((uint32_t)(seq) << CSE_PRAM_HDR_CALL_SEQ_SHIFT) | \
+                                                  ((uint32_t)(key) << CSE_PRAM_HDR_KEY_ID_SHIFT))
+/*! @} */
+
+/*! @name Word 1 - Error bits (upper half) */
+/*! @{ */
+#define CSE_PRAM_ERROR_WORD                      (1U)
+#define CSE_PRAM_ERROR_SHIFT                     (16U)
+/*! @} */
+
+/*! @name Word 3 - Message length in bits (MAC commands) */
+/*! @{ */
+#define CSE_PRAM_MSG_LEN_WORD                    (3U)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group CSE_PRAM_Peripheral_Access_Layer */
+
+#endif /* CSEC_REG_H_ */
@@ -0,0 +1,244 @@
+/**
+ * @file    dma.c
+ * @brief   eDMA / DMAMUX Driver Implementation for S32K144
+ * @details TCD programming, request routing and channel interrupts
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "dma.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static dma_callback_t s_dma_callbacks[DMA_CHANNEL_COUNT];
+static void *s_dma_params[DMA_CHANNEL_COUNT];
+static bool s_dma_initialized = false;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void DMA_Init(void)
+{
+    /* Shared by several services - only the first call resets the engine */
+    if (s_dma_initialized) {
+        return;
+    }
+
+    /* Fixed priority, no minor loop mapping, stop in debug */
+    DMA->CR = DMA_CR_EDBG_MASK;
+
+    for (uint8_t ch = 0; ch < DMA_CHANNEL_COUNT; ch++) {
+        DMA->CERQ = ch;
+        DMAMUX->CHCFG[DMAMUX_CHCFG_IDX(ch)] = 0U;
+        s_dma_callbacks[ch] = NULL;
+        s_dma_params[ch] = NULL;
+    }
+
+    DMA->CINT = 0x40U;      /* CAIR: clear all interrupt requests */
+    DMA->CERR = 0x40U;      /* CAEI: clear all error indicators */
+    DMA->CDNE = 0x40U;      /* CADN: clear all DONE bits */
+
+    s_dma_initialized = true;
+}
+
+dma_status_t DMA_ConfigTransfer(uint8_t channel, const dma_transfer_config_t *config)
+{
+    dma_tcd_t tcd;
+
+    if (DMA_BuildTcd(&tcd, config, NULL) != DMA_STATUS_SUCCESS) {
+        return DMA_STATUS_INVALID_PARAM;
+    }
+
+    return DMA_LoadTcd(channel, &tcd);
+}
+
+dma_status_t DMA_BuildTcd(dma_tcd_t *tcd, const dma_transfer_config_t *config,
+                          const dma_tcd_t *next)
+{
+    uint16_t csr = 0;
+
+    if (tcd == NULL || config == NULL ||
+        config->major_count == 0U || config->major_count > DMA_MAX_MAJOR_COUNT) {
+        return DMA_STATUS_INVALID_PARAM;
+    }
+
+    if (config->int_major) {
+        csr |= DMA_TCD_CSR_INTMAJOR_MASK;
+    }
+    if (config->int_half) {
+        csr |= DMA_TCD_CSR_INTHALF_MASK;
+    }
+    if (config->disable_request) {
+        csr |= DMA_TCD_CSR_DREQ_MASK;
+    }
+
+    tcd->SADDR = config->src_addr;
+    tcd->SOFF = (uint16_t)config->src_offset;
+    tcd->ATTR = (uint16_t)(DMA_TCD_ATTR_SSIZE(config->src_size) |
+                           DMA_TCD_ATTR_DSIZE(config->dst_size));
+    tcd->NBYTES = config->minor_bytes;
+    tcd->SLAST = (uint32_t)config->src_last_adjust;
+    tcd->DADDR = config->dst_addr;
+    tcd->DOFF = (uint16_t)config->dst_offset;
+    tcd->CITER = config->major_count;
+    tcd->BITER = config->major_count;
+
+    if (next != NULL) {
+        tcd->DLASTSGA = (uint32_t)next;
+        csr |= DMA_TCD_CSR_ESG_MASK;
+    } else {
+        tcd->DLASTSGA = (uint32_t)config->dst_last_adjust;
+    }
+
+    tcd->CSR = csr;
+
+    return DMA_STATUS_SUCCESS;
+}
+
+dma_status_t DMA_LoadTcd(uint8_t channel, const dma_tcd_t *tcd)
+{
+    if (channel >= DMA_CHANNEL_COUNT || tcd == NULL) {
+        return DMA_STATUS_INVALID_PARAM;
+    }
+
+    if ((DMA->TCD[channel].CSR & DMA_TCD_CSR_ACTIVE_MASK) != 0U) {
+        return DMA_STATUS_BUSY;
+    }
+
+    /* CSR first: clears a stale START/DONE before the rest is loaded */
+    DMA->TCD[channel].CSR = 0U;
+    DMA->TCD[channel].SADDR = tcd->SADDR;
+    DMA->TCD[channel].SOFF = tcd->SOFF;
+    DMA->TCD[channel].ATTR = tcd->ATTR;
+    DMA->TCD[channel].NBYTES = tcd->NBYTES;
+    DMA->TCD[channel].SLAST = tcd->SLAST;
+    DMA->TCD[channel].DADDR = tcd->DADDR;
+    DMA->TCD[channel].DOFF = tcd->DOFF;
+    DMA->TCD[channel].CITER = tcd->CITER;
+    DMA->TCD[channel].BITER = tcd->BITER;
+    DMA->TCD[channel].DLASTSGA = tcd->DLASTSGA;
+    DMA->TCD[channel].CSR = tcd->CSR;
+
+    return DMA_STATUS_SUCCESS;
+}
+
+void DMA_SetRequestSource(uint8_t channel, dma_request_source_t source, bool periodic)
+{
+    uint8_t chcfg = 0;
+
+    if (channel >= DMA_CHANNEL_COUNT) {
+        return;
+    }
+
+    /* Source may only change while the slot is disabled */
+    DMAMUX->CHCFG[DMAMUX_CHCFG_IDX(channel)] = 0U;
+
+    if (source != DMA_REQ_DISABLED) {
+        chcfg = (uint8_t)(DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_SOURCE(source));
+        if (periodic && channel < 4U) {
+            chcfg |= DMAMUX_CHCFG_TRIG_MASK;
+        }
+    }
+
+    DMAMUX->CHCFG[DMAMUX_CHCFG_IDX(channel)] = chcfg;
+}
+
+void DMA_StartChannel(uint8_t channel)
+{
+    DMA->SERQ = channel;
+}
+
+void DMA_StopChannel(uint8_t channel)
+{
+    DMA->CERQ = channel;
+}
+
+void DMA_TriggerSoftware(uint8_t channel)
+{
+    DMA->SSRT = channel;
+}
+
+void DMA_SetAddresses(uint8_t channel, uint32_t src_addr, uint32_t dst_addr)
+{
+    DMA->TCD[channel].SADDR = src_addr;
+    DMA->TCD[channel].DADDR = dst_addr;
+}
+
+void DMA_SetMajorCount(uint8_t channel, uint16_t major_count)
+{
+    DMA->TCD[channel].CITER = major_count;
+    DMA->TCD[channel].BITER = major_count;
+}
+
+dma_status_t DMA_GetStatus(uint8_t channel)
+{
+    if ((DMA->ERR & (1UL << channel)) != 0U) {
+        return DMA_STATUS_ERROR;
+    }
+
+    if ((DMA->TCD[channel].CSR & DMA_TCD_CSR_DONE_MASK) != 0U) {
+        return DMA_STATUS_SUCCESS;
+    }
+
+    return DMA_STATUS_BUSY;
+}
+
+void DMA_ClearStatus(uint8_t channel)
+{
+    DMA->CDNE = channel;
+    DMA->CERR = channel;
+    DMA->CINT = channel;
+}
+
+void DMA_InstallCallback(uint8_t channel, dma_callback_t callback, void *param)
+{
+    if (channel >= DMA_CHANNEL_COUNT) {
+        return;
+    }
+
+    s_dma_params[channel] = param;
+    s_dma_callbacks[channel] = callback;
+}
+
+void DMA_IRQHandler(uint8_t channel)
+{
+    dma_event_t event;
+
+    DMA->CINT = channel;
+
+    /* A scatter/gather load replaces CSR (DONE reads 0), but CITER is
+       back at BITER after every major loop either way */
+    event = ((DMA->TCD[channel].CSR & DMA_TCD_CSR_DONE_MASK) != 0U ||
+             DMA->TCD[channel].CITER == DMA->TCD[channel].BITER) ?
+            DMA_EVENT_COMPLETE : DMA_EVENT_HALF_COMPLETE;
+
+    if (s_dma_callbacks[channel] != NULL) {
+        s_dma_callbacks[channel](channel, event, s_dma_params[channel]);
+    }
+}
+
+void DMA_ErrorIRQHandler(void)
+{
+    uint32_t errors = DMA->ERR;
+
+    for (uint8_t ch = 0; ch < DMA_CHANNEL_COUNT; ch++) {
+        if ((errors & (1UL << ch)) == 0U) {
+            continue;
+        }
+
+        DMA->CERQ = ch;
+        DMA->CERR = ch;
+
+        if (s_dma_callbacks[ch] != NULL) {
+            s_dma_callbacks[ch](ch, DMA_EVENT_ERROR, s_dma_params[ch]);
+        }
+    }
+}
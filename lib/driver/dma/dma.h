@@ -0,0 +1,296 @@
+/**
+ * @file    dma.h
+ * @brief   eDMA / DMAMUX Driver API for S32K144
+ * @details Channel-level access to the 16-channel eDMA engine:
+ *
+ * Features:
+ * - Transfer control descriptor (TCD) setup from a plain config struct
+ * - DMAMUX request routing (peripheral, always-on, LPIT periodic trigger)
+ * - Software start, hardware request enable/disable
+ * - Per-channel major-loop / half-major callbacks
+ * - Scatter/gather descriptor rings (ping-pong buffers)
+ *
+ * Channel numbers are shared by all users; services take them from the
+ * resource registry (res_srv, RES_SRV_DMA_CHANNEL).
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef DMA_H
+#define DMA_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "dma_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Number of eDMA channels */
+#define DMA_CHANNEL_COUNT           (16U)
+
+/** @brief Largest major loop count (ELINK disabled) */
+#define DMA_MAX_MAJOR_COUNT         (0x7FFFU)
+
+/**
+ * @brief DMA driver status codes
+ */
+typedef enum {
+    DMA_STATUS_SUCCESS = 0,         /**< Operation successful */
+    DMA_STATUS_ERROR,               /**< Channel reported a transfer error */
+    DMA_STATUS_BUSY,                /**< Channel still active */
+    DMA_STATUS_INVALID_PARAM        /**< Invalid parameter */
+} dma_status_t;
+
+/**
+ * @brief Transfer size per read/write (TCD ATTR SSIZE/DSIZE encoding)
+ */
+typedef enum {
+    DMA_TRANSFER_SIZE_1B  = 0U,
+    DMA_TRANSFER_SIZE_2B  = 1U,
+    DMA_TRANSFER_SIZE_4B  = 2U,
+    DMA_TRANSFER_SIZE_16B = 4U,
+    DMA_TRANSFER_SIZE_32B = 5U
+} dma_transfer_size_t;
+
+/**
+ * @brief DMAMUX request sources (S32K144)
+ */
+typedef enum {
+    DMA_REQ_DISABLED            = 0U,
+    DMA_REQ_LPUART0_RX          = 2U,
+    DMA_REQ_LPUART0_TX          = 3U,
+    DMA_REQ_LPUART1_RX          = 4U,
+    DMA_REQ_LPUART1_TX          = 5U,
+    DMA_REQ_LPUART2_RX          = 6U,
+    DMA_REQ_LPUART2_TX          = 7U,
+    DMA_REQ_LPI2C1_RX           = 8U,
+    DMA_REQ_LPI2C1_TX           = 9U,
+    DMA_REQ_FLEXIO_SHIFTER0     = 10U,
+    DMA_REQ_FLEXIO_SHIFTER1     = 11U,
+    DMA_REQ_FLEXIO_SHIFTER2     = 12U,
+    DMA_REQ_FLEXIO_SHIFTER3     = 13U,
+    DMA_REQ_LPSPI0_RX           = 14U,
+    DMA_REQ_LPSPI0_TX           = 15U,
+    DMA_REQ_LPSPI1_RX           = 16U,
+    DMA_REQ_LPSPI1_TX           = 17U,
+    DMA_REQ_LPSPI2_RX           = 18U,
+    DMA_REQ_LPSPI2_TX           = 19U,
+    DMA_REQ_FTM1_CH0            = 20U,      /* FTM1 CH0-CH7 = 20-27 */
+    DMA_REQ_FTM2_CH0            = 28U,      /* FTM2 CH0-CH7 = 28-35 */
+    DMA_REQ_FTM0_OR_CH0_CH7     = 36U,
+    DMA_REQ_FTM3_OR_CH0_CH7     = 37U,
+    DMA_REQ_ADC0                = 42U,
+    DMA_REQ_ADC1                = 43U,
+    DMA_REQ_LPI2C0_RX           = 44U,
+    DMA_REQ_LPI2C0_TX           = 45U,
+    DMA_REQ_PDB0                = 46U,
+    DMA_REQ_PDB1                = 47U,
+    DMA_REQ_CMP0                = 48U,
+    DMA_REQ_PORTA               = 49U,
+    DMA_REQ_PORTB               = 50U,
+    DMA_REQ_PORTC               = 51U,
+    DMA_REQ_PORTD               = 52U,
+    DMA_REQ_PORTE               = 53U,
+    DMA_REQ_FLEXCAN0            = 54U,
+    DMA_REQ_FLEXCAN1            = 55U,
+    DMA_REQ_FLEXCAN2            = 56U,
+    DMA_REQ_LPTMR0              = 59U,
+    DMA_REQ_ALWAYS_ON0          = 62U,
+    DMA_REQ_ALWAYS_ON1          = 63U
+} dma_request_source_t;
+
+/**
+ * @brief Channel event passed to the callback
+ */
+typedef enum {
+    DMA_EVENT_HALF_COMPLETE = 0,    /**< Half of the major loop done */
+    DMA_EVENT_COMPLETE,             /**< Major loop done */
+    DMA_EVENT_ERROR                 /**< Transfer error */
+} dma_event_t;
+
+/**
+ * @brief Channel callback (interrupt context)
+ */
+typedef void (*dma_callback_t)(uint8_t channel, dma_event_t event, void *param);
+
+/**
+ * @brief Transfer descriptor
+ * @details One major loop of major_count minor loops, minor_bytes each.
+ *          Offsets are added after every read/write; the *_last_adjust
+ *          values are added once when the major loop completes.
+ */
+typedef struct {
+    uint32_t src_addr;              /**< Source address */
+    uint32_t dst_addr;              /**< Destination address */
+    int16_t src_offset;             /**< Added to the source after each read */
+    int16_t dst_offset;             /**< Added to the destination after each write */
+    dma_transfer_size_t src_size;   /**< Read size */
+    dma_transfer_size_t dst_size;   /**< Write size */
+    uint32_t minor_bytes;           /**< Bytes per request (minor loop) */
+    uint16_t major_count;           /**< Minor loops per major loop (1-32767) */
+    int32_t src_last_adjust;        /**< Source adjustment at major loop end */
+    int32_t dst_last_adjust;        /**< Destination adjustment at major loop end */
+    bool int_major;                 /**< Interrupt at major loop end */
+    bool int_half;                  /**< Interrupt at half major loop */
+    bool disable_request;           /**< Clear ERQ at major loop end (one-shot) */
+} dma_transfer_config_t;
+
+/**
+ * @brief Memory image of a TCD (scatter/gather)
+ * @details With scatter/gather the engine loads the next descriptor from
+ *          memory when a major loop completes, so a ring of descriptors
+ *          runs without CPU involvement. Layout matches DMA->TCD[n].
+ */
+typedef struct {
+    uint32_t SADDR;
+    uint16_t SOFF;
+    uint16_t ATTR;
+    uint32_t NBYTES;
+    uint32_t SLAST;
+    uint32_t DADDR;
+    uint16_t DOFF;
+    uint16_t CITER;
+    uint32_t DLASTSGA;
+    uint16_t CSR;
+    uint16_t BITER;
+} __attribute__((aligned(32))) dma_tcd_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the eDMA engine
+ * @details Round-robin off (fixed priority), halt on error disabled, debug
+ *          halt enabled. The DMAMUX clock must be enabled by the caller.
+ *          Only the first call has an effect, so every user of a channel
+ *          may call it.
+ */
+void DMA_Init(void);
+
+/**
+ * @brief Load a channel TCD
+ * @param channel Channel number (0-15)
+ * @param config Transfer descriptor
+ * @return dma_status_t DMA_STATUS_BUSY if the channel is active
+ */
+dma_status_t DMA_ConfigTransfer(uint8_t channel, const dma_transfer_config_t *config);
+
+/**
+ * @brief Build a descriptor in memory
+ * @param tcd Descriptor to fill (32-byte aligned)
+ * @param config Transfer descriptor
+ * @param next Descriptor loaded when this major loop completes, NULL for
+ *        none. dst_last_adjust is ignored when next is given (the
+ *        DLASTSGA field holds the link).
+ * @return dma_status_t Status of operation
+ */
+dma_status_t DMA_BuildTcd(dma_tcd_t *tcd, const dma_transfer_config_t *config,
+                          const dma_tcd_t *next);
+
+/**
+ * @brief Load a memory descriptor into a channel
+ * @param channel Channel number (0-15)
+ * @param tcd Descriptor built with DMA_BuildTcd()
+ * @return dma_status_t DMA_STATUS_BUSY if the channel is active
+ */
+dma_status_t DMA_LoadTcd(uint8_t channel, const dma_tcd_t *tcd);
+
+/**
+ * @brief Route a DMAMUX request source to a channel
+ * @param channel Channel number (0-15)
+ * @param source Request source, DMA_REQ_DISABLED to disconnect
+ * @param periodic true to gate the request with the LPIT trigger of the
+ *        same number (channels 0-3 only)
+ */
+void DMA_SetRequestSource(uint8_t channel, dma_request_source_t source, bool periodic);
+
+/**
+ * @brief Enable hardware requests of a channel
+ * @param channel Channel number (0-15)
+ */
+void DMA_StartChannel(uint8_t channel);
+
+/**
+ * @brief Disable hardware requests of a channel
+ * @param channel Channel number (0-15)
+ */
+void DMA_StopChannel(uint8_t channel);
+
+/**
+ * @brief Start one minor loop by software
+ * @param channel Channel number (0-15)
+ */
+void DMA_TriggerSoftware(uint8_t channel);
+
+/**
+ * @brief Set source and destination address without touching the rest
+ *        of the TCD (ping-pong re-arm)
+ */
+void DMA_SetAddresses(uint8_t channel, uint32_t src_addr, uint32_t dst_addr);
+
+/**
+ * @brief Reload the major loop count
+ */
+void DMA_SetMajorCount(uint8_t channel, uint16_t major_count);
+
+/**
+ * @brief Check whether the major loop is complete
+ * @param channel Channel number (0-15)
+ * @return true if DONE is set
+ */
+static inline bool DMA_IsDone(uint8_t channel)
+{
+    return (DMA->TCD[channel].CSR & DMA_TCD_CSR_DONE_MASK) != 0U;
+}
+
+/**
+ * @brief Remaining minor loops of the current major loop
+ * @param channel Channel number (0-15)
+ * @return uint16_t CITER
+ */
+static inline uint16_t DMA_GetRemainingMajor(uint8_t channel)
+{
+    return (uint16_t)(DMA->TCD[channel].CITER & DMA_TCD_CITER_CITER_MASK);
+}
+
+/**
+ * @brief Get channel status
+ * @param channel Channel number (0-15)
+ * @return dma_status_t SUCCESS when done, BUSY while running, ERROR on error
+ */
+dma_status_t DMA_GetStatus(uint8_t channel);
+
+/**
+ * @brief Clear DONE, error and interrupt flags of a channel
+ * @param channel Channel number (0-15)
+ */
+void DMA_ClearStatus(uint8_t channel);
+
+/**
+ * @brief Install a channel callback
+ * @param channel Channel number (0-15)
+ * @param callback Callback, NULL to remove
+ * @param param User parameter passed back to the callback
+ */
+void DMA_InstallCallback(uint8_t channel, dma_callback_t callback, void *param);
+
+/**
+ * @brief Channel interrupt handler (called from dma_irq.c)
+ * @param channel Channel number (0-15)
+ */
+void DMA_IRQHandler(uint8_t channel);
+
+/**
+ * @brief Error interrupt handler (called from dma_irq.c)
+ */
+void DMA_ErrorIRQHandler(void);
+
+#endif /* DMA_H */
@@ -0,0 +1,45 @@
+/**
+ * @file    dma_irq.c
+ * @brief   eDMA Interrupt Service Routine Implementation
+ * @details Implements eDMA ISRs and forwards to driver layer handler
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "dma_irq.h"
+
+/*******************************************************************************
+ * ISR Implementation
+ ******************************************************************************/
+
+/* Channel transfer complete - forward to driver layer handler */
+void DMA0_IRQHandler(void)  { DMA_IRQHandler(0U); }
+void DMA1_IRQHandler(void)  { DMA_IRQHandler(1U); }
+void DMA2_IRQHandler(void)  { DMA_IRQHandler(2U); }
+void DMA3_IRQHandler(void)  { DMA_IRQHandler(3U); }
+void DMA4_IRQHandler(void)  { DMA_IRQHandler(4U); }
+void DMA5_IRQHandler(void)  { DMA_IRQHandler(5U); }
+void DMA6_IRQHandler(void)  { DMA_IRQHandler(6U); }
+void DMA7_IRQHandler(void)  { DMA_IRQHandler(7U); }
+void DMA8_IRQHandler(void)  { DMA_IRQHandler(8U); }
+void DMA9_IRQHandler(void)  { DMA_IRQHandler(9U); }
+void DMA10_IRQHandler(void)  { DMA_IRQHandler(10U); }
+void DMA11_IRQHandler(void)  { DMA_IRQHandler(11U); }
+void DMA12_IRQHandler(void)  { DMA_IRQHandler(12U); }
+void DMA13_IRQHandler(void)  { DMA_IRQHandler(13U); }
+void DMA14_IRQHandler(void)  { DMA_IRQHandler(14U); }
+void DMA15_IRQHandler(void)  { DMA_IRQHandler(15U); }
+
+/**
+ * @brief eDMA error service routine
+ * @details Called by hardware when any channel reports a transfer error
+ */
+void DMA_Error_IRQHandler(void) {
+    /* Forward to driver layer handler */
+    DMA_ErrorIRQHandler();
+}
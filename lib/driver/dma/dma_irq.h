@@ -0,0 +1,58 @@
+/**
+ * @file    dma_irq.h
+ * @brief   eDMA Interrupt Handler Declarations
+ * @details Provides ISR declarations for eDMA interrupts following CMSIS naming convention
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef DMA_IRQ_H
+#define DMA_IRQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "dma.h"
+
+/*******************************************************************************
+ * ISR Declarations
+ ******************************************************************************/
+
+/**
+ * @brief eDMA channel 0-15 transfer complete service routines
+ * @note These functions should be defined in the startup vector table
+ */
+void DMA0_IRQHandler(void);
+void DMA1_IRQHandler(void);
+void DMA2_IRQHandler(void);
+void DMA3_IRQHandler(void);
+void DMA4_IRQHandler(void);
+void DMA5_IRQHandler(void);
+void DMA6_IRQHandler(void);
+void DMA7_IRQHandler(void);
+void DMA8_IRQHandler(void);
+void DMA9_IRQHandler(void);
+void DMA10_IRQHandler(void);
+void DMA11_IRQHandler(void);
+void DMA12_IRQHandler(void);
+void DMA13_IRQHandler(void);
+void DMA14_IRQHandler(void);
+void DMA15_IRQHandler(void);
+
+/**
+ * @brief eDMA error service routine (channels 0-15)
+ * @note This function should be defined in the startup vector table
+ */
+void DMA_Error_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DMA_IRQ_H */
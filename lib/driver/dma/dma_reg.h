@@ -0,0 +1,171 @@
+/*
+ * @file    dma_reg.h
+ * @brief   eDMA and DMAMUX Register Definitions for S32K144
+ */
+
+#ifndef DMA_REG_H_
+#define DMA_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+/**
+*   IO Type Qualifiers are used
+*   \li to specify the access to peripheral variables.
+*   \li for automatic generation of peripheral register debug information.
+*/
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- DMA Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup DMA_Peripheral_Access_Layer DMA Peripheral Access Layer
+ * @{
+ */
+
+/** DMA - Size of Registers Arrays */
+#define DMA_DCHPRI_COUNT                          16u
+#define DMA_TCD_COUNT                             16u
+
+/** DMA - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t CR;                                /**< Control, offset: 0x0 */
+  __I  uint32_t ES;                                /**< Error Status, offset: 0x4 */
+  uint8_t RESERVED_0[4];
+  __IO uint32_t ERQ;                               /**< Enable Request, offset: 0xC */
+  uint8_t RESERVED_1[4];
+  __IO uint32_t EEI;                               /**< Enable Error Interrupt, offset: 0x14 */
+  __O  uint8_t CEEI;                               /**< Clear Enable Error Interrupt, offset: 0x18 */
+  __O  uint8_t SEEI;                               /**< Set Enable Error Interrupt, offset: 0x19 */
+  __O  uint8_t CERQ;                               /**< Clear Enable Request, offset: 0x1A */
+  __O  uint8_t SERQ;                               /**< Set Enable Request, offset: 0x1B */
+  __O  uint8_t CDNE;                               /**< Clear DONE Status Bit, offset: 0x1C */
+  __O  uint8_t SSRT;                               /**< Set START Bit, offset: 0x1D */
+  __O  uint8_t CERR;                               /**< Clear Error, offset: 0x1E */
+  __O  uint8_t CINT;                               /**< Clear Interrupt Request, offset: 0x1F */
+  uint8_t RESERVED_2[4];
+  __IO uint32_t INT;                               /**< Interrupt Request, offset: 0x24 */
+  uint8_t RESERVED_3[4];
+  __IO uint32_t ERR;                               /**< Error, offset: 0x2C */
+  uint8_t RESERVED_4[4];
+  __I  uint32_t HRS;                               /**< Hardware Request Status, offset: 0x34 */
+  uint8_t RESERVED_5[12];
+  __IO uint32_t EARS;                              /**< Enable Asynchronous Request in Stop, offset: 0x44 */
+  uint8_t RESERVED_6[184];
+  __IO uint8_t DCHPRI[DMA_DCHPRI_COUNT];           /**< Channel Priority, array offset: 0x100, array step: 0x1 */
+  uint8_t RESERVED_7[3824];
+  struct {                                         /* offset: 0x1000, array step: 0x20 */
+    __IO uint32_t SADDR;                             /**< TCD Source Address */
+    __IO uint16_t SOFF;                              /**< TCD Signed Source Address Offset */
+    __IO uint16_t ATTR;                              /**< TCD Transfer Attributes */
+    __IO uint32_t NBYTES;                            /**< TCD Minor Byte Count (minor loop mapping disabled) */
+    __IO uint32_t SLAST;                             /**< TCD Last Source Address Adjustment */
+    __IO uint32_t DADDR;                             /**< TCD Destination Address */
+    __IO uint16_t DOFF;                              /**< TCD Signed Destination Address Offset */
+    __IO uint16_t CITER;                             /**< TCD Current Major Loop Count (channel linking disabled) */
+    __IO uint32_t DLASTSGA;                          /**< TCD Last Destination Address Adjustment/Scatter Gather Address */
+    __IO uint16_t CSR;                               /**< TCD Control and Status */
+    __IO uint16_t BITER;                             /**< TCD Beginning Major Loop Count (channel linking disabled) */
+  } TCD[DMA_TCD_COUNT];
+} DMA_Type, *DMA_MemMapPtr;
+
+/** Number of instances of the DMA module. */
+#define DMA_INSTANCE_COUNT                       (1u)
+
+/** Peripheral DMA base address */
+#define DMA_BASE                                 (0x40008000u)
+/** Peripheral DMA base pointer */
+#define DMA                                      ((DMA_Type *)DMA_BASE)
+
+/* ----------------------------------------------------------------------------
+   -- DMA Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*! @name CR - Control */
+#define DMA_CR_EDBG_MASK                         (0x2U)
+#define DMA_CR_ERCA_MASK                         (0x4U)
+#define DMA_CR_HOE_MASK                          (0x10U)
+#define DMA_CR_HALT_MASK                         (0x20U)
+#define DMA_CR_CLM_MASK                          (0x40U)
+#define DMA_CR_EMLM_MASK                         (0x80U)
+#define DMA_CR_ECX_MASK                          (0x10000U)
+#define DMA_CR_CX_MASK                           (0x20000U)
+#define DMA_CR_ACTIVE_MASK                       (0x80000000U)
+
+/*! @name ES - Error Status */
+#define DMA_ES_VLD_MASK                          (0x80000000U)
+
+/*! @name DCHPRI - Channel Priority */
+#define DMA_DCHPRI_CHPRI_MASK                    (0xFU)
+#define DMA_DCHPRI_DPA_MASK                      (0x40U)
+#define DMA_DCHPRI_ECP_MASK                      (0x80U)
+
+/** DCHPRI registers are stored big-endian within each 32-bit group */
+#define DMA_DCHPRI_IDX(n)                        ((((n) & ~3u)) + 3u - ((n) & 3u))
+
+/*! @name TCD_ATTR - TCD Transfer Attributes */
+#define DMA_TCD_ATTR_DSIZE_MASK                  (0x7U)
+#define DMA_TCD_ATTR_DSIZE_SHIFT                 (0U)
+#define DMA_TCD_ATTR_DSIZE(x)                    (((uint16_t)(((uint16_t)(x)) << DMA_TCD_ATTR_DSIZE_SHIFT)) & DMA_TCD_ATTR_DSIZE_MASK)
+#define DMA_TCD_ATTR_DMOD_MASK                   (0xF8U)
+#define DMA_TCD_ATTR_DMOD_SHIFT                  (3U)
+#define DMA_TCD_ATTR_DMOD(x)                     (((uint16_t)(((uint16_t)(x)) << DMA_TCD_ATTR_DMOD_SHIFT)) & DMA_TCD_ATTR_DMOD_MASK)
+#define DMA_TCD_ATTR_SSIZE_MASK                  (0x700U)
+#define DMA_TCD_ATTR_SSIZE_SHIFT                 (8U)
+#define DMA_TCD_ATTR_SSIZE(x)                    (((uint16_t)(((uint16_t)(x)) << DMA_TCD_ATTR_SSIZE_SHIFT)) & DMA_TCD_ATTR_SSIZE_MASK)
+#define DMA_TCD_ATTR_SMOD_MASK                   (0xF800U)
+#define DMA_TCD_ATTR_SMOD_SHIFT                  (11U)
+#define DMA_TCD_ATTR_SMOD(x)                     (((uint16_t)(((uint16_t)(x)) << DMA_TCD_ATTR_SMOD_SHIFT)) & DMA_TCD_ATTR_SMOD_MASK)
+
+/*! @name TCD_CITER/BITER - Major Loop Count (channel linking disabled) */
+#define DMA_TCD_CITER_CITER_MASK                 (0x7FFFU)
+#define DMA_TCD_BITER_BITER_MASK                 (0x7FFFU)
+
+/*! @name TCD_CSR - TCD Control and Status */
+#define DMA_TCD_CSR_START_MASK                   (0x1U)
+#define DMA_TCD_CSR_INTMAJOR_MASK                (0x2U)
+#define DMA_TCD_CSR_INTHALF_MASK                 (0x4U)
+#define DMA_TCD_CSR_DREQ_MASK                    (0x8U)
+#define DMA_TCD_CSR_ESG_MASK                     (0x10U)
+#define DMA_TCD_CSR_MAJORELINK_MASK              (0x20U)
+#define DMA_TCD_CSR_ACTIVE_MASK                  (0x40U)
+#define DMA_TCD_CSR_DONE_MASK                    (0x80U)
+#define DMA_TCD_CSR_MAJORLINKCH_MASK             (0xF00U)
+#define DMA_TCD_CSR_MAJORLINKCH_SHIFT            (8U)
+#define DMA_TCD_CSR_BWC_MASK                     (0xC000U)
+#define DMA_TCD_CSR_BWC_SHIFT                    (14U)
+
+/* ----------------------------------------------------------------------------
+   -- DMAMUX Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/** DMAMUX - Size of Registers Arrays */
+#define DMAMUX_CHCFG_COUNT                       16u
+
+/** DMAMUX - Register Layout Typedef */
+typedef struct {
+  __IO uint8_t CHCFG[DMAMUX_CHCFG_COUNT];          /**< Channel Configuration register, array offset: 0x0, array step: 0x1 */
+} DMAMUX_Type, *DMAMUX_MemMapPtr;
+
+/** Peripheral DMAMUX base address */
+#define DMAMUX_BASE                              (0x40021000u)
+/** Peripheral DMAMUX base pointer */
+#define DMAMUX                                   ((DMAMUX_Type *)DMAMUX_BASE)
+
+/** CHCFG registers are stored big-endian within each 32-bit group */
+#define DMAMUX_CHCFG_IDX(n)                      ((((n) & ~3u)) + 3u - ((n) & 3u))
+
+/*! @name CHCFG - Channel Configuration register */
+#define DMAMUX_CHCFG_SOURCE_MASK                 (0x3FU)
+#define DMAMUX_CHCFG_SOURCE_SHIFT                (0U)
+#define DMAMUX_CHCFG_SOURCE(x)                   (((uint8_t)(((uint8_t)(x)) << DMAMUX_CHCFG_SOURCE_SHIFT)) & DMAMUX_CHCFG_SOURCE_MASK)
+#define DMAMUX_CHCFG_TRIG_MASK                   (0x40U)
+#define DMAMUX_CHCFG_ENBL_MASK                   (0x80U)
+
+#endif /* DMA_REG_H_ */
@@ -0,0 +1,272 @@
+/**
+ * @file    flexio.c
+ * @brief   FlexIO Driver Implementation for S32K144
+ * @details UART and SPI master shifter/timer setup, DMA and interrupts
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "flexio.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static flexio_callback_t s_flexio_callback = NULL;
+static void *s_flexio_user_data = NULL;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static bool FLEXIO_IsValid(FLEXIO_Type *base)
+{
+    return base == FLEXIO;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void FLEXIO_Init(FLEXIO_Type *base)
+{
+    if (!FLEXIO_IsValid(base)) {
+        return;
+    }
+
+    base->CTRL = FLEXIO_CTRL_SWRST_MASK;
+    base->CTRL = 0U;
+
+    base->SHIFTSIEN = 0U;
+    base->SHIFTEIEN = 0U;
+    base->TIMIEN = 0U;
+    base->SHIFTSDEN = 0U;
+    base->SHIFTERR = FLEXIO_FLAGS_MASK;
+    base->TIMSTAT = FLEXIO_FLAGS_MASK;
+
+    /* Keep running while halted so a debugger does not corrupt frames */
+    base->CTRL = FLEXIO_CTRL_FLEXEN_MASK | FLEXIO_CTRL_DBGE_MASK;
+}
+
+void FLEXIO_Deinit(FLEXIO_Type *base)
+{
+    if (!FLEXIO_IsValid(base)) {
+        return;
+    }
+
+    base->CTRL = FLEXIO_CTRL_SWRST_MASK;
+    base->CTRL = 0U;
+}
+
+flexio_status_t FLEXIO_ConfigUartTx(FLEXIO_Type *base, const flexio_uart_config_t *config)
+{
+    if (!FLEXIO_IsValid(base) || config == NULL || config->shifter >= FLEXIO_SHIFTER_COUNT ||
+        config->timer >= FLEXIO_TIMER_COUNT || config->pin >= FLEXIO_PIN_COUNT) {
+        return FLEXIO_STATUS_INVALID_PARAM;
+    }
+
+    /* Start bit 0, stop bit 1, shift on the timer's rising edge */
+    base->SHIFTCFG[config->shifter] = FLEXIO_SHIFTCFG_SSTART(FLEXIO_SHIFTCFG_START_ZERO) |
+                                      FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTCFG_STOP_ONE);
+    base->SHIFTCTL[config->shifter] = FLEXIO_SHIFTCTL_TIMSEL(config->timer) |
+                                      FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PINCFG_OUTPUT) |
+                                      FLEXIO_SHIFTCTL_PINSEL(config->pin) |
+                                      FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTCTL_SMOD_TRANSMIT);
+
+    /* Enabled by the shifter (buffer written), disabled after 10 bits */
+    base->TIMCMP[config->timer] = FLEXIO_TIMCMP_BAUD(8U, config->half_period);
+    base->TIMCFG[config->timer] = FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMCFG_TIMOUT_ONE) |
+                                  FLEXIO_TIMCFG_TIMRST(FLEXIO_TIMCFG_TIMRST_NEVER) |
+                                  FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMCFG_TIMDIS_COMPARE) |
+                                  FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMCFG_TIMENA_TRIGGER_HIGH) |
+                                  FLEXIO_TIMCFG_TSTOP(FLEXIO_TIMCFG_TSTOP_ON_DISABLE) |
+                                  FLEXIO_TIMCFG_TSTART_MASK;
+    base->TIMCTL[config->timer] = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TIMCTL_TRGSEL_SHIFTER(config->shifter)) |
+                                  FLEXIO_TIMCTL_TRGPOL_MASK | FLEXIO_TIMCTL_TRGSRC_MASK |
+                                  FLEXIO_TIMCTL_PINCFG(FLEXIO_PINCFG_OUTPUT_DISABLED) |
+                                  FLEXIO_TIMCTL_PINSEL(config->pin) |
+                                  FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMCTL_TIMOD_BAUD);
+
+    return FLEXIO_STATUS_SUCCESS;
+}
+
+flexio_status_t FLEXIO_ConfigUartRx(FLEXIO_Type *base, const flexio_uart_config_t *config)
+{
+    if (!FLEXIO_IsValid(base) || config == NULL || config->shifter >= FLEXIO_SHIFTER_COUNT ||
+        config->timer >= FLEXIO_TIMER_COUNT || config->pin >= FLEXIO_PIN_COUNT) {
+        return FLEXIO_STATUS_INVALID_PARAM;
+    }
+
+    /* Sample on the timer's falling edge, i.e. mid-bit */
+    base->SHIFTCFG[config->shifter] = FLEXIO_SHIFTCFG_SSTART(FLEXIO_SHIFTCFG_START_ZERO) |
+                                      FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTCFG_STOP_ONE);
+    base->SHIFTCTL[config->shifter] = FLEXIO_SHIFTCTL_TIMSEL(config->timer) |
+                                      FLEXIO_SHIFTCTL_TIMPOL_MASK |
+                                      FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PINCFG_OUTPUT_DISABLED) |
+                                      FLEXIO_SHIFTCTL_PINSEL(config->pin) |
+                                      FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTCTL_SMOD_RECEIVE);
+
+    /* Pin inverted: "rising edge" is the start bit's falling edge */
+    base->TIMCMP[config->timer] = FLEXIO_TIMCMP_BAUD(8U, config->half_period);
+    base->TIMCFG[config->timer] = FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMCFG_TIMOUT_ONE_RESET) |
+                                  FLEXIO_TIMCFG_TIMRST(FLEXIO_TIMCFG_TIMRST_PIN_RISING) |
+                                  FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMCFG_TIMDIS_COMPARE) |
+                                  FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMCFG_TIMENA_PIN_RISING) |
+                                  FLEXIO_TIMCFG_TSTOP(FLEXIO_TIMCFG_TSTOP_ON_DISABLE) |
+                                  FLEXIO_TIMCFG_TSTART_MASK;
+    base->TIMCTL[config->timer] = FLEXIO_TIMCTL_PINCFG(FLEXIO_PINCFG_OUTPUT_DISABLED) |
+                                  FLEXIO_TIMCTL_PINSEL(config->pin) |
+                                  FLEXIO_TIMCTL_PINPOL_MASK |
+                                  FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMCTL_TIMOD_BAUD);
+
+    return FLEXIO_STATUS_SUCCESS;
+}
+
+flexio_status_t FLEXIO_ConfigSpiMaster(FLEXIO_Type *base, const flexio_spi_config_t *config)
+{
+    if (!FLEXIO_IsValid(base) || config == NULL ||
+        config->tx_shifter >= FLEXIO_SHIFTER_COUNT || config->rx_shifter >= FLEXIO_SHIFTER_COUNT ||
+        config->tx_shifter == config->rx_shifter || config->timer >= FLEXIO_TIMER_COUNT ||
+        config->mosi_pin >= FLEXIO_PIN_COUNT || config->miso_pin >= FLEXIO_PIN_COUNT ||
+        config->sck_pin >= FLEXIO_PIN_COUNT) {
+        return FLEXIO_STATUS_INVALID_PARAM;
+    }
+
+    /* Mode 0: MOSI changes on the falling SCK edge, MISO sampled on the rising one */
+    base->SHIFTCFG[config->tx_shifter] = FLEXIO_SHIFTCFG_SSTART(FLEXIO_SHIFTCFG_START_DISABLED) |
+                                         FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTCFG_STOP_DISABLED);
+    base->SHIFTCTL[config->tx_shifter] = FLEXIO_SHIFTCTL_TIMSEL(config->timer) |
+                                         FLEXIO_SHIFTCTL_TIMPOL_MASK |
+                                         FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PINCFG_OUTPUT) |
+                                         FLEXIO_SHIFTCTL_PINSEL(config->mosi_pin) |
+                                         FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTCTL_SMOD_TRANSMIT);
+
+    base->SHIFTCFG[config->rx_shifter] = FLEXIO_SHIFTCFG_SSTART(FLEXIO_SHIFTCFG_START_DISABLED) |
+                                         FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTCFG_STOP_DISABLED);
+    base->SHIFTCTL[config->rx_shifter] = FLEXIO_SHIFTCTL_TIMSEL(config->timer) |
+                                         FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PINCFG_OUTPUT_DISABLED) |
+                                         FLEXIO_SHIFTCTL_PINSEL(config->miso_pin) |
+                                         FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTCTL_SMOD_RECEIVE);
+
+    /* SCK: started by a TX buffer write, 8 clock cycles, idle low */
+    base->TIMCMP[config->timer] = FLEXIO_TIMCMP_BAUD(8U, config->half_period);
+    base->TIMCFG[config->timer] = FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMCFG_TIMOUT_ZERO) |
+                                  FLEXIO_TIMCFG_TIMRST(FLEXIO_TIMCFG_TIMRST_NEVER) |
+                                  FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMCFG_TIMDIS_COMPARE) |
+                                  FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMCFG_TIMENA_TRIGGER_HIGH) |
+                                  FLEXIO_TIMCFG_TSTOP(FLEXIO_TIMCFG_TSTOP_ON_DISABLE) |
+                                  FLEXIO_TIMCFG_TSTART_MASK;
+    base->TIMCTL[config->timer] = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TIMCTL_TRGSEL_SHIFTER(config->tx_shifter)) |
+                                  FLEXIO_TIMCTL_TRGPOL_MASK | FLEXIO_TIMCTL_TRGSRC_MASK |
+                                  FLEXIO_TIMCTL_PINCFG(FLEXIO_PINCFG_OUTPUT) |
+                                  FLEXIO_TIMCTL_PINSEL(config->sck_pin) |
+                                  FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMCTL_TIMOD_BAUD);
+
+    return FLEXIO_STATUS_SUCCESS;
+}
+
+void FLEXIO_DisableShifter(FLEXIO_Type *base, uint8_t shifter)
+{
+    if (!FLEXIO_IsValid(base) || shifter >= FLEXIO_SHIFTER_COUNT) {
+        return;
+    }
+
+    base->SHIFTSDEN &= ~(1UL << shifter);
+    base->SHIFTSIEN &= ~(1UL << shifter);
+    base->SHIFTEIEN &= ~(1UL << shifter);
+    base->SHIFTCTL[shifter] = 0U;
+    base->SHIFTCFG[shifter] = 0U;
+    base->SHIFTERR = 1UL << shifter;
+}
+
+void FLEXIO_DisableTimer(FLEXIO_Type *base, uint8_t timer)
+{
+    if (!FLEXIO_IsValid(base) || timer >= FLEXIO_TIMER_COUNT) {
+        return;
+    }
+
+    base->TIMIEN &= ~(1UL << timer);
+    base->TIMCTL[timer] = 0U;
+    base->TIMCFG[timer] = 0U;
+    base->TIMCMP[timer] = 0U;
+    base->TIMSTAT = 1UL << timer;
+}
+
+void FLEXIO_EnableShifterDma(FLEXIO_Type *base, uint8_t shifter, bool enable)
+{
+    if (!FLEXIO_IsValid(base) || shifter >= FLEXIO_SHIFTER_COUNT) {
+        return;
+    }
+
+    if (enable) {
+        base->SHIFTSDEN |= 1UL << shifter;
+    } else {
+        base->SHIFTSDEN &= ~(1UL << shifter);
+    }
+}
+
+void FLEXIO_EnableShifterInterrupt(FLEXIO_Type *base, uint8_t shifter, bool enable)
+{
+    if (!FLEXIO_IsValid(base) || shifter >= FLEXIO_SHIFTER_COUNT) {
+        return;
+    }
+
+    if (enable) {
+        base->SHIFTSIEN |= 1UL << shifter;
+    } else {
+        base->SHIFTSIEN &= ~(1UL << shifter);
+    }
+}
+
+void FLEXIO_EnableErrorInterrupt(FLEXIO_Type *base, uint8_t shifter, bool enable)
+{
+    if (!FLEXIO_IsValid(base) || shifter >= FLEXIO_SHIFTER_COUNT) {
+        return;
+    }
+
+    if (enable) {
+        base->SHIFTERR = 1UL << shifter;
+        base->SHIFTEIEN |= 1UL << shifter;
+    } else {
+        base->SHIFTEIEN &= ~(1UL << shifter);
+    }
+}
+
+flexio_status_t FLEXIO_RegisterCallback(FLEXIO_Type *base, flexio_callback_t callback, void *userData)
+{
+    if (!FLEXIO_IsValid(base)) {
+        return FLEXIO_STATUS_INVALID_PARAM;
+    }
+
+    s_flexio_callback = callback;
+    s_flexio_user_data = userData;
+
+    return FLEXIO_STATUS_SUCCESS;
+}
+
+void FLEXIO_ShifterIRQHandler(FLEXIO_Type *base)
+{
+    uint32_t status;
+    uint32_t errors;
+    uint32_t timers;
+
+    if (!FLEXIO_IsValid(base)) {
+        return;
+    }
+
+    status = base->SHIFTSTAT & base->SHIFTSIEN;
+    errors = base->SHIFTERR & base->SHIFTEIEN;
+    timers = base->TIMSTAT & base->TIMIEN;
+
+    base->SHIFTERR = errors;
+    base->TIMSTAT = timers;
+
+    if (s_flexio_callback != NULL && (status | errors | timers) != 0U) {
+        s_flexio_callback(base, status | (errors << 8) | (timers << 16), s_flexio_user_data);
+    }
+}
@@ -0,0 +1,287 @@
+/**
+ * @file    flexio.h
+ * @brief   FlexIO Driver API for S32K144
+ * @details Shifter and timer configuration for hardware-timed serial
+ *          protocols.
+ *
+ * Features:
+ * - UART transmitter and receiver (8N1), one shifter and one timer each
+ * - SPI master (mode 0, MSB first, 8-bit), two shifters and one timer;
+ *   chip select is left to a GPIO
+ * - Shifter status as DMA request or interrupt, shifter errors (RX
+ *   overrun, framing) as interrupt
+ *
+ * The caller picks the shifter, timer and FlexIO pin (D0-D7) numbers and
+ * the bit timing in FlexIO clocks; pin muxing is done with the PORT
+ * driver.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef FLEXIO_H
+#define FLEXIO_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "flexio_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Resources per instance */
+#define FLEXIO_SHIFTER_COUNT        (FLEXIO_SHIFTCTL_COUNT)
+#define FLEXIO_TIMER_COUNT          (FLEXIO_TIMCTL_COUNT)
+#define FLEXIO_PIN_COUNT            (8U)
+
+/** @brief Callback event flags */
+#define FLEXIO_EVENT_SHIFTER(n)         (1UL << (n))            /* Status flag, bits 0-3 */
+#define FLEXIO_EVENT_SHIFTER_ERROR(n)   (1UL << ((n) + 8U))     /* Error flag, bits 8-11 */
+#define FLEXIO_EVENT_TIMER(n)           (1UL << ((n) + 16U))    /* Timer flag, bits 16-19 */
+
+/**
+ * @brief FlexIO driver status codes
+ */
+typedef enum {
+    FLEXIO_STATUS_SUCCESS = 0,      /**< Operation successful */
+    FLEXIO_STATUS_ERROR,            /**< General error */
+    FLEXIO_STATUS_INVALID_PARAM     /**< Invalid parameter */
+} flexio_status_t;
+
+/**
+ * @brief UART transmitter or receiver
+ */
+typedef struct {
+    uint8_t shifter;                /**< Shifter (0-3) */
+    uint8_t timer;                  /**< Timer (0-3) */
+    uint8_t pin;                    /**< FlexIO pin (0-7) */
+    uint8_t half_period;            /**< Half bit time in FlexIO clocks - 1 */
+} flexio_uart_config_t;
+
+/**
+ * @brief SPI master
+ */
+typedef struct {
+    uint8_t tx_shifter;             /**< Shifter driving MOSI (0-3) */
+    uint8_t rx_shifter;             /**< Shifter sampling MISO (0-3) */
+    uint8_t timer;                  /**< SCK timer (0-3) */
+    uint8_t mosi_pin;               /**< FlexIO pins (0-7) */
+    uint8_t miso_pin;
+    uint8_t sck_pin;
+    uint8_t half_period;            /**< Half SCK period in FlexIO clocks - 1 */
+} flexio_spi_config_t;
+
+/**
+ * @brief FlexIO callback function type
+ * @param base FlexIO base
+ * @param flags FLEXIO_EVENT_xxx flags that fired
+ * @param userData User data
+ */
+typedef void (*flexio_callback_t)(FLEXIO_Type *base, uint32_t flags, void *userData);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Reset the module and enable it
+ * @details All shifters and timers are disabled. The functional clock
+ *          must be enabled (PCC) first.
+ * @param base FlexIO base
+ */
+void FLEXIO_Init(FLEXIO_Type *base);
+
+/**
+ * @brief Disable the module
+ * @param base FlexIO base
+ */
+void FLEXIO_Deinit(FLEXIO_Type *base);
+
+/**
+ * @brief Configure a UART transmitter
+ * @details The timer starts when the shifter buffer is written and
+ *          clocks out start bit, 8 data bits LSB first and stop bit.
+ * @param base FlexIO base
+ * @param config Transmitter configuration
+ * @return flexio_status_t Status of operation
+ */
+flexio_status_t FLEXIO_ConfigUartTx(FLEXIO_Type *base, const flexio_uart_config_t *config);
+
+/**
+ * @brief Configure a UART receiver
+ * @details The timer starts on the falling edge of the start bit and
+ *          samples in the middle of each bit. A stop bit that is not 1 or
+ *          an unread buffer sets the shifter error flag.
+ * @param base FlexIO base
+ * @param config Receiver configuration
+ * @return flexio_status_t Status of operation
+ */
+flexio_status_t FLEXIO_ConfigUartRx(FLEXIO_Type *base, const flexio_uart_config_t *config);
+
+/**
+ * @brief Configure an SPI master
+ * @details Each write to the TX shifter runs 8 SCK cycles; the received
+ *          byte is in the RX shifter when the transfer ends.
+ * @param base FlexIO base
+ * @param config SPI configuration
+ * @return flexio_status_t Status of operation
+ */
+flexio_status_t FLEXIO_ConfigSpiMaster(FLEXIO_Type *base, const flexio_spi_config_t *config);
+
+/**
+ * @brief Disable a shifter and its DMA request and interrupts
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ */
+void FLEXIO_DisableShifter(FLEXIO_Type *base, uint8_t shifter);
+
+/**
+ * @brief Disable a timer and its interrupt
+ * @param base FlexIO base
+ * @param timer Timer (0-3)
+ */
+void FLEXIO_DisableTimer(FLEXIO_Type *base, uint8_t timer);
+
+/**
+ * @brief Route the shifter status flag to DMA
+ * @details TX shifter: request while the buffer is empty. RX shifter:
+ *          request while the buffer holds data.
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @param enable true to enable
+ */
+void FLEXIO_EnableShifterDma(FLEXIO_Type *base, uint8_t shifter, bool enable);
+
+/**
+ * @brief Enable or disable the shifter status interrupt
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @param enable true to enable
+ */
+void FLEXIO_EnableShifterInterrupt(FLEXIO_Type *base, uint8_t shifter, bool enable);
+
+/**
+ * @brief Enable or disable the shifter error interrupt
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @param enable true to enable
+ */
+void FLEXIO_EnableErrorInterrupt(FLEXIO_Type *base, uint8_t shifter, bool enable);
+
+/**
+ * @brief Check the shifter status flag
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @return true if a TX buffer is empty or an RX buffer is full
+ */
+static inline bool FLEXIO_IsShifterReady(FLEXIO_Type *base, uint8_t shifter)
+{
+    return (base->SHIFTSTAT & (1UL << shifter)) != 0U;
+}
+
+/**
+ * @brief Check and clear the shifter error flag
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @return true if an error was pending
+ */
+static inline bool FLEXIO_ClearShifterError(FLEXIO_Type *base, uint8_t shifter)
+{
+    bool pending = (base->SHIFTERR & (1UL << shifter)) != 0U;
+
+    base->SHIFTERR = 1UL << shifter;
+    return pending;
+}
+
+/**
+ * @brief Write a byte, LSB first (UART)
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @param data Byte
+ */
+static inline void FLEXIO_WriteByte(FLEXIO_Type *base, uint8_t shifter, uint8_t data)
+{
+    base->SHIFTBUF[shifter] = data;
+}
+
+/**
+ * @brief Read a byte, LSB first (UART)
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @return uint8_t Byte, bits shifted in at the top of the buffer
+ */
+static inline uint8_t FLEXIO_ReadByte(FLEXIO_Type *base, uint8_t shifter)
+{
+    return (uint8_t)base->SHIFTBUFBYS[shifter];
+}
+
+/**
+ * @brief Write a byte, MSB first (SPI)
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @param data Byte
+ */
+static inline void FLEXIO_WriteByteMsb(FLEXIO_Type *base, uint8_t shifter, uint8_t data)
+{
+    base->SHIFTBUFBIS[shifter] = (uint32_t)data << 24;
+}
+
+/**
+ * @brief Read a byte, MSB first (SPI)
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @return uint8_t Byte
+ */
+static inline uint8_t FLEXIO_ReadByteMsb(FLEXIO_Type *base, uint8_t shifter)
+{
+    return (uint8_t)base->SHIFTBUFBIS[shifter];
+}
+
+/**
+ * @brief Byte address for DMA writes
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @param msb_first true: lands in the top byte of the bit-swapped buffer
+ * @return uint32_t Destination address for 1-byte transfers
+ */
+static inline uint32_t FLEXIO_GetTxAddress(FLEXIO_Type *base, uint8_t shifter, bool msb_first)
+{
+    return msb_first ? ((uint32_t)&base->SHIFTBUFBIS[shifter] + 3U) : (uint32_t)&base->SHIFTBUF[shifter];
+}
+
+/**
+ * @brief Byte address for DMA reads
+ * @param base FlexIO base
+ * @param shifter Shifter (0-3)
+ * @param msb_first true: bit-swapped buffer, false: byte-swapped buffer
+ * @return uint32_t Source address for 1-byte transfers
+ */
+static inline uint32_t FLEXIO_GetRxAddress(FLEXIO_Type *base, uint8_t shifter, bool msb_first)
+{
+    return msb_first ? (uint32_t)&base->SHIFTBUFBIS[shifter] : (uint32_t)&base->SHIFTBUFBYS[shifter];
+}
+
+/**
+ * @brief Register event callback
+ * @param base FlexIO base
+ * @param callback Callback, NULL to remove
+ * @param userData Passed to the callback
+ * @return flexio_status_t Status of registration
+ */
+flexio_status_t FLEXIO_RegisterCallback(FLEXIO_Type *base, flexio_callback_t callback, void *userData);
+
+/**
+ * @brief FlexIO interrupt handler - should be called from ISR
+ * @details Clears and reports error and timer flags with the interrupt
+ *          enabled. Status flags are reported only: they clear when the
+ *          buffer is accessed, so the callback must service them.
+ * @param base FlexIO base
+ */
+void FLEXIO_ShifterIRQHandler(FLEXIO_Type *base);
+
+#endif /* FLEXIO_H */
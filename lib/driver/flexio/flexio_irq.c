@@ -0,0 +1,21 @@
+/**
+ * @file    flexio_irq.c
+ * @brief   FlexIO Interrupt Service Routine Implementation
+ * @details Implements the FlexIO ISR and forwards to driver layer handler
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "flexio_irq.h"
+
+/*******************************************************************************
+ * ISR Implementation
+ ******************************************************************************/
+
+/* Forward to driver layer handler */
+void FLEXIO_IRQHandler(void) { FLEXIO_ShifterIRQHandler(FLEXIO); }
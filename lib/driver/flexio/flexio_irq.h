@@ -0,0 +1,37 @@
+/**
+ * @file    flexio_irq.h
+ * @brief   FlexIO Interrupt Handler Declarations
+ * @details Provides ISR declarations for FlexIO interrupts following CMSIS naming convention
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef FLEXIO_IRQ_H
+#define FLEXIO_IRQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "flexio.h"
+
+/*******************************************************************************
+ * ISR Declarations
+ ******************************************************************************/
+
+/**
+ * @brief FlexIO interrupt service routine (shifters and timers)
+ * @note This function should be defined in the startup vector table
+ */
+void FLEXIO_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLEXIO_IRQ_H */
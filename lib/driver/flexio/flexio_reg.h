@@ -0,0 +1,169 @@
+/*
+ * @file    flexio_reg.h
+ * @brief   FlexIO Register Definitions for S32K144
+ */
+
+#ifndef FLEXIO_REG_H_
+#define FLEXIO_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+/**
+*   IO Type Qualifiers are used
+*   \li to specify the access to peripheral variables.
+*   \li for automatic generation of peripheral register debug information.
+*/
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- FLEXIO Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/** FLEXIO - Size of Registers Arrays */
+#define FLEXIO_SHIFTCTL_COUNT                    4u
+#define FLEXIO_TIMCTL_COUNT                      4u
+
+/** FLEXIO - Register Layout Typedef */
+typedef struct {
+  __I  uint32_t VERID;                             /**< Version ID Register, offset: 0x0 */
+  __I  uint32_t PARAM;                             /**< Parameter Register, offset: 0x4 */
+  __IO uint32_t CTRL;                              /**< FlexIO Control Register, offset: 0x8 */
+  __I  uint32_t PIN;                               /**< Pin State Register, offset: 0xC */
+  __IO uint32_t SHIFTSTAT;                         /**< Shifter Status Register, offset: 0x10 */
+  __IO uint32_t SHIFTERR;                          /**< Shifter Error Register, offset: 0x14 */
+  __IO uint32_t TIMSTAT;                           /**< Timer Status Register, offset: 0x18 */
+  uint8_t RESERVED_0[4];
+  __IO uint32_t SHIFTSIEN;                         /**< Shifter Status Interrupt Enable, offset: 0x20 */
+  __IO uint32_t SHIFTEIEN;                         /**< Shifter Error Interrupt Enable, offset: 0x24 */
+  __IO uint32_t TIMIEN;                            /**< Timer Interrupt Enable Register, offset: 0x28 */
+  uint8_t RESERVED_1[4];
+  __IO uint32_t SHIFTSDEN;                         /**< Shifter Status DMA Enable, offset: 0x30 */
+  uint8_t RESERVED_2[76];
+  __IO uint32_t SHIFTCTL[FLEXIO_SHIFTCTL_COUNT];   /**< Shifter Control N Register, array offset: 0x80, array step: 0x4 */
+  uint8_t RESERVED_3[112];
+  __IO uint32_t SHIFTCFG[FLEXIO_SHIFTCTL_COUNT];   /**< Shifter Configuration N Register, array offset: 0x100, array step: 0x4 */
+  uint8_t RESERVED_4[240];
+  __IO uint32_t SHIFTBUF[FLEXIO_SHIFTCTL_COUNT];   /**< Shifter Buffer N Register, array offset: 0x200, array step: 0x4 */
+  uint8_t RESERVED_5[112];
+  __IO uint32_t SHIFTBUFBIS[FLEXIO_SHIFTCTL_COUNT]; /**< Shifter Buffer N Bit Swapped Register, array offset: 0x280, array step: 0x4 */
+  uint8_t RESERVED_6[112];
+  __IO uint32_t SHIFTBUFBYS[FLEXIO_SHIFTCTL_COUNT]; /**< Shifter Buffer N Byte Swapped Register, array offset: 0x300, array step: 0x4 */
+  uint8_t RESERVED_7[112];
+  __IO uint32_t SHIFTBUFBBS[FLEXIO_SHIFTCTL_COUNT]; /**< Shifter Buffer N Bit Byte Swapped Register, array offset: 0x380, array step: 0x4 */
+  uint8_t RESERVED_8[112];
+  __IO uint32_t TIMCTL[FLEXIO_TIMCTL_COUNT];       /**< Timer Control N Register, array offset: 0x400, array step: 0x4 */
+  uint8_t RESERVED_9[112];
+  __IO uint32_t TIMCFG[FLEXIO_TIMCTL_COUNT];       /**< Timer Configuration N Register, array offset: 0x480, array step: 0x4 */
+  uint8_t RESERVED_10[112];
+  __IO uint32_t TIMCMP[FLEXIO_TIMCTL_COUNT];       /**< Timer Compare N Register, array offset: 0x500, array step: 0x4 */
+} FLEXIO_Type, *FLEXIO_MemMapPtr;
+
+/** Number of instances of the FLEXIO module. */
+#define FLEXIO_INSTANCE_COUNT                    (1u)
+
+/* FLEXIO - Peripheral instance base addresses */
+#define FLEXIO_BASE                              (0x4005A000u)
+#define FLEXIO                                   ((FLEXIO_Type *)FLEXIO_BASE)
+
+/* ----------------------------------------------------------------------------
+   -- FLEXIO Register Masks
+   ---------------------------------------------------------------------------- */
+
+/* CTRL Bit Fields */
+#define FLEXIO_CTRL_FLEXEN_MASK                  0x1u
+#define FLEXIO_CTRL_SWRST_MASK                   0x2u
+#define FLEXIO_CTRL_FASTACC_MASK                 0x4u
+#define FLEXIO_CTRL_DBGE_MASK                    0x40000000u
+
+/* SHIFTSTAT / SHIFTERR / TIMSTAT / *IEN / SHIFTSDEN: one bit per shifter or timer (w1c for flags) */
+#define FLEXIO_FLAGS_MASK                        0xFu
+
+/* SHIFTCTL Bit Fields */
+#define FLEXIO_SHIFTCTL_SMOD_SHIFT               0u
+#define FLEXIO_SHIFTCTL_SMOD(x)                  (((uint32_t)(x) << FLEXIO_SHIFTCTL_SMOD_SHIFT) & 0x7u)
+#define FLEXIO_SHIFTCTL_PINPOL_MASK              0x80u
+#define FLEXIO_SHIFTCTL_PINSEL_SHIFT             8u
+#define FLEXIO_SHIFTCTL_PINSEL(x)                (((uint32_t)(x) << FLEXIO_SHIFTCTL_PINSEL_SHIFT) & 0x700u)
+#define FLEXIO_SHIFTCTL_PINCFG_SHIFT             16u
+#define FLEXIO_SHIFTCTL_PINCFG(x)                (((uint32_t)(x) << FLEXIO_SHIFTCTL_PINCFG_SHIFT) & 0x30000u)
+#define FLEXIO_SHIFTCTL_TIMPOL_MASK              0x800000u
+#define FLEXIO_SHIFTCTL_TIMSEL_SHIFT             24u
+#define FLEXIO_SHIFTCTL_TIMSEL(x)                (((uint32_t)(x) << FLEXIO_SHIFTCTL_TIMSEL_SHIFT) & 0x3000000u)
+
+/* SHIFTCTL[SMOD] values */
+#define FLEXIO_SHIFTCTL_SMOD_DISABLED            0u
+#define FLEXIO_SHIFTCTL_SMOD_RECEIVE             1u
+#define FLEXIO_SHIFTCTL_SMOD_TRANSMIT            2u
+
+/* SHIFTCTL/TIMCTL[PINCFG] values */
+#define FLEXIO_PINCFG_OUTPUT_DISABLED            0u
+#define FLEXIO_PINCFG_OUTPUT                     3u
+
+/* SHIFTCFG Bit Fields */
+#define FLEXIO_SHIFTCFG_SSTART_SHIFT             0u
+#define FLEXIO_SHIFTCFG_SSTART(x)                (((uint32_t)(x) << FLEXIO_SHIFTCFG_SSTART_SHIFT) & 0x3u)
+#define FLEXIO_SHIFTCFG_SSTOP_SHIFT              4u
+#define FLEXIO_SHIFTCFG_SSTOP(x)                 (((uint32_t)(x) << FLEXIO_SHIFTCFG_SSTOP_SHIFT) & 0x30u)
+#define FLEXIO_SHIFTCFG_INSRC_MASK               0x100u
+
+/* SHIFTCFG[SSTART]/[SSTOP] values */
+#define FLEXIO_SHIFTCFG_START_DISABLED           0u
+#define FLEXIO_SHIFTCFG_START_ZERO               2u
+#define FLEXIO_SHIFTCFG_STOP_DISABLED            0u
+#define FLEXIO_SHIFTCFG_STOP_ONE                 3u
+
+/* TIMCTL Bit Fields */
+#define FLEXIO_TIMCTL_TIMOD_SHIFT                0u
+#define FLEXIO_TIMCTL_TIMOD(x)                   (((uint32_t)(x) << FLEXIO_TIMCTL_TIMOD_SHIFT) & 0x3u)
+#define FLEXIO_TIMCTL_PINPOL_MASK                0x80u
+#define FLEXIO_TIMCTL_PINSEL_SHIFT               8u
+#define FLEXIO_TIMCTL_PINSEL(x)                  (((uint32_t)(x) << FLEXIO_TIMCTL_PINSEL_SHIFT) & 0x700u)
+#define FLEXIO_TIMCTL_PINCFG_SHIFT               16u
+#define FLEXIO_TIMCTL_PINCFG(x)                  (((uint32_t)(x) << FLEXIO_TIMCTL_PINCFG_SHIFT) & 0x30000u)
+#define FLEXIO_TIMCTL_TRGSRC_MASK                0x400000u
+#define FLEXIO_TIMCTL_TRGPOL_MASK                0x800000u
+#define FLEXIO_TIMCTL_TRGSEL_SHIFT               24u
+#define FLEXIO_TIMCTL_TRGSEL(x)                  (((uint32_t)(x) << FLEXIO_TIMCTL_TRGSEL_SHIFT) & 0xF000000u)
+
+/* TIMCTL[TIMOD] values */
+#define FLEXIO_TIMCTL_TIMOD_DISABLED             0u
+#define FLEXIO_TIMCTL_TIMOD_BAUD                 1u      /* Dual 8-bit counters baud/bit */
+
+/* TIMCTL[TRGSEL] internal trigger: shifter n status flag */
+#define FLEXIO_TIMCTL_TRGSEL_SHIFTER(n)          (((uint32_t)(n) * 4u) + 1u)
+
+/* TIMCFG Bit Fields */
+#define FLEXIO_TIMCFG_TSTART_MASK                0x2u
+#define FLEXIO_TIMCFG_TSTOP_SHIFT                4u
+#define FLEXIO_TIMCFG_TSTOP(x)                   (((uint32_t)(x) << FLEXIO_TIMCFG_TSTOP_SHIFT) & 0x30u)
+#define FLEXIO_TIMCFG_TIMENA_SHIFT               8u
+#define FLEXIO_TIMCFG_TIMENA(x)                  (((uint32_t)(x) << FLEXIO_TIMCFG_TIMENA_SHIFT) & 0x700u)
+#define FLEXIO_TIMCFG_TIMDIS_SHIFT               12u
+#define FLEXIO_TIMCFG_TIMDIS(x)                  (((uint32_t)(x) << FLEXIO_TIMCFG_TIMDIS_SHIFT) & 0x7000u)
+#define FLEXIO_TIMCFG_TIMRST_SHIFT               16u
+#define FLEXIO_TIMCFG_TIMRST(x)                  (((uint32_t)(x) << FLEXIO_TIMCFG_TIMRST_SHIFT) & 0x70000u)
+#define FLEXIO_TIMCFG_TIMDEC_SHIFT               20u
+#define FLEXIO_TIMCFG_TIMDEC(x)                  (((uint32_t)(x) << FLEXIO_TIMCFG_TIMDEC_SHIFT) & 0x300000u)
+#define FLEXIO_TIMCFG_TIMOUT_SHIFT               24u
+#define FLEXIO_TIMCFG_TIMOUT(x)                  (((uint32_t)(x) << FLEXIO_TIMCFG_TIMOUT_SHIFT) & 0x3000000u)
+
+/* TIMCFG field values */
+#define FLEXIO_TIMCFG_TSTOP_ON_DISABLE           2u
+#define FLEXIO_TIMCFG_TIMENA_TRIGGER_HIGH        2u
+#define FLEXIO_TIMCFG_TIMENA_PIN_RISING          4u
+#define FLEXIO_TIMCFG_TIMDIS_COMPARE             2u
+#define FLEXIO_TIMCFG_TIMRST_NEVER               0u
+#define FLEXIO_TIMCFG_TIMRST_PIN_RISING          4u
+#define FLEXIO_TIMCFG_TIMOUT_ONE                 0u
+#define FLEXIO_TIMCFG_TIMOUT_ZERO                1u
+#define FLEXIO_TIMCFG_TIMOUT_ONE_RESET           2u
+
+/* TIMCMP in baud/bit mode: [15:8] = 2 * bits - 1, [7:0] = half bit period - 1 */
+#define FLEXIO_TIMCMP_BAUD(bits, half)           ((((uint32_t)(bits) * 2u - 1u) << 8) | ((uint32_t)(half) & 0xFFu))
+
+#endif /* FLEXIO_REG_H_ */
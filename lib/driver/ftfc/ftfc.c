@@ -0,0 +1,199 @@
+/**
+ * @file    ftfc.c
+ * @brief   FTFC Flash Driver Implementation for S32K144
+ * @details Implementation of FTFC command sequences
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftfc.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/** @brief FSTAT error flags (write 1 to clear) */
+#define FTFC_FSTAT_ERROR_MASK   (FTFC_FSTAT_RDCOLERR_MASK | FTFC_FSTAT_ACCERR_MASK | \
+                                 FTFC_FSTAT_FPVIOL_MASK)
+
+/** @brief FCCOB address bit 23 selects the FlexNVM block */
+#define FTFC_FLEXNVM_ADDR_FLAG  (0x800000U)
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static bool FTFC_SetAddress(uint32_t address);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Load FCCOB1-3 with a flash address
+ * @return false if the address is in neither P-Flash nor D-Flash
+ */
+static bool FTFC_SetAddress(uint32_t address)
+{
+    uint32_t cmdAddr;
+
+    if (address < (FTFC_PFLASH_BASE + FTFC_PFLASH_SIZE)) {
+        cmdAddr = address;
+    } else if (address >= FTFC_DFLASH_BASE && address < (FTFC_DFLASH_BASE + FTFC_DFLASH_SIZE)) {
+        cmdAddr = (address - FTFC_DFLASH_BASE) | FTFC_FLEXNVM_ADDR_FLAG;
+    } else {
+        return false;
+    }
+
+    FTFC->FCCOB[FTFC_FCCOB_IDX(1U)] = (uint8_t)(cmdAddr >> 16);
+    FTFC->FCCOB[FTFC_FCCOB_IDX(2U)] = (uint8_t)(cmdAddr >> 8);
+    FTFC->FCCOB[FTFC_FCCOB_IDX(3U)] = (uint8_t)(cmdAddr);
+
+    return true;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+FTFC_RAM_FUNC ftfc_status_t FTFC_LaunchAndWait(void)
+{
+    uint8_t fstat;
+
+    /* Launch: writing 1 to CCIF starts the command */
+    FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+
+    /* Wait in RAM until the controller is idle again */
+    while ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U) {
+    }
+
+    fstat = FTFC->FSTAT;
+
+    if ((fstat & FTFC_FSTAT_ACCERR_MASK) != 0U) {
+        return FTFC_STATUS_ACCESS_ERROR;
+    }
+
+    if ((fstat & FTFC_FSTAT_FPVIOL_MASK) != 0U) {
+        return FTFC_STATUS_PROTECTION_ERROR;
+    }
+
+    if ((fstat & FTFC_FSTAT_MGSTAT0_MASK) != 0U) {
+        return FTFC_STATUS_ERROR;
+    }
+
+    return FTFC_STATUS_SUCCESS;
+}
+
+ftfc_status_t FTFC_EraseSector(uint32_t address)
+{
+    if (!FTFC_IsIdle()) {
+        return FTFC_STATUS_BUSY;
+    }
+
+    /* Clear stale error flags before loading FCCOB */
+    FTFC->FSTAT = FTFC_FSTAT_ERROR_MASK;
+
+    FTFC->FCCOB[FTFC_FCCOB_IDX(0U)] = FTFC_CMD_ERASE_SECTOR;
+    if (!FTFC_SetAddress(address)) {
+        return FTFC_STATUS_INVALID_PARAM;
+    }
+
+    return FTFC_LaunchAndWait();
+}
+
+ftfc_status_t FTFC_ProgramPhrase(uint32_t address, const uint8_t *data)
+{
+    if (data == NULL || (address & (FTFC_PHRASE_SIZE - 1U)) != 0U) {
+        return FTFC_STATUS_INVALID_PARAM;
+    }
+
+    if (!FTFC_IsIdle()) {
+        return FTFC_STATUS_BUSY;
+    }
+
+    FTFC->FSTAT = FTFC_FSTAT_ERROR_MASK;
+
+    FTFC->FCCOB[FTFC_FCCOB_IDX(0U)] = FTFC_CMD_PROGRAM_PHRASE;
+    if (!FTFC_SetAddress(address)) {
+        return FTFC_STATUS_INVALID_PARAM;
+    }
+
+    /* Data byte i (lowest address first) goes to FCCOB[4 + i] */
+    for (uint8_t i = 0; i < FTFC_PHRASE_SIZE; i++) {
+        FTFC->FCCOB[4U + i] = data[i];
+    }
+
+    return FTFC_LaunchAndWait();
+}
+
+ftfc_status_t FTFC_ProgramPartition(uint8_t csecKeySize, uint8_t eeeSize, uint8_t depart)
+{
+    if (!FTFC_IsIdle()) {
+        return FTFC_STATUS_BUSY;
+    }
+
+    FTFC->FSTAT = FTFC_FSTAT_ERROR_MASK;
+
+    FTFC->FCCOB[FTFC_FCCOB_IDX(0U)] = FTFC_CMD_PROGRAM_PARTITION;
+    FTFC->FCCOB[FTFC_FCCOB_IDX(1U)] = csecKeySize;
+    FTFC->FCCOB[FTFC_FCCOB_IDX(2U)] = 0x00U;   /* SFE: no security flag extension */
+    FTFC->FCCOB[FTFC_FCCOB_IDX(3U)] = 0x00U;   /* Load FlexRAM with EEE data at reset */
+    FTFC->FCCOB[FTFC_FCCOB_IDX(4U)] = eeeSize;
+    FTFC->FCCOB[FTFC_FCCOB_IDX(5U)] = depart;
+
+    return FTFC_LaunchAndWait();
+}
+
+ftfc_status_t FTFC_SetFlexRamFunction(ftfc_flexram_function_t function)
+{
+    ftfc_status_t status;
+
+    if (!FTFC_IsIdle()) {
+        return FTFC_STATUS_BUSY;
+    }
+
+    FTFC->FSTAT = FTFC_FSTAT_ERROR_MASK;
+
+    FTFC->FCCOB[FTFC_FCCOB_IDX(0U)] = FTFC_CMD_SET_FLEXRAM;
+    FTFC->FCCOB[FTFC_FCCOB_IDX(1U)] = (uint8_t)function;
+
+    status = FTFC_LaunchAndWait();
+    if (status != FTFC_STATUS_SUCCESS) {
+        return status;
+    }
+
+    if (function == FTFC_FLEXRAM_EEE) {
+        /* EEE data is copied into FlexRAM before EEERDY is set */
+        while (!FTFC_IsEeeReady()) {
+        }
+    }
+
+    return FTFC_STATUS_SUCCESS;
+}
+
+bool FTFC_IsPartitioned(void)
+{
+    uint32_t depart = (SIM_FCFG1 & SIM_FCFG1_DEPART_MASK) >> SIM_FCFG1_DEPART_SHIFT;
+
+    return depart != FTFC_DEPART_UNPARTITIONED;
+}
+
+ftfc_status_t FTFC_EeeWrite32(uint32_t offset, uint32_t value)
+{
+    if ((offset & 3U) != 0U || offset >= FTFC_FLEXRAM_SIZE) {
+        return FTFC_STATUS_INVALID_PARAM;
+    }
+
+    if (!FTFC_IsEeeReady()) {
+        return FTFC_STATUS_BUSY;
+    }
+
+    *(volatile uint32_t *)(FTFC_FLEXRAM_BASE + offset) = value;
+
+    return FTFC_STATUS_SUCCESS;
+}
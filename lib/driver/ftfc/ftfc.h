@@ -0,0 +1,170 @@
+/**
+ * @file    ftfc.h
+ * @brief   FTFC Flash Driver API for S32K144
+ * @details Command-level access to the Flash Memory Module:
+ *
+ * Features:
+ * - P-Flash / D-Flash sector erase and phrase programming
+ * - FlexNVM partitioning for EEPROM emulation (EEE)
+ * - FlexRAM function selection (EEE or traditional RAM)
+ * - Non-blocking EEE writes with EEERDY polling
+ *
+ * The command launch/wait routine is linked into .code_ram, so a P-Flash
+ * command can run while the CPU executes from RAM (the P-Flash block cannot
+ * be read while it is being programmed or erased).
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef FTFC_H
+#define FTFC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftfc_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Place a function in RAM (copied by startup from .code_ram) */
+#define FTFC_RAM_FUNC               __attribute__((section(".code_ram"), noinline))
+
+/** @brief FTFC command codes (FCCOB0) */
+#define FTFC_CMD_READ_1S_SECTION    (0x01U)
+#define FTFC_CMD_PROGRAM_CHECK      (0x02U)
+#define FTFC_CMD_PROGRAM_PHRASE     (0x07U)
+#define FTFC_CMD_ERASE_SECTOR       (0x09U)
+#define FTFC_CMD_PROGRAM_PARTITION  (0x80U)
+#define FTFC_CMD_SET_FLEXRAM        (0x81U)
+
+/** @brief Program Partition EEESIZE codes (FlexRAM used as EEE) */
+#define FTFC_EEE_SIZE_4KB           (0x02U)
+#define FTFC_EEE_SIZE_2KB           (0x03U)
+#define FTFC_EEE_SIZE_1KB           (0x04U)
+#define FTFC_EEE_SIZE_NONE          (0x0FU)
+
+/** @brief Program Partition DEPART codes (D-Flash / EEE backup split) */
+#define FTFC_DEPART_64K_DF_0K_EEE   (0x00U)
+#define FTFC_DEPART_32K_DF_32K_EEE  (0x03U)
+#define FTFC_DEPART_0K_DF_64K_EEE   (0x04U)
+
+/** @brief Program Partition CSEc key size codes */
+#define FTFC_CSEC_KEYS_NONE         (0x00U)
+#define FTFC_CSEC_KEYS_6            (0x01U)
+#define FTFC_CSEC_KEYS_12           (0x02U)
+#define FTFC_CSEC_KEYS_24           (0x03U)
+
+/** @brief SIM_FCFG1 DEPART value of a device that was never partitioned */
+#define FTFC_DEPART_UNPARTITIONED   (0x0FU)
+
+/**
+ * @brief FTFC driver status codes
+ */
+typedef enum {
+    FTFC_STATUS_SUCCESS = 0,        /**< Command completed */
+    FTFC_STATUS_ERROR,              /**< MGSTAT0 set (command failed) */
+    FTFC_STATUS_BUSY,               /**< Previous command / EEE write in progress */
+    FTFC_STATUS_ACCESS_ERROR,       /**< ACCERR set (bad address or sequence) */
+    FTFC_STATUS_PROTECTION_ERROR,   /**< FPVIOL set (protected region) */
+    FTFC_STATUS_INVALID_PARAM       /**< Invalid parameter */
+} ftfc_status_t;
+
+/**
+ * @brief FlexRAM function
+ */
+typedef enum {
+    FTFC_FLEXRAM_EEE = 0x00U,       /**< FlexRAM is emulated EEPROM */
+    FTFC_FLEXRAM_RAM = 0xFFU        /**< FlexRAM is traditional RAM */
+} ftfc_flexram_function_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Check whether the command controller is idle
+ * @return true if a new command can be launched
+ */
+static inline bool FTFC_IsIdle(void)
+{
+    return (FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) != 0U;
+}
+
+/**
+ * @brief Check whether the EEE state machine accepts a new write
+ * @return true if FlexRAM is in EEE mode and ready
+ */
+static inline bool FTFC_IsEeeReady(void)
+{
+    return (FTFC->FCNFG & FTFC_FCNFG_EEERDY_MASK) != 0U;
+}
+
+/**
+ * @brief Launch the command loaded in FCCOB and wait for completion
+ * @details Runs from RAM with the caller's interrupt state unchanged.
+ *          Interrupt handlers located in P-Flash must not run while a
+ *          P-Flash command is in progress, so callers programming P-Flash
+ *          disable interrupts around this call.
+ * @return ftfc_status_t Decoded FSTAT error flags
+ */
+ftfc_status_t FTFC_LaunchAndWait(void);
+
+/**
+ * @brief Erase one flash sector
+ * @param address Sector-aligned address (P-Flash or D-Flash)
+ * @return ftfc_status_t Status of operation
+ */
+ftfc_status_t FTFC_EraseSector(uint32_t address);
+
+/**
+ * @brief Program one phrase (8 bytes)
+ * @param address Phrase-aligned address (P-Flash or D-Flash)
+ * @param data 8 bytes to program
+ * @return ftfc_status_t Status of operation
+ */
+ftfc_status_t FTFC_ProgramPhrase(uint32_t address, const uint8_t *data);
+
+/**
+ * @brief Partition FlexNVM for EEPROM emulation
+ * @details One-time operation on a blank device. Erases all EEE data.
+ * @param csecKeySize FTFC_CSEC_KEYS_x
+ * @param eeeSize FTFC_EEE_SIZE_x
+ * @param depart FTFC_DEPART_x
+ * @return ftfc_status_t Status of operation
+ */
+ftfc_status_t FTFC_ProgramPartition(uint8_t csecKeySize, uint8_t eeeSize, uint8_t depart);
+
+/**
+ * @brief Select FlexRAM function
+ * @details In EEE mode, waits until the EEE state machine reports ready.
+ * @param function FTFC_FLEXRAM_EEE or FTFC_FLEXRAM_RAM
+ * @return ftfc_status_t Status of operation
+ */
+ftfc_status_t FTFC_SetFlexRamFunction(ftfc_flexram_function_t function);
+
+/**
+ * @brief Check whether FlexNVM has been partitioned for EEE
+ * @return true if SIM_FCFG1 reports a valid partition with EEE backup
+ */
+bool FTFC_IsPartitioned(void);
+
+/**
+ * @brief Write one 32-bit word to emulated EEPROM without waiting
+ * @details The write is accepted only when EEERDY is set. The EEE state
+ *          machine then copies it to the FlexNVM backup in the background.
+ * @param offset Word-aligned byte offset into FlexRAM
+ * @param value Value to write
+ * @return ftfc_status_t
+ *         - FTFC_STATUS_SUCCESS: Write accepted
+ *         - FTFC_STATUS_BUSY: Previous write still in progress
+ *         - FTFC_STATUS_INVALID_PARAM: Offset out of range or unaligned
+ */
+ftfc_status_t FTFC_EeeWrite32(uint32_t offset, uint32_t value);
+
+#endif /* FTFC_H */
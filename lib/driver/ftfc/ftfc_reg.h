@@ -0,0 +1,149 @@
+/*
+ * @file    ftfc_reg.h
+ * @brief   FTFC (Flash Memory Module) Register Definitions for S32K144
+ */
+
+#ifndef FTFC_REG_H_
+#define FTFC_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+/**
+*   IO Type Qualifiers are used
+*   \li to specify the access to peripheral variables.
+*   \li for automatic generation of peripheral register debug information.
+*/
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- FTFC Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup FTFC_Peripheral_Access_Layer FTFC Peripheral Access Layer
+ * @{
+ */
+
+/** FTFC - Size of Registers Arrays */
+#define FTFC_FCCOB_COUNT                          12u
+#define FTFC_FPROT_COUNT                          4u
+
+/** FTFC - Register Layout Typedef */
+typedef struct {
+  __IO uint8_t FSTAT;                              /**< Flash Status Register, offset: 0x0 */
+  __IO uint8_t FCNFG;                              /**< Flash Configuration Register, offset: 0x1 */
+  __I  uint8_t FSEC;                               /**< Flash Security Register, offset: 0x2 */
+  __I  uint8_t FOPT;                               /**< Flash Option Register, offset: 0x3 */
+  __IO uint8_t FCCOB[FTFC_FCCOB_COUNT];            /**< Flash Common Command Object Registers, array offset: 0x4, array step: 0x1 */
+  __IO uint8_t FPROT[FTFC_FPROT_COUNT];            /**< Program Flash Protection Registers, array offset: 0x10, array step: 0x1 */
+  uint8_t RESERVED_0[2];
+  __IO uint8_t FEPROT;                             /**< EEPROM Protection Register, offset: 0x16 */
+  __IO uint8_t FDPROT;                             /**< Data Flash Protection Register, offset: 0x17 */
+  uint8_t RESERVED_1[20];
+  __I  uint8_t FCSESTAT;                           /**< Flash CSEc Status Register, offset: 0x2C */
+  uint8_t RESERVED_2[1];
+  __IO uint8_t FERSTAT;                            /**< Flash Error Status Register, offset: 0x2E */
+  __IO uint8_t FERCNFG;                            /**< Flash Error Configuration Register, offset: 0x2F */
+} FTFC_Type, *FTFC_MemMapPtr;
+
+/** Number of instances of the FTFC module. */
+#define FTFC_INSTANCE_COUNT                      (1u)
+
+/* FTFC - Peripheral instance base addresses */
+/** Peripheral FTFC base address */
+#define FTFC_BASE                                (0x40020000u)
+/** Peripheral FTFC base pointer */
+#define FTFC                                     ((FTFC_Type *)FTFC_BASE)
+
+/**
+ * FCCOB register numbering used by the reference manual (FCCOB0..FCCOBB)
+ * mapped onto the FCCOB[] array, which stores each 32-bit group big-endian.
+ */
+#define FTFC_FCCOB_IDX(n)                        ((((n) & ~3u)) + 3u - ((n) & 3u))
+
+/* ----------------------------------------------------------------------------
+   -- FTFC Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup FTFC_Register_Masks FTFC Register Masks
+ * @{
+ */
+
+/*! @name FSTAT - Flash Status Register */
+/*! @{ */
+#define FTFC_FSTAT_MGSTAT0_MASK                  (0x1U)
+#define FTFC_FSTAT_MGSTAT0_SHIFT                 (0U)
+#define FTFC_FSTAT_FPVIOL_MASK                   (0x10U)
+#define FTFC_FSTAT_FPVIOL_SHIFT                  (4U)
+#define FTFC_FSTAT_ACCERR_MASK                   (0x20U)
+#define FTFC_FSTAT_ACCERR_SHIFT                  (5U)
+#define FTFC_FSTAT_RDCOLERR_MASK                 (0x40U)
+#define FTFC_FSTAT_RDCOLERR_SHIFT                (6U)
+#define FTFC_FSTAT_CCIF_MASK                     (0x80U)
+#define FTFC_FSTAT_CCIF_SHIFT                    (7U)
+/*! @} */
+
+/*! @name FCNFG - Flash Configuration Register */
+/*! @{ */
+#define FTFC_FCNFG_EEERDY_MASK                   (0x1U)
+#define FTFC_FCNFG_EEERDY_SHIFT                  (0U)
+#define FTFC_FCNFG_RAMRDY_MASK                   (0x2U)
+#define FTFC_FCNFG_RAMRDY_SHIFT                  (1U)
+#define FTFC_FCNFG_ERSSUSP_MASK                  (0x10U)
+#define FTFC_FCNFG_ERSSUSP_SHIFT                 (4U)
+#define FTFC_FCNFG_ERSAREQ_MASK                  (0x20U)
+#define FTFC_FCNFG_ERSAREQ_SHIFT                 (5U)
+#define FTFC_FCNFG_RDCOLLIE_MASK                 (0x40U)
+#define FTFC_FCNFG_RDCOLLIE_SHIFT                (6U)
+#define FTFC_FCNFG_CCIE_MASK                     (0x80U)
+#define FTFC_FCNFG_CCIE_SHIFT                    (7U)
+/*! @} */
+
+/*! @name FCSESTAT - Flash CSEc Status Register */
+/*! @{ */
+#define FTFC_FCSESTAT_BSY_MASK                   (0x1U)
+#define FTFC_FCSESTAT_BSY_SHIFT                  (0U)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group FTFC_Register_Masks */
+
+/*!
+ * @}
+ */ /* end of group FTFC_Peripheral_Access_Layer */
+
+/* ----------------------------------------------------------------------------
+   -- SIM FCFG1 (FlexNVM partition readback)
+   ---------------------------------------------------------------------------- */
+
+/** SIM Flash Configuration Register 1 address */
+#define SIM_FCFG1_ADDR                           (0x4004804Cu)
+#define SIM_FCFG1                                (*(__I uint32_t *)SIM_FCFG1_ADDR)
+
+#define SIM_FCFG1_DEPART_MASK                    (0xF000U)
+#define SIM_FCFG1_DEPART_SHIFT                   (12U)
+#define SIM_FCFG1_EEERAMSIZE_MASK                (0xF0000U)
+#define SIM_FCFG1_EEERAMSIZE_SHIFT               (16U)
+
+/* ----------------------------------------------------------------------------
+   -- Flash memory map
+   ---------------------------------------------------------------------------- */
+
+#define FTFC_PFLASH_BASE                         (0x00000000u)   /**< Program flash */
+#define FTFC_PFLASH_SIZE                         (0x00080000u)   /**< 512 KB */
+#define FTFC_PFLASH_SECTOR_SIZE                  (0x1000u)       /**< 4 KB */
+#define FTFC_DFLASH_BASE                         (0x10000000u)   /**< FlexNVM */
+#define FTFC_DFLASH_SIZE                         (0x00010000u)   /**< 64 KB */
+#define FTFC_DFLASH_SECTOR_SIZE                  (0x800u)        /**< 2 KB */
+#define FTFC_FLEXRAM_BASE                        (0x14000000u)   /**< FlexRAM / EEE */
+#define FTFC_FLEXRAM_SIZE                        (0x1000u)       /**< 4 KB */
+#define FTFC_PHRASE_SIZE                         (8u)            /**< Program unit */
+
+#endif /* FTFC_REG_H_ */
@@ -0,0 +1,262 @@
+/**
+ * @file    ftm.c
+ * @brief   FTM Driver Implementation for S32K144
+ * @details Counter, input capture and interrupt configuration
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftm.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static FTM_Type * const s_ftm_bases[FTM_INSTANCE_COUNT] = { FTM0, FTM1, FTM2, FTM3 };
+
+static ftm_clock_source_t s_ftm_clock[FTM_INSTANCE_COUNT] = { FTM_CLOCK_NONE };
+static ftm_callback_t s_ftm_callbacks[FTM_INSTANCE_COUNT] = { NULL };
+static void *s_ftm_user_data[FTM_INSTANCE_COUNT] = { NULL };
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+uint8_t FTM_GetInstance(FTM_Type *base)
+{
+    uint8_t i;
+
+    for (i = 0; i < FTM_INSTANCE_COUNT; i++) {
+        if (s_ftm_bases[i] == base) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+ftm_status_t FTM_Init(FTM_Type *base, const ftm_config_t *config)
+{
+    uint8_t instance = FTM_GetInstance(base);
+
+    if (instance >= FTM_INSTANCE_COUNT || config == NULL || config->prescaler > 7U) {
+        return FTM_STATUS_INVALID_PARAM;
+    }
+
+    base->SC = 0U;
+    base->MODE = FTM_MODE_WPDIS_MASK | FTM_MODE_FTMEN_MASK;
+
+    for (uint8_t ch = 0; ch < FTM_CONTROLS_COUNT; ch++) {
+        base->CONTROLS[ch].CnSC = 0U;
+    }
+    base->COMBINE = 0U;
+    base->FILTER = 0U;
+
+    base->CNTIN = 0U;
+    base->MOD = config->modulo;
+    base->CNT = 0U;                 /* Any write loads CNTIN */
+
+    /* Clock selected by FTM_Start() */
+    base->SC = FTM_SC_PS(config->prescaler);
+    s_ftm_clock[instance] = config->clock;
+
+    return FTM_STATUS_SUCCESS;
+}
+
+void FTM_Deinit(FTM_Type *base)
+{
+    uint8_t instance = FTM_GetInstance(base);
+
+    if (instance >= FTM_INSTANCE_COUNT) {
+        return;
+    }
+
+    base->SC = 0U;
+    for (uint8_t ch = 0; ch < FTM_CONTROLS_COUNT; ch++) {
+        base->CONTROLS[ch].CnSC = 0U;
+    }
+    base->COMBINE = 0U;
+    base->STATUS = 0U;
+
+    s_ftm_callbacks[instance] = NULL;
+}
+
+void FTM_Start(FTM_Type *base)
+{
+    uint8_t instance = FTM_GetInstance(base);
+
+    if (instance >= FTM_INSTANCE_COUNT) {
+        return;
+    }
+
+    base->SC = (base->SC & ~FTM_SC_CLKS_MASK) | FTM_SC_CLKS(s_ftm_clock[instance]);
+}
+
+void FTM_Stop(FTM_Type *base)
+{
+    base->SC &= ~FTM_SC_CLKS_MASK;
+}
+
+ftm_status_t FTM_ConfigInputCapture(FTM_Type *base, uint8_t channel, ftm_edge_t edge)
+{
+    uint32_t cnsc;
+
+    if (channel >= FTM_CONTROLS_COUNT) {
+        return FTM_STATUS_INVALID_PARAM;
+    }
+
+    /* Pair back to independent channels */
+    base->COMBINE &= ~((FTM_COMBINE_COMBINE_MASK | FTM_COMBINE_DECAPEN_MASK | FTM_COMBINE_DECAP_MASK)
+                       << FTM_COMBINE_PAIR_SHIFT(channel / 2U));
+
+    /* MSB:MSA = 00: input capture */
+    cnsc = base->CONTROLS[channel].CnSC & (FTM_CnSC_CHIE_MASK | FTM_CnSC_DMA_MASK);
+    base->CONTROLS[channel].CnSC = cnsc | FTM_CnSC_ELS(edge);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+ftm_status_t FTM_ConfigDualEdgeCapture(FTM_Type *base, uint8_t pair, ftm_edge_t first,
+                                       ftm_edge_t second, bool continuous)
+{
+    uint32_t shift = FTM_COMBINE_PAIR_SHIFT(pair);
+    uint8_t ch = (uint8_t)(2U * pair);
+    uint32_t keep;
+
+    if (pair >= FTM_PAIR_COUNT || first == FTM_EDGE_NONE || first == FTM_EDGE_BOTH ||
+        second == FTM_EDGE_NONE || second == FTM_EDGE_BOTH) {
+        return FTM_STATUS_INVALID_PARAM;
+    }
+
+    /* Disarm while reconfiguring */
+    base->COMBINE = (base->COMBINE & ~(FTM_COMBINE_PAIR_MASK << shift)) |
+                    (FTM_COMBINE_DECAPEN_MASK << shift);
+
+    keep = FTM_CnSC_CHIE_MASK | FTM_CnSC_DMA_MASK;
+    base->CONTROLS[ch].CnSC = (base->CONTROLS[ch].CnSC & keep) |
+                              FTM_CnSC_ELS(first) | (continuous ? FTM_CnSC_MSA_MASK : 0U);
+    base->CONTROLS[ch + 1U].CnSC = (base->CONTROLS[ch + 1U].CnSC & keep) | FTM_CnSC_ELS(second);
+
+    /* Drop stale captures, then arm */
+    base->STATUS = ~((3UL << ch) & FTM_STATUS_CHF_MASK);
+    base->COMBINE |= FTM_COMBINE_DECAP_MASK << shift;
+
+    return FTM_STATUS_SUCCESS;
+}
+
+void FTM_DisablePair(FTM_Type *base, uint8_t pair)
+{
+    uint8_t ch = (uint8_t)(2U * pair);
+
+    if (pair >= FTM_PAIR_COUNT) {
+        return;
+    }
+
+    base->COMBINE &= ~(FTM_COMBINE_PAIR_MASK << FTM_COMBINE_PAIR_SHIFT(pair));
+    base->CONTROLS[ch].CnSC = 0U;
+    base->CONTROLS[ch + 1U].CnSC = 0U;
+    base->STATUS = ~((3UL << ch) & FTM_STATUS_CHF_MASK);
+}
+
+ftm_status_t FTM_SetInputFilter(FTM_Type *base, uint8_t channel, uint8_t value)
+{
+    uint32_t shift = FTM_FILTER_CHFVAL_SHIFT(channel);
+
+    if (channel >= FTM_FILTER_CHANNEL_COUNT || value > FTM_FILTER_CHFVAL_MASK) {
+        return FTM_STATUS_INVALID_PARAM;
+    }
+
+    base->FILTER = (base->FILTER & ~(FTM_FILTER_CHFVAL_MASK << shift)) | ((uint32_t)value << shift);
+
+    return FTM_STATUS_SUCCESS;
+}
+
+void FTM_EnableChannelInterrupt(FTM_Type *base, uint8_t channel, bool enable)
+{
+    if (channel >= FTM_CONTROLS_COUNT) {
+        return;
+    }
+
+    if (enable) {
+        base->CONTROLS[channel].CnSC |= FTM_CnSC_CHIE_MASK;
+    } else {
+        base->CONTROLS[channel].CnSC &= ~FTM_CnSC_CHIE_MASK;
+    }
+}
+
+void FTM_EnableChannelDma(FTM_Type *base, uint8_t channel, bool enable)
+{
+    if (channel >= FTM_CONTROLS_COUNT) {
+        return;
+    }
+
+    /* The request is raised through the interrupt enable */
+    if (enable) {
+        base->CONTROLS[channel].CnSC |= FTM_CnSC_DMA_MASK | FTM_CnSC_CHIE_MASK;
+    } else {
+        base->CONTROLS[channel].CnSC &= ~(FTM_CnSC_DMA_MASK | FTM_CnSC_CHIE_MASK);
+    }
+}
+
+void FTM_EnableOverflowInterrupt(FTM_Type *base, bool enable)
+{
+    if (enable) {
+        base->SC &= ~FTM_SC_TOF_MASK;
+        base->SC |= FTM_SC_TOIE_MASK;
+    } else {
+        base->SC &= ~FTM_SC_TOIE_MASK;
+    }
+}
+
+ftm_status_t FTM_RegisterCallback(FTM_Type *base, ftm_callback_t callback, void *userData)
+{
+    uint8_t instance = FTM_GetInstance(base);
+
+    if (instance >= FTM_INSTANCE_COUNT) {
+        return FTM_STATUS_INVALID_PARAM;
+    }
+
+    s_ftm_callbacks[instance] = callback;
+    s_ftm_user_data[instance] = userData;
+
+    return FTM_STATUS_SUCCESS;
+}
+
+void FTM_IRQHandler(FTM_Type *base)
+{
+    uint8_t instance = FTM_GetInstance(base);
+    uint32_t enabled = 0U;
+    uint32_t flags;
+    uint32_t cnsc;
+
+    if (instance >= FTM_INSTANCE_COUNT) {
+        return;
+    }
+
+    for (uint8_t ch = 0; ch < FTM_CONTROLS_COUNT; ch++) {
+        cnsc = base->CONTROLS[ch].CnSC;
+        if ((cnsc & (FTM_CnSC_CHIE_MASK | FTM_CnSC_DMA_MASK)) == FTM_CnSC_CHIE_MASK) {
+            enabled |= FTM_EVENT_CHANNEL(ch);
+        }
+    }
+
+    /* Flags clear by writing 0 after the read; 1s leave the others alone */
+    flags = base->STATUS & enabled;
+    if (flags != 0U) {
+        base->STATUS = ~flags & FTM_STATUS_CHF_MASK;
+    }
+
+    if ((base->SC & (FTM_SC_TOIE_MASK | FTM_SC_TOF_MASK)) == (FTM_SC_TOIE_MASK | FTM_SC_TOF_MASK)) {
+        base->SC &= ~FTM_SC_TOF_MASK;
+        flags |= FTM_EVENT_OVERFLOW;
+    }
+
+    if (flags != 0U && s_ftm_callbacks[instance] != NULL) {
+        s_ftm_callbacks[instance](base, flags, s_ftm_user_data[instance]);
+    }
+}
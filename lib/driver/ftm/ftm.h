@@ -0,0 +1,255 @@
+/**
+ * @file    ftm.h
+ * @brief   FTM Driver API for S32K144
+ * @details FlexTimer counter and input capture configuration.
+ *
+ * Features:
+ * - Free-running 16-bit counter from the system, fixed or PCC clock
+ * - Single-edge input capture on any channel
+ * - Dual-edge capture on a channel pair: the input of channel 2n is
+ *   captured into C(2n)V on the first edge and C(2n+1)V on the second,
+ *   one-shot or continuously
+ * - Channel flags as interrupt or as DMA request (FTM1/FTM2 only have
+ *   per-channel DMA requests)
+ * - Counter overflow interrupt for software extension of the timebase
+ *
+ * Each FTM has one vector per channel pair and one for overflow; all of
+ * them are forwarded to FTM_IRQHandler().
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef FTM_H
+#define FTM_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftm_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Number of channel pairs */
+#define FTM_PAIR_COUNT              (FTM_CONTROLS_COUNT / 2U)
+
+/** @brief Callback event flags */
+#define FTM_EVENT_CHANNEL(ch)       (1UL << (ch))   /* Channel flag, bits 0-7 */
+#define FTM_EVENT_CHANNEL_MASK      (0xFFUL)
+#define FTM_EVENT_OVERFLOW          (1UL << 8)      /* Counter wrapped MOD -> CNTIN */
+
+/**
+ * @brief FTM driver status codes
+ */
+typedef enum {
+    FTM_STATUS_SUCCESS = 0,         /**< Operation successful */
+    FTM_STATUS_ERROR,               /**< General error */
+    FTM_STATUS_INVALID_PARAM        /**< Invalid parameter */
+} ftm_status_t;
+
+/**
+ * @brief Counter clock (SC[CLKS])
+ */
+typedef enum {
+    FTM_CLOCK_NONE = 0U,            /**< Counter stopped */
+    FTM_CLOCK_SYSTEM,               /**< System clock */
+    FTM_CLOCK_FIXED,                /**< Fixed frequency clock (RTC) */
+    FTM_CLOCK_EXTERNAL              /**< PCC functional clock */
+} ftm_clock_source_t;
+
+/**
+ * @brief Input capture edge (ELSB:ELSA)
+ */
+typedef enum {
+    FTM_EDGE_NONE = 0U,             /**< Capture disabled */
+    FTM_EDGE_RISING,
+    FTM_EDGE_FALLING,
+    FTM_EDGE_BOTH
+} ftm_edge_t;
+
+/**
+ * @brief Counter configuration
+ */
+typedef struct {
+    ftm_clock_source_t clock;       /**< Counter clock */
+    uint8_t prescaler;              /**< Clock divided by 2^prescaler (0-7) */
+    uint16_t modulo;                /**< Counter counts 0..modulo */
+} ftm_config_t;
+
+/**
+ * @brief Event callback
+ * @param instance FTM base
+ * @param flags FTM_EVENT_x
+ * @param userData Parameter given at registration
+ */
+typedef void (*ftm_callback_t)(FTM_Type *instance, uint32_t flags, void *userData);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Get instance index
+ * @param base FTM base
+ * @return uint8_t Index, FTM_INSTANCE_COUNT if unknown
+ */
+uint8_t FTM_GetInstance(FTM_Type *base);
+
+/**
+ * @brief Configure the counter and enable the extended FTM features
+ * @details Every channel disabled, counter stopped and cleared. The clock
+ *          must be enabled through the PCC.
+ * @param base FTM base
+ * @param config Configuration
+ * @return ftm_status_t Status of operation
+ */
+ftm_status_t FTM_Init(FTM_Type *base, const ftm_config_t *config);
+
+/**
+ * @brief Stop the counter and disable every channel and interrupt
+ * @param base FTM base
+ */
+void FTM_Deinit(FTM_Type *base);
+
+/**
+ * @brief Start the counter with the configured clock
+ * @param base FTM base
+ */
+void FTM_Start(FTM_Type *base);
+
+/**
+ * @brief Stop the counter
+ * @param base FTM base
+ */
+void FTM_Stop(FTM_Type *base);
+
+/**
+ * @brief Configure single-edge input capture
+ * @param base FTM base
+ * @param channel Channel (0-7)
+ * @param edge Edge to capture, FTM_EDGE_NONE disables the channel
+ * @return ftm_status_t Status of operation
+ */
+ftm_status_t FTM_ConfigInputCapture(FTM_Type *base, uint8_t channel, ftm_edge_t edge);
+
+/**
+ * @brief Configure dual-edge capture on a channel pair
+ * @details The input of channel 2*pair is measured. The first edge is
+ *          captured into C(2*pair)V, the second into C(2*pair+1)V. In
+ *          continuous mode the pair re-arms after every second edge.
+ * @param base FTM base
+ * @param pair Channel pair (0-3)
+ * @param first First edge (period start)
+ * @param second Second edge
+ * @param continuous Re-arm automatically
+ * @return ftm_status_t Status of operation
+ */
+ftm_status_t FTM_ConfigDualEdgeCapture(FTM_Type *base, uint8_t pair, ftm_edge_t first,
+                                       ftm_edge_t second, bool continuous);
+
+/**
+ * @brief Disable both channels of a pair and leave dual-edge mode
+ * @param base FTM base
+ * @param pair Channel pair (0-3)
+ */
+void FTM_DisablePair(FTM_Type *base, uint8_t pair);
+
+/**
+ * @brief Set the input filter of a channel
+ * @param base FTM base
+ * @param channel Channel (0-3, channels 4-7 have no filter)
+ * @param value Filter length in 4 system clocks (0 = off, 1-15)
+ * @return ftm_status_t Status of operation
+ */
+ftm_status_t FTM_SetInputFilter(FTM_Type *base, uint8_t channel, uint8_t value);
+
+/**
+ * @brief Enable or disable the channel flag interrupt
+ * @param base FTM base
+ * @param channel Channel (0-7)
+ * @param enable Interrupt on the channel flag
+ */
+void FTM_EnableChannelInterrupt(FTM_Type *base, uint8_t channel, bool enable);
+
+/**
+ * @brief Turn the channel flag into a DMA request
+ * @details The flag is cleared by the DMA transfer; no interrupt is
+ *          raised while DMA is selected.
+ * @param base FTM base
+ * @param channel Channel (0-7)
+ * @param enable DMA request instead of interrupt
+ */
+void FTM_EnableChannelDma(FTM_Type *base, uint8_t channel, bool enable);
+
+/**
+ * @brief Enable or disable the counter overflow interrupt
+ * @param base FTM base
+ * @param enable Interrupt on TOF
+ */
+void FTM_EnableOverflowInterrupt(FTM_Type *base, bool enable);
+
+/**
+ * @brief Read the counter
+ * @param base FTM base
+ * @return uint16_t Counter value
+ */
+static inline uint16_t FTM_GetCounter(FTM_Type *base)
+{
+    return (uint16_t)(base->CNT & FTM_CNT_COUNT_MASK);
+}
+
+/**
+ * @brief Check for an overflow not yet cleared
+ * @param base FTM base
+ * @return true if TOF is set
+ */
+static inline bool FTM_IsOverflowPending(FTM_Type *base)
+{
+    return (base->SC & FTM_SC_TOF_MASK) != 0U;
+}
+
+/**
+ * @brief Read a captured value
+ * @param base FTM base
+ * @param channel Channel (0-7)
+ * @return uint16_t C(n)V
+ */
+static inline uint16_t FTM_GetChannelValue(FTM_Type *base, uint8_t channel)
+{
+    return (uint16_t)(base->CONTROLS[channel].CnV & FTM_CnV_VAL_MASK);
+}
+
+/**
+ * @brief Address of C(n)V (DMA source)
+ * @param base FTM base
+ * @param channel Channel (0-7)
+ * @return uint32_t Register address
+ */
+static inline uint32_t FTM_GetChannelValueAddress(FTM_Type *base, uint8_t channel)
+{
+    return (uint32_t)&base->CONTROLS[channel].CnV;
+}
+
+/**
+ * @brief Register event callback
+ * @param base FTM base
+ * @param callback Callback, NULL to remove
+ * @param userData Passed to the callback
+ * @return ftm_status_t Status of registration
+ */
+ftm_status_t FTM_RegisterCallback(FTM_Type *base, ftm_callback_t callback, void *userData);
+
+/**
+ * @brief FTM interrupt handler - should be called from ISR
+ * @details Clears and reports the flags of channels with the interrupt
+ *          enabled (and DMA not selected) and the overflow flag.
+ * @param base FTM base
+ */
+void FTM_IRQHandler(FTM_Type *base);
+
+#endif /* FTM_H */
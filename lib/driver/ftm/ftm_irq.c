@@ -0,0 +1,43 @@
+/**
+ * @file    ftm_irq.c
+ * @brief   FTM Interrupt Service Routine Implementation
+ * @details Implements FTM ISRs and forwards to driver layer handler
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftm_irq.h"
+
+/*******************************************************************************
+ * ISR Implementation
+ ******************************************************************************/
+
+/* Forward to driver layer handler */
+void FTM0_Ch0_Ch1_IRQHandler(void) { FTM_IRQHandler(FTM0); }
+void FTM0_Ch2_Ch3_IRQHandler(void) { FTM_IRQHandler(FTM0); }
+void FTM0_Ch4_Ch5_IRQHandler(void) { FTM_IRQHandler(FTM0); }
+void FTM0_Ch6_Ch7_IRQHandler(void) { FTM_IRQHandler(FTM0); }
+void FTM0_Ovf_Reload_IRQHandler(void) { FTM_IRQHandler(FTM0); }
+
+void FTM1_Ch0_Ch1_IRQHandler(void) { FTM_IRQHandler(FTM1); }
+void FTM1_Ch2_Ch3_IRQHandler(void) { FTM_IRQHandler(FTM1); }
+void FTM1_Ch4_Ch5_IRQHandler(void) { FTM_IRQHandler(FTM1); }
+void FTM1_Ch6_Ch7_IRQHandler(void) { FTM_IRQHandler(FTM1); }
+void FTM1_Ovf_Reload_IRQHandler(void) { FTM_IRQHandler(FTM1); }
+
+void FTM2_Ch0_Ch1_IRQHandler(void) { FTM_IRQHandler(FTM2); }
+void FTM2_Ch2_Ch3_IRQHandler(void) { FTM_IRQHandler(FTM2); }
+void FTM2_Ch4_Ch5_IRQHandler(void) { FTM_IRQHandler(FTM2); }
+void FTM2_Ch6_Ch7_IRQHandler(void) { FTM_IRQHandler(FTM2); }
+void FTM2_Ovf_Reload_IRQHandler(void) { FTM_IRQHandler(FTM2); }
+
+void FTM3_Ch0_Ch1_IRQHandler(void) { FTM_IRQHandler(FTM3); }
+void FTM3_Ch2_Ch3_IRQHandler(void) { FTM_IRQHandler(FTM3); }
+void FTM3_Ch4_Ch5_IRQHandler(void) { FTM_IRQHandler(FTM3); }
+void FTM3_Ch6_Ch7_IRQHandler(void) { FTM_IRQHandler(FTM3); }
+void FTM3_Ovf_Reload_IRQHandler(void) { FTM_IRQHandler(FTM3); }
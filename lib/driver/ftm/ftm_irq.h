@@ -0,0 +1,59 @@
+/**
+ * @file    ftm_irq.h
+ * @brief   FTM Interrupt Handler Declarations
+ * @details Provides ISR declarations for FTM interrupts following CMSIS naming convention
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef FTM_IRQ_H
+#define FTM_IRQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftm.h"
+
+/*******************************************************************************
+ * ISR Declarations
+ ******************************************************************************/
+
+/**
+ * @brief FTM0-3 channel pair and overflow interrupt service routines
+ * @note These functions should be defined in the startup vector table
+ */
+void FTM0_Ch0_Ch1_IRQHandler(void);
+void FTM0_Ch2_Ch3_IRQHandler(void);
+void FTM0_Ch4_Ch5_IRQHandler(void);
+void FTM0_Ch6_Ch7_IRQHandler(void);
+void FTM0_Ovf_Reload_IRQHandler(void);
+
+void FTM1_Ch0_Ch1_IRQHandler(void);
+void FTM1_Ch2_Ch3_IRQHandler(void);
+void FTM1_Ch4_Ch5_IRQHandler(void);
+void FTM1_Ch6_Ch7_IRQHandler(void);
+void FTM1_Ovf_Reload_IRQHandler(void);
+
+void FTM2_Ch0_Ch1_IRQHandler(void);
+void FTM2_Ch2_Ch3_IRQHandler(void);
+void FTM2_Ch4_Ch5_IRQHandler(void);
+void FTM2_Ch6_Ch7_IRQHandler(void);
+void FTM2_Ovf_Reload_IRQHandler(void);
+
+void FTM3_Ch0_Ch1_IRQHandler(void);
+void FTM3_Ch2_Ch3_IRQHandler(void);
+void FTM3_Ch4_Ch5_IRQHandler(void);
+void FTM3_Ch6_Ch7_IRQHandler(void);
+void FTM3_Ovf_Reload_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FTM_IRQ_H */
@@ -0,0 +1,130 @@
+/*
+ * @file    ftm_reg.h
+ * @brief   FTM (FlexTimer Module) Register Definitions for S32K144
+ */
+
+#ifndef FTM_REG_H_
+#define FTM_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- FTM Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/** FTM - Size of Registers Arrays */
+#define FTM_CONTROLS_COUNT                        8u
+
+/** FTM - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t SC;                                /**< Status And Control, offset: 0x0 */
+  __IO uint32_t CNT;                               /**< Counter, offset: 0x4 */
+  __IO uint32_t MOD;                               /**< Modulo, offset: 0x8 */
+  struct {                                         /* offset: 0xC, array step: 0x8 */
+    __IO uint32_t CnSC;                              /**< Channel (n) Status And Control, array offset: 0xC, array step: 0x8 */
+    __IO uint32_t CnV;                               /**< Channel (n) Value, array offset: 0x10, array step: 0x8 */
+  } CONTROLS[FTM_CONTROLS_COUNT];
+  __IO uint32_t CNTIN;                             /**< Counter Initial Value, offset: 0x4C */
+  __IO uint32_t STATUS;                            /**< Capture And Compare Status, offset: 0x50 */
+  __IO uint32_t MODE;                              /**< Features Mode Selection, offset: 0x54 */
+  __IO uint32_t SYNC;                              /**< Synchronization, offset: 0x58 */
+  __IO uint32_t OUTINIT;                           /**< Initial State For Channels Output, offset: 0x5C */
+  __IO uint32_t OUTMASK;                           /**< Output Mask, offset: 0x60 */
+  __IO uint32_t COMBINE;                           /**< Function For Linked Channels, offset: 0x64 */
+  __IO uint32_t DEADTIME;                          /**< Deadtime Configuration, offset: 0x68 */
+  __IO uint32_t EXTTRIG;                           /**< FTM External Trigger, offset: 0x6C */
+  __IO uint32_t POL;                               /**< Channels Polarity, offset: 0x70 */
+  __IO uint32_t FMS;                               /**< Fault Mode Status, offset: 0x74 */
+  __IO uint32_t FILTER;                            /**< Input Capture Filter Control, offset: 0x78 */
+  __IO uint32_t FLTCTRL;                           /**< Fault Control, offset: 0x7C */
+  __IO uint32_t QDCTRL;                            /**< Quadrature Decoder Control And Status, offset: 0x80 */
+  __IO uint32_t CONF;                              /**< Configuration, offset: 0x84 */
+  __IO uint32_t FLTPOL;                            /**< FTM Fault Input Polarity, offset: 0x88 */
+  __IO uint32_t SYNCONF;                           /**< Synchronization Configuration, offset: 0x8C */
+  __IO uint32_t INVCTRL;                           /**< FTM Inverting Control, offset: 0x90 */
+  __IO uint32_t SWOCTRL;                           /**< FTM Software Output Control, offset: 0x94 */
+  __IO uint32_t PWMLOAD;                           /**< FTM PWM Load, offset: 0x98 */
+  __IO uint32_t HCR;                               /**< Half Cycle Register, offset: 0x9C */
+  __IO uint32_t PAIR0DEADTIME;                     /**< Pair 0 Deadtime Configuration, offset: 0xA0 */
+  uint8_t RESERVED_0[4];
+  __IO uint32_t PAIR1DEADTIME;                     /**< Pair 1 Deadtime Configuration, offset: 0xA8 */
+  uint8_t RESERVED_1[4];
+  __IO uint32_t PAIR2DEADTIME;                     /**< Pair 2 Deadtime Configuration, offset: 0xB0 */
+  uint8_t RESERVED_2[4];
+  __IO uint32_t PAIR3DEADTIME;                     /**< Pair 3 Deadtime Configuration, offset: 0xB8 */
+} FTM_Type, *FTM_MemMapPtr;
+
+/** Number of instances of the FTM module. */
+#define FTM_INSTANCE_COUNT                       (4u)
+
+/* FTM - Peripheral instance base addresses */
+#define FTM0_BASE                                (0x40038000u)
+#define FTM0                                     ((FTM_Type *)FTM0_BASE)
+#define FTM1_BASE                                (0x40039000u)
+#define FTM1                                     ((FTM_Type *)FTM1_BASE)
+#define FTM2_BASE                                (0x4003A000u)
+#define FTM2                                     ((FTM_Type *)FTM2_BASE)
+#define FTM3_BASE                                (0x40026000u)
+#define FTM3                                     ((FTM_Type *)FTM3_BASE)
+
+/* ----------------------------------------------------------------------------
+   -- FTM Register Masks
+   ---------------------------------------------------------------------------- */
+
+/* SC Bit Fields */
+#define FTM_SC_PS_MASK                           0x7u
+#define FTM_SC_PS_SHIFT                          0u
+#define FTM_SC_PS(x)                             (((uint32_t)(((uint32_t)(x))<<FTM_SC_PS_SHIFT))&FTM_SC_PS_MASK)
+#define FTM_SC_CLKS_MASK                         0x18u
+#define FTM_SC_CLKS_SHIFT                        3u
+#define FTM_SC_CLKS(x)                           (((uint32_t)(((uint32_t)(x))<<FTM_SC_CLKS_SHIFT))&FTM_SC_CLKS_MASK)
+#define FTM_SC_CPWMS_MASK                        0x20u
+#define FTM_SC_TOIE_MASK                         0x100u
+#define FTM_SC_TOF_MASK                          0x200u
+#define FTM_SC_PWMEN_MASK                        0xFF0000u
+
+/* CnSC Bit Fields */
+#define FTM_CnSC_DMA_MASK                        0x1u
+#define FTM_CnSC_ICRST_MASK                      0x2u
+#define FTM_CnSC_ELSA_MASK                       0x4u
+#define FTM_CnSC_ELSB_MASK                       0x8u
+#define FTM_CnSC_ELS_SHIFT                       2u
+#define FTM_CnSC_ELS(x)                          (((uint32_t)(((uint32_t)(x))<<FTM_CnSC_ELS_SHIFT))&(FTM_CnSC_ELSA_MASK|FTM_CnSC_ELSB_MASK))
+#define FTM_CnSC_MSA_MASK                        0x10u
+#define FTM_CnSC_MSB_MASK                        0x20u
+#define FTM_CnSC_CHIE_MASK                       0x40u
+#define FTM_CnSC_CHF_MASK                        0x80u
+#define FTM_CnSC_CHIS_MASK                       0x200u
+
+/* CnV / CNT / MOD / CNTIN Bit Fields */
+#define FTM_CNT_COUNT_MASK                       0xFFFFu
+#define FTM_CnV_VAL_MASK                         0xFFFFu
+
+/* STATUS Bit Fields (one flag per channel, write 0 to clear) */
+#define FTM_STATUS_CHF_MASK                      0xFFu
+
+/* MODE Bit Fields */
+#define FTM_MODE_FTMEN_MASK                      0x1u
+#define FTM_MODE_WPDIS_MASK                      0x4u
+
+/* COMBINE Bit Fields (one byte per channel pair) */
+#define FTM_COMBINE_PAIR_SHIFT(pair)             ((uint32_t)(pair) * 8u)
+#define FTM_COMBINE_COMBINE_MASK                 0x1u
+#define FTM_COMBINE_COMP_MASK                    0x2u
+#define FTM_COMBINE_DECAPEN_MASK                 0x4u
+#define FTM_COMBINE_DECAP_MASK                   0x8u
+#define FTM_COMBINE_PAIR_MASK                    0xFFu
+
+/* FILTER Bit Fields (channels 0-3 only) */
+#define FTM_FILTER_CHFVAL_MASK                   0xFu
+#define FTM_FILTER_CHFVAL_SHIFT(ch)              ((uint32_t)(ch) * 4u)
+#define FTM_FILTER_CHANNEL_COUNT                 4u
+
+#endif /* FTM_REG_H_ */
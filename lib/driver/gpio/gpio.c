@@ -4,7 +4,8 @@
  */
 
 #include "gpio.h"
-// #include <devassert.h>
+#include "devassert.h"
+#include <stddef.h>
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
@@ -21,14 +22,17 @@ gpio_status_t GPIO_Config(GPIO_Type *gpio, gpio_pin_t pin, gpio_direction_t dire
     return GPIO_STATUS_SUCCESS;
 }
 gpio_status_t GPIO_SetPin(GPIO_Type *gpio, gpio_pin_t pin) {
+    DEV_ASSERT(gpio != NULL && pin < 32U);
     gpio->PSOR |= (1U << pin);
     return GPIO_STATUS_SUCCESS;
 }
 gpio_status_t GPIO_ClearPin(GPIO_Type *gpio, gpio_pin_t pin) {
+    DEV_ASSERT(gpio != NULL && pin < 32U);
     gpio->PCOR |= (1U << pin);
     return GPIO_STATUS_SUCCESS;
 }
 gpio_status_t GPIO_TogglePin(GPIO_Type *gpio, gpio_pin_t pin) {
+    DEV_ASSERT(gpio != NULL && pin < 32U);
     gpio->PTOR |= (1U << pin);
     return GPIO_STATUS_SUCCESS;
 }
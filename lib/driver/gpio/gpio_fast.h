@@ -0,0 +1,115 @@
+/**
+ * @file    gpio_fast.h
+ * @brief   GPIO Port-Bound Fast Paths
+ * @details Single-store pin access with the port resolved at build time.
+ *          The GPIO blocks are 0x40 apart from PTA, so a constant port
+ *          number gives a constant base and no switch is executed
+ *          (GPIO_SRV_Write() looks the base up on every call).
+ *
+ *          - GPIO_FAST_DEFINE(prefix, port): prefix_FastSet(pin),
+ *            _FastClear, _FastToggle, _FastWrite(pin, value), _FastRead;
+ *            predefined for PTA-PTE
+ *          - GPIO_FAST_PIN(prefix, port, pin): prefix_Set(), _Clear(),
+ *            _Toggle(), _Write(value), _Read() for one pin, e.g. an LED
+ *
+ *          Set, clear and toggle are single writes to PSOR/PCOR/PTOR and
+ *          are interrupt safe without masking. No check is made: the pin
+ *          must be configured (PORT mux, direction) beforehand.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef GPIO_FAST_H
+#define GPIO_FAST_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "gpio.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Distance between two GPIO port blocks */
+#define GPIO_FAST_PORT_STRIDE       (0x40U)
+
+/** @brief Base of a port from its number (0 = PTA ... 4 = PTE) */
+#define GPIO_FAST_BASE(port)        ((GPIO_Type *)(PTA_BASE + ((uint32_t)(port) * GPIO_FAST_PORT_STRIDE)))
+
+/*******************************************************************************
+ * Instance Binding
+ ******************************************************************************/
+
+/**
+ * @brief Generate the fast paths of one port
+ * @param prefix Function name prefix
+ * @param port Port number (0-4)
+ */
+#define GPIO_FAST_DEFINE(prefix, port)                                                      \
+    static inline void prefix##_FastSet(uint32_t pin)                                       \
+    {                                                                                       \
+        GPIO_FAST_BASE(port)->PSOR = (1UL << pin);                                          \
+    }                                                                                       \
+    static inline void prefix##_FastClear(uint32_t pin)                                     \
+    {                                                                                       \
+        GPIO_FAST_BASE(port)->PCOR = (1UL << pin);                                          \
+    }                                                                                       \
+    static inline void prefix##_FastToggle(uint32_t pin)                                    \
+    {                                                                                       \
+        GPIO_FAST_BASE(port)->PTOR = (1UL << pin);                                          \
+    }                                                                                       \
+    static inline void prefix##_FastWrite(uint32_t pin, uint32_t value)                     \
+    {                                                                                       \
+        if (value != 0U) {                                                                  \
+            GPIO_FAST_BASE(port)->PSOR = (1UL << pin);                                      \
+        } else {                                                                            \
+            GPIO_FAST_BASE(port)->PCOR = (1UL << pin);                                      \
+        }                                                                                   \
+    }                                                                                       \
+    static inline uint32_t prefix##_FastRead(uint32_t pin)                                  \
+    {                                                                                       \
+        return (GPIO_FAST_BASE(port)->PDIR >> pin) & 1U;                                    \
+    }
+
+/**
+ * @brief Generate the fast paths of one pin
+ * @param prefix Function name prefix
+ * @param port Port number (0-4)
+ * @param pin Pin number (0-31)
+ */
+#define GPIO_FAST_PIN(prefix, port, pin)                                                    \
+    static inline void prefix##_Set(void)                                                   \
+    {                                                                                       \
+        GPIO_FAST_BASE(port)->PSOR = (1UL << (pin));                                        \
+    }                                                                                       \
+    static inline void prefix##_Clear(void)                                                 \
+    {                                                                                       \
+        GPIO_FAST_BASE(port)->PCOR = (1UL << (pin));                                        \
+    }                                                                                       \
+    static inline void prefix##_Toggle(void)                                                \
+    {                                                                                       \
+        GPIO_FAST_BASE(port)->PTOR = (1UL << (pin));                                        \
+    }                                                                                       \
+    static inline void prefix##_Write(uint32_t value)                                       \
+    {                                                                                       \
+        if (value != 0U) {                                                                  \
+            GPIO_FAST_BASE(port)->PSOR = (1UL << (pin));                                    \
+        } else {                                                                            \
+            GPIO_FAST_BASE(port)->PCOR = (1UL << (pin));                                    \
+        }                                                                                   \
+    }                                                                                       \
+    static inline uint32_t prefix##_Read(void)                                              \
+    {                                                                                       \
+        return (GPIO_FAST_BASE(port)->PDIR >> (pin)) & 1U;                                  \
+    }
+
+GPIO_FAST_DEFINE(PTA, 0U)
+GPIO_FAST_DEFINE(PTB, 1U)
+GPIO_FAST_DEFINE(PTC, 2U)
+GPIO_FAST_DEFINE(PTD, 3U)
+GPIO_FAST_DEFINE(PTE, 4U)
+
+#endif /* GPIO_FAST_H */
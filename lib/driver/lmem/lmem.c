@@ -0,0 +1,100 @@
+/**
+ * @file    lmem.c
+ * @brief   LMEM Code Cache Driver Implementation for S32K144
+ * @details Cache and line commands; each one is started with GO/LGO and
+ *          waited for, the hardware clears the bit when done.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lmem.h"
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/** @brief Line command: invalidate (PCCLCR[LCMD]) */
+#define LMEM_LCMD_INVALIDATE        (1U)
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Run a whole-cache command and wait for it
+ */
+static void LMEM_CacheCommand(uint32_t command)
+{
+    LMEM->PCCCR = (LMEM->PCCCR & LMEM_PCCCR_ENCACHE_MASK) | command | LMEM_PCCCR_GO_MASK;
+
+    while ((LMEM->PCCCR & LMEM_PCCCR_GO_MASK) != 0U) {
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void LMEM_Enable(void)
+{
+    LMEM_CacheCommand(LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+
+    LMEM->PCCCR = LMEM_PCCCR_ENCACHE_MASK;
+
+    /* Fetches already in the pipeline came from before the enable */
+    __asm volatile ("dsb" : : : "memory");
+    __asm volatile ("isb" : : : "memory");
+}
+
+void LMEM_Disable(void)
+{
+    LMEM_CacheCommand(LMEM_PCCCR_PUSHW0_MASK | LMEM_PCCCR_PUSHW1_MASK);
+
+    LMEM->PCCCR = 0U;
+
+    __asm volatile ("dsb" : : : "memory");
+    __asm volatile ("isb" : : : "memory");
+}
+
+void LMEM_InvalidateAll(void)
+{
+    LMEM_CacheCommand(LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+
+    __asm volatile ("isb" : : : "memory");
+}
+
+void LMEM_InvalidateLine(uint32_t address)
+{
+    LMEM->PCCLCR = LMEM_PCCLCR_LADSEL(1U) | LMEM_PCCLCR_LCMD(LMEM_LCMD_INVALIDATE);
+    LMEM->PCCSAR = (address & LMEM_PCCSAR_PHYADDR_MASK) | LMEM_PCCSAR_LGO_MASK;
+
+    while ((LMEM->PCCSAR & LMEM_PCCSAR_LGO_MASK) != 0U) {
+    }
+}
+
+void LMEM_SetRegionMode(uint8_t region, lmem_mode_t mode)
+{
+    if (region >= LMEM_REGION_COUNT) {
+        return;
+    }
+
+    LMEM->PCCRMR = (LMEM->PCCRMR & ~LMEM_PCCRMR_MASK(region)) | LMEM_PCCRMR_R(region, mode);
+}
+
+lmem_mode_t LMEM_GetRegionMode(uint8_t region)
+{
+    uint32_t mode;
+
+    if (region >= LMEM_REGION_COUNT) {
+        return LMEM_MODE_NON_CACHEABLE;
+    }
+
+    mode = (LMEM->PCCRMR & LMEM_PCCRMR_MASK(region)) >> LMEM_PCCRMR_SHIFT(region);
+
+    return (mode < (uint32_t)LMEM_MODE_WRITE_THROUGH) ? LMEM_MODE_NON_CACHEABLE : (lmem_mode_t)mode;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file    lmem.h
+ * @brief   LMEM Code Cache Driver API for S32K144
+ * @details Processor code bus cache (4 KB, 2 ways of 128 lines of 16 bytes).
+ *
+ * Features:
+ * - Enable / disable, whole-cache invalidate and push (PCCCR)
+ * - Line invalidate by physical address (PCCLCR/PCCSAR)
+ * - Cache mode per region (PCCRMR): 16 regions of the address map, of
+ *   which the code bus ones (0-3, below 0x20000000) are served by the
+ *   cache. SRAM_L accesses go to the LMEM RAM controller, never the cache.
+ *
+ * The cache only holds instruction and constant fetches of the core. Flash
+ * contents changed by the FTFC (program, erase, FlexRAM writes) or by
+ * another master are not seen until the lines are invalidated.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LMEM_H
+#define LMEM_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lmem_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Cache geometry */
+#define LMEM_LINE_SIZE              (16U)
+#define LMEM_WAY_COUNT              (2U)
+#define LMEM_SET_COUNT              (128U)
+#define LMEM_CACHE_SIZE             (LMEM_LINE_SIZE * LMEM_WAY_COUNT * LMEM_SET_COUNT)
+
+/** @brief Regions in PCCRMR */
+#define LMEM_REGION_COUNT           (16U)
+
+/**
+ * @brief Region cache mode (PCCRMR Rn encoding)
+ */
+typedef enum {
+    LMEM_MODE_NON_CACHEABLE = 0U,   /**< Bypass the cache */
+    LMEM_MODE_WRITE_THROUGH = 2U,   /**< Cached, writes go to memory (reset value of 0-3) */
+    LMEM_MODE_WRITE_BACK    = 3U    /**< Cached, writes held in the line */
+} lmem_mode_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Invalidate both ways and enable the cache
+ */
+void LMEM_Enable(void);
+
+/**
+ * @brief Push modified lines and disable the cache
+ */
+void LMEM_Disable(void);
+
+/**
+ * @brief Check whether the cache is enabled
+ * @return true if PCCCR[ENCACHE] is set
+ */
+static inline bool LMEM_IsEnabled(void)
+{
+    return (LMEM->PCCCR & LMEM_PCCCR_ENCACHE_MASK) != 0U;
+}
+
+/**
+ * @brief Invalidate every line, keeping the enable state
+ * @details Takes one pass over the 128 sets (a few hundred cycles).
+ */
+void LMEM_InvalidateAll(void);
+
+/**
+ * @brief Invalidate the line holding an address, if any
+ * @param address Physical address (any byte of the line)
+ */
+void LMEM_InvalidateLine(uint32_t address);
+
+/**
+ * @brief Set the cache mode of a region
+ * @details Takes effect on the next allocation; lines already cached
+ *          keep their data until invalidated.
+ * @param region Region index (0-15)
+ * @param mode Cache mode
+ */
+void LMEM_SetRegionMode(uint8_t region, lmem_mode_t mode);
+
+/**
+ * @brief Read the cache mode of a region
+ * @param region Region index (0-15)
+ * @return lmem_mode_t Cache mode (01 reads back as non-cacheable)
+ */
+lmem_mode_t LMEM_GetRegionMode(uint8_t region);
+
+#endif /* LMEM_H */
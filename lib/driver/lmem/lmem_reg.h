@@ -0,0 +1,111 @@
+/*
+ * @file    lmem_reg.h
+ * @brief   LMEM Register Definitions for S32K144
+ */
+
+#ifndef LMEM_REG_H_
+#define LMEM_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+/**
+*   IO Type Qualifiers are used
+*   \li to specify the access to peripheral variables.
+*   \li for automatic generation of peripheral register debug information.
+*/
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- LMEM Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup LMEM_Peripheral_Access_Layer LMEM Peripheral Access Layer
+ * @{
+ */
+
+/** LMEM - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t PCCCR;                             /**< Cache control register, offset: 0x0 */
+  __IO uint32_t PCCLCR;                            /**< Cache line control register, offset: 0x4 */
+  __IO uint32_t PCCSAR;                            /**< Cache search address register, offset: 0x8 */
+  __IO uint32_t PCCCVR;                            /**< Cache read/write value register, offset: 0xC */
+  uint8_t RESERVED_0[16];
+  __IO uint32_t PCCRMR;                            /**< Cache regions mode register, offset: 0x20 */
+} LMEM_Type, *LMEM_MemMapPtr;
+
+/** Number of instances of the LMEM module. */
+#define LMEM_INSTANCE_COUNT                      (1u)
+
+/* LMEM - Peripheral instance base addresses */
+/** Peripheral LMEM base address */
+#define LMEM_BASE                                (0xE0082000u)
+/** Peripheral LMEM base pointer */
+#define LMEM                                     ((LMEM_Type *)LMEM_BASE)
+
+/* ----------------------------------------------------------------------------
+   -- LMEM Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*! @name PCCCR - Cache control register */
+/*! @{ */
+#define LMEM_PCCCR_ENCACHE_MASK                  (0x1U)
+#define LMEM_PCCCR_ENCACHE_SHIFT                 (0U)
+#define LMEM_PCCCR_ENCACHE(x)                    (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_ENCACHE_SHIFT)) & LMEM_PCCCR_ENCACHE_MASK)
+#define LMEM_PCCCR_INVW0_MASK                    (0x1000000U)
+#define LMEM_PCCCR_INVW0_SHIFT                   (24U)
+#define LMEM_PCCCR_INVW0(x)                      (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_INVW0_SHIFT)) & LMEM_PCCCR_INVW0_MASK)
+#define LMEM_PCCCR_PUSHW0_MASK                   (0x2000000U)
+#define LMEM_PCCCR_PUSHW0_SHIFT                  (25U)
+#define LMEM_PCCCR_PUSHW0(x)                     (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_PUSHW0_SHIFT)) & LMEM_PCCCR_PUSHW0_MASK)
+#define LMEM_PCCCR_INVW1_MASK                    (0x4000000U)
+#define LMEM_PCCCR_INVW1_SHIFT                   (26U)
+#define LMEM_PCCCR_INVW1(x)                      (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_INVW1_SHIFT)) & LMEM_PCCCR_INVW1_MASK)
+#define LMEM_PCCCR_PUSHW1_MASK                   (0x8000000U)
+#define LMEM_PCCCR_PUSHW1_SHIFT                  (27U)
+#define LMEM_PCCCR_PUSHW1(x)                     (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_PUSHW1_SHIFT)) & LMEM_PCCCR_PUSHW1_MASK)
+#define LMEM_PCCCR_GO_MASK                       (0x80000000U)
+#define LMEM_PCCCR_GO_SHIFT                      (31U)
+#define LMEM_PCCCR_GO(x)                         (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_GO_SHIFT)) & LMEM_PCCCR_GO_MASK)
+/*! @} */
+
+/*! @name PCCLCR - Cache line control register */
+/*! @{ */
+#define LMEM_PCCLCR_LGO_MASK                     (0x1U)
+#define LMEM_PCCLCR_LGO_SHIFT                    (0U)
+#define LMEM_PCCLCR_LGO(x)                       (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LGO_SHIFT)) & LMEM_PCCLCR_LGO_MASK)
+#define LMEM_PCCLCR_LCMD_MASK                    (0x3000000U)
+#define LMEM_PCCLCR_LCMD_SHIFT                   (24U)
+#define LMEM_PCCLCR_LCMD(x)                      (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LCMD_SHIFT)) & LMEM_PCCLCR_LCMD_MASK)
+#define LMEM_PCCLCR_LADSEL_MASK                  (0x4000000U)
+#define LMEM_PCCLCR_LADSEL_SHIFT                 (26U)
+#define LMEM_PCCLCR_LADSEL(x)                    (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LADSEL_SHIFT)) & LMEM_PCCLCR_LADSEL_MASK)
+/*! @} */
+
+/*! @name PCCSAR - Cache search address register */
+/*! @{ */
+#define LMEM_PCCSAR_LGO_MASK                     (0x1U)
+#define LMEM_PCCSAR_LGO_SHIFT                    (0U)
+#define LMEM_PCCSAR_LGO(x)                       (((uint32_t)(((uint32_t)(x)) << LMEM_PCCSAR_LGO_SHIFT)) & LMEM_PCCSAR_LGO_MASK)
+#define LMEM_PCCSAR_PHYADDR_MASK                 (0xFFFFFFFCU)
+#define LMEM_PCCSAR_PHYADDR_SHIFT                (2U)
+/*! @} */
+
+/*! @name PCCRMR - Cache regions mode register */
+/*! @{ */
+/* Region n (0-15) occupies bits [31-2n:30-2n]: R0 is the most significant field */
+#define LMEM_PCCRMR_SHIFT(n)                     (30U - (2U * (uint32_t)(n)))
+#define LMEM_PCCRMR_MASK(n)                      (0x3UL << LMEM_PCCRMR_SHIFT(n))
+#define LMEM_PCCRMR_R(n, x)                      (((uint32_t)(x) << LMEM_PCCRMR_SHIFT(n)) & LMEM_PCCRMR_MASK(n))
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group LMEM_Peripheral_Access_Layer */
+
+#endif /* LMEM_REG_H_ */
@@ -0,0 +1,214 @@
+/**
+ * @file    lpi2c.c
+ * @brief   LPI2C Driver Implementation for S32K144 (master)
+ * @details Timing setup, FIFO/DMA control and interrupt dispatch
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpi2c.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static LPI2C_Type * const s_lpi2c_bases[LPI2C_INSTANCE_COUNT] = { LPI2C0 };
+
+static lpi2c_callback_t s_lpi2c_callbacks[LPI2C_INSTANCE_COUNT] = { NULL };
+static void *s_lpi2c_user_data[LPI2C_INSTANCE_COUNT] = { NULL };
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static uint8_t LPI2C_GetInstance(LPI2C_Type *base);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint8_t LPI2C_GetInstance(LPI2C_Type *base)
+{
+    uint8_t i;
+
+    for (i = 0; i < LPI2C_INSTANCE_COUNT; i++) {
+        if (s_lpi2c_bases[i] == base) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+lpi2c_status_t LPI2C_MasterInit(LPI2C_Type *base, const lpi2c_master_config_t *config,
+                                uint32_t srcClockHz)
+{
+    uint32_t prescale;
+    uint32_t period = 0;
+    uint32_t clklo;
+    uint32_t clkhi;
+    uint32_t ticks_per_us;
+    uint32_t value;
+
+    if (LPI2C_GetInstance(base) >= LPI2C_INSTANCE_COUNT || config == NULL ||
+        config->baudrate == 0U || srcClockHz == 0U) {
+        return LPI2C_STATUS_INVALID_PARAM;
+    }
+
+    /* SCL period = (CLKLO + CLKHI + 2) * 2^PRESCALE, both fields <= 63 */
+    for (prescale = 0; prescale < 8U; prescale++) {
+        period = ((srcClockHz >> prescale) + config->baudrate - 1U) / config->baudrate;
+        if (period <= 128U) {
+            break;
+        }
+    }
+
+    if (prescale == 8U || period < 8U) {
+        return LPI2C_STATUS_INVALID_PARAM;
+    }
+
+    /* Low phase slightly longer than high (tLOW > tHIGH in fast mode) */
+    clkhi = (period - 2U) / 2U;
+    clklo = (period - 2U) - clkhi;
+
+    base->MCR = LPI2C_MCR_RST_MASK;
+    base->MCR = 0U;
+
+    base->MCFGR1 = LPI2C_MCFGR1_PRESCALE(prescale);
+    base->MCCR0 = LPI2C_MCCR0_CLKLO(clklo) |
+                  LPI2C_MCCR0_CLKHI(clkhi) |
+                  LPI2C_MCCR0_SETHOLD(clkhi) |
+                  LPI2C_MCCR0_DATAVD(clkhi / 2U);
+
+    /* Timeouts count prescaled clocks; PINLOW in units of 256 */
+    ticks_per_us = (srcClockHz >> prescale) / 1000000U;
+    if (ticks_per_us == 0U) {
+        ticks_per_us = 1U;
+    }
+
+    value = LPI2C_MCFGR2_FILTSCL(config->glitch_filter) |
+            LPI2C_MCFGR2_FILTSDA(config->glitch_filter);
+    if (config->bus_idle_timeout_us != 0U) {
+        value |= LPI2C_MCFGR2_BUSIDLE(config->bus_idle_timeout_us * ticks_per_us);
+    }
+    base->MCFGR2 = value;
+
+    value = 0U;
+    if (config->pin_low_timeout_us != 0U) {
+        value = ((config->pin_low_timeout_us * ticks_per_us) + 255U) / 256U;
+    }
+    base->MCFGR3 = LPI2C_MCFGR3_PINLOW(value);
+
+    base->MFCR = LPI2C_MFCR_TXWATER(0U) | LPI2C_MFCR_RXWATER(0U);
+    base->MCR = LPI2C_MCR_MEN_MASK | LPI2C_MCR_DBGEN_MASK;
+
+    return LPI2C_STATUS_SUCCESS;
+}
+
+void LPI2C_MasterDeinit(LPI2C_Type *base)
+{
+    uint8_t inst = LPI2C_GetInstance(base);
+
+    if (inst >= LPI2C_INSTANCE_COUNT) {
+        return;
+    }
+
+    base->MIER = 0U;
+    base->MDER = 0U;
+    base->MCR = LPI2C_MCR_RST_MASK;
+    base->MCR = 0U;
+
+    s_lpi2c_callbacks[inst] = NULL;
+    s_lpi2c_user_data[inst] = NULL;
+}
+
+void LPI2C_MasterEnable(LPI2C_Type *base, bool enable)
+{
+    if (enable) {
+        base->MCR |= LPI2C_MCR_MEN_MASK;
+    } else {
+        base->MCR &= ~LPI2C_MCR_MEN_MASK;
+    }
+}
+
+void LPI2C_FlushFifo(LPI2C_Type *base, bool tx, bool rx)
+{
+    uint32_t mcr = base->MCR;
+
+    if (tx) {
+        mcr |= LPI2C_MCR_RTF_MASK;
+    }
+    if (rx) {
+        mcr |= LPI2C_MCR_RRF_MASK;
+    }
+
+    base->MCR = mcr;
+}
+
+void LPI2C_SetFifoWatermarks(LPI2C_Type *base, uint8_t txWater, uint8_t rxWater)
+{
+    base->MFCR = LPI2C_MFCR_TXWATER(txWater) | LPI2C_MFCR_RXWATER(rxWater);
+}
+
+void LPI2C_EnableDma(LPI2C_Type *base, uint32_t mask)
+{
+    base->MDER |= mask;
+}
+
+void LPI2C_DisableDma(LPI2C_Type *base, uint32_t mask)
+{
+    base->MDER &= ~mask;
+}
+
+void LPI2C_EnableInterrupts(LPI2C_Type *base, uint32_t mask)
+{
+    base->MIER |= mask;
+}
+
+void LPI2C_DisableInterrupts(LPI2C_Type *base, uint32_t mask)
+{
+    base->MIER &= ~mask;
+}
+
+lpi2c_status_t LPI2C_RegisterCallback(LPI2C_Type *base, lpi2c_callback_t callback, void *userData)
+{
+    uint8_t inst = LPI2C_GetInstance(base);
+
+    if (inst >= LPI2C_INSTANCE_COUNT) {
+        return LPI2C_STATUS_INVALID_PARAM;
+    }
+
+    s_lpi2c_user_data[inst] = userData;
+    s_lpi2c_callbacks[inst] = callback;
+
+    return LPI2C_STATUS_SUCCESS;
+}
+
+void LPI2C_MasterIRQHandler(LPI2C_Type *base)
+{
+    uint8_t inst = LPI2C_GetInstance(base);
+    uint32_t flags;
+
+    if (inst >= LPI2C_INSTANCE_COUNT) {
+        return;
+    }
+
+    /* Error flags are left set: the callback decides how to recover and
+       the master stays halted until NDF/ALF/FEF/PLTF are cleared */
+    flags = base->MSR & base->MIER;
+    base->MSR = flags & (LPI2C_MSR_W1C_FLAGS & ~LPI2C_MSR_ERROR_FLAGS);
+
+    if (s_lpi2c_callbacks[inst] != NULL) {
+        s_lpi2c_callbacks[inst](base, flags, s_lpi2c_user_data[inst]);
+    } else {
+        base->MSR = flags & LPI2C_MSR_ERROR_FLAGS;
+    }
+}
@@ -0,0 +1,242 @@
+/**
+ * @file    lpi2c.h
+ * @brief   LPI2C Driver API for S32K144 (master)
+ * @details The LPI2C master executes a stream of commands from its
+ *          command/transmit FIFO (START + address, transmit, receive,
+ *          STOP). A whole transaction can therefore be queued as an array
+ *          of command words and fed by DMA, with received bytes drained
+ *          from the receive FIFO the same way.
+ *
+ * Features:
+ * - SCL timing from the functional clock (PRESCALE / CLKLO / CLKHI)
+ * - Command word helpers (LPI2C_CMD_WORD)
+ * - FIFO watermarks, DMA requests, interrupt dispatch
+ * - Pin low timeout and bus idle detection for stuck buses
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LPI2C_H
+#define LPI2C_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpi2c_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief LPI2C driver status codes
+ */
+typedef enum {
+    LPI2C_STATUS_SUCCESS = 0,       /**< Operation successful */
+    LPI2C_STATUS_ERROR,             /**< General error */
+    LPI2C_STATUS_BUSY,              /**< Bus or module busy */
+    LPI2C_STATUS_INVALID_PARAM      /**< Invalid parameter */
+} lpi2c_status_t;
+
+/**
+ * @brief Master commands (MTDR CMD field)
+ */
+typedef enum {
+    LPI2C_CMD_TRANSMIT      = 0U,   /**< Transmit DATA */
+    LPI2C_CMD_RECEIVE       = 1U,   /**< Receive DATA + 1 bytes */
+    LPI2C_CMD_STOP          = 2U,   /**< Generate STOP */
+    LPI2C_CMD_RECEIVE_DISCARD = 3U, /**< Receive and discard DATA + 1 bytes */
+    LPI2C_CMD_START         = 4U,   /**< (Repeated) START and transmit address DATA */
+    LPI2C_CMD_START_NACK    = 5U    /**< START, address expecting NACK */
+} lpi2c_cmd_t;
+
+/** @brief Build a command word */
+#define LPI2C_CMD_WORD(cmd, data)   ((((uint32_t)(cmd)) << LPI2C_MTDR_CMD_SHIFT) | ((uint32_t)(data) & 0xFFU))
+
+/** @brief Address byte for a 7-bit address */
+#define LPI2C_ADDR_WRITE(addr)      ((uint8_t)((addr) << 1))
+#define LPI2C_ADDR_READ(addr)       ((uint8_t)(((addr) << 1) | 1U))
+
+/** @brief Largest byte count of one receive command */
+#define LPI2C_MAX_RECEIVE           (256U)
+
+/**
+ * @brief Master configuration
+ */
+typedef struct {
+    uint32_t baudrate;              /**< SCL in Hz (100000, 400000, ...) */
+    uint8_t glitch_filter;          /**< SCL/SDA glitch filter in functional clocks (0-15) */
+    uint32_t pin_low_timeout_us;    /**< Flag PLTF when a pin stays low this long, 0 = off */
+    uint32_t bus_idle_timeout_us;   /**< Treat the bus as idle after this long high, 0 = off */
+} lpi2c_master_config_t;
+
+/**
+ * @brief Callback (interrupt context)
+ * @param instance LPI2C base address
+ * @param flags MSR flags that caused the interrupt (LPI2C_MSR_xxx_MASK)
+ * @param userData Parameter given at registration
+ */
+typedef void (*lpi2c_callback_t)(LPI2C_Type *instance, uint32_t flags, void *userData);
+
+/*******************************************************************************
+ * Inline Functions
+ ******************************************************************************/
+
+/**
+ * @brief Push one command word
+ */
+static inline void LPI2C_WriteCommand(LPI2C_Type *base, uint32_t command)
+{
+    base->MTDR = command;
+}
+
+/**
+ * @brief Pop one received byte
+ */
+static inline uint8_t LPI2C_ReadData(LPI2C_Type *base)
+{
+    return (uint8_t)(base->MRDR & LPI2C_MRDR_DATA_MASK);
+}
+
+/**
+ * @brief Command words waiting in the transmit FIFO
+ */
+static inline uint32_t LPI2C_GetTxFifoCount(LPI2C_Type *base)
+{
+    return (base->MFSR & LPI2C_MFSR_TXCOUNT_MASK) >> LPI2C_MFSR_TXCOUNT_SHIFT;
+}
+
+/**
+ * @brief Bytes waiting in the receive FIFO
+ */
+static inline uint32_t LPI2C_GetRxFifoCount(LPI2C_Type *base)
+{
+    return (base->MFSR & LPI2C_MFSR_RXCOUNT_MASK) >> LPI2C_MFSR_RXCOUNT_SHIFT;
+}
+
+/**
+ * @brief Read status flags
+ */
+static inline uint32_t LPI2C_GetStatusFlags(LPI2C_Type *base)
+{
+    return base->MSR;
+}
+
+/**
+ * @brief Clear write-1-to-clear status flags
+ */
+static inline void LPI2C_ClearStatusFlags(LPI2C_Type *base, uint32_t flags)
+{
+    base->MSR = flags & LPI2C_MSR_W1C_FLAGS;
+}
+
+/**
+ * @brief MTDR address (DMA destination)
+ */
+static inline uint32_t LPI2C_GetTxDataAddress(LPI2C_Type *base)
+{
+    return (uint32_t)&base->MTDR;
+}
+
+/**
+ * @brief MRDR address (DMA source)
+ */
+static inline uint32_t LPI2C_GetRxDataAddress(LPI2C_Type *base)
+{
+    return (uint32_t)&base->MRDR;
+}
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the master
+ * @details Resets the module, programs SCL timing, filters and timeouts,
+ *          FIFO watermarks 0, then enables the master. The PCC clock must
+ *          be enabled by the caller.
+ * @param base LPI2C base address
+ * @param config Master configuration
+ * @param srcClockHz Functional clock in Hz
+ * @return lpi2c_status_t LPI2C_STATUS_INVALID_PARAM if the rate cannot be reached
+ */
+lpi2c_status_t LPI2C_MasterInit(LPI2C_Type *base, const lpi2c_master_config_t *config,
+                                uint32_t srcClockHz);
+
+/**
+ * @brief Disable the master and drop its callback
+ * @param base LPI2C base address
+ */
+void LPI2C_MasterDeinit(LPI2C_Type *base);
+
+/**
+ * @brief Enable or disable the master
+ * @param base LPI2C base address
+ * @param enable true to enable
+ */
+void LPI2C_MasterEnable(LPI2C_Type *base, bool enable);
+
+/**
+ * @brief Flush FIFOs
+ * @param base LPI2C base address
+ * @param tx Flush the command FIFO
+ * @param rx Flush the receive FIFO
+ */
+void LPI2C_FlushFifo(LPI2C_Type *base, bool tx, bool rx);
+
+/**
+ * @brief Set FIFO watermarks
+ * @param base LPI2C base address
+ * @param txWater TDF while TXCOUNT <= txWater (0-3)
+ * @param rxWater RDF while RXCOUNT > rxWater (0-3)
+ */
+void LPI2C_SetFifoWatermarks(LPI2C_Type *base, uint8_t txWater, uint8_t rxWater);
+
+/**
+ * @brief Enable DMA requests
+ * @param base LPI2C base address
+ * @param mask LPI2C_MDER_TDDE_MASK | LPI2C_MDER_RDDE_MASK
+ */
+void LPI2C_EnableDma(LPI2C_Type *base, uint32_t mask);
+
+/**
+ * @brief Disable DMA requests
+ * @param base LPI2C base address
+ * @param mask LPI2C_MDER_TDDE_MASK | LPI2C_MDER_RDDE_MASK
+ */
+void LPI2C_DisableDma(LPI2C_Type *base, uint32_t mask);
+
+/**
+ * @brief Enable interrupts
+ * @param base LPI2C base address
+ * @param mask LPI2C_MIER_xxx_MASK
+ */
+void LPI2C_EnableInterrupts(LPI2C_Type *base, uint32_t mask);
+
+/**
+ * @brief Disable interrupts
+ * @param base LPI2C base address
+ * @param mask LPI2C_MIER_xxx_MASK
+ */
+void LPI2C_DisableInterrupts(LPI2C_Type *base, uint32_t mask);
+
+/**
+ * @brief Register callback
+ * @param base LPI2C base address
+ * @param callback Callback, NULL to remove
+ * @param userData Passed back to the callback
+ * @return lpi2c_status_t Status of operation
+ */
+lpi2c_status_t LPI2C_RegisterCallback(LPI2C_Type *base, lpi2c_callback_t callback, void *userData);
+
+/**
+ * @brief Master interrupt handler (called from lpi2c_irq.c)
+ * @param base LPI2C base address
+ */
+void LPI2C_MasterIRQHandler(LPI2C_Type *base);
+
+#endif /* LPI2C_H */
@@ -0,0 +1,21 @@
+/**
+ * @file    lpi2c_irq.c
+ * @brief   LPI2C Interrupt Service Routine Implementation
+ * @details Implements LPI2C ISRs and forwards to driver layer handler
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpi2c_irq.h"
+
+/*******************************************************************************
+ * ISR Implementation
+ ******************************************************************************/
+
+/* Master interrupt - forward to driver layer handler */
+void LPI2C0_Master_IRQHandler(void) { LPI2C_MasterIRQHandler(LPI2C0); }
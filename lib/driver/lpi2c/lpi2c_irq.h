@@ -0,0 +1,37 @@
+/**
+ * @file    lpi2c_irq.h
+ * @brief   LPI2C Interrupt Handler Declarations
+ * @details Provides ISR declarations for LPI2C interrupts following CMSIS naming convention
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LPI2C_IRQ_H
+#define LPI2C_IRQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpi2c.h"
+
+/*******************************************************************************
+ * ISR Declarations
+ ******************************************************************************/
+
+/**
+ * @brief LPI2C0 master interrupt service routine
+ * @note This function should be defined in the startup vector table
+ */
+void LPI2C0_Master_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPI2C_IRQ_H */
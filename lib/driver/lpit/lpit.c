@@ -84,8 +84,8 @@ void LPIT0_EnableInterrupt(lpit_channel_t channel)
  */
 void LPIT0_StopTimer(lpit_channel_t channel)
 {
-	/* Enable interrupt for the selected channel */
-	CLEAR_BIT(LPIT0->CLRTEN, channel);
+	/* CLRTEN reads as 0: write the channel bit, a read-modify-write writes 0 */
+	LPIT0->CLRTEN = (1U << channel);
 }
 
 /**
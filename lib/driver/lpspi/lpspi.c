@@ -0,0 +1,239 @@
+/**
+ * @file    lpspi.c
+ * @brief   LPSPI Driver Implementation for S32K144
+ * @details Master configuration, FIFO/DMA control and interrupt dispatch
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpspi.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static LPSPI_Type * const s_lpspi_bases[LPSPI_INSTANCE_COUNT] = { LPSPI0, LPSPI1, LPSPI2 };
+
+static lpspi_callback_t s_lpspi_callbacks[LPSPI_INSTANCE_COUNT] = { NULL };
+static void *s_lpspi_user_data[LPSPI_INSTANCE_COUNT] = { NULL };
+
+/* Transmit command without CONT: reused by every TCR write */
+static uint32_t s_lpspi_tcr[LPSPI_INSTANCE_COUNT] = { 0 };
+static uint32_t s_lpspi_baudrate[LPSPI_INSTANCE_COUNT] = { 0 };
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+uint8_t LPSPI_GetInstance(LPSPI_Type *base)
+{
+    uint8_t i;
+
+    for (i = 0; i < LPSPI_INSTANCE_COUNT; i++) {
+        if (s_lpspi_bases[i] == base) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+lpspi_status_t LPSPI_MasterInit(LPSPI_Type *base, const lpspi_master_config_t *config,
+                                uint32_t srcClockHz)
+{
+    uint8_t inst = LPSPI_GetInstance(base);
+    uint32_t prescale;
+    uint32_t div = 0;
+    uint32_t sckdiv;
+    uint32_t tcr;
+
+    if (inst >= LPSPI_INSTANCE_COUNT || config == NULL || config->baudrate == 0U ||
+        config->frame_bits < 8U || config->frame_bits > LPSPI_MAX_FRAME_BITS) {
+        return LPSPI_STATUS_INVALID_PARAM;
+    }
+
+    /* SCK = src / (2^PRESCALE * (SCKDIV + 2)): smallest prescaler that fits */
+    for (prescale = 0; prescale < 8U; prescale++) {
+        div = (srcClockHz >> prescale) / config->baudrate;
+        if (((srcClockHz >> prescale) % config->baudrate) != 0U) {
+            div++;                  /* Round the rate down, never up */
+        }
+        if (div <= 257U) {
+            break;
+        }
+    }
+
+    if (prescale == 8U || srcClockHz == 0U) {
+        return LPSPI_STATUS_INVALID_PARAM;
+    }
+
+    sckdiv = (div < 2U) ? 0U : (div - 2U);
+    s_lpspi_baudrate[inst] = (srcClockHz >> prescale) / (sckdiv + 2U);
+
+    /* Reset clears FIFOs and every register except CR */
+    base->CR = LPSPI_CR_RST_MASK;
+    base->CR = 0U;
+
+    base->CFGR1 = LPSPI_CFGR1_MASTER_MASK |
+                  (config->pcs_active_high ? (1UL << (LPSPI_CFGR1_PCSPOL_SHIFT + (uint32_t)config->pcs)) : 0U);
+
+    /* PCS-to-SCK, SCK-to-PCS and inter-transfer delays of ~1/2 SCK */
+    base->CCR = LPSPI_CCR_SCKDIV(sckdiv) |
+                LPSPI_CCR_DBT(sckdiv / 2U) |
+                LPSPI_CCR_PCSSCK(sckdiv / 2U) |
+                LPSPI_CCR_SCKPCS(sckdiv / 2U);
+
+    base->FCR = LPSPI_FCR_TXWATER(0U) | LPSPI_FCR_RXWATER(0U);
+
+    tcr = LPSPI_TCR_FRAMESZ(config->frame_bits - 1U) |
+          LPSPI_TCR_PCS(config->pcs) |
+          LPSPI_TCR_PRESCALE(prescale);
+    if (config->cpol) {
+        tcr |= LPSPI_TCR_CPOL_MASK;
+    }
+    if (config->cpha) {
+        tcr |= LPSPI_TCR_CPHA_MASK;
+    }
+    if (config->lsb_first) {
+        tcr |= LPSPI_TCR_LSBF_MASK;
+    }
+    s_lpspi_tcr[inst] = tcr;
+
+    base->CR = LPSPI_CR_MEN_MASK | LPSPI_CR_DBGEN_MASK;
+    base->TCR = tcr;
+
+    return LPSPI_STATUS_SUCCESS;
+}
+
+void LPSPI_Deinit(LPSPI_Type *base)
+{
+    uint8_t inst = LPSPI_GetInstance(base);
+
+    if (inst >= LPSPI_INSTANCE_COUNT) {
+        return;
+    }
+
+    base->IER = 0U;
+    base->DER = 0U;
+    base->CR = LPSPI_CR_RST_MASK;
+    base->CR = 0U;
+
+    s_lpspi_callbacks[inst] = NULL;
+    s_lpspi_user_data[inst] = NULL;
+    s_lpspi_baudrate[inst] = 0U;
+}
+
+uint32_t LPSPI_GetBaudrate(LPSPI_Type *base)
+{
+    uint8_t inst = LPSPI_GetInstance(base);
+
+    return (inst < LPSPI_INSTANCE_COUNT) ? s_lpspi_baudrate[inst] : 0U;
+}
+
+void LPSPI_SetPcsContinuous(LPSPI_Type *base, bool hold)
+{
+    uint8_t inst = LPSPI_GetInstance(base);
+
+    if (inst >= LPSPI_INSTANCE_COUNT) {
+        return;
+    }
+
+    base->TCR = hold ? (s_lpspi_tcr[inst] | LPSPI_TCR_CONT_MASK) : s_lpspi_tcr[inst];
+}
+
+void LPSPI_SetFifoWatermarks(LPSPI_Type *base, uint8_t txWater, uint8_t rxWater)
+{
+    base->FCR = LPSPI_FCR_TXWATER(txWater) | LPSPI_FCR_RXWATER(rxWater);
+}
+
+void LPSPI_FlushFifo(LPSPI_Type *base, bool tx, bool rx)
+{
+    uint32_t cr = base->CR;
+
+    if (tx) {
+        cr |= LPSPI_CR_RTF_MASK;
+    }
+    if (rx) {
+        cr |= LPSPI_CR_RRF_MASK;
+    }
+
+    base->CR = cr;
+}
+
+void LPSPI_ConfigHostRequest(LPSPI_Type *base, lpspi_host_request_t request, bool activeHigh)
+{
+    uint32_t cr = base->CR;
+    uint32_t cfgr0 = base->CFGR0 & ~(LPSPI_CFGR0_HREN_MASK | LPSPI_CFGR0_HRPOL_MASK |
+                                     LPSPI_CFGR0_HRSEL_MASK);
+
+    if (request != LPSPI_HOST_REQUEST_DISABLED) {
+        cfgr0 |= LPSPI_CFGR0_HREN_MASK;
+        if (request == LPSPI_HOST_REQUEST_TRIGGER) {
+            cfgr0 |= LPSPI_CFGR0_HRSEL_MASK;
+        } else if (!activeHigh) {
+            cfgr0 |= LPSPI_CFGR0_HRPOL_MASK;
+        }
+    }
+
+    /* CFGR0 is writable only while the module is disabled */
+    base->CR = cr & ~LPSPI_CR_MEN_MASK;
+    base->CFGR0 = cfgr0;
+    base->CR = cr;
+}
+
+void LPSPI_EnableDma(LPSPI_Type *base, uint32_t mask)
+{
+    base->DER |= mask;
+}
+
+void LPSPI_DisableDma(LPSPI_Type *base, uint32_t mask)
+{
+    base->DER &= ~mask;
+}
+
+void LPSPI_EnableInterrupts(LPSPI_Type *base, uint32_t mask)
+{
+    base->IER |= mask;
+}
+
+void LPSPI_DisableInterrupts(LPSPI_Type *base, uint32_t mask)
+{
+    base->IER &= ~mask;
+}
+
+lpspi_status_t LPSPI_RegisterCallback(LPSPI_Type *base, lpspi_callback_t callback, void *userData)
+{
+    uint8_t inst = LPSPI_GetInstance(base);
+
+    if (inst >= LPSPI_INSTANCE_COUNT) {
+        return LPSPI_STATUS_INVALID_PARAM;
+    }
+
+    s_lpspi_user_data[inst] = userData;
+    s_lpspi_callbacks[inst] = callback;
+
+    return LPSPI_STATUS_SUCCESS;
+}
+
+void LPSPI_IRQHandler(LPSPI_Type *base)
+{
+    uint8_t inst = LPSPI_GetInstance(base);
+    uint32_t flags;
+
+    if (inst >= LPSPI_INSTANCE_COUNT) {
+        return;
+    }
+
+    /* Only enabled sources; TDF/RDF clear themselves through the FIFOs */
+    flags = base->SR & base->IER;
+    base->SR = flags & LPSPI_SR_W1C_FLAGS;
+
+    if (s_lpspi_callbacks[inst] != NULL) {
+        s_lpspi_callbacks[inst](base, flags, s_lpspi_user_data[inst]);
+    }
+}
@@ -0,0 +1,272 @@
+/**
+ * @file    lpspi.h
+ * @brief   LPSPI Driver API for S32K144
+ * @details Master mode access to the three LPSPI instances:
+ *
+ * Features:
+ * - Baud rate from the functional clock (PRESCALE / SCKDIV search)
+ * - 4-word TX/RX FIFOs with programmable watermarks
+ * - Continuous transfers: PCS held asserted across frames (TCR CONT)
+ * - DMA requests on TX/RX watermarks
+ * - Host request: each transfer waits for the HREQ pin or the TRGMUX
+ *   input trigger, so transfers can be paced by a timer
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LPSPI_H
+#define LPSPI_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpspi_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Largest supported frame (one FIFO word) */
+#define LPSPI_MAX_FRAME_BITS        (32U)
+
+/**
+ * @brief LPSPI driver status codes
+ */
+typedef enum {
+    LPSPI_STATUS_SUCCESS = 0,       /**< Operation successful */
+    LPSPI_STATUS_ERROR,             /**< General error */
+    LPSPI_STATUS_BUSY,              /**< Module busy */
+    LPSPI_STATUS_INVALID_PARAM      /**< Invalid parameter */
+} lpspi_status_t;
+
+/**
+ * @brief Peripheral chip select
+ */
+typedef enum {
+    LPSPI_PCS0 = 0U,
+    LPSPI_PCS1 = 1U,
+    LPSPI_PCS2 = 2U,
+    LPSPI_PCS3 = 3U
+} lpspi_pcs_t;
+
+/**
+ * @brief Transfer start condition
+ */
+typedef enum {
+    LPSPI_HOST_REQUEST_DISABLED = 0,    /**< Transfers start as soon as data is queued */
+    LPSPI_HOST_REQUEST_PIN,             /**< Wait for the HREQ pin */
+    LPSPI_HOST_REQUEST_TRIGGER          /**< Wait for the TRGMUX input trigger */
+} lpspi_host_request_t;
+
+/**
+ * @brief Master configuration
+ */
+typedef struct {
+    uint32_t baudrate;              /**< Requested SCK in Hz (rounded down) */
+    uint8_t frame_bits;             /**< Bits per frame (8-32) */
+    bool cpol;                      /**< Clock idles high */
+    bool cpha;                      /**< Data captured on the second edge */
+    bool lsb_first;                 /**< LSB shifted first */
+    lpspi_pcs_t pcs;                /**< Chip select */
+    bool pcs_active_high;           /**< Chip select polarity */
+} lpspi_master_config_t;
+
+/**
+ * @brief Callback (interrupt context)
+ * @param instance LPSPI base address
+ * @param flags SR flags that caused the interrupt (LPSPI_SR_xxx_MASK)
+ * @param userData Parameter given at registration
+ */
+typedef void (*lpspi_callback_t)(LPSPI_Type *instance, uint32_t flags, void *userData);
+
+/*******************************************************************************
+ * Inline Functions
+ ******************************************************************************/
+
+/**
+ * @brief Push one word into the TX FIFO
+ */
+static inline void LPSPI_WriteData(LPSPI_Type *base, uint32_t data)
+{
+    base->TDR = data;
+}
+
+/**
+ * @brief Pop one word from the RX FIFO
+ */
+static inline uint32_t LPSPI_ReadData(LPSPI_Type *base)
+{
+    return base->RDR;
+}
+
+/**
+ * @brief Words (data and commands) waiting in the TX FIFO
+ */
+static inline uint32_t LPSPI_GetTxFifoCount(LPSPI_Type *base)
+{
+    return (base->FSR & LPSPI_FSR_TXCOUNT_MASK) >> LPSPI_FSR_TXCOUNT_SHIFT;
+}
+
+/**
+ * @brief Words waiting in the RX FIFO
+ */
+static inline uint32_t LPSPI_GetRxFifoCount(LPSPI_Type *base)
+{
+    return (base->FSR & LPSPI_FSR_RXCOUNT_MASK) >> LPSPI_FSR_RXCOUNT_SHIFT;
+}
+
+/**
+ * @brief Read status flags
+ */
+static inline uint32_t LPSPI_GetStatusFlags(LPSPI_Type *base)
+{
+    return base->SR;
+}
+
+/**
+ * @brief Clear write-1-to-clear status flags
+ */
+static inline void LPSPI_ClearStatusFlags(LPSPI_Type *base, uint32_t flags)
+{
+    base->SR = flags & LPSPI_SR_W1C_FLAGS;
+}
+
+/**
+ * @brief TDR address (DMA destination)
+ */
+static inline uint32_t LPSPI_GetTxDataAddress(LPSPI_Type *base)
+{
+    return (uint32_t)&base->TDR;
+}
+
+/**
+ * @brief RDR address (DMA source)
+ */
+static inline uint32_t LPSPI_GetRxDataAddress(LPSPI_Type *base)
+{
+    return (uint32_t)&base->RDR;
+}
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize an instance as master
+ * @details Resets the module, programs clock, delays (half an SCK period
+ *          each), FIFO watermarks 0 and the transmit command, then enables
+ *          the module. The PCC clock must be enabled by the caller.
+ * @param base LPSPI base address
+ * @param config Master configuration
+ * @param srcClockHz Functional clock in Hz
+ * @return lpspi_status_t LPSPI_STATUS_INVALID_PARAM if the rate cannot be reached
+ */
+lpspi_status_t LPSPI_MasterInit(LPSPI_Type *base, const lpspi_master_config_t *config,
+                                uint32_t srcClockHz);
+
+/**
+ * @brief Disable an instance and drop its callback
+ * @param base LPSPI base address
+ */
+void LPSPI_Deinit(LPSPI_Type *base);
+
+/**
+ * @brief Get the SCK rate programmed by LPSPI_MasterInit()
+ * @param base LPSPI base address
+ * @return uint32_t Baud rate in Hz
+ */
+uint32_t LPSPI_GetBaudrate(LPSPI_Type *base);
+
+/**
+ * @brief Hold or release the chip select between frames
+ * @details Queues a transmit command. With hold set, PCS stays asserted
+ *          after each frame until a command with hold cleared is queued.
+ * @param base LPSPI base address
+ * @param hold true for continuous transfers
+ */
+void LPSPI_SetPcsContinuous(LPSPI_Type *base, bool hold);
+
+/**
+ * @brief Set FIFO watermarks
+ * @details TDF (and the TX DMA request) is set while TXCOUNT <= txWater,
+ *          RDF (and the RX DMA request) while RXCOUNT > rxWater.
+ * @param base LPSPI base address
+ * @param txWater TX watermark (0-3)
+ * @param rxWater RX watermark (0-3)
+ */
+void LPSPI_SetFifoWatermarks(LPSPI_Type *base, uint8_t txWater, uint8_t rxWater);
+
+/**
+ * @brief Flush FIFOs
+ * @param base LPSPI base address
+ * @param tx Flush the TX FIFO
+ * @param rx Flush the RX FIFO
+ */
+void LPSPI_FlushFifo(LPSPI_Type *base, bool tx, bool rx);
+
+/**
+ * @brief Select the transfer start condition
+ * @details The module is disabled while CFGR0 is changed. A host request
+ *          is sampled only while PCS is negated, so it paces frames of
+ *          non-continuous transfers.
+ * @param base LPSPI base address
+ * @param request Start condition
+ * @param activeHigh Request polarity (pin only)
+ */
+void LPSPI_ConfigHostRequest(LPSPI_Type *base, lpspi_host_request_t request, bool activeHigh);
+
+/**
+ * @brief Enable DMA requests
+ * @param base LPSPI base address
+ * @param mask LPSPI_DER_TDDE_MASK | LPSPI_DER_RDDE_MASK
+ */
+void LPSPI_EnableDma(LPSPI_Type *base, uint32_t mask);
+
+/**
+ * @brief Disable DMA requests
+ * @param base LPSPI base address
+ * @param mask LPSPI_DER_TDDE_MASK | LPSPI_DER_RDDE_MASK
+ */
+void LPSPI_DisableDma(LPSPI_Type *base, uint32_t mask);
+
+/**
+ * @brief Enable interrupts
+ * @param base LPSPI base address
+ * @param mask LPSPI_IER_xxx_MASK
+ */
+void LPSPI_EnableInterrupts(LPSPI_Type *base, uint32_t mask);
+
+/**
+ * @brief Disable interrupts
+ * @param base LPSPI base address
+ * @param mask LPSPI_IER_xxx_MASK
+ */
+void LPSPI_DisableInterrupts(LPSPI_Type *base, uint32_t mask);
+
+/**
+ * @brief Get the instance number of a base address
+ * @param base LPSPI base address
+ * @return uint8_t Instance (0-2), LPSPI_INSTANCE_COUNT if unknown
+ */
+uint8_t LPSPI_GetInstance(LPSPI_Type *base);
+
+/**
+ * @brief Register callback
+ * @param base LPSPI base address
+ * @param callback Callback, NULL to remove
+ * @param userData Passed back to the callback
+ * @return lpspi_status_t Status of operation
+ */
+lpspi_status_t LPSPI_RegisterCallback(LPSPI_Type *base, lpspi_callback_t callback, void *userData);
+
+/**
+ * @brief Interrupt handler (called from lpspi_irq.c)
+ * @param base LPSPI base address
+ */
+void LPSPI_IRQHandler(LPSPI_Type *base);
+
+#endif /* LPSPI_H */
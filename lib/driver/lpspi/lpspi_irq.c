@@ -0,0 +1,23 @@
+/**
+ * @file    lpspi_irq.c
+ * @brief   LPSPI Interrupt Service Routine Implementation
+ * @details Implements LPSPI ISRs and forwards to driver layer handler
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpspi_irq.h"
+
+/*******************************************************************************
+ * ISR Implementation
+ ******************************************************************************/
+
+/* Forward to driver layer handler */
+void LPSPI0_IRQHandler(void) { LPSPI_IRQHandler(LPSPI0); }
+void LPSPI1_IRQHandler(void) { LPSPI_IRQHandler(LPSPI1); }
+void LPSPI2_IRQHandler(void) { LPSPI_IRQHandler(LPSPI2); }
@@ -0,0 +1,39 @@
+/**
+ * @file    lpspi_irq.h
+ * @brief   LPSPI Interrupt Handler Declarations
+ * @details Provides ISR declarations for LPSPI interrupts following CMSIS naming convention
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LPSPI_IRQ_H
+#define LPSPI_IRQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpspi.h"
+
+/*******************************************************************************
+ * ISR Declarations
+ ******************************************************************************/
+
+/**
+ * @brief LPSPI0-2 interrupt service routines
+ * @note These functions should be defined in the startup vector table
+ */
+void LPSPI0_IRQHandler(void);
+void LPSPI1_IRQHandler(void);
+void LPSPI2_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPSPI_IRQ_H */
@@ -0,0 +1,182 @@
+/*
+ * @file    lpspi_reg.h
+ * @brief   LPSPI Register Definitions for S32K144
+ */
+
+#ifndef LPSPI_REG_H_
+#define LPSPI_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+/**
+*   IO Type Qualifiers are used
+*   \li to specify the access to peripheral variables.
+*   \li for automatic generation of peripheral register debug information.
+*/
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- LPSPI Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup LPSPI_Peripheral_Access_Layer LPSPI Peripheral Access Layer
+ * @{
+ */
+
+/** LPSPI - Register Layout Typedef */
+typedef struct {
+  __I  uint32_t VERID;                             /**< Version ID Register, offset: 0x0 */
+  __I  uint32_t PARAM;                             /**< Parameter Register, offset: 0x4 */
+  uint8_t RESERVED_0[8];
+  __IO uint32_t CR;                                /**< Control Register, offset: 0x10 */
+  __IO uint32_t SR;                                /**< Status Register, offset: 0x14 */
+  __IO uint32_t IER;                               /**< Interrupt Enable Register, offset: 0x18 */
+  __IO uint32_t DER;                               /**< DMA Enable Register, offset: 0x1C */
+  __IO uint32_t CFGR0;                             /**< Configuration Register 0, offset: 0x20 */
+  __IO uint32_t CFGR1;                             /**< Configuration Register 1, offset: 0x24 */
+  uint8_t RESERVED_1[8];
+  __IO uint32_t DMR0;                              /**< Data Match Register 0, offset: 0x30 */
+  __IO uint32_t DMR1;                              /**< Data Match Register 1, offset: 0x34 */
+  uint8_t RESERVED_2[8];
+  __IO uint32_t CCR;                               /**< Clock Configuration Register, offset: 0x40 */
+  uint8_t RESERVED_3[20];
+  __IO uint32_t FCR;                               /**< FIFO Control Register, offset: 0x58 */
+  __I  uint32_t FSR;                               /**< FIFO Status Register, offset: 0x5C */
+  __IO uint32_t TCR;                               /**< Transmit Command Register, offset: 0x60 */
+  __O  uint32_t TDR;                               /**< Transmit Data Register, offset: 0x64 */
+  uint8_t RESERVED_4[8];
+  __I  uint32_t RSR;                               /**< Receive Status Register, offset: 0x70 */
+  __I  uint32_t RDR;                               /**< Receive Data Register, offset: 0x74 */
+} LPSPI_Type, *LPSPI_MemMapPtr;
+
+/** Number of instances of the LPSPI module. */
+#define LPSPI_INSTANCE_COUNT                     (3u)
+
+/** Peripheral LPSPI base addresses */
+#define LPSPI0_BASE                              (0x4002C000u)
+#define LPSPI1_BASE                              (0x4002D000u)
+#define LPSPI2_BASE                              (0x4002E000u)
+/** Peripheral LPSPI base pointers */
+#define LPSPI0                                   ((LPSPI_Type *)LPSPI0_BASE)
+#define LPSPI1                                   ((LPSPI_Type *)LPSPI1_BASE)
+#define LPSPI2                                   ((LPSPI_Type *)LPSPI2_BASE)
+
+/** FIFO depth in words */
+#define LPSPI_FIFO_SIZE                          (4u)
+
+/* ----------------------------------------------------------------------------
+   -- LPSPI Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*! @name CR - Control Register */
+#define LPSPI_CR_MEN_MASK                        (0x1U)
+#define LPSPI_CR_RST_MASK                        (0x2U)
+#define LPSPI_CR_DOZEN_MASK                      (0x4U)
+#define LPSPI_CR_DBGEN_MASK                      (0x8U)
+#define LPSPI_CR_RTF_MASK                        (0x100U)
+#define LPSPI_CR_RRF_MASK                        (0x200U)
+
+/*! @name SR - Status Register (flags are write 1 to clear) */
+#define LPSPI_SR_TDF_MASK                        (0x1U)
+#define LPSPI_SR_RDF_MASK                        (0x2U)
+#define LPSPI_SR_WCF_MASK                        (0x100U)
+#define LPSPI_SR_FCF_MASK                        (0x200U)
+#define LPSPI_SR_TCF_MASK                        (0x400U)
+#define LPSPI_SR_TEF_MASK                        (0x800U)
+#define LPSPI_SR_REF_MASK                        (0x1000U)
+#define LPSPI_SR_DMF_MASK                        (0x2000U)
+#define LPSPI_SR_MBF_MASK                        (0x1000000U)
+#define LPSPI_SR_W1C_FLAGS                       (0x3F00U)
+
+/*! @name IER - Interrupt Enable Register (same layout as SR) */
+#define LPSPI_IER_TDIE_MASK                      (0x1U)
+#define LPSPI_IER_RDIE_MASK                      (0x2U)
+#define LPSPI_IER_FCIE_MASK                      (0x200U)
+#define LPSPI_IER_TCIE_MASK                      (0x400U)
+#define LPSPI_IER_TEIE_MASK                      (0x800U)
+#define LPSPI_IER_REIE_MASK                      (0x1000U)
+
+/*! @name DER - DMA Enable Register */
+#define LPSPI_DER_TDDE_MASK                      (0x1U)
+#define LPSPI_DER_RDDE_MASK                      (0x2U)
+
+/*! @name CFGR0 - Configuration Register 0 */
+#define LPSPI_CFGR0_HREN_MASK                    (0x1U)
+#define LPSPI_CFGR0_HRPOL_MASK                   (0x2U)
+#define LPSPI_CFGR0_HRSEL_MASK                   (0x4U)
+#define LPSPI_CFGR0_CIRFIFO_MASK                 (0x100U)
+#define LPSPI_CFGR0_RDMO_MASK                    (0x200U)
+
+/*! @name CFGR1 - Configuration Register 1 */
+#define LPSPI_CFGR1_MASTER_MASK                  (0x1U)
+#define LPSPI_CFGR1_SAMPLE_MASK                  (0x2U)
+#define LPSPI_CFGR1_AUTOPCS_MASK                 (0x4U)
+#define LPSPI_CFGR1_NOSTALL_MASK                 (0x8U)
+#define LPSPI_CFGR1_PCSPOL_SHIFT                 (8U)
+#define LPSPI_CFGR1_PCSPOL_MASK                  (0xF00U)
+#define LPSPI_CFGR1_PINCFG_SHIFT                 (24U)
+#define LPSPI_CFGR1_PINCFG_MASK                  (0x3000000U)
+#define LPSPI_CFGR1_OUTCFG_MASK                  (0x4000000U)
+
+/*! @name CCR - Clock Configuration Register */
+#define LPSPI_CCR_SCKDIV_SHIFT                   (0U)
+#define LPSPI_CCR_SCKDIV_MASK                    (0xFFU)
+#define LPSPI_CCR_SCKDIV(x)                      (((uint32_t)(x) << LPSPI_CCR_SCKDIV_SHIFT) & LPSPI_CCR_SCKDIV_MASK)
+#define LPSPI_CCR_DBT_SHIFT                      (8U)
+#define LPSPI_CCR_DBT_MASK                       (0xFF00U)
+#define LPSPI_CCR_DBT(x)                         (((uint32_t)(x) << LPSPI_CCR_DBT_SHIFT) & LPSPI_CCR_DBT_MASK)
+#define LPSPI_CCR_PCSSCK_SHIFT                   (16U)
+#define LPSPI_CCR_PCSSCK_MASK                    (0xFF0000U)
+#define LPSPI_CCR_PCSSCK(x)                      (((uint32_t)(x) << LPSPI_CCR_PCSSCK_SHIFT) & LPSPI_CCR_PCSSCK_MASK)
+#define LPSPI_CCR_SCKPCS_SHIFT                   (24U)
+#define LPSPI_CCR_SCKPCS_MASK                    (0xFF000000U)
+#define LPSPI_CCR_SCKPCS(x)                      (((uint32_t)(x) << LPSPI_CCR_SCKPCS_SHIFT) & LPSPI_CCR_SCKPCS_MASK)
+
+/*! @name FCR - FIFO Control Register */
+#define LPSPI_FCR_TXWATER_SHIFT                  (0U)
+#define LPSPI_FCR_TXWATER_MASK                   (0x3U)
+#define LPSPI_FCR_TXWATER(x)                     (((uint32_t)(x) << LPSPI_FCR_TXWATER_SHIFT) & LPSPI_FCR_TXWATER_MASK)
+#define LPSPI_FCR_RXWATER_SHIFT                  (16U)
+#define LPSPI_FCR_RXWATER_MASK                   (0x30000U)
+#define LPSPI_FCR_RXWATER(x)                     (((uint32_t)(x) << LPSPI_FCR_RXWATER_SHIFT) & LPSPI_FCR_RXWATER_MASK)
+
+/*! @name FSR - FIFO Status Register */
+#define LPSPI_FSR_TXCOUNT_SHIFT                  (0U)
+#define LPSPI_FSR_TXCOUNT_MASK                   (0x7U)
+#define LPSPI_FSR_RXCOUNT_SHIFT                  (16U)
+#define LPSPI_FSR_RXCOUNT_MASK                   (0x70000U)
+
+/*! @name TCR - Transmit Command Register */
+#define LPSPI_TCR_FRAMESZ_SHIFT                  (0U)
+#define LPSPI_TCR_FRAMESZ_MASK                   (0xFFFU)
+#define LPSPI_TCR_FRAMESZ(x)                     (((uint32_t)(x) << LPSPI_TCR_FRAMESZ_SHIFT) & LPSPI_TCR_FRAMESZ_MASK)
+#define LPSPI_TCR_TXMSK_MASK                     (0x40000U)
+#define LPSPI_TCR_RXMSK_MASK                     (0x80000U)
+#define LPSPI_TCR_CONTC_MASK                     (0x100000U)
+#define LPSPI_TCR_CONT_MASK                      (0x200000U)
+#define LPSPI_TCR_BYSW_MASK                      (0x400000U)
+#define LPSPI_TCR_LSBF_MASK                      (0x800000U)
+#define LPSPI_TCR_PCS_SHIFT                      (24U)
+#define LPSPI_TCR_PCS_MASK                       (0x3000000U)
+#define LPSPI_TCR_PCS(x)                         (((uint32_t)(x) << LPSPI_TCR_PCS_SHIFT) & LPSPI_TCR_PCS_MASK)
+#define LPSPI_TCR_PRESCALE_SHIFT                 (27U)
+#define LPSPI_TCR_PRESCALE_MASK                  (0x38000000U)
+#define LPSPI_TCR_PRESCALE(x)                    (((uint32_t)(x) << LPSPI_TCR_PRESCALE_SHIFT) & LPSPI_TCR_PRESCALE_MASK)
+#define LPSPI_TCR_CPHA_MASK                      (0x40000000U)
+#define LPSPI_TCR_CPOL_MASK                      (0x80000000U)
+
+/*! @name RSR - Receive Status Register */
+#define LPSPI_RSR_SOF_MASK                       (0x1U)
+#define LPSPI_RSR_RXEMPTY_MASK                   (0x2U)
+
+/*!
+ * @}
+ */ /* end of group LPSPI_Peripheral_Access_Layer */
+
+#endif /* LPSPI_REG_H_ */
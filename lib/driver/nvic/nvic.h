@@ -13,6 +13,11 @@
 typedef enum
 {
   DMA_0_IRQn                   = 0u,
+  WDOG_EWM_IRQn                = 22,               /**< WDOG interrupt before reset, EWM output */
+  LPI2C0_Master_IRQn           = 24,               /**< LPI2C0 Master Interrupt */
+  LPSPI0_IRQn                  = 26,               /**< LPSPI0 Interrupt */
+  LPSPI1_IRQn                  = 27,               /**< LPSPI1 Interrupt */
+  LPSPI2_IRQn                  = 28,               /**< LPSPI2 Interrupt */
   LPUART0_RxTx_IRQn            = 31,               /**< LPUART0 Transmit / Receive Interrupt / Error / Overrun */
   LPUART1_RxTx_IRQn            = 33,               /**< LPUART1 Transmit / Receive Interrupt / Error / Overrun */
   LPUART2_RxTx_IRQn            = 35,               /**< LPUART2 Transmit / Receive Interrupt / Error / Overrun */
@@ -22,11 +27,14 @@ typedef enum
   LPIT0_Ch1_IRQn               = 49,               /**< LPIT0 channel 1 overflow interrupt */
   LPIT0_Ch2_IRQn               = 50,               /**< LPIT0 channel 2 overflow interrupt */
   LPIT0_Ch3_IRQn               = 51,               /**< LPIT0 channel 3 overflow interrupt */
+  PDB0_IRQn                    = 52,               /**< PDB0 interrupt */
   PORTA_IRQn                   = 59u,              /**< Port A pin detect interrupt */
   PORTB_IRQn                   = 60u,              /**< Port B pin detect interrupt */
   PORTC_IRQn                   = 61u,              /**< Port C pin detect interrupt */
   PORTD_IRQn                   = 62u,              /**< Port D pin detect interrupt */
   PORTE_IRQn                   = 63u,              /**< Port E pin detect interrupt */
+  PDB1_IRQn                    = 68,               /**< PDB1 interrupt */
+  FLEXIO_IRQn                  = 69,               /**< FlexIO interrupt */
   CAN0_ORed_IRQn               = 78,               /**< CAN0 OR'ed Bus in Off State. */
   CAN0_Error_IRQn              = 79,               /**< CAN0 Interrupt indicating that errors were detected on the CAN bus */
   CAN0_Wake_Up_IRQn            = 80,               /**< CAN0 Interrupt asserted when Pretended Networking operation is enabled, and a valid message matches the selected filter criteria during Low Power mode */
@@ -38,6 +46,26 @@ typedef enum
   CAN2_ORed_IRQn               = 92,               /**< CAN2 OR'ed Bus in Off State */
   CAN2_Error_IRQn              = 93,               /**< CAN2 Interrupt indicating that errors were detected on the CAN bus */
   CAN2_ORed_0_15_MB_IRQn       = 95,               /**< CAN2 OR'ed Message buffer (0-15) */
+  FTM0_Ch0_Ch1_IRQn            = 99,               /**< FTM0 Channel 0 and 1 interrupt */
+  FTM0_Ch2_Ch3_IRQn            = 100,              /**< FTM0 Channel 2 and 3 interrupt */
+  FTM0_Ch4_Ch5_IRQn            = 101,              /**< FTM0 Channel 4 and 5 interrupt */
+  FTM0_Ch6_Ch7_IRQn            = 102,              /**< FTM0 Channel 6 and 7 interrupt */
+  FTM0_Ovf_Reload_IRQn         = 104,              /**< FTM0 Counter overflow and Reload interrupt */
+  FTM1_Ch0_Ch1_IRQn            = 105,              /**< FTM1 Channel 0 and 1 interrupt */
+  FTM1_Ch2_Ch3_IRQn            = 106,              /**< FTM1 Channel 2 and 3 interrupt */
+  FTM1_Ch4_Ch5_IRQn            = 107,              /**< FTM1 Channel 4 and 5 interrupt */
+  FTM1_Ch6_Ch7_IRQn            = 108,              /**< FTM1 Channel 6 and 7 interrupt */
+  FTM1_Ovf_Reload_IRQn         = 110,              /**< FTM1 Counter overflow and Reload interrupt */
+  FTM2_Ch0_Ch1_IRQn            = 111,              /**< FTM2 Channel 0 and 1 interrupt */
+  FTM2_Ch2_Ch3_IRQn            = 112,              /**< FTM2 Channel 2 and 3 interrupt */
+  FTM2_Ch4_Ch5_IRQn            = 113,              /**< FTM2 Channel 4 and 5 interrupt */
+  FTM2_Ch6_Ch7_IRQn            = 114,              /**< FTM2 Channel 6 and 7 interrupt */
+  FTM2_Ovf_Reload_IRQn         = 116,              /**< FTM2 Counter overflow and Reload interrupt */
+  FTM3_Ch0_Ch1_IRQn            = 117,              /**< FTM3 Channel 0 and 1 interrupt */
+  FTM3_Ch2_Ch3_IRQn            = 118,              /**< FTM3 Channel 2 and 3 interrupt */
+  FTM3_Ch4_Ch5_IRQn            = 119,              /**< FTM3 Channel 4 and 5 interrupt */
+  FTM3_Ch6_Ch7_IRQn            = 120,              /**< FTM3 Channel 6 and 7 interrupt */
+  FTM3_Ovf_Reload_IRQn         = 122,              /**< FTM3 Counter overflow and Reload interrupt */
 } IRQn_Type;
 
 void NVIC_EnableInterrupt		(IRQn_Type IRQ_number);
@@ -15,17 +15,29 @@
  * This enum defines the PCC register index for each peripheral.
  */
 typedef enum {
+    PCC_DMAMUX_INDEX   = 33U,  /**< DMAMUX PCC index */
     PCC_FLEXCAN0_INDEX = 36U,  /**< FlexCAN0 PCC index */
     PCC_FLEXCAN1_INDEX = 37U,  /**< FlexCAN1 PCC index */
+    PCC_FTM3_INDEX     = 38U,  /**< FTM3 PCC index */
     PCC_ADC1_INDEX     = 39U,  /**< ADC1 PCC index */
     PCC_FLEXCAN2_INDEX = 43U,  /**< FlexCAN2 PCC index */
+    PCC_LPSPI0_INDEX   = 44U,  /**< LPSPI0 PCC index */
+    PCC_LPSPI1_INDEX   = 45U,  /**< LPSPI1 PCC index */
+    PCC_LPSPI2_INDEX   = 46U,  /**< LPSPI2 PCC index */
+    PCC_PDB1_INDEX     = 49U,  /**< PDB1 PCC index */
+    PCC_CRC_INDEX      = 50U,  /**< CRC PCC index */
+    PCC_PDB0_INDEX     = 54U,  /**< PDB0 PCC index */
     PCC_LPIT_INDEX     = 55U,  /**< LPIT PCC index */
+    PCC_FTM0_INDEX     = 56U,  /**< FTM0 PCC index */
+    PCC_FTM1_INDEX     = 57U,  /**< FTM1 PCC index */
+    PCC_FTM2_INDEX     = 58U,  /**< FTM2 PCC index */
     PCC_ADC0_INDEX     = 59U,  /**< ADC0 PCC index */
     PCC_PORTA_INDEX    = 73U,  /**< PORTA PCC index */
     PCC_PORTB_INDEX    = 74U,  /**< PORTB PCC index */
     PCC_PORTC_INDEX    = 75U,  /**< PORTC PCC index */
     PCC_PORTD_INDEX    = 76U,  /**< PORTD PCC index */
     PCC_PORTE_INDEX    = 77U,  /**< PORTE PCC index */
+    PCC_FLEXIO_INDEX   = 90U,  /**< FlexIO PCC index */
     PCC_LPI2C0_INDEX   = 102U, /**< LPI2C0 PCC index */
     PCC_LPI2C1_INDEX   = 103U, /**< LPI2C1 PCC index */
     PCC_LPUART0_INDEX  = 106U, /**< LPUART0 PCC index */
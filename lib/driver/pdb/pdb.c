@@ -0,0 +1,182 @@
+/**
+ * @file    pdb.c
+ * @brief   PDB Driver Implementation for S32K144
+ * @details Counter, pre-trigger and interrupt configuration
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "pdb.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static PDB_Type * const s_pdb_bases[PDB_INSTANCE_COUNT] = { PDB0, PDB1 };
+
+static pdb_callback_t s_pdb_callbacks[PDB_INSTANCE_COUNT] = { NULL };
+static void *s_pdb_user_data[PDB_INSTANCE_COUNT] = { NULL };
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+uint8_t PDB_GetInstance(PDB_Type *base)
+{
+    uint8_t i;
+
+    for (i = 0; i < PDB_INSTANCE_COUNT; i++) {
+        if (s_pdb_bases[i] == base) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+pdb_status_t PDB_Init(PDB_Type *base, const pdb_config_t *config)
+{
+    if (PDB_GetInstance(base) >= PDB_INSTANCE_COUNT || config == NULL || config->prescaler > 7U) {
+        return PDB_STATUS_INVALID_PARAM;
+    }
+
+    base->SC = 0U;
+    base->CH[0].C1 = 0U;
+    base->CH[1].C1 = 0U;
+    base->POEN = 0U;
+
+    base->SC = PDB_SC_PDBEN_MASK |
+               PDB_SC_TRGSEL(config->trigger) |
+               PDB_SC_PRESCALER(config->prescaler) |
+               PDB_SC_MULT(config->mult) |
+               PDB_SC_LDMOD(config->load_mode) |
+               (config->continuous ? PDB_SC_CONT_MASK : 0U);
+
+    /* MOD/IDLY/DLY are buffered: written only while PDBEN is set, applied
+       by LDOK */
+    base->MOD = PDB_MAX_COUNT;
+    base->IDLY = PDB_MAX_COUNT;
+    base->SC |= PDB_SC_LDOK_MASK;
+
+    return PDB_STATUS_SUCCESS;
+}
+
+void PDB_Deinit(PDB_Type *base)
+{
+    if (PDB_GetInstance(base) >= PDB_INSTANCE_COUNT) {
+        return;
+    }
+
+    base->CH[0].C1 = 0U;
+    base->CH[1].C1 = 0U;
+    base->CH[0].S = PDB_S_ERR_MASK;
+    base->CH[1].S = PDB_S_ERR_MASK;
+    base->SC = 0U;
+}
+
+void PDB_SetModulus(PDB_Type *base, uint16_t modulus)
+{
+    base->MOD = modulus;
+}
+
+void PDB_SetInterruptDelay(PDB_Type *base, uint16_t delay)
+{
+    base->IDLY = delay;
+}
+
+pdb_status_t PDB_ConfigPreTrigger(PDB_Type *base, uint8_t channel, uint8_t pretrigger,
+                                  bool enable, bool backToBack, uint16_t delay)
+{
+    uint32_t bit;
+    uint32_t c1;
+
+    if (channel >= PDB_CH_COUNT || pretrigger >= PDB_DLY_COUNT) {
+        return PDB_STATUS_INVALID_PARAM;
+    }
+
+    bit = 1UL << pretrigger;
+    c1 = base->CH[channel].C1 & ~((bit << PDB_C1_EN_SHIFT) | (bit << PDB_C1_TOS_SHIFT) |
+                                  (bit << PDB_C1_BB_SHIFT));
+
+    if (enable) {
+        /* TOS: output enabled, not bypassed to the trigger input */
+        c1 |= (bit << PDB_C1_EN_SHIFT) | (bit << PDB_C1_TOS_SHIFT);
+        if (backToBack && pretrigger > 0U) {
+            /* Fires on the previous conversion's completion, DLY unused */
+            c1 |= bit << PDB_C1_BB_SHIFT;
+        } else {
+            base->CH[channel].DLY[pretrigger] = delay;
+        }
+    }
+
+    base->CH[channel].C1 = c1;
+
+    return PDB_STATUS_SUCCESS;
+}
+
+void PDB_LoadValues(PDB_Type *base)
+{
+    base->SC |= PDB_SC_LDOK_MASK;
+}
+
+void PDB_EnableInterrupts(PDB_Type *base, bool delay, bool sequenceError)
+{
+    uint32_t sc = base->SC & ~(PDB_SC_PDBIE_MASK | PDB_SC_PDBEIE_MASK | PDB_SC_SWTRIG_MASK);
+
+    if (delay) {
+        sc |= PDB_SC_PDBIE_MASK;
+    }
+    if (sequenceError) {
+        sc |= PDB_SC_PDBEIE_MASK;
+    }
+
+    base->SC = sc;
+}
+
+pdb_status_t PDB_RegisterCallback(PDB_Type *base, pdb_callback_t callback, void *userData)
+{
+    uint8_t inst = PDB_GetInstance(base);
+
+    if (inst >= PDB_INSTANCE_COUNT) {
+        return PDB_STATUS_INVALID_PARAM;
+    }
+
+    s_pdb_callbacks[inst] = callback;
+    s_pdb_user_data[inst] = userData;
+
+    return PDB_STATUS_SUCCESS;
+}
+
+void PDB_IRQHandler(PDB_Type *base)
+{
+    uint8_t inst = PDB_GetInstance(base);
+    uint32_t flags = 0;
+
+    if (inst >= PDB_INSTANCE_COUNT) {
+        return;
+    }
+
+    if ((base->SC & (PDB_SC_PDBIF_MASK | PDB_SC_PDBIE_MASK)) == (PDB_SC_PDBIF_MASK | PDB_SC_PDBIE_MASK)) {
+        /* PDBIF is cleared by writing 0; SWTRIG/LDOK must not be re-written */
+        base->SC &= ~(PDB_SC_PDBIF_MASK | PDB_SC_SWTRIG_MASK | PDB_SC_LDOK_MASK);
+        flags |= PDB_EVENT_DELAY;
+    }
+
+    /* Error flags stay set for the callback to read */
+    if ((base->SC & PDB_SC_PDBEIE_MASK) != 0U &&
+        ((base->CH[0].S | base->CH[1].S) & PDB_S_ERR_MASK) != 0U) {
+        flags |= PDB_EVENT_SEQUENCE_ERROR;
+    }
+
+    if (s_pdb_callbacks[inst] != NULL) {
+        s_pdb_callbacks[inst](base, flags, s_pdb_user_data[inst]);
+    } else {
+        base->CH[0].S = PDB_S_ERR_MASK;
+        base->CH[1].S = PDB_S_ERR_MASK;
+    }
+}
@@ -0,0 +1,214 @@
+/**
+ * @file    pdb.h
+ * @brief   PDB Driver API for S32K144
+ * @details Programmable Delay Block: a 16-bit counter started by a trigger
+ *          that fires ADC pre-triggers at programmed counts.
+ *
+ * Features:
+ * - Trigger from software or from TRGMUX (LPIT, FTM, ...)
+ * - One-shot or continuous (counter restarts at MOD)
+ * - Per pre-trigger delay or back-to-back chaining: pre-trigger n fires
+ *   when the ADC conversion of pre-trigger n-1 completes
+ * - Sequence error detection when a pre-trigger hits an unread result
+ *
+ * PDB0 pre-triggers drive ADC0, PDB1 drives ADC1. Channel 0 pre-trigger m
+ * selects SC1[m], channel 1 pre-trigger m selects SC1[8 + m].
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef PDB_H
+#define PDB_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "pdb_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Largest counter value */
+#define PDB_MAX_COUNT               (0xFFFFU)
+
+/** @brief Callback event flags */
+#define PDB_EVENT_DELAY             (1U << 0)       /* Counter reached IDLY */
+#define PDB_EVENT_SEQUENCE_ERROR    (1U << 1)       /* Pre-trigger on an unread result */
+
+/**
+ * @brief PDB driver status codes
+ */
+typedef enum {
+    PDB_STATUS_SUCCESS = 0,         /**< Operation successful */
+    PDB_STATUS_ERROR,               /**< General error */
+    PDB_STATUS_INVALID_PARAM        /**< Invalid parameter */
+} pdb_status_t;
+
+/**
+ * @brief Trigger input
+ */
+typedef enum {
+    PDB_TRIGGER_INPUT   = 0U,       /**< TRGMUX output to this PDB */
+    PDB_TRIGGER_SOFTWARE = 15U      /**< PDB_SoftwareTrigger() */
+} pdb_trigger_t;
+
+/**
+ * @brief Counter clock multiplication factor (divides the clock)
+ */
+typedef enum {
+    PDB_MULT_1 = 0U,
+    PDB_MULT_10,
+    PDB_MULT_20,
+    PDB_MULT_40
+} pdb_mult_t;
+
+/**
+ * @brief When buffered MOD/IDLY/DLY values take effect after LDOK
+ */
+typedef enum {
+    PDB_LOAD_IMMEDIATE = 0U,
+    PDB_LOAD_AT_MODULO,             /**< When the counter reaches MOD */
+    PDB_LOAD_AT_TRIGGER,            /**< On the next trigger */
+    PDB_LOAD_AT_MODULO_OR_TRIGGER
+} pdb_load_mode_t;
+
+/**
+ * @brief Module configuration
+ */
+typedef struct {
+    pdb_trigger_t trigger;          /**< Trigger input */
+    bool continuous;                /**< Restart at MOD without a new trigger */
+    uint8_t prescaler;              /**< Clock divided by 2^prescaler (0-7) */
+    pdb_mult_t mult;                /**< Additional divider */
+    pdb_load_mode_t load_mode;      /**< Buffered register update */
+} pdb_config_t;
+
+/**
+ * @brief Event callback
+ * @param instance PDB base
+ * @param flags PDB_EVENT_x
+ * @param userData Parameter given at registration
+ */
+typedef void (*pdb_callback_t)(PDB_Type *instance, uint32_t flags, void *userData);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Get instance index
+ * @param base PDB base
+ * @return uint8_t Index, PDB_INSTANCE_COUNT if unknown
+ */
+uint8_t PDB_GetInstance(PDB_Type *base);
+
+/**
+ * @brief Enable and configure the module
+ * @details All pre-triggers disabled, MOD at its maximum. The clock must
+ *          be enabled through the PCC.
+ * @param base PDB base
+ * @param config Configuration
+ * @return pdb_status_t Status of operation
+ */
+pdb_status_t PDB_Init(PDB_Type *base, const pdb_config_t *config);
+
+/**
+ * @brief Disable the module and every pre-trigger
+ * @param base PDB base
+ */
+void PDB_Deinit(PDB_Type *base);
+
+/**
+ * @brief Set the counter period (buffered)
+ * @param base PDB base
+ * @param modulus Counter counts 0..modulus
+ */
+void PDB_SetModulus(PDB_Type *base, uint16_t modulus);
+
+/**
+ * @brief Set the interrupt delay (buffered)
+ * @param base PDB base
+ * @param delay Count at which PDB_EVENT_DELAY fires
+ */
+void PDB_SetInterruptDelay(PDB_Type *base, uint16_t delay);
+
+/**
+ * @brief Configure one ADC pre-trigger
+ * @param base PDB base
+ * @param channel PDB channel (0-1)
+ * @param pretrigger Pre-trigger (0-7)
+ * @param enable Assert this pre-trigger
+ * @param backToBack Fire when the previous pre-trigger's conversion
+ *        completes instead of at delay (ignored for pre-trigger 0)
+ * @param delay Count at which the pre-trigger fires (buffered)
+ * @return pdb_status_t Status of operation
+ */
+pdb_status_t PDB_ConfigPreTrigger(PDB_Type *base, uint8_t channel, uint8_t pretrigger,
+                                  bool enable, bool backToBack, uint16_t delay);
+
+/**
+ * @brief Latch buffered MOD/IDLY/DLY values (LDOK)
+ * @param base PDB base
+ */
+void PDB_LoadValues(PDB_Type *base);
+
+/**
+ * @brief Start the counter (trigger = PDB_TRIGGER_SOFTWARE)
+ * @param base PDB base
+ */
+static inline void PDB_SoftwareTrigger(PDB_Type *base)
+{
+    base->SC |= PDB_SC_SWTRIG_MASK;
+}
+
+/**
+ * @brief Get sequence error flags of a channel
+ * @param base PDB base
+ * @param channel PDB channel (0-1)
+ * @return uint32_t One bit per pre-trigger
+ */
+static inline uint32_t PDB_GetSequenceErrors(PDB_Type *base, uint8_t channel)
+{
+    return (base->CH[channel].S & PDB_S_ERR_MASK) >> PDB_S_ERR_SHIFT;
+}
+
+/**
+ * @brief Clear sequence error flags (write 1)
+ * @param base PDB base
+ * @param channel PDB channel (0-1)
+ * @param mask One bit per pre-trigger
+ */
+static inline void PDB_ClearSequenceErrors(PDB_Type *base, uint8_t channel, uint32_t mask)
+{
+    base->CH[channel].S = (mask << PDB_S_ERR_SHIFT) & PDB_S_ERR_MASK;
+}
+
+/**
+ * @brief Enable or disable the delay and sequence error interrupts
+ * @param base PDB base
+ * @param delay PDB_EVENT_DELAY interrupt
+ * @param sequenceError PDB_EVENT_SEQUENCE_ERROR interrupt
+ */
+void PDB_EnableInterrupts(PDB_Type *base, bool delay, bool sequenceError);
+
+/**
+ * @brief Register event callback
+ * @param base PDB base
+ * @param callback Callback, NULL to remove
+ * @param userData Passed to the callback
+ * @return pdb_status_t Status of registration
+ */
+pdb_status_t PDB_RegisterCallback(PDB_Type *base, pdb_callback_t callback, void *userData);
+
+/**
+ * @brief PDB interrupt handler - should be called from ISR
+ * @param base PDB base
+ */
+void PDB_IRQHandler(PDB_Type *base);
+
+#endif /* PDB_H */
@@ -0,0 +1,22 @@
+/**
+ * @file    pdb_irq.c
+ * @brief   PDB Interrupt Service Routine Implementation
+ * @details Implements PDB ISRs and forwards to driver layer handler
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "pdb_irq.h"
+
+/*******************************************************************************
+ * ISR Implementation
+ ******************************************************************************/
+
+/* Forward to driver layer handler */
+void PDB0_IRQHandler(void) { PDB_IRQHandler(PDB0); }
+void PDB1_IRQHandler(void) { PDB_IRQHandler(PDB1); }
@@ -0,0 +1,38 @@
+/**
+ * @file    pdb_irq.h
+ * @brief   PDB Interrupt Handler Declarations
+ * @details Provides ISR declarations for PDB interrupts following CMSIS naming convention
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef PDB_IRQ_H
+#define PDB_IRQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "pdb.h"
+
+/*******************************************************************************
+ * ISR Declarations
+ ******************************************************************************/
+
+/**
+ * @brief PDB0-1 interrupt service routines
+ * @note These functions should be defined in the startup vector table
+ */
+void PDB0_IRQHandler(void);
+void PDB1_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PDB_IRQ_H */
@@ -0,0 +1,98 @@
+/*
+ * @file    pdb_reg.h
+ * @brief   PDB Register Definitions for S32K144
+ */
+
+#ifndef PDB_REG_H_
+#define PDB_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- PDB Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/** PDB - Size of Registers Arrays */
+#define PDB_CH_COUNT                             2u
+#define PDB_DLY_COUNT                            8u
+#define PDB_PODLY_COUNT                          1u
+
+/** PDB - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t SC;                                /**< Status and Control register, offset: 0x0 */
+  __IO uint32_t MOD;                               /**< Modulus register, offset: 0x4 */
+  __I  uint32_t CNT;                               /**< Counter register, offset: 0x8 */
+  __IO uint32_t IDLY;                              /**< Interrupt Delay register, offset: 0xC */
+  struct {                                         /* offset: 0x10, array step: 0x28 */
+    __IO uint32_t C1;                              /**< Channel n Control register 1, array offset: 0x10, array step: 0x28 */
+    __IO uint32_t S;                               /**< Channel n Status register, array offset: 0x14, array step: 0x28 */
+    __IO uint32_t DLY[PDB_DLY_COUNT];              /**< Channel n Delay m register, array offset: 0x18, array step: index*0x28, index2*0x4 */
+  } CH[PDB_CH_COUNT];
+  uint8_t RESERVED_0[304];
+  __IO uint32_t POEN;                              /**< Pulse-Out n Enable register, offset: 0x190 */
+  __IO uint32_t PODLY[PDB_PODLY_COUNT];            /**< Pulse-Out n Delay register, offset: 0x194 */
+} PDB_Type, *PDB_MemMapPtr;
+
+/** Number of instances of the PDB module. */
+#define PDB_INSTANCE_COUNT                       (2u)
+
+/* PDB - Peripheral instance base addresses */
+#define PDB0_BASE                                (0x40036000u)
+#define PDB0                                     ((PDB_Type *)PDB0_BASE)
+#define PDB1_BASE                                (0x40031000u)
+#define PDB1                                     ((PDB_Type *)PDB1_BASE)
+
+/* ----------------------------------------------------------------------------
+   -- PDB Register Masks
+   ---------------------------------------------------------------------------- */
+
+/* SC Bit Fields */
+#define PDB_SC_LDOK_MASK                         0x1u
+#define PDB_SC_CONT_MASK                         0x2u
+#define PDB_SC_MULT_MASK                         0xCu
+#define PDB_SC_MULT_SHIFT                        2u
+#define PDB_SC_MULT(x)                           (((uint32_t)(((uint32_t)(x))<<PDB_SC_MULT_SHIFT))&PDB_SC_MULT_MASK)
+#define PDB_SC_PDBIE_MASK                        0x20u
+#define PDB_SC_PDBIF_MASK                        0x40u
+#define PDB_SC_PDBEN_MASK                        0x80u
+#define PDB_SC_TRGSEL_MASK                       0xF00u
+#define PDB_SC_TRGSEL_SHIFT                      8u
+#define PDB_SC_TRGSEL(x)                         (((uint32_t)(((uint32_t)(x))<<PDB_SC_TRGSEL_SHIFT))&PDB_SC_TRGSEL_MASK)
+#define PDB_SC_PRESCALER_MASK                    0x7000u
+#define PDB_SC_PRESCALER_SHIFT                   12u
+#define PDB_SC_PRESCALER(x)                      (((uint32_t)(((uint32_t)(x))<<PDB_SC_PRESCALER_SHIFT))&PDB_SC_PRESCALER_MASK)
+#define PDB_SC_DMAEN_MASK                        0x8000u
+#define PDB_SC_SWTRIG_MASK                       0x10000u
+#define PDB_SC_PDBEIE_MASK                       0x20000u
+#define PDB_SC_LDMOD_MASK                        0xC0000u
+#define PDB_SC_LDMOD_SHIFT                       18u
+#define PDB_SC_LDMOD(x)                          (((uint32_t)(((uint32_t)(x))<<PDB_SC_LDMOD_SHIFT))&PDB_SC_LDMOD_MASK)
+
+/* MOD / CNT / IDLY / DLY Bit Fields */
+#define PDB_MOD_MOD_MASK                         0xFFFFu
+#define PDB_CNT_CNT_MASK                         0xFFFFu
+#define PDB_IDLY_IDLY_MASK                       0xFFFFu
+#define PDB_DLY_DLY_MASK                         0xFFFFu
+
+/* C1 Bit Fields (one bit per pre-trigger) */
+#define PDB_C1_EN_MASK                           0xFFu
+#define PDB_C1_EN_SHIFT                          0u
+#define PDB_C1_TOS_MASK                          0xFF00u
+#define PDB_C1_TOS_SHIFT                         8u
+#define PDB_C1_BB_MASK                           0xFF0000u
+#define PDB_C1_BB_SHIFT                          16u
+
+/* S Bit Fields */
+#define PDB_S_ERR_MASK                           0xFFu
+#define PDB_S_ERR_SHIFT                          0u
+#define PDB_S_CF_MASK                            0xFF0000u
+#define PDB_S_CF_SHIFT                           16u
+
+#endif /* PDB_REG_H_ */
@@ -28,6 +28,7 @@ port_status_t PORT_InterruptCheck(PORT_Type *port, port_pin_t pin) {
     }
 }
 port_status_t PORT_InterruptClear(PORT_Type *port, port_pin_t pin) {
-    port->ISFR |= (1U << pin);
+    /* W1C: a read-modify-write would clear every other pending flag */
+    port->ISFR = (1U << pin);
     return PORT_STATUS_SUCCESS;
 }
\ No newline at end of file
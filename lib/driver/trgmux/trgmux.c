@@ -0,0 +1,107 @@
+/**
+ * @file    trgmux.c
+ * @brief   TRGMUX Driver Implementation for S32K144
+ * @details Selector, lock and ADC trigger path access
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "trgmux.h"
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+trgmux_status_t TRGMUX_SetSource(trgmux_target_t target, trgmux_source_t source)
+{
+    uint8_t index = TRGMUX_TARGET_INDEX(target);
+    uint32_t shift = TRGMUX_TRGMUXn_SEL_SHIFT(TRGMUX_TARGET_SEL(target));
+    uint32_t reg;
+
+    if (index >= TRGMUX_TRGMUXn_COUNT || (uint32_t)source > TRGMUX_TRGMUXn_SEL_MASK) {
+        return TRGMUX_STATUS_INVALID_PARAM;
+    }
+
+    reg = TRGMUX->TRGMUXn[index];
+    if ((reg & TRGMUX_TRGMUXn_LK_MASK) != 0U) {
+        return TRGMUX_STATUS_LOCKED;
+    }
+
+    reg &= ~(TRGMUX_TRGMUXn_SEL_MASK << shift);
+    reg |= ((uint32_t)source & TRGMUX_TRGMUXn_SEL_MASK) << shift;
+    TRGMUX->TRGMUXn[index] = reg;
+
+    return TRGMUX_STATUS_SUCCESS;
+}
+
+trgmux_source_t TRGMUX_GetSource(trgmux_target_t target)
+{
+    uint8_t index = TRGMUX_TARGET_INDEX(target);
+    uint32_t shift = TRGMUX_TRGMUXn_SEL_SHIFT(TRGMUX_TARGET_SEL(target));
+
+    if (index >= TRGMUX_TRGMUXn_COUNT) {
+        return TRGMUX_SOURCE_DISABLED;
+    }
+
+    return (trgmux_source_t)((TRGMUX->TRGMUXn[index] >> shift) & TRGMUX_TRGMUXn_SEL_MASK);
+}
+
+trgmux_status_t TRGMUX_Lock(trgmux_target_t target)
+{
+    uint8_t index = TRGMUX_TARGET_INDEX(target);
+
+    if (index >= TRGMUX_TRGMUXn_COUNT) {
+        return TRGMUX_STATUS_INVALID_PARAM;
+    }
+
+    TRGMUX->TRGMUXn[index] |= TRGMUX_TRGMUXn_LK_MASK;
+
+    return TRGMUX_STATUS_SUCCESS;
+}
+
+bool TRGMUX_IsLocked(trgmux_target_t target)
+{
+    uint8_t index = TRGMUX_TARGET_INDEX(target);
+
+    if (index >= TRGMUX_TRGMUXn_COUNT) {
+        return false;
+    }
+
+    return (TRGMUX->TRGMUXn[index] & TRGMUX_TRGMUXn_LK_MASK) != 0U;
+}
+
+trgmux_status_t TRGMUX_SetAdcTriggerPath(uint8_t adc, trgmux_adc_trigger_t path)
+{
+    uint32_t shift = SIM_ADCOPT_ADC_SHIFT(adc);
+    uint32_t pretrgsel;
+    uint32_t adcopt;
+
+    if (adc > 1U) {
+        return TRGMUX_STATUS_INVALID_PARAM;
+    }
+
+    pretrgsel = (path == TRGMUX_ADC_TRIGGER_TRGMUX) ? SIM_ADCOPT_PRETRGSEL_TRGMUX : SIM_ADCOPT_PRETRGSEL_PDB;
+
+    adcopt = SIM_ADCOPT;
+    adcopt &= ~((SIM_ADCOPT_TRGSEL_MASK | SIM_ADCOPT_SWPRETRG_MASK | SIM_ADCOPT_PRETRGSEL_MASK) << shift);
+    adcopt |= (((path == TRGMUX_ADC_TRIGGER_TRGMUX) ? SIM_ADCOPT_TRGSEL_MASK : 0U) |
+               (pretrgsel << SIM_ADCOPT_PRETRGSEL_SHIFT)) << shift;
+    SIM_ADCOPT = adcopt;
+
+    return TRGMUX_STATUS_SUCCESS;
+}
+
+trgmux_adc_trigger_t TRGMUX_GetAdcTriggerPath(uint8_t adc)
+{
+    if (adc > 1U) {
+        return TRGMUX_ADC_TRIGGER_PDB;
+    }
+
+    return ((SIM_ADCOPT >> SIM_ADCOPT_ADC_SHIFT(adc)) & SIM_ADCOPT_TRGSEL_MASK) != 0U ?
+           TRGMUX_ADC_TRIGGER_TRGMUX : TRGMUX_ADC_TRIGGER_PDB;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file    trgmux.h
+ * @brief   TRGMUX Driver API for S32K144
+ * @details Trigger multiplexer: connects peripheral trigger outputs
+ *          (LPIT, FTM, PDB, CMP, ADC COCO, ...) to peripheral trigger
+ *          inputs (ADC, PDB, DMAMUX, LPUART, LPSPI, ...) in hardware.
+ *
+ * Features:
+ * - One source per target, any source may feed several targets
+ * - Per-register lock (LK) until the next reset
+ * - ADC hardware trigger path selection (PDB or TRGMUX) in SIM_ADCOPT
+ *
+ * A target is encoded as (TRGMUXn register index << 2) | selector, so
+ * the enum values match the reference manual's target module numbering.
+ * The module is always clocked, there is no PCC gate.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef TRGMUX_H
+#define TRGMUX_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "trgmux_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Target encoding helpers */
+#define TRGMUX_TARGET(index, sel)       ((uint8_t)(((index) << 2) | (sel)))
+#define TRGMUX_TARGET_INDEX(target)     ((uint8_t)(target) >> 2)
+#define TRGMUX_TARGET_SEL(target)       ((uint8_t)(target) & 3U)
+
+/**
+ * @brief TRGMUX driver status codes
+ */
+typedef enum {
+    TRGMUX_STATUS_SUCCESS = 0,      /**< Operation successful */
+    TRGMUX_STATUS_ERROR,            /**< General error */
+    TRGMUX_STATUS_INVALID_PARAM,    /**< Invalid target or source */
+    TRGMUX_STATUS_LOCKED            /**< Register locked until reset */
+} trgmux_status_t;
+
+/**
+ * @brief Trigger sources (trigger outputs of other modules)
+ */
+typedef enum {
+    TRGMUX_SOURCE_DISABLED          = 0U,
+    TRGMUX_SOURCE_VDD               = 1U,
+    TRGMUX_SOURCE_TRGMUX_IN0        = 2U,
+    TRGMUX_SOURCE_TRGMUX_IN1        = 3U,
+    TRGMUX_SOURCE_TRGMUX_IN2        = 4U,
+    TRGMUX_SOURCE_TRGMUX_IN3        = 5U,
+    TRGMUX_SOURCE_TRGMUX_IN4        = 6U,
+    TRGMUX_SOURCE_TRGMUX_IN5        = 7U,
+    TRGMUX_SOURCE_TRGMUX_IN6        = 8U,
+    TRGMUX_SOURCE_TRGMUX_IN7        = 9U,
+    TRGMUX_SOURCE_TRGMUX_IN8        = 10U,
+    TRGMUX_SOURCE_TRGMUX_IN9        = 11U,
+    TRGMUX_SOURCE_TRGMUX_IN10       = 12U,
+    TRGMUX_SOURCE_TRGMUX_IN11       = 13U,
+    TRGMUX_SOURCE_CMP0_OUT          = 14U,
+    TRGMUX_SOURCE_LPIT_CH0          = 17U,
+    TRGMUX_SOURCE_LPIT_CH1          = 18U,
+    TRGMUX_SOURCE_LPIT_CH2          = 19U,
+    TRGMUX_SOURCE_LPIT_CH3          = 20U,
+    TRGMUX_SOURCE_LPTMR0            = 21U,
+    TRGMUX_SOURCE_FTM0_INIT         = 22U,
+    TRGMUX_SOURCE_FTM0_EXT          = 23U,
+    TRGMUX_SOURCE_FTM1_INIT         = 24U,
+    TRGMUX_SOURCE_FTM1_EXT          = 25U,
+    TRGMUX_SOURCE_FTM2_INIT         = 26U,
+    TRGMUX_SOURCE_FTM2_EXT          = 27U,
+    TRGMUX_SOURCE_FTM3_INIT         = 28U,
+    TRGMUX_SOURCE_FTM3_EXT          = 29U,
+    TRGMUX_SOURCE_ADC0_SC1A_COCO    = 30U,
+    TRGMUX_SOURCE_ADC0_SC1B_COCO    = 31U,
+    TRGMUX_SOURCE_ADC1_SC1A_COCO    = 32U,
+    TRGMUX_SOURCE_ADC1_SC1B_COCO    = 33U,
+    TRGMUX_SOURCE_PDB0_CH0_TRIG     = 34U,
+    TRGMUX_SOURCE_PDB0_PULSE_OUT    = 36U,
+    TRGMUX_SOURCE_PDB1_CH0_TRIG     = 37U,
+    TRGMUX_SOURCE_PDB1_PULSE_OUT    = 39U,
+    TRGMUX_SOURCE_RTC_ALARM         = 43U,
+    TRGMUX_SOURCE_RTC_SECOND        = 44U,
+    TRGMUX_SOURCE_FLEXIO_TRIG0      = 45U,
+    TRGMUX_SOURCE_FLEXIO_TRIG1      = 46U,
+    TRGMUX_SOURCE_FLEXIO_TRIG2      = 47U,
+    TRGMUX_SOURCE_FLEXIO_TRIG3      = 48U,
+    TRGMUX_SOURCE_LPUART0_RX_DATA   = 49U,
+    TRGMUX_SOURCE_LPUART0_TX_DATA   = 50U,
+    TRGMUX_SOURCE_LPUART0_RX_IDLE   = 51U,
+    TRGMUX_SOURCE_LPUART1_RX_DATA   = 52U,
+    TRGMUX_SOURCE_LPUART1_TX_DATA   = 53U,
+    TRGMUX_SOURCE_LPUART1_RX_IDLE   = 54U,
+    TRGMUX_SOURCE_LPI2C0_MASTER     = 55U,
+    TRGMUX_SOURCE_LPI2C0_SLAVE      = 56U,
+    TRGMUX_SOURCE_LPSPI0_FRAME      = 59U,
+    TRGMUX_SOURCE_LPSPI0_RX_DATA    = 60U,
+    TRGMUX_SOURCE_LPSPI1_FRAME      = 61U,
+    TRGMUX_SOURCE_LPSPI1_RX_DATA    = 62U,
+    TRGMUX_SOURCE_SIM_SW_TRIG       = 63U
+} trgmux_source_t;
+
+/** @brief Number of source selector values */
+#define TRGMUX_SOURCE_COUNT             (64U)
+
+/**
+ * @brief Trigger targets (trigger inputs of other modules)
+ */
+typedef enum {
+    TRGMUX_TARGET_DMA_CH0           = TRGMUX_TARGET(TRGMUX_DMAMUX0_INDEX, 0),  /**< DMAMUX periodic trigger */
+    TRGMUX_TARGET_DMA_CH1           = TRGMUX_TARGET(TRGMUX_DMAMUX0_INDEX, 1),
+    TRGMUX_TARGET_DMA_CH2           = TRGMUX_TARGET(TRGMUX_DMAMUX0_INDEX, 2),
+    TRGMUX_TARGET_DMA_CH3           = TRGMUX_TARGET(TRGMUX_DMAMUX0_INDEX, 3),
+    TRGMUX_TARGET_TRGMUX_OUT0       = TRGMUX_TARGET(TRGMUX_EXTOUT0_INDEX, 0),
+    TRGMUX_TARGET_TRGMUX_OUT1       = TRGMUX_TARGET(TRGMUX_EXTOUT0_INDEX, 1),
+    TRGMUX_TARGET_TRGMUX_OUT2       = TRGMUX_TARGET(TRGMUX_EXTOUT0_INDEX, 2),
+    TRGMUX_TARGET_TRGMUX_OUT3       = TRGMUX_TARGET(TRGMUX_EXTOUT0_INDEX, 3),
+    TRGMUX_TARGET_TRGMUX_OUT4       = TRGMUX_TARGET(TRGMUX_EXTOUT1_INDEX, 0),
+    TRGMUX_TARGET_TRGMUX_OUT5       = TRGMUX_TARGET(TRGMUX_EXTOUT1_INDEX, 1),
+    TRGMUX_TARGET_TRGMUX_OUT6       = TRGMUX_TARGET(TRGMUX_EXTOUT1_INDEX, 2),
+    TRGMUX_TARGET_TRGMUX_OUT7       = TRGMUX_TARGET(TRGMUX_EXTOUT1_INDEX, 3),
+    TRGMUX_TARGET_ADC0_ADHWT_TLA0   = TRGMUX_TARGET(TRGMUX_ADC0_INDEX, 0),     /**< ADC0 pre-trigger 0 */
+    TRGMUX_TARGET_ADC0_ADHWT_TLA1   = TRGMUX_TARGET(TRGMUX_ADC0_INDEX, 1),
+    TRGMUX_TARGET_ADC0_ADHWT_TLA2   = TRGMUX_TARGET(TRGMUX_ADC0_INDEX, 2),
+    TRGMUX_TARGET_ADC0_ADHWT_TLA3   = TRGMUX_TARGET(TRGMUX_ADC0_INDEX, 3),
+    TRGMUX_TARGET_ADC1_ADHWT_TLA0   = TRGMUX_TARGET(TRGMUX_ADC1_INDEX, 0),
+    TRGMUX_TARGET_ADC1_ADHWT_TLA1   = TRGMUX_TARGET(TRGMUX_ADC1_INDEX, 1),
+    TRGMUX_TARGET_ADC1_ADHWT_TLA2   = TRGMUX_TARGET(TRGMUX_ADC1_INDEX, 2),
+    TRGMUX_TARGET_ADC1_ADHWT_TLA3   = TRGMUX_TARGET(TRGMUX_ADC1_INDEX, 3),
+    TRGMUX_TARGET_CMP0_SAMPLE       = TRGMUX_TARGET(TRGMUX_CMP0_INDEX, 0),
+    TRGMUX_TARGET_FTM0_HWTRIG0      = TRGMUX_TARGET(TRGMUX_FTM0_INDEX, 0),
+    TRGMUX_TARGET_FTM0_FAULT0       = TRGMUX_TARGET(TRGMUX_FTM0_INDEX, 1),
+    TRGMUX_TARGET_FTM0_FAULT1       = TRGMUX_TARGET(TRGMUX_FTM0_INDEX, 2),
+    TRGMUX_TARGET_FTM0_FAULT2       = TRGMUX_TARGET(TRGMUX_FTM0_INDEX, 3),
+    TRGMUX_TARGET_FTM1_HWTRIG0      = TRGMUX_TARGET(TRGMUX_FTM1_INDEX, 0),
+    TRGMUX_TARGET_FTM1_FAULT0       = TRGMUX_TARGET(TRGMUX_FTM1_INDEX, 1),
+    TRGMUX_TARGET_FTM1_FAULT1       = TRGMUX_TARGET(TRGMUX_FTM1_INDEX, 2),
+    TRGMUX_TARGET_FTM1_FAULT2       = TRGMUX_TARGET(TRGMUX_FTM1_INDEX, 3),
+    TRGMUX_TARGET_FTM2_HWTRIG0      = TRGMUX_TARGET(TRGMUX_FTM2_INDEX, 0),
+    TRGMUX_TARGET_FTM2_FAULT0       = TRGMUX_TARGET(TRGMUX_FTM2_INDEX, 1),
+    TRGMUX_TARGET_FTM2_FAULT1       = TRGMUX_TARGET(TRGMUX_FTM2_INDEX, 2),
+    TRGMUX_TARGET_FTM2_FAULT2       = TRGMUX_TARGET(TRGMUX_FTM2_INDEX, 3),
+    TRGMUX_TARGET_FTM3_HWTRIG0      = TRGMUX_TARGET(TRGMUX_FTM3_INDEX, 0),
+    TRGMUX_TARGET_FTM3_FAULT0       = TRGMUX_TARGET(TRGMUX_FTM3_INDEX, 1),
+    TRGMUX_TARGET_FTM3_FAULT1       = TRGMUX_TARGET(TRGMUX_FTM3_INDEX, 2),
+    TRGMUX_TARGET_FTM3_FAULT2       = TRGMUX_TARGET(TRGMUX_FTM3_INDEX, 3),
+    TRGMUX_TARGET_PDB0_TRG_IN       = TRGMUX_TARGET(TRGMUX_PDB0_INDEX, 0),     /**< PDB0 trigger input 0 */
+    TRGMUX_TARGET_PDB1_TRG_IN       = TRGMUX_TARGET(TRGMUX_PDB1_INDEX, 0),
+    TRGMUX_TARGET_FLEXIO_TRG_TIM0   = TRGMUX_TARGET(TRGMUX_FLEXIO_INDEX, 0),
+    TRGMUX_TARGET_FLEXIO_TRG_TIM1   = TRGMUX_TARGET(TRGMUX_FLEXIO_INDEX, 1),
+    TRGMUX_TARGET_FLEXIO_TRG_TIM2   = TRGMUX_TARGET(TRGMUX_FLEXIO_INDEX, 2),
+    TRGMUX_TARGET_FLEXIO_TRG_TIM3   = TRGMUX_TARGET(TRGMUX_FLEXIO_INDEX, 3),
+    TRGMUX_TARGET_LPIT_TRG_CH0      = TRGMUX_TARGET(TRGMUX_LPIT0_INDEX, 0),
+    TRGMUX_TARGET_LPIT_TRG_CH1      = TRGMUX_TARGET(TRGMUX_LPIT0_INDEX, 1),
+    TRGMUX_TARGET_LPIT_TRG_CH2      = TRGMUX_TARGET(TRGMUX_LPIT0_INDEX, 2),
+    TRGMUX_TARGET_LPIT_TRG_CH3      = TRGMUX_TARGET(TRGMUX_LPIT0_INDEX, 3),
+    TRGMUX_TARGET_LPUART0_TRG       = TRGMUX_TARGET(TRGMUX_LPUART0_INDEX, 0),
+    TRGMUX_TARGET_LPUART1_TRG       = TRGMUX_TARGET(TRGMUX_LPUART1_INDEX, 0),
+    TRGMUX_TARGET_LPI2C0_TRG        = TRGMUX_TARGET(TRGMUX_LPI2C0_INDEX, 0),
+    TRGMUX_TARGET_LPSPI0_TRG        = TRGMUX_TARGET(TRGMUX_LPSPI0_INDEX, 0),
+    TRGMUX_TARGET_LPSPI1_TRG        = TRGMUX_TARGET(TRGMUX_LPSPI1_INDEX, 0),
+    TRGMUX_TARGET_LPTMR0_ALT0       = TRGMUX_TARGET(TRGMUX_LPTMR0_INDEX, 0)
+} trgmux_target_t;
+
+/**
+ * @brief ADC hardware trigger path
+ */
+typedef enum {
+    TRGMUX_ADC_TRIGGER_PDB = 0U,    /**< Reset default: PDB pre-triggers */
+    TRGMUX_ADC_TRIGGER_TRGMUX       /**< ADCx_ADHWT_TLA0..3 targets */
+} trgmux_adc_trigger_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Connect a source to a target
+ * @details Read-modify-write of the target's TRGMUXn register; the other
+ *          three selectors of that register are preserved.
+ * @param target Trigger input
+ * @param source Trigger output, TRGMUX_SOURCE_DISABLED to disconnect
+ * @return trgmux_status_t Status of operation
+ */
+trgmux_status_t TRGMUX_SetSource(trgmux_target_t target, trgmux_source_t source);
+
+/**
+ * @brief Read back the source driving a target
+ * @param target Trigger input
+ * @return trgmux_source_t Current source
+ */
+trgmux_source_t TRGMUX_GetSource(trgmux_target_t target);
+
+/**
+ * @brief Lock the register holding a target until the next reset
+ * @details Locks all four selectors of that register.
+ * @param target Trigger input
+ * @return trgmux_status_t Status of operation
+ */
+trgmux_status_t TRGMUX_Lock(trgmux_target_t target);
+
+/**
+ * @brief Check the lock of the register holding a target
+ * @param target Trigger input
+ * @return true if the register is locked
+ */
+bool TRGMUX_IsLocked(trgmux_target_t target);
+
+/**
+ * @brief Select where an ADC takes its hardware trigger from
+ * @details With TRGMUX_ADC_TRIGGER_TRGMUX, both the trigger and the
+ *          pre-trigger selection (SIM_ADCOPT) come from TRGMUX.
+ * @param adc ADC instance (0-1)
+ * @param path Trigger path
+ * @return trgmux_status_t Status of operation
+ */
+trgmux_status_t TRGMUX_SetAdcTriggerPath(uint8_t adc, trgmux_adc_trigger_t path);
+
+/**
+ * @brief Get the hardware trigger path of an ADC
+ * @param adc ADC instance (0-1)
+ * @return trgmux_adc_trigger_t Current path
+ */
+trgmux_adc_trigger_t TRGMUX_GetAdcTriggerPath(uint8_t adc);
+
+#endif /* TRGMUX_H */
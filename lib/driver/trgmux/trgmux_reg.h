@@ -0,0 +1,85 @@
+/*
+ * @file    trgmux_reg.h
+ * @brief   TRGMUX (Trigger Multiplexing Control) Register Definitions for S32K144
+ */
+
+#ifndef TRGMUX_REG_H_
+#define TRGMUX_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- TRGMUX Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/** TRGMUX - Size of Registers Arrays */
+#define TRGMUX_TRGMUXn_COUNT                     26u
+
+/** TRGMUX - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t TRGMUXn[TRGMUX_TRGMUXn_COUNT];     /**< TRGMUX DMAMUX0 Register..TRGMUX LPTMR0 Register, array offset: 0x0, array step: 0x4 */
+} TRGMUX_Type, *TRGMUX_MemMapPtr;
+
+/** Number of instances of the TRGMUX module. */
+#define TRGMUX_INSTANCE_COUNT                    (1u)
+
+/* TRGMUX - Peripheral instance base addresses */
+#define TRGMUX_BASE                              (0x40063000u)
+#define TRGMUX                                   ((TRGMUX_Type *)TRGMUX_BASE)
+
+/* TRGMUXn register index of each trigger input (target module) */
+#define TRGMUX_DMAMUX0_INDEX                     0u
+#define TRGMUX_EXTOUT0_INDEX                     1u
+#define TRGMUX_EXTOUT1_INDEX                     2u
+#define TRGMUX_ADC0_INDEX                        3u
+#define TRGMUX_ADC1_INDEX                        4u
+#define TRGMUX_CMP0_INDEX                        7u
+#define TRGMUX_FTM0_INDEX                        10u
+#define TRGMUX_FTM1_INDEX                        11u
+#define TRGMUX_FTM2_INDEX                        12u
+#define TRGMUX_FTM3_INDEX                        13u
+#define TRGMUX_PDB0_INDEX                        14u
+#define TRGMUX_PDB1_INDEX                        15u
+#define TRGMUX_FLEXIO_INDEX                      17u
+#define TRGMUX_LPIT0_INDEX                       18u
+#define TRGMUX_LPUART0_INDEX                     19u
+#define TRGMUX_LPUART1_INDEX                     20u
+#define TRGMUX_LPI2C0_INDEX                      21u
+#define TRGMUX_LPSPI0_INDEX                      23u
+#define TRGMUX_LPSPI1_INDEX                      24u
+#define TRGMUX_LPTMR0_INDEX                      25u
+
+/* ----------------------------------------------------------------------------
+   -- TRGMUX Register Masks
+   ---------------------------------------------------------------------------- */
+
+/* TRGMUXn Bit Fields: four 6-bit selectors, one byte apart */
+#define TRGMUX_TRGMUXn_SEL_MASK                  0x3Fu
+#define TRGMUX_TRGMUXn_SEL_SHIFT(n)              ((uint32_t)(n) * 8u)
+#define TRGMUX_TRGMUXn_SEL_COUNT                 4u
+#define TRGMUX_TRGMUXn_LK_MASK                   0x80000000u
+
+/* ----------------------------------------------------------------------------
+   -- SIM ADC Options (ADC hardware trigger source)
+   ---------------------------------------------------------------------------- */
+
+#define SIM_ADCOPT_ADDR                          (0x40048018u)
+#define SIM_ADCOPT                               (*(__IO uint32_t *)SIM_ADCOPT_ADDR)
+
+/* ADCOPT Bit Fields (ADC1 fields are the ADC0 fields shifted by 8) */
+#define SIM_ADCOPT_ADC_SHIFT(adc)                ((uint32_t)(adc) * 8u)
+#define SIM_ADCOPT_TRGSEL_MASK                   0x1u            /* 0: PDB, 1: TRGMUX */
+#define SIM_ADCOPT_SWPRETRG_MASK                 0xEu
+#define SIM_ADCOPT_PRETRGSEL_MASK                0x30u
+#define SIM_ADCOPT_PRETRGSEL_SHIFT               4u
+#define SIM_ADCOPT_PRETRGSEL_PDB                 0u
+#define SIM_ADCOPT_PRETRGSEL_TRGMUX              1u
+
+#endif /* TRGMUX_REG_H_ */
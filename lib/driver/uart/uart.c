@@ -12,6 +12,7 @@
  *                                      INCLUDE FILES
  *================================================================================================*/
 #include "uart.h"
+#include "devassert.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
@@ -85,20 +86,14 @@ uart_status_t UART_Init(const uart_init_config_t *config)
 
 uart_status_t UART_SendString(LPUART_Type *instance, const char *str)
 {
-    if (!g_uart.initialized || (instance == NULL) || (str == NULL))
-    {
-        return UART_STATUS_INVALID_PARAM;
-    }
+    DEV_ASSERT(g_uart.initialized && (instance != NULL) && (str != NULL));
 
     return UART_WriteBlocking(instance, (const uint8_t *)str, (uint16_t)strlen(str));
 }
 
 uart_status_t UART_SendByte(LPUART_Type *instance, uint8_t data)
 {
-    if (!g_uart.initialized || (instance == NULL))
-    {
-        return UART_STATUS_INVALID_PARAM;
-    }
+    DEV_ASSERT(g_uart.initialized && (instance != NULL));
 
     UART_WriteByte(instance, data);
     return UART_STATUS_SUCCESS;
@@ -110,10 +105,7 @@ uart_status_t UART_Printf(LPUART_Type *instance, const char *format, ...)
     va_list args;
     int len;
 
-    if (!g_uart.initialized || (instance == NULL) || (format == NULL))
-    {
-        return UART_STATUS_INVALID_PARAM;
-    }
+    DEV_ASSERT(g_uart.initialized && (instance != NULL) && (format != NULL));
 
     va_start(args, format);
     len = vsnprintf(buffer, sizeof(buffer), format, args);
@@ -134,10 +126,7 @@ uart_status_t UART_SendAdcValue(LPUART_Type *instance, uint16_t adc_value)
 
 uart_status_t UART_ReceiveByte(LPUART_Type *instance, uint8_t *data)
 {
-    if ((instance == NULL) || (data == NULL))
-    {
-        return UART_STATUS_INVALID_PARAM;
-    }
+    DEV_ASSERT((instance != NULL) && (data != NULL));
 
     /* Wait until character is received */
     while ((instance->STAT & LPUART_STAT_RDRF_MASK) == 0U)
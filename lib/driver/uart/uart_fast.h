@@ -0,0 +1,92 @@
+/**
+ * @file    uart_fast.h
+ * @brief   LPUART Instance-Bound Fast Paths
+ * @details Inline byte transmit / receive with the LPUART base fixed at
+ *          build time. UART_FAST_DEFINE(prefix, base) generates
+ *          prefix_FastPutByte(), prefix_FastWrite(), prefix_FastTryGetByte()
+ *          with no instance lookup, init flag or NULL checks; the service
+ *          path (UART_SRV_SendByte -> UART_SendByte -> UART_WriteByte) goes
+ *          through three calls and as many checks per byte.
+ *
+ *          The instance must have been set up with UART_SRV_Init().
+ *          LPUART0-2 are predefined.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef UART_FAST_H
+#define UART_FAST_H
+
+/*==================================================================================================
+ *                                      INCLUDE FILES
+ *================================================================================================*/
+#include "uart.h"
+#include <stdbool.h>
+
+/*==================================================================================================
+ *                                      INLINE FUNCTIONS
+ *================================================================================================*/
+
+/**
+ * @brief Wait for room in the transmit buffer and write one byte
+ */
+static inline __attribute__((always_inline))
+void UART_FastPutByte(LPUART_Type *base, uint8_t data)
+{
+    while ((base->STAT & LPUART_STAT_TDRE_MASK) == 0U)
+    {
+        /* Busy wait */
+    }
+    base->DATA = (uint32_t)data;
+}
+
+/**
+ * @brief Read one byte if one was received
+ * @return false if the receive buffer is empty
+ */
+static inline __attribute__((always_inline))
+bool UART_FastTryGetByte(LPUART_Type *base, uint8_t *data)
+{
+    if ((base->STAT & LPUART_STAT_RDRF_MASK) == 0U)
+    {
+        return false;
+    }
+    *data = (uint8_t)(base->DATA & 0xFFU);
+    return true;
+}
+
+/*==================================================================================================
+ *                                      INSTANCE BINDING
+ *================================================================================================*/
+
+/**
+ * @brief Generate the fast paths of one LPUART
+ * @param prefix Function name prefix
+ * @param base LPUART base (LPUART0, LPUART1, LPUART2)
+ */
+#define UART_FAST_DEFINE(prefix, base)                                                      \
+    static inline __attribute__((always_inline))                                            \
+    void prefix##_FastPutByte(uint8_t data)                                                 \
+    {                                                                                       \
+        UART_FastPutByte((base), data);                                                     \
+    }                                                                                       \
+    static inline void prefix##_FastWrite(const uint8_t *data, uint32_t length)             \
+    {                                                                                       \
+        for (uint32_t i = 0U; i < length; i++)                                              \
+        {                                                                                   \
+            UART_FastPutByte((base), data[i]);                                              \
+        }                                                                                   \
+    }                                                                                       \
+    static inline __attribute__((always_inline))                                            \
+    bool prefix##_FastTryGetByte(uint8_t *data)                                             \
+    {                                                                                       \
+        return UART_FastTryGetByte((base), data);                                           \
+    }
+
+UART_FAST_DEFINE(LPUART0, LPUART0)
+UART_FAST_DEFINE(LPUART1, LPUART1)
+UART_FAST_DEFINE(LPUART2, LPUART2)
+
+#endif /* UART_FAST_H */
@@ -0,0 +1,29 @@
+/**
+ * @file    assert_ultis.c
+ * @brief   Checked Profile Failure Handler
+ * @details Only built into the checked profile (DEV_ERROR_DETECT) when
+ *          CUSTOM_DEVASSERT selects assert_ultis.h.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#include "devassert.h"
+
+#ifdef ASSERT_ULTIS_CHECKED
+
+volatile dev_assert_info_t g_devAssertInfo;
+
+void DEV_AssertFailed(const char *file, uint32_t line)
+{
+    g_devAssertInfo.file = file;
+    g_devAssertInfo.line = line;
+
+    __asm volatile ("bkpt #0");
+
+    for (;;) {
+    }
+}
+
+#endif /* ASSERT_ULTIS_CHECKED */
@@ -0,0 +1,62 @@
+/**
+ * @file    assert_ultis.h
+ * @brief   Checked / Release Argument Validation
+ * @details Project DEV_ASSERT, selected through the SDK hook of
+ *          include/devassert.h: the Debug configurations define
+ *          CUSTOM_DEVASSERT="../lib/driver/ultis/assert_ultis.h" (relative
+ *          to include/), so every file including devassert.h, directly or
+ *          through device_registers.h, gets the same definition.
+ *          - Checked (DEV_ERROR_DETECT defined, Debug configurations):
+ *            DEV_ASSERT(x) records file and line of the failed check in
+ *            g_devAssertInfo, stops at a breakpoint and spins
+ *          - Release (DEV_ERROR_DETECT not defined): DEV_ASSERT(x) is
+ *            empty, the check costs nothing
+ *
+ *          Drivers use DEV_ASSERT for arguments of hot-path calls (send,
+ *          receive, pin and byte I/O): a bad value there is a caller bug,
+ *          not a runtime condition. Configuration-time calls (Init, filter
+ *          and mailbox setup, callback registration) keep their runtime
+ *          checks and error codes in both profiles.
+ *
+ *          Do not include this file directly; include devassert.h.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef ASSERT_ULTIS_H_
+#define ASSERT_ULTIS_H_
+
+#include <stdint.h>
+
+#if defined(DEV_ERROR_DETECT)
+
+#define ASSERT_ULTIS_CHECKED
+
+/**
+ * @brief Location of the last failed check, for the debugger
+ */
+typedef struct {
+    const char *file;               /**< __FILE__ of the check */
+    uint32_t line;                  /**< __LINE__ of the check */
+} dev_assert_info_t;
+
+extern volatile dev_assert_info_t g_devAssertInfo;
+
+/**
+ * @brief Record the location, break and stop
+ * @param file Source file
+ * @param line Source line
+ */
+void DEV_AssertFailed(const char *file, uint32_t line) __attribute__((noreturn));
+
+#define DEV_ASSERT(x)               ((x) ? (void)0 : DEV_AssertFailed(__FILE__, (uint32_t)__LINE__))
+
+#else
+
+#define DEV_ASSERT(x)               ((void)0)
+
+#endif /* DEV_ERROR_DETECT */
+
+#endif /* ASSERT_ULTIS_H_ */
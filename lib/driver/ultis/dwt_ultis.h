@@ -0,0 +1,57 @@
+/**
+ * @file    dwt_ultis.h
+ * @brief   DWT Cycle Counter Helpers
+ * @details Core clock cycle counting for benchmarks (Cortex-M4 DWT).
+ *          The counter wraps after 2^32 cycles (~26 s at 160 MHz);
+ *          differences of two readings stay valid across one wrap.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef DWT_ULTIS_H_
+#define DWT_ULTIS_H_
+
+#include <stdint.h>
+
+/** @brief Debug Exception and Monitor Control, TRCENA enables DWT/ITM */
+#define DWT_ULTIS_DEMCR             (*(volatile uint32_t *)0xE000EDFCU)
+#define DWT_ULTIS_DEMCR_TRCENA      (1UL << 24)
+
+/** @brief DWT control and cycle count */
+#define DWT_ULTIS_CTRL              (*(volatile uint32_t *)0xE0001000U)
+#define DWT_ULTIS_CTRL_CYCCNTENA    (1UL << 0)
+#define DWT_ULTIS_CYCCNT            (*(volatile uint32_t *)0xE0001004U)
+
+/**
+ * @brief Enable and reset the cycle counter
+ */
+static inline void DWT_CycleCounterInit(void)
+{
+    DWT_ULTIS_DEMCR |= DWT_ULTIS_DEMCR_TRCENA;
+    DWT_ULTIS_CYCCNT = 0U;
+    DWT_ULTIS_CTRL |= DWT_ULTIS_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Enable the cycle counter without resetting it
+ * @details For services that only take differences, so a running
+ *          benchmark is not disturbed.
+ */
+static inline void DWT_CycleCounterStart(void)
+{
+    DWT_ULTIS_DEMCR |= DWT_ULTIS_DEMCR_TRCENA;
+    DWT_ULTIS_CTRL |= DWT_ULTIS_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Read the cycle counter
+ * @return uint32_t Core clock cycles since DWT_CycleCounterInit()
+ */
+static inline uint32_t DWT_GetCycles(void)
+{
+    return DWT_ULTIS_CYCCNT;
+}
+
+#endif /* DWT_ULTIS_H_ */
@@ -0,0 +1,51 @@
+/**
+ * @file    mem_ultis.h
+ * @brief   SRAM Placement Helpers
+ * @details The S32K144 SRAM is split in two arrays with separate ports:
+ *          - SRAM_L (0x1FFF8000, 32 KB): reached by the core over the code
+ *            bus, by other masters through the crossbar backdoor
+ *          - SRAM_U (0x20000000, 28 KB): reached by the core over the
+ *            system bus, through the same crossbar port as the eDMA
+ *          A CPU access to an array the eDMA is streaming through waits
+ *          for the crossbar arbitration. Keeping the eDMA in SRAM_U and
+ *          the CPU-critical state in SRAM_L lets both run at full speed.
+ *
+ *          Placement (S32K144_64_flash*.ld):
+ *          - MEM_DMA, MEM_STREAM: SRAM_U, zeroed at startup with .bss
+ *          - MEM_HOT, MEM_QUEUE: SRAM_L, NOLOAD block zeroed at startup
+ *            (no flash image); the objects must not have an initializer
+ *          - Stack: top of SRAM_L; untagged .bss, heap: SRAM_U
+ *          The RAM target links all data in SRAM_U; the macros are then
+ *          accepted but have no effect on contention.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef MEM_ULTIS_H_
+#define MEM_ULTIS_H_
+
+/** @brief Buffer read or written by an eDMA channel (SRAM_U) */
+#define MEM_DMA                     __attribute__((section(".bss.sram_u.dma"), aligned(4)))
+
+/** @brief Large buffer filled or drained in bulk: sample blocks, traces (SRAM_U) */
+#define MEM_STREAM                  __attribute__((section(".bss.sram_u.stream"), aligned(4)))
+
+/** @brief State the CPU touches on every interrupt or inner loop (SRAM_L) */
+#define MEM_HOT                     __attribute__((section(".bss.sram_l.hot")))
+
+/** @brief Lock-free queue between an interrupt and the main loop (SRAM_L) */
+#define MEM_QUEUE                   __attribute__((section(".bss.sram_l.queue")))
+
+/** @brief SRAM_L address range */
+#define MEM_SRAM_L_START            (0x1FFF8000UL)
+#define MEM_SRAM_L_END              (0x20000000UL)
+
+/**
+ * @brief Check at run time where an object landed
+ */
+#define MEM_IS_SRAM_L(ptr)          (((unsigned long)(ptr) >= MEM_SRAM_L_START) && \
+                                     ((unsigned long)(ptr) < MEM_SRAM_L_END))
+
+#endif /* MEM_ULTIS_H_ */
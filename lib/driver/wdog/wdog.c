@@ -0,0 +1,163 @@
+/**
+ * @file    wdog.c
+ * @brief   WDOG Driver Implementation for S32K144
+ * @details Watchdog configuration, unlock sequence and interrupt dispatch
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "wdog.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static wdog_callback_t s_wdog_callback = NULL;
+static void *s_wdog_user_data = NULL;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Mask interrupts, return the previous PRIMASK
+ */
+static inline uint32_t WDOG_EnterCritical(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+    __asm volatile ("cpsid i" : : : "memory");
+
+    return primask;
+}
+
+/**
+ * @brief Restore PRIMASK saved by WDOG_EnterCritical()
+ */
+static inline void WDOG_ExitCritical(uint32_t primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+/**
+ * @brief Unlock, write the configuration and wait until it is active
+ * @details The registers must be written within 128 bus clocks of the
+ *          unlock, so nothing may interrupt the sequence.
+ */
+static void WDOG_WriteConfig(WDOG_Type *base, uint32_t cs, uint16_t timeout, uint16_t window)
+{
+    uint32_t primask = WDOG_EnterCritical();
+
+    base->CNT = WDOG_UNLOCK_KEY;
+    (void)base->CNT;                /* Unlock write completed before the next access */
+    while ((base->CS & WDOG_CS_ULK_MASK) == 0U) {
+        /* Wait for unlock */
+    }
+
+    base->TOVAL = timeout;
+    base->WIN = window;
+    base->CS = cs;
+
+    WDOG_ExitCritical(primask);
+
+    /* Relock, then the new configuration takes effect */
+    while ((base->CS & WDOG_CS_ULK_MASK) != 0U) {
+    }
+    while ((base->CS & WDOG_CS_RCS_MASK) == 0U) {
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+wdog_status_t WDOG_Init(WDOG_Type *base, const wdog_config_t *config)
+{
+    uint32_t cs;
+
+    if (base != WDOG || config == NULL || config->timeout == 0U ||
+        config->window >= config->timeout) {
+        return WDOG_STATUS_INVALID_PARAM;
+    }
+
+    if ((base->CS & WDOG_CS_UPDATE_MASK) == 0U) {
+        return WDOG_STATUS_LOCKED;
+    }
+
+    cs = WDOG_CS_CMD32EN_MASK | WDOG_CS_EN_MASK | WDOG_CS_CLK(config->clock) |
+         WDOG_CS_FLG_MASK;      /* w1c, drop a stale flag */
+
+    if (config->prescaler) {
+        cs |= WDOG_CS_PRES_MASK;
+    }
+    if (config->window != 0U) {
+        cs |= WDOG_CS_WIN_MASK;
+    }
+    if (config->interrupt) {
+        cs |= WDOG_CS_INT_MASK;
+    }
+    if (config->run_in_debug) {
+        cs |= WDOG_CS_DBG_MASK;
+    }
+    if (config->allow_update) {
+        cs |= WDOG_CS_UPDATE_MASK;
+    }
+
+    WDOG_WriteConfig(base, cs, config->timeout, config->window);
+
+    return WDOG_STATUS_SUCCESS;
+}
+
+wdog_status_t WDOG_Disable(WDOG_Type *base)
+{
+    if (base != WDOG) {
+        return WDOG_STATUS_INVALID_PARAM;
+    }
+
+    if ((base->CS & WDOG_CS_UPDATE_MASK) == 0U) {
+        return WDOG_STATUS_LOCKED;
+    }
+
+    /* Same state SystemInit() leaves behind */
+    WDOG_WriteConfig(base, WDOG_CS_CMD32EN_MASK | WDOG_CS_CLK(WDOG_CLOCK_LPO) | WDOG_CS_UPDATE_MASK,
+                     (uint16_t)WDOG_TOVAL_MASK, 0U);
+
+    return WDOG_STATUS_SUCCESS;
+}
+
+bool WDOG_IsEnabled(WDOG_Type *base)
+{
+    return (base->CS & WDOG_CS_EN_MASK) != 0U;
+}
+
+bool WDOG_IsResetCause(void)
+{
+    return (WDOG_RCM_SRS & WDOG_RCM_SRS_WDOG_MASK) != 0U;
+}
+
+void WDOG_RegisterCallback(WDOG_Type *base, wdog_callback_t callback, void *userData)
+{
+    (void)base;
+
+    s_wdog_callback = callback;
+    s_wdog_user_data = userData;
+}
+
+void WDOG_IRQHandler(WDOG_Type *base)
+{
+    if ((base->CS & WDOG_CS_FLG_MASK) == 0U) {
+        return;
+    }
+
+    /* FLG is left set: clearing it needs the unlock sequence and the
+     * reset follows anyway. WDOG_Init() clears it after reset. */
+    if (s_wdog_callback != NULL) {
+        s_wdog_callback(base, WDOG_EVENT_TIMEOUT, s_wdog_user_data);
+    }
+}
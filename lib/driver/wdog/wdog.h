@@ -0,0 +1,158 @@
+/**
+ * @file    wdog.h
+ * @brief   WDOG Driver API for S32K144
+ * @details Watchdog timer configuration and refresh.
+ *
+ * Features:
+ * - Normal or windowed mode: in windowed mode a refresh while the counter
+ *   is still below WIN is treated as a fault and resets the MCU
+ * - Bus, LPO, SOSC or SIRC clock, optionally divided by 256
+ * - Optional interrupt before the reset (128 bus clocks of warning)
+ * - Refresh is a single 32-bit write of the refresh key (CS[CMD32EN]).
+ *   The unlock sequence is only needed for reconfiguration and stays in
+ *   WDOG_Init() / WDOG_Disable(), so WDOG_Refresh() never masks
+ *   interrupts
+ *
+ * SystemInit() leaves the watchdog disabled with CS[UPDATE] set, so it
+ * can be configured once more after reset. Configuring with
+ * allow_update = false locks it until the next reset.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef WDOG_H
+#define WDOG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "wdog_reg.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief LPO clock feeding the watchdog */
+#define WDOG_LPO_CLOCK_HZ           (128000U)
+
+/** @brief Callback event flags */
+#define WDOG_EVENT_TIMEOUT          (1UL << 0)      /* Reset follows after 128 bus clocks */
+
+/**
+ * @brief WDOG driver status codes
+ */
+typedef enum {
+    WDOG_STATUS_SUCCESS = 0,        /**< Operation successful */
+    WDOG_STATUS_ERROR,              /**< General error */
+    WDOG_STATUS_INVALID_PARAM,      /**< Invalid parameter */
+    WDOG_STATUS_LOCKED              /**< CS[UPDATE] clear, configuration locked until reset */
+} wdog_status_t;
+
+/**
+ * @brief Counter clock (CS[CLK])
+ */
+typedef enum {
+    WDOG_CLOCK_BUS = 0U,            /**< Bus clock */
+    WDOG_CLOCK_LPO,                 /**< 128 kHz LPO clock */
+    WDOG_CLOCK_SOSC,                /**< System oscillator */
+    WDOG_CLOCK_SIRC                 /**< Slow internal reference clock */
+} wdog_clock_source_t;
+
+/**
+ * @brief Watchdog configuration
+ */
+typedef struct {
+    wdog_clock_source_t clock;      /**< Counter clock */
+    bool prescaler;                 /**< Divide the clock by 256 */
+    uint16_t timeout;               /**< Timeout in counter ticks (TOVAL, > 0) */
+    uint16_t window;                /**< Earliest refresh in ticks, 0 = normal mode */
+    bool interrupt;                 /**< Interrupt before the reset */
+    bool run_in_debug;              /**< Keep counting while halted by the debugger */
+    bool allow_update;              /**< Allow a later WDOG_Init() / WDOG_Disable() */
+} wdog_config_t;
+
+/**
+ * @brief Event callback
+ * @param instance WDOG base
+ * @param flags WDOG_EVENT_x
+ * @param userData Parameter given at registration
+ */
+typedef void (*wdog_callback_t)(WDOG_Type *instance, uint32_t flags, void *userData);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Configure and enable the watchdog
+ * @details Unlocks, writes WIN, TOVAL and CS and waits until the new
+ *          configuration is active. Interrupts are masked for the unlock
+ *          window only. The counter restarts from 0.
+ * @param base WDOG base
+ * @param config Configuration
+ * @return wdog_status_t Status of operation
+ */
+wdog_status_t WDOG_Init(WDOG_Type *base, const wdog_config_t *config);
+
+/**
+ * @brief Disable the watchdog
+ * @param base WDOG base
+ * @return wdog_status_t WDOG_STATUS_LOCKED if configured without update
+ */
+wdog_status_t WDOG_Disable(WDOG_Type *base);
+
+/**
+ * @brief Check whether the watchdog is counting
+ * @param base WDOG base
+ * @return true if CS[EN] is set
+ */
+bool WDOG_IsEnabled(WDOG_Type *base);
+
+/**
+ * @brief Check whether the last reset was caused by the watchdog
+ * @return true if RCM SRS[WDOG] is set
+ */
+bool WDOG_IsResetCause(void);
+
+/**
+ * @brief Register the interrupt callback
+ * @param base WDOG base
+ * @param callback Callback, NULL to remove
+ * @param userData Parameter passed back to the callback
+ */
+void WDOG_RegisterCallback(WDOG_Type *base, wdog_callback_t callback, void *userData);
+
+/**
+ * @brief Driver-level interrupt handler
+ * @details Calls the registered callback. Only 128 bus clocks remain
+ *          before the reset.
+ * @param base WDOG base
+ */
+void WDOG_IRQHandler(WDOG_Type *base);
+
+/**
+ * @brief Refresh the watchdog
+ * @details Single 32-bit write of the refresh key. In windowed mode this
+ *          must not be called while the counter is below the window.
+ * @param base WDOG base
+ */
+static inline void WDOG_Refresh(WDOG_Type *base)
+{
+    base->CNT = WDOG_REFRESH_KEY;
+}
+
+/**
+ * @brief Read the counter
+ * @param base WDOG base
+ * @return uint16_t Ticks since the last refresh
+ */
+static inline uint16_t WDOG_GetCounter(WDOG_Type *base)
+{
+    return (uint16_t)(base->CNT & WDOG_CNT_MASK);
+}
+
+#endif /* WDOG_H */
@@ -0,0 +1,21 @@
+/**
+ * @file    wdog_irq.c
+ * @brief   WDOG Interrupt Service Routine Implementation
+ * @details Implements WDOG ISRs and forwards to driver layer handler
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "wdog_irq.h"
+
+/*******************************************************************************
+ * ISR Implementation
+ ******************************************************************************/
+
+/* Forward to driver layer handler */
+void WDOG_EWM_IRQHandler(void) { WDOG_IRQHandler(WDOG); }
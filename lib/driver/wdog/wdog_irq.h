@@ -0,0 +1,37 @@
+/**
+ * @file    wdog_irq.h
+ * @brief   WDOG Interrupt Handler Declarations
+ * @details Provides ISR declarations for WDOG interrupts following CMSIS naming convention
+ * 
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef WDOG_IRQ_H
+#define WDOG_IRQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "wdog.h"
+
+/*******************************************************************************
+ * ISR Declarations
+ ******************************************************************************/
+
+/**
+ * @brief WDOG / EWM interrupt service routine (shared vector)
+ * @note This function should be defined in the startup vector table
+ */
+void WDOG_EWM_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WDOG_IRQ_H */
@@ -0,0 +1,74 @@
+/*
+ * @file    wdog_reg.h
+ * @brief   WDOG (Watchdog Timer) Register Definitions for S32K144
+ */
+
+#ifndef WDOG_REG_H_
+#define WDOG_REG_H_
+
+#include <stdint.h>
+
+/* IO definitions (access restrictions to peripheral registers) */
+#ifndef __IO
+	#define   __I     volatile const       /*!< Defines 'read only' permissions                 */
+	#define     __O     volatile             /*!< Defines 'write only' permissions                */
+	#define     __IO    volatile             /*!< Defines 'read / write' permissions              */
+#endif
+
+/* ----------------------------------------------------------------------------
+   -- WDOG Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/** WDOG - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t CS;                                /**< Watchdog Control and Status Register, offset: 0x0 */
+  __IO uint32_t CNT;                               /**< Watchdog Counter Register, offset: 0x4 */
+  __IO uint32_t TOVAL;                             /**< Watchdog Timeout Value Register, offset: 0x8 */
+  __IO uint32_t WIN;                               /**< Watchdog Window Register, offset: 0xC */
+} WDOG_Type, *WDOG_MemMapPtr;
+
+/* WDOG - Peripheral instance base address */
+#define WDOG_BASE                                (0x40052000u)
+#define WDOG                                     ((WDOG_Type *)WDOG_BASE)
+
+/* ----------------------------------------------------------------------------
+   -- WDOG Register Masks
+   ---------------------------------------------------------------------------- */
+
+/* CS Bit Fields */
+#define WDOG_CS_STOP_MASK                        0x1u
+#define WDOG_CS_WAIT_MASK                        0x2u
+#define WDOG_CS_DBG_MASK                         0x4u
+#define WDOG_CS_UPDATE_MASK                      0x20u
+#define WDOG_CS_INT_MASK                         0x40u
+#define WDOG_CS_EN_MASK                          0x80u
+#define WDOG_CS_CLK_MASK                         0x300u
+#define WDOG_CS_CLK_SHIFT                        8u
+#define WDOG_CS_CLK(x)                           (((uint32_t)(((uint32_t)(x))<<WDOG_CS_CLK_SHIFT))&WDOG_CS_CLK_MASK)
+#define WDOG_CS_RCS_MASK                         0x400u
+#define WDOG_CS_ULK_MASK                         0x800u
+#define WDOG_CS_PRES_MASK                        0x1000u
+#define WDOG_CS_CMD32EN_MASK                     0x2000u
+#define WDOG_CS_FLG_MASK                         0x4000u
+#define WDOG_CS_WIN_MASK                         0x8000u
+
+/* CNT / TOVAL / WIN Bit Fields */
+#define WDOG_CNT_MASK                            0xFFFFu
+#define WDOG_TOVAL_MASK                          0xFFFFu
+#define WDOG_WIN_MASK                            0xFFFFu
+
+/* 32-bit command words written to CNT (CS[CMD32EN] = 1) */
+#define WDOG_UNLOCK_KEY                          0xD928C520u
+#define WDOG_REFRESH_KEY                         0xB480A602u
+
+/* Clock source prescaler (CS[PRES]) */
+#define WDOG_PRESCALER_DIV                       256u
+
+/* ----------------------------------------------------------------------------
+   -- RCM System Reset Status (reset cause only)
+   ---------------------------------------------------------------------------- */
+#define WDOG_RCM_SRS_ADDR                        (0x4007F008u)
+#define WDOG_RCM_SRS                             (*(__I uint32_t *)WDOG_RCM_SRS_ADDR)
+#define WDOG_RCM_SRS_WDOG_MASK                   0x20u
+
+#endif /* WDOG_REG_H_ */
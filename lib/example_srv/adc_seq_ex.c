@@ -0,0 +1,79 @@
+/**
+ * @file    adc_seq_ex.c
+ * @brief   ADC Service Example - PDB-Timed Multi-Channel Sequence
+ * @details Samples three potentiometer inputs every millisecond with the
+ *          sample instants fixed by PDB0, not by software.
+ *
+ * Setup:
+ * - ADC0 channels 12/13/14 on PTB3/PTB4/PTB5 (analog)
+ * - Slot 0: 2 us after the PDB start
+ * - Slot 1: back-to-back, right after slot 0 completes
+ * - Slot 2: 50 us after the PDB start
+ * - PDB0 restarts itself every 1000 us after one software trigger
+ *
+ * Expected Behavior:
+ * - ADC_SEQ_EX_Done() runs once per millisecond with three results
+ * - ADC_SRV_GetSequenceErrors() stays 0 (results are read in time)
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/adc_srv/adc_srv.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static volatile uint16_t s_pot[3];
+static volatile uint32_t s_sequences = 0;
+
+/*******************************************************************************
+ * Callback
+ ******************************************************************************/
+
+/**
+ * @brief Sequence complete (ADC0 interrupt context)
+ */
+static void ADC_SEQ_EX_Done(const uint16_t *raw, uint8_t count)
+{
+    for (uint8_t i = 0; i < count && i < 3U; i++) {
+        s_pot[i] = raw[i];
+    }
+    s_sequences++;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Arm and start the sequence
+ * @note CLOCK_SRV_InitPreset(), ADC0 clock, analog pin mux and
+ *       ADC_SRV_Init() must be done.
+ */
+bool ADC_SEQ_EX_Start(void)
+{
+    adc_srv_sequence_config_t seq;
+
+    memset(&seq, 0, sizeof(seq));
+    seq.channels[0] = 12U;
+    seq.channels[1] = 13U;
+    seq.channels[2] = 14U;
+    seq.delay_ns[0] = 2000U;
+    seq.delay_ns[1] = 0U;           /* Back-to-back */
+    seq.delay_ns[2] = 50000U;
+    seq.count = 3U;
+    seq.period_us = 1000U;
+    seq.trigger = ADC_SRV_TRIGGER_SOFTWARE;
+    seq.callback = ADC_SEQ_EX_Done;
+
+    if (ADC_SRV_StartSequence(&seq) != ADC_SRV_SUCCESS) {
+        return false;
+    }
+
+    return ADC_SRV_TriggerSequence() == ADC_SRV_SUCCESS;
+}
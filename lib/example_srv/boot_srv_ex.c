@@ -0,0 +1,58 @@
+/**
+ * @file    boot_srv_ex.c
+ * @brief   Bootloader Service Example - Resident Bootloader
+ * @details Reset path of the resident bootloader: start the stored
+ *          application unless it asked for an update or is not valid,
+ *          otherwise stay on CAN, receive a new image into P-Flash through
+ *          the FTFC backend and start it on GO.
+ *
+ * Off target: test/unit/test_boot.c runs the block protocol against a RAM
+ * flash model and the simulated FlexCAN in test/sim (`make -C test test`).
+ *
+ * Expected Behavior:
+ * - Valid image, no update request: BOOT_EX_Run() does not return, the
+ *   application starts
+ * - Otherwise the node answers the block protocol on BOOT_SRV_CMD_ID and
+ *   starts the new image after END was answered positive and GO received
+ * - BOOT_EX_Run() returns only if the bootloader could not join CAN
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/boot_srv/boot_srv.h"
+#include "../service/nvm_srv/nvm_srv.h"
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Bootloader main
+ * @note CAN_SRV_Init() and NVM_SRV_Init() must have succeeded.
+ */
+void BOOT_EX_Run(void)
+{
+    /* Returns only if there is no valid image */
+    if (!BOOT_SRV_ConsumeUpdateRequest()) {
+        (void)BOOT_SRV_JumpToApp();
+    }
+
+    if (BOOT_SRV_Init() != BOOT_SRV_SUCCESS) {
+        return;
+    }
+
+    while (1) {
+        BOOT_SRV_Process();
+        NVM_SRV_Process();      /* Cleared request flag, image size/CRC */
+
+        /* One attempt per GO: an image that does not start waits for the host */
+        if (BOOT_SRV_IsStartRequested()) {
+            BOOT_SRV_ClearStartRequest();
+            (void)BOOT_SRV_JumpToApp();
+        }
+    }
+}
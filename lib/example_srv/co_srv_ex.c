@@ -0,0 +1,137 @@
+/**
+ * @file    co_srv_ex.c
+ * @brief   CANopen-lite Service Example - SYNC Master and PDO Exchange
+ * @details Node 0x10 acts as NMT master and SYNC producer for a Board 1
+ *          node (node 0x01, see app_b1). It starts the node, sends a SYNC
+ *          every 100 ms and receives the node's TPDO1 into its own
+ *          dictionary through an RPDO, with the same bit layout.
+ *
+ * Setup:
+ * - CAN_SRV_Init() at 500 Kbps and LPIT_SRV_Init() already called
+ * - CO_EX_Tick() called every 100 ms (LPIT channel of the caller)
+ *
+ * Expected Behavior:
+ * - Heartbeat 0x710 every second, state 0x05 after CO_EX_Init()
+ * - Node 1 answers each SYNC with TPDO1 (0x181, 4 bytes)
+ * - s_adc / s_count follow the node's ADC value and sample counter
+ * - CO_EX_SetPeriod() sends RPDO1 (0x201) and the node's sample period
+ *   changes without any legacy command frame
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/co_srv/co_srv.h"
+#include "../service/can_srv/can_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define CO_EX_NODE_ID           (0x10U)
+#define CO_EX_SLAVE_ID          (0x01U)
+#define CO_EX_HEARTBEAT_MS      (1000U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static volatile uint16_t s_adc = 0;
+static volatile uint16_t s_count = 0;
+static volatile uint16_t s_period_ms = 0;
+
+static const co_srv_od_entry_t s_od[] = {
+    CO_SRV_OD_VAR(0x2100U, 0x00U, CO_SRV_OD_RW, s_adc),
+    CO_SRV_OD_VAR(0x2100U, 0x01U, CO_SRV_OD_RW, s_count),
+    CO_SRV_OD_VAR(0x2101U, 0x00U, CO_SRV_OD_RO, s_period_ms),
+};
+
+/* Slave TPDO1: 12-bit ADC, 16-bit counter */
+static const co_srv_pdo_map_t s_rpdo_map[] = {
+    { 0x2100U, 0x00U, 12U },
+    { 0x2100U, 0x01U, 16U },
+};
+
+/* Slave RPDO1: 16-bit period */
+static const co_srv_pdo_map_t s_tpdo_map[] = {
+    { 0x2101U, 0x00U, 16U },
+};
+
+static co_srv_stats_t s_stats;
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Join the network and start the slave
+ * @return co_srv_status_t Status of the first failing step
+ */
+co_srv_status_t CO_EX_Init(void)
+{
+    co_srv_config_t cfg;
+    co_srv_pdo_config_t pdo;
+    co_srv_status_t status;
+
+    cfg.node_id = CO_EX_NODE_ID;
+    cfg.od = s_od;
+    cfg.od_count = (uint16_t)(sizeof(s_od) / sizeof(s_od[0]));
+    cfg.heartbeat_ms = CO_EX_HEARTBEAT_MS;
+    cfg.auto_start = true;
+    cfg.on_nmt = NULL;
+    cfg.on_rpdo = NULL;
+
+    status = CO_SRV_Init(&cfg);
+    if (status != CO_SRV_SUCCESS) {
+        return status;
+    }
+
+    /* Consume the slave's TPDO1. Applied on reception: a SYNC producer
+       does not receive its own SYNC, so a synchronous RPDO would wait */
+    pdo.cob_id = CO_SRV_COB_TPDO(0U, CO_EX_SLAVE_ID);
+    pdo.transmission = CO_SRV_PDO_EVENT;
+    pdo.count = 2U;
+    pdo.map = s_rpdo_map;
+    status = CO_SRV_ConfigRpdo(0U, &pdo);
+    if (status != CO_SRV_SUCCESS) {
+        return status;
+    }
+
+    /* Produce the slave's RPDO1 on demand */
+    pdo.cob_id = CO_SRV_COB_RPDO(0U, CO_EX_SLAVE_ID);
+    pdo.transmission = CO_SRV_PDO_EVENT;
+    pdo.count = 1U;
+    pdo.map = s_tpdo_map;
+    status = CO_SRV_ConfigTpdo(0U, &pdo);
+    if (status != CO_SRV_SUCCESS) {
+        return status;
+    }
+
+    status = CO_SRV_Start();
+    if (status != CO_SRV_SUCCESS) {
+        return status;
+    }
+
+    return CO_SRV_SendNmt(CO_SRV_NMT_CMD_START, CO_EX_SLAVE_ID);
+}
+
+/**
+ * @brief 100 ms tick: one SYNC for the whole network
+ */
+void CO_EX_Tick(void)
+{
+    CO_SRV_SendSync();
+    CO_SRV_GetStats(&s_stats);
+}
+
+/**
+ * @brief Change the slave's sample period
+ */
+co_srv_status_t CO_EX_SetPeriod(uint16_t period_ms)
+{
+    s_period_ms = period_ms;
+
+    return CO_SRV_TriggerTpdo(0U);
+}
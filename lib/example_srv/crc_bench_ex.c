@@ -0,0 +1,138 @@
+/**
+ * @file    crc_bench_ex.c
+ * @brief   CRC Service Example - Engine Crossover Benchmark
+ * @details Times the software, CPU-fed and DMA-fed engines of crc_srv for
+ *          growing input sizes with the DWT cycle counter, prints a table
+ *          over UART and applies the measured crossovers as thresholds.
+ *
+ * Expected Behavior (160 MHz core, buffers in SRAM_U):
+ * - Software wins below ~12 bytes (peripheral setup dominates)
+ * - CPU writes win up to a few hundred bytes (TCD setup dominates DMA)
+ * - Every engine returns the same CRC for the same input
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/crc_srv/crc_srv.h"
+#include "../service/uart_srv/uart_srv.h"
+#include "../driver/ultis/dwt_ultis.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define CRC_BENCH_MAX_SIZE      (4096U)
+#define CRC_BENCH_REPEAT        (8U)
+#define CRC_BENCH_UART          (UART_SRV_INSTANCE_1)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint8_t s_bench_buf[CRC_BENCH_MAX_SIZE] __attribute__((aligned(4)));
+
+static const uint32_t s_bench_sizes[] = {
+    4U, 8U, 12U, 16U, 24U, 32U, 64U, 128U, 256U, 512U, 1024U, 2048U, 4096U
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Average cycles of one CRC32 over length bytes on a given engine
+ */
+static uint32_t CRC_Bench_Measure(crc_srv_path_t path, uint32_t length, uint32_t *crc)
+{
+    crc_srv_ctx_t ctx;
+    uint32_t start;
+    uint32_t total = 0;
+
+    for (uint32_t i = 0; i < CRC_BENCH_REPEAT; i++) {
+        start = DWT_GetCycles();
+        CRC_SRV_Begin(&ctx, CRC_SRV_CRC32);
+        CRC_SRV_UpdatePath(&ctx, s_bench_buf, length, path);
+        *crc = CRC_SRV_Finish(&ctx);
+        total += DWT_GetCycles() - start;
+    }
+
+    return total / CRC_BENCH_REPEAT;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Run the benchmark and apply the crossovers
+ * @note CRC_SRV_Init() and UART_SRV_Init(CRC_BENCH_UART, ...) must have
+ *       been called.
+ * @return true if all engines agreed on every size
+ */
+bool CRC_BENCH_Run(void)
+{
+    uint32_t sw_cycles;
+    uint32_t hw_cycles;
+    uint32_t dma_cycles;
+    uint32_t crc_sw;
+    uint32_t crc_hw;
+    uint32_t crc_dma;
+    uint32_t sw_max = 0;
+    uint32_t dma_min = 0;
+    bool match = true;
+
+    for (uint32_t i = 0; i < CRC_BENCH_MAX_SIZE; i++) {
+        s_bench_buf[i] = (uint8_t)(i * 31U + 7U);
+    }
+
+    DWT_CycleCounterInit();
+
+    /* Reference check value of the catalogue: "123456789" -> 0xCBF43926 */
+    if (CRC_SRV_Compute(CRC_SRV_CRC32, "123456789", 9U) != 0xCBF43926U ||
+        CRC_SRV_Compute(CRC_SRV_CRC16_CCITT, "123456789", 9U) != 0x29B1U) {
+        UART_SRV_SendString(CRC_BENCH_UART, "CRC check value mismatch\r\n");
+        return false;
+    }
+
+    UART_SRV_SendString(CRC_BENCH_UART, "\r\nCRC32 cycles: size  sw  hw  dma\r\n");
+
+    for (uint32_t i = 0; i < sizeof(s_bench_sizes) / sizeof(s_bench_sizes[0]); i++) {
+        uint32_t size = s_bench_sizes[i];
+
+        sw_cycles = CRC_Bench_Measure(CRC_SRV_PATH_SW, size, &crc_sw);
+        hw_cycles = CRC_Bench_Measure(CRC_SRV_PATH_HW, size, &crc_hw);
+        dma_cycles = CRC_Bench_Measure(CRC_SRV_PATH_DMA, size, &crc_dma);
+
+        if (crc_sw != crc_hw || crc_sw != crc_dma) {
+            match = false;
+        }
+
+        UART_SRV_Printf(CRC_BENCH_UART, "%u %u %u %u%s\r\n",
+                        (unsigned)size, (unsigned)sw_cycles,
+                        (unsigned)hw_cycles, (unsigned)dma_cycles,
+                        (crc_sw == crc_hw && crc_sw == crc_dma) ? "" : " MISMATCH");
+
+        /* Largest size where software still beats the peripheral */
+        if (sw_cycles <= hw_cycles) {
+            sw_max = size;
+        }
+
+        /* Smallest size from which DMA beats CPU writes */
+        if (dma_min == 0U && dma_cycles < hw_cycles) {
+            dma_min = size;
+        }
+    }
+
+    if (dma_min == 0U) {
+        dma_min = CRC_BENCH_MAX_SIZE + 1U;     /* DMA never won */
+    }
+
+    UART_SRV_Printf(CRC_BENCH_UART, "Crossover: sw <= %u, dma >= %u\r\n",
+                    (unsigned)sw_max, (unsigned)dma_min);
+
+    CRC_SRV_SetThresholds(sw_max, dma_min);
+
+    return match;
+}
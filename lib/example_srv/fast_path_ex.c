@@ -0,0 +1,187 @@
+/**
+ * @file    fast_path_ex.c
+ * @brief   Fast Path Example - Runtime-Instance vs Instance-Bound Driver Calls
+ * @details Times the same operation through the runtime-instance API and
+ *          through the build-time bound inline path, and prints the cycles
+ *          over UART:
+ *          - CAN0 mailbox load: CAN_Send() vs CAN0_FastSend()
+ *          - CAN0 empty mailbox poll: CAN_Receive() vs CAN0_FastReceive()
+ *          - PTD15 toggle: GPIO_SRV_Toggle() vs PTD_FastToggle()
+ *          - LPUART1 byte into an empty buffer: UART_SRV_SendByte() vs
+ *            LPUART1_FastPutByte()
+ *          Each figure is the fastest of FAST_EX_RUNS, so interrupts do
+ *          not show. The header names the argument check profile of the
+ *          build (assert_ultis.h): run it from a Debug and from a Release
+ *          configuration to see what the DEV_ASSERT checks cost.
+ *
+ * Setup:
+ * - CAN_SRV_Init() done, a second node on the bus acknowledging frames
+ * - PTD15 configured as output (red LED)
+ * - UART_SRV_Init(FAST_EX_UART, ...)
+ *
+ * Expected Behavior:
+ * - Identical bus and pin activity on both paths
+ * - The bound paths drop the calls, the instance table load and the
+ *   checks: a few cycles for a pin toggle instead of a few tens, and
+ *   roughly half for the CAN and UART calls
+ * - The API column shrinks by a few cycles per DEV_ASSERT from the checked
+ *   to the release profile; the bound column does not change
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/can_srv/can_srv.h"
+#include "../service/gpio_srv/gpio_srv.h"
+#include "../service/uart_srv/uart_srv.h"
+#include "../driver/can/can_fast.h"
+#include "../driver/gpio/gpio_fast.h"
+#include "../driver/uart/uart_fast.h"
+#include "../driver/ultis/dwt_ultis.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define FAST_EX_UART            (UART_SRV_INSTANCE_1)
+#define FAST_EX_RUNS            (8U)
+#define FAST_EX_LED_PORT        (3U)            /* Port D */
+#define FAST_EX_LED_PIN         (15U)           /* Red LED */
+#define FAST_EX_RX_MB           (31U)           /* Polled while empty */
+#define FAST_EX_CAN_ID          (0x7F0U)
+#define FAST_EX_TIMEOUT         (100000U)
+
+#ifdef DEV_ERROR_DETECT
+#define FAST_EX_PROFILE         "checked"
+#else
+#define FAST_EX_PROFILE         "release"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static can_message_t s_msg = {
+    FAST_EX_CAN_ID, CAN_ID_STD, CAN_FRAME_DATA, 8U, { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U }, 0U
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Wait until the mailbox sent its frame
+ */
+static bool FAST_EX_WaitTx(uint8_t mb)
+{
+    for (uint32_t i = 0; i < FAST_EX_TIMEOUT; i++) {
+        if (!CAN0_FastIsMbBusy(mb)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Wait until the LPUART1 shifter is idle, so TDRE is set at once
+ */
+static void FAST_EX_WaitUart(void)
+{
+    while ((LPUART1->STAT & LPUART_STAT_TC_MASK) == 0U) {
+    }
+}
+
+/**
+ * @brief Keep the fastest of two readings
+ */
+static inline void FAST_EX_Min(uint32_t *best, uint32_t start)
+{
+    uint32_t cycles = DWT_GetCycles() - start;
+
+    if (cycles < *best) {
+        *best = cycles;
+    }
+}
+
+/**
+ * @brief Print one line: operation, API, bound
+ */
+static void FAST_EX_Print(const char *name, uint32_t api, uint32_t bound)
+{
+    UART_SRV_Printf(FAST_EX_UART, "%s  %u  %u\r\n", name, (unsigned)api, (unsigned)bound);
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Run the example
+ * @return true if every frame was sent
+ */
+bool FAST_EX_Run(void)
+{
+    uint8_t mb;
+    uint32_t start;
+    uint32_t can_tx[2] = { UINT32_MAX, UINT32_MAX };
+    uint32_t can_rx[2] = { UINT32_MAX, UINT32_MAX };
+    uint32_t gpio[2] = { UINT32_MAX, UINT32_MAX };
+    uint32_t uart[2] = { UINT32_MAX, UINT32_MAX };
+    can_message_t rx;
+    bool ok = true;
+
+    if (CAN_SRV_AllocTxMailbox(&mb) != CAN_SRV_SUCCESS) {
+        return false;
+    }
+
+    DWT_CycleCounterStart();
+
+    for (uint32_t run = 0; run < FAST_EX_RUNS && ok; run++) {
+        start = DWT_GetCycles();
+        (void)CAN_Send(0U, mb, &s_msg);
+        FAST_EX_Min(&can_tx[0], start);
+        ok = FAST_EX_WaitTx(mb);
+
+        start = DWT_GetCycles();
+        CAN0_FastSend(mb, &s_msg);
+        FAST_EX_Min(&can_tx[1], start);
+        ok = ok && FAST_EX_WaitTx(mb);
+
+        start = DWT_GetCycles();
+        (void)CAN_Receive(0U, FAST_EX_RX_MB, &rx);
+        FAST_EX_Min(&can_rx[0], start);
+
+        start = DWT_GetCycles();
+        (void)CAN0_FastReceive(FAST_EX_RX_MB, &rx);
+        FAST_EX_Min(&can_rx[1], start);
+
+        start = DWT_GetCycles();
+        GPIO_SRV_Toggle(FAST_EX_LED_PORT, FAST_EX_LED_PIN);
+        FAST_EX_Min(&gpio[0], start);
+
+        start = DWT_GetCycles();
+        PTD_FastToggle(FAST_EX_LED_PIN);
+        FAST_EX_Min(&gpio[1], start);
+
+        FAST_EX_WaitUart();
+        start = DWT_GetCycles();
+        UART_SRV_SendByte(FAST_EX_UART, (uint8_t)'.');
+        FAST_EX_Min(&uart[0], start);
+
+        FAST_EX_WaitUart();
+        start = DWT_GetCycles();
+        LPUART1_FastPutByte((uint8_t)'.');
+        FAST_EX_Min(&uart[1], start);
+    }
+
+    UART_SRV_SendString(FAST_EX_UART, "\r\nProfile: " FAST_EX_PROFILE "\r\n");
+    UART_SRV_SendString(FAST_EX_UART, "Cycles: operation  API  bound\r\n");
+    FAST_EX_Print("CAN send", can_tx[0], can_tx[1]);
+    FAST_EX_Print("CAN poll", can_rx[0], can_rx[1]);
+    FAST_EX_Print("Pin toggle", gpio[0], gpio[1]);
+    FAST_EX_Print("UART byte", uart[0], uart[1]);
+
+    return ok;
+}
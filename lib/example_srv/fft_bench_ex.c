@@ -0,0 +1,136 @@
+/**
+ * @file    fft_bench_ex.c
+ * @brief   FFT Service Example - Transform Benchmark
+ * @details Feeds fft_srv a synthetic triangle wave (no ADC needed), checks
+ *          that its odd harmonics come out as the strongest peaks and times
+ *          each stage with the DWT cycle counter for 256, 512 and 1024
+ *          points. Prints a table over UART.
+ *
+ * Expected Behavior (160 MHz core):
+ * - Peaks at bins N/32, 3N/32 and 5N/32 with amplitudes close to 811,
+ *   90 and 32 counts (8/pi^2, /9, /25 of the 1000 count triangle)
+ * - The transform grows as N log N: in the order of 10k cycles for 256
+ *   points and 50k for 1024 (about 0.3 ms)
+ * - Loading and the peak search stay linear in N
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/fft_srv/fft_srv.h"
+#include "../service/clock_srv/clock_srv.h"
+#include "../service/uart_srv/uart_srv.h"
+#include "../driver/ultis/dwt_ultis.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define FFT_BENCH_UART          (UART_SRV_INSTANCE_1)
+#define FFT_BENCH_PERIOD        (32U)           /* Samples per triangle period */
+#define FFT_BENCH_AMPLITUDE     (1000)          /* Counts */
+#define FFT_BENCH_PEAKS         (3U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint16_t s_bench_samples[FFT_SRV_MAX_SIZE];
+static uint32_t s_bench_work[FFT_SRV_MAX_SIZE];
+
+static const uint16_t s_bench_sizes[] = { 256U, 512U, 1024U };
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Triangle wave around mid-scale
+ */
+static void FFT_Bench_Generate(uint16_t size)
+{
+    uint32_t period = FFT_BENCH_PERIOD;
+    int32_t phase;
+    int32_t value;
+
+    for (uint32_t n = 0; n < size; n++) {
+        /* Rises over the first half period, falls over the second: -A .. A */
+        phase = (int32_t)(n % period);
+        value = (phase < (int32_t)(period / 2U)) ? phase : ((int32_t)period - phase);
+        value = ((value * 4 * FFT_BENCH_AMPLITUDE) / (int32_t)period) - FFT_BENCH_AMPLITUDE;
+        s_bench_samples[n] = (uint16_t)(2048 + value);
+    }
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Run the benchmark
+ * @note UART_SRV_Init(FFT_BENCH_UART, ...) must have been called.
+ * @return true if every size found the three harmonics in order
+ */
+bool FFT_BENCH_Run(void)
+{
+    fft_srv_peak_t peaks[FFT_BENCH_PEAKS];
+    clock_srv_frequencies_t freq;
+    uint32_t mhz;
+    uint32_t start;
+    uint32_t load_cycles;
+    uint32_t fft_cycles;
+    uint32_t peak_cycles;
+    uint8_t count;
+    bool match = true;
+
+    if (FFT_SRV_Init() != FFT_SRV_SUCCESS) {
+        return false;
+    }
+
+    CLOCK_SRV_GetFrequencies(&freq);
+    mhz = freq.core_hz / 1000000U;
+    DWT_CycleCounterStart();
+
+    UART_SRV_SendString(FFT_BENCH_UART, "\r\nQ15 FFT cycles: size  load  fft  peaks  (fft us)\r\n");
+
+    for (uint32_t i = 0; i < sizeof(s_bench_sizes) / sizeof(s_bench_sizes[0]); i++) {
+        uint16_t size = s_bench_sizes[i];
+
+        FFT_Bench_Generate(size);
+
+        start = DWT_GetCycles();
+        FFT_SRV_LoadSamples(s_bench_samples, size, FFT_SRV_WINDOW_HANN, s_bench_work);
+        load_cycles = DWT_GetCycles() - start;
+
+        start = DWT_GetCycles();
+        FFT_SRV_Transform(s_bench_work, size);
+        fft_cycles = DWT_GetCycles() - start;
+
+        start = DWT_GetCycles();
+        count = FFT_SRV_FindPeaks(s_bench_work, size, FFT_SRV_WINDOW_HANN, 10U, peaks, FFT_BENCH_PEAKS);
+        peak_cycles = DWT_GetCycles() - start;
+
+        UART_SRV_Printf(FFT_BENCH_UART, "%u %u %u %u  (%u)\r\n",
+                        (unsigned)size, (unsigned)load_cycles, (unsigned)fft_cycles,
+                        (unsigned)peak_cycles, (unsigned)(fft_cycles / mhz));
+
+        /* Harmonic h sits on bin h * N / FFT_BENCH_PERIOD */
+        for (uint8_t p = 0; p < count; p++) {
+            UART_SRV_Printf(FFT_BENCH_UART, "  bin %u.%02u amplitude %u\r\n",
+                            (unsigned)(peaks[p].bin_q8 >> 8),
+                            (unsigned)(((peaks[p].bin_q8 & 0xFFU) * 100U) >> 8),
+                            (unsigned)peaks[p].amplitude);
+            if (((peaks[p].bin_q8 + 128U) >> 8) != ((2U * p + 1U) * (size / FFT_BENCH_PERIOD))) {
+                match = false;
+            }
+        }
+        if (count != FFT_BENCH_PEAKS) {
+            match = false;
+        }
+    }
+
+    UART_SRV_Printf(FFT_BENCH_UART, "Harmonics %s\r\n", match ? "ok" : "MISMATCH");
+
+    return match;
+}
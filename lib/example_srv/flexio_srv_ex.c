@@ -0,0 +1,133 @@
+/**
+ * @file    flexio_srv_ex.c
+ * @brief   FlexIO Service Example - Extra Console And SPI EEPROM
+ * @details Adds a third UART and a second SPI bus on FlexIO while all
+ *          LPUART/LPSPI pins are in use elsewhere.
+ *
+ * Setup:
+ * - FlexIO clock: SPLLDIV2
+ * - UART_SRV_INSTANCE_FLEXIO_0 on PTD0 (TX) / PTD1 (RX), 115200 8N1
+ * - SPI master: PTA0 = MOSI (FXIO_D2), PTA1 = MISO (FXIO_D3),
+ *   PTE10 = SCK (FXIO_D4), all ALT4; PTE9 = chip select (GPIO)
+ * - 25xx SPI EEPROM on the SPI bus
+ *
+ * Expected Behavior:
+ * - Characters typed on the FlexIO console are echoed back; reception
+ *   runs into the DMA ring, so nothing is lost while the loop is busy
+ * - Every FLEXIO_EX_Process() call with no transfer running reads the
+ *   EEPROM status register by DMA and prints it when done
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/flexio_srv/flexio_srv.h"
+#include "../service/uart_srv/uart_srv.h"
+#include "../service/port_srv/port_srv.h"
+#include "../service/gpio_srv/gpio_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define FLEXIO_EX_CONSOLE       UART_SRV_INSTANCE_FLEXIO_0
+
+#define FLEXIO_EX_CS_PORT       (4U)        /* Port E */
+#define FLEXIO_EX_CS_PIN        (9U)
+
+#define FLEXIO_EX_EEPROM_RDSR   (0x05U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint8_t s_spi_tx[2] = { FLEXIO_EX_EEPROM_RDSR, 0xFFU };
+static uint8_t s_spi_rx[2];
+static volatile bool s_spi_done = false;
+
+/*******************************************************************************
+ * Callback
+ ******************************************************************************/
+
+/**
+ * @brief SPI transfer complete (DMA interrupt context)
+ */
+static void FLEXIO_EX_SpiDone(flexio_srv_status_t status, void *user)
+{
+    (void)status;
+    (void)user;
+
+    GPIO_SRV_Write(FLEXIO_EX_CS_PORT, FLEXIO_EX_CS_PIN, 1U);
+    s_spi_done = true;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Bring up FlexIO, the console and the SPI bus
+ * @note CLOCK_SRV_InitPreset(), PORTA/D/E clocks, PORT_SRV_Init() and
+ *       GPIO_SRV_Init() must be done.
+ */
+bool FLEXIO_EX_Init(void)
+{
+    flexio_srv_spi_config_t spi;
+
+    if (FLEXIO_SRV_Init(CLOCK_SRV_PCS_SPLLDIV2) != FLEXIO_SRV_SUCCESS) {
+        return false;
+    }
+
+    /* Console: pins muxed by uart_srv */
+    if (UART_SRV_Init(FLEXIO_EX_CONSOLE, 115200U) != UART_SRV_SUCCESS) {
+        return false;
+    }
+
+    PORT_SRV_SetMux(0, 0, PORT_SRV_MUX_ALT4);  /* PTA0 = FXIO_D2 */
+    PORT_SRV_SetMux(0, 1, PORT_SRV_MUX_ALT4);  /* PTA1 = FXIO_D3 */
+    PORT_SRV_SetMux(4, 10, PORT_SRV_MUX_ALT4); /* PTE10 = FXIO_D4 */
+    GPIO_SRV_ConfigOutput(FLEXIO_EX_CS_PORT, FLEXIO_EX_CS_PIN);
+    GPIO_SRV_Write(FLEXIO_EX_CS_PORT, FLEXIO_EX_CS_PIN, 1U);
+
+    spi.mosi_pin = 2U;
+    spi.miso_pin = 3U;
+    spi.sck_pin = 4U;
+    spi.baudrate = 1000000U;
+    if (FLEXIO_SRV_SpiOpen(&spi) != FLEXIO_SRV_SUCCESS) {
+        return false;
+    }
+
+    s_spi_done = true;      /* Nothing pending */
+    return UART_SRV_SendString(FLEXIO_EX_CONSOLE, "FlexIO console ready\r\n") == UART_SRV_SUCCESS;
+}
+
+/**
+ * @brief Main loop step
+ */
+void FLEXIO_EX_Process(void)
+{
+    uint8_t c;
+
+    /* Echo whatever the DMA ring has collected */
+    while (FLEXIO_SRV_UartGetByte(0, &c) == FLEXIO_SRV_SUCCESS) {
+        UART_SRV_SendByte(FLEXIO_EX_CONSOLE, c);
+    }
+
+    if (!s_spi_done) {
+        return;
+    }
+
+    if (!FLEXIO_SRV_SpiIsBusy()) {
+        UART_SRV_Printf(FLEXIO_EX_CONSOLE, "EEPROM SR=0x%02X\r\n", s_spi_rx[1]);
+
+        s_spi_done = false;
+        GPIO_SRV_Write(FLEXIO_EX_CS_PORT, FLEXIO_EX_CS_PIN, 0U);
+        if (FLEXIO_SRV_SpiTransfer(s_spi_tx, s_spi_rx, sizeof(s_spi_tx),
+                                   FLEXIO_EX_SpiDone, NULL) != FLEXIO_SRV_SUCCESS) {
+            GPIO_SRV_Write(FLEXIO_EX_CS_PORT, FLEXIO_EX_CS_PIN, 1U);
+            s_spi_done = true;
+        }
+    }
+}
@@ -0,0 +1,134 @@
+/**
+ * @file    ftm_srv_ex.c
+ * @brief   FTM Service Example - Speed Sensor And PWM Input
+ * @details Measures a slow wheel-speed signal in interrupt mode and a fast
+ *          PWM input in DMA mode, both as block averages.
+ *
+ * Setup:
+ * - FTM1 CH0 on PTB2 (ALT2): wheel-speed sensor, 5 Hz - 2 kHz, square wave
+ * - FTM2 CH0 on PTC5 (ALT2): PWM input, 20 kHz, duty 10-90 %
+ *
+ * Expected Behavior:
+ * - FTM1 runs at 80 MHz / 128 so a 5 Hz period (~1.3 overflows) is still
+ *   measured; the speed updates every 8 periods and drops to 0 Hz within
+ *   500 ms of the wheel stopping
+ * - FTM2 runs at full system clock; the PWM duty is averaged over 64
+ *   periods and the CPU is interrupted every 64 periods instead of twice
+ *   per period
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/ftm_srv/ftm_srv.h"
+#include "../service/port_srv/port_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define FTM_EX_PWM_BLOCK        (64U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint16_t s_pwm_ring[4U * FTM_EX_PWM_BLOCK];
+
+static volatile uint32_t s_wheel_mhz = 0;       /* Wheel callback only */
+
+/*******************************************************************************
+ * Callback
+ ******************************************************************************/
+
+/**
+ * @brief Wheel-speed block (FTM1 interrupt context)
+ */
+static void FTM_EX_WheelBlock(ftm_srv_instance_t instance, uint8_t pair,
+                              const ftm_srv_measurement_t *result)
+{
+    (void)instance;
+    (void)pair;
+
+    /* periods == 0: stalled, frequency already reported as 0 */
+    s_wheel_mhz = result->frequency_mhz;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Start both measurements
+ * @note CLOCK_SRV_InitPreset(), PORTB/PORTC clocks and PORT_SRV_Init()
+ *       must be done.
+ */
+bool FTM_EX_Init(void)
+{
+    ftm_srv_config_t inst_cfg;
+    ftm_srv_capture_config_t cap;
+
+    PORT_SRV_SetMux(1, 2, PORT_SRV_MUX_ALT2);   /* PTB2 = FTM1_CH0 */
+    PORT_SRV_SetMux(2, 5, PORT_SRV_MUX_ALT2);   /* PTC5 = FTM2_CH0 */
+
+    /* Wheel: long periods, overflow-extended timestamps */
+    inst_cfg.min_frequency_hz = 10U;
+    if (FTM_SRV_Init(FTM_SRV_INSTANCE_1, &inst_cfg) != FTM_SRV_SUCCESS) {
+        return false;
+    }
+
+    cap.pair = 0;
+    cap.mode = FTM_SRV_CAPTURE_IRQ;
+    cap.active_low = false;
+    cap.block_periods = 8U;
+    cap.dma_buffer = NULL;
+    cap.stall_ms = 500U;
+    cap.filter = 15U;                   /* Sensor edges are noisy */
+    cap.callback = FTM_EX_WheelBlock;
+    if (FTM_SRV_StartCapture(FTM_SRV_INSTANCE_1, &cap) != FTM_SRV_SUCCESS) {
+        return false;
+    }
+
+    /* PWM: 20 kHz fits the counter at full clock, captures go by DMA */
+    inst_cfg.min_frequency_hz = 2000U;
+    if (FTM_SRV_Init(FTM_SRV_INSTANCE_2, &inst_cfg) != FTM_SRV_SUCCESS) {
+        return false;
+    }
+
+    cap.pair = 0;
+    cap.mode = FTM_SRV_CAPTURE_DMA;
+    cap.active_low = false;
+    cap.block_periods = FTM_EX_PWM_BLOCK;
+    cap.dma_buffer = s_pwm_ring;
+    cap.stall_ms = 0U;
+    cap.filter = 0U;
+    cap.callback = NULL;                /* Polled below */
+
+    return FTM_SRV_StartCapture(FTM_SRV_INSTANCE_2, &cap) == FTM_SRV_SUCCESS;
+}
+
+/**
+ * @brief Read the PWM duty cycle
+ * @return uint16_t Duty in 0.01 %, 0 until the first block
+ */
+uint16_t FTM_EX_GetPwmDuty(void)
+{
+    ftm_srv_measurement_t m;
+
+    if (FTM_SRV_GetMeasurement(FTM_SRV_INSTANCE_2, 0, &m) != FTM_SRV_SUCCESS) {
+        return 0U;
+    }
+
+    return m.duty_permyriad;
+}
+
+/**
+ * @brief Read the wheel frequency
+ * @return uint32_t Frequency in mHz, 0 when stalled
+ */
+uint32_t FTM_EX_GetWheelMilliHz(void)
+{
+    return s_wheel_mhz;
+}
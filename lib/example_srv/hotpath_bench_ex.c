@@ -0,0 +1,172 @@
+/**
+ * @file    hotpath_bench_ex.c
+ * @brief   Hot Path Benchmark Example - Cycle Budgets
+ * @details Times the calls made on every sample, frame or interrupt with
+ *          the DWT cycle counter and compares each against a budget, so a
+ *          change that slows one of them shows up as a failed run instead
+ *          of a missed deadline in the field.
+ *
+ * Each entry is called through a wrapper; the cost of an empty wrapper is
+ * measured first and subtracted. The minimum over HOT_BENCH_REPEAT runs is
+ * used so an interrupt landing in one run does not count.
+ *
+ * Off target: test/bench/bench.c times the same calls on a Linux host
+ * against the simulated register maps in test/sim (`make -C test bench`).
+ *
+ * Expected Behavior:
+ * - One line per entry over UART: name, cycles, budget
+ * - HOT_BENCH_Run() returns the number of entries over budget (0 = pass)
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/gpio_srv/gpio_srv.h"
+#include "../service/can_srv/can_srv.h"
+#include "../service/crc_srv/crc_srv.h"
+#include "../service/wdog_srv/wdog_srv.h"
+#include "../service/uart_srv/uart_srv.h"
+#include "../driver/ultis/dwt_ultis.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOT_BENCH_REPEAT        (16U)
+#define HOT_BENCH_UART          (UART_SRV_INSTANCE_1)
+
+#define HOT_BENCH_GPIO_PORT     (3U)        /* Port D */
+#define HOT_BENCH_GPIO_PIN      (0U)        /* PTD0, blue LED */
+
+/**
+ * @brief One timed call
+ */
+typedef struct {
+    const char *name;
+    void (*run)(void);
+    uint32_t budget;                /**< Core cycles, wrapper cost excluded */
+} hot_bench_entry_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static can_srv_message_t s_frame;
+static uint8_t s_wdog_task = WDOG_SRV_NO_TASK;
+static volatile uint32_t s_sink;
+
+/*******************************************************************************
+ * Timed calls
+ ******************************************************************************/
+
+static void Bench_Empty(void)
+{
+}
+
+static void Bench_GpioToggle(void)
+{
+    GPIO_SRV_Toggle(HOT_BENCH_GPIO_PORT, HOT_BENCH_GPIO_PIN);
+}
+
+static void Bench_GpioRead(void)
+{
+    s_sink = GPIO_SRV_Read(HOT_BENCH_GPIO_PORT, HOT_BENCH_GPIO_PIN);
+}
+
+static void Bench_CanSend(void)
+{
+    s_sink = (uint32_t)CAN_SRV_Send(&s_frame);
+}
+
+static void Bench_Crc8Bytes(void)
+{
+    s_sink = CRC_SRV_Compute(CRC_SRV_CRC32, s_frame.data, 8U);
+}
+
+static void Bench_WdogCheckIn(void)
+{
+    WDOG_SRV_CheckIn(s_wdog_task);
+}
+
+static const hot_bench_entry_t s_entries[] = {
+    { "gpio_toggle",  Bench_GpioToggle,  60U  },
+    { "gpio_read",    Bench_GpioRead,    60U  },
+    { "can_send",     Bench_CanSend,     400U },
+    { "crc32_8",      Bench_Crc8Bytes,   300U },
+    { "wdog_checkin", Bench_WdogCheckIn, 30U  },
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Fewest cycles of one call over HOT_BENCH_REPEAT runs
+ */
+static uint32_t Bench_Measure(void (*run)(void))
+{
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t best = UINT32_MAX;
+
+    for (uint32_t i = 0; i < HOT_BENCH_REPEAT; i++) {
+        start = DWT_GetCycles();
+        run();
+        cycles = DWT_GetCycles() - start;
+        if (cycles < best) {
+            best = cycles;
+        }
+    }
+
+    return best;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Run every entry against its budget
+ * @note GPIO_SRV_Init(), CAN_SRV_Init() in CAN_MODE_LOOPBACK, CRC_SRV_Init()
+ *       and UART_SRV_Init(HOT_BENCH_UART, ...) must have been called.
+ * @return uint32_t Number of entries over budget
+ */
+uint32_t HOT_BENCH_Run(void)
+{
+    uint32_t overhead;
+    uint32_t cycles;
+    uint32_t failed = 0;
+
+    GPIO_SRV_ConfigOutput(HOT_BENCH_GPIO_PORT, HOT_BENCH_GPIO_PIN);
+    WDOG_SRV_RegisterTask("bench", 1000U, &s_wdog_task);
+
+    s_frame.id = 0x123U;
+    s_frame.dlc = 8U;
+    s_frame.isExtended = false;
+    s_frame.isRemote = false;
+    for (uint8_t i = 0; i < 8U; i++) {
+        s_frame.data[i] = (uint8_t)(0x11U * i);
+    }
+
+    DWT_CycleCounterInit();
+    overhead = Bench_Measure(Bench_Empty);
+
+    UART_SRV_SendString(HOT_BENCH_UART, "\r\nHot path cycles: name  cycles  budget\r\n");
+
+    for (uint32_t i = 0; i < sizeof(s_entries) / sizeof(s_entries[0]); i++) {
+        cycles = Bench_Measure(s_entries[i].run);
+        cycles = (cycles > overhead) ? (cycles - overhead) : 0U;
+
+        if (cycles > s_entries[i].budget) {
+            failed++;
+        }
+
+        UART_SRV_Printf(HOT_BENCH_UART, "%s %u %u%s\r\n", s_entries[i].name,
+                        (unsigned)cycles, (unsigned)s_entries[i].budget,
+                        (cycles > s_entries[i].budget) ? " OVER" : "");
+    }
+
+    return failed;
+}
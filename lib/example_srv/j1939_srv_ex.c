@@ -0,0 +1,137 @@
+/**
+ * @file    j1939_srv_ex.c
+ * @brief   J1939 Service Example - Address Claim, Broadcast and Transport
+ * @details Joins a 250 Kbps J1939 network as an arbitrary-address-capable
+ *          node, publishes a proprietary-B PGN every 100 ms and receives
+ *          engine temperature (single frame) and DM1 (multi-packet BAM
+ *          when more than one fault is active).
+ *
+ * Setup:
+ * - CAN_SRV_Init() at 250 Kbps in CAN_MODE_NORMAL, LPIT_SRV_Init()
+ * - J1939_EX_Process() called from the main loop
+ *
+ * Expected Behavior:
+ * - Address claim (PGN 0xEE00) from SA 0x80 right after J1939_EX_Init()
+ * - If another node with a lower NAME owns 0x80, the node moves to the
+ *   next free address in 0x80-0x87 and claims again
+ * - 250 ms after the claim, PGN 0xFF10 goes out every 100 ms
+ * - Only PGNs 0xFEEE and 0xFECA (plus claim/request/TP) raise CAN
+ *   interrupts; all other traffic is dropped by the mailbox filters
+ * - J1939_EX_SendLog() sends 40 bytes to node 0x00 with RTS/CTS
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/j1939_srv/j1939_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define J1939_EX_NAME               (J1939_SRV_NAME_ARBITRARY_ADDRESS | 0x0000A5A500123456ULL)
+#define J1939_EX_ADDRESS            (0x80U)
+#define J1939_EX_ADDRESS_MAX        (0x87U)
+
+#define J1939_EX_PGN_STATUS         (0x0FF10UL)     /* Proprietary B */
+#define J1939_EX_PGN_ENGINE_TEMP    (0x0FEEEUL)     /* ET1 */
+#define J1939_EX_PGN_DM1            (0x0FECAUL)     /* Active diagnostic codes */
+#define J1939_EX_PGN_LOG            (0x0EF00UL)     /* Proprietary A (PDU1) */
+
+#define J1939_EX_STATUS_PERIOD_MS   (100U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static volatile int16_t s_coolant_c = 0;
+static volatile uint8_t s_dm1_faults = 0;
+static volatile bool s_claimed = false;
+static uint8_t s_log[40];
+
+/*******************************************************************************
+ * Callbacks
+ ******************************************************************************/
+
+static void J1939_EX_OnEngineTemp(const j1939_srv_msg_t *msg)
+{
+    /* SPN 110: 1 degC/bit, -40 degC offset */
+    if (msg->length >= 1U && msg->data[0] != 0xFFU) {
+        s_coolant_c = (int16_t)msg->data[0] - 40;
+    }
+}
+
+static void J1939_EX_OnDm1(const j1939_srv_msg_t *msg)
+{
+    /* Two lamp bytes, then 4 bytes per DTC */
+    s_dm1_faults = (msg->length > 2U) ? (uint8_t)((msg->length - 2U) / 4U) : 0U;
+}
+
+static void J1939_EX_OnAddress(j1939_srv_addr_state_t state, uint8_t address)
+{
+    (void)address;
+    s_claimed = (state == J1939_SRV_ADDR_CLAIMED);
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+j1939_srv_status_t J1939_EX_Init(void)
+{
+    j1939_srv_config_t cfg;
+    j1939_srv_status_t status;
+
+    cfg.name = J1939_EX_NAME;
+    cfg.address = J1939_EX_ADDRESS;
+    cfg.address_min = J1939_EX_ADDRESS;
+    cfg.address_max = J1939_EX_ADDRESS_MAX;
+    cfg.on_address = J1939_EX_OnAddress;
+    cfg.on_tx_done = NULL;
+
+    status = J1939_SRV_Init(&cfg);
+    if (status != J1939_SRV_SUCCESS) {
+        return status;
+    }
+
+    status = J1939_SRV_Subscribe(J1939_EX_PGN_ENGINE_TEMP, J1939_EX_OnEngineTemp);
+    if (status != J1939_SRV_SUCCESS) {
+        return status;
+    }
+
+    return J1939_SRV_Subscribe(J1939_EX_PGN_DM1, J1939_EX_OnDm1);
+}
+
+/**
+ * @brief Main loop step
+ * @param now_ms Millisecond time of the caller
+ */
+void J1939_EX_Process(uint32_t now_ms)
+{
+    static uint32_t last_ms = 0;
+    uint8_t status[8] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+
+    J1939_SRV_Process();
+
+    if (s_claimed && (now_ms - last_ms) >= J1939_EX_STATUS_PERIOD_MS) {
+        last_ms = now_ms;
+        status[0] = (uint8_t)(s_coolant_c + 40);
+        status[1] = s_dm1_faults;
+        J1939_SRV_Send(J1939_SRV_PRIO_DEFAULT, J1939_EX_PGN_STATUS, J1939_SRV_ADDR_GLOBAL,
+                       status, sizeof(status));
+    }
+}
+
+/**
+ * @brief Connection-mode transfer to node 0x00
+ */
+j1939_srv_status_t J1939_EX_SendLog(void)
+{
+    for (uint8_t i = 0; i < sizeof(s_log); i++) {
+        s_log[i] = i;
+    }
+
+    return J1939_SRV_Send(J1939_SRV_PRIO_DEFAULT, J1939_EX_PGN_LOG, 0x00U, s_log, sizeof(s_log));
+}
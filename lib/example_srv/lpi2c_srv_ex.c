@@ -0,0 +1,130 @@
+/**
+ * @file    lpi2c_srv_ex.c
+ * @brief   LPI2C Service Example - Sensor Polling Next To CAN
+ * @details Polls two I2C sensors every cycle from the main loop without
+ *          waiting on the bus.
+ *
+ * Setup:
+ * - LPI2C0 on PTA2 (SDA) and PTA3 (SCL), ALT3, 400 kHz
+ * - TMP102 temperature sensor at 0x48 (register 0x00, 2 bytes)
+ * - LIS3DH accelerometer at 0x18 (OUT_X_L | auto-increment, 6 bytes)
+ *
+ * Expected Behavior:
+ * - I2C_EX_Process() queues both reads and returns at once; the LPI2C
+ *   command FIFO and DMA run them back to back
+ * - Results are picked up on a later call once both callbacks have run
+ * - A bus held low by a sensor is recovered by LPI2C_SRV_Process()
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/lpi2c_srv/lpi2c_srv.h"
+#include "../service/port_srv/port_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define I2C_EX_TMP102_ADDR      (0x48U)
+#define I2C_EX_TMP102_TEMP      (0x00U)
+
+#define I2C_EX_LIS3DH_ADDR      (0x18U)
+#define I2C_EX_LIS3DH_CTRL1     (0x20U)
+#define I2C_EX_LIS3DH_OUT_X_L   (0x28U)
+#define I2C_EX_LIS3DH_AUTO_INC  (0x80U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint8_t s_temp_raw[2];
+static uint8_t s_accel_raw[6];
+
+static uint32_t s_queued = 0;              /* Main loop only */
+static volatile uint32_t s_completed = 0;   /* Callback only */
+static volatile uint32_t s_errors = 0;
+
+static int16_t s_temp_c16 = 0;          /* 1/16 degC */
+static int16_t s_accel[3] = { 0 };
+
+/*******************************************************************************
+ * Callback
+ ******************************************************************************/
+
+/**
+ * @brief Transaction done (LPI2C interrupt context)
+ */
+static void I2C_EX_Done(uint8_t address, lpi2c_srv_status_t status, void *user)
+{
+    (void)address;
+    (void)user;
+
+    if (status != LPI2C_SRV_SUCCESS) {
+        s_errors++;
+    }
+    s_completed++;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Bring up the bus and the accelerometer
+ * @note CLOCK_SRV_InitPreset(), PORTA clock, PORT_SRV_Init() and
+ *       GPIO_SRV_Init() must be done.
+ */
+bool I2C_EX_Init(void)
+{
+    static const uint8_t lis3dh_ctrl1 = 0x57U;     /* 100 Hz, XYZ enabled */
+    lpi2c_srv_config_t cfg;
+
+    cfg.baudrate = 400000U;
+    cfg.port = 0;   /* Port A */
+    cfg.scl_pin = 3;
+    cfg.sda_pin = 2;
+    cfg.mux = PORT_SRV_MUX_ALT3;
+    cfg.use_dma = true;
+
+    if (LPI2C_SRV_Init(&cfg) != LPI2C_SRV_SUCCESS) {
+        return false;
+    }
+
+    if (LPI2C_SRV_WriteRegs(I2C_EX_LIS3DH_ADDR, I2C_EX_LIS3DH_CTRL1, &lis3dh_ctrl1, 1U,
+                            I2C_EX_Done, NULL) != LPI2C_SRV_SUCCESS) {
+        return false;
+    }
+    s_queued++;
+
+    return true;
+}
+
+/**
+ * @brief Main loop step - never blocks
+ */
+void I2C_EX_Process(void)
+{
+    LPI2C_SRV_Process();
+
+    if (s_completed != s_queued) {
+        return;
+    }
+
+    /* Previous round complete: convert, then queue the next */
+    s_temp_c16 = (int16_t)(((uint16_t)s_temp_raw[0] << 8) | s_temp_raw[1]) >> 4;
+    for (uint8_t axis = 0; axis < 3U; axis++) {
+        s_accel[axis] = (int16_t)(((uint16_t)s_accel_raw[2U * axis + 1U] << 8) | s_accel_raw[2U * axis]);
+    }
+
+    if (LPI2C_SRV_ReadRegs(I2C_EX_TMP102_ADDR, I2C_EX_TMP102_TEMP, s_temp_raw, sizeof(s_temp_raw),
+                           I2C_EX_Done, NULL) == LPI2C_SRV_SUCCESS) {
+        s_queued++;
+    }
+    if (LPI2C_SRV_ReadRegs(I2C_EX_LIS3DH_ADDR, I2C_EX_LIS3DH_OUT_X_L | I2C_EX_LIS3DH_AUTO_INC,
+                           s_accel_raw, sizeof(s_accel_raw), I2C_EX_Done, NULL) == LPI2C_SRV_SUCCESS) {
+        s_queued++;
+    }
+}
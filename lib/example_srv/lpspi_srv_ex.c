@@ -0,0 +1,138 @@
+/**
+ * @file    lpspi_srv_ex.c
+ * @brief   LPSPI Service Example - External ADC Streaming
+ * @details Streams a 16-bit SPI ADC (e.g. ADS8866-class, conversion
+ *          started by the chip select) into ping-pong buffers.
+ *
+ * Setup:
+ * - LPSPI0 on PTB2 (SCK), PTB3 (SIN), PTB4 (SOUT), PTB5 (PCS1), ALT3
+ * - 4 MHz SCK, mode 0, 16-bit frames, PCS1 active low
+ * - Frames paced by the LPSPI0 input trigger: a free LPIT channel runs
+ *   at 50 kHz and is routed to LPSPI0 through TRGMUX
+ *
+ * Expected Behavior:
+ * - SPI_EX_BufferReady() runs every 256 samples (5.12 ms at 50 kHz)
+ * - No CPU work between buffers
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/lpspi_srv/lpspi_srv.h"
+#include "../service/port_srv/port_srv.h"
+#include "../service/lpit_srv/lpit_srv.h"
+#include "../service/res_srv/res_srv.h"
+#include "../service/trgmux_srv/trgmux_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SPI_EX_SAMPLES      (256U)
+#define SPI_EX_PERIOD_US    (20U)       /* 50 kHz */
+#define SPI_EX_RES_OWNER    (0x40U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint16_t s_ping[SPI_EX_SAMPLES];
+static uint16_t s_pong[SPI_EX_SAMPLES];
+
+static volatile uint32_t s_sum = 0;
+static volatile bool s_ready = false;
+
+static lpit_srv_config_t s_pacer;
+
+/*******************************************************************************
+ * Callback
+ ******************************************************************************/
+
+/**
+ * @brief One buffer full (DMA interrupt context)
+ * @details The other buffer is being filled; this one must be consumed
+ *          within SPI_EX_SAMPLES sample periods.
+ */
+static void SPI_EX_BufferReady(lpspi_srv_instance_t instance, const uint16_t *samples, uint16_t count)
+{
+    uint32_t sum = 0;
+
+    (void)instance;
+
+    for (uint16_t i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+
+    s_sum = sum;
+    s_ready = true;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Start streaming from the external ADC
+ * @note CLOCK_SRV_InitPreset(), PORTB and LPIT clocks must be set up.
+ */
+bool SPI_EX_StartAdcStream(void)
+{
+    port_srv_pin_config_t pin;
+    lpspi_srv_config_t spi_cfg;
+    lpspi_srv_stream_config_t stream_cfg;
+    trgmux_srv_route_t route;
+
+    pin.port = 1;   /* Port B */
+    pin.mux = PORT_SRV_MUX_ALT3;
+    pin.pull = PORT_SRV_PULL_DISABLE;
+    pin.interrupt = PORT_SRV_INT_DISABLE;
+    for (uint8_t p = 2; p <= 5U; p++) {
+        pin.pin = p;
+        PORT_SRV_ConfigPin(&pin);
+    }
+
+    spi_cfg.baudrate = 4000000U;
+    spi_cfg.frame_bits = 16U;
+    spi_cfg.mode = LPSPI_SRV_MODE_0;
+    spi_cfg.pcs = 1U;
+    spi_cfg.pcs_active_high = false;
+    spi_cfg.lsb_first = false;
+
+    if (LPSPI_SRV_Init(LPSPI_SRV_INSTANCE_0, &spi_cfg) != LPSPI_SRV_SUCCESS) {
+        return false;
+    }
+
+    stream_cfg.buffer[0] = s_ping;
+    stream_cfg.buffer[1] = s_pong;
+    stream_cfg.samples = SPI_EX_SAMPLES;
+    stream_cfg.command = 0x0000U;
+    stream_cfg.trigger = LPSPI_SRV_TRIGGER_INPUT;
+    stream_cfg.trigger_active_high = true;
+    stream_cfg.callback = SPI_EX_BufferReady;
+
+    if (LPSPI_SRV_StartStream(LPSPI_SRV_INSTANCE_0, &stream_cfg) != LPSPI_SRV_SUCCESS) {
+        return false;
+    }
+
+    /* Pacer: LPIT channel -> LPSPI0 trigger input, no interrupt */
+    if (LPIT_SRV_Init() != LPIT_SRV_SUCCESS ||
+        RES_SRV_Alloc(RES_SRV_LPIT_CHANNEL, SPI_EX_RES_OWNER, &s_pacer.channel) != RES_SRV_SUCCESS) {
+        return false;
+    }
+
+    route.source = (trgmux_source_t)(TRGMUX_SOURCE_LPIT_CH0 + s_pacer.channel);
+    route.target = TRGMUX_TARGET_LPSPI0_TRG;
+    if (TRGMUX_SRV_Apply(&route, 1U, false) != TRGMUX_SRV_SUCCESS) {
+        return false;
+    }
+
+    s_pacer.period_us = SPI_EX_PERIOD_US;
+    s_pacer.is_running = false;
+    if (LPIT_SRV_Config(&s_pacer, NULL) != LPIT_SRV_SUCCESS) {
+        return false;
+    }
+
+    return LPIT_SRV_Start(&s_pacer) == LPIT_SRV_SUCCESS;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file    lut_srv_ex.c
+ * @brief   LUT Service Example - Thermistor Linearization
+ * @details Converts a ramp over the full ADC range through the NTC table
+ *          and compares the block conversion cost with the per-sample
+ *          division it replaces. Prints the results over UART.
+ *
+ * Setup:
+ * - UART_SRV_Init(LUT_EX_UART, ...)
+ *
+ * Expected Behavior:
+ * - Mid-scale (2048 counts) reads 25.00 degC, the pull-up and the NTC
+ *   being equal at 25 degC
+ * - The block conversion takes around 10 cycles per sample; the
+ *   division-based voltage conversion (UDIV is 2-12 cycles on the M4)
+ *   costs about as much for a straight line only
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/lut_srv/lut_srv_cal.h"
+#include "../service/uart_srv/uart_srv.h"
+#include "../driver/ultis/dwt_ultis.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define LUT_EX_UART             (UART_SRV_INSTANCE_1)
+#define LUT_EX_CHANNEL          (13U)
+#define LUT_EX_SAMPLES          (256U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint16_t s_raw[LUT_EX_SAMPLES];
+static int32_t s_values[LUT_EX_SAMPLES];
+
+/* Keeps the reference loop from being optimized away */
+static volatile uint32_t s_divisor = 4096U;
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Run the example
+ * @return true if mid-scale converts to 25.00 degC
+ */
+bool LUT_EX_Run(void)
+{
+    uint32_t start;
+    uint32_t lut_cycles;
+    uint32_t div_cycles;
+    uint32_t divisor = s_divisor;
+
+    if (LUT_SRV_Init() != LUT_SRV_SUCCESS ||
+        LUT_SRV_Attach(LUT_EX_CHANNEL, &LUT_SRV_CAL_NTC_10K_3435) != LUT_SRV_SUCCESS) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < LUT_EX_SAMPLES; i++) {
+        s_raw[i] = (uint16_t)(i * 16U);
+    }
+
+    DWT_CycleCounterStart();
+
+    start = DWT_GetCycles();
+    LUT_SRV_ConvertBlock(LUT_EX_CHANNEL, s_raw, s_values, LUT_EX_SAMPLES);
+    lut_cycles = DWT_GetCycles() - start;
+
+    start = DWT_GetCycles();
+    for (uint32_t i = 0; i < LUT_EX_SAMPLES; i++) {
+        s_values[i] = (int32_t)(((uint32_t)s_raw[i] * 5000U) / divisor);
+    }
+    div_cycles = DWT_GetCycles() - start;
+
+    LUT_SRV_ConvertBlock(LUT_EX_CHANNEL, s_raw, s_values, LUT_EX_SAMPLES);
+
+    UART_SRV_Printf(LUT_EX_UART, "\r\nNTC table: %u cycles/sample (divide: %u)\r\n",
+                    (unsigned)(lut_cycles / LUT_EX_SAMPLES), (unsigned)(div_cycles / LUT_EX_SAMPLES));
+
+    for (uint32_t i = 0; i < LUT_EX_SAMPLES; i += 16U) {
+        int32_t t = s_values[i];
+        int32_t abs_t = (t < 0) ? -t : t;
+
+        UART_SRV_Printf(LUT_EX_UART, "%u counts: %s%u.%02u degC\r\n", (unsigned)s_raw[i],
+                        (t < 0) ? "-" : "", (unsigned)(abs_t / 100), (unsigned)(abs_t % 100));
+    }
+
+    return s_values[LUT_EX_SAMPLES / 2U] == 2500;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file    scope_srv_ex.c
+ * @brief   Scope Service Example - Button-Triggered Capture
+ * @details Samples the potentiometer at 10 kHz with PDB0 and freezes
+ *          256 samples before and 768 after a level crossing or a press
+ *          of SW2, then prints the window over UART. Also measures what
+ *          the trigger check costs per sample.
+ *
+ * Setup:
+ * - ADC0 channel 12 on PTB3 (potentiometer), ADC_SRV_Init() done
+ * - SW2 on PTC12 (PORT and GPIO services initialized, PORTC clock on)
+ * - UART_SRV_Init(SCOPE_EX_UART, ...)
+ *
+ * Expected Behavior:
+ * - Turning the potentiometer through mid-scale prints "level" and a
+ *   window whose sample 256 is the first one at or above 2048
+ * - Pressing SW2 prints "external" and the window around the press
+ * - The push cost printed at start is a few tens of cycles per sample
+ *   (call, store and two compares), i.e. well under 1 % at 10 kHz
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/scope_srv/scope_srv.h"
+#include "../service/adc_srv/adc_srv.h"
+#include "../service/gpio_srv/gpio_srv.h"
+#include "../service/port_srv/port_srv.h"
+#include "../service/uart_srv/uart_srv.h"
+#include "../driver/nvic/nvic.h"
+#include "../driver/ultis/dwt_ultis.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SCOPE_EX_UART           (UART_SRV_INSTANCE_1)
+#define SCOPE_EX_CHANNEL        (12U)
+#define SCOPE_EX_PERIOD_US      (100U)
+#define SCOPE_EX_SIZE           (1024U)
+#define SCOPE_EX_PRE            (256U)
+#define SCOPE_EX_POST           (768U)
+#define SCOPE_EX_LEVEL          (2048U)
+#define SCOPE_EX_BTN_PORT       (2U)            /* Port C */
+#define SCOPE_EX_BTN_PIN        (12U)           /* SW2 */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint16_t s_history[SCOPE_EX_SIZE];
+static uint8_t s_packed[SCOPE_SRV_PACKED_SIZE(SCOPE_EX_PRE + SCOPE_EX_POST)];
+
+static const scope_srv_arm_t s_arm = {
+    SCOPE_SRV_TRIGGER_LEVEL, false, SCOPE_EX_LEVEL
+};
+
+/*******************************************************************************
+ * Callbacks
+ ******************************************************************************/
+
+/**
+ * @brief Sequence complete (ADC0 interrupt context)
+ */
+static void SCOPE_EX_Sample(const uint16_t *raw, uint8_t count)
+{
+    SCOPE_SRV_PushBlock(raw, count);
+}
+
+/**
+ * @brief SW2 pressed (PORTC interrupt context)
+ */
+static void SCOPE_EX_Button(uint8_t port, uint8_t pin)
+{
+    (void)port;
+    (void)pin;
+
+    SCOPE_SRV_ForceTrigger();
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Cycles per pushed sample while armed (no trigger fires)
+ */
+static uint32_t SCOPE_EX_MeasurePush(void)
+{
+    scope_srv_arm_t arm = { SCOPE_SRV_TRIGGER_LEVEL, false, 0xFFFFU };
+    uint32_t start;
+
+    SCOPE_SRV_Arm(&arm);
+    DWT_CycleCounterStart();
+
+    start = DWT_GetCycles();
+    for (uint32_t i = 0; i < SCOPE_EX_SIZE; i++) {
+        SCOPE_SRV_Push((uint16_t)(i & 0x0FFFU));
+    }
+
+    return (DWT_GetCycles() - start) / SCOPE_EX_SIZE;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Configure the capture, the button and the sequence
+ */
+bool SCOPE_EX_Start(void)
+{
+    scope_srv_config_t scope_cfg;
+    adc_srv_sequence_config_t seq;
+    port_srv_pin_config_t port_cfg;
+
+    scope_cfg.buffer = s_history;
+    scope_cfg.size = SCOPE_EX_SIZE;
+    scope_cfg.pre = SCOPE_EX_PRE;
+    scope_cfg.post = SCOPE_EX_POST;
+    if (SCOPE_SRV_Init(&scope_cfg) != SCOPE_SRV_SUCCESS) {
+        return false;
+    }
+
+    UART_SRV_Printf(SCOPE_EX_UART, "\r\nScope push: %u cycles/sample\r\n",
+                    (unsigned)SCOPE_EX_MeasurePush());
+
+    port_cfg.port = SCOPE_EX_BTN_PORT;
+    port_cfg.pin = SCOPE_EX_BTN_PIN;
+    port_cfg.mux = PORT_SRV_MUX_GPIO;
+    port_cfg.pull = PORT_SRV_PULL_UP;
+    port_cfg.interrupt = PORT_SRV_INT_FALLING;
+    if (PORT_SRV_ConfigPin(&port_cfg) != PORT_SRV_SUCCESS ||
+        GPIO_SRV_ConfigInput(SCOPE_EX_BTN_PORT, SCOPE_EX_BTN_PIN) != GPIO_SRV_SUCCESS ||
+        GPIO_SRV_EnableInterrupt(SCOPE_EX_BTN_PORT, SCOPE_EX_BTN_PIN,
+                                 GPIO_SRV_INT_FALLING_EDGE, SCOPE_EX_Button) != GPIO_SRV_SUCCESS) {
+        return false;
+    }
+    NVIC_EnableInterrupt(PORTC_IRQn);
+    NVIC_SetPriority(PORTC_IRQn, 3);
+
+    if (SCOPE_SRV_Arm(&s_arm) != SCOPE_SRV_SUCCESS) {
+        return false;
+    }
+
+    /* PDB0 restarts itself every SCOPE_EX_PERIOD_US after one software trigger */
+    memset(&seq, 0, sizeof(seq));
+    seq.channels[0] = SCOPE_EX_CHANNEL;
+    seq.count = 1U;
+    seq.period_us = SCOPE_EX_PERIOD_US;
+    seq.trigger = ADC_SRV_TRIGGER_SOFTWARE;
+    seq.callback = SCOPE_EX_Sample;
+
+    if (ADC_SRV_StartSequence(&seq) != ADC_SRV_SUCCESS) {
+        return false;
+    }
+
+    return ADC_SRV_TriggerSequence() == ADC_SRV_SUCCESS;
+}
+
+/**
+ * @brief Print a frozen capture and re-arm (main loop)
+ */
+void SCOPE_EX_Process(void)
+{
+    scope_srv_capture_t info;
+    uint16_t length;
+
+    if (SCOPE_SRV_GetState() != SCOPE_SRV_STATE_DONE) {
+        return;
+    }
+
+    length = SCOPE_SRV_ReadPacked(s_packed, sizeof(s_packed), &info);
+    SCOPE_SRV_Arm(&s_arm);
+
+    UART_SRV_Printf(SCOPE_EX_UART, "Trigger %s at sample %lu, %u + %u samples:\r\n",
+                    (info.source == SCOPE_SRV_TRIGGER_EXTERNAL) ? "external" : "level",
+                    (unsigned long)info.trigger_sample, (unsigned)info.pre, (unsigned)info.post);
+
+    /* Unpack pairs: [a11..a4] [a3..a0 b11..b8] [b7..b0] */
+    for (uint16_t i = 0; (i + 2U) < length; i += 3U) {
+        UART_SRV_Printf(SCOPE_EX_UART, "%u\r\n%u\r\n",
+                        (unsigned)(((uint16_t)s_packed[i] << 4) | (s_packed[i + 1U] >> 4)),
+                        (unsigned)((((uint16_t)s_packed[i + 1U] & 0x0FU) << 8) | s_packed[i + 2U]));
+    }
+}
@@ -0,0 +1,170 @@
+/**
+ * @file    secoc_bench_ex.c
+ * @brief   SecOC Service Example - MAC Engine Benchmark
+ * @details Checks both MAC engines of secoc_srv against the RFC 4493
+ *          AES-128 CMAC test vectors, then times them with the DWT cycle
+ *          counter for message sizes around one CAN frame and prints a
+ *          table over UART.
+ *
+ * Expected Behavior (160 MHz core):
+ * - Both engines return the RFC 4493 MACs
+ * - CSEc needs a few microseconds per frame-sized MAC, including the
+ *   CSE_PRAM copy; software AES-128 needs a few tens of microseconds
+ * - "sw only" is printed if FlexNVM is not partitioned for CSEc keys
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/secoc_srv/secoc_srv.h"
+#include "../service/clock_srv/clock_srv.h"
+#include "../service/uart_srv/uart_srv.h"
+#include "../driver/ultis/dwt_ultis.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SECOC_BENCH_MAX_SIZE    (64U)
+#define SECOC_BENCH_REPEAT      (8U)
+#define SECOC_BENCH_UART        (UART_SRV_INSTANCE_1)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* RFC 4493 section 4 */
+static const uint8_t s_rfc_key[SECOC_SRV_KEY_SIZE] = {
+    0x2BU, 0x7EU, 0x15U, 0x16U, 0x28U, 0xAEU, 0xD2U, 0xA6U,
+    0xABU, 0xF7U, 0x15U, 0x88U, 0x09U, 0xCFU, 0x4FU, 0x3CU
+};
+
+static const uint8_t s_rfc_msg[SECOC_BENCH_MAX_SIZE] = {
+    0x6BU, 0xC1U, 0xBEU, 0xE2U, 0x2EU, 0x40U, 0x9FU, 0x96U,
+    0xE9U, 0x3DU, 0x7EU, 0x11U, 0x73U, 0x93U, 0x17U, 0x2AU,
+    0xAEU, 0x2DU, 0x8AU, 0x57U, 0x1EU, 0x03U, 0xACU, 0x9CU,
+    0x9EU, 0xB7U, 0x6FU, 0xACU, 0x45U, 0xAFU, 0x8EU, 0x51U,
+    0x30U, 0xC8U, 0x1CU, 0x46U, 0xA3U, 0x5CU, 0xE4U, 0x11U,
+    0xE5U, 0xFBU, 0xC1U, 0x19U, 0x1AU, 0x0AU, 0x52U, 0xEFU,
+    0xF6U, 0x9FU, 0x24U, 0x45U, 0xDFU, 0x4FU, 0x9BU, 0x17U,
+    0xADU, 0x2BU, 0x41U, 0x7BU, 0xE6U, 0x6CU, 0x37U, 0x10U
+};
+
+static const struct {
+    uint16_t length;
+    uint8_t mac[SECOC_SRV_MAC_SIZE];
+} s_rfc_vectors[] = {
+    { 0U,  { 0xBBU, 0x1DU, 0x69U, 0x29U, 0xE9U, 0x59U, 0x37U, 0x28U,
+             0x7FU, 0xA3U, 0x7DU, 0x12U, 0x9BU, 0x75U, 0x67U, 0x46U } },
+    { 16U, { 0x07U, 0x0AU, 0x16U, 0xB4U, 0x6BU, 0x4DU, 0x41U, 0x44U,
+             0xF7U, 0x9BU, 0xDDU, 0x9DU, 0xD0U, 0x4AU, 0x28U, 0x7CU } },
+    { 40U, { 0xDFU, 0xA6U, 0x67U, 0x47U, 0xDEU, 0x9AU, 0xE6U, 0x30U,
+             0x30U, 0xCAU, 0x32U, 0x61U, 0x14U, 0x97U, 0xC8U, 0x27U } },
+    { 64U, { 0x51U, 0xF0U, 0xBEU, 0xBFU, 0x7EU, 0xE9U, 0xBBU, 0x3AU,
+             0xB0U, 0xB3U, 0x1CU, 0x1FU, 0xE9U, 0xB6U, 0xA1U, 0xC8U } }
+};
+
+/* DataID + data + FV of secured CAN frames, then multi-block messages */
+static const uint16_t s_bench_sizes[] = { 8U, 10U, 14U, 16U, 32U, 64U };
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Average cycles of one MAC over length bytes on a given engine
+ * @return uint32_t Cycles, 0 if the engine failed
+ */
+static uint32_t SECOC_Bench_Measure(secoc_srv_engine_t engine, uint16_t length)
+{
+    uint8_t mac[SECOC_SRV_MAC_SIZE];
+    uint32_t start;
+    uint32_t total = 0;
+
+    for (uint32_t i = 0; i < SECOC_BENCH_REPEAT; i++) {
+        start = DWT_GetCycles();
+        if (SECOC_SRV_ComputeMac(engine, s_rfc_msg, length, mac) != SECOC_SRV_SUCCESS) {
+            return 0U;
+        }
+        total += DWT_GetCycles() - start;
+    }
+
+    return total / SECOC_BENCH_REPEAT;
+}
+
+/**
+ * @brief Check an engine against the RFC 4493 vectors
+ */
+static bool SECOC_Bench_Check(secoc_srv_engine_t engine)
+{
+    uint8_t mac[SECOC_SRV_MAC_SIZE];
+
+    for (uint32_t i = 0; i < sizeof(s_rfc_vectors) / sizeof(s_rfc_vectors[0]); i++) {
+        if (SECOC_SRV_ComputeMac(engine, s_rfc_msg, s_rfc_vectors[i].length, mac) != SECOC_SRV_SUCCESS ||
+            memcmp(mac, s_rfc_vectors[i].mac, SECOC_SRV_MAC_SIZE) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Run the benchmark
+ * @note CAN_SRV_Init() and UART_SRV_Init(SECOC_BENCH_UART, ...) must have
+ *       been called, SECOC_SRV_Init() must not: the service is initialized
+ *       here with the RFC 4493 key.
+ * @return true if every available engine returned the reference MACs
+ */
+bool SECOC_BENCH_Run(void)
+{
+    secoc_srv_config_t config;
+    clock_srv_frequencies_t freq;
+    uint32_t mhz;
+    uint32_t sw_cycles;
+    uint32_t hw_cycles;
+    bool has_csec;
+    bool match;
+
+    config.key = s_rfc_key;
+    config.engine = SECOC_SRV_ENGINE_AUTO;
+    if (SECOC_SRV_Init(&config) != SECOC_SRV_SUCCESS) {
+        UART_SRV_SendString(SECOC_BENCH_UART, "SecOC init failed\r\n");
+        return false;
+    }
+
+    CLOCK_SRV_GetFrequencies(&freq);
+    mhz = freq.core_hz / 1000000U;
+    DWT_CycleCounterStart();
+
+    has_csec = (SECOC_SRV_GetEngine() == SECOC_SRV_ENGINE_CSEC);
+
+    match = SECOC_Bench_Check(SECOC_SRV_ENGINE_SW);
+    if (has_csec && !SECOC_Bench_Check(SECOC_SRV_ENGINE_CSEC)) {
+        match = false;
+    }
+
+    UART_SRV_Printf(SECOC_BENCH_UART, "\r\nCMAC check %s, %s\r\n",
+                    match ? "ok" : "MISMATCH", has_csec ? "csec + sw" : "sw only");
+    UART_SRV_SendString(SECOC_BENCH_UART, "AES-CMAC cycles: size  sw  csec  (us)\r\n");
+
+    for (uint32_t i = 0; i < sizeof(s_bench_sizes) / sizeof(s_bench_sizes[0]); i++) {
+        uint16_t size = s_bench_sizes[i];
+
+        sw_cycles = SECOC_Bench_Measure(SECOC_SRV_ENGINE_SW, size);
+        hw_cycles = has_csec ? SECOC_Bench_Measure(SECOC_SRV_ENGINE_CSEC, size) : 0U;
+
+        UART_SRV_Printf(SECOC_BENCH_UART, "%u %u %u  (%u %u)\r\n",
+                        (unsigned)size, (unsigned)sw_cycles, (unsigned)hw_cycles,
+                        (unsigned)(sw_cycles / mhz), (unsigned)(hw_cycles / mhz));
+    }
+
+    return match;
+}
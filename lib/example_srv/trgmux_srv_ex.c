@@ -0,0 +1,80 @@
+/**
+ * @file    trgmux_srv_ex.c
+ * @brief   Trigger Routing Service Example - Timer -> PDB -> ADC -> DMA Chain
+ * @details Wires a sampling chain in the trigger fabric and prints the
+ *          result of the hardware read-back.
+ *
+ * Setup:
+ * - LPIT channel 1 starts PDB0 (PDB0 then fires the ADC0 pre-triggers)
+ * - The same LPIT pulse is mirrored on TRGMUX_OUT0 for a scope probe
+ *   (pin mux done by the board setup)
+ * - ADC0 conversion complete paces the DMAMUX periodic trigger of DMA
+ *   channel 0
+ * - Dump printed on LPUART1
+ *
+ * Expected Behavior:
+ * - TRGMUX_EX_Run() returns true and prints:
+ *     DMA_CH0 <- ADC0_SC1A_COCO
+ *     TRGMUX_OUT0 <- LPIT_CH1
+ *     PDB0_TRG_IN <- LPIT_CH1
+ * - The conflicting table is rejected at index 1 without touching the
+ *   hardware
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/trgmux_srv/trgmux_srv.h"
+#include "../service/uart_srv/uart_srv.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const trgmux_srv_route_t s_chain[] = {
+    { TRGMUX_SOURCE_LPIT_CH1,       TRGMUX_TARGET_PDB0_TRG_IN },
+    { TRGMUX_SOURCE_LPIT_CH1,       TRGMUX_TARGET_TRGMUX_OUT0 },
+    { TRGMUX_SOURCE_ADC0_SC1A_COCO, TRGMUX_TARGET_DMA_CH0 }
+};
+
+/* PDB0 is already driven by LPIT channel 1 */
+static const trgmux_srv_route_t s_conflicting[] = {
+    { TRGMUX_SOURCE_FTM0_INIT,      TRGMUX_TARGET_FTM1_HWTRIG0 },
+    { TRGMUX_SOURCE_FTM0_INIT,      TRGMUX_TARGET_PDB0_TRG_IN }
+};
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static void TRGMUX_EX_Print(const char *line)
+{
+    UART_SRV_SendString(UART_SRV_INSTANCE_1, line);
+    UART_SRV_SendString(UART_SRV_INSTANCE_1, "\r\n");
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Apply the chain, check the conflict and dump the fabric
+ * @note UART_SRV_Init(UART_SRV_INSTANCE_1, ...) must have been called.
+ */
+bool TRGMUX_EX_Run(void)
+{
+    uint8_t failed = 0xFFU;
+
+    if (TRGMUX_SRV_Apply(s_chain, sizeof(s_chain) / sizeof(s_chain[0]), false) != TRGMUX_SRV_SUCCESS) {
+        return false;
+    }
+
+    if (TRGMUX_SRV_Validate(s_conflicting, sizeof(s_conflicting) / sizeof(s_conflicting[0]),
+                            &failed) != TRGMUX_SRV_CONFLICT || failed != 1U) {
+        return false;
+    }
+
+    return TRGMUX_SRV_Dump(TRGMUX_EX_Print) == 3U;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file    uds_srv_ex.c
+ * @brief   UDS Service Example - Diagnostic Server with Live Data
+ * @details Exposes a counter, a writable setpoint and a self-test routine
+ *          to a tester on the standard OBD diagnostic IDs.
+ *
+ * Setup:
+ * - CLOCK_SRV_Init() and CAN_SRV_Init() at 500 Kbps
+ * - UDS_EX_Process() called from the main loop
+ *
+ * Expected Behavior (tester requests on 0x7E0, responses on 0x7E8):
+ * - 22 F1 90 22 01 -> 62 F1 90 <counter, 4 bytes> 22 01 <setpoint, 2 bytes>
+ *   (multi-DID read, one response; more than 7 bytes uses ISO-TP frames)
+ * - 2E 22 01 00 64 -> 7F 2E 31 in the default session
+ * - 10 03 then 2E 22 01 00 64 -> 50 03 00 32 01 F4, then 6E 22 01
+ * - 31 01 02 00 -> 71 01 02 00 <self-test result>
+ * - 3E 80 on 0x7DF every 2 s keeps the extended session open, no response
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/uds_srv/uds_srv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define UDS_EX_DID_COUNTER          (0xF190U)
+#define UDS_EX_DID_SETPOINT         (0x2201U)
+#define UDS_EX_RID_SELF_TEST        (0x0200U)
+
+#define UDS_EX_SETPOINT_MAX         (1000U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static volatile uint32_t s_counter = 0;
+static uint16_t s_setpoint = 50;
+
+/*******************************************************************************
+ * Handlers
+ ******************************************************************************/
+
+static void UDS_EX_ReadSetpoint(uint8_t *out)
+{
+    out[0] = (uint8_t)(s_setpoint >> 8);
+    out[1] = (uint8_t)s_setpoint;
+}
+
+static uint8_t UDS_EX_WriteSetpoint(const uint8_t *in)
+{
+    uint16_t value = (uint16_t)(((uint16_t)in[0] << 8) | in[1]);
+
+    if (value > UDS_EX_SETPOINT_MAX) {
+        return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+    }
+
+    s_setpoint = value;
+
+    return UDS_SRV_NRC_OK;
+}
+
+static uint8_t UDS_EX_SelfTest(uint8_t control, const uint8_t *option, uint16_t option_length,
+                               uint8_t *result, uint16_t *result_length)
+{
+    (void)option;
+    (void)option_length;
+
+    if (control != UDS_SRV_ROUTINE_START) {
+        return UDS_SRV_NRC_SUBFUNCTION_NOT_SUPPORTED;
+    }
+
+    result[0] = (s_setpoint <= UDS_EX_SETPOINT_MAX) ? 0x00U : 0x01U;
+    *result_length = 1U;
+
+    return UDS_SRV_NRC_OK;
+}
+
+static const uds_srv_did_t s_dids[] = {
+    UDS_SRV_DID_VAR(UDS_EX_DID_COUNTER, UDS_SRV_DID_READ, s_counter),
+    UDS_SRV_DID_FN(UDS_EX_DID_SETPOINT, 2U, UDS_SRV_DID_RW | UDS_SRV_DID_EXTENDED,
+                   UDS_EX_ReadSetpoint, UDS_EX_WriteSetpoint),
+};
+
+static const uds_srv_routine_t s_routines[] = {
+    { UDS_EX_RID_SELF_TEST, false, UDS_EX_SelfTest },
+};
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+uds_srv_status_t UDS_EX_Init(void)
+{
+    uds_srv_config_t cfg;
+
+    cfg.rx_id = 0x7E0U;
+    cfg.tx_id = 0x7E8U;
+    cfg.functional_id = 0x7DFU;
+    cfg.dids = s_dids;
+    cfg.did_count = (uint8_t)(sizeof(s_dids) / sizeof(s_dids[0]));
+    cfg.routines = s_routines;
+    cfg.routine_count = (uint8_t)(sizeof(s_routines) / sizeof(s_routines[0]));
+    cfg.on_session = NULL;
+
+    return UDS_SRV_Init(&cfg);
+}
+
+/**
+ * @brief Main loop step
+ */
+void UDS_EX_Process(void)
+{
+    s_counter++;
+    UDS_SRV_Process();
+}
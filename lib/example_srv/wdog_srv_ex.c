@@ -0,0 +1,105 @@
+/**
+ * @file    wdog_srv_ex.c
+ * @brief   Watchdog Service Example - Supervised Main Loop
+ * @details Two supervised tasks on a 100 ms windowed watchdog. One task
+ *          checks in from an interrupt, the other from the main loop.
+ *          Setting WDOG_EX_HANG makes the main loop task stop checking in
+ *          so the supervisor latches it and the watchdog resets the node.
+ *
+ * Setup:
+ * - LPIT channel running at 10 ms with WDOG_EX_Tick() as its callback
+ * - Timeout 100 ms, window 10 ms
+ *
+ * Expected Behavior:
+ * - WDOG_EX_Init() returns the reset cause: true after a watchdog reset
+ * - While both tasks run, refresh_count grows and min_margin_us stays
+ *   close to 90 ms (refresh right after the window opens)
+ * - After s_hang is set, "loop" is reported in expired_task within
+ *   50 ms and the node resets about 100 ms later
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../service/wdog_srv/wdog_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define WDOG_EX_TIMEOUT_MS      (100U)
+#define WDOG_EX_WINDOW_MS       (10U)
+
+#define WDOG_EX_TICK_DEADLINE   (30U)       /* 3 LPIT periods */
+#define WDOG_EX_LOOP_DEADLINE   (50U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint8_t s_tick_task = WDOG_SRV_NO_TASK;
+static uint8_t s_loop_task = WDOG_SRV_NO_TASK;
+
+static volatile bool s_hang = false;            /* Set from the debugger */
+static volatile uint8_t s_missed = WDOG_SRV_NO_TASK;
+
+static wdog_srv_stats_t s_stats;
+
+/*******************************************************************************
+ * Callback
+ ******************************************************************************/
+
+/**
+ * @brief First deadline miss (main loop context)
+ */
+static void WDOG_EX_Miss(uint8_t task)
+{
+    s_missed = task;
+}
+
+/*******************************************************************************
+ * Example
+ ******************************************************************************/
+
+/**
+ * @brief Register the tasks and start the watchdog
+ * @return true if the previous reset was a watchdog reset
+ */
+bool WDOG_EX_Init(void)
+{
+    wdog_srv_config_t cfg;
+
+    WDOG_SRV_RegisterTask("tick", WDOG_EX_TICK_DEADLINE, &s_tick_task);
+    WDOG_SRV_RegisterTask("loop", WDOG_EX_LOOP_DEADLINE, &s_loop_task);
+
+    cfg.timeout_ms = WDOG_EX_TIMEOUT_MS;
+    cfg.window_ms = WDOG_EX_WINDOW_MS;
+    cfg.lock = true;
+    cfg.on_miss = WDOG_EX_Miss;
+    WDOG_SRV_Init(&cfg);
+
+    return WDOG_SRV_WasWatchdogReset();
+}
+
+/**
+ * @brief Periodic interrupt (LPIT callback)
+ */
+void WDOG_EX_Tick(void)
+{
+    WDOG_SRV_CheckIn(s_tick_task);
+}
+
+/**
+ * @brief Main loop step
+ */
+void WDOG_EX_Process(void)
+{
+    if (!s_hang) {
+        WDOG_SRV_CheckIn(s_loop_task);
+    }
+
+    WDOG_SRV_Process();
+    WDOG_SRV_GetStats(&s_stats);
+}
@@ -14,10 +14,22 @@
 // #include "../inc/adc_srv.h"
 // #include "../../../../Core/BareMetal/adc/adc.h"
 #include "adc_srv.h"
+#include "../clock_srv/clock_srv.h"
 #include "../../driver/adc/adc.h"
+#include "../../driver/pdb/pdb.h"
 #include "../../driver/nvic/nvic.h"
 #include <stddef.h>
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define ADC_SRV_PDB_IRQ_PRIORITY    (5U)
+#define ADC_SRV_NS_PER_S            (1000000000ULL)
+#define ADC_SRV_RESOLUTION_BITS     (12U)
+
+/** @brief Counts to mV: one multiply and a shift (full scale is a power of two) */
+#define ADC_SRV_TO_MV(raw)          (((uint32_t)(raw) * s_ref_voltage_mv) >> ADC_SRV_RESOLUTION_BITS)
+
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
@@ -27,6 +39,13 @@ static uint32_t s_ref_voltage_mv = 5000; /* Default 5V reference */
 static adc_srv_user_callback_t s_user_callback = NULL;
 static volatile bool s_conversion_busy = false;
 
+/* Hardware-timed sequence (PDB0 -> ADC0) */
+static bool s_sequence_active = false;
+static adc_srv_sequence_callback_t s_sequence_callback = NULL;
+static volatile uint32_t s_sequence_errors = 0;
+
+static const uint8_t s_pdb_mult_factor[4] = { 1U, 10U, 20U, 40U };
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
@@ -39,7 +58,7 @@ static volatile bool s_conversion_busy = false;
  */
 static void ADC_SRV_DriverCallback(ADC_Type *adc, adc_channel_t channel, uint16_t rawValue) {
     /* Convert raw value to voltage */
-    uint32_t voltage_mv = (uint32_t)((rawValue * s_ref_voltage_mv) / 4096U);
+    uint32_t voltage_mv = ADC_SRV_TO_MV(rawValue);
     
     /* Clear busy flag */
     s_conversion_busy = false;
@@ -50,6 +69,58 @@ static void ADC_SRV_DriverCallback(ADC_Type *adc, adc_channel_t channel, uint16_
     }
 }
 
+/**
+ * @brief Sequence complete (ADC0 interrupt, last slot)
+ */
+static void ADC_SRV_SequenceCallback(ADC_Type *adc, const uint16_t *results, uint8_t count)
+{
+    (void)adc;
+
+    if (s_sequence_callback != NULL) {
+        s_sequence_callback(results, count);
+    }
+}
+
+/**
+ * @brief PDB0 sequence error: a pre-trigger found its previous result unread
+ */
+static void ADC_SRV_PdbCallback(PDB_Type *instance, uint32_t flags, void *userData)
+{
+    (void)userData;
+
+    if ((flags & PDB_EVENT_SEQUENCE_ERROR) != 0U) {
+        s_sequence_errors++;
+        PDB_ClearSequenceErrors(instance, 0U, PDB_S_ERR_MASK);
+    }
+}
+
+/**
+ * @brief Finest PDB clock whose counter still covers span_ns
+ * @param bus_hz PDB input clock
+ * @param span_ns Longest delay or period to represent
+ * @param config Receives prescaler and mult
+ * @return uint32_t Divider (prescaler * mult), 0 if span_ns does not fit
+ */
+static uint32_t ADC_SRV_SelectPdbClock(uint32_t bus_hz, uint64_t span_ns, pdb_config_t *config)
+{
+    uint32_t best = 0;
+    uint32_t div;
+
+    for (uint8_t m = 0; m < 4U; m++) {
+        for (uint8_t p = 0; p < 8U; p++) {
+            div = (uint32_t)s_pdb_mult_factor[m] << p;
+            if ((best == 0U || div < best) &&
+                span_ns * bus_hz / ((uint64_t)div * ADC_SRV_NS_PER_S) <= PDB_MAX_COUNT) {
+                best = div;
+                config->prescaler = p;
+                config->mult = (pdb_mult_t)m;
+            }
+        }
+    }
+
+    return best;
+}
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -101,6 +172,12 @@ adc_srv_status_t ADC_SRV_Start(adc_srv_config_t *config)
 	        return ADC_SRV_NOT_INITIALIZED;
 	    }
 
+	    /* SC1[0] belongs to the PDB while a sequence is armed */
+	    if (s_sequence_active)
+	    {
+	        return ADC_SRV_BUSY;
+	    }
+
 	    /* Interrupt configuration on slot 0 */
 	    adc_status_t status = ADC_InterruptConfig(s_adc_instance, config->interrupt);
 	    /* Start conversion on slot 0 */
@@ -115,7 +192,7 @@ adc_srv_status_t ADC_SRV_Start(adc_srv_config_t *config)
 	    /* Read raw value */
 	    config->raw_value = (uint16_t)ADC_ReadRaw(s_adc_instance);
 
-	    return (status == ADC_STATUS_SUCCESS) ? ADC_SRV_SUCCESS : ADC_SRV_ERROR;
+	    return (status == ADC_STATUS_CONVERSION_COMPLETED) ? ADC_SRV_SUCCESS : ADC_SRV_ERROR;
 }
 
 adc_srv_status_t ADC_SRV_Read(adc_srv_config_t *config)
@@ -131,8 +208,8 @@ adc_srv_status_t ADC_SRV_Read(adc_srv_config_t *config)
     }
 
     /* Calculate voltage in mV */
-    /* For 12-bit: voltage = (raw_value * ref_voltage) / 4096 */
-    config->voltage_mv = (uint32_t)((config->raw_value * s_ref_voltage_mv) / 4096U);
+    /* For 12-bit: voltage = (raw_value * ref_voltage) >> 12; other units via lut_srv */
+    config->voltage_mv = ADC_SRV_TO_MV(config->raw_value);
 
     return ADC_SRV_SUCCESS;
 }
@@ -149,3 +226,118 @@ adc_srv_status_t ADC_SRV_Calibrate(void)
 
     return ADC_SRV_SUCCESS;
 }
+
+adc_srv_status_t ADC_SRV_StartSequence(const adc_srv_sequence_config_t *config)
+{
+    clock_srv_frequencies_t freq;
+    pdb_config_t pdb_cfg;
+    uint64_t span_ns;
+    uint64_t ticks;
+    uint32_t div;
+    uint8_t n;
+
+    if (config == NULL || config->count == 0U || config->count > ADC_SRV_SEQ_MAX_SLOTS) {
+        return ADC_SRV_INVALID_PARAM;
+    }
+
+    if (!s_adc_initialized) {
+        return ADC_SRV_NOT_INITIALIZED;
+    }
+
+    if (s_sequence_active) {
+        ADC_SRV_StopSequence();
+    }
+
+    if (CLOCK_SRV_GetFrequencies(&freq) != CLOCK_SRV_SUCCESS ||
+        CLOCK_SRV_EnablePeripheral(CLOCK_SRV_PDB0, CLOCK_SRV_PCS_NONE) != CLOCK_SRV_SUCCESS) {
+        return ADC_SRV_ERROR;
+    }
+
+    /* The counter has to reach the period and every delay */
+    span_ns = (uint64_t)config->period_us * 1000U;
+    for (n = 0; n < config->count; n++) {
+        if (config->delay_ns[n] > span_ns) {
+            span_ns = config->delay_ns[n];
+        }
+    }
+
+    div = ADC_SRV_SelectPdbClock(freq.bus_hz, span_ns, &pdb_cfg);
+    if (div == 0U) {
+        CLOCK_SRV_DisablePeripheral(CLOCK_SRV_PDB0);
+        return ADC_SRV_INVALID_PARAM;
+    }
+
+    pdb_cfg.trigger = (config->trigger == ADC_SRV_TRIGGER_INPUT) ? PDB_TRIGGER_INPUT : PDB_TRIGGER_SOFTWARE;
+    pdb_cfg.continuous = (config->period_us > 0U);
+    pdb_cfg.load_mode = PDB_LOAD_IMMEDIATE;
+
+    /* ADC0: one slot per pre-trigger, interrupt on the last one only */
+    ADC_InterruptConfig(s_adc_instance, ADC_CONVERSION_INTERRUPT_DISABLE);
+    for (n = 0; n < config->count; n++) {
+        ADC_ConfigSlot(s_adc_instance, n, config->channels[n],
+                       (n == config->count - 1U) ? ADC_CONVERSION_INTERRUPT_ENABLE
+                                                 : ADC_CONVERSION_INTERRUPT_DISABLE);
+    }
+    s_sequence_callback = config->callback;
+    ADC_RegisterSequenceCallback(s_adc_instance, config->count, ADC_SRV_SequenceCallback);
+    ADC_SetHardwareTrigger(s_adc_instance, true);
+
+    /* PDB0 channel 0 pre-triggers */
+    PDB_Init(PDB0, &pdb_cfg);
+    if (config->period_us > 0U) {
+        ticks = (uint64_t)config->period_us * 1000U * freq.bus_hz / ((uint64_t)div * ADC_SRV_NS_PER_S);
+        PDB_SetModulus(PDB0, (uint16_t)((ticks > 0U) ? (ticks - 1U) : 0U));
+    }
+    for (n = 0; n < config->count; n++) {
+        ticks = (uint64_t)config->delay_ns[n] * freq.bus_hz / ((uint64_t)div * ADC_SRV_NS_PER_S);
+        PDB_ConfigPreTrigger(PDB0, 0U, n, true, (n > 0U && config->delay_ns[n] == 0U), (uint16_t)ticks);
+    }
+    PDB_LoadValues(PDB0);
+
+    s_sequence_errors = 0;
+    PDB_RegisterCallback(PDB0, ADC_SRV_PdbCallback, NULL);
+    PDB_EnableInterrupts(PDB0, false, true);
+    NVIC_SetPriority(PDB0_IRQn, ADC_SRV_PDB_IRQ_PRIORITY);
+    NVIC_EnableInterrupt(PDB0_IRQn);
+
+    s_sequence_active = true;
+
+    return ADC_SRV_SUCCESS;
+}
+
+adc_srv_status_t ADC_SRV_TriggerSequence(void)
+{
+    if (!s_sequence_active) {
+        return ADC_SRV_NOT_INITIALIZED;
+    }
+
+    PDB_SoftwareTrigger(PDB0);
+
+    return ADC_SRV_SUCCESS;
+}
+
+void ADC_SRV_StopSequence(void)
+{
+    if (!s_sequence_active) {
+        return;
+    }
+
+    NVIC_DisableInterrupt(PDB0_IRQn);
+    PDB_RegisterCallback(PDB0, NULL, NULL);
+    PDB_Deinit(PDB0);
+    CLOCK_SRV_DisablePeripheral(CLOCK_SRV_PDB0);
+
+    ADC_SetHardwareTrigger(s_adc_instance, false);
+    ADC_RegisterSequenceCallback(s_adc_instance, 0U, NULL);
+    /* SC1[0] is rewritten by the next ADC_SRV_Start() */
+    for (uint8_t n = 1; n < ADC_SRV_SEQ_MAX_SLOTS; n++) {
+        ADC_ConfigSlot(s_adc_instance, n, ADC_CHANNEL_MASK, ADC_CONVERSION_INTERRUPT_DISABLE);
+    }
+    s_sequence_callback = NULL;
+    s_sequence_active = false;
+}
+
+uint32_t ADC_SRV_GetSequenceErrors(void)
+{
+    return s_sequence_errors;
+}
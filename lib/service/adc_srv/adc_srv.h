@@ -10,6 +10,9 @@
  * - Single-shot conversion
  * - Calibration support
  * - Multi-channel management
+ * - Hardware-timed sequences: PDB0 pre-triggers start up to 8 conversions
+ *   at programmed delays (or back-to-back) after a trigger, without CPU
+ *   involvement between trigger and sample
  * 
  * @author  PhucPH32
  * @date    05/12/2025
@@ -36,9 +39,44 @@ typedef enum {
     ADC_SRV_SUCCESS = 0,
     ADC_SRV_ERROR,
     ADC_SRV_NOT_INITIALIZED,
-    ADC_SRV_BUSY
+    ADC_SRV_BUSY,
+    ADC_SRV_INVALID_PARAM
 } adc_srv_status_t;
 
+/** @brief Slots of a sequence (PDB0 channel 0 pre-triggers -> SC1[0..7]) */
+#define ADC_SRV_SEQ_MAX_SLOTS       (8U)
+
+/**
+ * @brief Sequence trigger
+ */
+typedef enum {
+    ADC_SRV_TRIGGER_SOFTWARE = 0,   /**< ADC_SRV_TriggerSequence() */
+    ADC_SRV_TRIGGER_INPUT           /**< PDB0 trigger input routed by TRGMUX */
+} adc_srv_trigger_t;
+
+/**
+ * @brief Sequence complete callback (interrupt context)
+ * @param raw Raw values in slot order
+ * @param count Number of slots
+ */
+typedef void (*adc_srv_sequence_callback_t)(const uint16_t *raw, uint8_t count);
+
+/**
+ * @brief Hardware-timed sequence
+ * @details Slot n converts channels[n]. Slot 0 starts delay_ns[0] after
+ *          the trigger. A later slot with delay_ns[n] == 0 starts when
+ *          slot n-1 completes (back-to-back), otherwise delay_ns[n] after
+ *          the trigger - which must leave time for slot n-1 to finish.
+ */
+typedef struct {
+    uint8_t channels[ADC_SRV_SEQ_MAX_SLOTS];    /**< Input channel per slot */
+    uint32_t delay_ns[ADC_SRV_SEQ_MAX_SLOTS];   /**< Pre-trigger delay per slot */
+    uint8_t count;                              /**< Slots used (1-8) */
+    uint32_t period_us;                         /**< > 0: PDB repeats on its own */
+    adc_srv_trigger_t trigger;                  /**< What starts the PDB */
+    adc_srv_sequence_callback_t callback;       /**< Results, may be NULL */
+} adc_srv_sequence_config_t;
+
 
 
 /**
@@ -100,4 +138,33 @@ adc_srv_status_t ADC_SRV_Read(adc_srv_config_t *config);
  */
 adc_srv_status_t ADC_SRV_Calibrate(void);
 
+/**
+ * @brief Arm a hardware-timed sequence on ADC0
+ * @details Switches ADC0 to hardware triggers and programs PDB0. Timing
+ *          resolution is one PDB clock (bus clock / prescaler), chosen as
+ *          fine as the longest delay or period allows. ADC_SRV_Start() is
+ *          rejected until ADC_SRV_StopSequence().
+ * @param config Sequence description
+ * @return adc_srv_status_t ADC_SRV_INVALID_PARAM if a delay or the period
+ *         cannot be represented
+ */
+adc_srv_status_t ADC_SRV_StartSequence(const adc_srv_sequence_config_t *config);
+
+/**
+ * @brief Start the armed sequence (ADC_SRV_TRIGGER_SOFTWARE)
+ * @return adc_srv_status_t Status of operation
+ */
+adc_srv_status_t ADC_SRV_TriggerSequence(void);
+
+/**
+ * @brief Disarm the sequence and return ADC0 to software triggers
+ */
+void ADC_SRV_StopSequence(void);
+
+/**
+ * @brief Pre-triggers that found an unread result since the sequence started
+ * @return uint32_t Sequence error count
+ */
+uint32_t ADC_SRV_GetSequenceErrors(void);
+
 #endif /* ADC_SRV_H */
@@ -0,0 +1,712 @@
+/**
+ * @file    boot_srv.c
+ * @brief   CAN Bootloader Service Implementation
+ * @details Block protocol, receive/program pipeline, image check and
+ *          application start
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "boot_srv.h"
+#include "../can_srv/can_srv.h"
+#include "../nvm_srv/nvm_srv.h"
+#include "../crc_srv/crc_srv.h"
+#include "../../driver/ftfc/ftfc.h"
+#include "../../driver/nvic/nvic_reg.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* System control block */
+#define BOOT_SRV_SCB_VTOR           (*(volatile uint32_t *)0xE000ED08U)
+#define BOOT_SRV_SCB_AIRCR          (*(volatile uint32_t *)0xE000ED0CU)
+#define BOOT_SRV_AIRCR_SYSRESETREQ  (0x05FA0004U)   /* VECTKEY | SYSRESETREQ */
+
+/* Initial stack pointer must land in SRAM_L/SRAM_U */
+#define BOOT_SRV_SRAM_START         (0x1FFF8000U)
+#define BOOT_SRV_SRAM_END           (0x20007000U)
+
+#define BOOT_SRV_FRAME_SIZE         (8U)
+#define BOOT_SRV_SEQ_MASK           (0x0FU)
+
+/* Responses waiting for the TX mailbox (NAK and ACK can come in one pass) */
+#define BOOT_SRV_RSP_QUEUE_LEN      (4U)
+
+/* Chunk used when reading flash back for the CRC */
+#define BOOT_SRV_READ_CHUNK         (64U)
+
+/* Stay-resident flag value */
+#define BOOT_SRV_UPDATE_REQUESTED   (0xB007B007U)
+
+#if defined(__arm__)
+#define BOOT_SRV_DISABLE_IRQ()      __asm volatile ("cpsid i" : : : "memory")
+#define BOOT_SRV_DSB()              __asm volatile ("dsb" : : : "memory")
+#else
+/* Host build (test/): no interrupts to mask, compiler barrier only */
+#define BOOT_SRV_DISABLE_IRQ()      __asm volatile ("" : : : "memory")
+#define BOOT_SRV_DSB()              __asm volatile ("" : : : "memory")
+#endif
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_boot_initialized = false;
+static volatile boot_srv_state_t s_boot_state = BOOT_SRV_STATE_IDLE;
+static const boot_srv_flash_ops_t *s_flash_ops = NULL;
+
+/* Image being received */
+static uint32_t s_image_size = 0;
+static uint32_t s_block_count = 0;
+static uint32_t s_erase_address = 0;
+
+/* Block buffers - filled by the CAN ISR, drained by Process */
+static uint8_t s_block_buf[BOOT_SRV_BUFFER_COUNT][BOOT_SRV_BLOCK_SIZE];
+static volatile bool s_buf_full[BOOT_SRV_BUFFER_COUNT];
+
+/* Receive side (ISR) */
+static volatile uint32_t s_rx_block = 0;
+static volatile uint32_t s_rx_frame = 0;
+static volatile bool s_rx_resync = false;
+static volatile bool s_nak_pending = false;
+
+/* Program side (thread) */
+static uint32_t s_prog_block = 0;
+
+/* Command mailbox (ISR -> thread) */
+static volatile bool s_cmd_pending = false;
+static uint8_t s_cmd_data[8];
+static volatile bool s_start_requested = false;
+
+/* Response path - own TX mailbox (can_srv) */
+static uint8_t s_tx_mb = 0;
+static can_srv_message_t s_rspq[BOOT_SRV_RSP_QUEUE_LEN];
+static uint8_t s_rspq_head = 0;
+static uint8_t s_rspq_tail = 0;
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static inline uint32_t BOOT_SRV_EnterCritical(void);
+static inline void BOOT_SRV_ExitCritical(uint32_t primask);
+static bool BOOT_SRV_FtfcErase(uint32_t address);
+static bool BOOT_SRV_FtfcProgram(uint32_t address, const uint8_t *data);
+static void BOOT_SRV_FtfcRead(uint32_t address, uint8_t *data, uint32_t length);
+static void BOOT_SRV_CANCallback(uint8_t instance, can_srv_event_t event,
+                                 const can_srv_message_t *message);
+static void BOOT_SRV_HandleData(const can_srv_message_t *message);
+static void BOOT_SRV_HandleCommand(void);
+static void BOOT_SRV_FlushResponses(void);
+static void BOOT_SRV_Respond(uint8_t code, const uint8_t *payload, uint8_t length);
+static void BOOT_SRV_RespondBlock(uint8_t code, uint32_t block);
+static void BOOT_SRV_ResetTransfer(void);
+static uint32_t BOOT_SRV_BlockLength(uint32_t block);
+static bool BOOT_SRV_ProgramBlock(uint32_t block);
+static uint32_t BOOT_SRV_FlashCrc32(uint32_t address, uint32_t length);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Mask interrupts, return the previous PRIMASK
+ */
+static inline uint32_t BOOT_SRV_EnterCritical(void)
+{
+    uint32_t primask = 0U;
+
+#if defined(__arm__)
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+#endif
+    BOOT_SRV_DISABLE_IRQ();
+
+    return primask;
+}
+
+/**
+ * @brief Restore PRIMASK saved by BOOT_SRV_EnterCritical(), so a caller
+ *        that already runs masked stays masked
+ */
+static inline void BOOT_SRV_ExitCritical(uint32_t primask)
+{
+#if defined(__arm__)
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+
+/*
+ * FTFC backend. P-Flash is a single read partition: nothing may execute
+ * from flash while a command runs, so interrupts are masked around each
+ * command (the launch loop itself lives in RAM).
+ */
+static bool BOOT_SRV_FtfcErase(uint32_t address)
+{
+    ftfc_status_t status;
+    uint32_t primask;
+
+    primask = BOOT_SRV_EnterCritical();
+    status = FTFC_EraseSector(address);
+    BOOT_SRV_ExitCritical(primask);
+
+    return status == FTFC_STATUS_SUCCESS;
+}
+
+static bool BOOT_SRV_FtfcProgram(uint32_t address, const uint8_t *data)
+{
+    ftfc_status_t status;
+    uint32_t primask;
+
+    primask = BOOT_SRV_EnterCritical();
+    status = FTFC_ProgramPhrase(address, data);
+    BOOT_SRV_ExitCritical(primask);
+
+    return status == FTFC_STATUS_SUCCESS;
+}
+
+static void BOOT_SRV_FtfcRead(uint32_t address, uint8_t *data, uint32_t length)
+{
+    memcpy(data, (const void *)address, length);
+}
+
+static const boot_srv_flash_ops_t s_ftfc_ops = {
+    BOOT_SRV_FtfcErase,
+    BOOT_SRV_FtfcProgram,
+    BOOT_SRV_FtfcRead,
+    FTFC_PFLASH_SECTOR_SIZE
+};
+
+/**
+ * @brief CAN receive callback (ISR context)
+ * @details Data frames are copied straight into the block buffers so the
+ *          receive path never waits for flash. Commands are handed over to
+ *          BOOT_SRV_Process().
+ */
+static void BOOT_SRV_CANCallback(uint8_t instance, can_srv_event_t event,
+                                 const can_srv_message_t *message)
+{
+    (void)instance;
+
+    if (event != CAN_SRV_EVENT_RX_COMPLETE || message == NULL || message->isExtended) {
+        return;
+    }
+
+    if ((message->id & BOOT_SRV_DATA_ID_MASK) == BOOT_SRV_DATA_ID_BASE) {
+        BOOT_SRV_HandleData(message);
+    } else if (message->id == BOOT_SRV_CMD_ID && message->dlc >= 1U) {
+        if (!s_cmd_pending) {
+            memcpy(s_cmd_data, message->data, sizeof(s_cmd_data));
+            s_cmd_pending = true;
+        }
+    }
+}
+
+/**
+ * @brief Store one data frame (ISR context)
+ */
+static void BOOT_SRV_HandleData(const can_srv_message_t *message)
+{
+    uint32_t block = s_rx_block;
+    uint32_t frame = s_rx_frame;
+    uint32_t length;
+    uint32_t offset;
+    uint8_t buf;
+    uint8_t copy;
+
+    if ((s_boot_state != BOOT_SRV_STATE_RECEIVING && s_boot_state != BOOT_SRV_STATE_VERIFYING) ||
+        block >= s_block_count) {
+        return;
+    }
+
+    /* After a NAK, drop frames still in flight until the block restarts */
+    if (s_rx_resync) {
+        if ((message->id & BOOT_SRV_SEQ_MASK) != 0U) {
+            return;
+        }
+        s_rx_resync = false;
+    }
+
+    buf = (uint8_t)(block % BOOT_SRV_BUFFER_COUNT);
+
+    if (s_nak_pending || s_buf_full[buf] ||
+        (message->id & BOOT_SRV_SEQ_MASK) != (frame & BOOT_SRV_SEQ_MASK)) {
+        /* Lost frame or host ran past the window - restart this block */
+        s_rx_frame = 0;
+        s_nak_pending = true;
+        return;
+    }
+
+    length = BOOT_SRV_BlockLength(block);
+    offset = frame * BOOT_SRV_FRAME_SIZE;
+    copy = (uint8_t)(((length - offset) < message->dlc) ? (length - offset) : message->dlc);
+
+    /* Only the last frame of the image may be short */
+    if (copy < BOOT_SRV_FRAME_SIZE && (offset + copy) < length) {
+        s_rx_frame = 0;
+        s_nak_pending = true;
+        return;
+    }
+
+    memcpy(&s_block_buf[buf][offset], message->data, copy);
+    offset += copy;
+
+    if (offset >= length) {
+        s_buf_full[buf] = true;
+        s_rx_block = block + 1U;
+        s_rx_frame = 0;
+    } else {
+        s_rx_frame = frame + 1U;
+    }
+}
+
+/**
+ * @brief Execute the pending host command (thread context)
+ */
+static void BOOT_SRV_HandleCommand(void)
+{
+    uint8_t cmd = s_cmd_data[0];
+    uint8_t nrc[2];
+    uint32_t value;
+
+    value = ((uint32_t)s_cmd_data[1] << 24) | ((uint32_t)s_cmd_data[2] << 16) |
+            ((uint32_t)s_cmd_data[3] << 8) | (uint32_t)s_cmd_data[4];
+
+    nrc[0] = cmd;
+    nrc[1] = BOOT_SRV_NRC_SEQUENCE;
+
+    switch (cmd) {
+        case BOOT_SRV_CMD_START:
+            if (value == 0U || value > BOOT_SRV_APP_MAX_SIZE) {
+                nrc[1] = BOOT_SRV_NRC_SIZE;
+                BOOT_SRV_Respond(BOOT_SRV_RSP_NEGATIVE, nrc, 2);
+                break;
+            }
+            BOOT_SRV_ResetTransfer();
+            s_image_size = value;
+            s_block_count = (value + BOOT_SRV_BLOCK_SIZE - 1U) / BOOT_SRV_BLOCK_SIZE;
+            s_erase_address = BOOT_SRV_APP_BASE;
+
+            /* Invalidate the stored image before the first sector goes */
+            NVM_SRV_Write(NVM_SRV_KEY_BOOT_IMAGE_SIZE, 0U);
+            s_boot_state = BOOT_SRV_STATE_ERASING;
+            break;
+
+        case BOOT_SRV_CMD_END:
+            if (s_boot_state != BOOT_SRV_STATE_RECEIVING) {
+                BOOT_SRV_Respond(BOOT_SRV_RSP_NEGATIVE, nrc, 2);
+                break;
+            }
+            /* Expected CRC is kept in the mailbox until the pipeline drains */
+            s_boot_state = BOOT_SRV_STATE_VERIFYING;
+            return;
+
+        case BOOT_SRV_CMD_GO:
+            if (s_boot_state != BOOT_SRV_STATE_DONE && !BOOT_SRV_IsAppValid()) {
+                nrc[1] = BOOT_SRV_NRC_NO_IMAGE;
+                BOOT_SRV_Respond(BOOT_SRV_RSP_NEGATIVE, nrc, 2);
+                break;
+            }
+            cmd |= BOOT_SRV_RSP_POSITIVE;
+            BOOT_SRV_Respond(cmd, NULL, 0);
+            s_start_requested = true;
+            break;
+
+        case BOOT_SRV_CMD_ABORT:
+            BOOT_SRV_ResetTransfer();
+            cmd |= BOOT_SRV_RSP_POSITIVE;
+            BOOT_SRV_Respond(cmd, NULL, 0);
+            break;
+
+        default:
+            /* Unknown command, ignore */
+            break;
+    }
+
+    s_cmd_pending = false;
+}
+
+/**
+ * @brief Send queued responses while the mailbox is free
+ */
+static void BOOT_SRV_FlushResponses(void)
+{
+    while (s_rspq_tail != s_rspq_head) {
+        if (CAN_SRV_SendOn(s_tx_mb, &s_rspq[s_rspq_tail]) != CAN_SRV_SUCCESS) {
+            break;
+        }
+        s_rspq_tail = (uint8_t)((s_rspq_tail + 1U) % BOOT_SRV_RSP_QUEUE_LEN);
+    }
+}
+
+/**
+ * @brief Queue a response frame
+ * @details Dropped if the queue is full; the host times out and retries.
+ */
+static void BOOT_SRV_Respond(uint8_t code, const uint8_t *payload, uint8_t length)
+{
+    uint8_t next = (uint8_t)((s_rspq_head + 1U) % BOOT_SRV_RSP_QUEUE_LEN);
+    can_srv_message_t *msg;
+
+    if (next == s_rspq_tail) {
+        return;
+    }
+
+    msg = &s_rspq[s_rspq_head];
+    msg->id = BOOT_SRV_RSP_ID;
+    msg->isExtended = false;
+    msg->isRemote = false;
+    msg->dlc = (uint8_t)(length + 1U);
+    memset(msg->data, 0, sizeof(msg->data));
+    msg->data[0] = code;
+
+    if (payload != NULL) {
+        memcpy(&msg->data[1], payload, length);
+    }
+    s_rspq_head = next;
+
+    BOOT_SRV_FlushResponses();
+}
+
+static void BOOT_SRV_RespondBlock(uint8_t code, uint32_t block)
+{
+    uint8_t payload[2];
+
+    payload[0] = (uint8_t)(block >> 8);
+    payload[1] = (uint8_t)block;
+    BOOT_SRV_Respond(code, payload, 2);
+}
+
+/**
+ * @brief Drop any transfer in progress
+ */
+static void BOOT_SRV_ResetTransfer(void)
+{
+    s_boot_state = BOOT_SRV_STATE_IDLE;
+    s_image_size = 0;
+    s_block_count = 0;
+    s_rx_block = 0;
+    s_rx_frame = 0;
+    s_rx_resync = false;
+    s_nak_pending = false;
+    s_prog_block = 0;
+    s_start_requested = false;
+
+    for (uint8_t i = 0; i < BOOT_SRV_BUFFER_COUNT; i++) {
+        memset(s_block_buf[i], 0xFF, BOOT_SRV_BLOCK_SIZE);
+        s_buf_full[i] = false;
+    }
+}
+
+/**
+ * @brief Number of image bytes carried by a block
+ */
+static uint32_t BOOT_SRV_BlockLength(uint32_t block)
+{
+    uint32_t remaining = s_image_size - (block * BOOT_SRV_BLOCK_SIZE);
+
+    return (remaining < BOOT_SRV_BLOCK_SIZE) ? remaining : BOOT_SRV_BLOCK_SIZE;
+}
+
+/**
+ * @brief Program one received block
+ * @details One phrase per flash command; the CAN ISR runs between phrases
+ *          and keeps filling the other buffer. The tail of the last block
+ *          is padded with the erased value.
+ */
+static bool BOOT_SRV_ProgramBlock(uint32_t block)
+{
+    uint8_t buf = (uint8_t)(block % BOOT_SRV_BUFFER_COUNT);
+    uint32_t address = BOOT_SRV_APP_BASE + (block * BOOT_SRV_BLOCK_SIZE);
+    uint32_t length = BOOT_SRV_BlockLength(block);
+    bool ok = true;
+
+    for (uint32_t offset = 0; offset < length; offset += FTFC_PHRASE_SIZE) {
+        if (!s_flash_ops->program_phrase(address + offset, &s_block_buf[buf][offset])) {
+            ok = false;
+            break;
+        }
+    }
+
+    memset(s_block_buf[buf], 0xFF, BOOT_SRV_BLOCK_SIZE);
+    s_buf_full[buf] = false;
+
+    return ok;
+}
+
+/**
+ * @brief CRC-32 of a flash range
+ * @details P-Flash is memory mapped, so the FTFC backend hands the range
+ *          straight to crc_srv (DMA-fed for images). Other backends are
+ *          read in chunks.
+ */
+static uint32_t BOOT_SRV_FlashCrc32(uint32_t address, uint32_t length)
+{
+    uint8_t chunk[BOOT_SRV_READ_CHUNK];
+    crc_srv_ctx_t ctx;
+    uint32_t n;
+
+    if (s_flash_ops == &s_ftfc_ops) {
+        return CRC_SRV_Compute(CRC_SRV_CRC32, (const void *)address, length);
+    }
+
+    CRC_SRV_Begin(&ctx, CRC_SRV_CRC32);
+
+    while (length > 0U) {
+        n = (length < BOOT_SRV_READ_CHUNK) ? length : BOOT_SRV_READ_CHUNK;
+        s_flash_ops->read(address, chunk, n);
+        CRC_SRV_Update(&ctx, chunk, n);
+        address += n;
+        length -= n;
+    }
+
+    return CRC_SRV_Finish(&ctx);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+boot_srv_status_t BOOT_SRV_Init(void)
+{
+    if (s_flash_ops == NULL) {
+        s_flash_ops = &s_ftfc_ops;
+    }
+
+    BOOT_SRV_ResetTransfer();
+    s_cmd_pending = false;
+    s_rspq_head = 0;
+    s_rspq_tail = 0;
+
+    if (CAN_SRV_AllocTxMailbox(&s_tx_mb) != CAN_SRV_SUCCESS) {
+        return BOOT_SRV_ERROR;
+    }
+
+    if (CAN_SRV_AddRxFilter(BOOT_SRV_CMD_ID, 0x7FFU, false) != CAN_SRV_SUCCESS) {
+        return BOOT_SRV_ERROR;
+    }
+
+    if (CAN_SRV_AddRxFilter(BOOT_SRV_DATA_ID_BASE, BOOT_SRV_DATA_ID_MASK, false) != CAN_SRV_SUCCESS) {
+        return BOOT_SRV_ERROR;
+    }
+
+    if (CAN_SRV_RegisterCallback(BOOT_SRV_CANCallback) != CAN_SRV_SUCCESS) {
+        return BOOT_SRV_ERROR;
+    }
+
+    s_boot_initialized = true;
+    return BOOT_SRV_SUCCESS;
+}
+
+void BOOT_SRV_SetFlashOps(const boot_srv_flash_ops_t *ops)
+{
+    s_flash_ops = (ops != NULL) ? ops : &s_ftfc_ops;
+}
+
+void BOOT_SRV_Process(void)
+{
+    uint8_t buf;
+    uint8_t nrc[2];
+    uint32_t expected;
+    uint32_t crc;
+
+    if (!s_boot_initialized) {
+        return;
+    }
+
+    BOOT_SRV_FlushResponses();
+
+    if (s_cmd_pending && s_boot_state != BOOT_SRV_STATE_VERIFYING) {
+        BOOT_SRV_HandleCommand();
+    }
+
+    switch (s_boot_state) {
+        case BOOT_SRV_STATE_ERASING:
+            /* One sector per call, the START response goes out when done */
+            if (!s_flash_ops->erase_sector(s_erase_address)) {
+                nrc[0] = BOOT_SRV_CMD_START;
+                nrc[1] = BOOT_SRV_NRC_FLASH;
+                BOOT_SRV_Respond(BOOT_SRV_RSP_NEGATIVE, nrc, 2);
+                s_boot_state = BOOT_SRV_STATE_ERROR;
+                break;
+            }
+            s_erase_address += s_flash_ops->sector_size;
+            if (s_erase_address >= BOOT_SRV_APP_BASE + s_image_size) {
+                s_boot_state = BOOT_SRV_STATE_RECEIVING;
+                BOOT_SRV_Respond(BOOT_SRV_CMD_START | BOOT_SRV_RSP_POSITIVE, NULL, 0);
+            }
+            break;
+
+        case BOOT_SRV_STATE_RECEIVING:
+        case BOOT_SRV_STATE_VERIFYING:
+            if (s_nak_pending) {
+                s_rx_resync = true;
+                s_nak_pending = false;
+                BOOT_SRV_RespondBlock(BOOT_SRV_RSP_BLOCK_NAK, s_rx_block);
+            }
+
+            buf = (uint8_t)(s_prog_block % BOOT_SRV_BUFFER_COUNT);
+            if (s_prog_block < s_block_count && s_buf_full[buf]) {
+                if (!BOOT_SRV_ProgramBlock(s_prog_block)) {
+                    nrc[0] = BOOT_SRV_CMD_END;
+                    nrc[1] = BOOT_SRV_NRC_FLASH;
+                    BOOT_SRV_Respond(BOOT_SRV_RSP_NEGATIVE, nrc, 2);
+                    s_boot_state = BOOT_SRV_STATE_ERROR;
+                    break;
+                }
+                s_prog_block++;
+                /* Buffer free again: host may send up to ACK + WINDOW - 1 */
+                BOOT_SRV_RespondBlock(BOOT_SRV_RSP_BLOCK_ACK, s_prog_block);
+            }
+
+            if (s_boot_state != BOOT_SRV_STATE_VERIFYING || s_prog_block < s_block_count) {
+                break;
+            }
+
+            /* Everything programmed - check what actually landed in flash */
+            expected = ((uint32_t)s_cmd_data[1] << 24) | ((uint32_t)s_cmd_data[2] << 16) |
+                       ((uint32_t)s_cmd_data[3] << 8) | (uint32_t)s_cmd_data[4];
+            s_cmd_pending = false;
+
+            crc = BOOT_SRV_FlashCrc32(BOOT_SRV_APP_BASE, s_image_size);
+            if (crc != expected) {
+                nrc[0] = BOOT_SRV_CMD_END;
+                nrc[1] = BOOT_SRV_NRC_CRC;
+                BOOT_SRV_Respond(BOOT_SRV_RSP_NEGATIVE, nrc, 2);
+                s_boot_state = BOOT_SRV_STATE_ERROR;
+                break;
+            }
+
+            NVM_SRV_Write(NVM_SRV_KEY_BOOT_IMAGE_CRC, crc);
+            NVM_SRV_Write(NVM_SRV_KEY_BOOT_IMAGE_SIZE, s_image_size);
+            NVM_SRV_Flush();
+
+            s_boot_state = BOOT_SRV_STATE_DONE;
+            BOOT_SRV_Respond(BOOT_SRV_CMD_END | BOOT_SRV_RSP_POSITIVE, NULL, 0);
+            break;
+
+        default:
+            break;
+    }
+}
+
+boot_srv_state_t BOOT_SRV_GetState(void)
+{
+    return s_boot_state;
+}
+
+bool BOOT_SRV_IsStartRequested(void)
+{
+    return s_start_requested;
+}
+
+void BOOT_SRV_ClearStartRequest(void)
+{
+    s_start_requested = false;
+}
+
+bool BOOT_SRV_IsAppValid(void)
+{
+    uint32_t size;
+    uint32_t crc;
+    uint32_t vectors[2];
+
+    if (s_flash_ops == NULL) {
+        s_flash_ops = &s_ftfc_ops;
+    }
+
+    if (NVM_SRV_Read(NVM_SRV_KEY_BOOT_IMAGE_SIZE, &size) != NVM_SRV_SUCCESS ||
+        NVM_SRV_Read(NVM_SRV_KEY_BOOT_IMAGE_CRC, &crc) != NVM_SRV_SUCCESS) {
+        return false;
+    }
+
+    if (size < sizeof(vectors) || size > BOOT_SRV_APP_MAX_SIZE) {
+        return false;
+    }
+
+    /* Initial SP and reset handler (Thumb) */
+    s_flash_ops->read(BOOT_SRV_APP_BASE, (uint8_t *)vectors, sizeof(vectors));
+    if (vectors[0] <= BOOT_SRV_SRAM_START || vectors[0] > BOOT_SRV_SRAM_END) {
+        return false;
+    }
+    if ((vectors[1] & 1U) == 0U ||
+        vectors[1] < BOOT_SRV_APP_BASE || vectors[1] >= BOOT_SRV_APP_BASE + size) {
+        return false;
+    }
+
+    return BOOT_SRV_FlashCrc32(BOOT_SRV_APP_BASE, size) == crc;
+}
+
+boot_srv_status_t BOOT_SRV_JumpToApp(void)
+{
+    uint32_t sp;
+    uint32_t pc;
+
+    if (!BOOT_SRV_IsAppValid()) {
+        return BOOT_SRV_NO_IMAGE;
+    }
+
+    sp = *(const volatile uint32_t *)BOOT_SRV_APP_BASE;
+    pc = *(const volatile uint32_t *)(BOOT_SRV_APP_BASE + 4U);
+
+    /* Leave no peripheral or pending interrupt behind */
+    CAN_SRV_Deinit();
+    BOOT_SRV_DISABLE_IRQ();
+
+    for (uint8_t i = 0; i < 8U; i++) {
+        NVIC->ICER[i] = 0xFFFFFFFFU;
+        NVIC->ICPR[i] = 0xFFFFFFFFU;
+    }
+
+    /* Application vector table; its startup re-enables interrupts */
+    BOOT_SRV_SCB_VTOR = BOOT_SRV_APP_BASE;
+#if defined(__arm__)
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+
+    __asm volatile ("msr msp, %0\n\t"
+                    "bx  %1"
+                    : : "r" (sp), "r" (pc) : "memory");
+#else
+    (void)sp;
+    (void)pc;
+#endif
+
+    /* Not reached */
+    return BOOT_SRV_ERROR;
+}
+
+boot_srv_status_t BOOT_SRV_RequestUpdate(void)
+{
+    if (NVM_SRV_Write(NVM_SRV_KEY_BOOT_REQUEST, BOOT_SRV_UPDATE_REQUESTED) != NVM_SRV_SUCCESS) {
+        return BOOT_SRV_ERROR;
+    }
+
+    if (NVM_SRV_Flush() != NVM_SRV_SUCCESS) {
+        return BOOT_SRV_ERROR;
+    }
+
+    BOOT_SRV_DSB();
+    BOOT_SRV_SCB_AIRCR = BOOT_SRV_AIRCR_SYSRESETREQ;
+    BOOT_SRV_DSB();
+
+    while (1) {
+        /* Wait for reset */
+    }
+}
+
+bool BOOT_SRV_ConsumeUpdateRequest(void)
+{
+    if (NVM_SRV_ReadOrDefault(NVM_SRV_KEY_BOOT_REQUEST, 0U) != BOOT_SRV_UPDATE_REQUESTED) {
+        return false;
+    }
+
+    NVM_SRV_Write(NVM_SRV_KEY_BOOT_REQUEST, 0U);
+    return true;
+}
@@ -0,0 +1,196 @@
+/**
+ * @file    boot_srv.h
+ * @brief   CAN Bootloader Service - Abstraction API
+ * @details
+ * Receives an application image over CAN and programs it into P-Flash
+ * behind the resident bootloader.
+ *
+ * Streamlined block protocol (11-bit IDs):
+ * - Host -> node commands on BOOT_SRV_CMD_ID, data[0] = command
+ *   - START  [0x01, size(4, BE)]: erase the application area
+ *   - END    [0x02, crc32(4, BE)]: finish, verify CRC-32 over the image
+ *   - GO     [0x03]: start the application
+ *   - ABORT  [0x04]: drop the transfer
+ * - Host -> node data on BOOT_SRV_DATA_ID_BASE + (seq & 0xF), 8 bytes
+ *   of image per frame. The low ID nibble is a rolling sequence number.
+ * - Node -> host responses on BOOT_SRV_RSP_ID
+ *   - [cmd | 0x40, ...] positive response
+ *   - [0x7F, cmd, reason] negative response
+ *   - [0x50, block(2, BE)] block ACK: host may send up to block + WINDOW - 1
+ *   - [0x51, block(2, BE)] block NAK: resend starting at block
+ *
+ * Pipelining: images are received into BOOT_SRV_BUFFER_COUNT block
+ * buffers. While the CAN ISR fills one buffer, BOOT_SRV_Process()
+ * programs the previous one phrase by phrase. Interrupts are masked only
+ * for the duration of a single phrase command, which is shorter than one
+ * CAN frame, so the host can stream BOOT_SRV_WINDOW blocks ahead instead
+ * of waiting for each block to be programmed.
+ *
+ * Flash access goes through boot_srv_flash_ops_t, so a simulated flash
+ * controller can replace the FTFC driver.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef BOOT_SRV_H
+#define BOOT_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief CAN identifiers */
+#define BOOT_SRV_CMD_ID             (0x7E0U)
+#define BOOT_SRV_RSP_ID             (0x7E8U)
+#define BOOT_SRV_DATA_ID_BASE       (0x700U)        /* 0x700-0x70F */
+#define BOOT_SRV_DATA_ID_MASK       (0x7F0U)
+
+/** @brief Commands */
+#define BOOT_SRV_CMD_START          (0x01U)
+#define BOOT_SRV_CMD_END            (0x02U)
+#define BOOT_SRV_CMD_GO             (0x03U)
+#define BOOT_SRV_CMD_ABORT          (0x04U)
+
+/** @brief Response codes */
+#define BOOT_SRV_RSP_POSITIVE       (0x40U)         /* OR-ed with the command */
+#define BOOT_SRV_RSP_NEGATIVE       (0x7FU)
+#define BOOT_SRV_RSP_BLOCK_ACK      (0x50U)
+#define BOOT_SRV_RSP_BLOCK_NAK      (0x51U)
+
+/** @brief Negative response reasons */
+#define BOOT_SRV_NRC_SEQUENCE       (0x01U)         /* Command not valid in this state */
+#define BOOT_SRV_NRC_SIZE           (0x02U)         /* Image does not fit */
+#define BOOT_SRV_NRC_FLASH          (0x03U)         /* Erase/program failed */
+#define BOOT_SRV_NRC_CRC            (0x04U)         /* CRC mismatch */
+#define BOOT_SRV_NRC_NO_IMAGE       (0x05U)         /* No valid application */
+
+/** @brief Application area */
+#define BOOT_SRV_APP_BASE           (0x00008000U)
+#define BOOT_SRV_APP_END            (0x00080000U)
+#define BOOT_SRV_APP_MAX_SIZE       (BOOT_SRV_APP_END - BOOT_SRV_APP_BASE)
+
+/** @brief Transfer geometry */
+#define BOOT_SRV_BLOCK_SIZE         (1024U)         /* 128 frames */
+#define BOOT_SRV_BUFFER_COUNT       (2U)
+#define BOOT_SRV_WINDOW             (BOOT_SRV_BUFFER_COUNT)
+
+/**
+ * @brief Bootloader service status codes
+ */
+typedef enum {
+    BOOT_SRV_SUCCESS = 0,
+    BOOT_SRV_ERROR,
+    BOOT_SRV_NOT_INITIALIZED,
+    BOOT_SRV_NO_IMAGE               /**< No valid application to start */
+} boot_srv_status_t;
+
+/**
+ * @brief Transfer state
+ */
+typedef enum {
+    BOOT_SRV_STATE_IDLE = 0,        /**< Waiting for START */
+    BOOT_SRV_STATE_ERASING,         /**< START received, erasing */
+    BOOT_SRV_STATE_RECEIVING,       /**< Streaming blocks */
+    BOOT_SRV_STATE_VERIFYING,       /**< END received, draining and checking CRC */
+    BOOT_SRV_STATE_DONE,            /**< Image verified */
+    BOOT_SRV_STATE_ERROR            /**< Transfer failed, waiting for START/ABORT */
+} boot_srv_state_t;
+
+/**
+ * @brief Flash backend
+ * @details Addresses are absolute. program_phrase() writes 8 bytes.
+ */
+typedef struct {
+    bool (*erase_sector)(uint32_t address);
+    bool (*program_phrase)(uint32_t address, const uint8_t *data);
+    void (*read)(uint32_t address, uint8_t *data, uint32_t length);
+    uint32_t sector_size;
+} boot_srv_flash_ops_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize bootloader service
+ * @details Joins the CAN service (command and data filters, own TX mailbox)
+ *          and selects the FTFC flash backend. CAN_SRV_Init() must have been called.
+ * @return boot_srv_status_t Status of initialization
+ */
+boot_srv_status_t BOOT_SRV_Init(void);
+
+/**
+ * @brief Replace the flash backend (simulation)
+ * @param ops Backend, NULL restores the FTFC backend
+ */
+void BOOT_SRV_SetFlashOps(const boot_srv_flash_ops_t *ops);
+
+/**
+ * @brief Run the programming pipeline
+ * @details Non-blocking apart from single phrase commands. Call from the
+ *          main loop.
+ */
+void BOOT_SRV_Process(void);
+
+/**
+ * @brief Get transfer state
+ * @return boot_srv_state_t Current state
+ */
+boot_srv_state_t BOOT_SRV_GetState(void);
+
+/**
+ * @brief Check whether a GO command was received
+ * @details The request stays set until BOOT_SRV_ClearStartRequest(), a
+ *          new START or ABORT.
+ * @return true if the host asked to start the application
+ */
+bool BOOT_SRV_IsStartRequested(void);
+
+/**
+ * @brief Consume a GO request
+ * @note Call when acting on the request, so that a start attempt that
+ *       fails is not repeated until the host sends GO again.
+ */
+void BOOT_SRV_ClearStartRequest(void);
+
+/**
+ * @brief Check the stored application image
+ * @details Recomputes CRC-32 over the size recorded after the last
+ *          successful transfer (crc_srv, CRC_SRV_CRC32) and validates the initial stack pointer
+ *          and reset vector.
+ * @return true if the application may be started
+ */
+bool BOOT_SRV_IsAppValid(void);
+
+/**
+ * @brief Start the application
+ * @details Shuts down CAN, clears NVIC state, points VTOR at the
+ *          application vector table, loads MSP and jumps to its reset
+ *          handler. Returns only if the image is not valid.
+ * @return boot_srv_status_t BOOT_SRV_NO_IMAGE
+ */
+boot_srv_status_t BOOT_SRV_JumpToApp(void);
+
+/**
+ * @brief Ask the bootloader to stay resident after the next reset
+ * @details Called by the application: stores the request flag, flushes
+ *          nvm_srv and performs a system reset. Does not return on success.
+ * @return boot_srv_status_t BOOT_SRV_ERROR if the flag could not be stored
+ */
+boot_srv_status_t BOOT_SRV_RequestUpdate(void);
+
+/**
+ * @brief Check and clear the stay-resident request
+ * @return true if BOOT_SRV_RequestUpdate() was called before the reset
+ */
+bool BOOT_SRV_ConsumeUpdateRequest(void);
+
+#endif /* BOOT_SRV_H */
@@ -0,0 +1,262 @@
+/**
+ * @file    cache_srv.c
+ * @brief   Code Cache Service Implementation
+ * @details LMEM control, region policies and cold/warm profiling
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cache_srv.h"
+#include "../../driver/lmem/lmem.h"
+#include "../../driver/ultis/dwt_ultis.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+
+static const cache_srv_policy_t s_default_policy[CACHE_SRV_REGION_COUNT] = {
+    CACHE_SRV_WRITE_THROUGH,        /* Program flash */
+    CACHE_SRV_NON_CACHEABLE,        /* Unused */
+    CACHE_SRV_NON_CACHEABLE,        /* FlexNVM, FlexRAM */
+    CACHE_SRV_NON_CACHEABLE         /* SRAM_L */
+};
+
+static const lmem_mode_t s_policy_mode[] = {
+    LMEM_MODE_NON_CACHEABLE,
+    LMEM_MODE_WRITE_THROUGH,
+    LMEM_MODE_WRITE_BACK
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Mask interrupts, returning the previous PRIMASK
+ */
+static inline uint32_t CACHE_EnterCritical(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+    __asm volatile ("cpsid i" : : : "memory");
+
+    return primask;
+}
+
+/**
+ * @brief Restore PRIMASK saved by CACHE_EnterCritical()
+ */
+static inline void CACHE_ExitCritical(uint32_t primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+/**
+ * @brief Cycles of one workload run, interrupts masked
+ */
+static uint32_t CACHE_Measure(cache_srv_workload_t workload, void *arg)
+{
+    uint32_t primask = CACHE_EnterCritical();
+    uint32_t start = DWT_GetCycles();
+
+    workload(arg);
+
+    start = DWT_GetCycles() - start;
+    CACHE_ExitCritical(primask);
+
+    return start;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+cache_srv_status_t CACHE_SRV_Init(void)
+{
+    LMEM_Disable();
+
+    for (uint8_t region = 0; region < CACHE_SRV_REGION_COUNT; region++) {
+        LMEM_SetRegionMode(region, s_policy_mode[s_default_policy[region]]);
+    }
+
+    LMEM_Enable();
+
+    s_initialized = true;
+
+    return CACHE_SRV_SUCCESS;
+}
+
+cache_srv_status_t CACHE_SRV_Enable(void)
+{
+    if (!s_initialized) {
+        return CACHE_SRV_NOT_INITIALIZED;
+    }
+
+    LMEM_Enable();
+
+    return CACHE_SRV_SUCCESS;
+}
+
+cache_srv_status_t CACHE_SRV_Disable(void)
+{
+    if (!s_initialized) {
+        return CACHE_SRV_NOT_INITIALIZED;
+    }
+
+    LMEM_Disable();
+
+    return CACHE_SRV_SUCCESS;
+}
+
+bool CACHE_SRV_IsEnabled(void)
+{
+    return LMEM_IsEnabled();
+}
+
+cache_srv_status_t CACHE_SRV_Invalidate(void)
+{
+    if (!s_initialized) {
+        return CACHE_SRV_NOT_INITIALIZED;
+    }
+
+    LMEM_InvalidateAll();
+
+    return CACHE_SRV_SUCCESS;
+}
+
+cache_srv_status_t CACHE_SRV_InvalidateRange(uint32_t address, uint32_t length)
+{
+    uint32_t line;
+    uint32_t end;
+
+    if (!s_initialized) {
+        return CACHE_SRV_NOT_INITIALIZED;
+    }
+
+    if (length == 0U) {
+        return CACHE_SRV_SUCCESS;
+    }
+
+    if (length >= LMEM_CACHE_SIZE) {
+        LMEM_InvalidateAll();
+        return CACHE_SRV_SUCCESS;
+    }
+
+    line = address & ~(LMEM_LINE_SIZE - 1U);
+    end = address + length;
+
+    for (; line < end; line += LMEM_LINE_SIZE) {
+        LMEM_InvalidateLine(line);
+    }
+
+    __asm volatile ("isb" : : : "memory");
+
+    return CACHE_SRV_SUCCESS;
+}
+
+cache_srv_status_t CACHE_SRV_SetRegionPolicy(uint8_t region, cache_srv_policy_t policy)
+{
+    bool enabled;
+
+    if (!s_initialized) {
+        return CACHE_SRV_NOT_INITIALIZED;
+    }
+
+    if (region >= CACHE_SRV_REGION_COUNT || (uint32_t)policy > (uint32_t)CACHE_SRV_WRITE_BACK) {
+        return CACHE_SRV_INVALID_PARAM;
+    }
+
+    enabled = LMEM_IsEnabled();
+
+    LMEM_Disable();
+    LMEM_SetRegionMode(region, s_policy_mode[policy]);
+
+    if (enabled) {
+        LMEM_Enable();
+    }
+
+    return CACHE_SRV_SUCCESS;
+}
+
+cache_srv_status_t CACHE_SRV_GetRegionPolicy(uint8_t region, cache_srv_policy_t *policy)
+{
+    lmem_mode_t mode;
+
+    if (!s_initialized) {
+        return CACHE_SRV_NOT_INITIALIZED;
+    }
+
+    if (region >= CACHE_SRV_REGION_COUNT || policy == NULL) {
+        return CACHE_SRV_INVALID_PARAM;
+    }
+
+    mode = LMEM_GetRegionMode(region);
+
+    if (mode == LMEM_MODE_WRITE_BACK) {
+        *policy = CACHE_SRV_WRITE_BACK;
+    } else if (mode == LMEM_MODE_WRITE_THROUGH) {
+        *policy = CACHE_SRV_WRITE_THROUGH;
+    } else {
+        *policy = CACHE_SRV_NON_CACHEABLE;
+    }
+
+    return CACHE_SRV_SUCCESS;
+}
+
+cache_srv_status_t CACHE_SRV_GetRegion(uint32_t address, uint8_t *region)
+{
+    if (region == NULL || address >= (CACHE_SRV_REGION_COUNT * CACHE_SRV_REGION_SIZE)) {
+        return CACHE_SRV_INVALID_PARAM;
+    }
+
+    *region = (uint8_t)(address / CACHE_SRV_REGION_SIZE);
+
+    return CACHE_SRV_SUCCESS;
+}
+
+cache_srv_status_t CACHE_SRV_Profile(cache_srv_workload_t workload, void *arg,
+                                     cache_srv_profile_t *result)
+{
+    bool enabled;
+    uint32_t cycles;
+
+    if (!s_initialized) {
+        return CACHE_SRV_NOT_INITIALIZED;
+    }
+
+    if (workload == NULL || result == NULL) {
+        return CACHE_SRV_INVALID_PARAM;
+    }
+
+    enabled = LMEM_IsEnabled();
+    DWT_CycleCounterStart();
+
+    LMEM_Disable();
+    result->uncached = CACHE_Measure(workload, arg);
+
+    /* Enable invalidates both ways: the next run fills from flash */
+    LMEM_Enable();
+    result->cold = CACHE_Measure(workload, arg);
+
+    result->warm = UINT32_MAX;
+    for (uint8_t run = 0; run < CACHE_SRV_WARM_RUNS; run++) {
+        cycles = CACHE_Measure(workload, arg);
+        if (cycles < result->warm) {
+            result->warm = cycles;
+        }
+    }
+
+    if (!enabled) {
+        LMEM_Disable();
+    }
+
+    return CACHE_SRV_SUCCESS;
+}
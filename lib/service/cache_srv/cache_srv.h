@@ -0,0 +1,174 @@
+/**
+ * @file    cache_srv.h
+ * @brief   Code Cache Service - Abstraction API
+ * @details
+ * Control of the LMEM code cache and measurement of what it buys on a
+ * given piece of code.
+ *
+ * Features:
+ * - Enable, disable, whole and address-range invalidation
+ * - Cacheability per code bus region (128 MB each):
+ *   - region 0, 0x00000000: program flash, cached
+ *   - region 1, 0x08000000: unused, not cached
+ *   - region 2, 0x10000000: FlexNVM and FlexRAM, not cached by default
+ *     because the FTFC rewrites them (EEE records, data flash) behind
+ *     the cache
+ *   - region 3, 0x18000000: SRAM_L, never cached (LMEM RAM controller)
+ * - Profiling: cycles of a workload with the cache off, on its first run
+ *   after an invalidate (cold) and once it is resident (warm). The gap
+ *   cold - warm is what a line fill costs that path, e.g. a CAN ISR after
+ *   the main loop evicted it; uncached - warm is what the cache saves
+ *   at steady state.
+ *
+ * Code that stays slow cold and runs rarely is a candidate for RAM
+ * (mem_ultis.h); code whose warm and uncached times match does not
+ * benefit from the cache at all (the flash prefetch buffer covers it).
+ *
+ * @note After programming or erasing program flash, call
+ *       CACHE_SRV_InvalidateRange() on the area before executing it.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef CACHE_SRV_H
+#define CACHE_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Code bus regions with a cache policy (0x00000000 - 0x1FFFFFFF) */
+#define CACHE_SRV_REGION_COUNT      (4U)
+
+/** @brief Size of one code bus region */
+#define CACHE_SRV_REGION_SIZE       (0x08000000UL)
+
+/** @brief Warm runs per profile, the fastest one is kept */
+#define CACHE_SRV_WARM_RUNS         (4U)
+
+/**
+ * @brief Cache service status codes
+ */
+typedef enum {
+    CACHE_SRV_SUCCESS = 0,
+    CACHE_SRV_ERROR,
+    CACHE_SRV_NOT_INITIALIZED,
+    CACHE_SRV_INVALID_PARAM
+} cache_srv_status_t;
+
+/**
+ * @brief Region cache policy
+ */
+typedef enum {
+    CACHE_SRV_NON_CACHEABLE = 0,    /**< Every fetch goes to memory */
+    CACHE_SRV_WRITE_THROUGH,        /**< Cached; writes also go to memory */
+    CACHE_SRV_WRITE_BACK            /**< Cached; writes stay in the line */
+} cache_srv_policy_t;
+
+/**
+ * @brief Code to profile, must give the same path on every call
+ */
+typedef void (*cache_srv_workload_t)(void *arg);
+
+/**
+ * @brief Profile result in core clock cycles
+ */
+typedef struct {
+    uint32_t uncached;              /**< Cache disabled */
+    uint32_t cold;                  /**< First run after an invalidate */
+    uint32_t warm;                  /**< Fastest of CACHE_SRV_WARM_RUNS resident runs */
+} cache_srv_profile_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the service
+ * @details Applies the default region policies, then invalidates and
+ *          enables the cache.
+ * @return cache_srv_status_t Status of initialization
+ */
+cache_srv_status_t CACHE_SRV_Init(void);
+
+/**
+ * @brief Invalidate and enable the cache
+ * @return cache_srv_status_t Status of operation
+ */
+cache_srv_status_t CACHE_SRV_Enable(void);
+
+/**
+ * @brief Disable the cache
+ * @return cache_srv_status_t Status of operation
+ */
+cache_srv_status_t CACHE_SRV_Disable(void);
+
+/**
+ * @brief Check whether the cache is enabled
+ * @return true if enabled
+ */
+bool CACHE_SRV_IsEnabled(void);
+
+/**
+ * @brief Invalidate the whole cache
+ * @return cache_srv_status_t Status of operation
+ */
+cache_srv_status_t CACHE_SRV_Invalidate(void);
+
+/**
+ * @brief Invalidate the lines covering an address range
+ * @details One line command per 16 bytes; ranges of 4 KB and more are
+ *          cheaper as a whole invalidate and are turned into one.
+ * @param address Start address
+ * @param length Length in bytes
+ * @return cache_srv_status_t Status of operation
+ */
+cache_srv_status_t CACHE_SRV_InvalidateRange(uint32_t address, uint32_t length);
+
+/**
+ * @brief Set the policy of a code bus region
+ * @details The cache is disabled for the change and invalidated, so no
+ *          line cached under the old policy survives.
+ * @param region Region index (0 to CACHE_SRV_REGION_COUNT - 1)
+ * @param policy Cache policy
+ * @return cache_srv_status_t Status of operation
+ */
+cache_srv_status_t CACHE_SRV_SetRegionPolicy(uint8_t region, cache_srv_policy_t policy);
+
+/**
+ * @brief Read the policy of a code bus region
+ * @param region Region index
+ * @param[out] policy Cache policy
+ * @return cache_srv_status_t Status of operation
+ */
+cache_srv_status_t CACHE_SRV_GetRegionPolicy(uint8_t region, cache_srv_policy_t *policy);
+
+/**
+ * @brief Region holding an address
+ * @param address Address
+ * @param[out] region Region index
+ * @return cache_srv_status_t CACHE_SRV_INVALID_PARAM above the code bus
+ */
+cache_srv_status_t CACHE_SRV_GetRegion(uint32_t address, uint8_t *region);
+
+/**
+ * @brief Measure a workload uncached, cold and warm
+ * @details Each run is timed with interrupts masked. The cache enable
+ *          state is restored afterwards, its contents are not.
+ * @param workload Code to run (1 + 1 + CACHE_SRV_WARM_RUNS times)
+ * @param arg Workload argument
+ * @param[out] result Cycles
+ * @return cache_srv_status_t Status of operation
+ */
+cache_srv_status_t CACHE_SRV_Profile(cache_srv_workload_t workload, void *arg,
+                                     cache_srv_profile_t *result);
+
+#endif /* CACHE_SRV_H */
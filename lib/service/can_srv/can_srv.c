@@ -5,23 +5,36 @@
  * 
  * @author  PhucPH32
  * @date    07/12/2025
- * @version 2.0
+ * @version 2.1
  */
 
 /*******************************************************************************
  * Includes
  ******************************************************************************/
 #include "can_srv.h"
+#include "../../driver/can/can_fast.h"
 #include "../../driver/nvic/nvic.h"
+#include "../res_srv/res_srv.h"
 #include <string.h>
 
 /*******************************************************************************
  * Private Definitions
  ******************************************************************************/
 #define CAN_DEFAULT_INSTANCE    (0U)        /* Use CAN0 */
-#define CAN_TX_MB               (8U)        /* TX mailbox number */
-#define CAN_RX_MB_PRIMARY       (16U)       /* Primary RX mailbox */
-#define CAN_RX_MB_SECONDARY     (17U)       /* Secondary RX mailbox */
+
+/* Hot paths bound to CAN0 (can_fast.h); mailboxes are validated at allocation */
+#define CAN_SRV_FAST_SEND       CAN0_FastSend
+#define CAN_SRV_FAST_IS_BUSY    CAN0_FastIsMbBusy
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef struct {
+    uint32_t id;                    /**< Filter ID */
+    uint32_t mask;                  /**< Filter mask */
+    bool extended;                  /**< Extended ID filter */
+    uint8_t mb;                     /**< RX mailbox serving this filter */
+} can_srv_filter_entry_t;
 
 /*******************************************************************************
  * Private Variables
@@ -29,7 +42,21 @@
 static bool s_can_initialized = false;
 static uint8_t s_can_instance_num = CAN_DEFAULT_INSTANCE;
 static CAN_Type *s_can_instance = NULL;
-static can_srv_callback_t s_user_callback = NULL;
+static uint8_t s_tx_mb = 0;
+static uint32_t s_baudrate = 0;
+static can_mode_t s_mode = CAN_MODE_NORMAL;
+
+/* Registered listeners, every one receives every event */
+static can_srv_callback_t s_user_callbacks[CAN_SRV_MAX_CALLBACKS];
+static uint8_t s_callback_count = 0;
+
+/* Active RX filters, one mailbox each */
+static can_srv_filter_entry_t s_rx_filters[CAN_SRV_MAX_RX_FILTERS];
+static uint8_t s_rx_filter_count = 0;
+
+/* Dedicated TX mailboxes handed out by CAN_SRV_AllocTxMailbox() */
+static uint8_t s_tx_mailboxes[CAN_SRV_MAX_TX_MAILBOXES];
+static uint8_t s_tx_mailbox_count = 0;
 
 /*******************************************************************************
  * Private Functions
@@ -41,7 +68,7 @@ static can_srv_callback_t s_user_callback = NULL;
  */
 static void CAN_SRV_DriverCallback(CAN_Type *instance, can_event_t event, const can_event_data_t *eventData)
 {
-    if (s_user_callback == NULL) {
+    if (s_callback_count == 0U) {
         return;
     }
     
@@ -52,6 +79,13 @@ static void CAN_SRV_DriverCallback(CAN_Type *instance, can_event_t event, const
     switch (event) {
         case CAN_EVENT_TX_COMPLETE:
             srvEvent = CAN_SRV_EVENT_TX_COMPLETE;
+            
+            /* Sent frame identity and bus time, no data */
+            if (eventData->message != NULL) {
+                srvMessage.id = eventData->message->id;
+                srvMessage.isExtended = (eventData->message->idType == CAN_ID_EXT);
+                srvMessage.timestamp = eventData->message->timeStamp;
+            }
             break;
             
         case CAN_EVENT_RX_COMPLETE:
@@ -64,6 +98,7 @@ static void CAN_SRV_DriverCallback(CAN_Type *instance, can_event_t event, const
                 srvMessage.isExtended = (eventData->message->idType == CAN_ID_EXT);
                 srvMessage.isRemote = (eventData->message->frameType == CAN_FRAME_REMOTE);
                 memcpy(srvMessage.data, eventData->message->data, 8);
+                srvMessage.timestamp = eventData->message->timeStamp;
             }
             break;
             
@@ -79,9 +114,11 @@ static void CAN_SRV_DriverCallback(CAN_Type *instance, can_event_t event, const
             return;  /* Don't call user callback for unknown events */
     }
     
-    /* Forward to user */
-    s_user_callback(s_can_instance_num, srvEvent, 
-                   (event == CAN_EVENT_RX_COMPLETE) ? &srvMessage : NULL);
+    /* Forward to every listener */
+    for (uint8_t i = 0; i < s_callback_count; i++) {
+        s_user_callbacks[i](s_can_instance_num, srvEvent,
+                            (eventData->message != NULL) ? &srvMessage : NULL);
+    }
 }
 
 /*******************************************************************************
@@ -94,6 +131,25 @@ can_srv_status_t CAN_SRV_Init(const can_srv_config_t *config)
         return CAN_SRV_ERROR;
     }
     
+    /* Controller already running: only merge this component's filters */
+    if (s_can_initialized) {
+        if (config->baudrate != s_baudrate || config->mode != s_mode) {
+            return CAN_SRV_BUSY;
+        }
+        
+        if (CAN_SRV_AddRxFilter(config->filter_id, config->filter_mask,
+                                config->filter_extended) != CAN_SRV_SUCCESS) {
+            return CAN_SRV_ERROR;
+        }
+        
+        if (config->filter_id2 != 0) {
+            return CAN_SRV_AddRxFilter(config->filter_id2, config->filter_mask2,
+                                       config->filter_extended);
+        }
+        
+        return CAN_SRV_SUCCESS;
+    }
+    
     /* Select CAN instance */
     s_can_instance_num = CAN_DEFAULT_INSTANCE;
     s_can_instance = CAN0;
@@ -112,40 +168,45 @@ can_srv_status_t CAN_SRV_Init(const can_srv_config_t *config)
         return CAN_SRV_ERROR;
     }
     
-    /* Configure RX filter */
-    can_rx_filter_t filter = {
-        .id = config->filter_id,
-        .mask = config->filter_mask,
-        .idType = config->filter_extended ? CAN_ID_EXT : CAN_ID_STD
-    };
+    s_baudrate = config->baudrate;
+    s_mode = config->mode;
+    s_rx_filter_count = 0;
     
-    if (CAN_ConfigRxFilter(s_can_instance_num, CAN_RX_MB_PRIMARY, &filter) != STATUS_SUCCESS) {
+    /* Mark initialized so the filter planner accepts requests */
+    s_can_initialized = true;
+    
+    /* Configure primary RX filter */
+    if (CAN_SRV_AddRxFilter(config->filter_id, config->filter_mask,
+                            config->filter_extended) != CAN_SRV_SUCCESS) {
+        s_can_initialized = false;
         return CAN_SRV_ERROR;
     }
     
     /* Configure secondary RX filter if enabled */
     if (config->filter_id2 != 0) {
-        can_rx_filter_t filter2 = {
-            .id = config->filter_id2,
-            .mask = config->filter_mask2,
-            .idType = config->filter_extended ? CAN_ID_EXT : CAN_ID_STD
-        };
-        
-        if (CAN_ConfigRxFilter(s_can_instance_num, CAN_RX_MB_SECONDARY, &filter2) != STATUS_SUCCESS) {
+        if (CAN_SRV_AddRxFilter(config->filter_id2, config->filter_mask2,
+                                config->filter_extended) != CAN_SRV_SUCCESS) {
+            s_can_initialized = false;
             return CAN_SRV_ERROR;
         }
     }
     
-    /* Configure TX mailbox */
-    if (CAN_ConfigTxMailbox(s_can_instance_num, CAN_TX_MB) != STATUS_SUCCESS) {
+    /* Configure TX mailbox (shared by all components) */
+    if (RES_SRV_Alloc(RES_SRV_CAN0_TX_MB, RES_SRV_OWNER_SERVICE, &s_tx_mb) != RES_SRV_SUCCESS) {
+        s_can_initialized = false;
+        return CAN_SRV_ERROR;
+    }
+    
+    if (CAN_ConfigTxMailbox(s_can_instance_num, s_tx_mb) != STATUS_SUCCESS) {
+        s_can_initialized = false;
         return CAN_SRV_ERROR;
     }
     
     /* Register driver callback */
     if (CAN_RegisterCallback(s_can_instance, CAN_SRV_DriverCallback) != STATUS_SUCCESS) {
+        s_can_initialized = false;
         return CAN_SRV_ERROR;
     }
-//    CAN_SetupRxMailbox(s_can_instance_num, 16, 0x200, CAN_ID_STD, filter.mask);
     /* Enable CAN interrupts in NVIC */
     NVIC_EnableInterrupt(CAN0_ORed_0_15_MB_IRQn);
     NVIC_EnableInterrupt(CAN0_ORed_16_31_MB_IRQn);
@@ -154,7 +215,51 @@ can_srv_status_t CAN_SRV_Init(const can_srv_config_t *config)
     NVIC_SetPriority(CAN0_ORed_0_15_MB_IRQn, 5);
     NVIC_SetPriority(CAN0_ORed_16_31_MB_IRQn, 5);
     
-    s_can_initialized = true;
+    return CAN_SRV_SUCCESS;
+}
+
+can_srv_status_t CAN_SRV_AddRxFilter(uint32_t id, uint32_t mask, bool extended)
+{
+    can_srv_filter_entry_t *entry;
+    uint8_t mb;
+    
+    if (!s_can_initialized) {
+        return CAN_SRV_NOT_INITIALIZED;
+    }
+    
+    /* Reuse a mailbox that already accepts exactly this filter */
+    for (uint8_t i = 0; i < s_rx_filter_count; i++) {
+        entry = &s_rx_filters[i];
+        if (entry->id == id && entry->mask == mask && entry->extended == extended) {
+            return CAN_SRV_SUCCESS;
+        }
+    }
+    
+    if (s_rx_filter_count >= CAN_SRV_MAX_RX_FILTERS) {
+        return CAN_SRV_BUSY;
+    }
+    
+    if (RES_SRV_Alloc(RES_SRV_CAN0_RX_MB, RES_SRV_OWNER_SERVICE, &mb) != RES_SRV_SUCCESS) {
+        return CAN_SRV_BUSY;
+    }
+    
+    can_rx_filter_t filter = {
+        .id = id,
+        .mask = mask,
+        .idType = extended ? CAN_ID_EXT : CAN_ID_STD
+    };
+    
+    if (CAN_ConfigRxFilter(s_can_instance_num, mb, &filter) != STATUS_SUCCESS) {
+        RES_SRV_Release(RES_SRV_CAN0_RX_MB, mb, RES_SRV_OWNER_SERVICE);
+        return CAN_SRV_ERROR;
+    }
+    
+    entry = &s_rx_filters[s_rx_filter_count];
+    entry->id = id;
+    entry->mask = mask;
+    entry->extended = extended;
+    entry->mb = mb;
+    s_rx_filter_count++;
     
     return CAN_SRV_SUCCESS;
 }
@@ -165,7 +270,22 @@ can_srv_status_t CAN_SRV_RegisterCallback(can_srv_callback_t callback)
         return CAN_SRV_NOT_INITIALIZED;
     }
     
-    s_user_callback = callback;
+    if (callback == NULL) {
+        return CAN_SRV_ERROR;
+    }
+    
+    for (uint8_t i = 0; i < s_callback_count; i++) {
+        if (s_user_callbacks[i] == callback) {
+            return CAN_SRV_SUCCESS;
+        }
+    }
+    
+    if (s_callback_count >= CAN_SRV_MAX_CALLBACKS) {
+        return CAN_SRV_BUSY;
+    }
+    
+    s_user_callbacks[s_callback_count] = callback;
+    s_callback_count++;
     return CAN_SRV_SUCCESS;
 }
 
@@ -179,6 +299,10 @@ can_srv_status_t CAN_SRV_Send(const can_srv_message_t *msg)
         return CAN_SRV_ERROR;
     }
     
+    if (CAN_SRV_FAST_IS_BUSY(s_tx_mb)) {
+        return CAN_SRV_BUSY;
+    }
+    
     /* Convert service message to driver message */
     can_message_t drvMsg = {
         .id = msg->id,
@@ -188,14 +312,89 @@ can_srv_status_t CAN_SRV_Send(const can_srv_message_t *msg)
     };
     memcpy(drvMsg.data, msg->data, msg->dlc);
     
-    /* Send via driver */
-    if (CAN_Send(s_can_instance_num, CAN_TX_MB, &drvMsg) != STATUS_SUCCESS) {
+    /* Send via driver (s_tx_mb configured in CAN_SRV_Init) */
+    CAN_SRV_FAST_SEND(s_tx_mb, &drvMsg);
+    
+    return CAN_SRV_SUCCESS;
+}
+
+can_srv_status_t CAN_SRV_AllocTxMailbox(uint8_t *mailbox)
+{
+    uint8_t mb;
+
+    if (!s_can_initialized) {
+        return CAN_SRV_NOT_INITIALIZED;
+    }
+
+    if (mailbox == NULL) {
         return CAN_SRV_ERROR;
     }
-    
+
+    if (s_tx_mailbox_count >= CAN_SRV_MAX_TX_MAILBOXES ||
+        RES_SRV_Alloc(RES_SRV_CAN0_TX_MB, RES_SRV_OWNER_SERVICE, &mb) != RES_SRV_SUCCESS) {
+        return CAN_SRV_BUSY;
+    }
+
+    if (CAN_ConfigTxMailbox(s_can_instance_num, mb) != STATUS_SUCCESS) {
+        RES_SRV_Release(RES_SRV_CAN0_TX_MB, mb, RES_SRV_OWNER_SERVICE);
+        return CAN_SRV_ERROR;
+    }
+
+    s_tx_mailboxes[s_tx_mailbox_count++] = mb;
+    *mailbox = mb;
+
+    return CAN_SRV_SUCCESS;
+}
+
+can_srv_status_t CAN_SRV_SendOn(uint8_t mailbox, const can_srv_message_t *msg)
+{
+    if (!s_can_initialized) {
+        return CAN_SRV_NOT_INITIALIZED;
+    }
+
+    if (msg == NULL || msg->dlc > 8 ||
+        mailbox < CAN_TX_MB_START || mailbox >= (CAN_TX_MB_START + CAN_TX_MB_COUNT)) {
+        return CAN_SRV_ERROR;
+    }
+
+    if (CAN_SRV_FAST_IS_BUSY(mailbox)) {
+        return CAN_SRV_BUSY;
+    }
+
+    can_message_t drvMsg = {
+        .id = msg->id,
+        .idType = msg->isExtended ? CAN_ID_EXT : CAN_ID_STD,
+        .frameType = msg->isRemote ? CAN_FRAME_REMOTE : CAN_FRAME_DATA,
+        .dataLength = msg->dlc
+    };
+    memcpy(drvMsg.data, msg->data, msg->dlc);
+
+    CAN_SRV_FAST_SEND(mailbox, &drvMsg);
+
+    return CAN_SRV_SUCCESS;
+}
+
+can_srv_status_t CAN_SRV_GetTimer(uint16_t *timer)
+{
+    if (!s_can_initialized) {
+        return CAN_SRV_NOT_INITIALIZED;
+    }
+
+    if (timer == NULL) {
+        return CAN_SRV_ERROR;
+    }
+
+    /* Arguments checked above; the driver only asserts them */
+    (void)CAN_GetTimer(s_can_instance_num, timer);
+
     return CAN_SRV_SUCCESS;
 }
 
+uint32_t CAN_SRV_GetBaudrate(void)
+{
+    return s_can_initialized ? s_baudrate : 0U;
+}
+
 can_srv_status_t CAN_SRV_Deinit(void)
 {
     if (!s_can_initialized) {
@@ -213,8 +412,19 @@ can_srv_status_t CAN_SRV_Deinit(void)
     /* Deinitialize driver */
     CAN_Deinit(s_can_instance_num);
     
+    /* Return mailboxes to the registry */
+    for (uint8_t i = 0; i < s_rx_filter_count; i++) {
+        RES_SRV_Release(RES_SRV_CAN0_RX_MB, s_rx_filters[i].mb, RES_SRV_OWNER_SERVICE);
+    }
+    RES_SRV_Release(RES_SRV_CAN0_TX_MB, s_tx_mb, RES_SRV_OWNER_SERVICE);
+    for (uint8_t i = 0; i < s_tx_mailbox_count; i++) {
+        RES_SRV_Release(RES_SRV_CAN0_TX_MB, s_tx_mailboxes[i], RES_SRV_OWNER_SERVICE);
+    }
+    
     s_can_initialized = false;
-    s_user_callback = NULL;
+    s_rx_filter_count = 0;
+    s_tx_mailbox_count = 0;
+    s_callback_count = 0;
     
     return CAN_SRV_SUCCESS;
 }
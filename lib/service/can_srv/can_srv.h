@@ -9,11 +9,13 @@
  * - CAN initialization and configuration
  * - Message transmission
  * - Message reception
- * - RX callback support
+ * - RX callback support (several components may listen on the same bus)
+ * - Shared RX filter planning (identical filters share one mailbox)
+ * - Bus timestamps of received and sent frames (time synchronization)
  * 
  * @author  PhucPH32
  * @date    05/12/2025
- * @version 1.0
+ * @version 1.1
  */
 
 #ifndef CAN_SRV_H
@@ -30,6 +32,15 @@
  * Definitions
  ******************************************************************************/
 
+/** @brief Maximum number of registered service callbacks */
+#define CAN_SRV_MAX_CALLBACKS       (6U)
+
+/** @brief Maximum number of distinct RX filters (one RX mailbox each) */
+#define CAN_SRV_MAX_RX_FILTERS      (16U)
+
+/** @brief Maximum number of dedicated TX mailboxes (besides the shared one) */
+#define CAN_SRV_MAX_TX_MAILBOXES    (6U)
+
 /**
  * @brief CAN service status codes
  */
@@ -59,6 +70,7 @@ typedef struct {
     uint8_t dlc;                    /**< Data length (0-8) */
     bool isExtended;                /**< true = 29-bit ID, false = 11-bit ID */
     bool isRemote;                  /**< true = Remote frame, false = Data frame */
+    uint16_t timestamp;             /**< CAN_SRV_GetTimer() value when the ID was on the bus */
 } can_srv_message_t;
 
 /**
@@ -78,7 +90,8 @@ typedef struct {
  * @brief CAN service callback type
  * @param instance CAN instance number (0-2)
  * @param event Event type
- * @param message Received message (valid for RX_COMPLETE event)
+ * @param message RX_COMPLETE: received message. TX_COMPLETE: ID and
+ *                timestamp of the sent frame (data not copied).
  */
 typedef void (*can_srv_callback_t)(uint8_t instance, can_srv_event_t event, const can_srv_message_t *message);
 
@@ -88,25 +101,85 @@ typedef void (*can_srv_callback_t)(uint8_t instance, can_srv_event_t event, cons
 
 /**
  * @brief Initialize CAN service
+ * @details The first call initializes the controller. Later calls (from other
+ *          components sharing the node) only add their RX filters, provided
+ *          baudrate and mode match the running configuration.
  * @param config Pointer to CAN configuration structure
  * @return can_srv_status_t Status of initialization
+ *         - CAN_SRV_BUSY: Already running with a different baudrate/mode
  */
 can_srv_status_t CAN_SRV_Init(const can_srv_config_t *config);
 
+/**
+ * @brief Add an RX filter
+ * @details Filters identical to an existing one reuse its mailbox. New
+ *          filters take a free RX mailbox from the resource registry.
+ * @param id Filter ID
+ * @param mask Filter mask (1 = bit must match)
+ * @param extended true = 29-bit ID filter
+ * @return can_srv_status_t Status of operation
+ *         - CAN_SRV_BUSY: No RX mailbox left
+ */
+can_srv_status_t CAN_SRV_AddRxFilter(uint32_t id, uint32_t mask, bool extended);
+
 /**
  * @brief Register callback for CAN events
+ * @details Up to CAN_SRV_MAX_CALLBACKS callbacks may be registered. Every
+ *          callback receives every event, so each listener filters on
+ *          message->id itself. Registering the same callback twice is a no-op.
  * @param callback Callback function for CAN events
  * @return can_srv_status_t Status of operation
  */
 can_srv_status_t CAN_SRV_RegisterCallback(can_srv_callback_t callback);
 
 /**
- * @brief Send CAN message
+ * @brief Send CAN message on the shared TX mailbox
+ * @details Does not overwrite a frame still waiting for the bus. Senders
+ *          that must not lose frames to each other reserve their own
+ *          mailbox with CAN_SRV_AllocTxMailbox().
  * @param msg Pointer to message structure
  * @return can_srv_status_t Status of operation
+ *         - CAN_SRV_BUSY: Previous frame on the shared mailbox not sent yet
  */
 can_srv_status_t CAN_SRV_Send(const can_srv_message_t *msg);
 
+/**
+ * @brief Reserve a TX mailbox for one sender
+ * @details Frames that must leave back to back (e.g. all PDOs of one SYNC)
+ *          each get their own mailbox instead of queuing on the shared one.
+ * @param mailbox Receives the mailbox handle for CAN_SRV_SendOn()
+ * @return can_srv_status_t Status of operation
+ *         - CAN_SRV_BUSY: No TX mailbox left
+ */
+can_srv_status_t CAN_SRV_AllocTxMailbox(uint8_t *mailbox);
+
+/**
+ * @brief Send a CAN message on a reserved mailbox
+ * @details Does not overwrite a frame still waiting for the bus.
+ *          Interrupt safe as long as each mailbox has a single sender.
+ * @param mailbox Handle from CAN_SRV_AllocTxMailbox()
+ * @param msg Pointer to message structure
+ * @return can_srv_status_t Status of operation
+ *         - CAN_SRV_BUSY: Previous frame on this mailbox not sent yet
+ */
+can_srv_status_t CAN_SRV_SendOn(uint8_t mailbox, const can_srv_message_t *msg);
+
+/**
+ * @brief Read the bus timer
+ * @details Free running 16-bit counter of CAN bit times, the time base of
+ *          can_srv_message_t.timestamp. (timer - timestamp) is the age of
+ *          a frame, unambiguous for 65536 bit times (131 ms at 500 Kbps).
+ * @param timer Receives the timer value
+ * @return can_srv_status_t Status of operation
+ */
+can_srv_status_t CAN_SRV_GetTimer(uint16_t *timer);
+
+/**
+ * @brief Get the running baudrate
+ * @return uint32_t Baudrate in bps, 0 if not initialized
+ */
+uint32_t CAN_SRV_GetBaudrate(void);
+
 /**
  * @brief Deinitialize CAN service
  * @return can_srv_status_t Status of operation
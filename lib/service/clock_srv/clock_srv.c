@@ -19,7 +19,7 @@
 static bool                     s_clock_initialized = false;
 static clock_srv_config_t       s_current_config    = {0};
 static clock_srv_frequencies_t  s_current_freq      = {0};
-static uint32_t                 s_peripheral_clocks[16] = {0};
+static uint32_t                 s_peripheral_clocks[CLOCK_SRV_PERIPHERAL_COUNT] = {0};
 
 /*============================================================================*/
 /* Private Function Prototypes                                                */
@@ -197,7 +197,7 @@ clock_srv_status_t CLOCK_SRV_EnablePeripheral(clock_srv_peripheral_t peripheral,
 
     PCC_Enable(pcc_index);
 
-    if (peripheral < 16U)
+    if (peripheral < CLOCK_SRV_PERIPHERAL_COUNT)
         s_peripheral_clocks[peripheral] = peripheral_freq;
 
     return CLOCK_SRV_SUCCESS;
@@ -210,14 +210,14 @@ clock_srv_status_t CLOCK_SRV_DisablePeripheral(clock_srv_peripheral_t peripheral
     if (idx != 0U)
     {
         PCC_Disable(idx);
-        if (peripheral < 16U) s_peripheral_clocks[peripheral] = 0U;
+        if (peripheral < CLOCK_SRV_PERIPHERAL_COUNT) s_peripheral_clocks[peripheral] = 0U;
     }
     return CLOCK_SRV_SUCCESS;
 }
 
 uint32_t CLOCK_SRV_GetPeripheralClock(clock_srv_peripheral_t peripheral)
 {
-    if (!s_clock_initialized || peripheral >= 16U) return 0U;
+    if (!s_clock_initialized || peripheral >= CLOCK_SRV_PERIPHERAL_COUNT) return 0U;
     return s_peripheral_clocks[peripheral];
 }
 
@@ -274,6 +274,19 @@ static uint8_t GetPCCIndex(clock_srv_peripheral_t peripheral)
         case CLOCK_SRV_LPUART0:    return PCC_LPUART0_INDEX;
         case CLOCK_SRV_LPUART1:    return PCC_LPUART1_INDEX;
         case CLOCK_SRV_LPUART2:    return PCC_LPUART2_INDEX;
+        case CLOCK_SRV_DMAMUX:     return PCC_DMAMUX_INDEX;
+        case CLOCK_SRV_CRC:        return PCC_CRC_INDEX;
+        case CLOCK_SRV_LPSPI0:     return PCC_LPSPI0_INDEX;
+        case CLOCK_SRV_LPSPI1:     return PCC_LPSPI1_INDEX;
+        case CLOCK_SRV_LPSPI2:     return PCC_LPSPI2_INDEX;
+        case CLOCK_SRV_LPI2C0:     return PCC_LPI2C0_INDEX;
+        case CLOCK_SRV_PDB0:       return PCC_PDB0_INDEX;
+        case CLOCK_SRV_PDB1:       return PCC_PDB1_INDEX;
+        case CLOCK_SRV_FTM0:       return PCC_FTM0_INDEX;
+        case CLOCK_SRV_FTM1:       return PCC_FTM1_INDEX;
+        case CLOCK_SRV_FTM2:       return PCC_FTM2_INDEX;
+        case CLOCK_SRV_FTM3:       return PCC_FTM3_INDEX;
+        case CLOCK_SRV_FLEXIO:     return PCC_FLEXIO_INDEX;
         default:                   return 0U;
     }
 }
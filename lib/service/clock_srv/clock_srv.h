@@ -209,7 +209,21 @@ typedef enum
     CLOCK_SRV_FLEXCAN2,
     CLOCK_SRV_LPUART0,
     CLOCK_SRV_LPUART1,
-    CLOCK_SRV_LPUART2
+    CLOCK_SRV_LPUART2,
+    CLOCK_SRV_DMAMUX,
+    CLOCK_SRV_CRC,
+    CLOCK_SRV_LPSPI0,
+    CLOCK_SRV_LPSPI1,
+    CLOCK_SRV_LPSPI2,
+    CLOCK_SRV_LPI2C0,
+    CLOCK_SRV_PDB0,
+    CLOCK_SRV_PDB1,
+    CLOCK_SRV_FTM0,
+    CLOCK_SRV_FTM1,
+    CLOCK_SRV_FTM2,
+    CLOCK_SRV_FTM3,
+    CLOCK_SRV_FLEXIO,
+    CLOCK_SRV_PERIPHERAL_COUNT
 } clock_srv_peripheral_t;
 
 /*============================================================================*/
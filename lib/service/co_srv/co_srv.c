@@ -0,0 +1,692 @@
+/**
+ * @file    co_srv.c
+ * @brief   CANopen-lite Service Implementation
+ * @details Object dictionary lookup, PDO packing, SYNC, NMT and heartbeat
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "co_srv.h"
+#include "../can_srv/can_srv.h"
+#include "../lpit_srv/lpit_srv.h"
+#include "../res_srv/res_srv.h"
+#include "../../driver/nvic/nvic.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define CO_SRV_COB_ID_MASK          (0x7FFU)
+#define CO_SRV_NODE_ID_MAX          (127U)
+
+/* Same priority as the CAN interrupts: the heartbeat and an NMT reset share
+ * the heartbeat mailbox and must not preempt each other */
+#define CO_SRV_HEARTBEAT_IRQ_PRIO   (5U)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Mapped object resolved to an address
+ */
+typedef struct {
+    volatile void *data;
+    uint8_t size;                   /**< Object size in bytes */
+    uint8_t shift;                  /**< Bit position in the frame */
+    uint32_t mask;                  /**< Mapped bits, right aligned */
+} co_srv_slot_t;
+
+/**
+ * @brief Compiled PDO
+ */
+typedef struct {
+    co_srv_slot_t slot[CO_SRV_MAX_PDO_MAPPINGS];
+    uint8_t count;
+    uint8_t dlc;
+    uint8_t transmission;
+    uint32_t cob_id;
+    bool configured;
+} co_srv_pdo_t;
+
+typedef struct {
+    co_srv_pdo_t pdo;
+    uint8_t sync_left;              /**< SYNCs until the next transmission */
+    uint8_t mb;                     /**< Own TX mailbox */
+    bool has_mb;
+} co_srv_tpdo_t;
+
+typedef struct {
+    co_srv_pdo_t pdo;
+    uint64_t pending;               /**< Synchronous RPDO waiting for SYNC */
+    bool has_pending;
+} co_srv_rpdo_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static co_srv_config_t s_config;
+static volatile co_srv_nmt_state_t s_state = CO_SRV_NMT_INITIALISING;
+
+static co_srv_tpdo_t s_tpdo[CO_SRV_MAX_TPDO];
+static co_srv_rpdo_t s_rpdo[CO_SRV_MAX_RPDO];
+
+static uint8_t s_heartbeat_mb = 0;
+static uint8_t s_master_mb = 0;             /**< NMT/SYNC, taken on first use */
+static bool s_has_master_mb = false;
+static lpit_srv_config_t s_heartbeat_lpit;
+
+static co_srv_stats_t s_stats;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint32_t CO_SRV_OdKey(uint16_t index, uint8_t subindex)
+{
+    return ((uint32_t)index << 8) | subindex;
+}
+
+static uint32_t CO_SRV_ReadSlot(const co_srv_slot_t *slot)
+{
+    switch (slot->size) {
+        case 1U:
+            return *(volatile uint8_t *)slot->data;
+        case 2U:
+            return *(volatile uint16_t *)slot->data;
+        default:
+            return *(volatile uint32_t *)slot->data;
+    }
+}
+
+static void CO_SRV_WriteSlot(const co_srv_slot_t *slot, uint32_t value)
+{
+    switch (slot->size) {
+        case 1U:
+            *(volatile uint8_t *)slot->data = (uint8_t)value;
+            break;
+        case 2U:
+            *(volatile uint16_t *)slot->data = (uint16_t)value;
+            break;
+        default:
+            *(volatile uint32_t *)slot->data = value;
+            break;
+    }
+}
+
+/**
+ * @brief Resolve a mapping table into slots
+ * @param access Access every mapped object must allow
+ */
+static co_srv_status_t CO_SRV_Compile(const co_srv_pdo_config_t *config, uint8_t access,
+                                      co_srv_pdo_t *pdo)
+{
+    const co_srv_od_entry_t *entry;
+    co_srv_slot_t *slot;
+    uint32_t shift = 0;
+
+    if (config->count == 0U || config->count > CO_SRV_MAX_PDO_MAPPINGS || config->map == NULL) {
+        return CO_SRV_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < config->count; i++) {
+        entry = CO_SRV_OdFind(config->map[i].index, config->map[i].subindex);
+        if (entry == NULL) {
+            return CO_SRV_NOT_FOUND;
+        }
+
+        if ((entry->access & access) == 0U || config->map[i].bits == 0U ||
+            config->map[i].bits > entry->bits ||
+            shift + config->map[i].bits > CO_SRV_PDO_MAX_BITS) {
+            return CO_SRV_INVALID_PARAM;
+        }
+
+        slot = &pdo->slot[i];
+        slot->data = entry->data;
+        slot->size = (uint8_t)(entry->bits / 8U);
+        slot->shift = (uint8_t)shift;
+        slot->mask = (config->map[i].bits == 32U) ? 0xFFFFFFFFU : ((1UL << config->map[i].bits) - 1U);
+        shift += config->map[i].bits;
+    }
+
+    pdo->count = config->count;
+    pdo->dlc = (uint8_t)((shift + 7U) / 8U);
+
+    return CO_SRV_SUCCESS;
+}
+
+static uint64_t CO_SRV_Pack(const co_srv_pdo_t *pdo)
+{
+    uint64_t frame = 0;
+
+    for (uint8_t i = 0; i < pdo->count; i++) {
+        frame |= (uint64_t)(CO_SRV_ReadSlot(&pdo->slot[i]) & pdo->slot[i].mask) << pdo->slot[i].shift;
+    }
+
+    return frame;
+}
+
+static void CO_SRV_Unpack(const co_srv_pdo_t *pdo, uint64_t frame)
+{
+    for (uint8_t i = 0; i < pdo->count; i++) {
+        CO_SRV_WriteSlot(&pdo->slot[i], (uint32_t)(frame >> pdo->slot[i].shift) & pdo->slot[i].mask);
+    }
+}
+
+static co_srv_status_t CO_SRV_SendTpdo(co_srv_tpdo_t *tpdo)
+{
+    can_srv_message_t msg;
+    uint64_t frame;
+    can_srv_status_t status;
+
+    frame = CO_SRV_Pack(&tpdo->pdo);
+
+    msg.id = tpdo->pdo.cob_id;
+    msg.dlc = tpdo->pdo.dlc;
+    msg.isExtended = false;
+    msg.isRemote = false;
+    /* Cortex-M4 is little-endian, like the PDO layout */
+    memcpy(msg.data, &frame, sizeof(msg.data));
+
+    status = CAN_SRV_SendOn(tpdo->mb, &msg);
+    if (status == CAN_SRV_BUSY) {
+        s_stats.tpdo_busy++;
+        return CO_SRV_BUSY;
+    }
+    if (status != CAN_SRV_SUCCESS) {
+        return CO_SRV_ERROR;
+    }
+
+    s_stats.tpdo_sent++;
+
+    return CO_SRV_SUCCESS;
+}
+
+/**
+ * @brief Send an NMT master or SYNC producer frame on its own mailbox
+ */
+static co_srv_status_t CO_SRV_SendMaster(const can_srv_message_t *msg)
+{
+    can_srv_status_t status;
+
+    if (!s_has_master_mb) {
+        if (CAN_SRV_AllocTxMailbox(&s_master_mb) != CAN_SRV_SUCCESS) {
+            return CO_SRV_NO_RESOURCE;
+        }
+        s_has_master_mb = true;
+    }
+
+    status = CAN_SRV_SendOn(s_master_mb, msg);
+    if (status == CAN_SRV_BUSY) {
+        return CO_SRV_BUSY;
+    }
+    if (status != CAN_SRV_SUCCESS) {
+        return CO_SRV_ERROR;
+    }
+
+    return CO_SRV_SUCCESS;
+}
+
+static void CO_SRV_SendState(uint8_t state)
+{
+    can_srv_message_t msg = {0};
+
+    msg.id = CO_SRV_COB_HEARTBEAT(s_config.node_id);
+    msg.dlc = 1U;
+    msg.data[0] = state;
+
+    (void)CAN_SRV_SendOn(s_heartbeat_mb, &msg);
+}
+
+static void CO_SRV_SetState(co_srv_nmt_state_t state)
+{
+    if (s_state == state) {
+        return;
+    }
+
+    s_state = state;
+
+    if (s_config.on_nmt != NULL) {
+        s_config.on_nmt(state);
+    }
+}
+
+/**
+ * @brief Boot-up: communication reset, then pre-operational
+ */
+static void CO_SRV_Boot(void)
+{
+    for (uint8_t i = 0; i < CO_SRV_MAX_TPDO; i++) {
+        s_tpdo[i].sync_left = s_tpdo[i].pdo.transmission;
+    }
+    for (uint8_t i = 0; i < CO_SRV_MAX_RPDO; i++) {
+        s_rpdo[i].has_pending = false;
+    }
+
+    s_state = CO_SRV_NMT_INITIALISING;
+    CO_SRV_SendState(CO_SRV_NMT_INITIALISING);
+
+    CO_SRV_SetState(s_config.auto_start ? CO_SRV_NMT_OPERATIONAL : CO_SRV_NMT_PRE_OPERATIONAL);
+}
+
+static void CO_SRV_HandleNmt(uint8_t command, uint8_t node)
+{
+    if (node != CO_SRV_NMT_ALL_NODES && node != s_config.node_id) {
+        return;
+    }
+
+    /* Ignored until CO_SRV_Start() */
+    if (s_state == CO_SRV_NMT_INITIALISING) {
+        return;
+    }
+
+    switch (command) {
+        case CO_SRV_NMT_CMD_START:
+            CO_SRV_SetState(CO_SRV_NMT_OPERATIONAL);
+            break;
+
+        case CO_SRV_NMT_CMD_STOP:
+            CO_SRV_SetState(CO_SRV_NMT_STOPPED);
+            break;
+
+        case CO_SRV_NMT_CMD_PREOP:
+            CO_SRV_SetState(CO_SRV_NMT_PRE_OPERATIONAL);
+            break;
+
+        case CO_SRV_NMT_CMD_RESET_NODE:
+        case CO_SRV_NMT_CMD_RESET_COMM:
+            CO_SRV_Boot();
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void CO_SRV_HandleSync(void)
+{
+    co_srv_tpdo_t *tpdo;
+    co_srv_rpdo_t *rpdo;
+
+    s_stats.sync_count++;
+
+    /* Data received before this SYNC becomes valid now */
+    for (uint8_t i = 0; i < CO_SRV_MAX_RPDO; i++) {
+        rpdo = &s_rpdo[i];
+        if (rpdo->has_pending) {
+            rpdo->has_pending = false;
+            CO_SRV_Unpack(&rpdo->pdo, rpdo->pending);
+            if (s_config.on_rpdo != NULL) {
+                s_config.on_rpdo(i);
+            }
+        }
+    }
+
+    /* Then sample and send every due TPDO back to back */
+    for (uint8_t i = 0; i < CO_SRV_MAX_TPDO; i++) {
+        tpdo = &s_tpdo[i];
+        if (!tpdo->pdo.configured || tpdo->pdo.transmission > CO_SRV_PDO_SYNC_MAX) {
+            continue;
+        }
+
+        if (--tpdo->sync_left == 0U) {
+            tpdo->sync_left = tpdo->pdo.transmission;
+            (void)CO_SRV_SendTpdo(tpdo);
+        }
+    }
+}
+
+static void CO_SRV_HandleRpdo(uint8_t index, const can_srv_message_t *msg)
+{
+    co_srv_rpdo_t *rpdo = &s_rpdo[index];
+    uint64_t frame = 0;
+
+    if (msg->dlc < rpdo->pdo.dlc) {
+        s_stats.rpdo_short++;
+        return;
+    }
+
+    s_stats.rpdo_received++;
+    memcpy(&frame, msg->data, sizeof(frame));
+
+    if (rpdo->pdo.transmission <= CO_SRV_PDO_SYNC_MAX) {
+        rpdo->pending = frame;
+        rpdo->has_pending = true;
+        return;
+    }
+
+    CO_SRV_Unpack(&rpdo->pdo, frame);
+    if (s_config.on_rpdo != NULL) {
+        s_config.on_rpdo(index);
+    }
+}
+
+/**
+ * @brief can_srv listener (CAN interrupt context)
+ */
+static void CO_SRV_CANCallback(uint8_t instance, can_srv_event_t event, const can_srv_message_t *msg)
+{
+    (void)instance;
+
+    if (event != CAN_SRV_EVENT_RX_COMPLETE || msg == NULL || msg->isExtended || msg->isRemote) {
+        return;
+    }
+
+    if (msg->id == CO_SRV_COB_NMT) {
+        if (msg->dlc >= 2U) {
+            CO_SRV_HandleNmt(msg->data[0], msg->data[1]);
+        }
+        return;
+    }
+
+    if (s_state != CO_SRV_NMT_OPERATIONAL) {
+        return;
+    }
+
+    if (msg->id == CO_SRV_COB_SYNC) {
+        CO_SRV_HandleSync();
+        return;
+    }
+
+    for (uint8_t i = 0; i < CO_SRV_MAX_RPDO; i++) {
+        if (s_rpdo[i].pdo.configured && s_rpdo[i].pdo.cob_id == msg->id) {
+            CO_SRV_HandleRpdo(i, msg);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Heartbeat timer (LPIT interrupt context)
+ */
+static void CO_SRV_HeartbeatCallback(void)
+{
+    if (s_state != CO_SRV_NMT_INITIALISING) {
+        CO_SRV_SendState((uint8_t)s_state);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+co_srv_status_t CO_SRV_Init(const co_srv_config_t *config)
+{
+    uint8_t channel;
+
+    if (config == NULL || config->node_id == 0U || config->node_id > CO_SRV_NODE_ID_MAX ||
+        (config->od == NULL && config->od_count != 0U)) {
+        return CO_SRV_INVALID_PARAM;
+    }
+
+    if (s_initialized) {
+        return CO_SRV_ERROR;
+    }
+
+    /* Binary search needs a strictly ascending table */
+    for (uint16_t i = 0; i < config->od_count; i++) {
+        if (config->od[i].data == NULL ||
+            (config->od[i].bits != 8U && config->od[i].bits != 16U && config->od[i].bits != 32U)) {
+            return CO_SRV_INVALID_PARAM;
+        }
+        if (i > 0U && CO_SRV_OdKey(config->od[i].index, config->od[i].subindex) <=
+                      CO_SRV_OdKey(config->od[i - 1U].index, config->od[i - 1U].subindex)) {
+            return CO_SRV_INVALID_PARAM;
+        }
+    }
+
+    s_config = *config;
+    s_state = CO_SRV_NMT_INITIALISING;
+    memset(s_tpdo, 0, sizeof(s_tpdo));
+    memset(s_rpdo, 0, sizeof(s_rpdo));
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_has_master_mb = false;
+
+    if (CAN_SRV_AddRxFilter(CO_SRV_COB_NMT, CO_SRV_COB_ID_MASK, false) != CAN_SRV_SUCCESS ||
+        CAN_SRV_AddRxFilter(CO_SRV_COB_SYNC, CO_SRV_COB_ID_MASK, false) != CAN_SRV_SUCCESS) {
+        return CO_SRV_NO_RESOURCE;
+    }
+
+    if (CAN_SRV_AllocTxMailbox(&s_heartbeat_mb) != CAN_SRV_SUCCESS) {
+        return CO_SRV_NO_RESOURCE;
+    }
+
+    if (CAN_SRV_RegisterCallback(CO_SRV_CANCallback) != CAN_SRV_SUCCESS) {
+        return CO_SRV_ERROR;
+    }
+
+    if (config->heartbeat_ms != 0U) {
+        if (LPIT_SRV_Init() != LPIT_SRV_SUCCESS) {
+            return CO_SRV_ERROR;
+        }
+
+        if (RES_SRV_Alloc(RES_SRV_LPIT_CHANNEL, RES_SRV_OWNER_SERVICE, &channel) != RES_SRV_SUCCESS) {
+            return CO_SRV_NO_RESOURCE;
+        }
+
+        s_heartbeat_lpit.channel = channel;
+        s_heartbeat_lpit.period_us = (uint32_t)config->heartbeat_ms * 1000U;
+        s_heartbeat_lpit.is_running = false;
+
+        if (LPIT_SRV_Config(&s_heartbeat_lpit, CO_SRV_HeartbeatCallback) != LPIT_SRV_SUCCESS) {
+            RES_SRV_Release(RES_SRV_LPIT_CHANNEL, channel, RES_SRV_OWNER_SERVICE);
+            return CO_SRV_ERROR;
+        }
+
+        NVIC_EnableInterrupt((IRQn_Type)(LPIT0_Ch0_IRQn + channel));
+        NVIC_SetPriority((IRQn_Type)(LPIT0_Ch0_IRQn + channel), CO_SRV_HEARTBEAT_IRQ_PRIO);
+    }
+
+    s_initialized = true;
+
+    return CO_SRV_SUCCESS;
+}
+
+co_srv_status_t CO_SRV_ConfigTpdo(uint8_t pdo, const co_srv_pdo_config_t *config)
+{
+    co_srv_tpdo_t *tpdo;
+    co_srv_pdo_t compiled = {0};
+    co_srv_status_t status;
+
+    if (!s_initialized) {
+        return CO_SRV_NOT_INITIALIZED;
+    }
+
+    if (pdo >= CO_SRV_MAX_TPDO || config == NULL ||
+        config->transmission == 0U ||
+        (config->transmission > CO_SRV_PDO_SYNC_MAX && config->transmission < 254U)) {
+        return CO_SRV_INVALID_PARAM;
+    }
+
+    /* Mapping is read from the CAN interrupt while operational */
+    if (s_state == CO_SRV_NMT_OPERATIONAL) {
+        return CO_SRV_BUSY;
+    }
+
+    status = CO_SRV_Compile(config, CO_SRV_OD_RO, &compiled);
+    if (status != CO_SRV_SUCCESS) {
+        return status;
+    }
+
+    tpdo = &s_tpdo[pdo];
+    if (!tpdo->has_mb) {
+        if (CAN_SRV_AllocTxMailbox(&tpdo->mb) != CAN_SRV_SUCCESS) {
+            return CO_SRV_NO_RESOURCE;
+        }
+        tpdo->has_mb = true;
+    }
+
+    compiled.transmission = config->transmission;
+    compiled.cob_id = (config->cob_id != 0U) ? (config->cob_id & CO_SRV_COB_ID_MASK)
+                                             : CO_SRV_COB_TPDO(pdo, s_config.node_id);
+    compiled.configured = true;
+
+    tpdo->pdo = compiled;
+    tpdo->sync_left = compiled.transmission;
+
+    return CO_SRV_SUCCESS;
+}
+
+co_srv_status_t CO_SRV_ConfigRpdo(uint8_t pdo, const co_srv_pdo_config_t *config)
+{
+    co_srv_pdo_t compiled = {0};
+    co_srv_status_t status;
+
+    if (!s_initialized) {
+        return CO_SRV_NOT_INITIALIZED;
+    }
+
+    if (pdo >= CO_SRV_MAX_RPDO || config == NULL ||
+        (config->transmission > CO_SRV_PDO_SYNC_MAX && config->transmission < 254U)) {
+        return CO_SRV_INVALID_PARAM;
+    }
+
+    if (s_state == CO_SRV_NMT_OPERATIONAL) {
+        return CO_SRV_BUSY;
+    }
+
+    status = CO_SRV_Compile(config, CO_SRV_OD_WO, &compiled);
+    if (status != CO_SRV_SUCCESS) {
+        return status;
+    }
+
+    compiled.transmission = config->transmission;
+    compiled.cob_id = (config->cob_id != 0U) ? (config->cob_id & CO_SRV_COB_ID_MASK)
+                                             : CO_SRV_COB_RPDO(pdo, s_config.node_id);
+
+    /* A filter of a previous COB-ID stays; frames on it no longer match */
+    if (CAN_SRV_AddRxFilter(compiled.cob_id, CO_SRV_COB_ID_MASK, false) != CAN_SRV_SUCCESS) {
+        return CO_SRV_NO_RESOURCE;
+    }
+
+    compiled.configured = true;
+    s_rpdo[pdo].pdo = compiled;
+    s_rpdo[pdo].has_pending = false;
+
+    return CO_SRV_SUCCESS;
+}
+
+co_srv_status_t CO_SRV_Start(void)
+{
+    if (!s_initialized) {
+        return CO_SRV_NOT_INITIALIZED;
+    }
+
+    if (s_state != CO_SRV_NMT_INITIALISING) {
+        return CO_SRV_SUCCESS;
+    }
+
+    /* Heartbeat timer not running yet, so the boot-up has the mailbox */
+    CO_SRV_Boot();
+
+    if (s_config.heartbeat_ms != 0U) {
+        LPIT_SRV_Start(&s_heartbeat_lpit);
+    }
+
+    return CO_SRV_SUCCESS;
+}
+
+co_srv_status_t CO_SRV_TriggerTpdo(uint8_t pdo)
+{
+    if (!s_initialized) {
+        return CO_SRV_NOT_INITIALIZED;
+    }
+
+    if (pdo >= CO_SRV_MAX_TPDO || !s_tpdo[pdo].pdo.configured ||
+        s_tpdo[pdo].pdo.transmission <= CO_SRV_PDO_SYNC_MAX) {
+        return CO_SRV_INVALID_PARAM;
+    }
+
+    if (s_state != CO_SRV_NMT_OPERATIONAL) {
+        return CO_SRV_ERROR;
+    }
+
+    return CO_SRV_SendTpdo(&s_tpdo[pdo]);
+}
+
+co_srv_nmt_state_t CO_SRV_GetState(void)
+{
+    return s_state;
+}
+
+const co_srv_od_entry_t *CO_SRV_OdFind(uint16_t index, uint8_t subindex)
+{
+    uint32_t key = CO_SRV_OdKey(index, subindex);
+    uint32_t entry_key;
+    uint16_t lo = 0;
+    uint16_t hi = s_config.od_count;
+    uint16_t mid;
+
+    while (lo < hi) {
+        mid = (uint16_t)((lo + hi) / 2U);
+        entry_key = CO_SRV_OdKey(s_config.od[mid].index, s_config.od[mid].subindex);
+
+        if (entry_key == key) {
+            return &s_config.od[mid];
+        }
+
+        if (entry_key < key) {
+            lo = (uint16_t)(mid + 1U);
+        } else {
+            hi = mid;
+        }
+    }
+
+    return NULL;
+}
+
+co_srv_status_t CO_SRV_SendNmt(uint8_t command, uint8_t node)
+{
+    can_srv_message_t msg = {0};
+
+    if (!s_initialized) {
+        return CO_SRV_NOT_INITIALIZED;
+    }
+
+    if (node > CO_SRV_NODE_ID_MAX) {
+        return CO_SRV_INVALID_PARAM;
+    }
+
+    msg.id = CO_SRV_COB_NMT;
+    msg.dlc = 2U;
+    msg.data[0] = command;
+    msg.data[1] = node;
+
+    return CO_SRV_SendMaster(&msg);
+}
+
+co_srv_status_t CO_SRV_SendSync(void)
+{
+    can_srv_message_t msg = {0};
+
+    if (!s_initialized) {
+        return CO_SRV_NOT_INITIALIZED;
+    }
+
+    msg.id = CO_SRV_COB_SYNC;
+    msg.dlc = 0U;
+
+    return CO_SRV_SendMaster(&msg);
+}
+
+co_srv_status_t CO_SRV_GetStats(co_srv_stats_t *stats)
+{
+    if (stats == NULL) {
+        return CO_SRV_INVALID_PARAM;
+    }
+
+    if (!s_initialized) {
+        return CO_SRV_NOT_INITIALIZED;
+    }
+
+    *stats = s_stats;
+
+    return CO_SRV_SUCCESS;
+}
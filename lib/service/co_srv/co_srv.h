@@ -0,0 +1,265 @@
+/**
+ * @file    co_srv.h
+ * @brief   CANopen-lite Service - Abstraction API
+ * @details
+ * Subset of CANopen (CiA 301) on top of can_srv, enough to replace
+ * hand-rolled IDs and payloads between nodes:
+ * - Object dictionary: a const table built at compile time with
+ *   CO_SRV_OD_VAR(), sorted by index/subindex, pointing at application
+ *   variables (8, 16 or 32 bit). No SDO access.
+ * - TPDO/RPDO with bit-level mapping: any number of bits (1-32) of an
+ *   object at any bit position, up to 64 bits per PDO, little-endian as
+ *   in CANopen
+ * - Synchronous TPDOs (transmission type 1-240: every n-th SYNC) and
+ *   synchronous RPDOs (0-240: applied at the next SYNC). Types 254/255
+ *   are event driven: TPDOs go out on CO_SRV_TriggerTpdo(), RPDOs are
+ *   applied on reception.
+ * - NMT slave (start, stop, pre-operational, resets) and heartbeat
+ *   producer with boot-up message
+ * - NMT master and SYNC producer helpers (a master does not receive its
+ *   own NMT commands)
+ *
+ * Mappings are resolved against the dictionary once, when the PDO is
+ * configured, into {address, size, shift, mask} slots. A SYNC then packs
+ * every due TPDO with one shift/mask per slot and sends it on its own TX
+ * mailbox straight from the CAN interrupt, so all PDOs of one SYNC leave
+ * back to back.
+ *
+ * Reset node is handled like reset communication: the node sends its
+ * boot-up message again and returns to pre-operational.
+ *
+ * @note Objects mapped into PDOs are read and written from the CAN
+ *       interrupt. Values wider than one access are not read atomically
+ *       across several objects.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef CO_SRV_H
+#define CO_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Limits */
+#define CO_SRV_MAX_TPDO             (4U)
+#define CO_SRV_MAX_RPDO             (4U)
+#define CO_SRV_MAX_PDO_MAPPINGS     (8U)            /* Objects per PDO */
+#define CO_SRV_PDO_MAX_BITS         (64U)
+
+/** @brief Predefined connection set (11-bit COB-IDs) */
+#define CO_SRV_COB_NMT              (0x000U)
+#define CO_SRV_COB_SYNC             (0x080U)
+#define CO_SRV_COB_TPDO(n, node)    (0x180U + 0x100U * (uint32_t)(n) + (uint32_t)(node))
+#define CO_SRV_COB_RPDO(n, node)    (0x200U + 0x100U * (uint32_t)(n) + (uint32_t)(node))
+#define CO_SRV_COB_HEARTBEAT(node)  (0x700U + (uint32_t)(node))
+
+/** @brief NMT commands (data[0] of the NMT frame) */
+#define CO_SRV_NMT_CMD_START        (0x01U)
+#define CO_SRV_NMT_CMD_STOP         (0x02U)
+#define CO_SRV_NMT_CMD_PREOP        (0x80U)
+#define CO_SRV_NMT_CMD_RESET_NODE   (0x81U)
+#define CO_SRV_NMT_CMD_RESET_COMM   (0x82U)
+#define CO_SRV_NMT_ALL_NODES        (0x00U)
+
+/** @brief PDO transmission types */
+#define CO_SRV_PDO_SYNC_MAX         (240U)          /* 1..240: every n-th SYNC */
+#define CO_SRV_PDO_EVENT            (255U)
+
+/** @brief Object access */
+#define CO_SRV_OD_RO                (0x01U)         /* May be mapped into a TPDO */
+#define CO_SRV_OD_WO                (0x02U)         /* May be mapped into an RPDO */
+#define CO_SRV_OD_RW                (CO_SRV_OD_RO | CO_SRV_OD_WO)
+
+/**
+ * @brief Dictionary entry for an application variable
+ * @details Size is taken from the variable at compile time, so the table
+ *          can live in flash.
+ */
+#define CO_SRV_OD_VAR(idx, sub, access, var) \
+    { (uint16_t)(idx), (uint8_t)(sub), (uint8_t)(sizeof(var) * 8U), (uint8_t)(access), \
+      (volatile void *)&(var) }
+
+/**
+ * @brief CANopen service status codes
+ */
+typedef enum {
+    CO_SRV_SUCCESS = 0,             /**< Operation successful */
+    CO_SRV_ERROR,                   /**< General error */
+    CO_SRV_NOT_INITIALIZED,         /**< Service not initialized */
+    CO_SRV_INVALID_PARAM,           /**< Invalid parameter or mapping */
+    CO_SRV_NO_RESOURCE,             /**< No CAN mailbox or LPIT channel left */
+    CO_SRV_NOT_FOUND,               /**< Object not in the dictionary */
+    CO_SRV_BUSY                     /**< Previous frame not sent yet */
+} co_srv_status_t;
+
+/**
+ * @brief NMT state (heartbeat value)
+ */
+typedef enum {
+    CO_SRV_NMT_INITIALISING = 0x00,
+    CO_SRV_NMT_STOPPED = 0x04,
+    CO_SRV_NMT_OPERATIONAL = 0x05,
+    CO_SRV_NMT_PRE_OPERATIONAL = 0x7F
+} co_srv_nmt_state_t;
+
+/**
+ * @brief Object dictionary entry (use CO_SRV_OD_VAR())
+ */
+typedef struct {
+    uint16_t index;
+    uint8_t subindex;
+    uint8_t bits;                   /**< 8, 16 or 32 */
+    uint8_t access;                 /**< CO_SRV_OD_x */
+    volatile void *data;
+} co_srv_od_entry_t;
+
+/**
+ * @brief One mapped object
+ */
+typedef struct {
+    uint16_t index;
+    uint8_t subindex;
+    uint8_t bits;                   /**< Low bits of the object carried (1-32) */
+} co_srv_pdo_map_t;
+
+/**
+ * @brief PDO configuration
+ * @details Objects are packed from bit 0 upwards in table order.
+ */
+typedef struct {
+    uint32_t cob_id;                /**< 0 = predefined connection set */
+    uint8_t transmission;           /**< 1-240 or CO_SRV_PDO_EVENT (RPDO: 0-240 sync) */
+    uint8_t count;                  /**< Number of mapped objects */
+    const co_srv_pdo_map_t *map;
+} co_srv_pdo_config_t;
+
+/**
+ * @brief NMT state change (CAN interrupt context)
+ */
+typedef void (*co_srv_nmt_callback_t)(co_srv_nmt_state_t state);
+
+/**
+ * @brief RPDO applied to the dictionary (CAN interrupt context)
+ */
+typedef void (*co_srv_rpdo_callback_t)(uint8_t pdo);
+
+/**
+ * @brief Service configuration
+ */
+typedef struct {
+    uint8_t node_id;                /**< 1-127 */
+    const co_srv_od_entry_t *od;    /**< Sorted by index, then subindex */
+    uint16_t od_count;
+    uint16_t heartbeat_ms;          /**< 0 = no heartbeat */
+    bool auto_start;                /**< Go operational without an NMT start */
+    co_srv_nmt_callback_t on_nmt;   /**< Optional, NULL allowed */
+    co_srv_rpdo_callback_t on_rpdo; /**< Optional, NULL allowed */
+} co_srv_config_t;
+
+/**
+ * @brief Service statistics
+ */
+typedef struct {
+    uint32_t sync_count;
+    uint32_t tpdo_sent;
+    uint32_t tpdo_busy;             /**< Skipped, mailbox still busy */
+    uint32_t rpdo_received;
+    uint32_t rpdo_short;            /**< Dropped, DLC shorter than the mapping */
+} co_srv_stats_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the CANopen service
+ * @details Joins can_srv (NMT and SYNC filters, heartbeat mailbox) and
+ *          takes an LPIT channel for the heartbeat. CAN_SRV_Init() and
+ *          LPIT_SRV_Init() must have been called. The node stays
+ *          initialising until CO_SRV_Start().
+ * @param config Configuration (od table is not copied)
+ * @return co_srv_status_t Status of initialization
+ */
+co_srv_status_t CO_SRV_Init(const co_srv_config_t *config);
+
+/**
+ * @brief Map a TPDO
+ * @details Resolves the mapping against the dictionary and reserves a TX
+ *          mailbox on the first call for this PDO.
+ * @param pdo TPDO number (0-based, TPDO1 = 0)
+ * @param config PDO configuration
+ * @return co_srv_status_t Status of operation
+ */
+co_srv_status_t CO_SRV_ConfigTpdo(uint8_t pdo, const co_srv_pdo_config_t *config);
+
+/**
+ * @brief Map an RPDO
+ * @param pdo RPDO number (0-based, RPDO1 = 0)
+ * @param config PDO configuration
+ * @return co_srv_status_t Status of operation
+ */
+co_srv_status_t CO_SRV_ConfigRpdo(uint8_t pdo, const co_srv_pdo_config_t *config);
+
+/**
+ * @brief Send the boot-up message and enter pre-operational
+ * @details Goes on to operational with auto_start.
+ * @return co_srv_status_t Status of operation
+ */
+co_srv_status_t CO_SRV_Start(void);
+
+/**
+ * @brief Send an event-driven TPDO now
+ * @param pdo TPDO number
+ * @return co_srv_status_t CO_SRV_BUSY if the previous one is still queued
+ */
+co_srv_status_t CO_SRV_TriggerTpdo(uint8_t pdo);
+
+/**
+ * @brief Get the NMT state
+ * @return co_srv_nmt_state_t Current state
+ */
+co_srv_nmt_state_t CO_SRV_GetState(void);
+
+/**
+ * @brief Look up an object
+ * @param index Object index
+ * @param subindex Object subindex
+ * @return const co_srv_od_entry_t* Entry, NULL if not found
+ */
+const co_srv_od_entry_t *CO_SRV_OdFind(uint16_t index, uint8_t subindex);
+
+/**
+ * @brief Send an NMT command (NMT master)
+ * @param command CO_SRV_NMT_CMD_x
+ * @param node Target node, CO_SRV_NMT_ALL_NODES for all
+ * @return co_srv_status_t Status of operation
+ *         - CO_SRV_BUSY: Previous NMT/SYNC frame not sent yet
+ *         - CO_SRV_NO_RESOURCE: No TX mailbox left for the master frames
+ */
+co_srv_status_t CO_SRV_SendNmt(uint8_t command, uint8_t node);
+
+/**
+ * @brief Send a SYNC (SYNC producer)
+ * @details Shares the mailbox of CO_SRV_SendNmt().
+ * @return co_srv_status_t Status of operation
+ */
+co_srv_status_t CO_SRV_SendSync(void);
+
+/**
+ * @brief Get service statistics
+ * @param stats Output
+ * @return co_srv_status_t Status of operation
+ */
+co_srv_status_t CO_SRV_GetStats(co_srv_stats_t *stats);
+
+#endif /* CO_SRV_H */
@@ -0,0 +1,167 @@
+/**
+ * @file    crc_srv.h
+ * @brief   CRC Service - Abstraction API
+ * @details
+ * Checksums for firmware images, configuration blocks and framed UART/CAN
+ * payloads.
+ *
+ * Features:
+ * - CRC16-CCITT (CCITT-FALSE: poly 0x1021, init 0xFFFF, check 0x29B1)
+ * - CRC32 (IEEE 802.3: poly 0x04C11DB7 reflected, check 0xCBF43926)
+ * - Automatic engine selection by length:
+ *   - length <= sw_max_bytes: table-driven software (no peripheral setup)
+ *   - length <  dma_min_bytes: CRC peripheral fed with 32-bit CPU writes
+ *   - otherwise: CRC peripheral fed by an eDMA channel
+ *   Thresholds default to the values measured by the crossover benchmark
+ *   (lib/example_srv/crc_bench_ex.c) and can be changed at runtime.
+ * - Incremental contexts: engines can be mixed across Update calls, the
+ *   running value is carried in the context, not in the peripheral
+ *
+ * @note The CRC peripheral and its DMA channel are shared; call the
+ *       hardware paths from thread context only. Interrupt handlers get
+ *       the software path by forcing CRC_SRV_PATH_SW.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef CRC_SRV_H
+#define CRC_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Inputs up to this size use the software tables */
+#ifndef CRC_SRV_SW_MAX_BYTES
+#define CRC_SRV_SW_MAX_BYTES        (12U)
+#endif
+
+/** @brief Inputs from this size on are fed by DMA */
+#ifndef CRC_SRV_DMA_MIN_BYTES
+#define CRC_SRV_DMA_MIN_BYTES       (256U)
+#endif
+
+/** @brief Bytes per DMA minor loop (other channels can preempt in between) */
+#define CRC_SRV_DMA_MINOR_BYTES     (64U)
+
+/**
+ * @brief CRC service status codes
+ */
+typedef enum {
+    CRC_SRV_SUCCESS = 0,
+    CRC_SRV_ERROR,
+    CRC_SRV_NOT_INITIALIZED,
+    CRC_SRV_BUSY,                   /**< DMA computation still running */
+    CRC_SRV_INVALID_PARAM
+} crc_srv_status_t;
+
+/**
+ * @brief Supported algorithms
+ */
+typedef enum {
+    CRC_SRV_CRC16_CCITT = 0,
+    CRC_SRV_CRC32,
+    CRC_SRV_ALGO_COUNT
+} crc_srv_algo_t;
+
+/**
+ * @brief Engine selection
+ */
+typedef enum {
+    CRC_SRV_PATH_AUTO = 0,          /**< Pick by length (thresholds) */
+    CRC_SRV_PATH_SW,                /**< Table-driven software */
+    CRC_SRV_PATH_HW,                /**< Peripheral, CPU writes */
+    CRC_SRV_PATH_DMA                /**< Peripheral, DMA writes */
+} crc_srv_path_t;
+
+/**
+ * @brief Incremental computation context
+ */
+typedef struct {
+    crc_srv_algo_t algo;            /**< Algorithm */
+    uint32_t crc;                   /**< Running value (algorithm bit order) */
+} crc_srv_ctx_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize CRC service
+ * @details Enables the CRC and DMAMUX clocks and takes a DMA channel from
+ *          the resource registry. Without a free channel the DMA path
+ *          falls back to CPU writes.
+ * @return crc_srv_status_t Status of initialization
+ */
+crc_srv_status_t CRC_SRV_Init(void);
+
+/**
+ * @brief One-shot checksum
+ * @param algo Algorithm
+ * @param data Data
+ * @param length Length in bytes
+ * @return uint32_t CRC (16-bit results in the low half-word)
+ */
+uint32_t CRC_SRV_Compute(crc_srv_algo_t algo, const void *data, uint32_t length);
+
+/**
+ * @brief Start an incremental computation
+ * @param ctx Context
+ * @param algo Algorithm
+ */
+void CRC_SRV_Begin(crc_srv_ctx_t *ctx, crc_srv_algo_t algo);
+
+/**
+ * @brief Add data to an incremental computation (automatic engine)
+ * @param ctx Context
+ * @param data Data
+ * @param length Length in bytes
+ */
+void CRC_SRV_Update(crc_srv_ctx_t *ctx, const void *data, uint32_t length);
+
+/**
+ * @brief Add data using a given engine
+ * @details CRC_SRV_PATH_AUTO behaves like CRC_SRV_Update(). Hardware paths
+ *          fall back to software before CRC_SRV_Init().
+ */
+void CRC_SRV_UpdatePath(crc_srv_ctx_t *ctx, const void *data, uint32_t length,
+                        crc_srv_path_t path);
+
+/**
+ * @brief Finish an incremental computation
+ * @param ctx Context
+ * @return uint32_t CRC
+ */
+uint32_t CRC_SRV_Finish(const crc_srv_ctx_t *ctx);
+
+/**
+ * @brief Start a DMA-fed checksum and return immediately
+ * @details The CPU is free while the DMA streams the buffer into the
+ *          peripheral. Collect the result with CRC_SRV_Poll().
+ * @return crc_srv_status_t CRC_SRV_BUSY if a computation is running
+ */
+crc_srv_status_t CRC_SRV_ComputeAsync(crc_srv_algo_t algo, const void *data, uint32_t length);
+
+/**
+ * @brief Collect the result of CRC_SRV_ComputeAsync()
+ * @param[out] result CRC when CRC_SRV_SUCCESS is returned
+ * @return crc_srv_status_t CRC_SRV_BUSY while the DMA is running
+ */
+crc_srv_status_t CRC_SRV_Poll(uint32_t *result);
+
+/**
+ * @brief Change the engine selection thresholds
+ * @param swMaxBytes Largest input handled in software
+ * @param dmaMinBytes Smallest input fed by DMA
+ */
+void CRC_SRV_SetThresholds(uint32_t swMaxBytes, uint32_t dmaMinBytes);
+
+#endif /* CRC_SRV_H */
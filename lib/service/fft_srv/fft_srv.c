@@ -0,0 +1,489 @@
+/**
+ * @file    fft_srv.c
+ * @brief   FFT Service Implementation
+ * @details Q15 decimation-in-frequency FFT. A radix-4 pass is the radix-2^2
+ *          butterfly: two radix-2 levels with the inner -j twiddle folded
+ *          into exchange add/subtract, so output stays in bit-reversed
+ *          order and one radix-2 level can finish odd sizes.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fft_srv.h"
+#include "../../driver/ultis/mem_ultis.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Twiddles W^k = cos - j sin (2 pi k / MAX_SIZE), k < 3/4 MAX_SIZE */
+#define FFT_TWIDDLE_COUNT           ((FFT_SRV_MAX_SIZE * 3U) / 4U)
+
+/** @brief Peaks kept while searching */
+#define FFT_MAX_PEAKS               (16U)
+
+/*******************************************************************************
+ * SIMD Helpers
+ ******************************************************************************/
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+
+/* (a + b) / 2 per halfword */
+static inline uint32_t FFT_SHADD16(uint32_t a, uint32_t b)
+{
+    uint32_t r;
+    __asm ("shadd16 %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+}
+
+/* (a - b) / 2 per halfword */
+static inline uint32_t FFT_SHSUB16(uint32_t a, uint32_t b)
+{
+    uint32_t r;
+    __asm ("shsub16 %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+}
+
+/* hi = (a.hi + b.lo) / 2, lo = (a.lo - b.hi) / 2 */
+static inline uint32_t FFT_SHASX(uint32_t a, uint32_t b)
+{
+    uint32_t r;
+    __asm ("shasx %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+}
+
+/* hi = (a.hi - b.lo) / 2, lo = (a.lo + b.hi) / 2 */
+static inline uint32_t FFT_SHSAX(uint32_t a, uint32_t b)
+{
+    uint32_t r;
+    __asm ("shsax %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+}
+
+/* a.lo * b.lo + a.hi * b.hi */
+static inline int32_t FFT_SMUAD(uint32_t a, uint32_t b)
+{
+    int32_t r;
+    __asm ("smuad %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+}
+
+/* a.lo * b.hi - a.hi * b.lo */
+static inline int32_t FFT_SMUSDX(uint32_t a, uint32_t b)
+{
+    int32_t r;
+    __asm ("smusdx %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+}
+
+static inline uint32_t FFT_RBIT(uint32_t a)
+{
+    uint32_t r;
+    __asm ("rbit %0, %1" : "=r" (r) : "r" (a));
+    return r;
+}
+
+#else
+
+static inline uint32_t FFT_Halves(int32_t lo, int32_t hi)
+{
+    return FFT_SRV_PACK(lo >> 1, hi >> 1);
+}
+
+static inline uint32_t FFT_SHADD16(uint32_t a, uint32_t b)
+{
+    return FFT_Halves(FFT_SRV_RE(a) + FFT_SRV_RE(b), FFT_SRV_IM(a) + FFT_SRV_IM(b));
+}
+
+static inline uint32_t FFT_SHSUB16(uint32_t a, uint32_t b)
+{
+    return FFT_Halves(FFT_SRV_RE(a) - FFT_SRV_RE(b), FFT_SRV_IM(a) - FFT_SRV_IM(b));
+}
+
+static inline uint32_t FFT_SHASX(uint32_t a, uint32_t b)
+{
+    return FFT_Halves(FFT_SRV_RE(a) - FFT_SRV_IM(b), FFT_SRV_IM(a) + FFT_SRV_RE(b));
+}
+
+static inline uint32_t FFT_SHSAX(uint32_t a, uint32_t b)
+{
+    return FFT_Halves(FFT_SRV_RE(a) + FFT_SRV_IM(b), FFT_SRV_IM(a) - FFT_SRV_RE(b));
+}
+
+static inline int32_t FFT_SMUAD(uint32_t a, uint32_t b)
+{
+    /* Wraps like the instruction: |a|^2 can reach 2^31 */
+    return (int32_t)((uint32_t)((int32_t)FFT_SRV_RE(a) * FFT_SRV_RE(b)) +
+                     (uint32_t)((int32_t)FFT_SRV_IM(a) * FFT_SRV_IM(b)));
+}
+
+static inline int32_t FFT_SMUSDX(uint32_t a, uint32_t b)
+{
+    return (int32_t)FFT_SRV_RE(a) * FFT_SRV_IM(b) - (int32_t)FFT_SRV_IM(a) * FFT_SRV_RE(b);
+}
+
+static inline uint32_t FFT_RBIT(uint32_t a)
+{
+    uint32_t r = 0U;
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        r = (r << 1) | (a & 1U);
+        a >>= 1;
+    }
+    return r;
+}
+
+#endif
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+
+/* sin(2 pi k / 1024), k = 0..256, Q15 */
+static const uint16_t s_quarter_sine[(FFT_SRV_MAX_SIZE / 4U) + 1U] = {
+        0U,   201U,   402U,   603U,   804U,  1005U,  1206U,  1407U,
+     1608U,  1809U,  2009U,  2210U,  2411U,  2611U,  2811U,  3012U,
+     3212U,  3412U,  3612U,  3812U,  4011U,  4211U,  4410U,  4609U,
+     4808U,  5007U,  5205U,  5404U,  5602U,  5800U,  5998U,  6195U,
+     6393U,  6590U,  6787U,  6983U,  7180U,  7376U,  7571U,  7767U,
+     7962U,  8157U,  8351U,  8546U,  8740U,  8933U,  9127U,  9319U,
+     9512U,  9704U,  9896U, 10088U, 10279U, 10469U, 10660U, 10850U,
+    11039U, 11228U, 11417U, 11605U, 11793U, 11980U, 12167U, 12354U,
+    12540U, 12725U, 12910U, 13095U, 13279U, 13463U, 13646U, 13828U,
+    14010U, 14192U, 14373U, 14553U, 14733U, 14912U, 15091U, 15269U,
+    15447U, 15624U, 15800U, 15976U, 16151U, 16326U, 16500U, 16673U,
+    16846U, 17018U, 17190U, 17361U, 17531U, 17700U, 17869U, 18037U,
+    18205U, 18372U, 18538U, 18703U, 18868U, 19032U, 19195U, 19358U,
+    19520U, 19681U, 19841U, 20001U, 20160U, 20318U, 20475U, 20632U,
+    20788U, 20943U, 21097U, 21251U, 21403U, 21555U, 21706U, 21856U,
+    22006U, 22154U, 22302U, 22449U, 22595U, 22740U, 22884U, 23028U,
+    23170U, 23312U, 23453U, 23593U, 23732U, 23870U, 24008U, 24144U,
+    24279U, 24414U, 24548U, 24680U, 24812U, 24943U, 25073U, 25202U,
+    25330U, 25457U, 25583U, 25708U, 25833U, 25956U, 26078U, 26199U,
+    26320U, 26439U, 26557U, 26674U, 26791U, 26906U, 27020U, 27133U,
+    27246U, 27357U, 27467U, 27576U, 27684U, 27791U, 27897U, 28002U,
+    28106U, 28209U, 28311U, 28411U, 28511U, 28610U, 28707U, 28803U,
+    28899U, 28993U, 29086U, 29178U, 29269U, 29359U, 29448U, 29535U,
+    29622U, 29707U, 29792U, 29875U, 29957U, 30038U, 30118U, 30196U,
+    30274U, 30350U, 30425U, 30499U, 30572U, 30644U, 30715U, 30784U,
+    30853U, 30920U, 30986U, 31050U, 31114U, 31177U, 31238U, 31298U,
+    31357U, 31415U, 31471U, 31527U, 31581U, 31634U, 31686U, 31737U,
+    31786U, 31834U, 31881U, 31927U, 31972U, 32015U, 32058U, 32099U,
+    32138U, 32177U, 32214U, 32251U, 32286U, 32319U, 32352U, 32383U,
+    32413U, 32442U, 32470U, 32496U, 32522U, 32546U, 32568U, 32590U,
+    32610U, 32629U, 32647U, 32664U, 32679U, 32693U, 32706U, 32718U,
+    32729U, 32738U, 32746U, 32753U, 32758U, 32762U, 32766U, 32767U,
+    32767U
+};
+
+/* Packed [sin:cos], built by FFT_SRV_Init(); read by every butterfly */
+static uint32_t s_twiddle[FFT_TWIDDLE_COUNT] MEM_HOT;
+
+/* 2 / (coherent gain * 2^(15 - FFT_SRV_SAMPLE_BITS)) in Q15: bin magnitude -> counts */
+static const uint16_t s_amplitude_gain[FFT_SRV_WINDOW_COUNT] = {
+    8192U,      /* Rect:    gain 1.00 */
+    16384U,     /* Hann:    gain 0.50 */
+    15170U,     /* Hamming: gain 0.54 */
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief sin(2 pi k / FFT_SRV_MAX_SIZE) in Q15 from the quarter wave
+ */
+static int32_t FFT_Sine(uint32_t k)
+{
+    k &= (FFT_SRV_MAX_SIZE - 1U);
+
+    if (k <= (FFT_SRV_MAX_SIZE / 4U)) {
+        return (int32_t)s_quarter_sine[k];
+    }
+    if (k <= (FFT_SRV_MAX_SIZE / 2U)) {
+        return (int32_t)s_quarter_sine[(FFT_SRV_MAX_SIZE / 2U) - k];
+    }
+    if (k <= ((FFT_SRV_MAX_SIZE * 3U) / 4U)) {
+        return -(int32_t)s_quarter_sine[k - (FFT_SRV_MAX_SIZE / 2U)];
+    }
+    return -(int32_t)s_quarter_sine[FFT_SRV_MAX_SIZE - k];
+}
+
+/**
+ * @brief log2 of a supported transform size, 0 if not supported
+ */
+static uint32_t FFT_Log2(uint16_t size)
+{
+    uint32_t bits = 0U;
+
+    if (size < FFT_SRV_MIN_SIZE || size > FFT_SRV_MAX_SIZE || (size & (size - 1U)) != 0U) {
+        return 0U;
+    }
+
+    while ((1UL << bits) < size) {
+        bits++;
+    }
+    return bits;
+}
+
+/**
+ * @brief x * w, Q15 complex
+ */
+static inline uint32_t FFT_Mul(uint32_t x, uint32_t w)
+{
+    /* (xr + j xi)(c - j s): re = xr c + xi s, im = xi c - xr s */
+    return FFT_SRV_PACK(FFT_SMUAD(x, w) >> 15, FFT_SMUSDX(w, x) >> 15);
+}
+
+/**
+ * @brief |x|^2, up to 2^31
+ */
+static inline uint32_t FFT_Power(uint32_t x)
+{
+    return (uint32_t)FFT_SMUAD(x, x);
+}
+
+static uint32_t FFT_Sqrt(uint32_t value)
+{
+    uint32_t root = 0U;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+
+    while (bit != 0U) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Radix-4 pass over all sub-transforms of length len
+ */
+static void FFT_Radix4Pass(uint32_t *data, uint32_t size, uint32_t len)
+{
+    uint32_t quarter = len / 4U;
+    uint32_t stride = FFT_SRV_MAX_SIZE / len;
+    uint32_t a, b, c, d, t0, t1, t2, u;
+
+    for (uint32_t n = 0; n < quarter; n++) {
+        uint32_t w1 = s_twiddle[n * stride];
+        uint32_t w2 = s_twiddle[2U * n * stride];
+        uint32_t w3 = s_twiddle[3U * n * stride];
+
+        for (uint32_t i = n; i < size; i += len) {
+            a = data[i];
+            b = data[i + quarter];
+            c = data[i + (2U * quarter)];
+            d = data[i + (3U * quarter)];
+
+            t0 = FFT_SHADD16(a, c);
+            t1 = FFT_SHADD16(b, d);
+            t2 = FFT_SHSUB16(a, c);
+            u = FFT_SHSUB16(b, d);
+
+            data[i] = FFT_SHADD16(t0, t1);
+            data[i + quarter] = FFT_Mul(FFT_SHSUB16(t0, t1), w2);
+            data[i + (2U * quarter)] = FFT_Mul(FFT_SHSAX(t2, u), w1);     /* t2 - j u */
+            data[i + (3U * quarter)] = FFT_Mul(FFT_SHASX(t2, u), w3);     /* t2 + j u */
+        }
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+fft_srv_status_t FFT_SRV_Init(void)
+{
+    if (s_initialized) {
+        return FFT_SRV_SUCCESS;
+    }
+
+    for (uint32_t k = 0; k < FFT_TWIDDLE_COUNT; k++) {
+        s_twiddle[k] = FFT_SRV_PACK(FFT_Sine(k + (FFT_SRV_MAX_SIZE / 4U)), FFT_Sine(k));
+    }
+
+    s_initialized = true;
+
+    return FFT_SRV_SUCCESS;
+}
+
+fft_srv_status_t FFT_SRV_LoadSamples(const uint16_t *raw, uint16_t size, fft_srv_window_t window,
+                                     uint32_t *data)
+{
+    uint32_t bits = FFT_Log2(size);
+    uint32_t stride;
+    uint32_t sum = 0U;
+    int32_t mean;
+    int32_t x;
+    int32_t cosine;
+    int32_t coef;
+
+    if (!s_initialized) {
+        return FFT_SRV_NOT_INITIALIZED;
+    }
+
+    if (raw == NULL || data == NULL || bits == 0U || window >= FFT_SRV_WINDOW_COUNT) {
+        return FFT_SRV_INVALID_PARAM;
+    }
+
+    for (uint32_t n = 0; n < size; n++) {
+        sum += raw[n];
+    }
+    mean = (int32_t)(sum >> bits);
+    stride = FFT_SRV_MAX_SIZE / size;
+
+    for (uint32_t n = 0; n < size; n++) {
+        x = ((int32_t)raw[n] - mean) * (int32_t)(1UL << (15U - FFT_SRV_SAMPLE_BITS));
+
+        if (window != FFT_SRV_WINDOW_RECT) {
+            /* Symmetric, so cos(2 pi n / size) is read from the first half */
+            cosine = FFT_SRV_RE(s_twiddle[((n <= (size / 2U)) ? n : (size - n)) * stride]);
+            coef = (window == FFT_SRV_WINDOW_HANN) ? (16384 - (cosine >> 1))               /* 0.5 - 0.5 cos */
+                                                   : (17695 - ((15073 * cosine) >> 15));   /* 0.54 - 0.46 cos */
+            x = (x * coef) >> 15;
+        }
+
+        data[n] = FFT_SRV_PACK(x, 0);
+    }
+
+    return FFT_SRV_SUCCESS;
+}
+
+fft_srv_status_t FFT_SRV_Transform(uint32_t *data, uint16_t size)
+{
+    uint32_t bits = FFT_Log2(size);
+    uint32_t len;
+    uint32_t j;
+    uint32_t tmp;
+
+    if (!s_initialized) {
+        return FFT_SRV_NOT_INITIALIZED;
+    }
+
+    if (data == NULL || bits == 0U) {
+        return FFT_SRV_INVALID_PARAM;
+    }
+
+    for (len = size; len >= 4U; len /= 4U) {
+        FFT_Radix4Pass(data, size, len);
+    }
+
+    /* Odd power of two: last level is radix-2 with twiddle 1 */
+    if (len == 2U) {
+        for (uint32_t i = 0; i < size; i += 2U) {
+            tmp = data[i];
+            data[i] = FFT_SHADD16(tmp, data[i + 1U]);
+            data[i + 1U] = FFT_SHSUB16(tmp, data[i + 1U]);
+        }
+    }
+
+    /* Bit-reversed -> natural order */
+    for (uint32_t i = 0; i < size; i++) {
+        j = FFT_RBIT(i) >> (32U - bits);
+        if (i < j) {
+            tmp = data[i];
+            data[i] = data[j];
+            data[j] = tmp;
+        }
+    }
+
+    return FFT_SRV_SUCCESS;
+}
+
+void FFT_SRV_Magnitude(uint32_t *data, uint16_t size)
+{
+    if (data == NULL) {
+        return;
+    }
+
+    for (uint32_t k = 0; k <= (size / 2U); k++) {
+        data[k] = FFT_Sqrt(FFT_Power(data[k]));
+    }
+}
+
+uint8_t FFT_SRV_FindPeaks(const uint32_t *data, uint16_t size, fft_srv_window_t window,
+                          uint16_t min_amplitude, fft_srv_peak_t *peaks, uint8_t max_peaks)
+{
+    uint32_t power[FFT_MAX_PEAKS];
+    uint16_t bins[FFT_MAX_PEAKS];
+    uint8_t count = 0U;
+    uint32_t gain;
+    uint32_t min_power;
+    uint32_t prev, cur, next;
+    uint32_t slot;
+
+    if (!s_initialized || data == NULL || peaks == NULL || max_peaks == 0U ||
+        FFT_Log2(size) == 0U || window >= FFT_SRV_WINDOW_COUNT) {
+        return 0U;
+    }
+
+    if (max_peaks > FFT_MAX_PEAKS) {
+        max_peaks = FFT_MAX_PEAKS;
+    }
+
+    /* Threshold as bin power, so the scan needs no square root */
+    gain = s_amplitude_gain[window];
+    min_power = (((uint32_t)min_amplitude << 15) + gain - 1U) / gain;
+    min_power *= min_power;
+
+    prev = FFT_Power(data[0]);
+    cur = FFT_Power(data[1]);
+
+    for (uint32_t k = 1; k < (size / 2U); k++) {
+        next = FFT_Power(data[k + 1U]);
+
+        if (cur > prev && cur >= next && cur >= min_power &&
+            (count < max_peaks || cur > power[count - 1U])) {
+            /* Insert, strongest first */
+            slot = (count < max_peaks) ? count++ : (count - 1U);
+            while (slot > 0U && power[slot - 1U] < cur) {
+                power[slot] = power[slot - 1U];
+                bins[slot] = bins[slot - 1U];
+                slot--;
+            }
+            power[slot] = cur;
+            bins[slot] = (uint16_t)k;
+        }
+
+        prev = cur;
+        cur = next;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t k = bins[i];
+        int32_t left = (int32_t)FFT_Sqrt(FFT_Power(data[k - 1U]));
+        int32_t centre = (int32_t)FFT_Sqrt(power[i]);
+        int32_t right = (int32_t)FFT_Sqrt(FFT_Power(data[k + 1U]));
+        int32_t denom = (2 * centre) - left - right;
+        int32_t delta = 0;
+        uint32_t amplitude;
+
+        /* Vertex of the parabola through the three bins, 1/256 bin */
+        if (denom > 0) {
+            delta = ((right - left) * 128) / denom;
+        }
+        centre += ((right - left) * delta) / 1024;
+
+        amplitude = ((uint32_t)centre * gain) >> 15;
+        peaks[i].bin_q8 = (uint32_t)((int32_t)(k << 8) + delta);
+        peaks[i].amplitude = (amplitude > 0xFFFFU) ? 0xFFFFU : (uint16_t)amplitude;
+    }
+
+    return count;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file    fft_srv.h
+ * @brief   FFT Service - Abstraction API
+ * @details
+ * Spectrum analysis of ADC sample blocks in Q15 fixed point, so that only
+ * the dominant frequencies have to leave the board.
+ *
+ * Features:
+ * - In-place complex FFT of 16 to 1024 points: radix-4 stages (two radix-2
+ *   stages per pass) and one radix-2 stage for odd powers of two
+ * - Cortex-M4 SIMD: one 32-bit word holds a complex sample, butterflies use
+ *   halving dual 16-bit add/subtract (SHADD16, SHASX, ...) and twiddle
+ *   products dual multiply-accumulate (SMUAD, SMUSDX). Other targets (host
+ *   tests) use equivalent C.
+ * - Sample loading with mean removal, 12-bit to Q15 scaling and a window
+ * - Peak extraction on the power spectrum: local maxima above a threshold,
+ *   strongest first, frequency refined by parabolic interpolation
+ *
+ * Scaling: every radix-2 level halves, so a transform returns X[k] / N and
+ * cannot overflow. Samples keep their magnitude below 1.0 (real input).
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef FFT_SRV_H
+#define FFT_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Transform sizes (powers of two) */
+#define FFT_SRV_MIN_SIZE            (16U)
+#define FFT_SRV_MAX_SIZE            (1024U)
+
+/** @brief ADC resolution expected by FFT_SRV_LoadSamples() */
+#define FFT_SRV_SAMPLE_BITS         (12U)
+
+/** @brief Complex sample: real part in the low halfword, imaginary in the high */
+#define FFT_SRV_PACK(re, im)        (((uint32_t)(uint16_t)(int16_t)(re)) | ((uint32_t)(uint16_t)(int16_t)(im) << 16))
+#define FFT_SRV_RE(x)               ((int16_t)(uint16_t)(x))
+#define FFT_SRV_IM(x)               ((int16_t)(uint16_t)((x) >> 16))
+
+/**
+ * @brief FFT service status codes
+ */
+typedef enum {
+    FFT_SRV_SUCCESS = 0,
+    FFT_SRV_ERROR,
+    FFT_SRV_NOT_INITIALIZED,
+    FFT_SRV_INVALID_PARAM
+} fft_srv_status_t;
+
+/**
+ * @brief Window applied by FFT_SRV_LoadSamples()
+ */
+typedef enum {
+    FFT_SRV_WINDOW_RECT = 0,        /**< None: best resolution, high leakage */
+    FFT_SRV_WINDOW_HANN,            /**< General purpose */
+    FFT_SRV_WINDOW_HAMMING,         /**< Lower first sidelobe than Hann */
+    FFT_SRV_WINDOW_COUNT
+} fft_srv_window_t;
+
+/**
+ * @brief Spectral peak
+ */
+typedef struct {
+    uint32_t bin_q8;                /**< Frequency in bins, 8 fractional bits */
+    uint16_t amplitude;             /**< Sine amplitude in ADC counts */
+} fft_srv_peak_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the service (builds the twiddle table)
+ * @return fft_srv_status_t Status of initialization
+ */
+fft_srv_status_t FFT_SRV_Init(void);
+
+/**
+ * @brief Load ADC samples into a transform buffer
+ * @details Removes the block mean, scales FFT_SRV_SAMPLE_BITS to Q15 and
+ *          applies the window. No division.
+ * @param raw Raw ADC values
+ * @param size Number of samples, power of two in FFT_SRV_MIN_SIZE..FFT_SRV_MAX_SIZE
+ * @param window Window
+ * @param data Output, size complex samples (imaginary parts 0)
+ * @return fft_srv_status_t Status of operation
+ */
+fft_srv_status_t FFT_SRV_LoadSamples(const uint16_t *raw, uint16_t size, fft_srv_window_t window,
+                                     uint32_t *data);
+
+/**
+ * @brief In-place forward FFT
+ * @param data Complex samples (FFT_SRV_PACK), replaced by X[k] / size in natural order
+ * @param size Power of two in FFT_SRV_MIN_SIZE..FFT_SRV_MAX_SIZE
+ * @return fft_srv_status_t Status of operation
+ */
+fft_srv_status_t FFT_SRV_Transform(uint32_t *data, uint16_t size);
+
+/**
+ * @brief Replace bins 0..size/2 of a transform by their magnitude
+ * @details For plotting the whole spectrum; the peak search does not need it.
+ * @param data Transform output, data[k] becomes |X[k]| (Q15, unsigned)
+ * @param size Transform size
+ */
+void FFT_SRV_Magnitude(uint32_t *data, uint16_t size);
+
+/**
+ * @brief Find the strongest peaks of a transform of real samples
+ * @details Bins 1..size/2-1 that are local maxima of the power spectrum.
+ *          The amplitude is corrected for the window gain, so a sine of
+ *          A counts on a bin centre reads A.
+ * @param data Transform output (not the magnitude)
+ * @param size Transform size
+ * @param window Window used when loading the samples
+ * @param min_amplitude Smaller peaks are ignored, ADC counts
+ * @param peaks Output, strongest first
+ * @param max_peaks Capacity of peaks
+ * @return uint8_t Number of peaks found
+ */
+uint8_t FFT_SRV_FindPeaks(const uint32_t *data, uint16_t size, fft_srv_window_t window,
+                          uint16_t min_amplitude, fft_srv_peak_t *peaks, uint8_t max_peaks);
+
+#endif /* FFT_SRV_H */
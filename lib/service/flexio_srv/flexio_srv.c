@@ -0,0 +1,621 @@
+/**
+ * @file    flexio_srv.c
+ * @brief   FlexIO Service Implementation
+ * @details UART channels and SPI master on FlexIO with DMA transport
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "flexio_srv.h"
+#include "../res_srv/res_srv.h"
+#include "../../driver/flexio/flexio.h"
+#include "../../driver/dma/dma.h"
+#include "../../driver/nvic/nvic.h"
+#include "../../driver/ultis/mem_ultis.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define FLEXIO_SRV_IRQ_PRIORITY     (4U)
+
+/* No resource held */
+#define FLEXIO_SRV_NONE             (0xFFU)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Resources of one channel
+ * @details UART: shifter/timer 0 transmit, 1 receive.
+ *          SPI: shifter 0 transmit, shifter 1 receive, timer 0 SCK.
+ */
+typedef struct {
+    uint8_t shifter[2];
+    uint8_t timer[2];
+    uint8_t tx_dma;
+    uint8_t rx_dma;
+} flexio_srv_res_t;
+
+typedef struct {
+    bool open;
+    flexio_srv_res_t res;
+    volatile bool tx_busy;
+    flexio_srv_done_t done;
+    void *user;
+    uint8_t rx_ring[FLEXIO_SRV_RX_RING_SIZE];
+    uint8_t rx_read;
+    volatile uint32_t errors;
+} flexio_srv_uart_t;
+
+typedef struct {
+    bool open;
+    flexio_srv_res_t res;
+    volatile bool busy;
+    flexio_srv_done_t done;
+    void *user;
+} flexio_srv_spi_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static uint32_t s_clock_hz = 0;
+
+static flexio_srv_uart_t s_uart[FLEXIO_SRV_UART_COUNT] MEM_DMA;     /* Receive rings */
+static flexio_srv_spi_t s_spi;
+
+/* DMA source/sink when the caller passes no buffer */
+static const uint8_t s_dummy_tx = 0xFFU;
+static uint8_t s_dummy_rx;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Half bit time register value for a baud rate
+ * @return Compare value (0-255), or -1 if out of range
+ */
+static int32_t FLEXIO_SRV_HalfPeriod(uint32_t baudrate)
+{
+    uint32_t half;
+
+    if (baudrate == 0U) {
+        return -1;
+    }
+
+    half = (s_clock_hz + baudrate) / (2U * baudrate);     /* Rounded */
+    if (half == 0U || half > 256U) {
+        return -1;
+    }
+
+    return (int32_t)half - 1;
+}
+
+static void FLEXIO_SRV_ReleaseResources(flexio_srv_res_t *res)
+{
+    for (uint8_t i = 0; i < 2U; i++) {
+        if (res->shifter[i] != FLEXIO_SRV_NONE) {
+            FLEXIO_DisableShifter(FLEXIO, res->shifter[i]);
+            RES_SRV_Release(RES_SRV_FLEXIO_SHIFTER, res->shifter[i], RES_SRV_OWNER_SERVICE);
+            res->shifter[i] = FLEXIO_SRV_NONE;
+        }
+        if (res->timer[i] != FLEXIO_SRV_NONE) {
+            FLEXIO_DisableTimer(FLEXIO, res->timer[i]);
+            RES_SRV_Release(RES_SRV_FLEXIO_TIMER, res->timer[i], RES_SRV_OWNER_SERVICE);
+            res->timer[i] = FLEXIO_SRV_NONE;
+        }
+    }
+
+    if (res->tx_dma != FLEXIO_SRV_NONE) {
+        DMA_StopChannel(res->tx_dma);
+        NVIC_DisableInterrupt((IRQn_Type)(DMA_0_IRQn + res->tx_dma));
+        DMA_InstallCallback(res->tx_dma, NULL, NULL);
+        DMA_SetRequestSource(res->tx_dma, DMA_REQ_DISABLED, false);
+        RES_SRV_Release(RES_SRV_DMA_CHANNEL, res->tx_dma, RES_SRV_OWNER_SERVICE);
+        res->tx_dma = FLEXIO_SRV_NONE;
+    }
+    if (res->rx_dma != FLEXIO_SRV_NONE) {
+        DMA_StopChannel(res->rx_dma);
+        NVIC_DisableInterrupt((IRQn_Type)(DMA_0_IRQn + res->rx_dma));
+        DMA_InstallCallback(res->rx_dma, NULL, NULL);
+        DMA_SetRequestSource(res->rx_dma, DMA_REQ_DISABLED, false);
+        RES_SRV_Release(RES_SRV_DMA_CHANNEL, res->rx_dma, RES_SRV_OWNER_SERVICE);
+        res->rx_dma = FLEXIO_SRV_NONE;
+    }
+}
+
+/**
+ * @brief Allocate shifters, timers and both DMA channels of a channel
+ * @details Everything is released again if one allocation fails.
+ */
+static flexio_srv_status_t FLEXIO_SRV_AllocResources(flexio_srv_res_t *res, uint8_t timers)
+{
+    bool ok = true;
+
+    res->shifter[0] = res->shifter[1] = FLEXIO_SRV_NONE;
+    res->timer[0] = res->timer[1] = FLEXIO_SRV_NONE;
+    res->tx_dma = res->rx_dma = FLEXIO_SRV_NONE;
+
+    for (uint8_t i = 0; i < 2U && ok; i++) {
+        ok = RES_SRV_Alloc(RES_SRV_FLEXIO_SHIFTER, RES_SRV_OWNER_SERVICE, &res->shifter[i]) == RES_SRV_SUCCESS;
+        if (!ok) {
+            res->shifter[i] = FLEXIO_SRV_NONE;
+        }
+    }
+    for (uint8_t i = 0; i < timers && ok; i++) {
+        ok = RES_SRV_Alloc(RES_SRV_FLEXIO_TIMER, RES_SRV_OWNER_SERVICE, &res->timer[i]) == RES_SRV_SUCCESS;
+        if (!ok) {
+            res->timer[i] = FLEXIO_SRV_NONE;
+        }
+    }
+    if (ok && RES_SRV_Alloc(RES_SRV_DMA_CHANNEL, RES_SRV_OWNER_SERVICE, &res->tx_dma) != RES_SRV_SUCCESS) {
+        res->tx_dma = FLEXIO_SRV_NONE;
+        ok = false;
+    }
+    if (ok && RES_SRV_Alloc(RES_SRV_DMA_CHANNEL, RES_SRV_OWNER_SERVICE, &res->rx_dma) != RES_SRV_SUCCESS) {
+        res->rx_dma = FLEXIO_SRV_NONE;
+        ok = false;
+    }
+
+    if (!ok) {
+        FLEXIO_SRV_ReleaseResources(res);
+        return FLEXIO_SRV_NO_RESOURCE;
+    }
+
+    return FLEXIO_SRV_SUCCESS;
+}
+
+static dma_request_source_t FLEXIO_SRV_Request(uint8_t shifter)
+{
+    return (dma_request_source_t)((uint32_t)DMA_REQ_FLEXIO_SHIFTER0 + shifter);
+}
+
+/**
+ * @brief Shifter errors: count UART receive errors
+ */
+static void FLEXIO_SRV_Handler(FLEXIO_Type *base, uint32_t flags, void *userData)
+{
+    (void)base;
+    (void)userData;
+
+    for (uint8_t ch = 0; ch < FLEXIO_SRV_UART_COUNT; ch++) {
+        if (s_uart[ch].open && (flags & FLEXIO_EVENT_SHIFTER_ERROR(s_uart[ch].res.shifter[1])) != 0U) {
+            s_uart[ch].errors++;
+        }
+    }
+}
+
+static void FLEXIO_SRV_UartTxDone(uint8_t channel, dma_event_t event, void *param)
+{
+    flexio_srv_uart_t *uart = &s_uart[(uint32_t)param];
+
+    if (event == DMA_EVENT_HALF_COMPLETE) {
+        return;
+    }
+
+    DMA_StopChannel(channel);
+    uart->tx_busy = false;
+
+    if (uart->done != NULL) {
+        uart->done((event == DMA_EVENT_COMPLETE) ? FLEXIO_SRV_SUCCESS : FLEXIO_SRV_ERROR, uart->user);
+    }
+}
+
+static void FLEXIO_SRV_SpiDone(uint8_t channel, dma_event_t event, void *param)
+{
+    (void)param;
+
+    if (event == DMA_EVENT_HALF_COMPLETE) {
+        return;
+    }
+
+    DMA_StopChannel(channel);
+    DMA_StopChannel(s_spi.res.tx_dma);
+    s_spi.busy = false;
+
+    if (s_spi.done != NULL) {
+        s_spi.done((event == DMA_EVENT_COMPLETE) ? FLEXIO_SRV_SUCCESS : FLEXIO_SRV_ERROR, s_spi.user);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+flexio_srv_status_t FLEXIO_SRV_Init(clock_srv_pcs_t pcs)
+{
+    if (s_initialized) {
+        return FLEXIO_SRV_SUCCESS;
+    }
+
+    if (pcs == CLOCK_SRV_PCS_NONE) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    if (CLOCK_SRV_EnablePeripheral(CLOCK_SRV_FLEXIO, pcs) != CLOCK_SRV_SUCCESS ||
+        CLOCK_SRV_EnablePeripheral(CLOCK_SRV_DMAMUX, CLOCK_SRV_PCS_NONE) != CLOCK_SRV_SUCCESS) {
+        return FLEXIO_SRV_ERROR;
+    }
+
+    s_clock_hz = CLOCK_SRV_GetPeripheralClock(CLOCK_SRV_FLEXIO);
+    if (s_clock_hz == 0U) {
+        return FLEXIO_SRV_ERROR;
+    }
+
+    DMA_Init();
+    FLEXIO_Init(FLEXIO);
+    FLEXIO_RegisterCallback(FLEXIO, FLEXIO_SRV_Handler, NULL);
+
+    NVIC_SetPriority(FLEXIO_IRQn, FLEXIO_SRV_IRQ_PRIORITY);
+    NVIC_EnableInterrupt(FLEXIO_IRQn);
+
+    for (uint8_t ch = 0; ch < FLEXIO_SRV_UART_COUNT; ch++) {
+        s_uart[ch].open = false;
+    }
+    s_spi.open = false;
+
+    s_initialized = true;
+    return FLEXIO_SRV_SUCCESS;
+}
+
+void FLEXIO_SRV_Deinit(void)
+{
+    if (!s_initialized) {
+        return;
+    }
+
+    for (uint8_t ch = 0; ch < FLEXIO_SRV_UART_COUNT; ch++) {
+        FLEXIO_SRV_UartClose(ch);
+    }
+    FLEXIO_SRV_SpiClose();
+
+    NVIC_DisableInterrupt(FLEXIO_IRQn);
+    FLEXIO_RegisterCallback(FLEXIO, NULL, NULL);
+    FLEXIO_Deinit(FLEXIO);
+    CLOCK_SRV_DisablePeripheral(CLOCK_SRV_FLEXIO);
+
+    s_initialized = false;
+}
+
+bool FLEXIO_SRV_IsInitialized(void)
+{
+    return s_initialized;
+}
+
+flexio_srv_status_t FLEXIO_SRV_UartOpen(uint8_t channel, const flexio_srv_uart_config_t *config)
+{
+    flexio_srv_uart_t *uart;
+    flexio_uart_config_t drv_cfg;
+    dma_transfer_config_t xfer;
+    flexio_srv_status_t status;
+    int32_t half;
+
+    if (channel >= FLEXIO_SRV_UART_COUNT || config == NULL ||
+        config->tx_pin >= FLEXIO_PIN_COUNT || config->rx_pin >= FLEXIO_PIN_COUNT ||
+        config->tx_pin == config->rx_pin) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    if (!s_initialized) {
+        return FLEXIO_SRV_NOT_INITIALIZED;
+    }
+
+    uart = &s_uart[channel];
+    if (uart->open) {
+        return FLEXIO_SRV_BUSY;
+    }
+
+    half = FLEXIO_SRV_HalfPeriod(config->baudrate);
+    if (half < 0) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    status = FLEXIO_SRV_AllocResources(&uart->res, 2U);
+    if (status != FLEXIO_SRV_SUCCESS) {
+        return status;
+    }
+
+    drv_cfg.half_period = (uint8_t)half;
+
+    drv_cfg.shifter = uart->res.shifter[0];
+    drv_cfg.timer = uart->res.timer[0];
+    drv_cfg.pin = config->tx_pin;
+    (void)FLEXIO_ConfigUartTx(FLEXIO, &drv_cfg);
+
+    drv_cfg.shifter = uart->res.shifter[1];
+    drv_cfg.timer = uart->res.timer[1];
+    drv_cfg.pin = config->rx_pin;
+    (void)FLEXIO_ConfigUartRx(FLEXIO, &drv_cfg);
+
+    uart->tx_busy = false;
+    uart->done = NULL;
+    uart->user = NULL;
+    uart->rx_read = 0U;
+    uart->errors = 0U;
+
+    /* Receive: shifter -> ring forever, no interrupt */
+    xfer.src_addr = FLEXIO_GetRxAddress(FLEXIO, uart->res.shifter[1], false);
+    xfer.dst_addr = (uint32_t)uart->rx_ring;
+    xfer.src_offset = 0;
+    xfer.dst_offset = 1;
+    xfer.src_size = DMA_TRANSFER_SIZE_1B;
+    xfer.dst_size = DMA_TRANSFER_SIZE_1B;
+    xfer.minor_bytes = 1U;
+    xfer.major_count = FLEXIO_SRV_RX_RING_SIZE;
+    xfer.src_last_adjust = 0;
+    xfer.dst_last_adjust = -(int32_t)FLEXIO_SRV_RX_RING_SIZE;
+    xfer.int_major = false;
+    xfer.int_half = false;
+    xfer.disable_request = false;
+    DMA_ConfigTransfer(uart->res.rx_dma, &xfer);
+    DMA_SetRequestSource(uart->res.rx_dma, FLEXIO_SRV_Request(uart->res.shifter[1]), false);
+    DMA_StartChannel(uart->res.rx_dma);
+
+    /* Transmit: armed per write */
+    DMA_SetRequestSource(uart->res.tx_dma, FLEXIO_SRV_Request(uart->res.shifter[0]), false);
+    DMA_InstallCallback(uart->res.tx_dma, FLEXIO_SRV_UartTxDone, (void *)(uint32_t)channel);
+    NVIC_SetPriority((IRQn_Type)(DMA_0_IRQn + uart->res.tx_dma), FLEXIO_SRV_IRQ_PRIORITY);
+    NVIC_EnableInterrupt((IRQn_Type)(DMA_0_IRQn + uart->res.tx_dma));
+
+    FLEXIO_EnableShifterDma(FLEXIO, uart->res.shifter[1], true);
+    FLEXIO_EnableShifterDma(FLEXIO, uart->res.shifter[0], true);
+    FLEXIO_EnableErrorInterrupt(FLEXIO, uart->res.shifter[1], true);
+
+    uart->open = true;
+    return FLEXIO_SRV_SUCCESS;
+}
+
+void FLEXIO_SRV_UartClose(uint8_t channel)
+{
+    if (channel >= FLEXIO_SRV_UART_COUNT || !s_uart[channel].open) {
+        return;
+    }
+
+    s_uart[channel].open = false;
+    FLEXIO_SRV_ReleaseResources(&s_uart[channel].res);
+    s_uart[channel].tx_busy = false;
+}
+
+flexio_srv_status_t FLEXIO_SRV_UartPutByte(uint8_t channel, uint8_t data)
+{
+    flexio_srv_uart_t *uart;
+
+    if (channel >= FLEXIO_SRV_UART_COUNT) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    uart = &s_uart[channel];
+    if (!uart->open) {
+        return FLEXIO_SRV_NOT_INITIALIZED;
+    }
+
+    while (uart->tx_busy) {
+        /* DMA write in progress */
+    }
+    while (!FLEXIO_IsShifterReady(FLEXIO, uart->res.shifter[0])) {
+        /* Previous byte still in the buffer */
+    }
+
+    FLEXIO_WriteByte(FLEXIO, uart->res.shifter[0], data);
+    return FLEXIO_SRV_SUCCESS;
+}
+
+flexio_srv_status_t FLEXIO_SRV_UartWrite(uint8_t channel, const uint8_t *data, uint16_t length,
+                                         flexio_srv_done_t done, void *user)
+{
+    flexio_srv_uart_t *uart;
+    dma_transfer_config_t xfer;
+
+    if (channel >= FLEXIO_SRV_UART_COUNT || data == NULL || length == 0U ||
+        length > DMA_MAX_MAJOR_COUNT) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    uart = &s_uart[channel];
+    if (!uart->open) {
+        return FLEXIO_SRV_NOT_INITIALIZED;
+    }
+
+    if (uart->tx_busy) {
+        return FLEXIO_SRV_BUSY;
+    }
+
+    xfer.src_addr = (uint32_t)data;
+    xfer.dst_addr = FLEXIO_GetTxAddress(FLEXIO, uart->res.shifter[0], false);
+    xfer.src_offset = 1;
+    xfer.dst_offset = 0;
+    xfer.src_size = DMA_TRANSFER_SIZE_1B;
+    xfer.dst_size = DMA_TRANSFER_SIZE_1B;
+    xfer.minor_bytes = 1U;
+    xfer.major_count = length;
+    xfer.src_last_adjust = 0;
+    xfer.dst_last_adjust = 0;
+    xfer.int_major = true;
+    xfer.int_half = false;
+    xfer.disable_request = true;
+
+    if (DMA_ConfigTransfer(uart->res.tx_dma, &xfer) != DMA_STATUS_SUCCESS) {
+        return FLEXIO_SRV_ERROR;
+    }
+
+    uart->done = done;
+    uart->user = user;
+    uart->tx_busy = true;
+    DMA_StartChannel(uart->res.tx_dma);
+
+    return FLEXIO_SRV_SUCCESS;
+}
+
+bool FLEXIO_SRV_UartIsTxBusy(uint8_t channel)
+{
+    return (channel < FLEXIO_SRV_UART_COUNT) && s_uart[channel].tx_busy;
+}
+
+flexio_srv_status_t FLEXIO_SRV_UartGetByte(uint8_t channel, uint8_t *data)
+{
+    flexio_srv_uart_t *uart;
+    uint8_t write;
+
+    if (channel >= FLEXIO_SRV_UART_COUNT || data == NULL) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    uart = &s_uart[channel];
+    if (!uart->open) {
+        return FLEXIO_SRV_NOT_INITIALIZED;
+    }
+
+    /* DMA write position = bytes done in the current pass */
+    write = (uint8_t)((FLEXIO_SRV_RX_RING_SIZE - DMA_GetRemainingMajor(uart->res.rx_dma)) %
+                      FLEXIO_SRV_RX_RING_SIZE);
+    if (write == uart->rx_read) {
+        return FLEXIO_SRV_NO_DATA;
+    }
+
+    *data = uart->rx_ring[uart->rx_read];
+    uart->rx_read = (uint8_t)((uart->rx_read + 1U) % FLEXIO_SRV_RX_RING_SIZE);
+
+    return FLEXIO_SRV_SUCCESS;
+}
+
+uint32_t FLEXIO_SRV_UartGetErrorCount(uint8_t channel)
+{
+    return (channel < FLEXIO_SRV_UART_COUNT) ? s_uart[channel].errors : 0U;
+}
+
+flexio_srv_status_t FLEXIO_SRV_SpiOpen(const flexio_srv_spi_config_t *config)
+{
+    flexio_spi_config_t drv_cfg;
+    flexio_srv_status_t status;
+    int32_t half;
+
+    if (config == NULL || config->mosi_pin >= FLEXIO_PIN_COUNT ||
+        config->miso_pin >= FLEXIO_PIN_COUNT || config->sck_pin >= FLEXIO_PIN_COUNT) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    if (!s_initialized) {
+        return FLEXIO_SRV_NOT_INITIALIZED;
+    }
+
+    if (s_spi.open) {
+        return FLEXIO_SRV_BUSY;
+    }
+
+    half = FLEXIO_SRV_HalfPeriod(config->baudrate);
+    if (half < 0) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    status = FLEXIO_SRV_AllocResources(&s_spi.res, 1U);
+    if (status != FLEXIO_SRV_SUCCESS) {
+        return status;
+    }
+
+    drv_cfg.tx_shifter = s_spi.res.shifter[0];
+    drv_cfg.rx_shifter = s_spi.res.shifter[1];
+    drv_cfg.timer = s_spi.res.timer[0];
+    drv_cfg.mosi_pin = config->mosi_pin;
+    drv_cfg.miso_pin = config->miso_pin;
+    drv_cfg.sck_pin = config->sck_pin;
+    drv_cfg.half_period = (uint8_t)half;
+    (void)FLEXIO_ConfigSpiMaster(FLEXIO, &drv_cfg);
+
+    DMA_SetRequestSource(s_spi.res.tx_dma, FLEXIO_SRV_Request(s_spi.res.shifter[0]), false);
+    DMA_SetRequestSource(s_spi.res.rx_dma, FLEXIO_SRV_Request(s_spi.res.shifter[1]), false);
+    DMA_InstallCallback(s_spi.res.rx_dma, FLEXIO_SRV_SpiDone, NULL);
+    NVIC_SetPriority((IRQn_Type)(DMA_0_IRQn + s_spi.res.rx_dma), FLEXIO_SRV_IRQ_PRIORITY);
+    NVIC_EnableInterrupt((IRQn_Type)(DMA_0_IRQn + s_spi.res.rx_dma));
+
+    FLEXIO_EnableShifterDma(FLEXIO, s_spi.res.shifter[0], true);
+    FLEXIO_EnableShifterDma(FLEXIO, s_spi.res.shifter[1], true);
+
+    s_spi.busy = false;
+    s_spi.open = true;
+    return FLEXIO_SRV_SUCCESS;
+}
+
+void FLEXIO_SRV_SpiClose(void)
+{
+    if (!s_spi.open) {
+        return;
+    }
+
+    s_spi.open = false;
+    FLEXIO_SRV_ReleaseResources(&s_spi.res);
+    s_spi.busy = false;
+}
+
+flexio_srv_status_t FLEXIO_SRV_SpiTransfer(const uint8_t *tx, uint8_t *rx, uint16_t length,
+                                           flexio_srv_done_t done, void *user)
+{
+    dma_transfer_config_t xfer;
+
+    if (length == 0U || length > DMA_MAX_MAJOR_COUNT) {
+        return FLEXIO_SRV_INVALID_PARAM;
+    }
+
+    if (!s_spi.open) {
+        return FLEXIO_SRV_NOT_INITIALIZED;
+    }
+
+    if (s_spi.busy) {
+        return FLEXIO_SRV_BUSY;
+    }
+
+    /* Drop a stale byte so RX stays aligned with TX */
+    if (FLEXIO_IsShifterReady(FLEXIO, s_spi.res.shifter[1])) {
+        (void)FLEXIO_ReadByteMsb(FLEXIO, s_spi.res.shifter[1]);
+    }
+    (void)FLEXIO_ClearShifterError(FLEXIO, s_spi.res.shifter[1]);
+
+    xfer.src_size = DMA_TRANSFER_SIZE_1B;
+    xfer.dst_size = DMA_TRANSFER_SIZE_1B;
+    xfer.minor_bytes = 1U;
+    xfer.major_count = length;
+    xfer.src_last_adjust = 0;
+    xfer.dst_last_adjust = 0;
+    xfer.int_half = false;
+    xfer.disable_request = true;
+
+    /* Receive first so no byte is missed once TX starts the clock */
+    xfer.src_addr = FLEXIO_GetRxAddress(FLEXIO, s_spi.res.shifter[1], true);
+    xfer.dst_addr = (rx != NULL) ? (uint32_t)rx : (uint32_t)&s_dummy_rx;
+    xfer.src_offset = 0;
+    xfer.dst_offset = (rx != NULL) ? 1 : 0;
+    xfer.int_major = true;
+    if (DMA_ConfigTransfer(s_spi.res.rx_dma, &xfer) != DMA_STATUS_SUCCESS) {
+        return FLEXIO_SRV_ERROR;
+    }
+
+    xfer.src_addr = (tx != NULL) ? (uint32_t)tx : (uint32_t)&s_dummy_tx;
+    xfer.dst_addr = FLEXIO_GetTxAddress(FLEXIO, s_spi.res.shifter[0], true);
+    xfer.src_offset = (tx != NULL) ? 1 : 0;
+    xfer.dst_offset = 0;
+    xfer.int_major = false;
+    if (DMA_ConfigTransfer(s_spi.res.tx_dma, &xfer) != DMA_STATUS_SUCCESS) {
+        return FLEXIO_SRV_ERROR;
+    }
+
+    s_spi.done = done;
+    s_spi.user = user;
+    s_spi.busy = true;
+
+    DMA_StartChannel(s_spi.res.rx_dma);
+    DMA_StartChannel(s_spi.res.tx_dma);
+
+    return FLEXIO_SRV_SUCCESS;
+}
+
+bool FLEXIO_SRV_SpiIsBusy(void)
+{
+    return s_spi.busy;
+}
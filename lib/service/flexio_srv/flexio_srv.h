@@ -0,0 +1,211 @@
+/**
+ * @file    flexio_srv.h
+ * @brief   FlexIO Service - Abstraction API
+ * @details
+ * Extra serial channels built from FlexIO shifters and timers, for when
+ * the LPUART/LPSPI instances or their pins are taken.
+ *
+ * Features:
+ * - Up to FLEXIO_SRV_UART_COUNT UART channels (8N1), each using two
+ *   shifters, two timers and two DMA channels. Reception runs into a
+ *   DMA ring without CPU involvement; transmission is either a blocking
+ *   byte write or a DMA buffer write.
+ * - One SPI master (mode 0, MSB first) using two shifters, one timer and
+ *   two DMA channels; chip select is a GPIO driven by the caller.
+ * - Shifters, timers and DMA channels come from the resource registry
+ *   (res_srv), so channels can be opened in any combination that fits
+ *   the 4 shifters and 4 timers.
+ *
+ * Bit timing: the FlexIO clock divided by 2 * (1..256). With a 40 MHz
+ * functional clock that covers roughly 78 kbit/s - 20 Mbit/s; use a
+ * slower PCS source for lower baud rates.
+ *
+ * Pin numbers are FlexIO pins (D0-D7). Muxing the package pins to FXIO_Dn
+ * is left to the caller (port_srv), except for channels opened through
+ * uart_srv.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef FLEXIO_SRV_H
+#define FLEXIO_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "../clock_srv/clock_srv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief UART channels */
+#define FLEXIO_SRV_UART_COUNT       (2U)
+
+/** @brief Receive ring per UART channel (bytes) */
+#define FLEXIO_SRV_RX_RING_SIZE     (64U)
+
+/**
+ * @brief FlexIO service status codes
+ */
+typedef enum {
+    FLEXIO_SRV_SUCCESS = 0,
+    FLEXIO_SRV_ERROR,
+    FLEXIO_SRV_NOT_INITIALIZED,
+    FLEXIO_SRV_BUSY,                /**< Channel open or transfer running */
+    FLEXIO_SRV_INVALID_PARAM,       /**< Bad pin, channel or baud rate out of range */
+    FLEXIO_SRV_NO_RESOURCE,         /**< No free shifter, timer or DMA channel */
+    FLEXIO_SRV_NO_DATA              /**< Receive ring empty */
+} flexio_srv_status_t;
+
+/**
+ * @brief Transfer done callback (DMA interrupt context)
+ * @param status FLEXIO_SRV_SUCCESS or FLEXIO_SRV_ERROR (DMA error)
+ * @param user User pointer given with the transfer
+ */
+typedef void (*flexio_srv_done_t)(flexio_srv_status_t status, void *user);
+
+/**
+ * @brief UART channel configuration
+ */
+typedef struct {
+    uint8_t tx_pin;                 /**< FlexIO pin (0-7) */
+    uint8_t rx_pin;                 /**< FlexIO pin (0-7) */
+    uint32_t baudrate;              /**< bit/s */
+} flexio_srv_uart_config_t;
+
+/**
+ * @brief SPI master configuration
+ */
+typedef struct {
+    uint8_t mosi_pin;               /**< FlexIO pins (0-7) */
+    uint8_t miso_pin;
+    uint8_t sck_pin;
+    uint32_t baudrate;              /**< SCK frequency in Hz */
+} flexio_srv_spi_config_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize FlexIO
+ * @details Enables the functional clock from the given source, resets the
+ *          module and installs the interrupt handler. DMA_Init() is done
+ *          here as well.
+ * @param pcs Functional clock source
+ * @return flexio_srv_status_t Status of initialization
+ */
+flexio_srv_status_t FLEXIO_SRV_Init(clock_srv_pcs_t pcs);
+
+/**
+ * @brief Close every channel and disable FlexIO
+ */
+void FLEXIO_SRV_Deinit(void);
+
+/**
+ * @brief Check initialization
+ * @return true if FLEXIO_SRV_Init() succeeded
+ */
+bool FLEXIO_SRV_IsInitialized(void);
+
+/**
+ * @brief Open a UART channel
+ * @details Allocates its resources and starts reception into the ring.
+ * @param channel UART channel (0 - FLEXIO_SRV_UART_COUNT-1)
+ * @param config Channel configuration
+ * @return flexio_srv_status_t Status of operation
+ */
+flexio_srv_status_t FLEXIO_SRV_UartOpen(uint8_t channel, const flexio_srv_uart_config_t *config);
+
+/**
+ * @brief Close a UART channel and release its resources
+ * @param channel UART channel
+ */
+void FLEXIO_SRV_UartClose(uint8_t channel);
+
+/**
+ * @brief Send one byte (blocking)
+ * @details Waits for a running DMA write and for the shifter buffer.
+ * @param channel UART channel
+ * @param data Byte
+ * @return flexio_srv_status_t Status of operation
+ */
+flexio_srv_status_t FLEXIO_SRV_UartPutByte(uint8_t channel, uint8_t data);
+
+/**
+ * @brief Send a buffer by DMA (non-blocking)
+ * @details The buffer must stay valid until the callback. The callback
+ *          runs when the last byte has been loaded into the shifter, one
+ *          character time before it has left the pin.
+ * @param channel UART channel
+ * @param data Buffer
+ * @param length Bytes (1 - DMA_MAX_MAJOR_COUNT)
+ * @param done Optional completion callback
+ * @param user Passed to the callback
+ * @return flexio_srv_status_t FLEXIO_SRV_BUSY if a write is running
+ */
+flexio_srv_status_t FLEXIO_SRV_UartWrite(uint8_t channel, const uint8_t *data, uint16_t length,
+                                         flexio_srv_done_t done, void *user);
+
+/**
+ * @brief Check for a running DMA write
+ * @param channel UART channel
+ * @return true while a write is running
+ */
+bool FLEXIO_SRV_UartIsTxBusy(uint8_t channel);
+
+/**
+ * @brief Take one received byte (non-blocking)
+ * @details Bytes older than FLEXIO_SRV_RX_RING_SIZE are overwritten if
+ *          not taken in time.
+ * @param channel UART channel
+ * @param[out] data Byte
+ * @return flexio_srv_status_t FLEXIO_SRV_NO_DATA if the ring is empty
+ */
+flexio_srv_status_t FLEXIO_SRV_UartGetByte(uint8_t channel, uint8_t *data);
+
+/**
+ * @brief Get the receive error count (framing errors, shifter overruns)
+ * @param channel UART channel
+ * @return uint32_t Errors since the channel was opened
+ */
+uint32_t FLEXIO_SRV_UartGetErrorCount(uint8_t channel);
+
+/**
+ * @brief Open the SPI master
+ * @param config SPI configuration
+ * @return flexio_srv_status_t Status of operation
+ */
+flexio_srv_status_t FLEXIO_SRV_SpiOpen(const flexio_srv_spi_config_t *config);
+
+/**
+ * @brief Close the SPI master and release its resources
+ */
+void FLEXIO_SRV_SpiClose(void);
+
+/**
+ * @brief Full-duplex transfer by DMA (non-blocking)
+ * @details Buffers must stay valid until the callback, which runs once
+ *          the last byte has been received.
+ * @param tx Bytes to send, NULL sends 0xFF
+ * @param rx Received bytes, NULL discards them
+ * @param length Bytes (1 - DMA_MAX_MAJOR_COUNT)
+ * @param done Optional completion callback
+ * @param user Passed to the callback
+ * @return flexio_srv_status_t FLEXIO_SRV_BUSY if a transfer is running
+ */
+flexio_srv_status_t FLEXIO_SRV_SpiTransfer(const uint8_t *tx, uint8_t *rx, uint16_t length,
+                                           flexio_srv_done_t done, void *user);
+
+/**
+ * @brief Check for a running SPI transfer
+ * @return true while a transfer is running
+ */
+bool FLEXIO_SRV_SpiIsBusy(void);
+
+#endif /* FLEXIO_SRV_H */
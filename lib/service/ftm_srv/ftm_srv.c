@@ -0,0 +1,624 @@
+/**
+ * @file    ftm_srv.c
+ * @brief   FTM Capture Service Implementation
+ * @details Dual-edge capture with overflow extension or DMA rings, block
+ *          averaging
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftm_srv.h"
+#include "../clock_srv/clock_srv.h"
+#include "../res_srv/res_srv.h"
+#include "../../driver/ftm/ftm.h"
+#include "../../driver/dma/dma.h"
+#include "../../driver/nvic/nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Channel pair and overflow vectors must not preempt each other */
+#define FTM_SRV_IRQ_PRIORITY        (3U)
+
+#define FTM_SRV_COUNTER_RANGE       (65536UL)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Per-pair capture state
+ */
+typedef struct {
+    ftm_srv_capture_config_t cfg;
+    volatile bool active;
+
+    /* Block accumulation */
+    uint64_t sum_period;
+    uint64_t sum_high;
+    uint16_t count;
+
+    /* IRQ mode: extended timestamps */
+    uint32_t rise;                  /**< Current period start */
+    uint32_t high;                  /**< Active time of the current period */
+    bool have_rise;
+    bool have_high;
+    uint32_t idle_overflows;
+    uint32_t stall_overflows;
+
+    /* DMA mode */
+    uint8_t rise_channel;
+    uint8_t fall_channel;
+    bool primed;                    /**< Ring holds a previous period start */
+
+    /* Latest result, seqlock: odd while the interrupt writes */
+    volatile uint32_t seq;
+    ftm_srv_measurement_t result;
+} ftm_srv_pair_t;
+
+/**
+ * @brief Per-instance state
+ */
+typedef struct {
+    bool initialized;
+    uint32_t tick_hz;
+    volatile uint32_t overflows;
+    uint8_t irq_pairs;              /**< Pairs in IRQ mode (overflow interrupt users) */
+    ftm_srv_pair_t pair[FTM_SRV_PAIR_COUNT];
+} ftm_srv_instance_data_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static FTM_Type * const s_ftm_bases[FTM_SRV_INSTANCE_COUNT] = { FTM0, FTM1, FTM2, FTM3 };
+
+static const clock_srv_peripheral_t s_ftm_clocks[FTM_SRV_INSTANCE_COUNT] = {
+    CLOCK_SRV_FTM0, CLOCK_SRV_FTM1, CLOCK_SRV_FTM2, CLOCK_SRV_FTM3
+};
+
+/* Channel 0/1 vector; pairs follow it, overflow is 5 above it */
+static const IRQn_Type s_ftm_pair_irqs[FTM_SRV_INSTANCE_COUNT] = {
+    FTM0_Ch0_Ch1_IRQn, FTM1_Ch0_Ch1_IRQn, FTM2_Ch0_Ch1_IRQn, FTM3_Ch0_Ch1_IRQn
+};
+
+static const IRQn_Type s_ftm_ovf_irqs[FTM_SRV_INSTANCE_COUNT] = {
+    FTM0_Ovf_Reload_IRQn, FTM1_Ovf_Reload_IRQn, FTM2_Ovf_Reload_IRQn, FTM3_Ovf_Reload_IRQn
+};
+
+static ftm_srv_instance_data_t s_ftm[FTM_SRV_INSTANCE_COUNT];
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static void FTM_SRV_Handler(FTM_Type *base, uint32_t flags, void *userData);
+static void FTM_SRV_DmaCallback(uint8_t channel, dma_event_t event, void *param);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Turn a 16-bit capture into a 32-bit timestamp
+ * @details Extends the current counter with the overflow count (TOF may
+ *          still be pending), then steps back by the ticks elapsed since
+ *          the capture. Valid while interrupt latency stays below one
+ *          counter period.
+ */
+static uint32_t FTM_SRV_Extend(ftm_srv_instance_data_t *inst, FTM_Type *base, uint16_t capture)
+{
+    bool wrapped = FTM_IsOverflowPending(base);
+    uint16_t cnt = FTM_GetCounter(base);
+    uint32_t now;
+
+    if (!wrapped && FTM_IsOverflowPending(base)) {
+        /* Wrapped between the two reads */
+        wrapped = true;
+        cnt = FTM_GetCounter(base);
+    }
+
+    now = ((inst->overflows + (wrapped ? 1U : 0U)) << 16) | cnt;
+
+    return now - (uint16_t)(cnt - capture);
+}
+
+/**
+ * @brief Convert the accumulated block and hand it out
+ */
+static void FTM_SRV_Publish(ftm_srv_instance_t instance, uint8_t index)
+{
+    ftm_srv_instance_data_t *inst = &s_ftm[instance];
+    ftm_srv_pair_t *pair = &inst->pair[index];
+    ftm_srv_measurement_t m;
+    uint64_t value;
+
+    m.periods = pair->count;
+    m.period_ns = 0U;
+    m.frequency_mhz = 0U;
+    m.duty_permyriad = 0U;
+
+    if (pair->count != 0U && pair->sum_period != 0U) {
+        /* sum * 1e9 overflows beyond ~2^34 ticks: fall back to the average */
+        if (pair->sum_period <= (UINT64_MAX / 1000000000ULL)) {
+            value = (pair->sum_period * 1000000000ULL) / ((uint64_t)pair->count * inst->tick_hz);
+        } else {
+            value = ((pair->sum_period / pair->count) * 1000000000ULL) / inst->tick_hz;
+        }
+        m.period_ns = (value > UINT32_MAX) ? UINT32_MAX : (uint32_t)value;
+
+        value = ((uint64_t)pair->count * inst->tick_hz * 1000ULL) / pair->sum_period;
+        m.frequency_mhz = (value > UINT32_MAX) ? UINT32_MAX : (uint32_t)value;
+
+        m.duty_permyriad = (uint16_t)((pair->sum_high * 10000ULL) / pair->sum_period);
+    }
+
+    pair->seq++;
+    pair->result = m;
+    pair->seq++;
+
+    pair->sum_period = 0U;
+    pair->sum_high = 0U;
+    pair->count = 0U;
+
+    if (pair->cfg.callback != NULL) {
+        pair->cfg.callback(instance, index, &m);
+    }
+}
+
+static void FTM_SRV_Accumulate(ftm_srv_instance_t instance, uint8_t index,
+                               uint32_t period, uint32_t high)
+{
+    ftm_srv_pair_t *pair = &s_ftm[instance].pair[index];
+
+    pair->sum_period += period;
+    pair->sum_high += high;
+    pair->count++;
+
+    if (pair->count >= pair->cfg.block_periods) {
+        FTM_SRV_Publish(instance, index);
+    }
+}
+
+/**
+ * @brief Period-start edge captured (IRQ mode)
+ */
+static void FTM_SRV_OnStart(ftm_srv_instance_t instance, uint8_t index, uint32_t ts)
+{
+    ftm_srv_pair_t *pair = &s_ftm[instance].pair[index];
+
+    if (pair->have_rise && pair->have_high) {
+        FTM_SRV_Accumulate(instance, index, ts - pair->rise, pair->high);
+    }
+
+    pair->rise = ts;
+    pair->have_rise = true;
+    pair->have_high = false;
+    pair->idle_overflows = 0U;
+}
+
+/**
+ * @brief Opposite edge captured (IRQ mode)
+ */
+static void FTM_SRV_OnEnd(ftm_srv_instance_t instance, uint8_t index, uint32_t ts)
+{
+    ftm_srv_pair_t *pair = &s_ftm[instance].pair[index];
+
+    if (pair->have_rise) {
+        pair->high = ts - pair->rise;
+        pair->have_high = true;
+    }
+    pair->idle_overflows = 0U;
+}
+
+/**
+ * @brief FTM event callback (channel pair and overflow vectors)
+ */
+static void FTM_SRV_Handler(FTM_Type *base, uint32_t flags, void *userData)
+{
+    ftm_srv_instance_t instance = (ftm_srv_instance_t)(uint32_t)userData;
+    ftm_srv_instance_data_t *inst = &s_ftm[instance];
+    ftm_srv_pair_t *pair;
+    uint32_t start_ts;
+    uint32_t end_ts;
+    bool start;
+    bool end;
+    uint8_t ch;
+
+    /* Overflow first: timestamps below use the updated count */
+    if ((flags & FTM_EVENT_OVERFLOW) != 0U) {
+        inst->overflows++;
+
+        for (uint8_t i = 0; i < FTM_SRV_PAIR_COUNT; i++) {
+            pair = &inst->pair[i];
+            if (!pair->active || pair->cfg.mode != FTM_SRV_CAPTURE_IRQ || pair->stall_overflows == 0U) {
+                continue;
+            }
+
+            if (++pair->idle_overflows == pair->stall_overflows) {
+                /* Report once, then restart from the next edge */
+                pair->sum_period = 0U;
+                pair->sum_high = 0U;
+                pair->count = 0U;
+                pair->have_rise = false;
+                FTM_SRV_Publish(instance, i);
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < FTM_SRV_PAIR_COUNT; i++) {
+        pair = &inst->pair[i];
+        ch = (uint8_t)(2U * i);
+        start = (flags & FTM_EVENT_CHANNEL(ch)) != 0U;
+        end = (flags & FTM_EVENT_CHANNEL(ch + 1U)) != 0U;
+
+        if (!pair->active || (!start && !end)) {
+            continue;
+        }
+
+        start_ts = start ? FTM_SRV_Extend(inst, base, FTM_GetChannelValue(base, ch)) : 0U;
+        end_ts = end ? FTM_SRV_Extend(inst, base, FTM_GetChannelValue(base, ch + 1U)) : 0U;
+
+        /* Both pending: the end edge may belong to the previous start */
+        if (start && end && (int32_t)(end_ts - start_ts) < 0) {
+            FTM_SRV_OnEnd(instance, i, end_ts);
+            FTM_SRV_OnStart(instance, i, start_ts);
+        } else {
+            if (start) {
+                FTM_SRV_OnStart(instance, i, start_ts);
+            }
+            if (end) {
+                FTM_SRV_OnEnd(instance, i, end_ts);
+            }
+        }
+    }
+}
+
+/**
+ * @brief End-edge DMA half/complete: one block of captures in the rings
+ */
+static void FTM_SRV_DmaCallback(uint8_t channel, dma_event_t event, void *param)
+{
+    ftm_srv_instance_t instance = (ftm_srv_instance_t)((uint32_t)param / FTM_SRV_PAIR_COUNT);
+    uint8_t index = (uint8_t)((uint32_t)param % FTM_SRV_PAIR_COUNT);
+    ftm_srv_pair_t *pair = &s_ftm[instance].pair[index];
+    uint16_t block = pair->cfg.block_periods;
+    uint16_t ring = (uint16_t)(2U * block);
+    const uint16_t *start = pair->cfg.dma_buffer;
+    const uint16_t *end = &pair->cfg.dma_buffer[ring];
+    uint16_t first;
+    uint16_t prev;
+
+    (void)channel;
+
+    if (event == DMA_EVENT_ERROR) {
+        return;
+    }
+
+    first = (event == DMA_EVENT_HALF_COMPLETE) ? 0U : block;
+
+    for (uint16_t k = first; k < first + block; k++) {
+        prev = (k == 0U) ? (uint16_t)(ring - 1U) : (uint16_t)(k - 1U);
+
+        if (!pair->primed) {
+            /* Very first capture has no previous period start */
+            pair->primed = true;
+            continue;
+        }
+
+        /* 16-bit differences: periods must fit the counter */
+        FTM_SRV_Accumulate(instance, index, (uint16_t)(start[k] - start[prev]),
+                           (uint16_t)(end[k] - start[k]));
+    }
+
+    /* The skipped first capture leaves a short first block */
+    if (pair->count != 0U) {
+        FTM_SRV_Publish(instance, index);
+    }
+}
+
+static ftm_srv_status_t FTM_SRV_StartDma(ftm_srv_instance_t instance, uint8_t index)
+{
+    ftm_srv_pair_t *pair = &s_ftm[instance].pair[index];
+    FTM_Type *base = s_ftm_bases[instance];
+    dma_request_source_t request;
+    dma_transfer_config_t xfer;
+    uint16_t ring = (uint16_t)(2U * pair->cfg.block_periods);
+    uint8_t ch = (uint8_t)(2U * index);
+
+    if (CLOCK_SRV_EnablePeripheral(CLOCK_SRV_DMAMUX, CLOCK_SRV_PCS_NONE) != CLOCK_SRV_SUCCESS) {
+        return FTM_SRV_ERROR;
+    }
+    DMA_Init();
+
+    if (RES_SRV_Alloc(RES_SRV_DMA_CHANNEL, RES_SRV_OWNER_SERVICE, &pair->rise_channel) != RES_SRV_SUCCESS) {
+        return FTM_SRV_NO_RESOURCE;
+    }
+    if (RES_SRV_Alloc(RES_SRV_DMA_CHANNEL, RES_SRV_OWNER_SERVICE, &pair->fall_channel) != RES_SRV_SUCCESS) {
+        RES_SRV_Release(RES_SRV_DMA_CHANNEL, pair->rise_channel, RES_SRV_OWNER_SERVICE);
+        return FTM_SRV_NO_RESOURCE;
+    }
+
+    /* C(n)V -> ring, one 16-bit capture per request, wrapping forever */
+    xfer.src_offset = 0;
+    xfer.dst_offset = 2;
+    xfer.src_size = DMA_TRANSFER_SIZE_2B;
+    xfer.dst_size = DMA_TRANSFER_SIZE_2B;
+    xfer.minor_bytes = 2U;
+    xfer.major_count = ring;
+    xfer.src_last_adjust = 0;
+    xfer.dst_last_adjust = -(int32_t)(ring * sizeof(uint16_t));
+    xfer.disable_request = false;
+
+    xfer.src_addr = FTM_GetChannelValueAddress(base, ch);
+    xfer.dst_addr = (uint32_t)pair->cfg.dma_buffer;
+    xfer.int_major = false;
+    xfer.int_half = false;
+    DMA_ConfigTransfer(pair->rise_channel, &xfer);
+
+    /* The end capture completes a period: it drives the block interrupt */
+    xfer.src_addr = FTM_GetChannelValueAddress(base, ch + 1U);
+    xfer.dst_addr = (uint32_t)&pair->cfg.dma_buffer[ring];
+    xfer.int_major = true;
+    xfer.int_half = true;
+    DMA_ConfigTransfer(pair->fall_channel, &xfer);
+
+    request = (instance == FTM_SRV_INSTANCE_1) ? DMA_REQ_FTM1_CH0 : DMA_REQ_FTM2_CH0;
+    DMA_SetRequestSource(pair->rise_channel, (dma_request_source_t)((uint32_t)request + ch), false);
+    DMA_SetRequestSource(pair->fall_channel, (dma_request_source_t)((uint32_t)request + ch + 1U), false);
+
+    DMA_InstallCallback(pair->fall_channel, FTM_SRV_DmaCallback,
+                        (void *)(uint32_t)((uint32_t)instance * FTM_SRV_PAIR_COUNT + index));
+    NVIC_SetPriority((IRQn_Type)(DMA_0_IRQn + pair->fall_channel), FTM_SRV_IRQ_PRIORITY);
+    NVIC_EnableInterrupt((IRQn_Type)(DMA_0_IRQn + pair->fall_channel));
+
+    DMA_StartChannel(pair->rise_channel);
+    DMA_StartChannel(pair->fall_channel);
+
+    FTM_EnableChannelDma(base, ch, true);
+    FTM_EnableChannelDma(base, ch + 1U, true);
+
+    return FTM_SRV_SUCCESS;
+}
+
+static void FTM_SRV_StopDma(ftm_srv_pair_t *pair)
+{
+    DMA_StopChannel(pair->rise_channel);
+    DMA_StopChannel(pair->fall_channel);
+    NVIC_DisableInterrupt((IRQn_Type)(DMA_0_IRQn + pair->fall_channel));
+
+    DMA_InstallCallback(pair->fall_channel, NULL, NULL);
+    DMA_SetRequestSource(pair->rise_channel, DMA_REQ_DISABLED, false);
+    DMA_SetRequestSource(pair->fall_channel, DMA_REQ_DISABLED, false);
+
+    RES_SRV_Release(RES_SRV_DMA_CHANNEL, pair->rise_channel, RES_SRV_OWNER_SERVICE);
+    RES_SRV_Release(RES_SRV_DMA_CHANNEL, pair->fall_channel, RES_SRV_OWNER_SERVICE);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+ftm_srv_status_t FTM_SRV_Init(ftm_srv_instance_t instance, const ftm_srv_config_t *config)
+{
+    clock_srv_frequencies_t freq;
+    ftm_config_t drv_cfg;
+    FTM_Type *base;
+    uint8_t prescaler = 0;
+
+    if (instance >= FTM_SRV_INSTANCE_COUNT || config == NULL) {
+        return FTM_SRV_INVALID_PARAM;
+    }
+
+    if (s_ftm[instance].initialized) {
+        return FTM_SRV_BUSY;
+    }
+
+    if (CLOCK_SRV_GetFrequencies(&freq) != CLOCK_SRV_SUCCESS ||
+        CLOCK_SRV_EnablePeripheral(s_ftm_clocks[instance], CLOCK_SRV_PCS_NONE) != CLOCK_SRV_SUCCESS) {
+        return FTM_SRV_ERROR;
+    }
+
+    /* Finest tick whose counter range still covers 1 / min_frequency */
+    if (config->min_frequency_hz != 0U) {
+        while ((freq.core_hz >> prescaler) / config->min_frequency_hz >= FTM_SRV_COUNTER_RANGE) {
+            if (++prescaler > 7U) {
+                return FTM_SRV_INVALID_PARAM;
+            }
+        }
+    }
+
+    base = s_ftm_bases[instance];
+    drv_cfg.clock = FTM_CLOCK_SYSTEM;
+    drv_cfg.prescaler = prescaler;
+    drv_cfg.modulo = 0xFFFFU;
+
+    if (FTM_Init(base, &drv_cfg) != FTM_STATUS_SUCCESS) {
+        return FTM_SRV_ERROR;
+    }
+
+    s_ftm[instance].tick_hz = freq.core_hz >> prescaler;
+    s_ftm[instance].overflows = 0U;
+    s_ftm[instance].irq_pairs = 0U;
+    for (uint8_t i = 0; i < FTM_SRV_PAIR_COUNT; i++) {
+        s_ftm[instance].pair[i].active = false;
+        s_ftm[instance].pair[i].seq = 0U;
+        s_ftm[instance].pair[i].result.periods = 0U;
+    }
+
+    FTM_RegisterCallback(base, FTM_SRV_Handler, (void *)(uint32_t)instance);
+    NVIC_SetPriority(s_ftm_ovf_irqs[instance], FTM_SRV_IRQ_PRIORITY);
+    NVIC_EnableInterrupt(s_ftm_ovf_irqs[instance]);
+
+    FTM_Start(base);
+    s_ftm[instance].initialized = true;
+
+    return FTM_SRV_SUCCESS;
+}
+
+void FTM_SRV_Deinit(ftm_srv_instance_t instance)
+{
+    if (instance >= FTM_SRV_INSTANCE_COUNT || !s_ftm[instance].initialized) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < FTM_SRV_PAIR_COUNT; i++) {
+        FTM_SRV_StopCapture(instance, i);
+    }
+
+    NVIC_DisableInterrupt(s_ftm_ovf_irqs[instance]);
+    FTM_Deinit(s_ftm_bases[instance]);
+    CLOCK_SRV_DisablePeripheral(s_ftm_clocks[instance]);
+    s_ftm[instance].initialized = false;
+}
+
+uint32_t FTM_SRV_GetTickHz(ftm_srv_instance_t instance)
+{
+    if (instance >= FTM_SRV_INSTANCE_COUNT || !s_ftm[instance].initialized) {
+        return 0U;
+    }
+
+    return s_ftm[instance].tick_hz;
+}
+
+ftm_srv_status_t FTM_SRV_StartCapture(ftm_srv_instance_t instance,
+                                      const ftm_srv_capture_config_t *config)
+{
+    ftm_srv_instance_data_t *inst;
+    ftm_srv_pair_t *pair;
+    ftm_srv_status_t status;
+    FTM_Type *base;
+    ftm_edge_t first;
+    ftm_edge_t second;
+    uint8_t ch;
+
+    if (instance >= FTM_SRV_INSTANCE_COUNT || config == NULL ||
+        config->pair >= FTM_SRV_PAIR_COUNT || config->block_periods == 0U) {
+        return FTM_SRV_INVALID_PARAM;
+    }
+
+    if (config->mode == FTM_SRV_CAPTURE_DMA &&
+        (config->dma_buffer == NULL || config->block_periods > DMA_MAX_MAJOR_COUNT / 2U ||
+         (instance != FTM_SRV_INSTANCE_1 && instance != FTM_SRV_INSTANCE_2))) {
+        return FTM_SRV_INVALID_PARAM;
+    }
+
+    inst = &s_ftm[instance];
+    if (!inst->initialized) {
+        return FTM_SRV_NOT_INITIALIZED;
+    }
+
+    pair = &inst->pair[config->pair];
+    if (pair->active) {
+        return FTM_SRV_BUSY;
+    }
+
+    base = s_ftm_bases[instance];
+    ch = (uint8_t)(2U * config->pair);
+
+    pair->cfg = *config;
+    pair->sum_period = 0U;
+    pair->sum_high = 0U;
+    pair->count = 0U;
+    pair->have_rise = false;
+    pair->have_high = false;
+    pair->idle_overflows = 0U;
+    pair->primed = false;
+
+    /* Overflows per stall period, rounded up */
+    pair->stall_overflows = (uint32_t)(((uint64_t)config->stall_ms * inst->tick_hz +
+                                        1000ULL * FTM_SRV_COUNTER_RANGE - 1ULL) /
+                                       (1000ULL * FTM_SRV_COUNTER_RANGE));
+    if (config->stall_ms != 0U && pair->stall_overflows < 2U) {
+        pair->stall_overflows = 2U;
+    }
+
+    if (ch < 4U) {
+        (void)FTM_SetInputFilter(base, ch, config->filter);
+    }
+
+    if (config->mode == FTM_SRV_CAPTURE_DMA) {
+        status = FTM_SRV_StartDma(instance, config->pair);
+        if (status != FTM_SRV_SUCCESS) {
+            return status;
+        }
+    } else {
+        FTM_EnableChannelInterrupt(base, ch, true);
+        FTM_EnableChannelInterrupt(base, ch + 1U, true);
+        NVIC_SetPriority((IRQn_Type)(s_ftm_pair_irqs[instance] + config->pair), FTM_SRV_IRQ_PRIORITY);
+        NVIC_EnableInterrupt((IRQn_Type)(s_ftm_pair_irqs[instance] + config->pair));
+
+        if (inst->irq_pairs++ == 0U) {
+            FTM_EnableOverflowInterrupt(base, true);
+        }
+    }
+
+    first = config->active_low ? FTM_EDGE_FALLING : FTM_EDGE_RISING;
+    second = config->active_low ? FTM_EDGE_RISING : FTM_EDGE_FALLING;
+
+    pair->active = true;
+    (void)FTM_ConfigDualEdgeCapture(base, config->pair, first, second, true);
+
+    return FTM_SRV_SUCCESS;
+}
+
+void FTM_SRV_StopCapture(ftm_srv_instance_t instance, uint8_t pair_index)
+{
+    ftm_srv_instance_data_t *inst;
+    ftm_srv_pair_t *pair;
+    FTM_Type *base;
+
+    if (instance >= FTM_SRV_INSTANCE_COUNT || pair_index >= FTM_SRV_PAIR_COUNT) {
+        return;
+    }
+
+    inst = &s_ftm[instance];
+    pair = &inst->pair[pair_index];
+    if (!pair->active) {
+        return;
+    }
+
+    base = s_ftm_bases[instance];
+    FTM_DisablePair(base, pair_index);
+
+    if (pair->cfg.mode == FTM_SRV_CAPTURE_DMA) {
+        FTM_SRV_StopDma(pair);
+    } else {
+        NVIC_DisableInterrupt((IRQn_Type)(s_ftm_pair_irqs[instance] + pair_index));
+        if (--inst->irq_pairs == 0U) {
+            FTM_EnableOverflowInterrupt(base, false);
+        }
+    }
+
+    pair->active = false;
+}
+
+ftm_srv_status_t FTM_SRV_GetMeasurement(ftm_srv_instance_t instance, uint8_t pair_index,
+                                        ftm_srv_measurement_t *result)
+{
+    ftm_srv_pair_t *pair;
+    uint32_t seq;
+
+    if (instance >= FTM_SRV_INSTANCE_COUNT || pair_index >= FTM_SRV_PAIR_COUNT || result == NULL) {
+        return FTM_SRV_INVALID_PARAM;
+    }
+
+    if (!s_ftm[instance].initialized) {
+        return FTM_SRV_NOT_INITIALIZED;
+    }
+
+    pair = &s_ftm[instance].pair[pair_index];
+
+    /* Retry if a block was published while copying */
+    do {
+        seq = pair->seq;
+        *result = pair->result;
+    } while ((seq & 1U) != 0U || seq != pair->seq);
+
+    return (seq == 0U) ? FTM_SRV_NO_DATA : FTM_SRV_SUCCESS;
+}
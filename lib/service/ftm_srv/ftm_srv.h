@@ -0,0 +1,174 @@
+/**
+ * @file    ftm_srv.h
+ * @brief   FTM Capture Service - Abstraction API
+ * @details
+ * Period, frequency and duty cycle measurement of PWM and frequency
+ * outputs (speed sensors, PWM-encoded sensors) with FTM input capture.
+ *
+ * Features:
+ * - Dual-edge capture per channel pair: the signal on channel 2n is
+ *   timestamped on the period-start edge and on the opposite edge
+ * - Results are delivered as averages over a block of periods, not per
+ *   edge
+ * - Interrupt mode: edge timestamps extended to 32 bits with the counter
+ *   overflow count, so periods longer than the 16-bit counter are
+ *   measured at full resolution; optional stall report when the input
+ *   stops toggling
+ * - DMA mode (FTM1/FTM2): both captures of every period are moved into
+ *   ring buffers by two DMA channels; the CPU only runs once per block.
+ *   Periods must fit the 16-bit counter (see min_frequency_hz).
+ *
+ * The counter clock is the system clock divided by 2^prescaler; all pairs
+ * of an instance share it. Pin muxing is left to the application
+ * (port_srv). DMA channels come from the resource registry (res_srv).
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef FTM_SRV_H
+#define FTM_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Channel pairs per instance */
+#define FTM_SRV_PAIR_COUNT          (4U)
+
+/**
+ * @brief FTM service status codes
+ */
+typedef enum {
+    FTM_SRV_SUCCESS = 0,
+    FTM_SRV_ERROR,
+    FTM_SRV_NOT_INITIALIZED,
+    FTM_SRV_BUSY,                   /**< Pair already capturing */
+    FTM_SRV_INVALID_PARAM,
+    FTM_SRV_NO_RESOURCE,            /**< No free DMA channel */
+    FTM_SRV_NO_DATA                 /**< No block completed yet */
+} ftm_srv_status_t;
+
+/**
+ * @brief FTM instance
+ */
+typedef enum {
+    FTM_SRV_INSTANCE_0 = 0,
+    FTM_SRV_INSTANCE_1,
+    FTM_SRV_INSTANCE_2,
+    FTM_SRV_INSTANCE_3,
+    FTM_SRV_INSTANCE_COUNT
+} ftm_srv_instance_t;
+
+/**
+ * @brief Instance configuration
+ */
+typedef struct {
+    uint32_t min_frequency_hz;      /**< Lowest frequency that must fit the 16-bit
+                                         counter (DMA mode). 0: finest resolution */
+} ftm_srv_config_t;
+
+/**
+ * @brief Capture transport
+ */
+typedef enum {
+    FTM_SRV_CAPTURE_IRQ = 0,        /**< Edge interrupts, overflow-extended */
+    FTM_SRV_CAPTURE_DMA             /**< DMA rings, interrupt per block (FTM1/FTM2) */
+} ftm_srv_capture_mode_t;
+
+/**
+ * @brief Averaged result of one block
+ */
+typedef struct {
+    uint32_t period_ns;             /**< Average period */
+    uint32_t frequency_mhz;         /**< Average frequency in mHz */
+    uint16_t duty_permyriad;        /**< Average active time, 0.01 % units */
+    uint16_t periods;               /**< Periods averaged, 0: input stalled */
+} ftm_srv_measurement_t;
+
+/**
+ * @brief Block callback (FTM or DMA interrupt context)
+ * @param instance FTM instance
+ * @param pair Channel pair
+ * @param result Averaged block
+ */
+typedef void (*ftm_srv_capture_callback_t)(ftm_srv_instance_t instance, uint8_t pair,
+                                           const ftm_srv_measurement_t *result);
+
+/**
+ * @brief Capture configuration
+ */
+typedef struct {
+    uint8_t pair;                   /**< Channel pair (0-3), input on channel 2*pair */
+    ftm_srv_capture_mode_t mode;    /**< Transport */
+    bool active_low;                /**< Period starts on the falling edge, duty is low time */
+    uint16_t block_periods;         /**< Periods per result */
+    uint16_t *dma_buffer;           /**< DMA mode: 4 * block_periods entries */
+    uint16_t stall_ms;              /**< IRQ mode: report periods = 0 after this long
+                                         without an edge, 0 = off */
+    uint8_t filter;                 /**< Input filter (0-15 x 4 system clocks, pairs 0-1) */
+    ftm_srv_capture_callback_t callback;    /**< Optional */
+} ftm_srv_capture_config_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize an FTM instance as a free-running capture timebase
+ * @details Picks the smallest prescaler for which a period of
+ *          1 / min_frequency_hz fits the 16-bit counter.
+ * @param instance FTM instance
+ * @param config Instance configuration
+ * @return ftm_srv_status_t Status of initialization
+ */
+ftm_srv_status_t FTM_SRV_Init(ftm_srv_instance_t instance, const ftm_srv_config_t *config);
+
+/**
+ * @brief Stop every capture and the counter
+ * @param instance FTM instance
+ */
+void FTM_SRV_Deinit(ftm_srv_instance_t instance);
+
+/**
+ * @brief Get the counter tick frequency
+ * @param instance FTM instance
+ * @return uint32_t Ticks per second, 0 if not initialized
+ */
+uint32_t FTM_SRV_GetTickHz(ftm_srv_instance_t instance);
+
+/**
+ * @brief Start measuring on a channel pair
+ * @param instance FTM instance
+ * @param config Capture configuration
+ * @return ftm_srv_status_t Status of operation
+ */
+ftm_srv_status_t FTM_SRV_StartCapture(ftm_srv_instance_t instance,
+                                      const ftm_srv_capture_config_t *config);
+
+/**
+ * @brief Stop measuring on a channel pair
+ * @param instance FTM instance
+ * @param pair Channel pair (0-3)
+ */
+void FTM_SRV_StopCapture(ftm_srv_instance_t instance, uint8_t pair);
+
+/**
+ * @brief Get the latest block result
+ * @details Safe against the interrupt updating it.
+ * @param instance FTM instance
+ * @param pair Channel pair (0-3)
+ * @param result Output
+ * @return ftm_srv_status_t FTM_SRV_NO_DATA until the first block completes
+ */
+ftm_srv_status_t FTM_SRV_GetMeasurement(ftm_srv_instance_t instance, uint8_t pair,
+                                        ftm_srv_measurement_t *result);
+
+#endif /* FTM_SRV_H */
@@ -174,7 +174,7 @@ gpio_srv_status_t GPIO_SRV_ConfigOutput(uint8_t port, uint8_t pin)
 uint8_t GPIO_SRV_Read(uint8_t port, uint8_t pin)
 {
     GPIO_Type *gpio_base = GPIO_SRV_GetPortBase(port);
-    if (gpio_base == NULL)
+    if ((gpio_base == NULL) || (pin >= MAX_CALLBACKS))
     {
         return 0;
     }
@@ -184,13 +184,14 @@ uint8_t GPIO_SRV_Read(uint8_t port, uint8_t pin)
 
 gpio_srv_status_t GPIO_SRV_Write(uint8_t port, uint8_t pin, uint8_t value)
 {
+    /* Checked at this layer; the unchecked tier is gpio_fast.h */
     if (!s_gpio_initialized)
     {
         return GPIO_SRV_NOT_INITIALIZED;
     }
 
     GPIO_Type *gpio_base = GPIO_SRV_GetPortBase(port);
-    if (gpio_base == NULL)
+    if ((gpio_base == NULL) || (pin >= MAX_CALLBACKS))
     {
         return GPIO_SRV_ERROR;
     }
@@ -216,7 +217,7 @@ gpio_srv_status_t GPIO_SRV_Toggle(uint8_t port, uint8_t pin)
     }
 
     GPIO_Type *gpio_base = GPIO_SRV_GetPortBase(port);
-    if (gpio_base == NULL)
+    if ((gpio_base == NULL) || (pin >= MAX_CALLBACKS))
     {
         return GPIO_SRV_ERROR;
     }
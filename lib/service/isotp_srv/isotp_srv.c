@@ -0,0 +1,468 @@
+/**
+ * @file    isotp_srv.c
+ * @brief   ISO-TP Service Implementation
+ * @details Segmentation, reassembly and flow control per ISO 15765-2
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "isotp_srv.h"
+#include "../can_srv/can_srv.h"
+#include "../clock_srv/clock_srv.h"
+#include "../../driver/ultis/dwt_ultis.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define ISOTP_SRV_STD_ID_MASK       (0x7FFU)
+#define ISOTP_SRV_PADDING           (0xCCU)
+
+/* Protocol control information (high nibble of byte 0) */
+#define ISOTP_SRV_PCI_SF            (0x00U)
+#define ISOTP_SRV_PCI_FF            (0x10U)
+#define ISOTP_SRV_PCI_CF            (0x20U)
+#define ISOTP_SRV_PCI_FC            (0x30U)
+
+/* Flow status */
+#define ISOTP_SRV_FS_CTS            (0U)
+#define ISOTP_SRV_FS_WAIT           (1U)
+#define ISOTP_SRV_FS_OVERFLOW       (2U)
+
+#define ISOTP_SRV_SF_MAX            (7U)
+#define ISOTP_SRV_FF_BYTES          (6U)
+#define ISOTP_SRV_CF_BYTES          (7U)
+
+#define ISOTP_SRV_N_BS_MS           (1000U)         /* Waiting for flow control */
+#define ISOTP_SRV_N_CR_MS           (1000U)         /* Waiting for a consecutive frame */
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef struct {
+    uint8_t dlc;
+    bool functional;
+    uint8_t data[8];
+} isotp_srv_frame_t;
+
+typedef enum {
+    ISOTP_SRV_TX_IDLE = 0,
+    ISOTP_SRV_TX_START,             /**< SF/FF waiting for the mailbox */
+    ISOTP_SRV_TX_WAIT_FC,
+    ISOTP_SRV_TX_SEND_CF
+} isotp_srv_tx_state_t;
+
+typedef struct {
+    isotp_srv_config_t cfg;
+    uint8_t mb;
+
+    /* CAN interrupt -> Process */
+    isotp_srv_frame_t queue[ISOTP_SRV_RX_QUEUE_LEN];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+
+    /* Reception */
+    bool receiving;
+    uint16_t rx_length;
+    uint16_t rx_offset;
+    uint8_t rx_sn;
+    uint8_t rx_bs_left;
+    uint32_t rx_stamp;
+    bool fc_pending;
+    uint8_t fc_status;
+
+    /* Transmission */
+    isotp_srv_tx_state_t tx_state;
+    const uint8_t *tx_data;
+    uint16_t tx_length;
+    uint16_t tx_offset;
+    uint8_t tx_sn;
+    uint8_t tx_bs;
+    uint8_t tx_bs_left;
+    uint32_t tx_st_cycles;
+    uint32_t tx_stamp;
+} isotp_srv_channel_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static isotp_srv_channel_t s_channels[ISOTP_SRV_MAX_CHANNELS];
+static uint8_t s_channel_count = 0;
+static uint32_t s_cycles_per_ms = 0;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static bool ISOTP_SRV_Elapsed(uint32_t stamp, uint32_t cycles)
+{
+    return (DWT_GetCycles() - stamp) >= cycles;
+}
+
+/**
+ * @brief STmin byte to core cycles
+ */
+static uint32_t ISOTP_SRV_StMinCycles(uint8_t st_min)
+{
+    if (st_min <= 0x7FU) {
+        return st_min * s_cycles_per_ms;
+    }
+
+    if (st_min >= 0xF1U && st_min <= 0xF9U) {
+        return (uint32_t)(st_min - 0xF0U) * (s_cycles_per_ms / 10U);
+    }
+
+    /* Reserved values: longest valid STmin */
+    return 0x7FU * s_cycles_per_ms;
+}
+
+static bool ISOTP_SRV_SendFrame(isotp_srv_channel_t *ch, const uint8_t *data, uint8_t length)
+{
+    can_srv_message_t msg;
+
+    msg.id = ch->cfg.tx_id;
+    msg.dlc = 8U;
+    msg.isExtended = false;
+    msg.isRemote = false;
+    memset(msg.data, ISOTP_SRV_PADDING, sizeof(msg.data));
+    memcpy(msg.data, data, length);
+
+    return CAN_SRV_SendOn(ch->mb, &msg) == CAN_SRV_SUCCESS;
+}
+
+static void ISOTP_SRV_TxDone(uint8_t index, isotp_srv_status_t status)
+{
+    isotp_srv_channel_t *ch = &s_channels[index];
+
+    ch->tx_state = ISOTP_SRV_TX_IDLE;
+
+    if (ch->cfg.on_tx_done != NULL) {
+        ch->cfg.on_tx_done(index, status);
+    }
+}
+
+static void ISOTP_SRV_RequestFc(isotp_srv_channel_t *ch, uint8_t status)
+{
+    ch->fc_status = status;
+    ch->fc_pending = true;
+}
+
+static void ISOTP_SRV_Deliver(uint8_t index, uint16_t length, bool functional)
+{
+    isotp_srv_channel_t *ch = &s_channels[index];
+
+    ch->receiving = false;
+    ch->cfg.on_receive(index, ch->cfg.rx_buffer, length, functional);
+}
+
+static void ISOTP_SRV_HandleFrame(uint8_t index, const isotp_srv_frame_t *frame)
+{
+    isotp_srv_channel_t *ch = &s_channels[index];
+    const uint8_t *d = frame->data;
+    uint16_t length;
+    uint16_t count;
+
+    switch (d[0] & 0xF0U) {
+        case ISOTP_SRV_PCI_SF:
+            length = d[0] & 0x0FU;
+            if (length == 0U || length > ISOTP_SRV_SF_MAX || length >= frame->dlc ||
+                length > ch->cfg.rx_size) {
+                break;
+            }
+            /* A new request replaces one still being received */
+            memcpy(ch->cfg.rx_buffer, &d[1], length);
+            ISOTP_SRV_Deliver(index, length, frame->functional);
+            break;
+
+        case ISOTP_SRV_PCI_FF:
+            if (frame->functional || frame->dlc < 8U) {
+                break;
+            }
+            length = (uint16_t)(((uint16_t)(d[0] & 0x0FU) << 8) | d[1]);
+            if (length <= ISOTP_SRV_SF_MAX) {
+                break;
+            }
+            if (length > ch->cfg.rx_size) {
+                ch->receiving = false;
+                ISOTP_SRV_RequestFc(ch, ISOTP_SRV_FS_OVERFLOW);
+                break;
+            }
+            memcpy(ch->cfg.rx_buffer, &d[2], ISOTP_SRV_FF_BYTES);
+            ch->receiving = true;
+            ch->rx_length = length;
+            ch->rx_offset = ISOTP_SRV_FF_BYTES;
+            ch->rx_sn = 1U;
+            ch->rx_bs_left = ch->cfg.block_size;
+            ch->rx_stamp = DWT_GetCycles();
+            ISOTP_SRV_RequestFc(ch, ISOTP_SRV_FS_CTS);
+            break;
+
+        case ISOTP_SRV_PCI_CF:
+            if (!ch->receiving || frame->functional) {
+                break;
+            }
+            if ((d[0] & 0x0FU) != ch->rx_sn) {
+                /* Lost frame: drop the message, the tester retries */
+                ch->receiving = false;
+                break;
+            }
+            count = (uint16_t)(ch->rx_length - ch->rx_offset);
+            if (count > ISOTP_SRV_CF_BYTES) {
+                count = ISOTP_SRV_CF_BYTES;
+            }
+            memcpy(&ch->cfg.rx_buffer[ch->rx_offset], &d[1], count);
+            ch->rx_offset = (uint16_t)(ch->rx_offset + count);
+            ch->rx_sn = (uint8_t)((ch->rx_sn + 1U) & 0x0FU);
+            ch->rx_stamp = DWT_GetCycles();
+
+            if (ch->rx_offset >= ch->rx_length) {
+                ISOTP_SRV_Deliver(index, ch->rx_length, false);
+            } else if (ch->cfg.block_size != 0U && --ch->rx_bs_left == 0U) {
+                ch->rx_bs_left = ch->cfg.block_size;
+                ISOTP_SRV_RequestFc(ch, ISOTP_SRV_FS_CTS);
+            }
+            break;
+
+        case ISOTP_SRV_PCI_FC:
+            if (ch->tx_state != ISOTP_SRV_TX_WAIT_FC || frame->functional || frame->dlc < 3U) {
+                break;
+            }
+            switch (d[0] & 0x0FU) {
+                case ISOTP_SRV_FS_CTS:
+                    ch->tx_bs = d[1];
+                    ch->tx_bs_left = d[1];
+                    ch->tx_st_cycles = ISOTP_SRV_StMinCycles(d[2]);
+                    /* First CF may follow immediately */
+                    ch->tx_stamp = DWT_GetCycles() - ch->tx_st_cycles;
+                    ch->tx_state = ISOTP_SRV_TX_SEND_CF;
+                    break;
+
+                case ISOTP_SRV_FS_WAIT:
+                    ch->tx_stamp = DWT_GetCycles();
+                    break;
+
+                default:
+                    ISOTP_SRV_TxDone(index, ISOTP_SRV_ERROR);
+                    break;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void ISOTP_SRV_RunTx(uint8_t index)
+{
+    isotp_srv_channel_t *ch = &s_channels[index];
+    uint8_t frame[8];
+    uint16_t count;
+
+    /* Flow control first: the peer is waiting for it */
+    if (ch->fc_pending) {
+        frame[0] = (uint8_t)(ISOTP_SRV_PCI_FC | ch->fc_status);
+        frame[1] = ch->cfg.block_size;
+        frame[2] = ch->cfg.st_min;
+        if (!ISOTP_SRV_SendFrame(ch, frame, 3U)) {
+            return;
+        }
+        ch->fc_pending = false;
+    }
+
+    switch (ch->tx_state) {
+        case ISOTP_SRV_TX_START:
+            if (ch->tx_length <= ISOTP_SRV_SF_MAX) {
+                frame[0] = (uint8_t)(ISOTP_SRV_PCI_SF | ch->tx_length);
+                memcpy(&frame[1], ch->tx_data, ch->tx_length);
+                if (ISOTP_SRV_SendFrame(ch, frame, (uint8_t)(ch->tx_length + 1U))) {
+                    ISOTP_SRV_TxDone(index, ISOTP_SRV_SUCCESS);
+                }
+            } else {
+                frame[0] = (uint8_t)(ISOTP_SRV_PCI_FF | (ch->tx_length >> 8));
+                frame[1] = (uint8_t)ch->tx_length;
+                memcpy(&frame[2], ch->tx_data, ISOTP_SRV_FF_BYTES);
+                if (ISOTP_SRV_SendFrame(ch, frame, 8U)) {
+                    ch->tx_offset = ISOTP_SRV_FF_BYTES;
+                    ch->tx_sn = 1U;
+                    ch->tx_stamp = DWT_GetCycles();
+                    ch->tx_state = ISOTP_SRV_TX_WAIT_FC;
+                }
+            }
+            break;
+
+        case ISOTP_SRV_TX_WAIT_FC:
+            if (ISOTP_SRV_Elapsed(ch->tx_stamp, ISOTP_SRV_N_BS_MS * s_cycles_per_ms)) {
+                ISOTP_SRV_TxDone(index, ISOTP_SRV_ERROR);
+            }
+            break;
+
+        case ISOTP_SRV_TX_SEND_CF:
+            if (!ISOTP_SRV_Elapsed(ch->tx_stamp, ch->tx_st_cycles)) {
+                break;
+            }
+            count = (uint16_t)(ch->tx_length - ch->tx_offset);
+            if (count > ISOTP_SRV_CF_BYTES) {
+                count = ISOTP_SRV_CF_BYTES;
+            }
+            frame[0] = (uint8_t)(ISOTP_SRV_PCI_CF | ch->tx_sn);
+            memcpy(&frame[1], &ch->tx_data[ch->tx_offset], count);
+            if (!ISOTP_SRV_SendFrame(ch, frame, (uint8_t)(count + 1U))) {
+                break;
+            }
+            ch->tx_offset = (uint16_t)(ch->tx_offset + count);
+            ch->tx_sn = (uint8_t)((ch->tx_sn + 1U) & 0x0FU);
+            ch->tx_stamp = DWT_GetCycles();
+
+            if (ch->tx_offset >= ch->tx_length) {
+                ISOTP_SRV_TxDone(index, ISOTP_SRV_SUCCESS);
+            } else if (ch->tx_bs != 0U && --ch->tx_bs_left == 0U) {
+                ch->tx_state = ISOTP_SRV_TX_WAIT_FC;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief can_srv listener: queue frames of open channels
+ */
+static void ISOTP_SRV_CANCallback(uint8_t instance, can_srv_event_t event, const can_srv_message_t *msg)
+{
+    isotp_srv_channel_t *ch;
+    isotp_srv_frame_t *frame;
+    uint8_t next;
+
+    (void)instance;
+
+    if (event != CAN_SRV_EVENT_RX_COMPLETE || msg == NULL || msg->isExtended || msg->isRemote) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < s_channel_count; i++) {
+        ch = &s_channels[i];
+        if (msg->id != ch->cfg.rx_id &&
+            (ch->cfg.functional_id == 0U || msg->id != ch->cfg.functional_id)) {
+            continue;
+        }
+
+        next = (uint8_t)((ch->head + 1U) % ISOTP_SRV_RX_QUEUE_LEN);
+        if (next != ch->tail) {
+            frame = &ch->queue[ch->head];
+            frame->dlc = msg->dlc;
+            frame->functional = (msg->id != ch->cfg.rx_id);
+            memcpy(frame->data, msg->data, sizeof(frame->data));
+            ch->head = next;
+        }
+        return;
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+isotp_srv_status_t ISOTP_SRV_Open(const isotp_srv_config_t *config, uint8_t *channel)
+{
+    clock_srv_frequencies_t freq;
+    isotp_srv_channel_t *ch;
+
+    if (config == NULL || channel == NULL || config->rx_buffer == NULL ||
+        config->rx_size == 0U || config->on_receive == NULL ||
+        config->rx_id > ISOTP_SRV_STD_ID_MASK || config->tx_id > ISOTP_SRV_STD_ID_MASK ||
+        config->functional_id > ISOTP_SRV_STD_ID_MASK) {
+        return ISOTP_SRV_INVALID_PARAM;
+    }
+
+    if (s_channel_count >= ISOTP_SRV_MAX_CHANNELS) {
+        return ISOTP_SRV_NO_RESOURCE;
+    }
+
+    if (CLOCK_SRV_GetFrequencies(&freq) != CLOCK_SRV_SUCCESS) {
+        return ISOTP_SRV_ERROR;
+    }
+    s_cycles_per_ms = freq.core_hz / 1000U;
+    DWT_CycleCounterStart();
+
+    ch = &s_channels[s_channel_count];
+    memset(ch, 0, sizeof(*ch));
+    ch->cfg = *config;
+    if (ch->cfg.rx_size > ISOTP_SRV_MAX_LENGTH) {
+        ch->cfg.rx_size = ISOTP_SRV_MAX_LENGTH;
+    }
+
+    if (CAN_SRV_AllocTxMailbox(&ch->mb) != CAN_SRV_SUCCESS ||
+        CAN_SRV_AddRxFilter(config->rx_id, ISOTP_SRV_STD_ID_MASK, false) != CAN_SRV_SUCCESS) {
+        return ISOTP_SRV_NO_RESOURCE;
+    }
+
+    if (config->functional_id != 0U &&
+        CAN_SRV_AddRxFilter(config->functional_id, ISOTP_SRV_STD_ID_MASK, false) != CAN_SRV_SUCCESS) {
+        return ISOTP_SRV_NO_RESOURCE;
+    }
+
+    if (CAN_SRV_RegisterCallback(ISOTP_SRV_CANCallback) != CAN_SRV_SUCCESS) {
+        return ISOTP_SRV_ERROR;
+    }
+
+    *channel = s_channel_count;
+    s_channel_count++;
+
+    return ISOTP_SRV_SUCCESS;
+}
+
+isotp_srv_status_t ISOTP_SRV_Send(uint8_t channel, const uint8_t *data, uint16_t length)
+{
+    isotp_srv_channel_t *ch;
+
+    if (channel >= s_channel_count || data == NULL || length == 0U ||
+        length > ISOTP_SRV_MAX_LENGTH) {
+        return ISOTP_SRV_INVALID_PARAM;
+    }
+
+    ch = &s_channels[channel];
+    if (ch->tx_state != ISOTP_SRV_TX_IDLE) {
+        return ISOTP_SRV_BUSY;
+    }
+
+    ch->tx_data = data;
+    ch->tx_length = length;
+    ch->tx_state = ISOTP_SRV_TX_START;
+
+    /* Single frames usually leave right away */
+    ISOTP_SRV_RunTx(channel);
+
+    return ISOTP_SRV_SUCCESS;
+}
+
+bool ISOTP_SRV_IsBusy(uint8_t channel)
+{
+    return (channel < s_channel_count) && (s_channels[channel].tx_state != ISOTP_SRV_TX_IDLE);
+}
+
+void ISOTP_SRV_Process(void)
+{
+    isotp_srv_channel_t *ch;
+
+    for (uint8_t i = 0; i < s_channel_count; i++) {
+        ch = &s_channels[i];
+
+        while (ch->tail != ch->head) {
+            ISOTP_SRV_HandleFrame(i, &ch->queue[ch->tail]);
+            ch->tail = (uint8_t)((ch->tail + 1U) % ISOTP_SRV_RX_QUEUE_LEN);
+        }
+
+        if (ch->receiving && ISOTP_SRV_Elapsed(ch->rx_stamp, ISOTP_SRV_N_CR_MS * s_cycles_per_ms)) {
+            ch->receiving = false;
+        }
+
+        ISOTP_SRV_RunTx(i);
+    }
+}
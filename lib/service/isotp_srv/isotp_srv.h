@@ -0,0 +1,123 @@
+/**
+ * @file    isotp_srv.h
+ * @brief   ISO-TP Service - Abstraction API
+ * @details
+ * ISO 15765-2 transport on classic CAN (normal addressing, 11-bit IDs)
+ * for messages up to 4095 bytes:
+ * - Single frame, first frame, consecutive frames and flow control
+ * - Block size and STmin of the sender are honoured (including the
+ *   100-900 us STmin range), our own BS/STmin are configurable
+ * - N_Bs and N_Cr timeouts (1000 ms) abort a stalled transfer
+ * - Optional functional request ID (single frames only)
+ *
+ * Each channel owns a TX mailbox and an RX filter per ID. The CAN
+ * interrupt only copies matching frames into the channel queue; frame
+ * handling, timers and callbacks run in ISOTP_SRV_Process() from the main
+ * loop. Timing uses the DWT cycle counter, so no LPIT channel is taken.
+ *
+ * All frames are sent with 8 data bytes, unused bytes padded with 0xCC.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef ISOTP_SRV_H
+#define ISOTP_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Limits */
+#define ISOTP_SRV_MAX_CHANNELS      (2U)
+#define ISOTP_SRV_MAX_LENGTH        (4095U)
+#define ISOTP_SRV_RX_QUEUE_LEN      (8U)            /* Frames between two Process passes */
+#define ISOTP_SRV_NO_CHANNEL        (0xFFU)
+
+/**
+ * @brief ISO-TP service status codes
+ */
+typedef enum {
+    ISOTP_SRV_SUCCESS = 0,          /**< Operation successful */
+    ISOTP_SRV_ERROR,                /**< General error, aborted or timed out */
+    ISOTP_SRV_INVALID_PARAM,        /**< Invalid parameter */
+    ISOTP_SRV_NO_RESOURCE,          /**< No channel, mailbox or filter left */
+    ISOTP_SRV_BUSY                  /**< Transmission in progress */
+} isotp_srv_status_t;
+
+/**
+ * @brief Complete message received (main loop context)
+ * @param channel Channel handle
+ * @param data Reassembled payload, valid until the next Process pass
+ * @param length Payload length
+ * @param functional Received on the functional ID
+ */
+typedef void (*isotp_srv_rx_callback_t)(uint8_t channel, const uint8_t *data, uint16_t length,
+                                        bool functional);
+
+/**
+ * @brief Transmission finished (main loop context)
+ */
+typedef void (*isotp_srv_tx_callback_t)(uint8_t channel, isotp_srv_status_t status);
+
+/**
+ * @brief Channel configuration
+ */
+typedef struct {
+    uint32_t rx_id;                 /**< Physical ID received (e.g. 0x7E0) */
+    uint32_t tx_id;                 /**< ID sent (e.g. 0x7E8) */
+    uint32_t functional_id;         /**< Functional ID received, 0 = none */
+    uint8_t block_size;             /**< BS in our flow control, 0 = no limit */
+    uint8_t st_min;                 /**< STmin in our flow control (ISO encoding) */
+    uint8_t *rx_buffer;             /**< Reassembly buffer */
+    uint16_t rx_size;               /**< Longer messages are refused (overflow) */
+    isotp_srv_rx_callback_t on_receive;
+    isotp_srv_tx_callback_t on_tx_done;     /**< Optional, NULL allowed */
+} isotp_srv_config_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Open a channel
+ * @details CAN_SRV_Init() and CLOCK_SRV_Init() must have been called.
+ * @param config Channel configuration (copied)
+ * @param channel Receives the channel handle
+ * @return isotp_srv_status_t Status of operation
+ */
+isotp_srv_status_t ISOTP_SRV_Open(const isotp_srv_config_t *config, uint8_t *channel);
+
+/**
+ * @brief Send a message
+ * @details The data is not copied and must stay valid until on_tx_done
+ *          (or until ISOTP_SRV_IsBusy() returns false).
+ * @param channel Channel handle
+ * @param data Payload
+ * @param length 1 - ISOTP_SRV_MAX_LENGTH bytes
+ * @return isotp_srv_status_t ISOTP_SRV_BUSY if a message is still being sent
+ */
+isotp_srv_status_t ISOTP_SRV_Send(uint8_t channel, const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Check for a transmission in progress
+ * @param channel Channel handle
+ * @return true while a message is being sent
+ */
+bool ISOTP_SRV_IsBusy(uint8_t channel);
+
+/**
+ * @brief Run all channels: received frames, timers, transmission
+ * @details Call from the main loop. Consecutive frames go out from here,
+ *          so the pass rate bounds the throughput when STmin is 0.
+ */
+void ISOTP_SRV_Process(void);
+
+#endif /* ISOTP_SRV_H */
@@ -0,0 +1,921 @@
+/**
+ * @file    j1939_srv.c
+ * @brief   J1939 Service Implementation
+ * @details Address claim, PGN filtering and BAM/CMDT transport protocol
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "j1939_srv.h"
+#include "../can_srv/can_srv.h"
+#include "../lpit_srv/lpit_srv.h"
+#include "../res_srv/res_srv.h"
+#include "../../driver/nvic/nvic.h"
+#include "../../driver/ultis/mem_ultis.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define J1939_SRV_TICK_MS           (5U)
+#define J1939_SRV_TICK_IRQ_PRIO     (5U)
+#define J1939_SRV_TX_QUEUE_LEN      (4U)
+
+/* Hardware filter masks (29-bit identifier) */
+#define J1939_SRV_FILTER_PDU1_MASK  (0x03FF0000UL)  /* EDP, DP, PF */
+#define J1939_SRV_FILTER_PDU2_MASK  (0x03FFFF00UL)  /* EDP, DP, PF, PS */
+
+/* J1939-81 */
+#define J1939_SRV_CLAIM_WAIT_MS     (250U)
+
+/* J1939-21 transport protocol */
+#define J1939_SRV_TP_PRIO           (7U)
+#define J1939_SRV_TP_BYTES          (7U)            /* Payload per TP.DT */
+#define J1939_SRV_TP_BAM_GAP_MS     (50U)
+#define J1939_SRV_TP_T1_MS          (750U)          /* Gap between received packets */
+#define J1939_SRV_TP_T2_MS          (1250U)         /* CTS sent, waiting for data */
+#define J1939_SRV_TP_T3_MS          (1250U)         /* Data sent, waiting for CTS/EOM */
+#define J1939_SRV_TP_T4_MS          (1050U)         /* Hold (CTS with 0 packets) */
+
+#define J1939_SRV_TP_CM_RTS         (16U)
+#define J1939_SRV_TP_CM_CTS         (17U)
+#define J1939_SRV_TP_CM_EOM_ACK     (19U)
+#define J1939_SRV_TP_CM_BAM         (32U)
+#define J1939_SRV_TP_CM_ABORT       (255U)
+
+#define J1939_SRV_ABORT_BUSY        (1U)
+#define J1939_SRV_ABORT_RESOURCES   (2U)
+#define J1939_SRV_ABORT_TIMEOUT     (3U)
+#define J1939_SRV_ABORT_SEQUENCE    (7U)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef enum {
+    J1939_SRV_TP_IDLE = 0,
+    J1939_SRV_TP_BAM,               /**< TX: pacing packets / RX: collecting */
+    J1939_SRV_TP_CMDT,              /**< RX: connection open */
+    J1939_SRV_TP_WAIT_CTS,          /**< TX: RTS or window sent */
+    J1939_SRV_TP_SEND,              /**< TX: sending the CTS window */
+    J1939_SRV_TP_WAIT_EOM           /**< TX: all sent, waiting for the ack */
+} j1939_srv_tp_state_t;
+
+/**
+ * @brief Transport session, one per direction
+ */
+typedef struct {
+    j1939_srv_tp_state_t state;
+    uint32_t pgn;
+    uint8_t peer;                   /**< TX: destination / RX: source */
+    uint8_t da;                     /**< RX: destination of the session */
+    uint16_t size;
+    uint8_t packets;
+    uint8_t next;                   /**< Next sequence number (1-based) */
+    uint8_t last;                   /**< Last sequence number of the CTS window */
+    uint32_t deadline;
+    uint8_t data[J1939_SRV_TP_MAX_SIZE];
+} j1939_srv_tp_t;
+
+typedef struct {
+    uint32_t pgn;
+    j1939_srv_rx_callback_t callback;
+} j1939_srv_sub_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static j1939_srv_config_t s_config;
+static volatile uint32_t s_now_ms = 0;
+
+/* Address management */
+static j1939_srv_addr_state_t s_addr_state = J1939_SRV_ADDR_CLAIMING;
+static uint8_t s_address = J1939_SRV_ADDR_NULL;
+static bool s_claim_pending = false;
+static uint32_t s_claim_time = 0;
+static uint32_t s_taken[8];                     /* Addresses claimed by other nodes */
+
+static j1939_srv_sub_t s_subs[J1939_SRV_MAX_SUBSCRIPTIONS];
+static uint8_t s_sub_count = 0;
+
+/* CAN interrupt -> Process */
+static can_srv_message_t s_rxq[J1939_SRV_RX_QUEUE_LEN] MEM_QUEUE;
+static volatile uint8_t s_rxq_head = 0;
+static volatile uint8_t s_rxq_tail = 0;
+
+/* Process -> own TX mailbox */
+static can_srv_message_t s_txq[J1939_SRV_TX_QUEUE_LEN];
+static uint8_t s_txq_head = 0;
+static uint8_t s_txq_tail = 0;
+static uint8_t s_tx_mb = 0;
+
+static j1939_srv_tp_t s_tp_tx;
+static j1939_srv_tp_t s_tp_rx;
+
+static lpit_srv_config_t s_tick_lpit;
+static j1939_srv_stats_t s_stats;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static bool J1939_SRV_Expired(uint32_t deadline)
+{
+    return (int32_t)(s_now_ms - deadline) >= 0;
+}
+
+static uint32_t J1939_SRV_GetPgn24(const uint8_t *bytes)
+{
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16);
+}
+
+static void J1939_SRV_PutPgn24(uint8_t *bytes, uint32_t pgn)
+{
+    bytes[0] = (uint8_t)pgn;
+    bytes[1] = (uint8_t)(pgn >> 8);
+    bytes[2] = (uint8_t)(pgn >> 16);
+}
+
+static bool J1939_SRV_IsTaken(uint8_t address)
+{
+    return (s_taken[address >> 5] & (1UL << (address & 0x1FU))) != 0U;
+}
+
+static void J1939_SRV_SetTaken(uint8_t address)
+{
+    s_taken[address >> 5] |= (1UL << (address & 0x1FU));
+}
+
+/**
+ * @brief Send queued frames while the mailbox is free
+ */
+static void J1939_SRV_FlushTx(void)
+{
+    while (s_txq_tail != s_txq_head) {
+        if (CAN_SRV_SendOn(s_tx_mb, &s_txq[s_txq_tail]) != CAN_SRV_SUCCESS) {
+            break;
+        }
+        s_txq_tail = (uint8_t)((s_txq_tail + 1U) % J1939_SRV_TX_QUEUE_LEN);
+    }
+}
+
+static j1939_srv_status_t J1939_SRV_Queue(uint32_t id, const uint8_t *data, uint8_t length)
+{
+    uint8_t next = (uint8_t)((s_txq_head + 1U) % J1939_SRV_TX_QUEUE_LEN);
+    can_srv_message_t *msg;
+
+    if (next == s_txq_tail) {
+        return J1939_SRV_BUSY;
+    }
+
+    msg = &s_txq[s_txq_head];
+    msg->id = id;
+    msg->dlc = length;
+    msg->isExtended = true;
+    msg->isRemote = false;
+    memset(msg->data, 0xFF, sizeof(msg->data));
+    if (length > 0U) {
+        memcpy(msg->data, data, length);
+    }
+    s_txq_head = next;
+
+    J1939_SRV_FlushTx();
+
+    return J1939_SRV_SUCCESS;
+}
+
+static j1939_srv_status_t J1939_SRV_SendCm(uint8_t da, uint8_t control, uint8_t b1, uint8_t b2,
+                                           uint8_t b3, uint8_t b4, uint32_t pgn)
+{
+    uint8_t data[8];
+
+    data[0] = control;
+    data[1] = b1;
+    data[2] = b2;
+    data[3] = b3;
+    data[4] = b4;
+    J1939_SRV_PutPgn24(&data[5], pgn);
+
+    return J1939_SRV_Queue(J1939_SRV_MakeId(J1939_SRV_TP_PRIO, J1939_SRV_PGN_TP_CM, da, s_address),
+                           data, 8U);
+}
+
+static void J1939_SRV_SendAbort(uint8_t da, uint8_t reason, uint32_t pgn)
+{
+    (void)J1939_SRV_SendCm(da, J1939_SRV_TP_CM_ABORT, reason, 0xFFU, 0xFFU, 0xFFU, pgn);
+}
+
+static void J1939_SRV_Deliver(uint32_t pgn, uint8_t priority, uint8_t sa, uint8_t da,
+                              const uint8_t *data, uint16_t length)
+{
+    j1939_srv_msg_t msg;
+
+    msg.pgn = pgn;
+    msg.priority = priority;
+    msg.sa = sa;
+    msg.da = da;
+    msg.length = length;
+    msg.data = data;
+
+    for (uint8_t i = 0; i < s_sub_count; i++) {
+        if (s_subs[i].pgn == pgn) {
+            s_subs[i].callback(&msg);
+        }
+    }
+}
+
+static bool J1939_SRV_IsSubscribed(uint32_t pgn)
+{
+    for (uint8_t i = 0; i < s_sub_count; i++) {
+        if (s_subs[i].pgn == pgn) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool J1939_SRV_IsForUs(uint8_t da)
+{
+    return da == J1939_SRV_ADDR_GLOBAL ||
+           (da == s_address && s_addr_state != J1939_SRV_ADDR_LOST);
+}
+
+/*******************************************************************************
+ * Address claim
+ ******************************************************************************/
+
+static void J1939_SRV_SetAddrState(j1939_srv_addr_state_t state)
+{
+    s_addr_state = state;
+
+    if (state != J1939_SRV_ADDR_CLAIMING && s_config.on_address != NULL) {
+        s_config.on_address(state, s_address);
+    }
+}
+
+/**
+ * @brief Send the pending claim (or "cannot claim" when lost)
+ */
+static void J1939_SRV_SendClaim(void)
+{
+    uint8_t name[8];
+
+    for (uint8_t i = 0; i < 8U; i++) {
+        name[i] = (uint8_t)(s_config.name >> (8U * i));
+    }
+
+    if (J1939_SRV_Queue(J1939_SRV_MakeId(J1939_SRV_PRIO_DEFAULT, J1939_SRV_PGN_ADDRESS_CLAIMED,
+                                         J1939_SRV_ADDR_GLOBAL, s_address),
+                        name, 8U) == J1939_SRV_SUCCESS) {
+        s_claim_pending = false;
+        s_claim_time = s_now_ms;
+    }
+}
+
+/**
+ * @brief Lost the address: next free one in the range, or give up
+ */
+static void J1939_SRV_Reclaim(void)
+{
+    uint8_t candidate = s_address;
+    uint16_t span;
+
+    s_stats.claim_losses++;
+    J1939_SRV_SetTaken(s_address);
+
+    if ((s_config.name & J1939_SRV_NAME_ARBITRARY_ADDRESS) != 0U) {
+        span = (uint16_t)(s_config.address_max - s_config.address_min + 1U);
+        for (uint16_t i = 0; i < span; i++) {
+            candidate = (candidate >= s_config.address_max || candidate < s_config.address_min) ?
+                        s_config.address_min : (uint8_t)(candidate + 1U);
+            if (!J1939_SRV_IsTaken(candidate)) {
+                s_address = candidate;
+                s_claim_pending = true;
+                J1939_SRV_SetAddrState(J1939_SRV_ADDR_CLAIMING);
+                return;
+            }
+        }
+    }
+
+    s_address = J1939_SRV_ADDR_NULL;
+    s_claim_pending = true;
+    s_tp_tx.state = J1939_SRV_TP_IDLE;
+    s_tp_rx.state = J1939_SRV_TP_IDLE;
+    J1939_SRV_SetAddrState(J1939_SRV_ADDR_LOST);
+}
+
+static void J1939_SRV_HandleClaim(uint8_t sa, const uint8_t *data)
+{
+    uint64_t name = 0;
+
+    if (sa == J1939_SRV_ADDR_NULL) {
+        return;
+    }
+
+    if (sa != s_address || s_addr_state == J1939_SRV_ADDR_LOST) {
+        J1939_SRV_SetTaken(sa);
+        return;
+    }
+
+    for (uint8_t i = 0; i < 8U; i++) {
+        name |= (uint64_t)data[i] << (8U * i);
+    }
+
+    if (s_config.name < name) {
+        /* We keep the address: repeat our claim */
+        s_claim_pending = true;
+    } else if (s_config.name > name) {
+        J1939_SRV_Reclaim();
+    }
+}
+
+static void J1939_SRV_HandleRequest(const j1939_srv_id_t *id, const uint8_t *data)
+{
+    uint32_t pgn = J1939_SRV_GetPgn24(data);
+
+    if (pgn == J1939_SRV_PGN_ADDRESS_CLAIMED) {
+        if (id->da == J1939_SRV_ADDR_GLOBAL || id->da == s_address) {
+            s_claim_pending = true;
+        }
+        return;
+    }
+
+    if (J1939_SRV_IsForUs(id->da)) {
+        J1939_SRV_Deliver(J1939_SRV_PGN_REQUEST, id->priority, id->sa, id->da, data, 3U);
+    }
+}
+
+/*******************************************************************************
+ * Transport protocol
+ ******************************************************************************/
+
+static void J1939_SRV_TxDone(j1939_srv_status_t status)
+{
+    uint32_t pgn = s_tp_tx.pgn;
+
+    s_tp_tx.state = J1939_SRV_TP_IDLE;
+
+    if (status == J1939_SRV_SUCCESS) {
+        s_stats.tp_tx_done++;
+    } else {
+        s_stats.tp_tx_aborted++;
+    }
+
+    if (s_config.on_tx_done != NULL) {
+        s_config.on_tx_done(pgn, status);
+    }
+}
+
+static void J1939_SRV_RxAbort(uint8_t reason)
+{
+    if (s_tp_rx.state == J1939_SRV_TP_CMDT) {
+        J1939_SRV_SendAbort(s_tp_rx.peer, reason, s_tp_rx.pgn);
+    }
+
+    s_tp_rx.state = J1939_SRV_TP_IDLE;
+    s_stats.tp_rx_aborted++;
+}
+
+/**
+ * @brief Ask for the next window of a CMDT reception
+ */
+static void J1939_SRV_SendCts(uint8_t max_per_cts)
+{
+    uint8_t count = (uint8_t)(s_tp_rx.packets - s_tp_rx.next + 1U);
+
+    /* 0xFF: sender has no limit; 0 is not valid, treat it the same */
+    if (max_per_cts != 0U && count > max_per_cts) {
+        count = max_per_cts;
+    }
+
+    s_tp_rx.last = (uint8_t)(s_tp_rx.next + count - 1U);
+    s_tp_rx.deadline = s_now_ms + J1939_SRV_TP_T2_MS;
+    (void)J1939_SRV_SendCm(s_tp_rx.peer, J1939_SRV_TP_CM_CTS, count, s_tp_rx.next,
+                           0xFFU, 0xFFU, s_tp_rx.pgn);
+}
+
+static bool J1939_SRV_StartRx(const j1939_srv_id_t *id, const uint8_t *data)
+{
+    uint16_t size = (uint16_t)(data[1] | ((uint16_t)data[2] << 8));
+    uint8_t packets = data[3];
+
+    if (size <= 8U || size > J1939_SRV_TP_MAX_SIZE ||
+        packets != (uint8_t)((size + J1939_SRV_TP_BYTES - 1U) / J1939_SRV_TP_BYTES) ||
+        !J1939_SRV_IsSubscribed(J1939_SRV_GetPgn24(&data[5]))) {
+        return false;
+    }
+
+    s_tp_rx.pgn = J1939_SRV_GetPgn24(&data[5]);
+    s_tp_rx.peer = id->sa;
+    s_tp_rx.da = id->da;
+    s_tp_rx.size = size;
+    s_tp_rx.packets = packets;
+    s_tp_rx.next = 1U;
+    s_tp_rx.last = packets;
+    s_tp_rx.deadline = s_now_ms + J1939_SRV_TP_T1_MS;
+
+    return true;
+}
+
+static void J1939_SRV_HandleCm(const j1939_srv_id_t *id, const uint8_t *data)
+{
+    uint32_t pgn = J1939_SRV_GetPgn24(&data[5]);
+
+    switch (data[0]) {
+        case J1939_SRV_TP_CM_BAM:
+            if (id->da != J1939_SRV_ADDR_GLOBAL || s_tp_rx.state == J1939_SRV_TP_CMDT) {
+                break;
+            }
+            s_tp_rx.state = J1939_SRV_StartRx(id, data) ? J1939_SRV_TP_BAM : J1939_SRV_TP_IDLE;
+            break;
+
+        case J1939_SRV_TP_CM_RTS:
+            if (id->da != s_address) {
+                break;
+            }
+            if (s_tp_rx.state != J1939_SRV_TP_IDLE && s_tp_rx.peer != id->sa) {
+                J1939_SRV_SendAbort(id->sa, J1939_SRV_ABORT_BUSY, pgn);
+                break;
+            }
+            if (!J1939_SRV_StartRx(id, data)) {
+                s_tp_rx.state = J1939_SRV_TP_IDLE;
+                J1939_SRV_SendAbort(id->sa, J1939_SRV_ABORT_RESOURCES, pgn);
+                break;
+            }
+            s_tp_rx.state = J1939_SRV_TP_CMDT;
+            J1939_SRV_SendCts(data[4]);
+            break;
+
+        case J1939_SRV_TP_CM_CTS:
+            if (id->da != s_address || id->sa != s_tp_tx.peer || pgn != s_tp_tx.pgn ||
+                (s_tp_tx.state != J1939_SRV_TP_WAIT_CTS && s_tp_tx.state != J1939_SRV_TP_SEND)) {
+                break;
+            }
+            if (data[1] == 0U) {
+                /* Hold the connection open */
+                s_tp_tx.state = J1939_SRV_TP_WAIT_CTS;
+                s_tp_tx.deadline = s_now_ms + J1939_SRV_TP_T4_MS;
+            } else if (data[2] == 0U || data[2] > s_tp_tx.packets) {
+                J1939_SRV_SendAbort(s_tp_tx.peer, J1939_SRV_ABORT_SEQUENCE, s_tp_tx.pgn);
+                J1939_SRV_TxDone(J1939_SRV_ERROR);
+            } else {
+                s_tp_tx.next = data[2];
+                s_tp_tx.last = (uint8_t)((data[2] + data[1] - 1U > s_tp_tx.packets) ?
+                                         s_tp_tx.packets : (data[2] + data[1] - 1U));
+                s_tp_tx.state = J1939_SRV_TP_SEND;
+            }
+            break;
+
+        case J1939_SRV_TP_CM_EOM_ACK:
+            if (s_tp_tx.state == J1939_SRV_TP_WAIT_EOM && id->sa == s_tp_tx.peer &&
+                pgn == s_tp_tx.pgn) {
+                J1939_SRV_TxDone(J1939_SRV_SUCCESS);
+            }
+            break;
+
+        case J1939_SRV_TP_CM_ABORT:
+            if (s_tp_tx.state != J1939_SRV_TP_IDLE && s_tp_tx.state != J1939_SRV_TP_BAM &&
+                id->sa == s_tp_tx.peer && pgn == s_tp_tx.pgn) {
+                J1939_SRV_TxDone(J1939_SRV_ERROR);
+            }
+            if (s_tp_rx.state == J1939_SRV_TP_CMDT && id->sa == s_tp_rx.peer && pgn == s_tp_rx.pgn) {
+                s_tp_rx.state = J1939_SRV_TP_IDLE;
+                s_stats.tp_rx_aborted++;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void J1939_SRV_HandleDt(const j1939_srv_id_t *id, const uint8_t *data)
+{
+    uint16_t offset;
+    uint16_t count;
+
+    if (s_tp_rx.state == J1939_SRV_TP_IDLE || id->sa != s_tp_rx.peer || id->da != s_tp_rx.da) {
+        return;
+    }
+
+    if (data[0] != s_tp_rx.next || data[0] > s_tp_rx.last) {
+        J1939_SRV_RxAbort(J1939_SRV_ABORT_SEQUENCE);
+        return;
+    }
+
+    offset = (uint16_t)((data[0] - 1U) * J1939_SRV_TP_BYTES);
+    count = (uint16_t)(s_tp_rx.size - offset);
+    if (count > J1939_SRV_TP_BYTES) {
+        count = J1939_SRV_TP_BYTES;
+    }
+    memcpy(&s_tp_rx.data[offset], &data[1], count);
+
+    s_tp_rx.next++;
+    s_tp_rx.deadline = s_now_ms + J1939_SRV_TP_T1_MS;
+
+    if (data[0] == s_tp_rx.packets) {
+        if (s_tp_rx.state == J1939_SRV_TP_CMDT) {
+            (void)J1939_SRV_SendCm(s_tp_rx.peer, J1939_SRV_TP_CM_EOM_ACK, (uint8_t)s_tp_rx.size,
+                                   (uint8_t)(s_tp_rx.size >> 8), s_tp_rx.packets, 0xFFU, s_tp_rx.pgn);
+        }
+        s_tp_rx.state = J1939_SRV_TP_IDLE;
+        s_stats.tp_rx_done++;
+        J1939_SRV_Deliver(s_tp_rx.pgn, J1939_SRV_TP_PRIO, s_tp_rx.peer, s_tp_rx.da,
+                          s_tp_rx.data, s_tp_rx.size);
+    } else if (s_tp_rx.state == J1939_SRV_TP_CMDT && data[0] == s_tp_rx.last) {
+        J1939_SRV_SendCts(0xFFU);
+    }
+}
+
+/**
+ * @brief Queue the next TP.DT of the TX session
+ */
+static bool J1939_SRV_SendDt(void)
+{
+    uint8_t data[8];
+    uint16_t offset = (uint16_t)((s_tp_tx.next - 1U) * J1939_SRV_TP_BYTES);
+    uint16_t count = (uint16_t)(s_tp_tx.size - offset);
+
+    if (count > J1939_SRV_TP_BYTES) {
+        count = J1939_SRV_TP_BYTES;
+    }
+
+    memset(data, 0xFF, sizeof(data));
+    data[0] = s_tp_tx.next;
+    memcpy(&data[1], &s_tp_tx.data[offset], count);
+
+    if (J1939_SRV_Queue(J1939_SRV_MakeId(J1939_SRV_TP_PRIO, J1939_SRV_PGN_TP_DT, s_tp_tx.peer, s_address),
+                        data, 8U) != J1939_SRV_SUCCESS) {
+        return false;
+    }
+
+    s_tp_tx.next++;
+
+    return true;
+}
+
+static void J1939_SRV_RunTx(void)
+{
+    switch (s_tp_tx.state) {
+        case J1939_SRV_TP_BAM:
+            if (J1939_SRV_Expired(s_tp_tx.deadline) && J1939_SRV_SendDt()) {
+                s_tp_tx.deadline = s_now_ms + J1939_SRV_TP_BAM_GAP_MS;
+                if (s_tp_tx.next > s_tp_tx.packets) {
+                    J1939_SRV_TxDone(J1939_SRV_SUCCESS);
+                }
+            }
+            break;
+
+        case J1939_SRV_TP_SEND:
+            while (s_tp_tx.next <= s_tp_tx.last && J1939_SRV_SendDt()) {
+            }
+            if (s_tp_tx.next > s_tp_tx.last) {
+                s_tp_tx.state = (s_tp_tx.last == s_tp_tx.packets) ? J1939_SRV_TP_WAIT_EOM
+                                                                  : J1939_SRV_TP_WAIT_CTS;
+                s_tp_tx.deadline = s_now_ms + J1939_SRV_TP_T3_MS;
+            }
+            break;
+
+        case J1939_SRV_TP_WAIT_CTS:
+        case J1939_SRV_TP_WAIT_EOM:
+            if (J1939_SRV_Expired(s_tp_tx.deadline)) {
+                J1939_SRV_SendAbort(s_tp_tx.peer, J1939_SRV_ABORT_TIMEOUT, s_tp_tx.pgn);
+                J1939_SRV_TxDone(J1939_SRV_ERROR);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*******************************************************************************
+ * Interrupt context
+ ******************************************************************************/
+
+/**
+ * @brief can_srv listener: queue extended frames for Process
+ */
+static void J1939_SRV_CANCallback(uint8_t instance, can_srv_event_t event, const can_srv_message_t *msg)
+{
+    uint8_t next;
+
+    (void)instance;
+
+    if (event != CAN_SRV_EVENT_RX_COMPLETE || msg == NULL || !msg->isExtended || msg->isRemote) {
+        return;
+    }
+
+    next = (uint8_t)((s_rxq_head + 1U) % J1939_SRV_RX_QUEUE_LEN);
+    if (next == s_rxq_tail) {
+        s_stats.rx_overruns++;
+        return;
+    }
+
+    s_rxq[s_rxq_head] = *msg;
+    s_rxq_head = next;
+}
+
+static void J1939_SRV_TickCallback(void)
+{
+    s_now_ms += J1939_SRV_TICK_MS;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+j1939_srv_status_t J1939_SRV_Init(const j1939_srv_config_t *config)
+{
+    static const uint32_t pgns[] = {
+        J1939_SRV_PGN_ADDRESS_CLAIMED, J1939_SRV_PGN_REQUEST,
+        J1939_SRV_PGN_TP_CM, J1939_SRV_PGN_TP_DT
+    };
+    uint8_t channel;
+
+    if (config == NULL || config->address >= J1939_SRV_ADDR_NULL ||
+        config->address_min > config->address_max || config->address_max >= J1939_SRV_ADDR_NULL) {
+        return J1939_SRV_INVALID_PARAM;
+    }
+
+    if (s_initialized) {
+        return J1939_SRV_ERROR;
+    }
+
+    s_config = *config;
+    s_address = config->address;
+    s_sub_count = 0;
+    s_rxq_head = 0;
+    s_rxq_tail = 0;
+    s_txq_head = 0;
+    s_txq_tail = 0;
+    s_tp_tx.state = J1939_SRV_TP_IDLE;
+    s_tp_rx.state = J1939_SRV_TP_IDLE;
+    memset(s_taken, 0, sizeof(s_taken));
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    /* Network management and transport, PF only */
+    for (uint8_t i = 0; i < sizeof(pgns) / sizeof(pgns[0]); i++) {
+        if (CAN_SRV_AddRxFilter(pgns[i] << 8, J1939_SRV_FILTER_PDU1_MASK, true) != CAN_SRV_SUCCESS) {
+            return J1939_SRV_NO_RESOURCE;
+        }
+    }
+
+    if (CAN_SRV_AllocTxMailbox(&s_tx_mb) != CAN_SRV_SUCCESS) {
+        return J1939_SRV_NO_RESOURCE;
+    }
+
+    if (CAN_SRV_RegisterCallback(J1939_SRV_CANCallback) != CAN_SRV_SUCCESS) {
+        return J1939_SRV_ERROR;
+    }
+
+    if (LPIT_SRV_Init() != LPIT_SRV_SUCCESS) {
+        return J1939_SRV_ERROR;
+    }
+
+    if (RES_SRV_Alloc(RES_SRV_LPIT_CHANNEL, RES_SRV_OWNER_SERVICE, &channel) != RES_SRV_SUCCESS) {
+        return J1939_SRV_NO_RESOURCE;
+    }
+
+    s_tick_lpit.channel = channel;
+    s_tick_lpit.period_us = J1939_SRV_TICK_MS * 1000U;
+    s_tick_lpit.is_running = false;
+
+    if (LPIT_SRV_Config(&s_tick_lpit, J1939_SRV_TickCallback) != LPIT_SRV_SUCCESS) {
+        RES_SRV_Release(RES_SRV_LPIT_CHANNEL, channel, RES_SRV_OWNER_SERVICE);
+        return J1939_SRV_ERROR;
+    }
+
+    NVIC_EnableInterrupt((IRQn_Type)(LPIT0_Ch0_IRQn + channel));
+    NVIC_SetPriority((IRQn_Type)(LPIT0_Ch0_IRQn + channel), J1939_SRV_TICK_IRQ_PRIO);
+    LPIT_SRV_Start(&s_tick_lpit);
+
+    s_initialized = true;
+
+    /* Claim right away, traffic starts 250 ms later */
+    s_addr_state = J1939_SRV_ADDR_CLAIMING;
+    s_claim_pending = true;
+    J1939_SRV_SendClaim();
+
+    return J1939_SRV_SUCCESS;
+}
+
+j1939_srv_status_t J1939_SRV_Subscribe(uint32_t pgn, j1939_srv_rx_callback_t callback)
+{
+    uint32_t id;
+    uint32_t mask;
+
+    if (!s_initialized) {
+        return J1939_SRV_NOT_INITIALIZED;
+    }
+
+    if (callback == NULL || pgn > 0x3FFFFUL) {
+        return J1939_SRV_INVALID_PARAM;
+    }
+
+    if (s_sub_count >= J1939_SRV_MAX_SUBSCRIPTIONS) {
+        return J1939_SRV_NO_RESOURCE;
+    }
+
+    /* PDU1: destination follows the claimed address, checked in Process */
+    if (((pgn >> 8) & 0xFFU) < J1939_SRV_PF_PDU2_MIN) {
+        pgn &= 0x3FF00UL;
+        mask = J1939_SRV_FILTER_PDU1_MASK;
+    } else {
+        mask = J1939_SRV_FILTER_PDU2_MASK;
+    }
+    id = pgn << 8;
+
+    if (CAN_SRV_AddRxFilter(id, mask, true) != CAN_SRV_SUCCESS) {
+        return J1939_SRV_NO_RESOURCE;
+    }
+
+    s_subs[s_sub_count].pgn = pgn;
+    s_subs[s_sub_count].callback = callback;
+    s_sub_count++;
+
+    return J1939_SRV_SUCCESS;
+}
+
+j1939_srv_status_t J1939_SRV_Send(uint8_t priority, uint32_t pgn, uint8_t da,
+                                  const uint8_t *data, uint16_t length)
+{
+    uint8_t packets;
+    j1939_srv_status_t status;
+
+    if (!s_initialized) {
+        return J1939_SRV_NOT_INITIALIZED;
+    }
+
+    if (priority > 7U || pgn > 0x3FFFFUL || length > J1939_SRV_TP_MAX_SIZE ||
+        (data == NULL && length != 0U)) {
+        return J1939_SRV_INVALID_PARAM;
+    }
+
+    if (s_addr_state != J1939_SRV_ADDR_CLAIMED) {
+        return J1939_SRV_NO_ADDRESS;
+    }
+
+    if (length <= 8U) {
+        return J1939_SRV_Queue(J1939_SRV_MakeId(priority, pgn, da, s_address), data, (uint8_t)length);
+    }
+
+    if (s_tp_tx.state != J1939_SRV_TP_IDLE) {
+        return J1939_SRV_BUSY;
+    }
+
+    packets = (uint8_t)((length + J1939_SRV_TP_BYTES - 1U) / J1939_SRV_TP_BYTES);
+
+    if (da == J1939_SRV_ADDR_GLOBAL) {
+        status = J1939_SRV_SendCm(da, J1939_SRV_TP_CM_BAM, (uint8_t)length, (uint8_t)(length >> 8),
+                                  packets, 0xFFU, pgn);
+    } else {
+        status = J1939_SRV_SendCm(da, J1939_SRV_TP_CM_RTS, (uint8_t)length, (uint8_t)(length >> 8),
+                                  packets, 0xFFU, pgn);
+    }
+
+    if (status != J1939_SRV_SUCCESS) {
+        return status;
+    }
+
+    memcpy(s_tp_tx.data, data, length);
+    s_tp_tx.pgn = pgn;
+    s_tp_tx.peer = da;
+    s_tp_tx.size = length;
+    s_tp_tx.packets = packets;
+    s_tp_tx.next = 1U;
+    s_tp_tx.last = packets;
+
+    if (da == J1939_SRV_ADDR_GLOBAL) {
+        s_tp_tx.state = J1939_SRV_TP_BAM;
+        s_tp_tx.deadline = s_now_ms + J1939_SRV_TP_BAM_GAP_MS;
+    } else {
+        s_tp_tx.state = J1939_SRV_TP_WAIT_CTS;
+        s_tp_tx.deadline = s_now_ms + J1939_SRV_TP_T3_MS;
+    }
+
+    return J1939_SRV_SUCCESS;
+}
+
+j1939_srv_status_t J1939_SRV_Request(uint32_t pgn, uint8_t da)
+{
+    uint8_t data[3];
+
+    if (!s_initialized) {
+        return J1939_SRV_NOT_INITIALIZED;
+    }
+
+    if (pgn > 0x3FFFFUL) {
+        return J1939_SRV_INVALID_PARAM;
+    }
+
+    /* Only the address claim may be requested before owning an address */
+    if (s_addr_state != J1939_SRV_ADDR_CLAIMED && pgn != J1939_SRV_PGN_ADDRESS_CLAIMED) {
+        return J1939_SRV_NO_ADDRESS;
+    }
+
+    J1939_SRV_PutPgn24(data, pgn);
+
+    return J1939_SRV_Queue(J1939_SRV_MakeId(J1939_SRV_PRIO_DEFAULT, J1939_SRV_PGN_REQUEST, da,
+                                            (s_addr_state == J1939_SRV_ADDR_CLAIMED) ?
+                                            s_address : J1939_SRV_ADDR_NULL),
+                           data, 3U);
+}
+
+void J1939_SRV_Process(void)
+{
+    const can_srv_message_t *msg;
+    j1939_srv_id_t id;
+
+    if (!s_initialized) {
+        return;
+    }
+
+    /* Received frames, in order */
+    while (s_rxq_tail != s_rxq_head) {
+        msg = &s_rxq[s_rxq_tail];
+        s_stats.rx_frames++;
+        J1939_SRV_ParseId(msg->id, &id);
+
+        switch (id.pgn) {
+            case J1939_SRV_PGN_ADDRESS_CLAIMED:
+                if (msg->dlc >= 8U) {
+                    J1939_SRV_HandleClaim(id.sa, msg->data);
+                }
+                break;
+
+            case J1939_SRV_PGN_REQUEST:
+                if (msg->dlc >= 3U) {
+                    J1939_SRV_HandleRequest(&id, msg->data);
+                }
+                break;
+
+            case J1939_SRV_PGN_TP_CM:
+                if (msg->dlc >= 8U && s_addr_state != J1939_SRV_ADDR_LOST) {
+                    J1939_SRV_HandleCm(&id, msg->data);
+                }
+                break;
+
+            case J1939_SRV_PGN_TP_DT:
+                if (msg->dlc >= 8U && s_addr_state != J1939_SRV_ADDR_LOST) {
+                    J1939_SRV_HandleDt(&id, msg->data);
+                }
+                break;
+
+            default:
+                if (J1939_SRV_IsForUs(id.da)) {
+                    J1939_SRV_Deliver(id.pgn, id.priority, id.sa, id.da, msg->data, msg->dlc);
+                }
+                break;
+        }
+
+        s_rxq_tail = (uint8_t)((s_rxq_tail + 1U) % J1939_SRV_RX_QUEUE_LEN);
+    }
+
+    /* Address claim */
+    if (s_claim_pending) {
+        J1939_SRV_SendClaim();
+    } else if (s_addr_state == J1939_SRV_ADDR_CLAIMING &&
+               J1939_SRV_Expired(s_claim_time + J1939_SRV_CLAIM_WAIT_MS)) {
+        J1939_SRV_SetAddrState(J1939_SRV_ADDR_CLAIMED);
+    }
+
+    /* Transport timers */
+    if (s_tp_rx.state != J1939_SRV_TP_IDLE && J1939_SRV_Expired(s_tp_rx.deadline)) {
+        J1939_SRV_RxAbort(J1939_SRV_ABORT_TIMEOUT);
+    }
+    J1939_SRV_RunTx();
+
+    J1939_SRV_FlushTx();
+}
+
+j1939_srv_addr_state_t J1939_SRV_GetAddress(uint8_t *address)
+{
+    if (address != NULL) {
+        *address = s_address;
+    }
+
+    return s_addr_state;
+}
+
+j1939_srv_status_t J1939_SRV_GetStats(j1939_srv_stats_t *stats)
+{
+    if (stats == NULL) {
+        return J1939_SRV_INVALID_PARAM;
+    }
+
+    if (!s_initialized) {
+        return J1939_SRV_NOT_INITIALIZED;
+    }
+
+    *stats = s_stats;
+
+    return J1939_SRV_SUCCESS;
+}
@@ -0,0 +1,266 @@
+/**
+ * @file    j1939_srv.h
+ * @brief   J1939 Service - Abstraction API
+ * @details
+ * SAE J1939 data link (J1939-21) and address management (J1939-81) on top
+ * of can_srv, using 29-bit identifiers:
+ * - Identifier helpers: priority, PGN, destination and source address
+ * - Address claim with NAME arbitration. An arbitrary-address-capable
+ *   NAME moves to the next free address in its range when it loses,
+ *   otherwise the node sends "cannot claim" and stays silent. Normal
+ *   traffic starts 250 ms after the claim.
+ * - Transport protocol for 9 to J1939_SRV_TP_MAX_SIZE bytes: BAM for
+ *   global destinations (50 ms between packets) and RTS/CTS (CMDT) for
+ *   a specific node, with the T1-T4/Tr timeouts and connection abort
+ *
+ * Reception is filtered by PGN in hardware: J1939_SRV_Subscribe() adds a
+ * FlexCAN mailbox filter on the PGN bits (priority and source address are
+ * don't care), so unrelated PGNs never raise an interrupt. PDU1 PGNs are
+ * filtered on PF only; the destination address is checked in software
+ * because it follows the claimed address.
+ *
+ * The CAN interrupt only queues matching frames. Protocol handling,
+ * timeouts and subscriber callbacks run in J1939_SRV_Process() from the
+ * main loop; a 5 ms LPIT tick provides the time base.
+ *
+ * One transport session per direction at a time: a second RTS is
+ * rejected with an abort, a second BAM while one is being received
+ * replaces it.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef J1939_SRV_H
+#define J1939_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Limits */
+#define J1939_SRV_MAX_SUBSCRIPTIONS     (8U)
+#define J1939_SRV_TP_MAX_SIZE           (256U)      /* J1939-21 allows 1785 */
+#define J1939_SRV_RX_QUEUE_LEN          (16U)       /* Frames between two Process passes */
+
+/** @brief Addresses */
+#define J1939_SRV_ADDR_GLOBAL           (0xFFU)
+#define J1939_SRV_ADDR_NULL             (0xFEU)     /* Source of "cannot claim" */
+
+/** @brief Priorities */
+#define J1939_SRV_PRIO_CONTROL          (3U)
+#define J1939_SRV_PRIO_DEFAULT          (6U)
+
+/** @brief Network management and transport PGNs */
+#define J1939_SRV_PGN_REQUEST           (0x0EA00UL)
+#define J1939_SRV_PGN_ADDRESS_CLAIMED   (0x0EE00UL)
+#define J1939_SRV_PGN_TP_CM             (0x0EC00UL)
+#define J1939_SRV_PGN_TP_DT             (0x0EB00UL)
+
+/** @brief NAME fields (64-bit, sent little-endian) */
+#define J1939_SRV_NAME_ARBITRARY_ADDRESS    (1ULL << 63)
+
+/** @brief Identifier layout */
+#define J1939_SRV_PF_PDU2_MIN           (240U)      /* PF >= 240: PS is a group extension */
+
+/**
+ * @brief J1939 service status codes
+ */
+typedef enum {
+    J1939_SRV_SUCCESS = 0,          /**< Operation successful */
+    J1939_SRV_ERROR,                /**< General error */
+    J1939_SRV_NOT_INITIALIZED,      /**< Service not initialized */
+    J1939_SRV_INVALID_PARAM,        /**< Invalid parameter */
+    J1939_SRV_NO_RESOURCE,          /**< No mailbox, filter or subscription left */
+    J1939_SRV_NO_ADDRESS,           /**< Address not claimed (yet) */
+    J1939_SRV_BUSY                  /**< TX queue full or transport session active */
+} j1939_srv_status_t;
+
+/**
+ * @brief Address claim state
+ */
+typedef enum {
+    J1939_SRV_ADDR_CLAIMING = 0,    /**< Claim sent, waiting 250 ms for contention */
+    J1939_SRV_ADDR_CLAIMED,         /**< Address owned, normal traffic allowed */
+    J1939_SRV_ADDR_LOST             /**< No address available, node is silent */
+} j1939_srv_addr_state_t;
+
+/**
+ * @brief Decoded identifier
+ */
+typedef struct {
+    uint8_t priority;
+    uint32_t pgn;                   /**< 18-bit PGN, PS cleared for PDU1 */
+    uint8_t da;                     /**< Destination, J1939_SRV_ADDR_GLOBAL for PDU2 */
+    uint8_t sa;
+} j1939_srv_id_t;
+
+/**
+ * @brief Received message (single frame or reassembled)
+ */
+typedef struct {
+    uint32_t pgn;
+    uint8_t priority;
+    uint8_t sa;
+    uint8_t da;
+    uint16_t length;
+    const uint8_t *data;            /**< Valid during the callback only */
+} j1939_srv_msg_t;
+
+/**
+ * @brief Message callback (main loop context)
+ */
+typedef void (*j1939_srv_rx_callback_t)(const j1939_srv_msg_t *msg);
+
+/**
+ * @brief Address claim result (main loop context)
+ */
+typedef void (*j1939_srv_addr_callback_t)(j1939_srv_addr_state_t state, uint8_t address);
+
+/**
+ * @brief Transport send finished (main loop context)
+ * @param status J1939_SRV_SUCCESS, or J1939_SRV_ERROR on abort/timeout
+ */
+typedef void (*j1939_srv_tx_callback_t)(uint32_t pgn, j1939_srv_status_t status);
+
+/**
+ * @brief Service configuration
+ */
+typedef struct {
+    uint64_t name;                  /**< NAME, lower value wins arbitration */
+    uint8_t address;                /**< Preferred source address */
+    uint8_t address_min;            /**< Self-configurable range (arbitrary address NAMEs) */
+    uint8_t address_max;
+    j1939_srv_addr_callback_t on_address;   /**< Optional, NULL allowed */
+    j1939_srv_tx_callback_t on_tx_done;     /**< Optional, NULL allowed */
+} j1939_srv_config_t;
+
+/**
+ * @brief Service statistics
+ */
+typedef struct {
+    uint32_t rx_frames;
+    uint32_t rx_overruns;           /**< Frames lost, Process called too rarely */
+    uint32_t tp_rx_done;
+    uint32_t tp_rx_aborted;
+    uint32_t tp_tx_done;
+    uint32_t tp_tx_aborted;
+    uint32_t claim_losses;
+} j1939_srv_stats_t;
+
+/*******************************************************************************
+ * Identifier helpers
+ ******************************************************************************/
+
+/**
+ * @brief Build a 29-bit identifier
+ * @param priority 0 (highest) - 7
+ * @param pgn Parameter group number
+ * @param da Destination (ignored for PDU2 PGNs)
+ * @param sa Source address
+ */
+static inline uint32_t J1939_SRV_MakeId(uint8_t priority, uint32_t pgn, uint8_t da, uint8_t sa)
+{
+    uint32_t id = ((uint32_t)(priority & 0x7U) << 26) | ((pgn & 0x3FFFFUL) << 8) | sa;
+
+    if (((pgn >> 8) & 0xFFU) < J1939_SRV_PF_PDU2_MIN) {
+        id = (id & ~0xFF00UL) | ((uint32_t)da << 8);
+    }
+
+    return id;
+}
+
+/**
+ * @brief Split a 29-bit identifier
+ */
+static inline void J1939_SRV_ParseId(uint32_t id, j1939_srv_id_t *out)
+{
+    uint8_t pf = (uint8_t)(id >> 16);
+
+    out->priority = (uint8_t)((id >> 26) & 0x7U);
+    out->sa = (uint8_t)id;
+
+    if (pf < J1939_SRV_PF_PDU2_MIN) {
+        out->pgn = (id >> 8) & 0x3FF00UL;
+        out->da = (uint8_t)(id >> 8);
+    } else {
+        out->pgn = (id >> 8) & 0x3FFFFUL;
+        out->da = J1939_SRV_ADDR_GLOBAL;
+    }
+}
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the service and start the address claim
+ * @details CAN_SRV_Init() (extended IDs, usually 250 Kbps) and
+ *          LPIT_SRV_Init() must have been called.
+ * @param config Configuration
+ * @return j1939_srv_status_t Status of initialization
+ */
+j1939_srv_status_t J1939_SRV_Init(const j1939_srv_config_t *config);
+
+/**
+ * @brief Receive a PGN
+ * @details Adds the hardware filter for the PGN. Transport sessions for
+ *          the PGN are reassembled and delivered the same way.
+ * @param pgn Parameter group number
+ * @param callback Called from J1939_SRV_Process()
+ * @return j1939_srv_status_t Status of operation
+ */
+j1939_srv_status_t J1939_SRV_Subscribe(uint32_t pgn, j1939_srv_rx_callback_t callback);
+
+/**
+ * @brief Send a parameter group
+ * @details Up to 8 bytes go out as one frame; longer data starts a BAM
+ *          (global destination) or CMDT session. The data is copied.
+ * @param priority 0-7
+ * @param pgn Parameter group number
+ * @param da Destination, J1939_SRV_ADDR_GLOBAL for broadcast
+ * @param data Payload
+ * @param length 0 - J1939_SRV_TP_MAX_SIZE bytes
+ * @return j1939_srv_status_t Status of operation
+ *         - J1939_SRV_NO_ADDRESS: Address not claimed yet
+ *         - J1939_SRV_BUSY: TX queue full or a session is active
+ */
+j1939_srv_status_t J1939_SRV_Send(uint8_t priority, uint32_t pgn, uint8_t da,
+                                  const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Request a PGN from a node (or all nodes)
+ * @param pgn Requested parameter group
+ * @param da Destination, J1939_SRV_ADDR_GLOBAL for all
+ * @return j1939_srv_status_t Status of operation
+ */
+j1939_srv_status_t J1939_SRV_Request(uint32_t pgn, uint8_t da);
+
+/**
+ * @brief Run the protocol: received frames, timers, transmission
+ * @details Call from the main loop at least every few milliseconds.
+ */
+void J1939_SRV_Process(void);
+
+/**
+ * @brief Get the address claim state
+ * @param address Current source address (may be NULL)
+ * @return j1939_srv_addr_state_t State
+ */
+j1939_srv_addr_state_t J1939_SRV_GetAddress(uint8_t *address);
+
+/**
+ * @brief Get service statistics
+ * @param stats Output
+ * @return j1939_srv_status_t Status of operation
+ */
+j1939_srv_status_t J1939_SRV_GetStats(j1939_srv_stats_t *stats);
+
+#endif /* J1939_SRV_H */
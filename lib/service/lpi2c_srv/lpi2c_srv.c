@@ -0,0 +1,616 @@
+/**
+ * @file    lpi2c_srv.c
+ * @brief   LPI2C Service Implementation
+ * @details Transaction queue executed from the LPI2C command FIFO
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpi2c_srv.h"
+#include "../clock_srv/clock_srv.h"
+#include "../res_srv/res_srv.h"
+#include "../port_srv/port_srv.h"
+#include "../gpio_srv/gpio_srv.h"
+#include "../../driver/lpi2c/lpi2c.h"
+#include "../../driver/dma/dma.h"
+#include "../../driver/nvic/nvic.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define LPI2C_SRV_IRQ_PRIORITY      (5U)            /* Below CAN */
+
+/** @brief Command words of one transaction: START(W), 2 register bytes,
+ *         payload, START(R), RECEIVE, STOP */
+#define LPI2C_SRV_MAX_CMDS          (LPI2C_SRV_MAX_WRITE + 6U)
+
+/** @brief Half SCL period of the GPIO recovery sequence (busy loop) */
+#define LPI2C_SRV_RECOVERY_DELAY    (200U)
+
+/** @brief Polls for the last byte of a DMA read after STOP */
+#define LPI2C_SRV_DRAIN_POLLS       (1000U)
+
+/** @brief Controller timeouts */
+#define LPI2C_SRV_PIN_LOW_US        (25000U)        /* SMBus clock low limit */
+#define LPI2C_SRV_BUS_IDLE_US       (100U)
+#define LPI2C_SRV_GLITCH_FILTER     (2U)
+
+#define LPI2C_SRV_ENTER_CRITICAL()  NVIC_DisableInterrupt(LPI2C0_Master_IRQn)
+#define LPI2C_SRV_EXIT_CRITICAL()   NVIC_EnableInterrupt(LPI2C0_Master_IRQn)
+
+/** @brief Interrupts enabled for every transaction */
+#define LPI2C_SRV_EVENT_IRQS        (LPI2C_MIER_SDIE_MASK | LPI2C_MIER_NDIE_MASK | \
+                                     LPI2C_MIER_ALIE_MASK | LPI2C_MIER_FEIE_MASK | \
+                                     LPI2C_MIER_PLTIE_MASK)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Queued transaction, compiled to command words at submit
+ */
+typedef struct {
+    uint32_t cmds[LPI2C_SRV_MAX_CMDS];
+    uint8_t cmd_count;
+    uint8_t address;
+    uint8_t *rx_data;
+    uint16_t rx_len;
+    lpi2c_srv_callback_t callback;
+    void *user;
+} lpi2c_srv_slot_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_lpi2c_initialized = false;
+static lpi2c_srv_config_t s_config;
+static uint32_t s_clock_hz;
+
+static lpi2c_srv_slot_t s_queue[LPI2C_SRV_QUEUE_DEPTH];
+static volatile uint8_t s_head = 0;
+static volatile uint8_t s_tail = 0;
+static volatile uint8_t s_count = 0;
+
+static volatile bool s_running = false;     /* s_queue[s_head] is on the bus */
+static volatile bool s_stopping = false;    /* STOP after an error in flight */
+static volatile bool s_recover_pending = false;
+
+/* FIFO service without DMA */
+static uint8_t s_cmd_index;
+static uint16_t s_rx_index;
+
+static bool s_use_dma = false;
+static uint8_t s_tx_channel;
+static uint8_t s_rx_channel;
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static lpi2c_srv_status_t LPI2C_SRV_InitMaster(void);
+static void LPI2C_SRV_SetPinMux(bool lpi2c);
+static void LPI2C_SRV_Delay(void);
+static bool LPI2C_SRV_ClockOutBus(void);
+static void LPI2C_SRV_StartNext(void);
+static void LPI2C_SRV_Complete(lpi2c_srv_status_t status);
+static void LPI2C_SRV_AbortHardware(void);
+static void LPI2C_SRV_PumpFifo(void);
+static void LPI2C_SRV_EventCallback(LPI2C_Type *instance, uint32_t flags, void *userData);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static lpi2c_srv_status_t LPI2C_SRV_InitMaster(void)
+{
+    lpi2c_master_config_t drv_cfg;
+
+    drv_cfg.baudrate = s_config.baudrate;
+    drv_cfg.glitch_filter = LPI2C_SRV_GLITCH_FILTER;
+    drv_cfg.pin_low_timeout_us = LPI2C_SRV_PIN_LOW_US;
+    drv_cfg.bus_idle_timeout_us = LPI2C_SRV_BUS_IDLE_US;
+
+    if (LPI2C_MasterInit(LPI2C0, &drv_cfg, s_clock_hz) != LPI2C_STATUS_SUCCESS) {
+        return LPI2C_SRV_INVALID_PARAM;
+    }
+
+    /* DMA: keep two command words queued; RX request on every byte */
+    LPI2C_SetFifoWatermarks(LPI2C0, 2U, 0U);
+    LPI2C_RegisterCallback(LPI2C0, LPI2C_SRV_EventCallback, NULL);
+    LPI2C_EnableInterrupts(LPI2C0, LPI2C_SRV_EVENT_IRQS);
+
+    return LPI2C_SRV_SUCCESS;
+}
+
+/**
+ * @brief Route SCL/SDA to LPI2C0 or to GPIO
+ * @details In GPIO mode SDA is an input and SCL drives high.
+ */
+static void LPI2C_SRV_SetPinMux(bool lpi2c)
+{
+    port_srv_pin_config_t port_cfg;
+
+    port_cfg.port = s_config.port;
+    port_cfg.mux = lpi2c ? (port_srv_mux_t)s_config.mux : PORT_SRV_MUX_GPIO;
+    port_cfg.pull = PORT_SRV_PULL_UP;
+    port_cfg.interrupt = PORT_SRV_INT_DISABLE;
+
+    port_cfg.pin = s_config.scl_pin;
+    PORT_SRV_ConfigPin(&port_cfg);
+    port_cfg.pin = s_config.sda_pin;
+    PORT_SRV_ConfigPin(&port_cfg);
+
+    if (!lpi2c) {
+        GPIO_SRV_Write(s_config.port, s_config.scl_pin, 1U);
+        GPIO_SRV_ConfigOutput(s_config.port, s_config.scl_pin);
+        GPIO_SRV_ConfigInput(s_config.port, s_config.sda_pin);
+    }
+}
+
+static void LPI2C_SRV_Delay(void)
+{
+    for (volatile uint32_t i = 0U; i < LPI2C_SRV_RECOVERY_DELAY; i++) { }
+}
+
+/**
+ * @brief Release a slave that holds SDA low (pins in GPIO mode)
+ * @details A slave interrupted mid-byte finishes it after at most 9 clocks
+ *          and lets SDA go on the ACK slot; a STOP then resets its state
+ *          machine.
+ * @return true if SDA is high afterwards
+ */
+static bool LPI2C_SRV_ClockOutBus(void)
+{
+    uint8_t port = s_config.port;
+
+    for (uint8_t pulse = 0U; pulse < 9U; pulse++) {
+        if (GPIO_SRV_Read(port, s_config.sda_pin) != 0U) {
+            break;
+        }
+        GPIO_SRV_Write(port, s_config.scl_pin, 0U);
+        LPI2C_SRV_Delay();
+        GPIO_SRV_Write(port, s_config.scl_pin, 1U);
+        LPI2C_SRV_Delay();
+    }
+
+    /* STOP: SDA low -> high while SCL is high */
+    GPIO_SRV_Write(port, s_config.scl_pin, 0U);
+    LPI2C_SRV_Delay();
+    GPIO_SRV_Write(port, s_config.sda_pin, 0U);
+    GPIO_SRV_ConfigOutput(port, s_config.sda_pin);
+    LPI2C_SRV_Delay();
+    GPIO_SRV_Write(port, s_config.scl_pin, 1U);
+    LPI2C_SRV_Delay();
+    GPIO_SRV_ConfigInput(port, s_config.sda_pin);
+    LPI2C_SRV_Delay();
+
+    return GPIO_SRV_Read(port, s_config.sda_pin) != 0U;
+}
+
+/**
+ * @brief Put the transaction at the head of the queue on the bus
+ * @note Interrupt context or LPI2C IRQ masked
+ */
+static void LPI2C_SRV_StartNext(void)
+{
+    lpi2c_srv_slot_t *slot;
+    dma_transfer_config_t xfer;
+
+    if (s_running || s_stopping || s_recover_pending || s_count == 0U) {
+        return;
+    }
+
+    slot = &s_queue[s_head];
+    s_running = true;
+
+    if (s_use_dma) {
+        /* Commands -> MTDR */
+        xfer.src_addr = (uint32_t)slot->cmds;
+        xfer.dst_addr = LPI2C_GetTxDataAddress(LPI2C0);
+        xfer.src_offset = 4;
+        xfer.dst_offset = 0;
+        xfer.src_size = DMA_TRANSFER_SIZE_4B;
+        xfer.dst_size = DMA_TRANSFER_SIZE_4B;
+        xfer.minor_bytes = 4U;
+        xfer.major_count = slot->cmd_count;
+        xfer.src_last_adjust = 0;
+        xfer.dst_last_adjust = 0;
+        xfer.int_major = false;
+        xfer.int_half = false;
+        xfer.disable_request = true;
+        DMA_ConfigTransfer(s_tx_channel, &xfer);
+
+        if (slot->rx_len > 0U) {
+            /* MRDR -> buffer */
+            xfer.src_addr = LPI2C_GetRxDataAddress(LPI2C0);
+            xfer.dst_addr = (uint32_t)slot->rx_data;
+            xfer.src_offset = 0;
+            xfer.dst_offset = 1;
+            xfer.src_size = DMA_TRANSFER_SIZE_1B;
+            xfer.dst_size = DMA_TRANSFER_SIZE_1B;
+            xfer.minor_bytes = 1U;
+            xfer.major_count = slot->rx_len;
+            DMA_ConfigTransfer(s_rx_channel, &xfer);
+            DMA_StartChannel(s_rx_channel);
+            LPI2C_EnableDma(LPI2C0, LPI2C_MDER_RDDE_MASK);
+        }
+
+        DMA_StartChannel(s_tx_channel);
+        LPI2C_EnableDma(LPI2C0, LPI2C_MDER_TDDE_MASK);
+    } else {
+        s_cmd_index = 0U;
+        s_rx_index = 0U;
+        LPI2C_SRV_PumpFifo();
+        LPI2C_EnableInterrupts(LPI2C0, LPI2C_MIER_TDIE_MASK |
+                               ((slot->rx_len > 0U) ? LPI2C_MIER_RDIE_MASK : 0U));
+    }
+}
+
+/**
+ * @brief Report the head transaction and drop it from the queue
+ */
+static void LPI2C_SRV_Complete(lpi2c_srv_status_t status)
+{
+    lpi2c_srv_slot_t *slot = &s_queue[s_head];
+    lpi2c_srv_callback_t callback = slot->callback;
+    uint8_t address = slot->address;
+    void *user = slot->user;
+
+    s_head = (uint8_t)((s_head + 1U) % LPI2C_SRV_QUEUE_DEPTH);
+    s_count--;
+    s_running = false;
+
+    if (callback != NULL) {
+        callback(address, status, user);
+    }
+}
+
+/**
+ * @brief Stop feeding the master and empty its FIFOs
+ */
+static void LPI2C_SRV_AbortHardware(void)
+{
+    if (s_use_dma) {
+        LPI2C_DisableDma(LPI2C0, LPI2C_MDER_TDDE_MASK | LPI2C_MDER_RDDE_MASK);
+        DMA_StopChannel(s_tx_channel);
+        DMA_StopChannel(s_rx_channel);
+        DMA_ClearStatus(s_tx_channel);
+        DMA_ClearStatus(s_rx_channel);
+    } else {
+        LPI2C_DisableInterrupts(LPI2C0, LPI2C_MIER_TDIE_MASK | LPI2C_MIER_RDIE_MASK);
+    }
+
+    LPI2C_FlushFifo(LPI2C0, true, true);
+}
+
+/**
+ * @brief Interrupt-driven FIFO service (no DMA)
+ */
+static void LPI2C_SRV_PumpFifo(void)
+{
+    lpi2c_srv_slot_t *slot = &s_queue[s_head];
+
+    while (s_rx_index < slot->rx_len && LPI2C_GetRxFifoCount(LPI2C0) > 0U) {
+        slot->rx_data[s_rx_index++] = LPI2C_ReadData(LPI2C0);
+    }
+
+    while (s_cmd_index < slot->cmd_count && LPI2C_GetTxFifoCount(LPI2C0) < LPI2C_FIFO_SIZE) {
+        LPI2C_WriteCommand(LPI2C0, slot->cmds[s_cmd_index++]);
+    }
+
+    if (s_cmd_index >= slot->cmd_count) {
+        LPI2C_DisableInterrupts(LPI2C0, LPI2C_MIER_TDIE_MASK);
+    }
+    if (s_rx_index >= slot->rx_len) {
+        LPI2C_DisableInterrupts(LPI2C0, LPI2C_MIER_RDIE_MASK);
+    }
+}
+
+/**
+ * @brief LPI2C0 master events
+ * @details The driver has already cleared SDF; error flags are cleared
+ *          here once the FIFOs are flushed so the master resumes with the
+ *          next transaction.
+ */
+static void LPI2C_SRV_EventCallback(LPI2C_Type *instance, uint32_t flags, void *userData)
+{
+    lpi2c_srv_status_t status;
+    uint32_t polls;
+
+    (void)userData;
+
+    if ((flags & LPI2C_MSR_ERROR_FLAGS) != 0U) {
+        if ((flags & LPI2C_MSR_PLTF_MASK) != 0U) {
+            status = LPI2C_SRV_BUS_STUCK;
+            s_recover_pending = true;
+        } else if ((flags & LPI2C_MSR_ALF_MASK) != 0U) {
+            status = LPI2C_SRV_ARBITRATION_LOST;
+        } else if ((flags & LPI2C_MSR_NDF_MASK) != 0U) {
+            status = LPI2C_SRV_NACK;
+        } else {
+            status = LPI2C_SRV_ERROR;
+        }
+
+        LPI2C_SRV_AbortHardware();
+        LPI2C_ClearStatusFlags(instance, LPI2C_MSR_ERROR_FLAGS | LPI2C_MSR_SDF_MASK);
+
+        /* Still holding the bus after a NACK: release it before the next
+           START. Its SDF restarts the queue. */
+        if (!s_recover_pending && (LPI2C_GetStatusFlags(instance) & LPI2C_MSR_MBF_MASK) != 0U) {
+            LPI2C_WriteCommand(instance, LPI2C_CMD_WORD(LPI2C_CMD_STOP, 0U));
+            s_stopping = true;
+        }
+
+        if (s_running) {
+            LPI2C_SRV_Complete(status);
+        }
+        LPI2C_SRV_StartNext();
+        return;
+    }
+
+    if (!s_use_dma && s_running) {
+        LPI2C_SRV_PumpFifo();
+    }
+
+    if ((flags & LPI2C_MSR_SDF_MASK) != 0U) {
+        if (s_stopping) {
+            s_stopping = false;
+        } else if (s_running) {
+            if (s_use_dma) {
+                /* The last byte is in MRDR before STOP; give the DMA time
+                   to move it */
+                polls = LPI2C_SRV_DRAIN_POLLS;
+                if (s_queue[s_head].rx_len > 0U) {
+                    while (!DMA_IsDone(s_rx_channel) && --polls > 0U) { }
+                }
+                LPI2C_SRV_AbortHardware();
+                status = (polls > 0U) ? LPI2C_SRV_SUCCESS : LPI2C_SRV_ERROR;
+            } else {
+                status = (s_rx_index >= s_queue[s_head].rx_len) ? LPI2C_SRV_SUCCESS : LPI2C_SRV_ERROR;
+                LPI2C_SRV_AbortHardware();
+            }
+            LPI2C_SRV_Complete(status);
+        }
+        LPI2C_SRV_StartNext();
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+lpi2c_srv_status_t LPI2C_SRV_Init(const lpi2c_srv_config_t *config)
+{
+    lpi2c_srv_status_t status;
+
+    if (config == NULL || config->baudrate == 0U || config->port > 4U) {
+        return LPI2C_SRV_INVALID_PARAM;
+    }
+
+    if (s_lpi2c_initialized) {
+        LPI2C_SRV_Deinit();
+    }
+
+    if (CLOCK_SRV_EnablePeripheral(CLOCK_SRV_LPI2C0, CLOCK_SRV_PCS_SOSCDIV2) != CLOCK_SRV_SUCCESS) {
+        return LPI2C_SRV_ERROR;
+    }
+
+    s_config = *config;
+    s_clock_hz = CLOCK_SRV_GetPeripheralClock(CLOCK_SRV_LPI2C0);
+    s_head = 0U;
+    s_tail = 0U;
+    s_count = 0U;
+    s_running = false;
+    s_stopping = false;
+    s_recover_pending = false;
+
+    /* A slave reset mid-read may still hold SDA */
+    LPI2C_SRV_SetPinMux(false);
+    if (GPIO_SRV_Read(s_config.port, s_config.sda_pin) == 0U) {
+        (void)LPI2C_SRV_ClockOutBus();
+    }
+    LPI2C_SRV_SetPinMux(true);
+
+    status = LPI2C_SRV_InitMaster();
+    if (status != LPI2C_SRV_SUCCESS) {
+        return status;
+    }
+
+    /* DMA when two channels are free, interrupt-driven FIFOs otherwise */
+    s_use_dma = false;
+    if (config->use_dma &&
+        CLOCK_SRV_EnablePeripheral(CLOCK_SRV_DMAMUX, CLOCK_SRV_PCS_NONE) == CLOCK_SRV_SUCCESS &&
+        RES_SRV_Alloc(RES_SRV_DMA_CHANNEL, RES_SRV_OWNER_SERVICE, &s_tx_channel) == RES_SRV_SUCCESS) {
+        if (RES_SRV_Alloc(RES_SRV_DMA_CHANNEL, RES_SRV_OWNER_SERVICE, &s_rx_channel) == RES_SRV_SUCCESS) {
+            DMA_Init();
+            DMA_SetRequestSource(s_tx_channel, DMA_REQ_LPI2C0_TX, false);
+            DMA_SetRequestSource(s_rx_channel, DMA_REQ_LPI2C0_RX, false);
+            s_use_dma = true;
+        } else {
+            RES_SRV_Release(RES_SRV_DMA_CHANNEL, s_tx_channel, RES_SRV_OWNER_SERVICE);
+        }
+    }
+
+    NVIC_SetPriority(LPI2C0_Master_IRQn, LPI2C_SRV_IRQ_PRIORITY);
+    NVIC_EnableInterrupt(LPI2C0_Master_IRQn);
+
+    s_lpi2c_initialized = true;
+
+    return LPI2C_SRV_SUCCESS;
+}
+
+void LPI2C_SRV_Deinit(void)
+{
+    if (!s_lpi2c_initialized) {
+        return;
+    }
+
+    NVIC_DisableInterrupt(LPI2C0_Master_IRQn);
+    LPI2C_SRV_AbortHardware();
+    LPI2C_MasterDeinit(LPI2C0);
+
+    while (s_count > 0U) {
+        LPI2C_SRV_Complete(LPI2C_SRV_ABORTED);
+    }
+
+    if (s_use_dma) {
+        DMA_SetRequestSource(s_tx_channel, DMA_REQ_DISABLED, false);
+        DMA_SetRequestSource(s_rx_channel, DMA_REQ_DISABLED, false);
+        RES_SRV_Release(RES_SRV_DMA_CHANNEL, s_tx_channel, RES_SRV_OWNER_SERVICE);
+        RES_SRV_Release(RES_SRV_DMA_CHANNEL, s_rx_channel, RES_SRV_OWNER_SERVICE);
+        s_use_dma = false;
+    }
+
+    CLOCK_SRV_DisablePeripheral(CLOCK_SRV_LPI2C0);
+    s_lpi2c_initialized = false;
+}
+
+lpi2c_srv_status_t LPI2C_SRV_Submit(const lpi2c_srv_transfer_t *transfer)
+{
+    lpi2c_srv_slot_t *slot;
+    uint8_t n = 0;
+
+    if (transfer == NULL || transfer->address > 0x7FU || transfer->reg_len > 2U ||
+        transfer->tx_len > LPI2C_SRV_MAX_WRITE || transfer->rx_len > LPI2C_SRV_MAX_READ ||
+        (transfer->tx_len > 0U && transfer->tx_data == NULL) ||
+        (transfer->rx_len > 0U && transfer->rx_data == NULL)) {
+        return LPI2C_SRV_INVALID_PARAM;
+    }
+
+    if (!s_lpi2c_initialized) {
+        return LPI2C_SRV_NOT_INITIALIZED;
+    }
+
+    if (s_count >= LPI2C_SRV_QUEUE_DEPTH) {
+        return LPI2C_SRV_QUEUE_FULL;
+    }
+
+    /* Only the main loop submits, so the tail slot is ours until s_count
+       is incremented below */
+    slot = &s_queue[s_tail];
+
+    if (transfer->reg_len > 0U || transfer->tx_len > 0U || transfer->rx_len == 0U) {
+        slot->cmds[n++] = LPI2C_CMD_WORD(LPI2C_CMD_START, LPI2C_ADDR_WRITE(transfer->address));
+        if (transfer->reg_len == 2U) {
+            slot->cmds[n++] = LPI2C_CMD_WORD(LPI2C_CMD_TRANSMIT, transfer->reg >> 8);
+        }
+        if (transfer->reg_len > 0U) {
+            slot->cmds[n++] = LPI2C_CMD_WORD(LPI2C_CMD_TRANSMIT, transfer->reg);
+        }
+        for (uint8_t i = 0U; i < transfer->tx_len; i++) {
+            slot->cmds[n++] = LPI2C_CMD_WORD(LPI2C_CMD_TRANSMIT, transfer->tx_data[i]);
+        }
+    }
+
+    if (transfer->rx_len > 0U) {
+        /* Repeated START when a write phase precedes the read */
+        slot->cmds[n++] = LPI2C_CMD_WORD(LPI2C_CMD_START, LPI2C_ADDR_READ(transfer->address));
+        slot->cmds[n++] = LPI2C_CMD_WORD(LPI2C_CMD_RECEIVE, transfer->rx_len - 1U);
+    }
+
+    slot->cmds[n++] = LPI2C_CMD_WORD(LPI2C_CMD_STOP, 0U);
+
+    slot->cmd_count = n;
+    slot->address = transfer->address;
+    slot->rx_data = transfer->rx_data;
+    slot->rx_len = transfer->rx_len;
+    slot->callback = transfer->callback;
+    slot->user = transfer->user;
+
+    LPI2C_SRV_ENTER_CRITICAL();
+    s_tail = (uint8_t)((s_tail + 1U) % LPI2C_SRV_QUEUE_DEPTH);
+    s_count++;
+    LPI2C_SRV_StartNext();
+    LPI2C_SRV_EXIT_CRITICAL();
+
+    return LPI2C_SRV_SUCCESS;
+}
+
+lpi2c_srv_status_t LPI2C_SRV_ReadRegs(uint8_t address, uint8_t reg, uint8_t *data, uint16_t length,
+                                      lpi2c_srv_callback_t callback, void *user)
+{
+    lpi2c_srv_transfer_t transfer;
+
+    if (length == 0U) {
+        return LPI2C_SRV_INVALID_PARAM;
+    }
+
+    memset(&transfer, 0, sizeof(transfer));
+    transfer.address = address;
+    transfer.reg = reg;
+    transfer.reg_len = 1U;
+    transfer.rx_data = data;
+    transfer.rx_len = length;
+    transfer.callback = callback;
+    transfer.user = user;
+
+    return LPI2C_SRV_Submit(&transfer);
+}
+
+lpi2c_srv_status_t LPI2C_SRV_WriteRegs(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t length,
+                                       lpi2c_srv_callback_t callback, void *user)
+{
+    lpi2c_srv_transfer_t transfer;
+
+    memset(&transfer, 0, sizeof(transfer));
+    transfer.address = address;
+    transfer.reg = reg;
+    transfer.reg_len = 1U;
+    transfer.tx_data = data;
+    transfer.tx_len = length;
+    transfer.callback = callback;
+    transfer.user = user;
+
+    return LPI2C_SRV_Submit(&transfer);
+}
+
+void LPI2C_SRV_Process(void)
+{
+    if (s_lpi2c_initialized && s_recover_pending) {
+        (void)LPI2C_SRV_RecoverBus();
+    }
+}
+
+lpi2c_srv_status_t LPI2C_SRV_RecoverBus(void)
+{
+    bool released;
+
+    if (!s_lpi2c_initialized) {
+        return LPI2C_SRV_NOT_INITIALIZED;
+    }
+
+    LPI2C_SRV_ENTER_CRITICAL();
+
+    LPI2C_SRV_AbortHardware();
+    if (s_running) {
+        LPI2C_SRV_Complete(LPI2C_SRV_ABORTED);
+    }
+    LPI2C_MasterEnable(LPI2C0, false);
+
+    LPI2C_SRV_SetPinMux(false);
+    released = LPI2C_SRV_ClockOutBus();
+    LPI2C_SRV_SetPinMux(true);
+
+    /* Reset clears MSR and the FIFOs; interrupts and watermarks return */
+    (void)LPI2C_SRV_InitMaster();
+
+    s_stopping = false;
+    s_recover_pending = !released;
+    LPI2C_SRV_StartNext();
+
+    LPI2C_SRV_EXIT_CRITICAL();
+
+    return released ? LPI2C_SRV_SUCCESS : LPI2C_SRV_BUS_STUCK;
+}
+
+uint8_t LPI2C_SRV_GetPending(void)
+{
+    return s_count;
+}
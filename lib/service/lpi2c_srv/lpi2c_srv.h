@@ -0,0 +1,168 @@
+/**
+ * @file    lpi2c_srv.h
+ * @brief   LPI2C Service - Abstraction API
+ * @details
+ * Non-blocking I2C master for register-based sensors on LPI2C0.
+ *
+ * Features:
+ * - Transaction queue: register reads (write register address, repeated
+ *   START, read N bytes) and register writes are submitted from the main
+ *   loop and return immediately
+ * - Each transaction is compiled into LPI2C command words at submit time;
+ *   the hardware executes them from its command FIFO
+ * - DMA feeds the command FIFO and drains the receive FIFO; without free
+ *   DMA channels the FIFOs are serviced from the LPI2C interrupt
+ * - Completion (STOP detected) or failure (NACK, arbitration lost, pin
+ *   low timeout) is reported per transaction through its callback, and
+ *   the next queued transaction starts from the interrupt
+ * - Bus recovery: a stuck bus (SDA held low by a slave) is released by
+ *   clocking SCL up to 9 times and generating a STOP by GPIO
+ *
+ * The CPU only touches the bus at submit and completion, so polling
+ * several sensors per cycle does not delay CAN processing.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LPI2C_SRV_H
+#define LPI2C_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Queued transactions */
+#ifndef LPI2C_SRV_QUEUE_DEPTH
+#define LPI2C_SRV_QUEUE_DEPTH       (8U)
+#endif
+
+/** @brief Largest write payload (bytes after the register address) */
+#ifndef LPI2C_SRV_MAX_WRITE
+#define LPI2C_SRV_MAX_WRITE         (16U)
+#endif
+
+/** @brief Largest read */
+#define LPI2C_SRV_MAX_READ          (256U)
+
+/**
+ * @brief LPI2C service status codes
+ */
+typedef enum {
+    LPI2C_SRV_SUCCESS = 0,
+    LPI2C_SRV_ERROR,
+    LPI2C_SRV_NOT_INITIALIZED,
+    LPI2C_SRV_INVALID_PARAM,
+    LPI2C_SRV_QUEUE_FULL,           /**< No free queue slot */
+    LPI2C_SRV_NACK,                 /**< Address or data not acknowledged */
+    LPI2C_SRV_ARBITRATION_LOST,     /**< Another master took the bus */
+    LPI2C_SRV_BUS_STUCK,            /**< Pin low timeout, recovery scheduled */
+    LPI2C_SRV_ABORTED               /**< Dropped by LPI2C_SRV_Deinit() or recovery */
+} lpi2c_srv_status_t;
+
+/**
+ * @brief Transaction completion callback (interrupt context)
+ * @param address 7-bit slave address of the transaction
+ * @param status LPI2C_SRV_SUCCESS or the failure reason
+ * @param user Parameter given at submit
+ */
+typedef void (*lpi2c_srv_callback_t)(uint8_t address, lpi2c_srv_status_t status, void *user);
+
+/**
+ * @brief Transaction descriptor
+ * @details Phases, each optional: START + address(W), register address
+ *          (reg_len bytes, MSB first), tx_len data bytes, repeated START +
+ *          address(R), rx_len data bytes, STOP.
+ */
+typedef struct {
+    uint8_t address;                /**< 7-bit slave address */
+    uint16_t reg;                   /**< Register address */
+    uint8_t reg_len;                /**< Register address bytes (0-2) */
+    const uint8_t *tx_data;         /**< Write payload (copied at submit) */
+    uint8_t tx_len;                 /**< Write payload length */
+    uint8_t *rx_data;               /**< Read buffer (must stay valid) */
+    uint16_t rx_len;                /**< Read length */
+    lpi2c_srv_callback_t callback;  /**< Completion callback, may be NULL */
+    void *user;                     /**< Callback parameter */
+} lpi2c_srv_transfer_t;
+
+/**
+ * @brief Service configuration
+ */
+typedef struct {
+    uint32_t baudrate;              /**< SCL in Hz */
+    uint8_t port;                   /**< Port of SCL/SDA (0 = A ... 4 = E) */
+    uint8_t scl_pin;                /**< SCL pin */
+    uint8_t sda_pin;                /**< SDA pin */
+    uint8_t mux;                    /**< LPI2C alternative of both pins (port_srv_mux_t) */
+    bool use_dma;                   /**< Feed FIFOs by DMA when channels are free */
+} lpi2c_srv_config_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the I2C master
+ * @details Clocks LPI2C0 from SOSCDIV2, muxes the pins, recovers the bus
+ *          if SDA is held low and enables the master interrupt.
+ *          PORT_SRV_Init() and GPIO_SRV_Init() must have been called.
+ * @param config Configuration
+ * @return lpi2c_srv_status_t Status of initialization
+ */
+lpi2c_srv_status_t LPI2C_SRV_Init(const lpi2c_srv_config_t *config);
+
+/**
+ * @brief Abort queued transactions and disable the master
+ */
+void LPI2C_SRV_Deinit(void);
+
+/**
+ * @brief Queue a transaction
+ * @param transfer Descriptor (copied)
+ * @return lpi2c_srv_status_t LPI2C_SRV_QUEUE_FULL if no slot is free
+ */
+lpi2c_srv_status_t LPI2C_SRV_Submit(const lpi2c_srv_transfer_t *transfer);
+
+/**
+ * @brief Queue a register read (8-bit register address)
+ */
+lpi2c_srv_status_t LPI2C_SRV_ReadRegs(uint8_t address, uint8_t reg, uint8_t *data, uint16_t length,
+                                      lpi2c_srv_callback_t callback, void *user);
+
+/**
+ * @brief Queue a register write (8-bit register address)
+ */
+lpi2c_srv_status_t LPI2C_SRV_WriteRegs(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t length,
+                                       lpi2c_srv_callback_t callback, void *user);
+
+/**
+ * @brief Run deferred bus recovery
+ * @details Call from the main loop. After a pin low timeout the queue is
+ *          paused until the bus has been recovered here.
+ */
+void LPI2C_SRV_Process(void);
+
+/**
+ * @brief Recover the bus now
+ * @details Aborts the running transaction, bit-bangs up to 9 SCL pulses
+ *          until SDA is released, generates a STOP and re-initializes the
+ *          master. Queued transactions continue afterwards.
+ * @return lpi2c_srv_status_t LPI2C_SRV_BUS_STUCK if SDA stays low
+ */
+lpi2c_srv_status_t LPI2C_SRV_RecoverBus(void);
+
+/**
+ * @brief Number of queued transactions (including the running one)
+ * @return uint8_t Pending transactions
+ */
+uint8_t LPI2C_SRV_GetPending(void);
+
+#endif /* LPI2C_SRV_H */
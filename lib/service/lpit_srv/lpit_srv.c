@@ -13,6 +13,13 @@
  ******************************************************************************/
 #include "lpit_srv.h"
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* FIRC DIV2 = 24 MHz */
+#define LPIT_SRV_TICKS_PER_US       (24U)
+#define LPIT_SRV_MAX_PERIOD_US      (0xFFFFFFFFU / LPIT_SRV_TICKS_PER_US)
+
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
@@ -23,6 +30,19 @@ static p_lpit_callback_t g_lpit_callbacks[4] = {NULL, NULL, NULL, NULL};
  * Private Functions
  ******************************************************************************/
 
+/**
+ * @brief Timer ticks of one period (the channel reloads TVAL = ticks - 1)
+ * @return 0 if the period is 0 or does not fit the 32-bit timer
+ */
+static inline uint32_t LPIT_SRV_PeriodToTicks(uint32_t period_us)
+{
+    if (period_us == 0U || period_us > LPIT_SRV_MAX_PERIOD_US) {
+        return 0U;
+    }
+
+    return period_us * LPIT_SRV_TICKS_PER_US;
+}
+
 /**
  * @brief LPIT Channel 0 Interrupt Handler.
  *
@@ -37,7 +57,7 @@ void LPIT0_Ch0_IRQHandler(void)
     {
         g_lpit_callbacks[0]();	/**< Invoke callback for channel 0 */
     }
-    LPIT0->MSR |= LPIT_MSR_TIF0_MASK; /**< Clear interrupt flag */
+    LPIT0->MSR = LPIT_MSR_TIF0_MASK;  /**< Clear interrupt flag (W1C, others untouched) */
 }
 
 /**
@@ -52,7 +72,7 @@ void LPIT0_Ch1_IRQHandler(void)
     {
         g_lpit_callbacks[1]();	/**< Invoke callback for channel 1 */
     }
-    LPIT0->MSR |= LPIT_MSR_TIF1_MASK;  /**< Clear interrupt flag */
+    LPIT0->MSR = LPIT_MSR_TIF1_MASK;  /**< Clear interrupt flag (W1C, others untouched) */
 }
 
 /**
@@ -67,7 +87,7 @@ void LPIT0_Ch2_IRQHandler(void)
     {
         g_lpit_callbacks[2]();	/**< Invoke callback for channel 2 */
     }
-    LPIT0->MSR |= LPIT_MSR_TIF2_MASK; /**< Clear interrupt flag */
+    LPIT0->MSR = LPIT_MSR_TIF2_MASK;  /**< Clear interrupt flag (W1C, others untouched) */
 }
 
 /**
@@ -82,7 +102,7 @@ void LPIT0_Ch3_IRQHandler(void)
     {
         g_lpit_callbacks[3]();	/**< Invoke callback for channel 3 */
     }
-    LPIT0->MSR |= LPIT_MSR_TIF3_MASK;  /**< Clear interrupt flag */
+    LPIT0->MSR = LPIT_MSR_TIF3_MASK;  /**< Clear interrupt flag (W1C, others untouched) */
 }
 
 /*******************************************************************************
@@ -101,7 +121,8 @@ lpit_srv_status_t LPIT_SRV_Config(lpit_srv_config_t *config, p_lpit_callback_t c
         return LPIT_SRV_NOT_INITIALIZED;
     }
     
-    if (config == NULL || config->channel > 3) {
+    if (config == NULL || config->channel > 3 ||
+        LPIT_SRV_PeriodToTicks(config->period_us) == 0U) {
         return LPIT_SRV_ERROR;
     }
     
@@ -113,9 +134,8 @@ lpit_srv_status_t LPIT_SRV_Config(lpit_srv_config_t *config, p_lpit_callback_t c
     lpit_cfg.source = LPIT_FIRCDIV2_CLK_SOURCE; /* Use FIRC DIV2 as clock source */
     lpit_cfg.channel = (lpit_channel_t)config->channel;
     
-    /* Calculate timer value from period_us */
-    /* Assuming 48MHz FIRC, DIV2 = 24MHz, 1us = 24 ticks */
-    lpit_cfg.value = config->period_us * 24U;
+    /* Ticks per period; LPIT_ConfigValue() loads TVAL = value - 1 */
+    lpit_cfg.value = LPIT_SRV_PeriodToTicks(config->period_us);
     
     /* Set callback */
     lpit_cfg.func_callback = callback;
@@ -162,3 +182,26 @@ lpit_srv_status_t LPIT_SRV_Stop(lpit_srv_config_t *config)
 
     return LPIT_SRV_SUCCESS;
 }
+
+lpit_srv_status_t LPIT_SRV_SetPeriod(lpit_srv_config_t *config, uint32_t period_us)
+{
+    lpit_config_value_t lpit_cfg;
+    uint32_t ticks = LPIT_SRV_PeriodToTicks(period_us);
+    
+    if (!s_lpit_initialized) {
+        return LPIT_SRV_NOT_INITIALIZED;
+    }
+    
+    if (config == NULL || config->channel > 3 || ticks == 0U) {
+        return LPIT_SRV_ERROR;
+    }
+    
+    /* Same TVAL as LPIT_SRV_Config(); written while running, it is loaded
+       at the next timeout */
+    lpit_cfg.channel = (lpit_channel_t)config->channel;
+    LPIT0_SetValue(&lpit_cfg, ticks - 1U);
+    
+    config->period_us = period_us;
+    
+    return LPIT_SRV_SUCCESS;
+}
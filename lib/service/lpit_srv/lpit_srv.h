@@ -79,4 +79,16 @@ lpit_srv_status_t LPIT_SRV_Start(lpit_srv_config_t *config);
  */
 lpit_srv_status_t LPIT_SRV_Stop(lpit_srv_config_t *config);
 
+/**
+ * @brief Change the period without stopping the timer
+ * @details The running period completes with the old value and the next
+ *          one uses the new value, so a trigger train changes rate
+ *          without a gap or a restart. On a stopped channel the value
+ *          applies on the next LPIT_SRV_Start().
+ * @param config Pointer to LPIT configuration structure (period_us updated)
+ * @param period_us New period in microseconds (1 us to about 178 s)
+ * @return lpit_srv_status_t Status of operation
+ */
+lpit_srv_status_t LPIT_SRV_SetPeriod(lpit_srv_config_t *config, uint32_t period_us);
+
 #endif /* LPIT_SRV_H */
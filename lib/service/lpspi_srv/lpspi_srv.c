@@ -0,0 +1,420 @@
+/**
+ * @file    lpspi_srv.c
+ * @brief   LPSPI Service Implementation
+ * @details Blocking FIFO transfers and DMA ping-pong sample streams
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpspi_srv.h"
+#include "../clock_srv/clock_srv.h"
+#include "../res_srv/res_srv.h"
+#include "../../driver/lpspi/lpspi.h"
+#include "../../driver/dma/dma.h"
+#include "../../driver/nvic/nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define LPSPI_SRV_DMA_IRQ_PRIORITY  (4U)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Per-instance stream state
+ */
+typedef struct {
+    dma_tcd_t rx_tcd[2];            /**< Scatter/gather ring (first: 32-byte aligned) */
+    uint32_t command;               /**< TX DMA source */
+    uint16_t *buffer[2];
+    uint16_t samples;
+    uint8_t next_buffer;            /**< Buffer the RX DMA completes next */
+    uint8_t tx_channel;
+    uint8_t rx_channel;
+    volatile bool active;
+    volatile uint32_t count;
+    lpspi_srv_stream_callback_t callback;
+} lpspi_srv_stream_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static LPSPI_Type * const s_lpspi_bases[LPSPI_SRV_INSTANCE_COUNT] = { LPSPI0, LPSPI1, LPSPI2 };
+
+static const clock_srv_peripheral_t s_lpspi_clocks[LPSPI_SRV_INSTANCE_COUNT] = {
+    CLOCK_SRV_LPSPI0, CLOCK_SRV_LPSPI1, CLOCK_SRV_LPSPI2
+};
+
+static bool s_lpspi_initialized[LPSPI_SRV_INSTANCE_COUNT] = { false };
+static uint8_t s_frame_bytes[LPSPI_SRV_INSTANCE_COUNT];
+static lpspi_srv_stream_t s_stream[LPSPI_SRV_INSTANCE_COUNT];
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static void LPSPI_SRV_DmaCallback(uint8_t channel, dma_event_t event, void *param);
+static lpspi_srv_status_t LPSPI_SRV_AllocChannels(lpspi_srv_stream_t *stream);
+static void LPSPI_SRV_ReleaseChannels(lpspi_srv_stream_t *stream);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief RX DMA major loop complete: one buffer full
+ */
+static void LPSPI_SRV_DmaCallback(uint8_t channel, dma_event_t event, void *param)
+{
+    lpspi_srv_instance_t instance = (lpspi_srv_instance_t)(uint32_t)param;
+    lpspi_srv_stream_t *stream = &s_stream[instance];
+    const uint16_t *filled;
+
+    (void)channel;
+
+    /* On errors the driver has already stopped the channel; the stream
+       stays stalled until LPSPI_SRV_StopStream() */
+    if (event != DMA_EVENT_COMPLETE) {
+        return;
+    }
+
+    /* The ring has already moved on to the other buffer */
+    filled = stream->buffer[stream->next_buffer];
+    stream->next_buffer ^= 1U;
+    stream->count++;
+
+    if (stream->callback != NULL) {
+        stream->callback(instance, filled, stream->samples);
+    }
+}
+
+static lpspi_srv_status_t LPSPI_SRV_AllocChannels(lpspi_srv_stream_t *stream)
+{
+    if (RES_SRV_Alloc(RES_SRV_DMA_CHANNEL, RES_SRV_OWNER_SERVICE, &stream->rx_channel) != RES_SRV_SUCCESS) {
+        return LPSPI_SRV_NO_RESOURCE;
+    }
+
+    if (RES_SRV_Alloc(RES_SRV_DMA_CHANNEL, RES_SRV_OWNER_SERVICE, &stream->tx_channel) != RES_SRV_SUCCESS) {
+        RES_SRV_Release(RES_SRV_DMA_CHANNEL, stream->rx_channel, RES_SRV_OWNER_SERVICE);
+        return LPSPI_SRV_NO_RESOURCE;
+    }
+
+    return LPSPI_SRV_SUCCESS;
+}
+
+static void LPSPI_SRV_ReleaseChannels(lpspi_srv_stream_t *stream)
+{
+    RES_SRV_Release(RES_SRV_DMA_CHANNEL, stream->rx_channel, RES_SRV_OWNER_SERVICE);
+    RES_SRV_Release(RES_SRV_DMA_CHANNEL, stream->tx_channel, RES_SRV_OWNER_SERVICE);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+lpspi_srv_status_t LPSPI_SRV_Init(lpspi_srv_instance_t instance, const lpspi_srv_config_t *config)
+{
+    lpspi_master_config_t drv_cfg;
+    uint32_t clock_hz;
+
+    if (instance >= LPSPI_SRV_INSTANCE_COUNT || config == NULL || config->pcs > 3U) {
+        return LPSPI_SRV_INVALID_PARAM;
+    }
+
+    if (s_stream[instance].active) {
+        return LPSPI_SRV_BUSY;
+    }
+
+    if (CLOCK_SRV_EnablePeripheral(s_lpspi_clocks[instance], CLOCK_SRV_PCS_SOSCDIV2) != CLOCK_SRV_SUCCESS) {
+        return LPSPI_SRV_ERROR;
+    }
+
+    clock_hz = CLOCK_SRV_GetPeripheralClock(s_lpspi_clocks[instance]);
+
+    drv_cfg.baudrate = config->baudrate;
+    drv_cfg.frame_bits = config->frame_bits;
+    drv_cfg.cpol = (config->mode == LPSPI_SRV_MODE_2 || config->mode == LPSPI_SRV_MODE_3);
+    drv_cfg.cpha = (config->mode == LPSPI_SRV_MODE_1 || config->mode == LPSPI_SRV_MODE_3);
+    drv_cfg.lsb_first = config->lsb_first;
+    drv_cfg.pcs = (lpspi_pcs_t)config->pcs;
+    drv_cfg.pcs_active_high = config->pcs_active_high;
+
+    if (LPSPI_MasterInit(s_lpspi_bases[instance], &drv_cfg, clock_hz) != LPSPI_STATUS_SUCCESS) {
+        return LPSPI_SRV_INVALID_PARAM;
+    }
+
+    s_frame_bytes[instance] = (config->frame_bits <= 8U) ? 1U : ((config->frame_bits <= 16U) ? 2U : 4U);
+    s_lpspi_initialized[instance] = true;
+
+    return LPSPI_SRV_SUCCESS;
+}
+
+void LPSPI_SRV_Deinit(lpspi_srv_instance_t instance)
+{
+    if (instance >= LPSPI_SRV_INSTANCE_COUNT || !s_lpspi_initialized[instance]) {
+        return;
+    }
+
+    LPSPI_SRV_StopStream(instance);
+    LPSPI_Deinit(s_lpspi_bases[instance]);
+    CLOCK_SRV_DisablePeripheral(s_lpspi_clocks[instance]);
+    s_lpspi_initialized[instance] = false;
+}
+
+lpspi_srv_status_t LPSPI_SRV_Transfer(lpspi_srv_instance_t instance, const void *tx,
+                                      void *rx, uint32_t frames)
+{
+    LPSPI_Type *base;
+    uint32_t sent = 0;
+    uint32_t received = 0;
+    uint32_t timeout = LPSPI_SRV_TIMEOUT_POLLS;
+    uint32_t word;
+    uint8_t size;
+
+    if (instance >= LPSPI_SRV_INSTANCE_COUNT) {
+        return LPSPI_SRV_INVALID_PARAM;
+    }
+
+    if (!s_lpspi_initialized[instance]) {
+        return LPSPI_SRV_NOT_INITIALIZED;
+    }
+
+    if (s_stream[instance].active) {
+        return LPSPI_SRV_BUSY;
+    }
+
+    base = s_lpspi_bases[instance];
+    size = s_frame_bytes[instance];
+
+    while (received < frames) {
+        /* Keep the TX FIFO full, but never more frames in flight than the
+           RX FIFO can hold - the master would stall on a full RX FIFO */
+        while (sent < frames && (sent - received) < LPSPI_FIFO_SIZE &&
+               LPSPI_GetTxFifoCount(base) < LPSPI_FIFO_SIZE) {
+            word = 0U;
+            if (tx != NULL) {
+                if (size == 1U) {
+                    word = ((const uint8_t *)tx)[sent];
+                } else if (size == 2U) {
+                    word = ((const uint16_t *)tx)[sent];
+                } else {
+                    word = ((const uint32_t *)tx)[sent];
+                }
+            }
+            LPSPI_WriteData(base, word);
+            sent++;
+        }
+
+        if (LPSPI_GetRxFifoCount(base) == 0U) {
+            if (--timeout == 0U) {
+                LPSPI_FlushFifo(base, true, true);
+                return LPSPI_SRV_TIMEOUT;
+            }
+            continue;
+        }
+
+        word = LPSPI_ReadData(base);
+        if (rx != NULL) {
+            if (size == 1U) {
+                ((uint8_t *)rx)[received] = (uint8_t)word;
+            } else if (size == 2U) {
+                ((uint16_t *)rx)[received] = (uint16_t)word;
+            } else {
+                ((uint32_t *)rx)[received] = word;
+            }
+        }
+        received++;
+        timeout = LPSPI_SRV_TIMEOUT_POLLS;
+    }
+
+    return LPSPI_SRV_SUCCESS;
+}
+
+lpspi_srv_status_t LPSPI_SRV_SetPcsHold(lpspi_srv_instance_t instance, bool hold)
+{
+    if (instance >= LPSPI_SRV_INSTANCE_COUNT) {
+        return LPSPI_SRV_INVALID_PARAM;
+    }
+
+    if (!s_lpspi_initialized[instance]) {
+        return LPSPI_SRV_NOT_INITIALIZED;
+    }
+
+    if (s_stream[instance].active) {
+        return LPSPI_SRV_BUSY;
+    }
+
+    /* Queued behind any frame still in the TX FIFO */
+    while (LPSPI_GetTxFifoCount(s_lpspi_bases[instance]) >= LPSPI_FIFO_SIZE) {
+        /* Wait for space */
+    }
+
+    LPSPI_SetPcsContinuous(s_lpspi_bases[instance], hold);
+
+    return LPSPI_SRV_SUCCESS;
+}
+
+lpspi_srv_status_t LPSPI_SRV_StartStream(lpspi_srv_instance_t instance,
+                                         const lpspi_srv_stream_config_t *config)
+{
+    lpspi_srv_stream_t *stream;
+    LPSPI_Type *base;
+    dma_transfer_config_t xfer;
+    lpspi_host_request_t request;
+    lpspi_srv_status_t status;
+    dma_request_source_t rx_source;
+
+    if (instance >= LPSPI_SRV_INSTANCE_COUNT || config == NULL ||
+        config->buffer[0] == NULL || config->buffer[1] == NULL ||
+        config->samples == 0U || config->samples > DMA_MAX_MAJOR_COUNT) {
+        return LPSPI_SRV_INVALID_PARAM;
+    }
+
+    if (!s_lpspi_initialized[instance]) {
+        return LPSPI_SRV_NOT_INITIALIZED;
+    }
+
+    if (s_frame_bytes[instance] > 2U) {
+        return LPSPI_SRV_INVALID_PARAM;
+    }
+
+    stream = &s_stream[instance];
+    base = s_lpspi_bases[instance];
+
+    if (stream->active) {
+        return LPSPI_SRV_BUSY;
+    }
+
+    if (CLOCK_SRV_EnablePeripheral(CLOCK_SRV_DMAMUX, CLOCK_SRV_PCS_NONE) != CLOCK_SRV_SUCCESS) {
+        return LPSPI_SRV_ERROR;
+    }
+    DMA_Init();
+
+    status = LPSPI_SRV_AllocChannels(stream);
+    if (status != LPSPI_SRV_SUCCESS) {
+        return status;
+    }
+
+    stream->buffer[0] = config->buffer[0];
+    stream->buffer[1] = config->buffer[1];
+    stream->samples = config->samples;
+    stream->command = config->command;
+    stream->callback = config->callback;
+    stream->next_buffer = 0;
+    stream->count = 0;
+
+    /* RX: RDR -> buffer[0] -> buffer[1] -> buffer[0] ... */
+    xfer.src_addr = LPSPI_GetRxDataAddress(base);
+    xfer.src_offset = 0;
+    xfer.dst_offset = 2;
+    xfer.src_size = DMA_TRANSFER_SIZE_2B;
+    xfer.dst_size = DMA_TRANSFER_SIZE_2B;
+    xfer.minor_bytes = 2U;
+    xfer.major_count = config->samples;
+    xfer.src_last_adjust = 0;
+    xfer.dst_last_adjust = 0;
+    xfer.int_major = true;
+    xfer.int_half = false;
+    xfer.disable_request = false;
+
+    xfer.dst_addr = (uint32_t)config->buffer[0];
+    DMA_BuildTcd(&stream->rx_tcd[0], &xfer, &stream->rx_tcd[1]);
+    xfer.dst_addr = (uint32_t)config->buffer[1];
+    DMA_BuildTcd(&stream->rx_tcd[1], &xfer, &stream->rx_tcd[0]);
+
+    if (DMA_LoadTcd(stream->rx_channel, &stream->rx_tcd[0]) != DMA_STATUS_SUCCESS) {
+        LPSPI_SRV_ReleaseChannels(stream);
+        return LPSPI_SRV_ERROR;
+    }
+
+    /* TX: the same command word for every frame, forever */
+    xfer.src_addr = (uint32_t)&stream->command;
+    xfer.dst_addr = LPSPI_GetTxDataAddress(base);
+    xfer.src_offset = 0;
+    xfer.dst_offset = 0;
+    xfer.src_size = DMA_TRANSFER_SIZE_4B;
+    xfer.dst_size = DMA_TRANSFER_SIZE_4B;
+    xfer.minor_bytes = 4U;
+    xfer.major_count = 1U;
+    xfer.int_major = false;
+
+    if (DMA_ConfigTransfer(stream->tx_channel, &xfer) != DMA_STATUS_SUCCESS) {
+        LPSPI_SRV_ReleaseChannels(stream);
+        return LPSPI_SRV_ERROR;
+    }
+
+    rx_source = (dma_request_source_t)((uint32_t)DMA_REQ_LPSPI0_RX + 2U * (uint32_t)instance);
+    DMA_SetRequestSource(stream->rx_channel, rx_source, false);
+    DMA_SetRequestSource(stream->tx_channel, (dma_request_source_t)((uint32_t)rx_source + 1U), false);
+
+    DMA_InstallCallback(stream->rx_channel, LPSPI_SRV_DmaCallback, (void *)(uint32_t)instance);
+    NVIC_SetPriority((IRQn_Type)(DMA_0_IRQn + stream->rx_channel), LPSPI_SRV_DMA_IRQ_PRIORITY);
+    NVIC_EnableInterrupt((IRQn_Type)(DMA_0_IRQn + stream->rx_channel));
+
+    /* Frames are never continuous: PCS toggles and the trigger is sampled
+       before every frame */
+    switch (config->trigger) {
+        case LPSPI_SRV_TRIGGER_PIN:   request = LPSPI_HOST_REQUEST_PIN; break;
+        case LPSPI_SRV_TRIGGER_INPUT: request = LPSPI_HOST_REQUEST_TRIGGER; break;
+        default:                      request = LPSPI_HOST_REQUEST_DISABLED; break;
+    }
+
+    LPSPI_FlushFifo(base, true, true);
+    LPSPI_ConfigHostRequest(base, request, config->trigger_active_high);
+    LPSPI_SetPcsContinuous(base, false);
+    LPSPI_SetFifoWatermarks(base, 1U, 0U);
+
+    stream->active = true;
+    DMA_StartChannel(stream->rx_channel);
+    DMA_StartChannel(stream->tx_channel);
+    LPSPI_EnableDma(base, LPSPI_DER_TDDE_MASK | LPSPI_DER_RDDE_MASK);
+
+    return LPSPI_SRV_SUCCESS;
+}
+
+void LPSPI_SRV_StopStream(lpspi_srv_instance_t instance)
+{
+    lpspi_srv_stream_t *stream;
+    LPSPI_Type *base;
+
+    if (instance >= LPSPI_SRV_INSTANCE_COUNT || !s_stream[instance].active) {
+        return;
+    }
+
+    stream = &s_stream[instance];
+    base = s_lpspi_bases[instance];
+
+    LPSPI_DisableDma(base, LPSPI_DER_TDDE_MASK | LPSPI_DER_RDDE_MASK);
+    DMA_StopChannel(stream->tx_channel);
+    DMA_StopChannel(stream->rx_channel);
+    NVIC_DisableInterrupt((IRQn_Type)(DMA_0_IRQn + stream->rx_channel));
+
+    DMA_InstallCallback(stream->rx_channel, NULL, NULL);
+    DMA_SetRequestSource(stream->tx_channel, DMA_REQ_DISABLED, false);
+    DMA_SetRequestSource(stream->rx_channel, DMA_REQ_DISABLED, false);
+    DMA_ClearStatus(stream->tx_channel);
+    DMA_ClearStatus(stream->rx_channel);
+
+    LPSPI_ConfigHostRequest(base, LPSPI_HOST_REQUEST_DISABLED, false);
+    LPSPI_FlushFifo(base, true, true);
+    LPSPI_SetFifoWatermarks(base, 0U, 0U);
+
+    LPSPI_SRV_ReleaseChannels(stream);
+    stream->active = false;
+}
+
+uint32_t LPSPI_SRV_GetStreamCount(lpspi_srv_instance_t instance)
+{
+    if (instance >= LPSPI_SRV_INSTANCE_COUNT) {
+        return 0U;
+    }
+
+    return s_stream[instance].count;
+}
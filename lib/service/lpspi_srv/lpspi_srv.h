@@ -0,0 +1,189 @@
+/**
+ * @file    lpspi_srv.h
+ * @brief   LPSPI Service - Abstraction API
+ * @details
+ * SPI master access for external converters and sensor front-ends.
+ *
+ * Features:
+ * - Blocking transfers that keep the 4-word FIFOs full (no gaps between
+ *   frames while the CPU keeps up)
+ * - Continuous transfers: chip select held across frames and calls
+ * - Sample streaming without per-sample CPU work:
+ *   - a TX DMA channel repeats one command word into the TX FIFO
+ *   - an RX DMA channel runs a scatter/gather ring over two buffers
+ *     (ping-pong); the callback gets the buffer that just filled while
+ *     the other one is being written
+ *   - optional hardware pacing: each frame waits for the HREQ pin or the
+ *     TRGMUX input trigger (e.g. an LPIT channel), so the sample rate is
+ *     set by a timer instead of the SPI clock
+ *
+ * Pin muxing is left to the application (port_srv). DMA channels come
+ * from the resource registry (res_srv).
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LPSPI_SRV_H
+#define LPSPI_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Blocking transfer timeout (polls without an RX word) */
+#define LPSPI_SRV_TIMEOUT_POLLS     (100000U)
+
+/**
+ * @brief LPSPI service status codes
+ */
+typedef enum {
+    LPSPI_SRV_SUCCESS = 0,
+    LPSPI_SRV_ERROR,
+    LPSPI_SRV_NOT_INITIALIZED,
+    LPSPI_SRV_BUSY,                 /**< Stream running on the instance */
+    LPSPI_SRV_INVALID_PARAM,
+    LPSPI_SRV_TIMEOUT,
+    LPSPI_SRV_NO_RESOURCE           /**< No free DMA channel */
+} lpspi_srv_status_t;
+
+/**
+ * @brief LPSPI instance
+ */
+typedef enum {
+    LPSPI_SRV_INSTANCE_0 = 0,
+    LPSPI_SRV_INSTANCE_1,
+    LPSPI_SRV_INSTANCE_2,
+    LPSPI_SRV_INSTANCE_COUNT
+} lpspi_srv_instance_t;
+
+/**
+ * @brief SPI mode (CPOL/CPHA)
+ */
+typedef enum {
+    LPSPI_SRV_MODE_0 = 0,           /**< CPOL 0, CPHA 0 */
+    LPSPI_SRV_MODE_1,               /**< CPOL 0, CPHA 1 */
+    LPSPI_SRV_MODE_2,               /**< CPOL 1, CPHA 0 */
+    LPSPI_SRV_MODE_3                /**< CPOL 1, CPHA 1 */
+} lpspi_srv_mode_t;
+
+/**
+ * @brief Stream pacing
+ */
+typedef enum {
+    LPSPI_SRV_TRIGGER_NONE = 0,     /**< Back-to-back frames (rate set by SCK) */
+    LPSPI_SRV_TRIGGER_PIN,          /**< One frame per HREQ pin assertion */
+    LPSPI_SRV_TRIGGER_INPUT         /**< One frame per TRGMUX input trigger */
+} lpspi_srv_trigger_t;
+
+/**
+ * @brief Instance configuration
+ */
+typedef struct {
+    uint32_t baudrate;              /**< SCK in Hz (rounded down) */
+    uint8_t frame_bits;             /**< Bits per frame (8-32, streams 8-16) */
+    lpspi_srv_mode_t mode;          /**< SPI mode */
+    uint8_t pcs;                    /**< Chip select (0-3) */
+    bool pcs_active_high;           /**< Chip select polarity */
+    bool lsb_first;                 /**< LSB shifted first */
+} lpspi_srv_config_t;
+
+/**
+ * @brief Stream buffer callback (DMA interrupt context)
+ * @param instance LPSPI instance
+ * @param samples Buffer that just filled; valid until the stream wraps
+ *        back to it
+ * @param count Samples in the buffer
+ */
+typedef void (*lpspi_srv_stream_callback_t)(lpspi_srv_instance_t instance,
+                                            const uint16_t *samples, uint16_t count);
+
+/**
+ * @brief Stream configuration
+ */
+typedef struct {
+    uint16_t *buffer[2];            /**< Ping-pong buffers */
+    uint16_t samples;               /**< Samples per buffer */
+    uint16_t command;               /**< Word shifted out with every frame */
+    lpspi_srv_trigger_t trigger;    /**< Frame pacing */
+    bool trigger_active_high;       /**< HREQ pin polarity */
+    lpspi_srv_stream_callback_t callback;
+} lpspi_srv_stream_config_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize an instance as master
+ * @details Clocks the instance from SOSCDIV2 and programs the frame
+ *          format. Pins must be muxed by the caller.
+ * @param instance LPSPI instance
+ * @param config Configuration
+ * @return lpspi_srv_status_t Status of initialization
+ */
+lpspi_srv_status_t LPSPI_SRV_Init(lpspi_srv_instance_t instance, const lpspi_srv_config_t *config);
+
+/**
+ * @brief Stop any stream and disable the instance
+ * @param instance LPSPI instance
+ */
+void LPSPI_SRV_Deinit(lpspi_srv_instance_t instance);
+
+/**
+ * @brief Full-duplex blocking transfer
+ * @details Frames are stored as uint8_t (<= 8 bits), uint16_t (<= 16 bits)
+ *          or uint32_t.
+ * @param instance LPSPI instance
+ * @param tx Frames to send, NULL to send zeros
+ * @param rx Received frames, NULL to discard
+ * @param frames Number of frames
+ * @return lpspi_srv_status_t Status of operation
+ */
+lpspi_srv_status_t LPSPI_SRV_Transfer(lpspi_srv_instance_t instance, const void *tx,
+                                      void *rx, uint32_t frames);
+
+/**
+ * @brief Hold the chip select across frames and transfers
+ * @details With hold set, consecutive LPSPI_SRV_Transfer() calls form one
+ *          continuous transfer. Clearing it negates PCS after the last
+ *          queued frame.
+ * @param instance LPSPI instance
+ * @param hold true to keep PCS asserted
+ * @return lpspi_srv_status_t Status of operation
+ */
+lpspi_srv_status_t LPSPI_SRV_SetPcsHold(lpspi_srv_instance_t instance, bool hold);
+
+/**
+ * @brief Start streaming samples into ping-pong buffers
+ * @details Allocates two DMA channels. Each frame shifts out the command
+ *          word and stores the received frame (low 16 bits). Frames are
+ *          non-continuous so a hardware trigger paces every frame.
+ * @param instance LPSPI instance
+ * @param config Stream configuration (buffers must stay valid)
+ * @return lpspi_srv_status_t Status of operation
+ */
+lpspi_srv_status_t LPSPI_SRV_StartStream(lpspi_srv_instance_t instance,
+                                         const lpspi_srv_stream_config_t *config);
+
+/**
+ * @brief Stop streaming and release the DMA channels
+ * @param instance LPSPI instance
+ */
+void LPSPI_SRV_StopStream(lpspi_srv_instance_t instance);
+
+/**
+ * @brief Number of buffers completed since the stream was started
+ * @param instance LPSPI instance
+ * @return uint32_t Completed buffers
+ */
+uint32_t LPSPI_SRV_GetStreamCount(lpspi_srv_instance_t instance);
+
+#endif /* LPSPI_SRV_H */
@@ -0,0 +1,177 @@
+/**
+ * @file    lut_srv.c
+ * @brief   Lookup-Table Linearization Service Implementation
+ * @details y = v[k] + ((v[k+1] - v[k]) * f) >> shift with k = raw >> shift
+ *          and f = raw & mask. The shift of a negative product rounds
+ *          towards minus infinity, which is at most one unit of the table.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lut_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define LUT_INPUT_MAX               ((1U << LUT_SRV_INPUT_BITS) - 1U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static const lut_srv_table_t *s_tables[LUT_SRV_MAX_CHANNELS];
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Interpolate one value (raw is clamped to the input range)
+ */
+static inline int32_t LUT_Interpolate(const int32_t *values, uint32_t shift,
+                                      uint32_t mask, uint32_t raw)
+{
+    const int32_t *entry;
+
+    if (raw > LUT_INPUT_MAX) {
+        raw = LUT_INPUT_MAX;
+    }
+
+    entry = &values[raw >> shift];
+
+    return entry[0] + (((entry[1] - entry[0]) * (int32_t)(raw & mask)) >> shift);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+lut_srv_status_t LUT_SRV_Init(void)
+{
+    for (uint8_t i = 0; i < LUT_SRV_MAX_CHANNELS; i++) {
+        s_tables[i] = NULL;
+    }
+
+    s_initialized = true;
+
+    return LUT_SRV_SUCCESS;
+}
+
+lut_srv_status_t LUT_SRV_Attach(uint8_t channel, const lut_srv_table_t *table)
+{
+    int32_t step;
+
+    if (!s_initialized) {
+        return LUT_SRV_NOT_INITIALIZED;
+    }
+
+    if (channel >= LUT_SRV_MAX_CHANNELS) {
+        return LUT_SRV_INVALID_PARAM;
+    }
+
+    if (table != NULL) {
+        if (table->values == NULL || table->shift == 0U || table->shift > LUT_SRV_INPUT_BITS) {
+            return LUT_SRV_INVALID_PARAM;
+        }
+
+        for (uint32_t k = 0; (k + 1U) < LUT_SRV_ENTRIES(table->shift); k++) {
+            step = table->values[k + 1U] - table->values[k];
+            if (step >= LUT_SRV_MAX_STEP || step <= -LUT_SRV_MAX_STEP) {
+                return LUT_SRV_INVALID_PARAM;
+            }
+        }
+    }
+
+    s_tables[channel] = table;
+
+    return LUT_SRV_SUCCESS;
+}
+
+lut_srv_status_t LUT_SRV_Convert(uint8_t channel, uint16_t raw, int32_t *value)
+{
+    const lut_srv_table_t *table;
+
+    if (!s_initialized) {
+        return LUT_SRV_NOT_INITIALIZED;
+    }
+
+    if (channel >= LUT_SRV_MAX_CHANNELS || value == NULL) {
+        return LUT_SRV_INVALID_PARAM;
+    }
+
+    table = s_tables[channel];
+    if (table == NULL) {
+        return LUT_SRV_NO_TABLE;
+    }
+
+    *value = LUT_Interpolate(table->values, table->shift, (1UL << table->shift) - 1U, raw);
+
+    return LUT_SRV_SUCCESS;
+}
+
+lut_srv_status_t LUT_SRV_ConvertBlock(uint8_t channel, const uint16_t *raw,
+                                      int32_t *values, uint16_t count)
+{
+    const lut_srv_table_t *table;
+    const int32_t *entries;
+    uint32_t shift;
+    uint32_t mask;
+
+    if (!s_initialized) {
+        return LUT_SRV_NOT_INITIALIZED;
+    }
+
+    if (channel >= LUT_SRV_MAX_CHANNELS || raw == NULL || values == NULL) {
+        return LUT_SRV_INVALID_PARAM;
+    }
+
+    table = s_tables[channel];
+    if (table == NULL) {
+        return LUT_SRV_NO_TABLE;
+    }
+
+    /* Table fields in registers for the whole block */
+    entries = table->values;
+    shift = table->shift;
+    mask = (1UL << shift) - 1U;
+
+    for (uint16_t i = 0; i < count; i++) {
+        values[i] = LUT_Interpolate(entries, shift, mask, raw[i]);
+    }
+
+    return LUT_SRV_SUCCESS;
+}
+
+lut_srv_status_t LUT_SRV_ConvertSequence(const uint8_t *channels, const uint16_t *raw,
+                                         int32_t *values, uint8_t count)
+{
+    const lut_srv_table_t *table;
+    lut_srv_status_t status = LUT_SRV_SUCCESS;
+
+    if (!s_initialized) {
+        return LUT_SRV_NOT_INITIALIZED;
+    }
+
+    if (channels == NULL || raw == NULL || values == NULL) {
+        return LUT_SRV_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        table = (channels[i] < LUT_SRV_MAX_CHANNELS) ? s_tables[channels[i]] : NULL;
+        if (table == NULL) {
+            values[i] = (int32_t)raw[i];
+            status = LUT_SRV_NO_TABLE;
+        } else {
+            values[i] = LUT_Interpolate(table->values, table->shift,
+                                        (1UL << table->shift) - 1U, raw[i]);
+        }
+    }
+
+    return status;
+}
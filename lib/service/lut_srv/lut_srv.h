@@ -0,0 +1,133 @@
+/**
+ * @file    lut_srv.h
+ * @brief   Lookup-Table Linearization Service - Abstraction API
+ * @details
+ * Converts raw 12-bit ADC counts to engineering units (hundredths of a
+ * degree, tenths of a kPa, millivolts...) through per-channel
+ * piecewise-linear tables, including for non-linear sensors such as
+ * thermistors.
+ *
+ * Features:
+ * - Uniform breakpoints every 2^shift counts: the segment is raw >> shift
+ *   and the position inside it raw & mask, so a conversion is one table
+ *   read pair, a multiply and a shift - no search and no division
+ * - Tables are const data from a build-time calibration definition
+ *   (lut_srv_cal.h); a linear sensor needs two entries, a thermistor a
+ *   few dozen
+ * - Block conversion for sequence and DMA results, with the table looked
+ *   up once per block
+ *
+ * Accuracy is set by the breakpoint density: the interpolation error of a
+ * segment grows with the square of its width, so halving shift quarters
+ * it.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LUT_SRV_H
+#define LUT_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Input resolution (ADC counts 0 .. 2^bits - 1) */
+#define LUT_SRV_INPUT_BITS          (12U)
+
+/** @brief Channels that can carry a table (ADC0 SE0-SE15) */
+#define LUT_SRV_MAX_CHANNELS        (16U)
+
+/** @brief Largest step between neighbouring entries (keeps the product in 32 bits) */
+#define LUT_SRV_MAX_STEP            ((int32_t)1 << (31U - LUT_SRV_INPUT_BITS))
+
+/** @brief Entries of a table with one breakpoint every 2^shift counts */
+#define LUT_SRV_ENTRIES(shift)      ((1U << (LUT_SRV_INPUT_BITS - (shift))) + 1U)
+
+/**
+ * @brief Define a table from its entries
+ * @details Entry k is the value at raw = k << shift; the last one is the
+ *          value at full scale + 1 count, used for the top segment only.
+ */
+#define LUT_SRV_TABLE(shift, values)    { (values), (uint8_t)(shift) }
+
+/**
+ * @brief LUT service status codes
+ */
+typedef enum {
+    LUT_SRV_SUCCESS = 0,
+    LUT_SRV_ERROR,
+    LUT_SRV_NOT_INITIALIZED,
+    LUT_SRV_INVALID_PARAM,
+    LUT_SRV_NO_TABLE                /**< Channel has no table attached */
+} lut_srv_status_t;
+
+/**
+ * @brief Piecewise-linear table
+ */
+typedef struct {
+    const int32_t *values;          /**< LUT_SRV_ENTRIES(shift) entries */
+    uint8_t shift;                  /**< log2 of counts per segment, 1-12 */
+} lut_srv_table_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the service, no channel has a table
+ * @return lut_srv_status_t Status of initialization
+ */
+lut_srv_status_t LUT_SRV_Init(void);
+
+/**
+ * @brief Use a table for a channel
+ * @details The table is checked once here (shift range, steps below
+ *          LUT_SRV_MAX_STEP) so that conversions need no checks.
+ * @param channel ADC channel
+ * @param table Table, kept by reference; NULL detaches
+ * @return lut_srv_status_t Status of operation
+ */
+lut_srv_status_t LUT_SRV_Attach(uint8_t channel, const lut_srv_table_t *table);
+
+/**
+ * @brief Convert one raw value
+ * @param channel ADC channel
+ * @param raw Raw counts
+ * @param value Receives the value in table units
+ * @return lut_srv_status_t Status of operation
+ */
+lut_srv_status_t LUT_SRV_Convert(uint8_t channel, uint16_t raw, int32_t *value);
+
+/**
+ * @brief Convert consecutive samples of one channel
+ * @details Interrupt safe: no state is written.
+ * @param channel ADC channel
+ * @param raw Raw counts
+ * @param values Receives count values in table units
+ * @param count Number of samples
+ * @return lut_srv_status_t Status of operation
+ */
+lut_srv_status_t LUT_SRV_ConvertBlock(uint8_t channel, const uint16_t *raw,
+                                      int32_t *values, uint16_t count);
+
+/**
+ * @brief Convert the slots of a sequence, each through its channel's table
+ * @param channels Channel per slot (as in adc_srv_sequence_config_t)
+ * @param raw Raw counts per slot
+ * @param values Receives count values
+ * @param count Number of slots
+ * @return lut_srv_status_t LUT_SRV_NO_TABLE if a slot's channel has none
+ *         (its value is then the raw count)
+ */
+lut_srv_status_t LUT_SRV_ConvertSequence(const uint8_t *channels, const uint16_t *raw,
+                                         int32_t *values, uint8_t count);
+
+#endif /* LUT_SRV_H */
@@ -0,0 +1,45 @@
+/**
+ * @file    lut_srv_cal.c
+ * @brief   Lookup-Table Linearization Service - Calibration Data
+ * @details Generated from the models in lut_srv_cal.h.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lut_srv_cal.h"
+
+/*******************************************************************************
+ * Calibration Data
+ ******************************************************************************/
+
+/* v = raw * 5000 / 4096 */
+static const int32_t s_cal_millivolt_5v[LUT_SRV_ENTRIES(12U)] = {
+    0, 5000
+};
+
+/* R = 10k * raw / (4096 - raw), T = 1 / (1 / 298.15 + ln(R / 10k) / 3435) - 273.15 */
+static const int32_t s_cal_ntc_10k_3435[LUT_SRV_ENTRIES(6U)] = {
+    15000, 15000, 15000, 13055, 11662, 10628, 9811, 9135,
+    8559, 8057, 7613, 7212, 6848, 6513, 6203, 5914,
+    5643, 5386, 5143, 4912, 4690, 4478, 4273, 4075,
+    3883, 3697, 3516, 3338, 3165, 2995, 2827, 2663,
+    2500, 2339, 2180, 2021, 1864, 1706, 1549, 1392,
+    1234, 1075, 916, 754, 590, 424, 255, 82,
+    -96, -278, -467, -662, -866, -1080, -1307, -1548,
+    -1808, -2091, -2405, -2760, -3174, -3680, -4000, -4000,
+    -4000
+};
+
+/* p = (raw / 4096 - 0.1) / 0.8 * 7000 */
+static const int32_t s_cal_pressure_700kpa[LUT_SRV_ENTRIES(12U)] = {
+    -875, 7875
+};
+
+const lut_srv_table_t LUT_SRV_CAL_MILLIVOLT_5V = LUT_SRV_TABLE(12U, s_cal_millivolt_5v);
+const lut_srv_table_t LUT_SRV_CAL_NTC_10K_3435 = LUT_SRV_TABLE(6U, s_cal_ntc_10k_3435);
+const lut_srv_table_t LUT_SRV_CAL_PRESSURE_700KPA = LUT_SRV_TABLE(12U, s_cal_pressure_700kpa);
@@ -0,0 +1,54 @@
+/**
+ * @file    lut_srv_cal.h
+ * @brief   Lookup-Table Linearization Service - Calibration Tables
+ * @details
+ * Build-time calibration of the sensors used on the boards. Each table is
+ * generated offline from the sensor model given with it and attached to
+ * a channel with LUT_SRV_Attach().
+ *
+ * To add a sensor: evaluate its transfer function at raw = k << shift for
+ * k = 0 .. 2^(12 - shift) (the last point one count past full scale),
+ * clamp to the sensor range, round to the table unit and add the table to
+ * lut_srv_cal.c.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef LUT_SRV_CAL_H
+#define LUT_SRV_CAL_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lut_srv.h"
+
+/*******************************************************************************
+ * Calibration Tables
+ ******************************************************************************/
+
+/**
+ * @brief Input voltage in mV, 5 V reference
+ * @details Linear, 2 entries. Same result as the adc_srv millivolt value.
+ */
+extern const lut_srv_table_t LUT_SRV_CAL_MILLIVOLT_5V;
+
+/**
+ * @brief NTC temperature in 0.01 degC
+ * @details 10 kOhm B25/85 = 3435 K thermistor to ground, 10 kOhm pull-up
+ *          to the reference. Clamped to -40 .. 150 degC, 65 entries
+ *          (shift 6); interpolation error below 0.16 degC from -20 to
+ *          100 degC.
+ */
+extern const lut_srv_table_t LUT_SRV_CAL_NTC_10K_3435;
+
+/**
+ * @brief Ratiometric pressure in 0.1 kPa
+ * @details 0 .. 700 kPa over 10 % .. 90 % of the supply, 2 entries.
+ *          Values outside the range are extrapolated, not clamped, so a
+ *          broken wire reads as negative or above full scale.
+ */
+extern const lut_srv_table_t LUT_SRV_CAL_PRESSURE_700KPA;
+
+#endif /* LUT_SRV_CAL_H */
@@ -0,0 +1,268 @@
+/**
+ * @file    nvm_srv.c
+ * @brief   Non-Volatile Configuration Service Implementation
+ * @details RAM shadow over FlexRAM EEE with a deferred write queue
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "nvm_srv.h"
+#include "../../driver/ftfc/ftfc.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define NVM_SRV_RECORD_SIZE     (8U)                /* value word + tag word */
+#define NVM_SRV_DIRTY_WORDS     ((NVM_SRV_MAX_KEYS + 31U) / 32U)
+
+/* Flush step for the key being written */
+#define NVM_SRV_STEP_VALUE      (0U)
+#define NVM_SRV_STEP_TAG        (1U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_nvm_initialized = false;
+
+/* RAM shadow of every record */
+static uint32_t s_shadow[NVM_SRV_MAX_KEYS];
+static uint32_t s_valid[NVM_SRV_DIRTY_WORDS];
+static uint32_t s_dirty[NVM_SRV_DIRTY_WORDS];
+
+/* Deferred write state */
+static uint8_t s_flush_key = 0;
+static uint8_t s_flush_step = NVM_SRV_STEP_VALUE;
+static bool s_flush_active = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Build the tag word of a record
+ */
+static inline uint32_t NVM_SRV_MakeTag(uint8_t key, uint32_t value)
+{
+    uint32_t check = ~(value ^ (value >> 16)) & 0xFFFFU;
+
+    return ((uint32_t)key << 16) | check;
+}
+
+static inline bool NVM_SRV_TestBit(const uint32_t *map, uint8_t key)
+{
+    return (map[key >> 5] & (1UL << (key & 31U))) != 0U;
+}
+
+static inline void NVM_SRV_SetBit(uint32_t *map, uint8_t key)
+{
+    map[key >> 5] |= (1UL << (key & 31U));
+}
+
+static inline void NVM_SRV_ClearBit(uint32_t *map, uint8_t key)
+{
+    map[key >> 5] &= ~(1UL << (key & 31U));
+}
+
+/**
+ * @brief Find the next dirty key
+ * @return true if one was found
+ */
+static bool NVM_SRV_NextDirty(uint8_t *key)
+{
+    for (uint8_t w = 0; w < NVM_SRV_DIRTY_WORDS; w++) {
+        if (s_dirty[w] != 0U) {
+            *key = (uint8_t)((w << 5) + (uint8_t)__builtin_ctz(s_dirty[w]));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Load the shadow from FlexRAM
+ */
+static void NVM_SRV_LoadShadow(void)
+{
+    const volatile uint32_t *flexram = (const volatile uint32_t *)FTFC_FLEXRAM_BASE;
+
+    for (uint8_t key = 0; key < NVM_SRV_MAX_KEYS; key++) {
+        uint32_t value = flexram[key * 2U];
+        uint32_t tag = flexram[(key * 2U) + 1U];
+
+        if (tag == NVM_SRV_MakeTag(key, value)) {
+            s_shadow[key] = value;
+            NVM_SRV_SetBit(s_valid, key);
+        } else {
+            s_shadow[key] = 0xFFFFFFFFU;
+            NVM_SRV_ClearBit(s_valid, key);
+        }
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+nvm_srv_status_t NVM_SRV_Init(void)
+{
+    if (s_nvm_initialized) {
+        return NVM_SRV_SUCCESS;
+    }
+
+    /* Blank device: dedicate all FlexNVM to EEE backup (max endurance).
+       Enabling CSEc with 6 key slots reserves the top of FlexRAM only;
+       the key records used here stay well below it. */
+    if (!FTFC_IsPartitioned()) {
+        if (FTFC_ProgramPartition(FTFC_CSEC_KEYS_6, FTFC_EEE_SIZE_4KB,
+                                  FTFC_DEPART_0K_DF_64K_EEE) != FTFC_STATUS_SUCCESS) {
+            return NVM_SRV_ERROR;
+        }
+    }
+
+    if (FTFC_SetFlexRamFunction(FTFC_FLEXRAM_EEE) != FTFC_STATUS_SUCCESS) {
+        return NVM_SRV_ERROR;
+    }
+
+    for (uint8_t w = 0; w < NVM_SRV_DIRTY_WORDS; w++) {
+        s_dirty[w] = 0U;
+    }
+    s_flush_active = false;
+
+    NVM_SRV_LoadShadow();
+
+    s_nvm_initialized = true;
+    return NVM_SRV_SUCCESS;
+}
+
+nvm_srv_status_t NVM_SRV_Read(nvm_srv_key_t key, uint32_t *value)
+{
+    if (!s_nvm_initialized) {
+        return NVM_SRV_NOT_INITIALIZED;
+    }
+
+    if (key >= NVM_SRV_MAX_KEYS || value == NULL) {
+        return NVM_SRV_INVALID_PARAM;
+    }
+
+    if (!NVM_SRV_TestBit(s_valid, (uint8_t)key)) {
+        return NVM_SRV_NOT_FOUND;
+    }
+
+    *value = s_shadow[key];
+    return NVM_SRV_SUCCESS;
+}
+
+uint32_t NVM_SRV_ReadOrDefault(nvm_srv_key_t key, uint32_t defaultValue)
+{
+    uint32_t value;
+
+    if (NVM_SRV_Read(key, &value) != NVM_SRV_SUCCESS) {
+        return defaultValue;
+    }
+
+    return value;
+}
+
+nvm_srv_status_t NVM_SRV_Write(nvm_srv_key_t key, uint32_t value)
+{
+    if (!s_nvm_initialized) {
+        return NVM_SRV_NOT_INITIALIZED;
+    }
+
+    if (key >= NVM_SRV_MAX_KEYS) {
+        return NVM_SRV_INVALID_PARAM;
+    }
+
+    /* Skip rewrites of the stored value - saves EEE endurance */
+    if (NVM_SRV_TestBit(s_valid, (uint8_t)key) && s_shadow[key] == value) {
+        return NVM_SRV_SUCCESS;
+    }
+
+    s_shadow[key] = value;
+    NVM_SRV_SetBit(s_valid, (uint8_t)key);
+    NVM_SRV_SetBit(s_dirty, (uint8_t)key);
+
+    /* A key rewritten mid-flush restarts from its value word */
+    if (s_flush_active && s_flush_key == (uint8_t)key) {
+        s_flush_step = NVM_SRV_STEP_VALUE;
+    }
+
+    return NVM_SRV_SUCCESS;
+}
+
+void NVM_SRV_Process(void)
+{
+    uint32_t offset;
+    uint32_t word;
+
+    if (!s_nvm_initialized || !FTFC_IsEeeReady()) {
+        return;
+    }
+
+    if (!s_flush_active) {
+        if (!NVM_SRV_NextDirty(&s_flush_key)) {
+            return;
+        }
+        s_flush_step = NVM_SRV_STEP_VALUE;
+        s_flush_active = true;
+    }
+
+    offset = (uint32_t)s_flush_key * NVM_SRV_RECORD_SIZE;
+
+    if (s_flush_step == NVM_SRV_STEP_VALUE) {
+        word = s_shadow[s_flush_key];
+    } else {
+        offset += 4U;
+        word = NVM_SRV_MakeTag(s_flush_key, s_shadow[s_flush_key]);
+    }
+
+    if (FTFC_EeeWrite32(offset, word) != FTFC_STATUS_SUCCESS) {
+        return;     /* EEE busy - retry on next call */
+    }
+
+    if (s_flush_step == NVM_SRV_STEP_VALUE) {
+        s_flush_step = NVM_SRV_STEP_TAG;
+    } else {
+        NVM_SRV_ClearBit(s_dirty, s_flush_key);
+        s_flush_active = false;
+    }
+}
+
+nvm_srv_status_t NVM_SRV_Flush(void)
+{
+    if (!s_nvm_initialized) {
+        return NVM_SRV_NOT_INITIALIZED;
+    }
+
+    while (NVM_SRV_IsBusy()) {
+        NVM_SRV_Process();
+    }
+
+    /* Wait for the last word to reach the backup */
+    while (!FTFC_IsEeeReady()) {
+    }
+
+    return NVM_SRV_SUCCESS;
+}
+
+bool NVM_SRV_IsBusy(void)
+{
+    if (s_flush_active) {
+        return true;
+    }
+
+    for (uint8_t w = 0; w < NVM_SRV_DIRTY_WORDS; w++) {
+        if (s_dirty[w] != 0U) {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file    nvm_srv.h
+ * @brief   Non-Volatile Configuration Service - Abstraction API
+ * @details
+ * Key/value storage for runtime-tuned settings, built on the FTFC
+ * FlexRAM EEPROM emulation (EEE).
+ *
+ * Features:
+ * - 32-bit values addressed by a fixed key table
+ * - RAM shadow: reads never touch flash and never wait
+ * - Deferred, batched writes: NVM_SRV_Write() only updates the shadow,
+ *   NVM_SRV_Process() drains one word per call when the EEE state machine
+ *   is ready, so the main loop (and CAN processing) is never stalled
+ * - Unchanged values are not rewritten; the EEE state machine spreads the
+ *   remaining writes over the whole FlexNVM backup (wear leveling)
+ *
+ * Record layout in FlexRAM (8 bytes per key, slot = key):
+ *   word 0: value
+ *   word 1: (key << 16) | check, check = ~(value ^ (value >> 16)) & 0xFFFF
+ *
+ * @note Call NVM_SRV_Write()/NVM_SRV_Process() from thread context only.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef NVM_SRV_H
+#define NVM_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Number of key slots reserved in FlexRAM */
+#define NVM_SRV_MAX_KEYS            (64U)
+
+/**
+ * @brief NVM service status codes
+ */
+typedef enum {
+    NVM_SRV_SUCCESS = 0,
+    NVM_SRV_ERROR,
+    NVM_SRV_NOT_INITIALIZED,
+    NVM_SRV_NOT_FOUND,              /**< Key never written (or record corrupt) */
+    NVM_SRV_INVALID_PARAM
+} nvm_srv_status_t;
+
+/**
+ * @brief Stored configuration keys
+ * @details Values are part of the FlexRAM layout: append new keys, never
+ *          renumber existing ones.
+ */
+typedef enum {
+    NVM_SRV_KEY_NODE_CAPS = 0,      /**< Node capability set (app_node) */
+    NVM_SRV_KEY_CAN_BAUDRATE,       /**< CAN bus baudrate in bps */
+    NVM_SRV_KEY_CMD_ID,             /**< Command message ID */
+    NVM_SRV_KEY_DATA_ID,            /**< ADC data message ID */
+    NVM_SRV_KEY_SAMPLE_PERIOD_MS,   /**< ADC sample period in ms */
+    NVM_SRV_KEY_UART_BAUDRATE,      /**< Gateway UART baudrate */
+    NVM_SRV_KEY_CAN_FILTER_MASK,    /**< Standard-ID filter mask */
+    NVM_SRV_KEY_BOOT_IMAGE_SIZE,    /**< Size of the verified application image (boot_srv) */
+    NVM_SRV_KEY_BOOT_IMAGE_CRC,     /**< CRC-32 of the verified application image */
+    NVM_SRV_KEY_BOOT_REQUEST,       /**< Stay in the bootloader after the next reset */
+    NVM_SRV_KEY_SECOC_TX_FRESHNESS, /**< Last freshness value of the secured commands sent */
+    NVM_SRV_KEY_SECOC_RX_FRESHNESS, /**< Last freshness value of the secured commands accepted */
+    NVM_SRV_KEY_COUNT
+} nvm_srv_key_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize NVM service
+ * @details Partitions FlexNVM on a blank device, switches FlexRAM to EEE
+ *          mode and loads the RAM shadow.
+ * @return nvm_srv_status_t Status of initialization
+ */
+nvm_srv_status_t NVM_SRV_Init(void);
+
+/**
+ * @brief Read a value from the RAM shadow
+ * @param key Configuration key
+ * @param[out] value Stored value
+ * @return nvm_srv_status_t
+ *         - NVM_SRV_NOT_FOUND: Key has no valid record
+ */
+nvm_srv_status_t NVM_SRV_Read(nvm_srv_key_t key, uint32_t *value);
+
+/**
+ * @brief Read a value, falling back to a default
+ * @param key Configuration key
+ * @param defaultValue Value returned when the key has no valid record
+ * @return uint32_t Stored value or defaultValue
+ */
+uint32_t NVM_SRV_ReadOrDefault(nvm_srv_key_t key, uint32_t defaultValue);
+
+/**
+ * @brief Write a value (deferred)
+ * @details Updates the shadow and marks the key dirty. Writing the value
+ *          already stored is a no-op.
+ * @param key Configuration key
+ * @param value New value
+ * @return nvm_srv_status_t Status of operation
+ */
+nvm_srv_status_t NVM_SRV_Write(nvm_srv_key_t key, uint32_t value);
+
+/**
+ * @brief Drain pending writes
+ * @details Non-blocking. Issues at most one FlexRAM word write per call,
+ *          and only when the EEE state machine is ready.
+ */
+void NVM_SRV_Process(void);
+
+/**
+ * @brief Write all pending values and wait for completion
+ * @details Blocking. Intended before a deliberate reset.
+ * @return nvm_srv_status_t Status of operation
+ */
+nvm_srv_status_t NVM_SRV_Flush(void);
+
+/**
+ * @brief Check whether writes are still pending
+ * @return true if at least one key is dirty
+ */
+bool NVM_SRV_IsBusy(void);
+
+#endif /* NVM_SRV_H */
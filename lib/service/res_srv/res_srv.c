@@ -0,0 +1,143 @@
+/**
+ * @file    res_srv.c
+ * @brief   Resource Registry Service Implementation
+ * @details Owner table per resource type, indexed by hardware slot number
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "res_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef struct {
+    uint8_t first;                  /**< First hardware slot number */
+    uint8_t count;                  /**< Number of slots */
+} res_srv_range_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/* Hardware slot ranges, indexed by res_srv_type_t */
+static const res_srv_range_t s_res_ranges[RES_SRV_TYPE_COUNT] = {
+    { 8U,  8U },                    /* RES_SRV_CAN0_TX_MB: MB8-MB15 */
+    { 16U, 16U },                   /* RES_SRV_CAN0_RX_MB: MB16-MB31 */
+    { 0U,  4U },                    /* RES_SRV_LPIT_CHANNEL: CH0-CH3 */
+    { 0U,  3U },                    /* RES_SRV_UART_INSTANCE: LPUART0-2 */
+    { 0U,  16U },                   /* RES_SRV_DMA_CHANNEL: CH0-CH15 */
+    { 0U,  4U },                    /* RES_SRV_FLEXIO_SHIFTER: SHIFTER0-3 */
+    { 0U,  4U }                     /* RES_SRV_FLEXIO_TIMER: TIMER0-3 */
+};
+
+/* Owner of each slot, position = slot - first */
+static res_srv_owner_t s_res_owners[RES_SRV_TYPE_COUNT][RES_SRV_MAX_SLOTS];
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Convert a hardware slot number to a table position
+ * @return Position, or RES_SRV_MAX_SLOTS if out of range
+ */
+static uint8_t RES_SRV_SlotToPos(res_srv_type_t type, uint8_t slot)
+{
+    const res_srv_range_t *range = &s_res_ranges[type];
+
+    if (slot < range->first || slot >= (uint8_t)(range->first + range->count)) {
+        return RES_SRV_MAX_SLOTS;
+    }
+
+    return (uint8_t)(slot - range->first);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+res_srv_status_t RES_SRV_Alloc(res_srv_type_t type, res_srv_owner_t owner, uint8_t *slot)
+{
+    if (type >= RES_SRV_TYPE_COUNT || owner == RES_SRV_OWNER_NONE || slot == NULL) {
+        return RES_SRV_INVALID_PARAM;
+    }
+
+    for (uint8_t pos = 0; pos < s_res_ranges[type].count; pos++) {
+        if (s_res_owners[type][pos] == RES_SRV_OWNER_NONE) {
+            s_res_owners[type][pos] = owner;
+            *slot = (uint8_t)(s_res_ranges[type].first + pos);
+            return RES_SRV_SUCCESS;
+        }
+    }
+
+    return RES_SRV_NO_RESOURCE;
+}
+
+res_srv_status_t RES_SRV_Claim(res_srv_type_t type, uint8_t slot, res_srv_owner_t owner)
+{
+    uint8_t pos;
+
+    if (type >= RES_SRV_TYPE_COUNT || owner == RES_SRV_OWNER_NONE) {
+        return RES_SRV_INVALID_PARAM;
+    }
+
+    pos = RES_SRV_SlotToPos(type, slot);
+    if (pos >= RES_SRV_MAX_SLOTS) {
+        return RES_SRV_INVALID_PARAM;
+    }
+
+    if (s_res_owners[type][pos] == owner) {
+        return RES_SRV_SUCCESS;     /* Already ours */
+    }
+
+    if (s_res_owners[type][pos] != RES_SRV_OWNER_NONE) {
+        return RES_SRV_BUSY;
+    }
+
+    s_res_owners[type][pos] = owner;
+    return RES_SRV_SUCCESS;
+}
+
+res_srv_status_t RES_SRV_Release(res_srv_type_t type, uint8_t slot, res_srv_owner_t owner)
+{
+    uint8_t pos;
+
+    if (type >= RES_SRV_TYPE_COUNT) {
+        return RES_SRV_INVALID_PARAM;
+    }
+
+    pos = RES_SRV_SlotToPos(type, slot);
+    if (pos >= RES_SRV_MAX_SLOTS) {
+        return RES_SRV_INVALID_PARAM;
+    }
+
+    if (s_res_owners[type][pos] != owner) {
+        return RES_SRV_BUSY;
+    }
+
+    s_res_owners[type][pos] = RES_SRV_OWNER_NONE;
+    return RES_SRV_SUCCESS;
+}
+
+res_srv_owner_t RES_SRV_GetOwner(res_srv_type_t type, uint8_t slot)
+{
+    uint8_t pos;
+
+    if (type >= RES_SRV_TYPE_COUNT) {
+        return RES_SRV_OWNER_NONE;
+    }
+
+    pos = RES_SRV_SlotToPos(type, slot);
+    if (pos >= RES_SRV_MAX_SLOTS) {
+        return RES_SRV_OWNER_NONE;
+    }
+
+    return s_res_owners[type][pos];
+}
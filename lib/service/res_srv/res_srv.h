@@ -0,0 +1,117 @@
+/**
+ * @file    res_srv.h
+ * @brief   Resource Registry Service - Abstraction API
+ * @details
+ * Shared registry for hardware resources that several application
+ * components may want at the same time (CAN mailboxes, LPIT channels,
+ * UART instances). Each resource slot records the owner that claimed it,
+ * so two components running on the same node never program the same
+ * mailbox or timer channel.
+ *
+ * Features:
+ * - Allocate the first free slot of a resource type
+ * - Claim a specific slot (fixed wiring such as a UART on known pins)
+ * - Release slots and query the current owner
+ *
+ * @note Allocation is intended for initialization time. The registry is
+ *       not protected against concurrent use from interrupt context.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef RES_SRV_H
+#define RES_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Owner ID meaning "slot is free" */
+#define RES_SRV_OWNER_NONE          (0U)
+
+/** @brief Owner ID reserved for service-internal resources (CAN TX mailbox, ...) */
+#define RES_SRV_OWNER_SERVICE       (1U)
+
+/** @brief Maximum number of slots of a single resource type */
+#define RES_SRV_MAX_SLOTS           (16U)
+
+/**
+ * @brief Resource registry status codes
+ */
+typedef enum {
+    RES_SRV_SUCCESS = 0,            /**< Operation successful */
+    RES_SRV_ERROR,                  /**< General error */
+    RES_SRV_INVALID_PARAM,          /**< Unknown type, slot out of range or bad owner */
+    RES_SRV_BUSY,                   /**< Slot already owned by another owner */
+    RES_SRV_NO_RESOURCE             /**< No free slot left for this type */
+} res_srv_status_t;
+
+/**
+ * @brief Resource types managed by the registry
+ * @details Slot numbers are the hardware numbers (mailbox index, LPIT
+ *          channel, LPUART instance), not zero-based positions.
+ */
+typedef enum {
+    RES_SRV_CAN0_TX_MB = 0,         /**< CAN0 transmit mailboxes (MB8-MB15) */
+    RES_SRV_CAN0_RX_MB,             /**< CAN0 receive mailboxes (MB16-MB31) */
+    RES_SRV_LPIT_CHANNEL,           /**< LPIT0 channels (0-3) */
+    RES_SRV_UART_INSTANCE,          /**< LPUART instances (0-2) */
+    RES_SRV_DMA_CHANNEL,            /**< eDMA channels (0-15) */
+    RES_SRV_FLEXIO_SHIFTER,         /**< FlexIO shifters (0-3) */
+    RES_SRV_FLEXIO_TIMER,           /**< FlexIO timers (0-3) */
+    RES_SRV_TYPE_COUNT
+} res_srv_type_t;
+
+/** @brief Owner identifier (application components pick their own IDs >= 0x10) */
+typedef uint8_t res_srv_owner_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Allocate the first free slot of a resource type
+ * @param type Resource type
+ * @param owner Owner ID (must not be RES_SRV_OWNER_NONE)
+ * @param[out] slot Hardware slot number that was allocated
+ * @return res_srv_status_t Status of operation
+ */
+res_srv_status_t RES_SRV_Alloc(res_srv_type_t type, res_srv_owner_t owner, uint8_t *slot);
+
+/**
+ * @brief Claim a specific slot of a resource type
+ * @details Claiming a slot already held by the same owner succeeds, so
+ *          components may call their init twice.
+ * @param type Resource type
+ * @param slot Hardware slot number
+ * @param owner Owner ID (must not be RES_SRV_OWNER_NONE)
+ * @return res_srv_status_t Status of operation
+ */
+res_srv_status_t RES_SRV_Claim(res_srv_type_t type, uint8_t slot, res_srv_owner_t owner);
+
+/**
+ * @brief Release a slot previously allocated or claimed
+ * @param type Resource type
+ * @param slot Hardware slot number
+ * @param owner Owner ID that holds the slot
+ * @return res_srv_status_t Status of operation
+ */
+res_srv_status_t RES_SRV_Release(res_srv_type_t type, uint8_t slot, res_srv_owner_t owner);
+
+/**
+ * @brief Get the owner of a slot
+ * @param type Resource type
+ * @param slot Hardware slot number
+ * @return res_srv_owner_t Owner ID (RES_SRV_OWNER_NONE if free or invalid)
+ */
+res_srv_owner_t RES_SRV_GetOwner(res_srv_type_t type, uint8_t slot);
+
+#endif /* RES_SRV_H */
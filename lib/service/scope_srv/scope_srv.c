@@ -0,0 +1,240 @@
+/**
+ * @file    scope_srv.c
+ * @brief   Scope Service Implementation
+ * @details Both trigger conditions are reduced to one comparison: a metric
+ *          (the sample or the step to it, negated for falling triggers)
+ *          crossing the threshold upward.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "scope_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Threshold of the external trigger: the metric never reaches it */
+#define SCOPE_NEVER                 (0x7FFFFFFFL)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static scope_srv_config_t s_config;
+static uint32_t s_mask = 0;
+
+static volatile scope_srv_state_t s_state = SCOPE_SRV_STATE_IDLE;
+static volatile bool s_force = false;
+
+/* Producer side, reset by Arm */
+static uint32_t s_count = 0;            /* Samples pushed since Arm */
+static uint32_t s_end = 0;              /* s_count at which the capture freezes */
+static uint32_t s_trigger = 0;          /* Position of the trigger sample */
+static uint16_t s_prev = 0;
+static int32_t s_last_metric = SCOPE_NEVER;
+static int32_t s_threshold = SCOPE_NEVER;
+static int32_t s_sign = 1;
+static bool s_slope = false;
+static scope_srv_trigger_t s_type = SCOPE_SRV_TRIGGER_LEVEL;
+static scope_srv_trigger_t s_source = SCOPE_SRV_TRIGGER_LEVEL;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Mask interrupts, returning the previous PRIMASK
+ */
+static inline uint32_t SCOPE_EnterCritical(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+    __asm volatile ("cpsid i" : : : "memory");
+
+    return primask;
+}
+
+/**
+ * @brief Restore PRIMASK saved by SCOPE_EnterCritical()
+ */
+static inline void SCOPE_ExitCritical(uint32_t primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+/**
+ * @brief Store a sample and advance the trigger state
+ */
+static inline void SCOPE_Step(uint16_t sample)
+{
+    uint32_t pos = s_count++;
+    int32_t metric;
+
+    s_config.buffer[pos & s_mask] = sample;
+
+    if (s_state == SCOPE_SRV_STATE_TRIGGERED) {
+        if (s_count == s_end) {
+            s_state = SCOPE_SRV_STATE_DONE;
+        }
+        return;
+    }
+
+    metric = s_slope ? ((int32_t)sample - (int32_t)s_prev) : (int32_t)sample;
+    metric *= s_sign;
+    s_prev = sample;
+
+    if (s_state == SCOPE_SRV_STATE_ARMED) {
+        if (s_force || (metric >= s_threshold && s_last_metric < s_threshold)) {
+            s_source = s_force ? SCOPE_SRV_TRIGGER_EXTERNAL : s_type;
+            s_force = false;
+            s_trigger = pos;
+            s_end = pos + s_config.post;
+            s_state = (s_count == s_end) ? SCOPE_SRV_STATE_DONE : SCOPE_SRV_STATE_TRIGGERED;
+        }
+    } else if (s_count >= s_config.pre) {
+        s_state = SCOPE_SRV_STATE_ARMED;
+    }
+
+    s_last_metric = metric;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+scope_srv_status_t SCOPE_SRV_Init(const scope_srv_config_t *config)
+{
+    scope_srv_state_t state = s_state;
+
+    if (config == NULL || config->buffer == NULL || config->size < 2U ||
+        (config->size & (config->size - 1U)) != 0U || config->post == 0U ||
+        ((uint32_t)config->pre + config->post) > config->size) {
+        return SCOPE_SRV_INVALID_PARAM;
+    }
+
+    if (state != SCOPE_SRV_STATE_IDLE && state != SCOPE_SRV_STATE_DONE) {
+        return SCOPE_SRV_BUSY;
+    }
+
+    s_config = *config;
+    s_mask = (uint32_t)config->size - 1U;
+    s_state = SCOPE_SRV_STATE_IDLE;
+    s_initialized = true;
+
+    return SCOPE_SRV_SUCCESS;
+}
+
+scope_srv_status_t SCOPE_SRV_Arm(const scope_srv_arm_t *arm)
+{
+    uint32_t primask;
+
+    if (!s_initialized) {
+        return SCOPE_SRV_NOT_INITIALIZED;
+    }
+
+    if (arm == NULL || arm->type > SCOPE_SRV_TRIGGER_EXTERNAL) {
+        return SCOPE_SRV_INVALID_PARAM;
+    }
+
+    primask = SCOPE_EnterCritical();
+
+    s_type = arm->type;
+    s_slope = (arm->type == SCOPE_SRV_TRIGGER_SLOPE);
+    s_sign = arm->falling ? -1 : 1;
+    if (arm->type == SCOPE_SRV_TRIGGER_EXTERNAL) {
+        s_threshold = SCOPE_NEVER;
+    } else if (s_slope) {
+        s_threshold = (int32_t)arm->threshold;              /* Step size, sign is in the metric */
+    } else {
+        s_threshold = (int32_t)arm->threshold * s_sign;
+    }
+    s_last_metric = SCOPE_NEVER;        /* The first sample cannot cross */
+    s_count = 0U;
+    s_force = false;
+    s_state = SCOPE_SRV_STATE_FILLING;
+
+    SCOPE_ExitCritical(primask);
+
+    return SCOPE_SRV_SUCCESS;
+}
+
+void SCOPE_SRV_Disarm(void)
+{
+    uint32_t primask = SCOPE_EnterCritical();
+
+    s_state = SCOPE_SRV_STATE_IDLE;
+    s_force = false;
+
+    SCOPE_ExitCritical(primask);
+}
+
+void SCOPE_SRV_Push(uint16_t sample)
+{
+    if (s_state == SCOPE_SRV_STATE_IDLE || s_state == SCOPE_SRV_STATE_DONE) {
+        return;
+    }
+
+    SCOPE_Step(sample);
+}
+
+void SCOPE_SRV_PushBlock(const uint16_t *samples, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++) {
+        if (s_state == SCOPE_SRV_STATE_IDLE || s_state == SCOPE_SRV_STATE_DONE) {
+            return;
+        }
+        SCOPE_Step(samples[i]);
+    }
+}
+
+void SCOPE_SRV_ForceTrigger(void)
+{
+    s_force = true;
+}
+
+scope_srv_state_t SCOPE_SRV_GetState(void)
+{
+    return s_state;
+}
+
+uint16_t SCOPE_SRV_ReadPacked(uint8_t *out, uint16_t capacity, scope_srv_capture_t *info)
+{
+    uint32_t total = (uint32_t)s_config.pre + s_config.post;
+    uint32_t start = s_trigger - s_config.pre;
+    uint32_t length = 0U;
+    uint16_t a, b;
+
+    if (out == NULL || s_state != SCOPE_SRV_STATE_DONE || SCOPE_SRV_PACKED_SIZE(total) > capacity) {
+        return 0U;
+    }
+
+    for (uint32_t i = 0; i < total; i += 2U) {
+        a = s_config.buffer[(start + i) & s_mask] & 0x0FFFU;
+        out[length++] = (uint8_t)(a >> 4);
+
+        if ((i + 1U) < total) {
+            b = s_config.buffer[(start + i + 1U) & s_mask] & 0x0FFFU;
+            out[length++] = (uint8_t)(((a & 0x0FU) << 4) | (b >> 8));
+            out[length++] = (uint8_t)b;
+        } else {
+            out[length++] = (uint8_t)((a & 0x0FU) << 4);
+        }
+    }
+
+    if (info != NULL) {
+        info->source = s_source;
+        info->pre = s_config.pre;
+        info->post = s_config.post;
+        info->trigger_sample = s_trigger;
+    }
+
+    return (uint16_t)length;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file    scope_srv.h
+ * @brief   Scope Service - Abstraction API
+ * @details
+ * Oscilloscope-style triggered capture of a sample stream, so that only
+ * the samples around a transient have to leave the board.
+ *
+ * Features:
+ * - Circular pre-trigger history in a caller-provided buffer
+ * - Level trigger (crossing a level, rising or falling), slope trigger
+ *   (sample-to-sample step above a threshold) and external trigger
+ *   (SCOPE_SRV_ForceTrigger() from a GPIO or CAN interrupt)
+ * - On a trigger, pre samples before and post samples from the trigger
+ *   on are frozen; the producer keeps calling Push at no extra cost
+ * - Packed read-out for bulk transfer: 12-bit samples, 3 bytes per pair
+ *
+ * The producer (ADC interrupt) is the only writer of the buffer and the
+ * state. Per sample it costs a store, a subtraction and two compares, so it
+ * keeps up with the conversion rate; SCOPE_SRV_PushBlock() takes the
+ * results of a whole sequence or DMA block at once.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef SCOPE_SRV_H
+#define SCOPE_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Bytes of a packed capture of n samples */
+#define SCOPE_SRV_PACKED_SIZE(n)    ((((uint32_t)(n) * 3U) + 1U) / 2U)
+
+/**
+ * @brief Scope service status codes
+ */
+typedef enum {
+    SCOPE_SRV_SUCCESS = 0,
+    SCOPE_SRV_ERROR,
+    SCOPE_SRV_NOT_INITIALIZED,
+    SCOPE_SRV_INVALID_PARAM,
+    SCOPE_SRV_BUSY                  /**< Armed or capturing */
+} scope_srv_status_t;
+
+/**
+ * @brief Capture state
+ */
+typedef enum {
+    SCOPE_SRV_STATE_IDLE = 0,       /**< Not armed */
+    SCOPE_SRV_STATE_FILLING,        /**< Armed, collecting the pre-trigger history */
+    SCOPE_SRV_STATE_ARMED,          /**< Waiting for the trigger */
+    SCOPE_SRV_STATE_TRIGGERED,      /**< Collecting post-trigger samples */
+    SCOPE_SRV_STATE_DONE            /**< Capture frozen, ready to read */
+} scope_srv_state_t;
+
+/**
+ * @brief Trigger condition
+ */
+typedef enum {
+    SCOPE_SRV_TRIGGER_LEVEL = 0,    /**< Sample crosses threshold */
+    SCOPE_SRV_TRIGGER_SLOPE,        /**< Step between two samples reaches threshold */
+    SCOPE_SRV_TRIGGER_EXTERNAL      /**< SCOPE_SRV_ForceTrigger() only */
+} scope_srv_trigger_t;
+
+/**
+ * @brief Buffer and window
+ */
+typedef struct {
+    uint16_t *buffer;               /**< History, size samples */
+    uint16_t size;                  /**< Power of two, >= pre + post */
+    uint16_t pre;                   /**< Samples kept before the trigger */
+    uint16_t post;                  /**< Samples from the trigger on, >= 1 */
+} scope_srv_config_t;
+
+/**
+ * @brief Trigger setup for SCOPE_SRV_Arm()
+ */
+typedef struct {
+    scope_srv_trigger_t type;
+    bool falling;                   /**< Level: downward crossing. Slope: negative step */
+    uint16_t threshold;             /**< Level in counts, or step size in counts */
+} scope_srv_arm_t;
+
+/**
+ * @brief Description of a frozen capture
+ */
+typedef struct {
+    scope_srv_trigger_t source;     /**< What fired (EXTERNAL if forced) */
+    uint16_t pre;
+    uint16_t post;
+    uint32_t trigger_sample;        /**< Samples pushed since Arm up to the trigger */
+} scope_srv_capture_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Set the buffer and window
+ * @param config Configuration (copied, the buffer is used in place)
+ * @return scope_srv_status_t SCOPE_SRV_BUSY while armed
+ */
+scope_srv_status_t SCOPE_SRV_Init(const scope_srv_config_t *config);
+
+/**
+ * @brief Start a capture
+ * @details The trigger is accepted once the pre-trigger history is full.
+ *          Re-arming discards a capture that was not read.
+ * @param arm Trigger setup
+ * @return scope_srv_status_t Status of operation
+ */
+scope_srv_status_t SCOPE_SRV_Arm(const scope_srv_arm_t *arm);
+
+/**
+ * @brief Stop waiting for a trigger, back to idle
+ */
+void SCOPE_SRV_Disarm(void);
+
+/**
+ * @brief Add one sample (producer interrupt)
+ */
+void SCOPE_SRV_Push(uint16_t sample);
+
+/**
+ * @brief Add consecutive samples (producer interrupt)
+ */
+void SCOPE_SRV_PushBlock(const uint16_t *samples, uint16_t count);
+
+/**
+ * @brief Trigger on the next sample, whatever the condition
+ * @details Any context. Held until the pre-trigger history is full.
+ */
+void SCOPE_SRV_ForceTrigger(void);
+
+/**
+ * @brief Get the capture state
+ */
+scope_srv_state_t SCOPE_SRV_GetState(void);
+
+/**
+ * @brief Pack a frozen capture in time order
+ * @details Samples a, b become [a >> 4, (a & 0xF) << 4 | b >> 8, b & 0xFF];
+ *          an odd last sample takes 2 bytes.
+ * @param out Output, SCOPE_SRV_PACKED_SIZE(pre + post) bytes
+ * @param capacity Size of out
+ * @param info Receives the capture description, may be NULL
+ * @return uint16_t Bytes written, 0 if no capture is frozen or out is too small
+ */
+uint16_t SCOPE_SRV_ReadPacked(uint8_t *out, uint16_t capacity, scope_srv_capture_t *info);
+
+#endif /* SCOPE_SRV_H */
@@ -0,0 +1,604 @@
+/**
+ * @file    secoc_srv.c
+ * @brief   SecOC Service Implementation
+ * @details Frame authentication, freshness handling and the software
+ *          AES-128/CMAC engine
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "secoc_srv.h"
+#include "../can_srv/can_srv.h"
+#include "../../driver/csec/csec.h"
+#include "../../driver/ultis/dwt_ultis.h"
+#include "../../driver/ultis/mem_ultis.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define SECOC_SRV_AES_BLOCK         (16U)
+#define SECOC_SRV_AES_ROUNDS        (10U)
+#define SECOC_SRV_FV_SIZE           (4U)
+
+/* DataID | data | FV fits one block for every valid CAN layout */
+#define SECOC_SRV_MAC_INPUT_MAX     (2U + SECOC_SRV_FRAME_SIZE + SECOC_SRV_FV_SIZE)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef struct {
+    secoc_srv_pdu_config_t cfg;
+    uint32_t freshness;             /**< Last sent (TX) / accepted (RX) */
+    bool synced;                    /**< RX: a frame has been accepted since reset */
+} secoc_srv_pdu_t;
+
+typedef struct {
+    uint8_t pdu;
+    uint8_t dlc;
+    uint8_t data[SECOC_SRV_FRAME_SIZE];
+} secoc_srv_frame_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static secoc_srv_engine_t s_engine = SECOC_SRV_ENGINE_SW;
+static uint8_t s_mailbox = 0;
+
+static secoc_srv_pdu_t s_pdus[SECOC_SRV_MAX_PDUS];
+static uint8_t s_pdu_count = 0;
+
+static secoc_srv_frame_t s_queue[SECOC_SRV_RX_QUEUE_LEN] MEM_QUEUE;
+static volatile uint8_t s_head = 0;
+static volatile uint8_t s_tail = 0;
+
+static secoc_srv_stats_t s_stats;
+
+/* Software engine: expanded key and CMAC subkeys */
+static uint8_t s_round_keys[(SECOC_SRV_AES_ROUNDS + 1U) * SECOC_SRV_AES_BLOCK] MEM_HOT;
+static uint8_t s_k1[SECOC_SRV_AES_BLOCK] MEM_HOT;
+static uint8_t s_k2[SECOC_SRV_AES_BLOCK] MEM_HOT;
+
+static const uint8_t s_sbox[256] = {
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
+};
+
+/*******************************************************************************
+ * Private Functions - Software AES-128 / CMAC
+ ******************************************************************************/
+
+static inline uint8_t SECOC_SRV_Xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ (((x >> 7) & 1U) * 0x1BU));
+}
+
+static void SECOC_SRV_ExpandKey(const uint8_t *key)
+{
+    uint8_t rcon = 0x01U;
+    uint8_t *w = s_round_keys;
+    uint8_t t[4];
+
+    memcpy(w, key, SECOC_SRV_AES_BLOCK);
+
+    for (uint32_t i = SECOC_SRV_AES_BLOCK; i < sizeof(s_round_keys); i += 4U) {
+        memcpy(t, &w[i - 4U], 4U);
+        if ((i % SECOC_SRV_AES_BLOCK) == 0U) {
+            /* RotWord, SubWord, Rcon */
+            uint8_t first = t[0];
+            t[0] = (uint8_t)(s_sbox[t[1]] ^ rcon);
+            t[1] = s_sbox[t[2]];
+            t[2] = s_sbox[t[3]];
+            t[3] = s_sbox[first];
+            rcon = SECOC_SRV_Xtime(rcon);
+        }
+        for (uint32_t j = 0; j < 4U; j++) {
+            w[i + j] = (uint8_t)(w[i + j - SECOC_SRV_AES_BLOCK] ^ t[j]);
+        }
+    }
+}
+
+/**
+ * @brief Encrypt one block in place
+ */
+static void SECOC_SRV_AesEncrypt(uint8_t *s)
+{
+    const uint8_t *rk = s_round_keys;
+    uint8_t t[SECOC_SRV_AES_BLOCK];
+    uint8_t a0, a1, a2, a3, all;
+
+    for (uint32_t i = 0; i < SECOC_SRV_AES_BLOCK; i++) {
+        s[i] ^= rk[i];
+    }
+
+    for (uint32_t round = 1U; round <= SECOC_SRV_AES_ROUNDS; round++) {
+        rk += SECOC_SRV_AES_BLOCK;
+
+        /* SubBytes and ShiftRows (state is column-major) */
+        for (uint32_t c = 0; c < 4U; c++) {
+            t[4U * c + 0U] = s_sbox[s[4U * c + 0U]];
+            t[4U * c + 1U] = s_sbox[s[4U * ((c + 1U) & 3U) + 1U]];
+            t[4U * c + 2U] = s_sbox[s[4U * ((c + 2U) & 3U) + 2U]];
+            t[4U * c + 3U] = s_sbox[s[4U * ((c + 3U) & 3U) + 3U]];
+        }
+
+        if (round == SECOC_SRV_AES_ROUNDS) {
+            for (uint32_t i = 0; i < SECOC_SRV_AES_BLOCK; i++) {
+                s[i] = (uint8_t)(t[i] ^ rk[i]);
+            }
+            break;
+        }
+
+        /* MixColumns and AddRoundKey */
+        for (uint32_t c = 0; c < 4U; c++) {
+            a0 = t[4U * c + 0U];
+            a1 = t[4U * c + 1U];
+            a2 = t[4U * c + 2U];
+            a3 = t[4U * c + 3U];
+            all = (uint8_t)(a0 ^ a1 ^ a2 ^ a3);
+            s[4U * c + 0U] = (uint8_t)(a0 ^ all ^ SECOC_SRV_Xtime((uint8_t)(a0 ^ a1)) ^ rk[4U * c + 0U]);
+            s[4U * c + 1U] = (uint8_t)(a1 ^ all ^ SECOC_SRV_Xtime((uint8_t)(a1 ^ a2)) ^ rk[4U * c + 1U]);
+            s[4U * c + 2U] = (uint8_t)(a2 ^ all ^ SECOC_SRV_Xtime((uint8_t)(a2 ^ a3)) ^ rk[4U * c + 2U]);
+            s[4U * c + 3U] = (uint8_t)(a3 ^ all ^ SECOC_SRV_Xtime((uint8_t)(a3 ^ a0)) ^ rk[4U * c + 3U]);
+        }
+    }
+}
+
+/**
+ * @brief Multiply by x in GF(2^128) (CMAC subkey derivation)
+ */
+static void SECOC_SRV_Double(const uint8_t *in, uint8_t *out)
+{
+    uint8_t carry = (uint8_t)(in[0] >> 7);
+
+    for (uint32_t i = 0; i < (SECOC_SRV_AES_BLOCK - 1U); i++) {
+        out[i] = (uint8_t)((in[i] << 1) | (in[i + 1U] >> 7));
+    }
+    out[SECOC_SRV_AES_BLOCK - 1U] = (uint8_t)((in[SECOC_SRV_AES_BLOCK - 1U] << 1) ^ (carry * 0x87U));
+}
+
+static void SECOC_SRV_SoftwareSetKey(const uint8_t *key)
+{
+    uint8_t l[SECOC_SRV_AES_BLOCK] = { 0 };
+
+    SECOC_SRV_ExpandKey(key);
+    SECOC_SRV_AesEncrypt(l);
+    SECOC_SRV_Double(l, s_k1);
+    SECOC_SRV_Double(s_k1, s_k2);
+}
+
+/**
+ * @brief AES-128 CMAC (RFC 4493)
+ */
+static void SECOC_SRV_SoftwareCmac(const uint8_t *msg, uint16_t length, uint8_t *mac)
+{
+    uint16_t blocks = (uint16_t)((length + SECOC_SRV_AES_BLOCK - 1U) / SECOC_SRV_AES_BLOCK);
+    uint16_t last;
+    const uint8_t *p = msg;
+
+    memset(mac, 0, SECOC_SRV_AES_BLOCK);
+
+    if (blocks == 0U) {
+        blocks = 1U;
+    }
+
+    for (uint16_t b = 0; b < (uint16_t)(blocks - 1U); b++) {
+        for (uint32_t i = 0; i < SECOC_SRV_AES_BLOCK; i++) {
+            mac[i] ^= p[i];
+        }
+        SECOC_SRV_AesEncrypt(mac);
+        p += SECOC_SRV_AES_BLOCK;
+    }
+
+    /* Last block: complete -> K1, padded with 10..0 -> K2 */
+    last = (uint16_t)(length - (uint16_t)((blocks - 1U) * SECOC_SRV_AES_BLOCK));
+    if (length != 0U && last == SECOC_SRV_AES_BLOCK) {
+        for (uint32_t i = 0; i < SECOC_SRV_AES_BLOCK; i++) {
+            mac[i] ^= (uint8_t)(p[i] ^ s_k1[i]);
+        }
+    } else {
+        for (uint32_t i = 0; i < SECOC_SRV_AES_BLOCK; i++) {
+            uint8_t byte = (i < last) ? p[i] : ((i == last) ? 0x80U : 0x00U);
+            mac[i] ^= (uint8_t)(byte ^ s_k2[i]);
+        }
+    }
+    SECOC_SRV_AesEncrypt(mac);
+}
+
+/*******************************************************************************
+ * Private Functions - Protocol
+ ******************************************************************************/
+
+/**
+ * @brief MAC with the selected engine, software while CSEc is busy
+ */
+static secoc_srv_status_t SECOC_SRV_Mac(const uint8_t *msg, uint16_t length, uint8_t *mac)
+{
+    uint32_t start = DWT_GetCycles();
+    uint32_t cycles;
+    csec_status_t status;
+
+    if (s_engine == SECOC_SRV_ENGINE_CSEC) {
+        status = CSEC_GenerateMac(CSEC_KEY_RAM, msg, length, mac);
+        if (status == CSEC_STATUS_BUSY) {
+            s_stats.sw_fallbacks++;
+            SECOC_SRV_SoftwareCmac(msg, length, mac);
+        } else if (status != CSEC_STATUS_SUCCESS) {
+            return SECOC_SRV_ERROR;
+        }
+    } else {
+        SECOC_SRV_SoftwareCmac(msg, length, mac);
+    }
+
+    cycles = DWT_GetCycles() - start;
+    if (cycles > s_stats.max_mac_cycles) {
+        s_stats.max_mac_cycles = cycles;
+    }
+
+    return SECOC_SRV_SUCCESS;
+}
+
+/**
+ * @brief MAC over DataID | data | freshness
+ */
+static secoc_srv_status_t SECOC_SRV_Authenticate(const secoc_srv_pdu_t *pdu, const uint8_t *data,
+                                                 uint32_t freshness, uint8_t *mac)
+{
+    uint8_t input[SECOC_SRV_MAC_INPUT_MAX];
+    uint8_t n = 0;
+
+    input[n++] = (uint8_t)(pdu->cfg.data_id >> 8);
+    input[n++] = (uint8_t)pdu->cfg.data_id;
+    memcpy(&input[n], data, pdu->cfg.data_length);
+    n = (uint8_t)(n + pdu->cfg.data_length);
+    input[n++] = (uint8_t)(freshness >> 24);
+    input[n++] = (uint8_t)(freshness >> 16);
+    input[n++] = (uint8_t)(freshness >> 8);
+    input[n++] = (uint8_t)freshness;
+
+    return SECOC_SRV_Mac(input, n, mac);
+}
+
+/**
+ * @brief Constant-time compare of the truncated MAC
+ */
+static bool SECOC_SRV_MacEqual(const uint8_t *a, const uint8_t *b, uint8_t length)
+{
+    uint8_t diff = 0;
+
+    for (uint8_t i = 0; i < length; i++) {
+        diff |= (uint8_t)(a[i] ^ b[i]);
+    }
+
+    return diff == 0U;
+}
+
+/**
+ * @brief Rebuild the full freshness value from its transmitted low bytes
+ * @details Smallest value above the last accepted one with those low bytes.
+ */
+static uint32_t SECOC_SRV_RebuildFreshness(const secoc_srv_pdu_t *pdu, const uint8_t *fv)
+{
+    uint32_t received = 0;
+    uint32_t mask;
+    uint32_t candidate;
+
+    if (pdu->cfg.fv_bytes == 0U) {
+        return pdu->freshness + 1U;
+    }
+
+    for (uint8_t i = 0; i < pdu->cfg.fv_bytes; i++) {
+        received = (received << 8) | fv[i];
+    }
+
+    if (pdu->cfg.fv_bytes >= SECOC_SRV_FV_SIZE) {
+        return received;
+    }
+
+    mask = (1UL << (8U * pdu->cfg.fv_bytes)) - 1U;
+    candidate = (pdu->freshness & ~mask) | received;
+    if (candidate <= pdu->freshness) {
+        candidate += mask + 1U;
+    }
+
+    return candidate;
+}
+
+static void SECOC_SRV_Verify(const secoc_srv_frame_t *frame)
+{
+    secoc_srv_pdu_t *pdu = &s_pdus[frame->pdu];
+    const uint8_t *fv = &frame->data[pdu->cfg.data_length];
+    const uint8_t *mac_rx = fv + pdu->cfg.fv_bytes;
+    uint8_t mac[SECOC_SRV_MAC_SIZE];
+    uint32_t freshness;
+
+    if (frame->dlc < (uint8_t)(pdu->cfg.data_length + pdu->cfg.fv_bytes + pdu->cfg.mac_bytes)) {
+        s_stats.rx_rejected++;
+        return;
+    }
+
+    freshness = SECOC_SRV_RebuildFreshness(pdu, fv);
+
+    /* Full freshness value must be strictly newer once synchronised */
+    if ((pdu->synced && freshness <= pdu->freshness) ||
+        SECOC_SRV_Authenticate(pdu, frame->data, freshness, mac) != SECOC_SRV_SUCCESS ||
+        !SECOC_SRV_MacEqual(mac, mac_rx, pdu->cfg.mac_bytes)) {
+        s_stats.rx_rejected++;
+        return;
+    }
+
+    pdu->freshness = freshness;
+    pdu->synced = true;
+    s_stats.rx_authentic++;
+
+    if (pdu->cfg.on_rx != NULL) {
+        pdu->cfg.on_rx(frame->pdu, frame->data, freshness);
+    }
+}
+
+/**
+ * @brief can_srv listener: queue frames of RX PDUs
+ */
+static void SECOC_SRV_CANCallback(uint8_t instance, can_srv_event_t event, const can_srv_message_t *msg)
+{
+    secoc_srv_frame_t *frame;
+    uint8_t next;
+
+    (void)instance;
+
+    if (event != CAN_SRV_EVENT_RX_COMPLETE || msg == NULL || msg->isRemote) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < s_pdu_count; i++) {
+        if (s_pdus[i].cfg.direction != SECOC_SRV_DIR_RX || s_pdus[i].cfg.can_id != msg->id ||
+            s_pdus[i].cfg.extended != msg->isExtended) {
+            continue;
+        }
+
+        next = (uint8_t)((s_head + 1U) % SECOC_SRV_RX_QUEUE_LEN);
+        if (next == s_tail) {
+            s_stats.rx_overruns++;
+            return;
+        }
+
+        frame = &s_queue[s_head];
+        frame->pdu = i;
+        frame->dlc = msg->dlc;
+        memcpy(frame->data, msg->data, SECOC_SRV_FRAME_SIZE);
+        s_head = next;
+        return;
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+secoc_srv_status_t SECOC_SRV_Init(const secoc_srv_config_t *config)
+{
+    csec_status_t status;
+
+    if (s_initialized) {
+        return SECOC_SRV_SUCCESS;
+    }
+
+    if (config == NULL || config->key == NULL || config->engine > SECOC_SRV_ENGINE_SW) {
+        return SECOC_SRV_INVALID_PARAM;
+    }
+
+    /* Software engine is always ready: fallback while CSEc is busy */
+    SECOC_SRV_SoftwareSetKey(config->key);
+
+    s_engine = SECOC_SRV_ENGINE_SW;
+    if (config->engine != SECOC_SRV_ENGINE_SW) {
+        status = CSEC_LoadPlainKey(config->key);
+        if (status == CSEC_STATUS_SUCCESS) {
+            s_engine = SECOC_SRV_ENGINE_CSEC;
+        } else if (config->engine == SECOC_SRV_ENGINE_CSEC) {
+            return SECOC_SRV_ERROR;
+        }
+    }
+
+    if (CAN_SRV_AllocTxMailbox(&s_mailbox) != CAN_SRV_SUCCESS) {
+        return SECOC_SRV_NO_RESOURCE;
+    }
+
+    if (CAN_SRV_RegisterCallback(SECOC_SRV_CANCallback) != CAN_SRV_SUCCESS) {
+        return SECOC_SRV_ERROR;
+    }
+
+    DWT_CycleCounterStart();
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_initialized = true;
+
+    return SECOC_SRV_SUCCESS;
+}
+
+secoc_srv_status_t SECOC_SRV_AddPdu(const secoc_srv_pdu_config_t *config, uint8_t *pdu)
+{
+    if (!s_initialized) {
+        return SECOC_SRV_NOT_INITIALIZED;
+    }
+
+    if (config == NULL || pdu == NULL || config->fv_bytes > SECOC_SRV_FV_SIZE ||
+        config->mac_bytes < SECOC_SRV_MIN_MAC_BYTES ||
+        ((uint32_t)config->data_length + config->fv_bytes + config->mac_bytes) > SECOC_SRV_FRAME_SIZE ||
+        (config->direction == SECOC_SRV_DIR_RX && config->on_rx == NULL)) {
+        return SECOC_SRV_INVALID_PARAM;
+    }
+
+    if (s_pdu_count >= SECOC_SRV_MAX_PDUS) {
+        return SECOC_SRV_NO_RESOURCE;
+    }
+
+    if (config->direction == SECOC_SRV_DIR_RX &&
+        CAN_SRV_AddRxFilter(config->can_id, config->extended ? 0x1FFFFFFFUL : 0x7FFUL,
+                            config->extended) != CAN_SRV_SUCCESS) {
+        return SECOC_SRV_NO_RESOURCE;
+    }
+
+    s_pdus[s_pdu_count].cfg = *config;
+    s_pdus[s_pdu_count].freshness = 0U;
+    s_pdus[s_pdu_count].synced = false;
+    *pdu = s_pdu_count;
+    s_pdu_count++;
+
+    return SECOC_SRV_SUCCESS;
+}
+
+secoc_srv_status_t SECOC_SRV_Send(uint8_t pdu, const uint8_t *data)
+{
+    can_srv_message_t msg;
+    secoc_srv_pdu_t *p;
+    uint8_t mac[SECOC_SRV_MAC_SIZE];
+    uint32_t freshness;
+    uint8_t n;
+
+    if (!s_initialized) {
+        return SECOC_SRV_NOT_INITIALIZED;
+    }
+
+    if (pdu >= s_pdu_count || data == NULL || s_pdus[pdu].cfg.direction != SECOC_SRV_DIR_TX) {
+        return SECOC_SRV_INVALID_PARAM;
+    }
+
+    p = &s_pdus[pdu];
+    freshness = p->freshness + 1U;
+
+    if (SECOC_SRV_Authenticate(p, data, freshness, mac) != SECOC_SRV_SUCCESS) {
+        return SECOC_SRV_ERROR;
+    }
+
+    msg.id = p->cfg.can_id;
+    msg.isExtended = p->cfg.extended;
+    msg.isRemote = false;
+    memcpy(msg.data, data, p->cfg.data_length);
+    n = p->cfg.data_length;
+    for (uint8_t i = p->cfg.fv_bytes; i > 0U; i--) {
+        msg.data[n++] = (uint8_t)(freshness >> (8U * (i - 1U)));
+    }
+    memcpy(&msg.data[n], mac, p->cfg.mac_bytes);
+    msg.dlc = (uint8_t)(n + p->cfg.mac_bytes);
+
+    switch (CAN_SRV_SendOn(s_mailbox, &msg)) {
+        case CAN_SRV_SUCCESS:
+            break;
+
+        case CAN_SRV_BUSY:
+            return SECOC_SRV_BUSY;
+
+        default:
+            return SECOC_SRV_ERROR;
+    }
+
+    p->freshness = freshness;
+    s_stats.tx_frames++;
+
+    return SECOC_SRV_SUCCESS;
+}
+
+void SECOC_SRV_Process(void)
+{
+    while (s_tail != s_head) {
+        SECOC_SRV_Verify(&s_queue[s_tail]);
+        s_tail = (uint8_t)((s_tail + 1U) % SECOC_SRV_RX_QUEUE_LEN);
+    }
+}
+
+secoc_srv_status_t SECOC_SRV_SetFreshness(uint8_t pdu, uint32_t value)
+{
+    if (pdu >= s_pdu_count) {
+        return SECOC_SRV_INVALID_PARAM;
+    }
+
+    s_pdus[pdu].freshness = value;
+    s_pdus[pdu].synced = true;
+
+    return SECOC_SRV_SUCCESS;
+}
+
+uint32_t SECOC_SRV_GetFreshness(uint8_t pdu)
+{
+    return (pdu < s_pdu_count) ? s_pdus[pdu].freshness : 0U;
+}
+
+secoc_srv_status_t SECOC_SRV_ComputeMac(secoc_srv_engine_t engine, const uint8_t *msg,
+                                        uint16_t length, uint8_t *mac)
+{
+    if (!s_initialized) {
+        return SECOC_SRV_NOT_INITIALIZED;
+    }
+
+    if ((msg == NULL && length != 0U) || mac == NULL) {
+        return SECOC_SRV_INVALID_PARAM;
+    }
+
+    if (engine == SECOC_SRV_ENGINE_AUTO) {
+        engine = s_engine;
+    }
+
+    if (engine == SECOC_SRV_ENGINE_SW) {
+        SECOC_SRV_SoftwareCmac(msg, length, mac);
+        return SECOC_SRV_SUCCESS;
+    }
+
+    if (s_engine != SECOC_SRV_ENGINE_CSEC) {
+        return SECOC_SRV_ERROR;
+    }
+
+    switch (CSEC_GenerateMac(CSEC_KEY_RAM, msg, length, mac)) {
+        case CSEC_STATUS_SUCCESS:
+            return SECOC_SRV_SUCCESS;
+
+        case CSEC_STATUS_BUSY:
+            return SECOC_SRV_BUSY;
+
+        case CSEC_STATUS_INVALID_PARAM:
+            return SECOC_SRV_INVALID_PARAM;
+
+        default:
+            return SECOC_SRV_ERROR;
+    }
+}
+
+secoc_srv_engine_t SECOC_SRV_GetEngine(void)
+{
+    return s_engine;
+}
+
+secoc_srv_status_t SECOC_SRV_GetStats(secoc_srv_stats_t *stats)
+{
+    if (stats == NULL) {
+        return SECOC_SRV_INVALID_PARAM;
+    }
+
+    if (!s_initialized) {
+        return SECOC_SRV_NOT_INITIALIZED;
+    }
+
+    *stats = s_stats;
+
+    return SECOC_SRV_SUCCESS;
+}
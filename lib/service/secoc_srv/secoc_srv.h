@@ -0,0 +1,205 @@
+/**
+ * @file    secoc_srv.h
+ * @brief   SecOC Service - Abstraction API
+ * @details
+ * Secure onboard communication (AUTOSAR SecOC style) on classic CAN
+ * frames, on top of can_srv:
+ * - Each secured PDU carries its authentic data, the low bytes of a
+ *   32-bit freshness value and the first bytes of an AES-128 CMAC:
+ *     [ data (data_length) | FV (fv_bytes) | MAC (mac_bytes) ] <= 8 bytes
+ * - The MAC covers DataID (2 bytes) | data | full freshness value
+ *   (4 bytes, big-endian), i.e. at most one AES block for a CAN frame
+ * - The receiver rebuilds the full freshness value from its last
+ *   accepted value and only accepts a strictly newer one, so a recorded
+ *   frame cannot be replayed
+ *
+ * MACs are computed by the CSEc engine with the key in its RAM_KEY slot.
+ * A software AES-128/CMAC gives the same result; it is used when CSEc is
+ * not available (FlexNVM not partitioned for keys, host builds), when
+ * selected explicitly, and for single frames while the flash controller
+ * is busy with an EEE or flash command.
+ *
+ * Received frames are only queued by the CAN interrupt; verification and
+ * the PDU callbacks run in SECOC_SRV_Process(). This keeps the CSEc
+ * command interface to one context and MAC work out of interrupts.
+ *
+ * Freshness values start at 0 after reset. A sender that must survive
+ * resets restores its last value with SECOC_SRV_SetFreshness() (see
+ * app_b2). After a receiver reset, the first authentic frame is accepted
+ * whatever its freshness value.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef SECOC_SRV_H
+#define SECOC_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Limits */
+#define SECOC_SRV_MAX_PDUS          (8U)
+#define SECOC_SRV_RX_QUEUE_LEN      (8U)            /* Frames between two Process passes */
+#define SECOC_SRV_KEY_SIZE          (16U)
+#define SECOC_SRV_MAC_SIZE          (16U)
+#define SECOC_SRV_MIN_MAC_BYTES     (3U)            /* 24-bit MAC, as in SecOC profile 1 */
+#define SECOC_SRV_FRAME_SIZE        (8U)
+#define SECOC_SRV_NO_PDU            (0xFFU)
+
+/**
+ * @brief SecOC service status codes
+ */
+typedef enum {
+    SECOC_SRV_SUCCESS = 0,          /**< Operation successful */
+    SECOC_SRV_ERROR,                /**< General error, CSEc command failed */
+    SECOC_SRV_NOT_INITIALIZED,      /**< Service not initialized */
+    SECOC_SRV_INVALID_PARAM,        /**< Invalid parameter or PDU layout */
+    SECOC_SRV_NO_RESOURCE,          /**< No PDU slot, mailbox or filter left */
+    SECOC_SRV_BUSY                  /**< Previous frame not sent yet */
+} secoc_srv_status_t;
+
+/**
+ * @brief MAC engine
+ */
+typedef enum {
+    SECOC_SRV_ENGINE_AUTO = 0,      /**< CSEc if the key can be loaded, else software */
+    SECOC_SRV_ENGINE_CSEC,          /**< CSEc, Init fails if unavailable */
+    SECOC_SRV_ENGINE_SW             /**< Software AES-128 */
+} secoc_srv_engine_t;
+
+/**
+ * @brief PDU direction
+ */
+typedef enum {
+    SECOC_SRV_DIR_TX = 0,
+    SECOC_SRV_DIR_RX
+} secoc_srv_dir_t;
+
+/**
+ * @brief Authentic PDU received (main loop context)
+ * @param pdu PDU handle
+ * @param data Authentic data (data_length bytes)
+ * @param freshness Full freshness value of the frame
+ */
+typedef void (*secoc_srv_rx_callback_t)(uint8_t pdu, const uint8_t *data, uint32_t freshness);
+
+/**
+ * @brief Secured PDU configuration
+ */
+typedef struct {
+    uint32_t can_id;
+    bool extended;
+    secoc_srv_dir_t direction;
+    uint16_t data_id;               /**< Authenticated with the data, same on both ends */
+    uint8_t data_length;            /**< Authentic data bytes */
+    uint8_t fv_bytes;               /**< Freshness bytes sent, 0-4 (0 = strict +1 sequence) */
+    uint8_t mac_bytes;              /**< MAC bytes sent, SECOC_SRV_MIN_MAC_BYTES or more */
+    secoc_srv_rx_callback_t on_rx;  /**< RX PDUs only */
+} secoc_srv_pdu_config_t;
+
+/**
+ * @brief Service configuration
+ */
+typedef struct {
+    const uint8_t *key;             /**< 16-byte AES key, copied */
+    secoc_srv_engine_t engine;
+} secoc_srv_config_t;
+
+/**
+ * @brief Service statistics
+ */
+typedef struct {
+    uint32_t tx_frames;
+    uint32_t rx_authentic;
+    uint32_t rx_rejected;           /**< Wrong MAC or stale freshness */
+    uint32_t rx_overruns;           /**< Frames lost, Process called too rarely */
+    uint32_t sw_fallbacks;          /**< MACs computed in software while CSEc was busy */
+    uint32_t max_mac_cycles;        /**< Worst MAC computation, core cycles */
+} secoc_srv_stats_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the service and load the key
+ * @details CAN_SRV_Init() must have been called. Further calls return
+ *          SECOC_SRV_SUCCESS and keep the first key, so components sharing
+ *          a node (app_node) may each call it.
+ * @param config Configuration
+ * @return secoc_srv_status_t Status of initialization
+ */
+secoc_srv_status_t SECOC_SRV_Init(const secoc_srv_config_t *config);
+
+/**
+ * @brief Add a secured PDU
+ * @details RX PDUs add a hardware filter for their CAN ID.
+ * @param config PDU configuration (copied)
+ * @param pdu Receives the PDU handle
+ * @return secoc_srv_status_t Status of operation
+ */
+secoc_srv_status_t SECOC_SRV_AddPdu(const secoc_srv_pdu_config_t *config, uint8_t *pdu);
+
+/**
+ * @brief Authenticate and send a TX PDU
+ * @details The freshness value is only consumed when the frame is queued.
+ * @param pdu PDU handle
+ * @param data data_length bytes of authentic data
+ * @return secoc_srv_status_t SECOC_SRV_BUSY if the mailbox is still pending
+ */
+secoc_srv_status_t SECOC_SRV_Send(uint8_t pdu, const uint8_t *data);
+
+/**
+ * @brief Verify queued frames and call the PDU callbacks
+ * @details Call from the main loop.
+ */
+void SECOC_SRV_Process(void);
+
+/**
+ * @brief Set the freshness value of a PDU
+ * @details TX: last value sent. RX: last value accepted.
+ */
+secoc_srv_status_t SECOC_SRV_SetFreshness(uint8_t pdu, uint32_t value);
+
+/**
+ * @brief Get the freshness value of a PDU
+ * @return uint32_t Last value sent (TX) or accepted (RX), 0 if invalid
+ */
+uint32_t SECOC_SRV_GetFreshness(uint8_t pdu);
+
+/**
+ * @brief Compute a full AES-128 CMAC with the service key
+ * @details Used by the benchmark to compare engines; SECOC_SRV_ENGINE_AUTO
+ *          uses the engine selected at init.
+ * @param engine Engine to use
+ * @param msg Message
+ * @param length Message length in bytes (CSEc: up to 112)
+ * @param mac Receives SECOC_SRV_MAC_SIZE bytes
+ * @return secoc_srv_status_t SECOC_SRV_BUSY if CSEc was requested and busy
+ */
+secoc_srv_status_t SECOC_SRV_ComputeMac(secoc_srv_engine_t engine, const uint8_t *msg,
+                                        uint16_t length, uint8_t *mac);
+
+/**
+ * @brief Get the engine selected at init
+ * @return secoc_srv_engine_t SECOC_SRV_ENGINE_CSEC or SECOC_SRV_ENGINE_SW
+ */
+secoc_srv_engine_t SECOC_SRV_GetEngine(void);
+
+/**
+ * @brief Get service statistics
+ * @param stats Output
+ * @return secoc_srv_status_t Status of operation
+ */
+secoc_srv_status_t SECOC_SRV_GetStats(secoc_srv_stats_t *stats);
+
+#endif /* SECOC_SRV_H */
@@ -0,0 +1,417 @@
+/**
+ * @file    trgmux_srv.c
+ * @brief   Trigger Routing Service Implementation
+ * @details Route table validation and apply on top of the TRGMUX driver
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "trgmux_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef struct {
+    trgmux_target_t target;
+    const char *name;
+} trgmux_srv_target_info_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/* Indexed by selector value, NULL for reserved values */
+static const char * const s_source_names[TRGMUX_SOURCE_COUNT] = {
+    "DISABLED",           /*  0 */
+    "VDD",                /*  1 */
+    "TRGMUX_IN0",         /*  2 */
+    "TRGMUX_IN1",         /*  3 */
+    "TRGMUX_IN2",         /*  4 */
+    "TRGMUX_IN3",         /*  5 */
+    "TRGMUX_IN4",         /*  6 */
+    "TRGMUX_IN5",         /*  7 */
+    "TRGMUX_IN6",         /*  8 */
+    "TRGMUX_IN7",         /*  9 */
+    "TRGMUX_IN8",         /* 10 */
+    "TRGMUX_IN9",         /* 11 */
+    "TRGMUX_IN10",        /* 12 */
+    "TRGMUX_IN11",        /* 13 */
+    "CMP0_OUT",           /* 14 */
+    NULL,                 /* 15 */
+    NULL,                 /* 16 */
+    "LPIT_CH0",           /* 17 */
+    "LPIT_CH1",           /* 18 */
+    "LPIT_CH2",           /* 19 */
+    "LPIT_CH3",           /* 20 */
+    "LPTMR0",             /* 21 */
+    "FTM0_INIT",          /* 22 */
+    "FTM0_EXT",           /* 23 */
+    "FTM1_INIT",          /* 24 */
+    "FTM1_EXT",           /* 25 */
+    "FTM2_INIT",          /* 26 */
+    "FTM2_EXT",           /* 27 */
+    "FTM3_INIT",          /* 28 */
+    "FTM3_EXT",           /* 29 */
+    "ADC0_SC1A_COCO",     /* 30 */
+    "ADC0_SC1B_COCO",     /* 31 */
+    "ADC1_SC1A_COCO",     /* 32 */
+    "ADC1_SC1B_COCO",     /* 33 */
+    "PDB0_CH0_TRIG",      /* 34 */
+    NULL,                 /* 35 */
+    "PDB0_PULSE_OUT",     /* 36 */
+    "PDB1_CH0_TRIG",      /* 37 */
+    NULL,                 /* 38 */
+    "PDB1_PULSE_OUT",     /* 39 */
+    NULL,                 /* 40 */
+    NULL,                 /* 41 */
+    NULL,                 /* 42 */
+    "RTC_ALARM",          /* 43 */
+    "RTC_SECOND",         /* 44 */
+    "FLEXIO_TRIG0",       /* 45 */
+    "FLEXIO_TRIG1",       /* 46 */
+    "FLEXIO_TRIG2",       /* 47 */
+    "FLEXIO_TRIG3",       /* 48 */
+    "LPUART0_RX_DATA",    /* 49 */
+    "LPUART0_TX_DATA",    /* 50 */
+    "LPUART0_RX_IDLE",    /* 51 */
+    "LPUART1_RX_DATA",    /* 52 */
+    "LPUART1_TX_DATA",    /* 53 */
+    "LPUART1_RX_IDLE",    /* 54 */
+    "LPI2C0_MASTER",      /* 55 */
+    "LPI2C0_SLAVE",       /* 56 */
+    NULL,                 /* 57 */
+    NULL,                 /* 58 */
+    "LPSPI0_FRAME",       /* 59 */
+    "LPSPI0_RX_DATA",     /* 60 */
+    "LPSPI1_FRAME",       /* 61 */
+    "LPSPI1_RX_DATA",     /* 62 */
+    "SIM_SW_TRIG",        /* 63 */
+};
+
+/* Every implemented target, in register order */
+static const trgmux_srv_target_info_t s_targets[] = {
+    { TRGMUX_TARGET_DMA_CH0,         "DMA_CH0" },
+    { TRGMUX_TARGET_DMA_CH1,         "DMA_CH1" },
+    { TRGMUX_TARGET_DMA_CH2,         "DMA_CH2" },
+    { TRGMUX_TARGET_DMA_CH3,         "DMA_CH3" },
+    { TRGMUX_TARGET_TRGMUX_OUT0,     "TRGMUX_OUT0" },
+    { TRGMUX_TARGET_TRGMUX_OUT1,     "TRGMUX_OUT1" },
+    { TRGMUX_TARGET_TRGMUX_OUT2,     "TRGMUX_OUT2" },
+    { TRGMUX_TARGET_TRGMUX_OUT3,     "TRGMUX_OUT3" },
+    { TRGMUX_TARGET_TRGMUX_OUT4,     "TRGMUX_OUT4" },
+    { TRGMUX_TARGET_TRGMUX_OUT5,     "TRGMUX_OUT5" },
+    { TRGMUX_TARGET_TRGMUX_OUT6,     "TRGMUX_OUT6" },
+    { TRGMUX_TARGET_TRGMUX_OUT7,     "TRGMUX_OUT7" },
+    { TRGMUX_TARGET_ADC0_ADHWT_TLA0, "ADC0_ADHWT_TLA0" },
+    { TRGMUX_TARGET_ADC0_ADHWT_TLA1, "ADC0_ADHWT_TLA1" },
+    { TRGMUX_TARGET_ADC0_ADHWT_TLA2, "ADC0_ADHWT_TLA2" },
+    { TRGMUX_TARGET_ADC0_ADHWT_TLA3, "ADC0_ADHWT_TLA3" },
+    { TRGMUX_TARGET_ADC1_ADHWT_TLA0, "ADC1_ADHWT_TLA0" },
+    { TRGMUX_TARGET_ADC1_ADHWT_TLA1, "ADC1_ADHWT_TLA1" },
+    { TRGMUX_TARGET_ADC1_ADHWT_TLA2, "ADC1_ADHWT_TLA2" },
+    { TRGMUX_TARGET_ADC1_ADHWT_TLA3, "ADC1_ADHWT_TLA3" },
+    { TRGMUX_TARGET_CMP0_SAMPLE,     "CMP0_SAMPLE" },
+    { TRGMUX_TARGET_FTM0_HWTRIG0,    "FTM0_HWTRIG0" },
+    { TRGMUX_TARGET_FTM0_FAULT0,     "FTM0_FAULT0" },
+    { TRGMUX_TARGET_FTM0_FAULT1,     "FTM0_FAULT1" },
+    { TRGMUX_TARGET_FTM0_FAULT2,     "FTM0_FAULT2" },
+    { TRGMUX_TARGET_FTM1_HWTRIG0,    "FTM1_HWTRIG0" },
+    { TRGMUX_TARGET_FTM1_FAULT0,     "FTM1_FAULT0" },
+    { TRGMUX_TARGET_FTM1_FAULT1,     "FTM1_FAULT1" },
+    { TRGMUX_TARGET_FTM1_FAULT2,     "FTM1_FAULT2" },
+    { TRGMUX_TARGET_FTM2_HWTRIG0,    "FTM2_HWTRIG0" },
+    { TRGMUX_TARGET_FTM2_FAULT0,     "FTM2_FAULT0" },
+    { TRGMUX_TARGET_FTM2_FAULT1,     "FTM2_FAULT1" },
+    { TRGMUX_TARGET_FTM2_FAULT2,     "FTM2_FAULT2" },
+    { TRGMUX_TARGET_FTM3_HWTRIG0,    "FTM3_HWTRIG0" },
+    { TRGMUX_TARGET_FTM3_FAULT0,     "FTM3_FAULT0" },
+    { TRGMUX_TARGET_FTM3_FAULT1,     "FTM3_FAULT1" },
+    { TRGMUX_TARGET_FTM3_FAULT2,     "FTM3_FAULT2" },
+    { TRGMUX_TARGET_PDB0_TRG_IN,     "PDB0_TRG_IN" },
+    { TRGMUX_TARGET_PDB1_TRG_IN,     "PDB1_TRG_IN" },
+    { TRGMUX_TARGET_FLEXIO_TRG_TIM0, "FLEXIO_TRG_TIM0" },
+    { TRGMUX_TARGET_FLEXIO_TRG_TIM1, "FLEXIO_TRG_TIM1" },
+    { TRGMUX_TARGET_FLEXIO_TRG_TIM2, "FLEXIO_TRG_TIM2" },
+    { TRGMUX_TARGET_FLEXIO_TRG_TIM3, "FLEXIO_TRG_TIM3" },
+    { TRGMUX_TARGET_LPIT_TRG_CH0,    "LPIT_TRG_CH0" },
+    { TRGMUX_TARGET_LPIT_TRG_CH1,    "LPIT_TRG_CH1" },
+    { TRGMUX_TARGET_LPIT_TRG_CH2,    "LPIT_TRG_CH2" },
+    { TRGMUX_TARGET_LPIT_TRG_CH3,    "LPIT_TRG_CH3" },
+    { TRGMUX_TARGET_LPUART0_TRG,     "LPUART0_TRG" },
+    { TRGMUX_TARGET_LPUART1_TRG,     "LPUART1_TRG" },
+    { TRGMUX_TARGET_LPI2C0_TRG,      "LPI2C0_TRG" },
+    { TRGMUX_TARGET_LPSPI0_TRG,      "LPSPI0_TRG" },
+    { TRGMUX_TARGET_LPSPI1_TRG,      "LPSPI1_TRG" },
+    { TRGMUX_TARGET_LPTMR0_ALT0,     "LPTMR0_ALT0" }
+};
+
+#define TRGMUX_SRV_TARGET_COUNT     (sizeof(s_targets) / sizeof(s_targets[0]))
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static const trgmux_srv_target_info_t *TRGMUX_SRV_FindTarget(trgmux_target_t target)
+{
+    for (uint8_t i = 0; i < TRGMUX_SRV_TARGET_COUNT; i++) {
+        if (s_targets[i].target == target) {
+            return &s_targets[i];
+        }
+    }
+
+    return NULL;
+}
+
+static bool TRGMUX_SRV_IsSourceValid(trgmux_source_t source)
+{
+    return source != TRGMUX_SOURCE_DISABLED &&
+           (uint32_t)source < TRGMUX_SOURCE_COUNT &&
+           s_source_names[source] != NULL;
+}
+
+/**
+ * @brief ADC instance of an ADCx_ADHWT_TLAn target, 0xFF otherwise
+ */
+static uint8_t TRGMUX_SRV_AdcOf(trgmux_target_t target)
+{
+    uint8_t index = TRGMUX_TARGET_INDEX(target);
+
+    if (index == TRGMUX_ADC0_INDEX) {
+        return 0U;
+    }
+    if (index == TRGMUX_ADC1_INDEX) {
+        return 1U;
+    }
+
+    return 0xFFU;
+}
+
+/**
+ * @brief Fall back to the PDB trigger path once no TRGMUX target of an
+ *        ADC is routed any more
+ */
+static void TRGMUX_SRV_UpdateAdcPath(uint8_t adc)
+{
+    trgmux_target_t first = (adc == 0U) ? TRGMUX_TARGET_ADC0_ADHWT_TLA0 : TRGMUX_TARGET_ADC1_ADHWT_TLA0;
+
+    for (uint8_t sel = 0; sel < TRGMUX_TRGMUXn_SEL_COUNT; sel++) {
+        if (TRGMUX_GetSource((trgmux_target_t)(first + sel)) != TRGMUX_SOURCE_DISABLED) {
+            return;
+        }
+    }
+
+    (void)TRGMUX_SetAdcTriggerPath(adc, TRGMUX_ADC_TRIGGER_PDB);
+}
+
+/**
+ * @brief Check route n of a table against the earlier routes and the hardware
+ */
+static trgmux_srv_status_t TRGMUX_SRV_CheckRoute(const trgmux_srv_route_t *routes, uint8_t n)
+{
+    trgmux_source_t current;
+
+    if (!TRGMUX_SRV_IsSourceValid(routes[n].source) ||
+        TRGMUX_SRV_FindTarget(routes[n].target) == NULL) {
+        return TRGMUX_SRV_INVALID_PARAM;
+    }
+
+    /* One source per target */
+    for (uint8_t i = 0; i < n; i++) {
+        if (routes[i].target == routes[n].target) {
+            return TRGMUX_SRV_CONFLICT;
+        }
+    }
+
+    /* Already active with the same source is fine, even when locked */
+    current = TRGMUX_GetSource(routes[n].target);
+    if (current == routes[n].source) {
+        return TRGMUX_SRV_SUCCESS;
+    }
+    if (TRGMUX_IsLocked(routes[n].target)) {
+        return TRGMUX_SRV_LOCKED;
+    }
+    if (current != TRGMUX_SOURCE_DISABLED) {
+        return TRGMUX_SRV_CONFLICT;
+    }
+
+    return TRGMUX_SRV_SUCCESS;
+}
+
+static char *TRGMUX_SRV_Append(char *dst, const char *end, const char *str)
+{
+    while (*str != '\0' && dst < end) {
+        *dst++ = *str++;
+    }
+
+    return dst;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+trgmux_srv_status_t TRGMUX_SRV_Validate(const trgmux_srv_route_t *routes, uint8_t count,
+                                        uint8_t *failed)
+{
+    trgmux_srv_status_t status;
+
+    if (routes == NULL) {
+        return TRGMUX_SRV_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        status = TRGMUX_SRV_CheckRoute(routes, i);
+        if (status != TRGMUX_SRV_SUCCESS) {
+            if (failed != NULL) {
+                *failed = i;
+            }
+            return status;
+        }
+    }
+
+    return TRGMUX_SRV_SUCCESS;
+}
+
+trgmux_srv_status_t TRGMUX_SRV_Apply(const trgmux_srv_route_t *routes, uint8_t count, bool lock)
+{
+    trgmux_srv_status_t status;
+    uint8_t adc;
+
+    status = TRGMUX_SRV_Validate(routes, count, NULL);
+    if (status != TRGMUX_SRV_SUCCESS) {
+        return status;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (TRGMUX_GetSource(routes[i].target) != routes[i].source &&
+            TRGMUX_SetSource(routes[i].target, routes[i].source) != TRGMUX_STATUS_SUCCESS) {
+            return TRGMUX_SRV_ERROR;
+        }
+
+        adc = TRGMUX_SRV_AdcOf(routes[i].target);
+        if (adc != 0xFFU) {
+            (void)TRGMUX_SetAdcTriggerPath(adc, TRGMUX_ADC_TRIGGER_TRGMUX);
+        }
+    }
+
+    /* Lock after all writes: one register may hold several routes */
+    if (lock) {
+        for (uint8_t i = 0; i < count; i++) {
+            (void)TRGMUX_Lock(routes[i].target);
+        }
+    }
+
+    return TRGMUX_SRV_SUCCESS;
+}
+
+trgmux_srv_status_t TRGMUX_SRV_Remove(const trgmux_srv_route_t *routes, uint8_t count)
+{
+    bool adc_touched[2] = { false, false };
+    uint8_t adc;
+
+    if (routes == NULL) {
+        return TRGMUX_SRV_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (TRGMUX_SRV_FindTarget(routes[i].target) == NULL) {
+            return TRGMUX_SRV_INVALID_PARAM;
+        }
+        if (TRGMUX_IsLocked(routes[i].target)) {
+            return TRGMUX_SRV_LOCKED;
+        }
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        (void)TRGMUX_SetSource(routes[i].target, TRGMUX_SOURCE_DISABLED);
+
+        adc = TRGMUX_SRV_AdcOf(routes[i].target);
+        if (adc != 0xFFU) {
+            adc_touched[adc] = true;
+        }
+    }
+
+    for (adc = 0; adc < 2U; adc++) {
+        if (adc_touched[adc]) {
+            TRGMUX_SRV_UpdateAdcPath(adc);
+        }
+    }
+
+    return TRGMUX_SRV_SUCCESS;
+}
+
+uint8_t TRGMUX_SRV_Query(trgmux_srv_route_t *routes, uint8_t max)
+{
+    trgmux_source_t source;
+    uint8_t found = 0;
+
+    for (uint8_t i = 0; i < TRGMUX_SRV_TARGET_COUNT; i++) {
+        source = TRGMUX_GetSource(s_targets[i].target);
+        if (source == TRGMUX_SOURCE_DISABLED) {
+            continue;
+        }
+
+        if (routes != NULL && found < max) {
+            routes[found].source = source;
+            routes[found].target = s_targets[i].target;
+        }
+        found++;
+    }
+
+    return found;
+}
+
+uint8_t TRGMUX_SRV_Dump(trgmux_srv_print_t print)
+{
+    char line[TRGMUX_SRV_LINE_MAX];
+    const char *end = &line[TRGMUX_SRV_LINE_MAX - 1U];
+    trgmux_source_t source;
+    uint8_t found = 0;
+    char *p;
+
+    for (uint8_t i = 0; i < TRGMUX_SRV_TARGET_COUNT; i++) {
+        source = TRGMUX_GetSource(s_targets[i].target);
+        if (source == TRGMUX_SOURCE_DISABLED) {
+            continue;
+        }
+        found++;
+
+        if (print == NULL) {
+            continue;
+        }
+
+        p = TRGMUX_SRV_Append(line, end, s_targets[i].name);
+        p = TRGMUX_SRV_Append(p, end, " <- ");
+        p = TRGMUX_SRV_Append(p, end, TRGMUX_SRV_SourceName(source));
+        if (TRGMUX_IsLocked(s_targets[i].target)) {
+            p = TRGMUX_SRV_Append(p, end, " [LK]");
+        }
+        *p = '\0';
+
+        print(line);
+    }
+
+    return found;
+}
+
+const char *TRGMUX_SRV_SourceName(trgmux_source_t source)
+{
+    if ((uint32_t)source >= TRGMUX_SOURCE_COUNT || s_source_names[source] == NULL) {
+        return "?";
+    }
+
+    return s_source_names[source];
+}
+
+const char *TRGMUX_SRV_TargetName(trgmux_target_t target)
+{
+    const trgmux_srv_target_info_t *info = TRGMUX_SRV_FindTarget(target);
+
+    return (info != NULL) ? info->name : "?";
+}
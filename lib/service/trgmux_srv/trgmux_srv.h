@@ -0,0 +1,136 @@
+/**
+ * @file    trgmux_srv.h
+ * @brief   Trigger Routing Service - Abstraction API
+ * @details
+ * Declarative wiring of the TRGMUX trigger fabric. A component describes
+ * the hardware chain it needs as a table of {source, target} routes
+ * (e.g. LPIT channel -> PDB0 -> ADC0, or ADC COCO -> DMA channel) and
+ * applies it once; after that the chain runs without an ISR hop.
+ *
+ * Features:
+ * - All-or-nothing apply: the table is validated before any register is
+ *   written
+ * - Validation rejects unknown targets, reserved sources, a target listed
+ *   twice, a target already driven by another source, and locked targets
+ * - ADC targets switch the ADC hardware trigger path from PDB to TRGMUX
+ * - Query/dump of the routes active in hardware
+ *
+ * Triggers into DMA_CH0..3 pace the DMAMUX periodic trigger of those
+ * channels; the channel itself is still set up through the DMA driver.
+ *
+ * @note Routing is intended for initialization time. The service is not
+ *       protected against concurrent use from interrupt context.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef TRGMUX_SRV_H
+#define TRGMUX_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../../driver/trgmux/trgmux.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Longest line passed to the dump sink, terminator included */
+#define TRGMUX_SRV_LINE_MAX         (48U)
+
+/**
+ * @brief Trigger routing service status codes
+ */
+typedef enum {
+    TRGMUX_SRV_SUCCESS = 0,         /**< Operation successful */
+    TRGMUX_SRV_ERROR,               /**< General error */
+    TRGMUX_SRV_INVALID_PARAM,       /**< Unknown target or reserved source */
+    TRGMUX_SRV_CONFLICT,            /**< Target listed twice or driven by another source */
+    TRGMUX_SRV_LOCKED               /**< Target register locked until reset */
+} trgmux_srv_status_t;
+
+/**
+ * @brief One connection: source trigger output -> target trigger input
+ */
+typedef struct {
+    trgmux_source_t source;
+    trgmux_target_t target;
+} trgmux_srv_route_t;
+
+/**
+ * @brief Dump output, called once per line (no line ending)
+ */
+typedef void (*trgmux_srv_print_t)(const char *line);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Check a route table against the hardware without writing it
+ * @details Re-applying a route that is already active is not a conflict.
+ * @param routes Route table
+ * @param count Number of routes
+ * @param failed Index of the first rejected route (optional, NULL allowed)
+ * @return trgmux_srv_status_t TRGMUX_SRV_SUCCESS if the table can be applied
+ */
+trgmux_srv_status_t TRGMUX_SRV_Validate(const trgmux_srv_route_t *routes, uint8_t count,
+                                        uint8_t *failed);
+
+/**
+ * @brief Validate and connect a route table
+ * @details Nothing is written unless the whole table validates.
+ * @param routes Route table
+ * @param count Number of routes
+ * @param lock Lock the affected registers until reset
+ * @return trgmux_srv_status_t Status of operation
+ */
+trgmux_srv_status_t TRGMUX_SRV_Apply(const trgmux_srv_route_t *routes, uint8_t count, bool lock);
+
+/**
+ * @brief Disconnect every target of a route table
+ * @details ADC trigger paths return to PDB once no ADCx_ADHWT target of
+ *          that ADC is routed any more.
+ * @param routes Route table previously applied
+ * @param count Number of routes
+ * @return trgmux_srv_status_t Status of operation
+ */
+trgmux_srv_status_t TRGMUX_SRV_Remove(const trgmux_srv_route_t *routes, uint8_t count);
+
+/**
+ * @brief Read back the routes active in hardware
+ * @param routes Output table
+ * @param max Capacity of the output table
+ * @return uint8_t Number of active routes (may exceed max)
+ */
+uint8_t TRGMUX_SRV_Query(trgmux_srv_route_t *routes, uint8_t max);
+
+/**
+ * @brief Print the routes active in hardware
+ * @details One line per route, e.g. "PDB0_TRG_IN <- LPIT_CH0", with
+ *          " [LK]" appended for locked registers.
+ * @param print Line sink (UART, log, ...)
+ * @return uint8_t Number of active routes
+ */
+uint8_t TRGMUX_SRV_Dump(trgmux_srv_print_t print);
+
+/**
+ * @brief Get the name of a source
+ * @param source Trigger source
+ * @return const char* Name, "?" for reserved values
+ */
+const char *TRGMUX_SRV_SourceName(trgmux_source_t source);
+
+/**
+ * @brief Get the name of a target
+ * @param target Trigger target
+ * @return const char* Name, "?" for unknown targets
+ */
+const char *TRGMUX_SRV_TargetName(trgmux_target_t target);
+
+#endif /* TRGMUX_SRV_H */
@@ -0,0 +1,547 @@
+/**
+ * @file    tsyn_srv.c
+ * @brief   Time Synchronization Service Implementation
+ * @details SYNC/FUP master and slave, mailbox timestamp conversion and the
+ *          64-bit local time base
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "tsyn_srv.h"
+#include "../can_srv/can_srv.h"
+#include "../clock_srv/clock_srv.h"
+#include "../../driver/ultis/dwt_ultis.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define TSYN_SRV_TYPE_SYNC          (0x10U)
+#define TSYN_SRV_TYPE_FUP           (0x18U)
+#define TSYN_SRV_FRAME_SIZE         (8U)
+#define TSYN_SRV_SEQ_MASK           (0x0FU)
+#define TSYN_SRV_OVS_MASK           (0x03U)
+#define TSYN_SRV_STD_ID_MASK        (0x7FFUL)
+
+#define TSYN_SRV_NS_PER_S           (1000000000ULL)
+#define TSYN_SRV_NS_PER_MS          (1000000ULL)
+#define TSYN_SRV_RATE_FILTER        (4)             /* A new rate measurement weighs 1/4 */
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef enum {
+    TSYN_SRV_MASTER_IDLE = 0,
+    TSYN_SRV_MASTER_WAIT_SYNC,      /**< SYNC queued, waiting for its TX timestamp */
+    TSYN_SRV_MASTER_SEND_FUP        /**< SYNC on the bus, FUP to send */
+} tsyn_srv_master_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static tsyn_srv_config_t s_cfg;
+static uint8_t s_mailbox = 0;
+static uint32_t s_cycles_per_us = 0;
+static uint32_t s_bit_ns = 0;
+static uint32_t s_bit_cycles = 0;
+
+/* Cycle counter extended to 64 bits */
+static uint32_t s_cycles_low = 0;
+static uint32_t s_cycles_high = 0;
+
+/* Master */
+static volatile tsyn_srv_master_state_t s_master_state = TSYN_SRV_MASTER_IDLE;
+static uint8_t s_seq = 0;
+static uint64_t s_next_sync = 0;
+static volatile uint64_t s_sync_time = 0;       /* Master: SYNC TX time. Slave: SYNC RX time */
+static uint32_t s_sync_seconds = 0;
+
+/* Slave: SYNC seen by the interrupt, completed pair handed to Process */
+static volatile bool s_sync_seen = false;
+static uint8_t s_sync_seq = 0;
+static volatile bool s_pair_ready = false;
+static volatile uint64_t s_pair_local = 0;
+static volatile uint64_t s_pair_global = 0;
+
+/* Slave: correction, network = global + elapsed * (1 + rate) since local */
+static bool s_synced = false;
+static bool s_rate_valid = false;
+static uint64_t s_base_local = 0;
+static uint64_t s_base_global = 0;
+static int32_t s_rate_ppb = 0;
+
+static tsyn_srv_stats_t s_stats;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Mask interrupts, return the previous PRIMASK
+ */
+static inline uint32_t TSYN_SRV_EnterCritical(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+    __asm volatile ("cpsid i" : : : "memory");
+
+    return primask;
+}
+
+/**
+ * @brief Restore PRIMASK saved by TSYN_SRV_EnterCritical()
+ */
+static inline void TSYN_SRV_ExitCritical(uint32_t primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+/**
+ * @brief Read the cycle counter extended to 64 bits
+ * @details Every reader carries the wrap, Process() makes sure one reads
+ *          at least once per wrap.
+ */
+static uint64_t TSYN_SRV_GetCycles(void)
+{
+    uint32_t primask = TSYN_SRV_EnterCritical();
+    uint32_t now = DWT_GetCycles();
+    uint64_t cycles;
+
+    if (now < s_cycles_low) {
+        s_cycles_high++;
+    }
+    s_cycles_low = now;
+    cycles = ((uint64_t)s_cycles_high << 32) | now;
+
+    TSYN_SRV_ExitCritical(primask);
+
+    return cycles;
+}
+
+static uint64_t TSYN_SRV_CyclesToNs(uint64_t cycles)
+{
+    return (cycles * 1000U) / s_cycles_per_us;
+}
+
+/**
+ * @brief Local time at which a frame's identifier was on the bus
+ * @details Waits for the next tick of the bus timer (at most one bit time)
+ *          so the conversion starts on a tick edge. What remains is the
+ *          mailbox capture resolution; its mean bias (half a bit) is the
+ *          same on master and slave and cancels.
+ */
+static uint64_t TSYN_SRV_FrameTime(uint16_t timestamp)
+{
+    uint32_t start = DWT_GetCycles();
+    uint16_t timer = 0;
+    uint16_t edge = 0;
+    uint64_t now;
+
+    (void)CAN_SRV_GetTimer(&timer);
+    do {
+        (void)CAN_SRV_GetTimer(&edge);
+    } while (edge == timer && (DWT_GetCycles() - start) < (2U * s_bit_cycles));
+    now = TSYN_SRV_CyclesToNs(TSYN_SRV_GetCycles());
+
+    return now - (uint64_t)(uint16_t)(edge - timestamp) * s_bit_ns;
+}
+
+static uint32_t TSYN_SRV_GetU32(const uint8_t *in)
+{
+    return ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 8) | in[3];
+}
+
+static void TSYN_SRV_PutU32(uint8_t *out, uint32_t value)
+{
+    out[0] = (uint8_t)(value >> 24);
+    out[1] = (uint8_t)(value >> 16);
+    out[2] = (uint8_t)(value >> 8);
+    out[3] = (uint8_t)value;
+}
+
+/**
+ * @brief Queue a SYNC or FUP frame
+ * @details The state change is made with interrupts masked, so the TX
+ *          complete interrupt of the SYNC always finds WAIT_SYNC.
+ */
+static bool TSYN_SRV_SendFrame(uint8_t type, uint8_t ovs, uint32_t value,
+                               tsyn_srv_master_state_t next)
+{
+    can_srv_message_t msg;
+    uint32_t primask;
+    bool sent;
+
+    msg.id = s_cfg.can_id;
+    msg.dlc = TSYN_SRV_FRAME_SIZE;
+    msg.isExtended = false;
+    msg.isRemote = false;
+    msg.data[0] = type;
+    msg.data[1] = 0U;
+    msg.data[2] = (uint8_t)((s_cfg.domain << 4) | s_seq);
+    msg.data[3] = ovs;
+    TSYN_SRV_PutU32(&msg.data[4], value);
+
+    primask = TSYN_SRV_EnterCritical();
+    sent = (CAN_SRV_SendOn(s_mailbox, &msg) == CAN_SRV_SUCCESS);
+    if (sent) {
+        s_master_state = next;
+    }
+    TSYN_SRV_ExitCritical(primask);
+
+    return sent;
+}
+
+/**
+ * @brief Master: one SYNC/FUP pair per period
+ */
+static void TSYN_SRV_MasterProcess(uint64_t now)
+{
+    uint64_t fup_ns;
+    uint32_t primask;
+
+    switch (s_master_state) {
+        case TSYN_SRV_MASTER_IDLE:
+            if (now < s_next_sync) {
+                break;
+            }
+            s_next_sync = now + (uint64_t)s_cfg.period_ms * TSYN_SRV_NS_PER_MS;
+            s_seq = (uint8_t)((s_seq + 1U) & TSYN_SRV_SEQ_MASK);
+            s_sync_seconds = (uint32_t)(now / TSYN_SRV_NS_PER_S);
+            if (!TSYN_SRV_SendFrame(TSYN_SRV_TYPE_SYNC, 0U, s_sync_seconds, TSYN_SRV_MASTER_WAIT_SYNC)) {
+                s_stats.errors++;
+            }
+            break;
+
+        case TSYN_SRV_MASTER_WAIT_SYNC:
+            /* Not on the bus within a period: give up this pair */
+            if (now >= s_next_sync) {
+                primask = TSYN_SRV_EnterCritical();
+                if (s_master_state == TSYN_SRV_MASTER_WAIT_SYNC) {
+                    s_master_state = TSYN_SRV_MASTER_IDLE;
+                    s_stats.errors++;
+                }
+                TSYN_SRV_ExitCritical(primask);
+            }
+            break;
+
+        case TSYN_SRV_MASTER_SEND_FUP:
+            fup_ns = s_sync_time - (uint64_t)s_sync_seconds * TSYN_SRV_NS_PER_S;
+            if (s_sync_time < (uint64_t)s_sync_seconds * TSYN_SRV_NS_PER_S ||
+                fup_ns / TSYN_SRV_NS_PER_S > TSYN_SRV_OVS_MASK || now >= s_next_sync) {
+                s_master_state = TSYN_SRV_MASTER_IDLE;
+                s_stats.errors++;
+                break;
+            }
+            /* Mailbox still busy: retry on the next pass */
+            if (TSYN_SRV_SendFrame(TSYN_SRV_TYPE_FUP, (uint8_t)(fup_ns / TSYN_SRV_NS_PER_S),
+                                   (uint32_t)(fup_ns % TSYN_SRV_NS_PER_S), TSYN_SRV_MASTER_IDLE)) {
+                s_stats.syncs++;
+            }
+            break;
+
+        default:
+            s_master_state = TSYN_SRV_MASTER_IDLE;
+            break;
+    }
+}
+
+/**
+ * @brief Slave: SYNC or FUP received (CAN interrupt)
+ */
+static void TSYN_SRV_SlaveReceive(const can_srv_message_t *msg)
+{
+    uint8_t seq = msg->data[2] & TSYN_SRV_SEQ_MASK;
+    uint32_t value = TSYN_SRV_GetU32(&msg->data[4]);
+
+    if (msg->dlc != TSYN_SRV_FRAME_SIZE || (msg->data[2] >> 4) != s_cfg.domain) {
+        return;
+    }
+
+    if (msg->data[0] == TSYN_SRV_TYPE_SYNC) {
+        s_sync_time = TSYN_SRV_FrameTime(msg->timestamp);
+        s_sync_seconds = value;
+        s_sync_seq = seq;
+        s_sync_seen = true;
+        return;
+    }
+
+    if (msg->data[0] != TSYN_SRV_TYPE_FUP || !s_sync_seen || seq != s_sync_seq ||
+        value >= TSYN_SRV_NS_PER_S ||
+        TSYN_SRV_GetLocalTime() - s_sync_time > TSYN_SRV_FUP_TIMEOUT_MS * TSYN_SRV_NS_PER_MS) {
+        s_sync_seen = false;
+        s_stats.errors++;
+        return;
+    }
+    s_sync_seen = false;
+
+    /* Previous pair not applied yet: keep it */
+    if (s_pair_ready) {
+        s_stats.errors++;
+        return;
+    }
+
+    s_pair_local = s_sync_time;
+    s_pair_global = ((uint64_t)s_sync_seconds + (msg->data[3] & TSYN_SRV_OVS_MASK)) * TSYN_SRV_NS_PER_S + value;
+    s_pair_ready = true;
+}
+
+/**
+ * @brief Slave: network time of a local time with the current correction
+ */
+static uint64_t TSYN_SRV_Correct(uint64_t local)
+{
+    int64_t elapsed = (int64_t)(local - s_base_local);
+
+    return s_base_global + (uint64_t)(elapsed + (elapsed * s_rate_ppb) / (int64_t)TSYN_SRV_NS_PER_S);
+}
+
+/**
+ * @brief Slave: apply a SYNC/FUP pair
+ * @details The error of the time predicted for the pair is the achieved
+ *          accuracy; the offset is then stepped onto the pair and the rate
+ *          filtered towards the ratio measured since the previous pair.
+ */
+static void TSYN_SRV_Apply(uint64_t local, uint64_t global)
+{
+    int64_t error;
+    int64_t elapsed;
+    int64_t rate;
+
+    if (s_synced) {
+        error = (int64_t)(global - TSYN_SRV_Correct(local));
+        elapsed = (int64_t)(local - s_base_local);
+
+        if (error > (int64_t)TSYN_SRV_STEP_LIMIT_NS || error < -(int64_t)TSYN_SRV_STEP_LIMIT_NS) {
+            /* Master restarted or pairs were missed: measure the rate again */
+            s_stats.steps++;
+            s_stats.max_error_ns = 0U;
+            s_rate_valid = false;
+        } else if (elapsed > 0) {
+            rate = ((int64_t)(global - s_base_global) - elapsed) * (int64_t)TSYN_SRV_NS_PER_S / elapsed;
+            if (rate > (int64_t)TSYN_SRV_MAX_RATE_PPM * 1000 || rate < -(int64_t)TSYN_SRV_MAX_RATE_PPM * 1000) {
+                s_stats.errors++;
+                return;
+            }
+
+            if (s_rate_valid) {
+                s_stats.last_error_ns = (int32_t)error;
+                if ((uint32_t)((error < 0) ? -error : error) > s_stats.max_error_ns) {
+                    s_stats.max_error_ns = (uint32_t)((error < 0) ? -error : error);
+                }
+                s_rate_ppb += (int32_t)((rate - s_rate_ppb) / TSYN_SRV_RATE_FILTER);
+            } else {
+                s_rate_ppb = (int32_t)rate;
+                s_rate_valid = true;
+            }
+        } else {
+            s_stats.errors++;
+            return;
+        }
+    }
+
+    s_base_local = local;
+    s_base_global = global;
+    s_synced = true;
+    s_stats.syncs++;
+    s_stats.rate_ppb = s_rate_ppb;
+}
+
+/**
+ * @brief can_srv listener
+ */
+static void TSYN_SRV_CANCallback(uint8_t instance, can_srv_event_t event, const can_srv_message_t *msg)
+{
+    (void)instance;
+
+    if (!s_initialized || msg == NULL || msg->id != s_cfg.can_id || msg->isExtended) {
+        return;
+    }
+
+    if (s_cfg.role == TSYN_SRV_ROLE_MASTER) {
+        if (event == CAN_SRV_EVENT_TX_COMPLETE && s_master_state == TSYN_SRV_MASTER_WAIT_SYNC) {
+            s_sync_time = TSYN_SRV_FrameTime(msg->timestamp);
+            s_master_state = TSYN_SRV_MASTER_SEND_FUP;
+        }
+        return;
+    }
+
+    if (event == CAN_SRV_EVENT_RX_COMPLETE && !msg->isRemote) {
+        TSYN_SRV_SlaveReceive(msg);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+tsyn_srv_status_t TSYN_SRV_Init(const tsyn_srv_config_t *config)
+{
+    clock_srv_frequencies_t freq;
+    uint32_t baudrate;
+
+    if (s_initialized) {
+        return TSYN_SRV_SUCCESS;
+    }
+
+    if (config == NULL || config->can_id > TSYN_SRV_STD_ID_MASK || config->domain > TSYN_SRV_MAX_DOMAIN ||
+        config->role > TSYN_SRV_ROLE_SLAVE ||
+        (config->role == TSYN_SRV_ROLE_MASTER && config->period_ms == 0U) ||
+        (config->role == TSYN_SRV_ROLE_SLAVE && config->timeout_ms == 0U)) {
+        return TSYN_SRV_INVALID_PARAM;
+    }
+
+    baudrate = CAN_SRV_GetBaudrate();
+    if (baudrate == 0U) {
+        return TSYN_SRV_NOT_INITIALIZED;
+    }
+
+    if (CLOCK_SRV_GetFrequencies(&freq) != CLOCK_SRV_SUCCESS || freq.core_hz < 1000000U) {
+        return TSYN_SRV_ERROR;
+    }
+
+    s_cfg = *config;
+    s_cycles_per_us = freq.core_hz / 1000000U;
+    s_bit_ns = (uint32_t)(TSYN_SRV_NS_PER_S / baudrate);
+    s_bit_cycles = freq.core_hz / baudrate;
+
+    if (config->role == TSYN_SRV_ROLE_MASTER) {
+        if (CAN_SRV_AllocTxMailbox(&s_mailbox) != CAN_SRV_SUCCESS) {
+            return TSYN_SRV_NO_RESOURCE;
+        }
+    } else if (CAN_SRV_AddRxFilter(config->can_id, TSYN_SRV_STD_ID_MASK, false) != CAN_SRV_SUCCESS) {
+        return TSYN_SRV_NO_RESOURCE;
+    }
+
+    if (CAN_SRV_RegisterCallback(TSYN_SRV_CANCallback) != CAN_SRV_SUCCESS) {
+        return TSYN_SRV_ERROR;
+    }
+
+    DWT_CycleCounterStart();
+    s_cycles_low = DWT_GetCycles();
+    s_cycles_high = 0U;
+
+    s_master_state = TSYN_SRV_MASTER_IDLE;
+    s_next_sync = 0U;
+    s_sync_seen = false;
+    s_pair_ready = false;
+    s_synced = false;
+    s_rate_valid = false;
+    s_rate_ppb = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_initialized = true;
+
+    return TSYN_SRV_SUCCESS;
+}
+
+void TSYN_SRV_Process(void)
+{
+    uint64_t local;
+    uint64_t global;
+    uint64_t now;
+
+    if (!s_initialized) {
+        return;
+    }
+
+    if (s_cfg.role == TSYN_SRV_ROLE_MASTER) {
+        TSYN_SRV_MasterProcess(TSYN_SRV_GetLocalTime());
+        return;
+    }
+
+    if (s_pair_ready) {
+        local = s_pair_local;
+        global = s_pair_global;
+        s_pair_ready = false;
+        TSYN_SRV_Apply(local, global);
+    }
+
+    /* Read after the pair, its SYNC time must not be in the future */
+    now = TSYN_SRV_GetLocalTime();
+    if (s_synced && now - s_base_local > (uint64_t)s_cfg.timeout_ms * TSYN_SRV_NS_PER_MS) {
+        s_synced = false;
+        s_rate_valid = false;
+        s_stats.max_error_ns = 0U;
+        s_stats.timeouts++;
+    }
+}
+
+uint64_t TSYN_SRV_GetLocalTime(void)
+{
+    if (s_cycles_per_us == 0U) {
+        return 0U;
+    }
+
+    return TSYN_SRV_CyclesToNs(TSYN_SRV_GetCycles());
+}
+
+uint64_t TSYN_SRV_GetLocalTimeAt(uint32_t cycles)
+{
+    uint64_t now;
+
+    if (s_cycles_per_us == 0U) {
+        return 0U;
+    }
+
+    now = TSYN_SRV_GetCycles();
+
+    return TSYN_SRV_CyclesToNs(now - (uint32_t)((uint32_t)now - cycles));
+}
+
+tsyn_srv_status_t TSYN_SRV_ToNetworkTime(uint64_t local, tsyn_srv_time_t *time)
+{
+    uint64_t network;
+
+    if (!s_initialized) {
+        return TSYN_SRV_NOT_INITIALIZED;
+    }
+
+    if (time == NULL) {
+        return TSYN_SRV_INVALID_PARAM;
+    }
+
+    if (s_cfg.role == TSYN_SRV_ROLE_MASTER) {
+        network = local;
+    } else if (s_synced) {
+        network = TSYN_SRV_Correct(local);
+    } else {
+        return TSYN_SRV_NOT_SYNCHRONIZED;
+    }
+
+    time->seconds = (uint32_t)(network / TSYN_SRV_NS_PER_S);
+    time->nanoseconds = (uint32_t)(network % TSYN_SRV_NS_PER_S);
+
+    return TSYN_SRV_SUCCESS;
+}
+
+tsyn_srv_status_t TSYN_SRV_GetNetworkTime(tsyn_srv_time_t *time)
+{
+    return TSYN_SRV_ToNetworkTime(TSYN_SRV_GetLocalTime(), time);
+}
+
+bool TSYN_SRV_IsSynchronized(void)
+{
+    return s_initialized && (s_cfg.role == TSYN_SRV_ROLE_MASTER || s_synced);
+}
+
+tsyn_srv_status_t TSYN_SRV_GetStats(tsyn_srv_stats_t *stats)
+{
+    if (!s_initialized) {
+        return TSYN_SRV_NOT_INITIALIZED;
+    }
+
+    if (stats == NULL) {
+        return TSYN_SRV_INVALID_PARAM;
+    }
+
+    *stats = s_stats;
+
+    return TSYN_SRV_SUCCESS;
+}
@@ -0,0 +1,169 @@
+/**
+ * @file    tsyn_srv.h
+ * @brief   Time Synchronization Service - Abstraction API
+ * @details
+ * Network time over CAN in the style of AUTOSAR CanTSyn, on top of can_srv:
+ * - The master sends a SYNC frame with the seconds of its time, then a
+ *   FUP (follow-up) frame with the nanoseconds at which the SYNC was
+ *   actually on the bus, taken from the TX mailbox timestamp
+ * - Slaves timestamp the SYNC in their RX mailbox the same way, so the
+ *   pair gives the master time at a known local instant, free of queueing
+ *   and interrupt latency
+ * - Slaves correct offset (step at each pair) and rate (filtered ratio of
+ *   master to local elapsed time between pairs)
+ *
+ * Frame layout (8 bytes, no CRC, CanTSyn types 0x10 / 0x18):
+ *   SYNC: [0x10, 0, domain << 4 | seq, 0,   seconds (BE, 4)]
+ *   FUP:  [0x18, 0, domain << 4 | seq, ovs, nanoseconds (BE, 4)]
+ * ovs carries whole seconds that passed between the SYNC request and its
+ * transmission.
+ *
+ * The local time base is the DWT cycle counter extended to 64 bits. It is
+ * monotonic as long as TSYN_SRV_Process() runs at least every 2^32 cycles
+ * (26 s at 160 MHz) and nothing resets the counter (DWT_CycleCounterInit()
+ * in the benchmarks). Mailbox timestamps count CAN bit times, so the
+ * resolution of a pair is one bit time (2 us at 500 Kbps); the prediction
+ * error reported at each SYNC shows the accuracy actually reached.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef TSYN_SRV_H
+#define TSYN_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Limits */
+#define TSYN_SRV_MAX_DOMAIN         (15U)
+#define TSYN_SRV_FUP_TIMEOUT_MS     (100U)          /* FUP must follow its SYNC within this */
+#define TSYN_SRV_MAX_RATE_PPM       (500U)          /* Larger rate deviations are rejected */
+#define TSYN_SRV_STEP_LIMIT_NS      (1000000UL)     /* Larger corrections restart the rate (master restart) */
+
+/**
+ * @brief Time synchronization service status codes
+ */
+typedef enum {
+    TSYN_SRV_SUCCESS = 0,           /**< Operation successful */
+    TSYN_SRV_ERROR,                 /**< General error */
+    TSYN_SRV_NOT_INITIALIZED,       /**< Service not initialized */
+    TSYN_SRV_INVALID_PARAM,         /**< Invalid parameter */
+    TSYN_SRV_NO_RESOURCE,           /**< No TX mailbox or RX filter left */
+    TSYN_SRV_NOT_SYNCHRONIZED       /**< Slave has no valid network time */
+} tsyn_srv_status_t;
+
+/**
+ * @brief Node role
+ */
+typedef enum {
+    TSYN_SRV_ROLE_MASTER = 0,       /**< Network time = local time, sends SYNC/FUP */
+    TSYN_SRV_ROLE_SLAVE             /**< Follows the master of its domain */
+} tsyn_srv_role_t;
+
+/**
+ * @brief Network time (seconds and nanoseconds since the master started)
+ */
+typedef struct {
+    uint32_t seconds;
+    uint32_t nanoseconds;           /**< 0-999999999 */
+} tsyn_srv_time_t;
+
+/**
+ * @brief Service configuration
+ */
+typedef struct {
+    tsyn_srv_role_t role;
+    uint32_t can_id;                /**< 11-bit ID of SYNC and FUP */
+    uint8_t domain;                 /**< Time domain, 0-TSYN_SRV_MAX_DOMAIN */
+    uint16_t period_ms;             /**< Master: SYNC period */
+    uint16_t timeout_ms;            /**< Slave: network time invalid without a pair for this long */
+} tsyn_srv_config_t;
+
+/**
+ * @brief Service statistics
+ */
+typedef struct {
+    uint32_t syncs;                 /**< Master: pairs sent. Slave: pairs applied */
+    uint32_t errors;                /**< Master: SYNC not sent within a period. Slave: bad or unmatched frames */
+    uint32_t timeouts;              /**< Slave: synchronization lost */
+    uint32_t steps;                 /**< Slave: corrections above TSYN_SRV_STEP_LIMIT_NS */
+    int32_t rate_ppb;               /**< Slave: local clock rate correction */
+    int32_t last_error_ns;          /**< Slave: network time error found at the last pair */
+    uint32_t max_error_ns;          /**< Slave: worst |error| since the rate was measured */
+} tsyn_srv_stats_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the service
+ * @details CAN_SRV_Init() and CLOCK_SRV_InitPreset() must have been called.
+ *          Further calls return TSYN_SRV_SUCCESS and keep the first
+ *          configuration, so on a node running the master component the
+ *          slave components use the master time directly (app_node).
+ * @param config Configuration
+ * @return tsyn_srv_status_t Status of initialization
+ */
+tsyn_srv_status_t TSYN_SRV_Init(const tsyn_srv_config_t *config);
+
+/**
+ * @brief Send SYNC/FUP pairs (master) or apply received pairs (slave)
+ * @details Call from the main loop.
+ */
+void TSYN_SRV_Process(void);
+
+/**
+ * @brief Read the local monotonic time
+ * @details Interrupt safe.
+ * @return uint64_t Nanoseconds since the cycle counter started
+ */
+uint64_t TSYN_SRV_GetLocalTime(void);
+
+/**
+ * @brief Local time of an earlier DWT_GetCycles() reading
+ * @details Lets interrupts keep a 32-bit cycle stamp and convert it later.
+ * @param cycles Cycle counter value, less than 2^32 cycles old
+ * @return uint64_t Local time in nanoseconds
+ */
+uint64_t TSYN_SRV_GetLocalTimeAt(uint32_t cycles);
+
+/**
+ * @brief Convert a local time to network time
+ * @details Main loop context (reads the correction updated by Process).
+ * @param local Local time in nanoseconds
+ * @param time Output
+ * @return tsyn_srv_status_t TSYN_SRV_NOT_SYNCHRONIZED on a slave without a valid pair
+ */
+tsyn_srv_status_t TSYN_SRV_ToNetworkTime(uint64_t local, tsyn_srv_time_t *time);
+
+/**
+ * @brief Current network time
+ * @param time Output
+ * @return tsyn_srv_status_t See TSYN_SRV_ToNetworkTime()
+ */
+tsyn_srv_status_t TSYN_SRV_GetNetworkTime(tsyn_srv_time_t *time);
+
+/**
+ * @brief Check whether network time is available
+ * @return bool true on the master and on synchronized slaves
+ */
+bool TSYN_SRV_IsSynchronized(void);
+
+/**
+ * @brief Get service statistics
+ * @param stats Output
+ * @return tsyn_srv_status_t Status of operation
+ */
+tsyn_srv_status_t TSYN_SRV_GetStats(tsyn_srv_stats_t *stats);
+
+#endif /* TSYN_SRV_H */
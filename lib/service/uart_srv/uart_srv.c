@@ -13,6 +13,7 @@
 #include "../port/port.h"
 #include "../pcc/pcc.h"
 #include "../clock_srv/clock_srv.h"
+#include "../flexio_srv/flexio_srv.h"
 
 #include <stdarg.h>
 #include <stdio.h>
@@ -23,6 +24,7 @@
 /*============================================================================*/
 
 #define UART_MAX_INSTANCES 3U
+#define UART_FLEXIO_INSTANCES 2U
 
 typedef struct
 {
@@ -42,11 +44,32 @@ static uart_instance_t g_uart_instances[UART_MAX_INSTANCES] =
     { LPUART2, PCC_LPUART2_INDEX, PORTB, 11U, 10U }   /* LPUART2: PTB11=TX, PTB10=RX */
 };
 
+typedef struct
+{
+    PORT_Type   *port;
+    uint8_t      tx_pin;
+    uint8_t      rx_pin;
+    uint8_t      mux;
+    uint8_t      flexio_tx;     /* FXIO_Dn */
+    uint8_t      flexio_rx;
+    bool         initialized;
+} uart_flexio_instance_t;
+
+/* Pin mapping for the FlexIO UART channels (UART_SRV_INSTANCE_FLEXIO_x) */
+static uart_flexio_instance_t g_uart_flexio_instances[UART_FLEXIO_INSTANCES] =
+{
+    { PORTD, 0U, 1U, 6U, 0U, 1U },  /* FlexIO 0: PTD0=TX (FXIO_D0), PTD1=RX (FXIO_D1), ALT6 */
+    { PORTD, 2U, 3U, 4U, 4U, 5U }   /* FlexIO 1: PTD2=TX (FXIO_D4), PTD3=RX (FXIO_D5), ALT4 */
+};
+
 /*============================================================================*/
 /* Private Functions                                                          */
 /*============================================================================*/
 
 static uint32_t UART_SRV_GetPeripheralClock(uart_srv_instance_t instance);
+static void     UART_SRV_EnablePortClock(PORT_Type *port);
+static bool     UART_SRV_IsFlexIO(uart_srv_instance_t instance);
+static uart_srv_status_t UART_SRV_InitFlexIO(uart_srv_instance_t instance, uint32_t baudrate);
 static uint16_t UART_SRV_CalculateBestSBR(uint32_t clock_hz, uint32_t baudrate, uint8_t *osr_reg);
 
 /*============================================================================*/
@@ -55,6 +78,9 @@ static uint16_t UART_SRV_CalculateBestSBR(uint32_t clock_hz, uint32_t baudrate,
 
 uart_srv_status_t UART_SRV_Init(uart_srv_instance_t instance, uint32_t baudrate)
 {
+    if (UART_SRV_IsFlexIO(instance))
+        return UART_SRV_InitFlexIO(instance, baudrate);
+
     if (instance >= UART_MAX_INSTANCES || baudrate == 0U)
         return UART_SRV_INVALID_BAUDRATE;
 
@@ -64,15 +90,7 @@ uart_srv_status_t UART_SRV_Init(uart_srv_instance_t instance, uint32_t baudrate)
         return UART_SRV_SUCCESS;
 
     /* Enable clock for corresponding PORT */
-        switch ((uint32_t)uart->port)
-        {
-            case (uint32_t)PORTA: PCC_Enable(PCC_PORTA_INDEX); break;
-            case (uint32_t)PORTB: PCC_Enable(PCC_PORTB_INDEX); break;
-            case (uint32_t)PORTC: PCC_Enable(PCC_PORTC_INDEX); break;
-            case (uint32_t)PORTD: PCC_Enable(PCC_PORTD_INDEX); break;
-            case (uint32_t)PORTE: PCC_Enable(PCC_PORTE_INDEX); break;
-            default: break;
-        }
+    UART_SRV_EnablePortClock(uart->port);
     /* 1. Enable peripheral clock via PCC */
     PCC_Enable(uart->pcc_index);
 
@@ -116,15 +134,34 @@ uart_srv_status_t UART_SRV_Init(uart_srv_instance_t instance, uint32_t baudrate)
 
 uart_srv_status_t UART_SRV_SendByte(uart_srv_instance_t instance, uint8_t data)
 {
+    if (UART_SRV_IsFlexIO(instance))
+        return (FLEXIO_SRV_UartPutByte((uint8_t)(instance - UART_MAX_INSTANCES), data) == FLEXIO_SRV_SUCCESS) ?
+               UART_SRV_SUCCESS : UART_SRV_NOT_INITIALIZED;
+
     if (instance >= UART_MAX_INSTANCES || !g_uart_instances[instance].initialized)
         return UART_SRV_NOT_INITIALIZED;
 
-    return (UART_SendByte(g_uart_instances[instance].base, data) == UART_STATUS_SUCCESS) ?
-           UART_SRV_SUCCESS : UART_SRV_ERROR;
+    /* Arguments checked above; the driver only asserts them */
+    (void)UART_SendByte(g_uart_instances[instance].base, data);
+
+    return UART_SRV_SUCCESS;
 }
 
 uart_srv_status_t UART_SRV_SendString(uart_srv_instance_t instance, const char *str)
 {
+    if (UART_SRV_IsFlexIO(instance))
+    {
+        if (str == NULL)
+            return UART_SRV_ERROR;
+
+        while (*str != '\0')
+        {
+            if (UART_SRV_SendByte(instance, (uint8_t)*str++) != UART_SRV_SUCCESS)
+                return UART_SRV_ERROR;
+        }
+        return UART_SRV_SUCCESS;
+    }
+
     if (instance >= UART_MAX_INSTANCES || !g_uart_instances[instance].initialized || str == NULL)
         return UART_SRV_ERROR;
 
@@ -138,7 +175,12 @@ uart_srv_status_t UART_SRV_Printf(uart_srv_instance_t instance, const char *form
     va_list args;
     int len;
 
-    if (instance >= UART_MAX_INSTANCES || !g_uart_instances[instance].initialized || format == NULL)
+    if (format == NULL)
+        return UART_SRV_NOT_INITIALIZED;
+
+    if (UART_SRV_IsFlexIO(instance) ?
+        !g_uart_flexio_instances[instance - UART_MAX_INSTANCES].initialized :
+        (instance >= UART_MAX_INSTANCES || !g_uart_instances[instance].initialized))
         return UART_SRV_NOT_INITIALIZED;
 
     va_start(args, format);
@@ -157,6 +199,18 @@ uart_srv_status_t UART_SRV_ReceiveByte(uart_srv_instance_t instance, uint8_t *da
     if (data == NULL)
         return UART_SRV_ERROR;
 
+    if (UART_SRV_IsFlexIO(instance))
+    {
+        flexio_srv_status_t fx_status;
+
+        /* Bytes arrive in the DMA ring; wait for the next one */
+        do {
+            fx_status = FLEXIO_SRV_UartGetByte((uint8_t)(instance - UART_MAX_INSTANCES), data);
+        } while (fx_status == FLEXIO_SRV_NO_DATA);
+
+        return (fx_status == FLEXIO_SRV_SUCCESS) ? UART_SRV_SUCCESS : UART_SRV_ERROR;
+    }
+
     // Check instance valid and initialized
     if (instance >= UART_MAX_INSTANCES || !g_uart_instances[instance].initialized)
         return UART_SRV_ERROR;
@@ -166,10 +220,11 @@ uart_srv_status_t UART_SRV_ReceiveByte(uart_srv_instance_t instance, uint8_t *da
     if (lpuart_base == NULL)
         return UART_SRV_ERROR;
 
-    // Call low-level driver function with hardware base pointer
-    uart_status_t status = UART_ReceiveByte(lpuart_base, data);
+    // Call low-level driver function with hardware base pointer (arguments
+    // checked above, the driver only asserts them)
+    (void)UART_ReceiveByte(lpuart_base, data);
 
-    return (status == UART_STATUS_SUCCESS) ? UART_SRV_SUCCESS : UART_SRV_ERROR;
+    return UART_SRV_SUCCESS;
 }
 
 /*============================================================================*/
@@ -188,6 +243,58 @@ static uint32_t UART_SRV_GetPeripheralClock(uart_srv_instance_t instance)
     return CLOCK_SRV_GetPeripheralClock(periph_map[instance]);
 }
 
+static void UART_SRV_EnablePortClock(PORT_Type *port)
+{
+    switch ((uint32_t)port)
+    {
+        case (uint32_t)PORTA: PCC_Enable(PCC_PORTA_INDEX); break;
+        case (uint32_t)PORTB: PCC_Enable(PCC_PORTB_INDEX); break;
+        case (uint32_t)PORTC: PCC_Enable(PCC_PORTC_INDEX); break;
+        case (uint32_t)PORTD: PCC_Enable(PCC_PORTD_INDEX); break;
+        case (uint32_t)PORTE: PCC_Enable(PCC_PORTE_INDEX); break;
+        default: break;
+    }
+}
+
+static bool UART_SRV_IsFlexIO(uart_srv_instance_t instance)
+{
+    return (instance >= UART_SRV_INSTANCE_FLEXIO_0) &&
+           (instance < UART_SRV_INSTANCE_FLEXIO_0 + UART_FLEXIO_INSTANCES);
+}
+
+static uart_srv_status_t UART_SRV_InitFlexIO(uart_srv_instance_t instance, uint32_t baudrate)
+{
+    uart_flexio_instance_t *fx = &g_uart_flexio_instances[instance - UART_MAX_INSTANCES];
+    flexio_srv_uart_config_t cfg;
+    flexio_srv_status_t status;
+
+    if (fx->initialized)
+        return UART_SRV_SUCCESS;
+
+    if (!FLEXIO_SRV_IsInitialized())
+        return UART_SRV_NOT_INITIALIZED;
+
+    UART_SRV_EnablePortClock(fx->port);
+
+    const port_pin_config_t pin_cfg = { .field.MUX = fx->mux };
+    PORT_Config(fx->port, fx->tx_pin, (port_pin_config_t*)&pin_cfg);
+    PORT_Config(fx->port, fx->rx_pin, (port_pin_config_t*)&pin_cfg);
+
+    cfg.tx_pin   = fx->flexio_tx;
+    cfg.rx_pin   = fx->flexio_rx;
+    cfg.baudrate = baudrate;
+
+    status = FLEXIO_SRV_UartOpen((uint8_t)(instance - UART_MAX_INSTANCES), &cfg);
+    if (status == FLEXIO_SRV_INVALID_PARAM)
+        return UART_SRV_INVALID_BAUDRATE;
+    if (status != FLEXIO_SRV_SUCCESS)
+        return UART_SRV_INIT_FAILED;
+
+    fx->initialized = true;
+
+    return UART_SRV_SUCCESS;
+}
+
 static uint16_t UART_SRV_CalculateBestSBR(uint32_t clock_hz,
                                           uint32_t baudrate,
                                           uint8_t *osr_reg)
@@ -27,7 +27,9 @@ typedef enum
 {
     UART_SRV_INSTANCE_0 = 0U,   /*!< LPUART0 */
     UART_SRV_INSTANCE_1 = 1U,   /*!< LPUART1 */
-    UART_SRV_INSTANCE_2 = 2U    /*!< LPUART2 */
+    UART_SRV_INSTANCE_2 = 2U,   /*!< LPUART2 */
+    UART_SRV_INSTANCE_FLEXIO_0 = 3U,    /*!< FlexIO UART channel 0 (flexio_srv) */
+    UART_SRV_INSTANCE_FLEXIO_1 = 4U     /*!< FlexIO UART channel 1 (flexio_srv) */
 } uart_srv_instance_t;
 
 /**
@@ -49,6 +51,8 @@ typedef enum
 
 /**
  * @brief Initialize specified UART instance with desired baud rate
+ * @note  FlexIO instances need FLEXIO_SRV_Init() first; their baud rate is
+ *        limited by the FlexIO clock (see flexio_srv.h).
  * @param instance UART instance to initialize
  * @param baudrate Desired baud rate in bps
  * @return Operation status
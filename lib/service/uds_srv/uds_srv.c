@@ -0,0 +1,564 @@
+/**
+ * @file    uds_srv.c
+ * @brief   UDS Diagnostic Service Implementation
+ * @details Request dispatch, DID hash index and session handling
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "uds_srv.h"
+#include "../isotp_srv/isotp_srv.h"
+#include "../clock_srv/clock_srv.h"
+#include "../../driver/ultis/dwt_ultis.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* Service identifiers */
+#define UDS_SRV_SID_SESSION_CONTROL     (0x10U)
+#define UDS_SRV_SID_READ_DID            (0x22U)
+#define UDS_SRV_SID_WRITE_DID           (0x2EU)
+#define UDS_SRV_SID_ROUTINE_CONTROL     (0x31U)
+#define UDS_SRV_SID_TESTER_PRESENT      (0x3EU)
+#define UDS_SRV_SID_NEGATIVE            (0x7FU)
+#define UDS_SRV_POSITIVE_OFFSET         (0x40U)
+
+#define UDS_SRV_NRC_SERVICE_NOT_IN_SESSION  (0x7EU)
+
+#define UDS_SRV_SUPPRESS_POS_RSP        (0x80U)
+#define UDS_SRV_SUBFUNCTION_MASK        (0x7FU)
+
+/* Session timing reported in the 0x50 response */
+#define UDS_SRV_P2_MS                   (50U)
+#define UDS_SRV_P2_EXT_MS               (5000U)     /* Sent in 10 ms units */
+#define UDS_SRV_S3_MS                   (5000U)
+
+/* DID index: open addressing, twice the table size */
+#define UDS_SRV_HASH_BITS               (6U)
+#define UDS_SRV_HASH_SIZE               (1U << UDS_SRV_HASH_BITS)
+#define UDS_SRV_HASH_EMPTY              (0xFFU)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static uds_srv_config_t s_config;
+static uint8_t s_channel = ISOTP_SRV_NO_CHANNEL;
+static uint8_t s_session = UDS_SRV_SESSION_DEFAULT;
+static uint32_t s_cycles_per_ms = 0;
+static uint32_t s_last_request = 0;
+
+static uint8_t s_rx_buffer[UDS_SRV_MAX_REQUEST];
+static uint8_t s_response[UDS_SRV_MAX_RESPONSE];
+
+/* DID index: slot -> table position */
+static uint8_t s_index[UDS_SRV_HASH_SIZE];
+static uint16_t s_hash_mult = 0;
+
+static uds_srv_stats_t s_stats;
+
+/* Odd 16-bit multipliers tried by the index build */
+static const uint16_t s_hash_candidates[] = {
+    0x9E37U, 0x6A09U, 0xBB67U, 0x3C6FU, 0xA54FU, 0x510FU, 0x9B05U, 0x1F83U
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline uint8_t UDS_SRV_Hash(uint16_t did, uint16_t mult)
+{
+    return (uint8_t)((uint16_t)(did * mult) >> (16U - UDS_SRV_HASH_BITS));
+}
+
+/**
+ * @brief Fill the index with one multiplier
+ * @return Longest probe sequence, in compares
+ */
+static uint8_t UDS_SRV_BuildIndex(uint16_t mult)
+{
+    uint8_t worst = 0;
+    uint8_t probes;
+    uint8_t slot;
+
+    memset(s_index, UDS_SRV_HASH_EMPTY, sizeof(s_index));
+
+    for (uint8_t i = 0; i < s_config.did_count; i++) {
+        slot = UDS_SRV_Hash(s_config.dids[i].did, mult);
+        probes = 1U;
+        while (s_index[slot] != UDS_SRV_HASH_EMPTY) {
+            slot = (uint8_t)((slot + 1U) & (UDS_SRV_HASH_SIZE - 1U));
+            probes++;
+        }
+        s_index[slot] = i;
+        if (probes > worst) {
+            worst = probes;
+        }
+    }
+
+    return worst;
+}
+
+static const uds_srv_did_t *UDS_SRV_FindDid(uint16_t did)
+{
+    uint8_t slot = UDS_SRV_Hash(did, s_hash_mult);
+    uint8_t entry;
+
+    for (uint8_t n = 0; n < s_stats.max_probes; n++) {
+        entry = s_index[slot];
+        if (entry == UDS_SRV_HASH_EMPTY) {
+            return NULL;
+        }
+        if (s_config.dids[entry].did == did) {
+            return &s_config.dids[entry];
+        }
+        slot = (uint8_t)((slot + 1U) & (UDS_SRV_HASH_SIZE - 1U));
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Copy a DID value into the response, big-endian
+ */
+static void UDS_SRV_ReadDid(const uds_srv_did_t *entry, uint8_t *out)
+{
+    uint32_t value;
+
+    if (entry->data == NULL) {
+        entry->read(out);
+        return;
+    }
+
+    switch (entry->size) {
+        case 1U:
+            out[0] = *(volatile uint8_t *)entry->data;
+            break;
+
+        case 2U:
+            value = *(volatile uint16_t *)entry->data;
+            out[0] = (uint8_t)(value >> 8);
+            out[1] = (uint8_t)value;
+            break;
+
+        case 4U:
+            value = *(volatile uint32_t *)entry->data;
+            out[0] = (uint8_t)(value >> 24);
+            out[1] = (uint8_t)(value >> 16);
+            out[2] = (uint8_t)(value >> 8);
+            out[3] = (uint8_t)value;
+            break;
+
+        default:
+            for (uint8_t i = 0; i < entry->size; i++) {
+                out[i] = ((volatile uint8_t *)entry->data)[i];
+            }
+            break;
+    }
+}
+
+static uint8_t UDS_SRV_WriteDid(const uds_srv_did_t *entry, const uint8_t *in)
+{
+    if (entry->data == NULL) {
+        return (entry->write != NULL) ? entry->write(in) : UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+    }
+
+    switch (entry->size) {
+        case 1U:
+            *(volatile uint8_t *)entry->data = in[0];
+            break;
+
+        case 2U:
+            *(volatile uint16_t *)entry->data = (uint16_t)(((uint16_t)in[0] << 8) | in[1]);
+            break;
+
+        case 4U:
+            *(volatile uint32_t *)entry->data = ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) |
+                                                ((uint32_t)in[2] << 8) | in[3];
+            break;
+
+        default:
+            for (uint8_t i = 0; i < entry->size; i++) {
+                ((volatile uint8_t *)entry->data)[i] = in[i];
+            }
+            break;
+    }
+
+    return UDS_SRV_NRC_OK;
+}
+
+static void UDS_SRV_SetSession(uint8_t session)
+{
+    if (session != s_session) {
+        s_session = session;
+        if (s_config.on_session != NULL) {
+            s_config.on_session(session);
+        }
+    }
+}
+
+/*
+ * Service handlers: build the positive response in s_response and return
+ * its length in *length, or return an NRC.
+ */
+
+static uint8_t UDS_SRV_SessionControl(const uint8_t *req, uint16_t req_len, uint16_t *length)
+{
+    uint8_t session;
+
+    if (req_len != 2U) {
+        return UDS_SRV_NRC_INCORRECT_LENGTH;
+    }
+
+    session = req[1] & UDS_SRV_SUBFUNCTION_MASK;
+    if (session != UDS_SRV_SESSION_DEFAULT && session != UDS_SRV_SESSION_EXTENDED) {
+        return UDS_SRV_NRC_SUBFUNCTION_NOT_SUPPORTED;
+    }
+
+    UDS_SRV_SetSession(session);
+
+    s_response[1] = session;
+    s_response[2] = (uint8_t)(UDS_SRV_P2_MS >> 8);
+    s_response[3] = (uint8_t)UDS_SRV_P2_MS;
+    s_response[4] = (uint8_t)((UDS_SRV_P2_EXT_MS / 10U) >> 8);
+    s_response[5] = (uint8_t)(UDS_SRV_P2_EXT_MS / 10U);
+    *length = 6U;
+
+    return UDS_SRV_NRC_OK;
+}
+
+static uint8_t UDS_SRV_ReadDataByIdentifier(const uint8_t *req, uint16_t req_len, uint16_t *length)
+{
+    const uds_srv_did_t *entry;
+    uint16_t pos = 1U;
+    uint16_t did;
+
+    if (req_len < 3U || (req_len & 1U) == 0U) {
+        return UDS_SRV_NRC_INCORRECT_LENGTH;
+    }
+
+    for (uint16_t i = 1U; i < req_len; i += 2U) {
+        did = (uint16_t)(((uint16_t)req[i] << 8) | req[i + 1U]);
+        entry = UDS_SRV_FindDid(did);
+        if (entry == NULL || (entry->access & UDS_SRV_DID_READ) == 0U) {
+            continue;
+        }
+
+        if ((uint32_t)pos + 2U + entry->size > UDS_SRV_MAX_RESPONSE) {
+            return UDS_SRV_NRC_RESPONSE_TOO_LONG;
+        }
+
+        s_response[pos++] = req[i];
+        s_response[pos++] = req[i + 1U];
+        UDS_SRV_ReadDid(entry, &s_response[pos]);
+        pos = (uint16_t)(pos + entry->size);
+    }
+
+    if (pos == 1U) {
+        return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+    }
+
+    *length = pos;
+
+    return UDS_SRV_NRC_OK;
+}
+
+static uint8_t UDS_SRV_WriteDataByIdentifier(const uint8_t *req, uint16_t req_len, uint16_t *length)
+{
+    const uds_srv_did_t *entry;
+    uint8_t nrc;
+
+    if (req_len < 4U) {
+        return UDS_SRV_NRC_INCORRECT_LENGTH;
+    }
+
+    entry = UDS_SRV_FindDid((uint16_t)(((uint16_t)req[1] << 8) | req[2]));
+    if (entry == NULL || (entry->access & UDS_SRV_DID_WRITE) == 0U) {
+        return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+    }
+
+    if ((entry->access & UDS_SRV_DID_EXTENDED) != 0U && s_session != UDS_SRV_SESSION_EXTENDED) {
+        return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+    }
+
+    if (req_len != (uint16_t)(3U + entry->size)) {
+        return UDS_SRV_NRC_INCORRECT_LENGTH;
+    }
+
+    nrc = UDS_SRV_WriteDid(entry, &req[3]);
+    if (nrc != UDS_SRV_NRC_OK) {
+        return nrc;
+    }
+
+    s_response[1] = req[1];
+    s_response[2] = req[2];
+    *length = 3U;
+
+    return UDS_SRV_NRC_OK;
+}
+
+static uint8_t UDS_SRV_RoutineControl(const uint8_t *req, uint16_t req_len, uint16_t *length)
+{
+    const uds_srv_routine_t *routine = NULL;
+    uint16_t rid;
+    uint16_t result_len;
+    uint8_t control;
+    uint8_t nrc;
+
+    if (req_len < 4U) {
+        return UDS_SRV_NRC_INCORRECT_LENGTH;
+    }
+
+    control = req[1] & UDS_SRV_SUBFUNCTION_MASK;
+    if (control < UDS_SRV_ROUTINE_START || control > UDS_SRV_ROUTINE_RESULTS) {
+        return UDS_SRV_NRC_SUBFUNCTION_NOT_SUPPORTED;
+    }
+
+    /* Few routines: a linear search is enough */
+    rid = (uint16_t)(((uint16_t)req[2] << 8) | req[3]);
+    for (uint8_t i = 0; i < s_config.routine_count; i++) {
+        if (s_config.routines[i].rid == rid) {
+            routine = &s_config.routines[i];
+            break;
+        }
+    }
+
+    if (routine == NULL ||
+        (routine->extended_only && s_session != UDS_SRV_SESSION_EXTENDED)) {
+        return UDS_SRV_NRC_REQUEST_OUT_OF_RANGE;
+    }
+
+    result_len = (uint16_t)(UDS_SRV_MAX_RESPONSE - 4U);
+    nrc = routine->handler(control, &req[4], (uint16_t)(req_len - 4U), &s_response[4], &result_len);
+    if (nrc != UDS_SRV_NRC_OK) {
+        return nrc;
+    }
+
+    s_response[1] = control;
+    s_response[2] = req[2];
+    s_response[3] = req[3];
+    *length = (uint16_t)(4U + result_len);
+
+    return UDS_SRV_NRC_OK;
+}
+
+static uint8_t UDS_SRV_TesterPresent(const uint8_t *req, uint16_t req_len, uint16_t *length)
+{
+    if (req_len != 2U) {
+        return UDS_SRV_NRC_INCORRECT_LENGTH;
+    }
+
+    if ((req[1] & UDS_SRV_SUBFUNCTION_MASK) != 0U) {
+        return UDS_SRV_NRC_SUBFUNCTION_NOT_SUPPORTED;
+    }
+
+    s_response[1] = 0x00U;
+    *length = 2U;
+
+    return UDS_SRV_NRC_OK;
+}
+
+/**
+ * @brief Complete request from ISO-TP (main loop context)
+ */
+static void UDS_SRV_OnRequest(uint8_t channel, const uint8_t *data, uint16_t length, bool functional)
+{
+    uint32_t start = DWT_GetCycles();
+    uint32_t elapsed_us;
+    uint16_t rsp_len = 0;
+    uint8_t sid;
+    uint8_t nrc;
+    bool suppress = false;
+
+    (void)channel;
+
+    if (length == 0U) {
+        return;
+    }
+
+    /* The response buffer is still being sent */
+    if (ISOTP_SRV_IsBusy(s_channel)) {
+        s_stats.dropped++;
+        return;
+    }
+
+    s_stats.requests++;
+    s_last_request = start;
+    sid = data[0];
+
+    switch (sid) {
+        case UDS_SRV_SID_SESSION_CONTROL:
+            suppress = (length >= 2U) && ((data[1] & UDS_SRV_SUPPRESS_POS_RSP) != 0U);
+            nrc = UDS_SRV_SessionControl(data, length, &rsp_len);
+            break;
+
+        case UDS_SRV_SID_READ_DID:
+            nrc = UDS_SRV_ReadDataByIdentifier(data, length, &rsp_len);
+            break;
+
+        case UDS_SRV_SID_WRITE_DID:
+            nrc = UDS_SRV_WriteDataByIdentifier(data, length, &rsp_len);
+            break;
+
+        case UDS_SRV_SID_ROUTINE_CONTROL:
+            suppress = (length >= 2U) && ((data[1] & UDS_SRV_SUPPRESS_POS_RSP) != 0U);
+            nrc = UDS_SRV_RoutineControl(data, length, &rsp_len);
+            break;
+
+        case UDS_SRV_SID_TESTER_PRESENT:
+            suppress = (length >= 2U) && ((data[1] & UDS_SRV_SUPPRESS_POS_RSP) != 0U);
+            nrc = UDS_SRV_TesterPresent(data, length, &rsp_len);
+            break;
+
+        default:
+            nrc = UDS_SRV_NRC_SERVICE_NOT_SUPPORTED;
+            break;
+    }
+
+    if (nrc == UDS_SRV_NRC_OK) {
+        if (!suppress) {
+            s_response[0] = (uint8_t)(sid + UDS_SRV_POSITIVE_OFFSET);
+            ISOTP_SRV_Send(s_channel, s_response, rsp_len);
+        }
+    } else {
+        s_stats.negative_responses++;
+        if (!functional || (nrc != UDS_SRV_NRC_SERVICE_NOT_SUPPORTED &&
+                            nrc != UDS_SRV_NRC_SUBFUNCTION_NOT_SUPPORTED &&
+                            nrc != UDS_SRV_NRC_REQUEST_OUT_OF_RANGE &&
+                            nrc != UDS_SRV_NRC_SERVICE_NOT_IN_SESSION &&
+                            nrc != UDS_SRV_NRC_NOT_IN_ACTIVE_SESSION)) {
+            s_response[0] = UDS_SRV_SID_NEGATIVE;
+            s_response[1] = sid;
+            s_response[2] = nrc;
+            ISOTP_SRV_Send(s_channel, s_response, 3U);
+        }
+    }
+
+    elapsed_us = (DWT_GetCycles() - start) / (s_cycles_per_ms / 1000U);
+    s_stats.last_request_us = elapsed_us;
+    if (elapsed_us > s_stats.max_request_us) {
+        s_stats.max_request_us = elapsed_us;
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+uds_srv_status_t UDS_SRV_Init(const uds_srv_config_t *config)
+{
+    clock_srv_frequencies_t freq;
+    isotp_srv_config_t tp_cfg;
+    uint8_t best = 0xFFU;
+    uint8_t probes;
+
+    if (config == NULL || config->did_count > UDS_SRV_MAX_DIDS ||
+        (config->did_count != 0U && config->dids == NULL) ||
+        (config->routine_count != 0U && config->routines == NULL)) {
+        return UDS_SRV_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < config->did_count; i++) {
+        if (config->dids[i].size == 0U ||
+            (config->dids[i].data == NULL && config->dids[i].read == NULL)) {
+            return UDS_SRV_INVALID_PARAM;
+        }
+        for (uint8_t j = 0; j < i; j++) {
+            if (config->dids[j].did == config->dids[i].did) {
+                return UDS_SRV_INVALID_PARAM;
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < config->routine_count; i++) {
+        if (config->routines[i].handler == NULL) {
+            return UDS_SRV_INVALID_PARAM;
+        }
+    }
+
+    if (CLOCK_SRV_GetFrequencies(&freq) != CLOCK_SRV_SUCCESS) {
+        return UDS_SRV_ERROR;
+    }
+    s_cycles_per_ms = freq.core_hz / 1000U;
+
+    s_config = *config;
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    /* Keep the multiplier with the shortest worst-case probe sequence */
+    for (uint8_t i = 0; i < (uint8_t)(sizeof(s_hash_candidates) / sizeof(s_hash_candidates[0])); i++) {
+        probes = UDS_SRV_BuildIndex(s_hash_candidates[i]);
+        if (probes < best) {
+            best = probes;
+            s_hash_mult = s_hash_candidates[i];
+        }
+    }
+    s_stats.max_probes = UDS_SRV_BuildIndex(s_hash_mult);
+
+    tp_cfg.rx_id = config->rx_id;
+    tp_cfg.tx_id = config->tx_id;
+    tp_cfg.functional_id = config->functional_id;
+    tp_cfg.block_size = 0U;
+    tp_cfg.st_min = 0U;
+    tp_cfg.rx_buffer = s_rx_buffer;
+    tp_cfg.rx_size = sizeof(s_rx_buffer);
+    tp_cfg.on_receive = UDS_SRV_OnRequest;
+    tp_cfg.on_tx_done = NULL;
+
+    switch (ISOTP_SRV_Open(&tp_cfg, &s_channel)) {
+        case ISOTP_SRV_SUCCESS:
+            break;
+
+        case ISOTP_SRV_NO_RESOURCE:
+            return UDS_SRV_NO_RESOURCE;
+
+        default:
+            return UDS_SRV_ERROR;
+    }
+
+    s_session = UDS_SRV_SESSION_DEFAULT;
+    s_initialized = true;
+
+    return UDS_SRV_SUCCESS;
+}
+
+void UDS_SRV_Process(void)
+{
+    if (!s_initialized) {
+        return;
+    }
+
+    ISOTP_SRV_Process();
+
+    /* S3: fall back to the default session when the tester goes quiet */
+    if (s_session != UDS_SRV_SESSION_DEFAULT &&
+        (DWT_GetCycles() - s_last_request) >= UDS_SRV_S3_MS * s_cycles_per_ms) {
+        UDS_SRV_SetSession(UDS_SRV_SESSION_DEFAULT);
+    }
+}
+
+uint8_t UDS_SRV_GetSession(void)
+{
+    return s_session;
+}
+
+uds_srv_status_t UDS_SRV_GetStats(uds_srv_stats_t *stats)
+{
+    if (stats == NULL) {
+        return UDS_SRV_INVALID_PARAM;
+    }
+
+    if (!s_initialized) {
+        return UDS_SRV_NOT_INITIALIZED;
+    }
+
+    *stats = s_stats;
+
+    return UDS_SRV_SUCCESS;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file    uds_srv.h
+ * @brief   UDS Diagnostic Service - Abstraction API
+ * @details
+ * ISO 14229 diagnostic server on one ISO-TP channel (isotp_srv):
+ * - 0x10 DiagnosticSessionControl: default (0x01) and extended (0x03)
+ *   session, back to default after 5 s without a request (S3)
+ * - 0x22 ReadDataByIdentifier: several DIDs per request, answered in one
+ *   response; unsupported DIDs are left out (NRC 0x31 if none is known)
+ * - 0x2E WriteDataByIdentifier
+ * - 0x31 RoutineControl: start, stop and request results
+ * - 0x3E TesterPresent
+ * The suppress-positive-response bit is honoured for services with a
+ * sub-function. Functional requests get no NRC 0x11/0x12/0x31/0x7E/0x7F.
+ *
+ * Data identifiers come from a const table built with UDS_SRV_DID_VAR()
+ * (a live application variable, 1/2/4 byte values sent big-endian) or
+ * UDS_SRV_DID_FN() (read/write handlers). UDS_SRV_Init() builds a hash
+ * index over the table, choosing the multiplier with the shortest probe
+ * sequence, so a lookup costs at most a few compares whatever the table
+ * size.
+ *
+ * Requests are handled in UDS_SRV_Process() from the main loop; the CAN
+ * interrupt only copies frames (see isotp_srv). Diagnostics therefore
+ * never add latency to interrupt-driven work such as sampling. The time
+ * spent per request is measured with the DWT cycle counter.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef UDS_SRV_H
+#define UDS_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Limits */
+#define UDS_SRV_MAX_DIDS            (32U)
+#define UDS_SRV_MAX_REQUEST         (128U)          /* Longer requests are refused by ISO-TP */
+#define UDS_SRV_MAX_RESPONSE        (256U)
+
+/** @brief Sessions */
+#define UDS_SRV_SESSION_DEFAULT     (0x01U)
+#define UDS_SRV_SESSION_EXTENDED    (0x03U)
+
+/** @brief Routine control types */
+#define UDS_SRV_ROUTINE_START       (0x01U)
+#define UDS_SRV_ROUTINE_STOP        (0x02U)
+#define UDS_SRV_ROUTINE_RESULTS     (0x03U)
+
+/** @brief Negative response codes */
+#define UDS_SRV_NRC_OK                          (0x00U)     /* Positive response */
+#define UDS_SRV_NRC_SERVICE_NOT_SUPPORTED       (0x11U)
+#define UDS_SRV_NRC_SUBFUNCTION_NOT_SUPPORTED   (0x12U)
+#define UDS_SRV_NRC_INCORRECT_LENGTH            (0x13U)
+#define UDS_SRV_NRC_RESPONSE_TOO_LONG           (0x14U)
+#define UDS_SRV_NRC_CONDITIONS_NOT_CORRECT      (0x22U)
+#define UDS_SRV_NRC_REQUEST_SEQUENCE_ERROR      (0x24U)
+#define UDS_SRV_NRC_REQUEST_OUT_OF_RANGE        (0x31U)
+#define UDS_SRV_NRC_NOT_IN_ACTIVE_SESSION       (0x7FU)
+
+/** @brief DID access */
+#define UDS_SRV_DID_READ            (0x01U)
+#define UDS_SRV_DID_WRITE           (0x02U)
+#define UDS_SRV_DID_RW              (UDS_SRV_DID_READ | UDS_SRV_DID_WRITE)
+#define UDS_SRV_DID_EXTENDED        (0x04U)         /* Write only in the extended session */
+
+/**
+ * @brief DID mapped onto an application variable
+ * @details Size is taken from the variable at compile time, so the table
+ *          can live in flash.
+ */
+#define UDS_SRV_DID_VAR(did, access, var) \
+    { (uint16_t)(did), (uint8_t)sizeof(var), (uint8_t)(access), (volatile void *)&(var), NULL, NULL }
+
+/**
+ * @brief DID served by handlers
+ */
+#define UDS_SRV_DID_FN(did, size, access, read, write) \
+    { (uint16_t)(did), (uint8_t)(size), (uint8_t)(access), NULL, (read), (write) }
+
+/**
+ * @brief UDS service status codes
+ */
+typedef enum {
+    UDS_SRV_SUCCESS = 0,            /**< Operation successful */
+    UDS_SRV_ERROR,                  /**< General error */
+    UDS_SRV_NOT_INITIALIZED,        /**< Service not initialized */
+    UDS_SRV_INVALID_PARAM,          /**< Invalid parameter or duplicate DID */
+    UDS_SRV_NO_RESOURCE             /**< No ISO-TP channel left */
+} uds_srv_status_t;
+
+/**
+ * @brief DID read handler
+ * @param out Receives exactly `size` bytes
+ */
+typedef void (*uds_srv_did_read_t)(uint8_t *out);
+
+/**
+ * @brief DID write handler
+ * @param in Exactly `size` bytes
+ * @return UDS_SRV_NRC_OK or a negative response code
+ */
+typedef uint8_t (*uds_srv_did_write_t)(const uint8_t *in);
+
+/**
+ * @brief Data identifier (use UDS_SRV_DID_VAR() / UDS_SRV_DID_FN())
+ */
+typedef struct {
+    uint16_t did;
+    uint8_t size;                   /**< Bytes on the wire */
+    uint8_t access;                 /**< UDS_SRV_DID_x */
+    volatile void *data;            /**< Variable, or NULL for handlers */
+    uds_srv_did_read_t read;
+    uds_srv_did_write_t write;
+} uds_srv_did_t;
+
+/**
+ * @brief Routine handler
+ * @param control UDS_SRV_ROUTINE_START / STOP / RESULTS
+ * @param option Routine control option record
+ * @param option_length Option record length
+ * @param result Status record buffer
+ * @param result_length In: buffer size, out: bytes written (0 on entry)
+ * @return UDS_SRV_NRC_OK or a negative response code
+ */
+typedef uint8_t (*uds_srv_routine_handler_t)(uint8_t control, const uint8_t *option,
+                                             uint16_t option_length, uint8_t *result,
+                                             uint16_t *result_length);
+
+/**
+ * @brief Routine identifier
+ */
+typedef struct {
+    uint16_t rid;
+    bool extended_only;             /**< Refused in the default session */
+    uds_srv_routine_handler_t handler;
+} uds_srv_routine_t;
+
+/**
+ * @brief Service configuration
+ */
+typedef struct {
+    uint32_t rx_id;                 /**< Physical request ID (e.g. 0x7E0) */
+    uint32_t tx_id;                 /**< Response ID (e.g. 0x7E8) */
+    uint32_t functional_id;         /**< Functional request ID (e.g. 0x7DF), 0 = none */
+    const uds_srv_did_t *dids;
+    uint8_t did_count;              /**< Up to UDS_SRV_MAX_DIDS */
+    const uds_srv_routine_t *routines;
+    uint8_t routine_count;
+    void (*on_session)(uint8_t session);    /**< Optional, NULL allowed */
+} uds_srv_config_t;
+
+/**
+ * @brief Service statistics
+ */
+typedef struct {
+    uint32_t requests;
+    uint32_t negative_responses;
+    uint32_t dropped;               /**< Requests received while a response was being sent */
+    uint32_t last_request_us;       /**< Request handling time, excluding transmission */
+    uint32_t max_request_us;
+    uint8_t max_probes;             /**< Worst DID lookup, in compares */
+} uds_srv_stats_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize the diagnostic server
+ * @details CAN_SRV_Init() and CLOCK_SRV_Init() must have been called.
+ * @param config Configuration, the tables must stay valid
+ * @return uds_srv_status_t Status of initialization
+ */
+uds_srv_status_t UDS_SRV_Init(const uds_srv_config_t *config);
+
+/**
+ * @brief Handle pending requests and session timing
+ * @details Call from the main loop. Also runs ISOTP_SRV_Process().
+ */
+void UDS_SRV_Process(void);
+
+/**
+ * @brief Get the active session
+ * @return uint8_t UDS_SRV_SESSION_x
+ */
+uint8_t UDS_SRV_GetSession(void);
+
+/**
+ * @brief Get service statistics
+ * @param stats Output
+ * @return uds_srv_status_t Status of operation
+ */
+uds_srv_status_t UDS_SRV_GetStats(uds_srv_stats_t *stats);
+
+#endif /* UDS_SRV_H */
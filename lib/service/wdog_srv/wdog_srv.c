@@ -0,0 +1,321 @@
+/**
+ * @file    wdog_srv.c
+ * @brief   Watchdog Supervisor Service Implementation
+ * @details Task deadlines, windowed refresh and timeout margin statistics
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "wdog_srv.h"
+#include "../../driver/wdog/wdog.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Supervised task
+ */
+typedef struct {
+    const char *name;
+    uint32_t deadline_ms;
+    uint32_t deadline_ticks;
+    volatile uint32_t checkins;     /**< Incremented by the task */
+    volatile bool suspended;
+    bool was_suspended;             /**< suspended at the last Process pass */
+    uint32_t seen;                  /**< checkins at the last stamp */
+    uint32_t stamp;                 /**< Time of the last check-in, ticks */
+    uint32_t worst_ticks;
+} wdog_srv_task_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static uint32_t s_tick_hz = WDOG_LPO_CLOCK_HZ;
+static uint16_t s_timeout_ticks = 0;
+static uint16_t s_window_ticks = 0;
+static wdog_srv_miss_callback_t s_on_miss = NULL;
+
+static wdog_srv_task_t s_tasks[WDOG_SRV_MAX_TASKS];
+static uint8_t s_task_count = 0;
+
+/* Monotonic time built from the WDOG counter */
+static uint32_t s_now = 0;
+static uint16_t s_last_cnt = 0;
+
+static uint32_t s_refresh_count = 0;
+static uint16_t s_max_refresh_cnt = 0;
+static uint8_t s_expired_task = WDOG_SRV_NO_TASK;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint32_t WDOG_SRV_MsToTicks(uint32_t ms)
+{
+    return (uint32_t)(((uint64_t)ms * s_tick_hz) / 1000U);
+}
+
+static uint32_t WDOG_SRV_TicksToUs(uint32_t ticks)
+{
+    return (uint32_t)(((uint64_t)ticks * 1000000U) / s_tick_hz);
+}
+
+static uint32_t WDOG_SRV_TicksToMs(uint32_t ticks)
+{
+    return (uint32_t)(((uint64_t)ticks * 1000U) / s_tick_hz);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+wdog_srv_status_t WDOG_SRV_Init(const wdog_srv_config_t *config)
+{
+    wdog_config_t wdog_cfg;
+    wdog_status_t status;
+
+    if (config == NULL || config->timeout_ms == 0U ||
+        config->timeout_ms > WDOG_SRV_MAX_TIMEOUT_MS ||
+        config->window_ms >= config->timeout_ms) {
+        return WDOG_SRV_INVALID_PARAM;
+    }
+
+    /* Full LPO resolution when TOVAL allows it */
+    wdog_cfg.prescaler = config->timeout_ms > WDOG_SRV_LPO_MAX_TIMEOUT_MS;
+    s_tick_hz = wdog_cfg.prescaler ? (WDOG_LPO_CLOCK_HZ / WDOG_PRESCALER_DIV) : WDOG_LPO_CLOCK_HZ;
+
+    s_timeout_ticks = (uint16_t)WDOG_SRV_MsToTicks(config->timeout_ms);
+    s_window_ticks = (uint16_t)WDOG_SRV_MsToTicks(config->window_ms);
+    if (config->window_ms != 0U && s_window_ticks == 0U) {
+        s_window_ticks = 1U;
+    }
+
+    wdog_cfg.clock = WDOG_CLOCK_LPO;
+    wdog_cfg.timeout = s_timeout_ticks;
+    wdog_cfg.window = s_window_ticks;
+    wdog_cfg.interrupt = false;
+    wdog_cfg.run_in_debug = false;
+    wdog_cfg.allow_update = !config->lock;
+
+    s_on_miss = config->on_miss;
+    s_now = 0;
+    s_last_cnt = 0;
+    s_refresh_count = 0;
+    s_max_refresh_cnt = 0;
+    s_expired_task = WDOG_SRV_NO_TASK;
+
+    /* Deadlines of tasks registered before the clock was known */
+    for (uint8_t i = 0; i < s_task_count; i++) {
+        s_tasks[i].deadline_ticks = WDOG_SRV_MsToTicks(s_tasks[i].deadline_ms);
+        s_tasks[i].seen = s_tasks[i].checkins;
+        s_tasks[i].stamp = 0;
+        s_tasks[i].worst_ticks = 0;
+    }
+
+    status = WDOG_Init(WDOG, &wdog_cfg);
+    if (status == WDOG_STATUS_LOCKED) {
+        return WDOG_SRV_LOCKED;
+    }
+    if (status != WDOG_STATUS_SUCCESS) {
+        return WDOG_SRV_ERROR;
+    }
+
+    s_initialized = true;
+
+    return WDOG_SRV_SUCCESS;
+}
+
+wdog_srv_status_t WDOG_SRV_Deinit(void)
+{
+    if (!s_initialized) {
+        return WDOG_SRV_NOT_INITIALIZED;
+    }
+
+    if (WDOG_Disable(WDOG) != WDOG_STATUS_SUCCESS) {
+        return WDOG_SRV_LOCKED;
+    }
+
+    s_initialized = false;
+
+    return WDOG_SRV_SUCCESS;
+}
+
+bool WDOG_SRV_IsInitialized(void)
+{
+    return s_initialized;
+}
+
+wdog_srv_status_t WDOG_SRV_RegisterTask(const char *name, uint32_t deadline_ms, uint8_t *task)
+{
+    wdog_srv_task_t *t;
+
+    if (deadline_ms == 0U || task == NULL) {
+        return WDOG_SRV_INVALID_PARAM;
+    }
+
+    if (s_task_count >= WDOG_SRV_MAX_TASKS) {
+        return WDOG_SRV_NO_RESOURCE;
+    }
+
+    t = &s_tasks[s_task_count];
+    t->name = name;
+    t->deadline_ms = deadline_ms;
+    t->deadline_ticks = WDOG_SRV_MsToTicks(deadline_ms);
+    t->checkins = 0;
+    t->suspended = false;
+    t->was_suspended = false;
+    t->seen = 0;
+    t->stamp = s_now;
+    t->worst_ticks = 0;
+
+    *task = s_task_count;
+    s_task_count++;
+
+    return WDOG_SRV_SUCCESS;
+}
+
+wdog_srv_status_t WDOG_SRV_SetDeadline(uint8_t task, uint32_t deadline_ms)
+{
+    if (task >= s_task_count || deadline_ms == 0U) {
+        return WDOG_SRV_INVALID_PARAM;
+    }
+
+    s_tasks[task].deadline_ms = deadline_ms;
+    s_tasks[task].deadline_ticks = WDOG_SRV_MsToTicks(deadline_ms);
+
+    return WDOG_SRV_SUCCESS;
+}
+
+void WDOG_SRV_CheckIn(uint8_t task)
+{
+    if (task < s_task_count) {
+        s_tasks[task].checkins++;
+    }
+}
+
+void WDOG_SRV_Suspend(uint8_t task)
+{
+    if (task < s_task_count) {
+        s_tasks[task].suspended = true;
+    }
+}
+
+void WDOG_SRV_Resume(uint8_t task)
+{
+    if (task < s_task_count) {
+        /* Check-in first: Process reads suspended before checkins */
+        s_tasks[task].checkins++;
+        s_tasks[task].suspended = false;
+    }
+}
+
+void WDOG_SRV_Process(void)
+{
+    wdog_srv_task_t *t;
+    uint16_t cnt;
+    uint32_t checkins;
+    uint32_t age;
+    bool suspended;
+    bool healthy = true;
+
+    if (!s_initialized) {
+        return;
+    }
+
+    /* Counter only restarts on our own refresh, so it never goes backwards here */
+    cnt = WDOG_GetCounter(WDOG);
+    s_now += (uint16_t)(cnt - s_last_cnt);
+    s_last_cnt = cnt;
+
+    for (uint8_t i = 0; i < s_task_count; i++) {
+        t = &s_tasks[i];
+        suspended = t->suspended;
+        checkins = t->checkins;
+        age = s_now - t->stamp;
+
+        if (checkins != t->seen) {
+            t->seen = checkins;
+            t->stamp = s_now;
+            /* Time spent suspended is not a gap */
+            if (!suspended && !t->was_suspended && age > t->worst_ticks) {
+                t->worst_ticks = age;
+            }
+        } else if (!suspended && age > t->deadline_ticks) {
+            if (age > t->worst_ticks) {
+                t->worst_ticks = age;
+            }
+            healthy = false;
+            if (s_expired_task == WDOG_SRV_NO_TASK) {
+                s_expired_task = i;
+                if (s_on_miss != NULL) {
+                    s_on_miss(i);
+                }
+            }
+        }
+        t->was_suspended = suspended;
+    }
+
+    /* Once latched, never refresh again - the reset is the recovery */
+    if (!healthy || s_expired_task != WDOG_SRV_NO_TASK) {
+        return;
+    }
+
+    /* Closed window: a refresh now would reset the node */
+    if (cnt < s_window_ticks) {
+        return;
+    }
+
+    WDOG_Refresh(WDOG);
+
+    /* Ticks between the read and the refresh are dropped from s_now */
+    s_last_cnt = 0;
+    s_refresh_count++;
+    if (cnt > s_max_refresh_cnt) {
+        s_max_refresh_cnt = cnt;
+    }
+}
+
+wdog_srv_status_t WDOG_SRV_GetStats(wdog_srv_stats_t *stats)
+{
+    if (stats == NULL) {
+        return WDOG_SRV_INVALID_PARAM;
+    }
+
+    if (!s_initialized) {
+        return WDOG_SRV_NOT_INITIALIZED;
+    }
+
+    stats->refresh_count = s_refresh_count;
+    stats->max_counter_us = WDOG_SRV_TicksToUs(s_max_refresh_cnt);
+    stats->min_margin_us = WDOG_SRV_TicksToUs((uint32_t)s_timeout_ticks - s_max_refresh_cnt);
+    stats->expired_task = s_expired_task;
+
+    return WDOG_SRV_SUCCESS;
+}
+
+wdog_srv_status_t WDOG_SRV_GetTaskStats(uint8_t task, wdog_srv_task_stats_t *stats)
+{
+    if (task >= s_task_count || stats == NULL) {
+        return WDOG_SRV_INVALID_PARAM;
+    }
+
+    stats->name = s_tasks[task].name;
+    stats->deadline_ms = s_tasks[task].deadline_ms;
+    stats->worst_age_ms = WDOG_SRV_TicksToMs(s_tasks[task].worst_ticks);
+    stats->suspended = s_tasks[task].suspended;
+
+    return WDOG_SRV_SUCCESS;
+}
+
+bool WDOG_SRV_WasWatchdogReset(void)
+{
+    return WDOG_IsResetCause();
+}
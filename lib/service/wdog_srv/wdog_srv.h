@@ -0,0 +1,209 @@
+/**
+ * @file    wdog_srv.h
+ * @brief   Watchdog Supervisor Service - Abstraction API
+ * @details
+ * Windowed hardware watchdog refreshed by a task supervisor instead of a
+ * bare "kick" in the main loop.
+ *
+ * Components register the activities that must make progress at a known
+ * rate (sampling, ...) with a deadline. Each activity calls
+ * WDOG_SRV_CheckIn() whenever it makes progress, and is suspended while it
+ * has no work. Event-driven work with no guaranteed rate (CAN commands,
+ * UART forwarding) is covered by the loop itself: a handler that hangs
+ * keeps WDOG_SRV_Process() from running. WDOG_SRV_Process(), run
+ * from the main loop, refreshes the WDOG only when:
+ * - every registered, non-suspended task has checked in within its
+ *   deadline, and
+ * - the counter has passed the window, so an early refresh can never
+ *   reach the hardware
+ *
+ * A task that misses its deadline is latched: the supervisor stops
+ * refreshing and the WDOG resets the node within one timeout, even if
+ * the task recovers in between.
+ *
+ * Timebase: the WDOG counter itself (128 kHz LPO, or LPO / 256 for
+ * timeouts above WDOG_SRV_LPO_MAX_TIMEOUT_MS). Check-ins are stamped when
+ * WDOG_SRV_Process() sees them, so ages have the resolution of one main
+ * loop pass.
+ *
+ * Statistics: the highest counter value seen at a refresh (closest
+ * approach to the timeout), refresh count and the worst interval between
+ * check-ins of every task.
+ *
+ * Tasks may be registered before WDOG_SRV_Init(), so components can do it
+ * during their own initialization and the watchdog is only started once
+ * the whole node is up.
+ *
+ * @author  PhucPH32
+ * @date    07/12/2025
+ * @version 1.0
+ */
+
+#ifndef WDOG_SRV_H
+#define WDOG_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Supervised tasks */
+#define WDOG_SRV_MAX_TASKS              (8U)
+
+/** @brief No task (WDOG_SRV_GetStats() expired_task) */
+#define WDOG_SRV_NO_TASK                (0xFFU)
+
+/** @brief Longest timeout without the /256 prescaler (65535 LPO ticks) */
+#define WDOG_SRV_LPO_MAX_TIMEOUT_MS     (511U)
+
+/** @brief Longest timeout with the prescaler */
+#define WDOG_SRV_MAX_TIMEOUT_MS         (131000U)
+
+/**
+ * @brief Watchdog service status codes
+ */
+typedef enum {
+    WDOG_SRV_SUCCESS = 0,           /**< Operation successful */
+    WDOG_SRV_ERROR,                 /**< General error */
+    WDOG_SRV_NOT_INITIALIZED,       /**< Service not initialized */
+    WDOG_SRV_INVALID_PARAM,         /**< Invalid parameter */
+    WDOG_SRV_NO_RESOURCE,           /**< Task table full */
+    WDOG_SRV_LOCKED                 /**< WDOG configuration locked until reset */
+} wdog_srv_status_t;
+
+/**
+ * @brief Deadline miss notification
+ * @details Called once from WDOG_SRV_Process() when the first task is
+ *          latched as expired. The reset follows within one timeout.
+ * @param task Task ID
+ */
+typedef void (*wdog_srv_miss_callback_t)(uint8_t task);
+
+/**
+ * @brief Service configuration
+ */
+typedef struct {
+    uint32_t timeout_ms;            /**< Reset when not refreshed for this long */
+    uint32_t window_ms;             /**< Earliest refresh, 0 = normal mode */
+    bool lock;                      /**< Lock the WDOG configuration until reset */
+    wdog_srv_miss_callback_t on_miss;   /**< Optional, NULL allowed */
+} wdog_srv_config_t;
+
+/**
+ * @brief Supervisor statistics
+ */
+typedef struct {
+    uint32_t refresh_count;         /**< Refreshes since WDOG_SRV_Init() */
+    uint32_t max_counter_us;        /**< Highest counter at a refresh */
+    uint32_t min_margin_us;         /**< timeout - max_counter_us */
+    uint8_t expired_task;           /**< Latched task, WDOG_SRV_NO_TASK if none */
+} wdog_srv_stats_t;
+
+/**
+ * @brief Per-task statistics
+ */
+typedef struct {
+    const char *name;
+    uint32_t deadline_ms;
+    uint32_t worst_age_ms;          /**< Longest time seen without a check-in */
+    bool suspended;
+} wdog_srv_task_stats_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Configure and start the watchdog
+ * @details LPO clock, windowed mode when window_ms != 0. Registered tasks
+ *          start their deadline now.
+ * @param config Configuration
+ * @return wdog_srv_status_t Status of initialization
+ */
+wdog_srv_status_t WDOG_SRV_Init(const wdog_srv_config_t *config);
+
+/**
+ * @brief Stop the watchdog
+ * @return wdog_srv_status_t WDOG_SRV_LOCKED if started with lock
+ */
+wdog_srv_status_t WDOG_SRV_Deinit(void);
+
+/**
+ * @brief Check if the supervisor is running
+ * @return true if initialized
+ */
+bool WDOG_SRV_IsInitialized(void);
+
+/**
+ * @brief Register a supervised task
+ * @param name Name for diagnostics (not copied)
+ * @param deadline_ms Longest allowed time between check-ins
+ * @param task Receives the task ID
+ * @return wdog_srv_status_t WDOG_SRV_NO_RESOURCE if the table is full
+ */
+wdog_srv_status_t WDOG_SRV_RegisterTask(const char *name, uint32_t deadline_ms, uint8_t *task);
+
+/**
+ * @brief Change the deadline of a task
+ * @details Main loop only.
+ * @param task Task ID
+ * @param deadline_ms Longest allowed time between check-ins
+ * @return wdog_srv_status_t Status of operation
+ */
+wdog_srv_status_t WDOG_SRV_SetDeadline(uint8_t task, uint32_t deadline_ms);
+
+/**
+ * @brief Report progress of a task
+ * @details Interrupt safe, a counter increment.
+ * @param task Task ID
+ */
+void WDOG_SRV_CheckIn(uint8_t task);
+
+/**
+ * @brief Stop supervising a task (e.g. sampling stopped)
+ * @details Interrupt safe.
+ * @param task Task ID
+ */
+void WDOG_SRV_Suspend(uint8_t task);
+
+/**
+ * @brief Supervise a suspended task again
+ * @details Interrupt safe. Counts as a check-in, so the deadline restarts.
+ * @param task Task ID
+ */
+void WDOG_SRV_Resume(uint8_t task);
+
+/**
+ * @brief Check deadlines and refresh the watchdog
+ * @details Call from the main loop, at least once per window and well
+ *          within the timeout.
+ */
+void WDOG_SRV_Process(void);
+
+/**
+ * @brief Get supervisor statistics
+ * @param stats Output
+ * @return wdog_srv_status_t Status of operation
+ */
+wdog_srv_status_t WDOG_SRV_GetStats(wdog_srv_stats_t *stats);
+
+/**
+ * @brief Get statistics of one task
+ * @param task Task ID
+ * @param stats Output
+ * @return wdog_srv_status_t Status of operation
+ */
+wdog_srv_status_t WDOG_SRV_GetTaskStats(uint8_t task, wdog_srv_task_stats_t *stats);
+
+/**
+ * @brief Check whether the last reset was a watchdog reset
+ * @return true if RCM reports a WDOG reset
+ */
+bool WDOG_SRV_WasWatchdogReset(void);
+
+#endif /* WDOG_SRV_H */
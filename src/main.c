@@ -1,14 +1,21 @@
 /**
  * @file    main.c
- * @brief   Main Application Entry Point - Board Selection
- * @details Allows selection between different board applications:
- *          - Board 1: ADC Sampling Board (CAN controlled)
- *          - Board 2: Gateway Board (CAN to UART)
- *          - Example: CAN Loopback Test
+ * @brief   Main Application Entry Point
+ * @details One image for every board. The node application selects its
+ *          role at runtime (strap pins, see app_node.h):
+ *          - Sampler: ADC Sampling Board (CAN controlled, app_b1)
+ *          - Gateway: Gateway Board (CAN to UART, app_b2)
+ *          - Both components together on one board
+ *
+ *          Built with BUILD_BOOTLOADER (and S32K144_64_flash_boot.ld) the
+ *          same tree produces the resident CAN bootloader instead; the node
+ *          image is then linked with S32K144_64_flash_app.ld. The
+ *          Debug_FLASH_Boot and Debug_FLASH_App configurations build the
+ *          two images.
  *
  * @author  PhucPH32
  * @date    07/12/2025
- * @version 2.0
+ * @version 3.1
  */
 
 #include <stdio.h>
@@ -17,24 +24,13 @@
 #include <stdint.h>
 
 /*******************************************************************************
- * Board Selection Configuration
- * Uncomment ONE of the following lines to select which board to compile:
- ******************************************************************************/
-
-#define BUILD_BOARD_1      /* Board 1: ADC Sampling (receives CAN commands) */
-//#define BUILD_BOARD_2       /* Board 2: Gateway (buttons + UART) */
-
-/*******************************************************************************
- * Includes based on selected board
+ * Includes
  ******************************************************************************/
- 
-#ifdef BUILD_BOARD_1
-    #include "../lib/app/app_b1/app_b1.h"
-#elif defined(BUILD_BOARD_2)
-    #include "../lib/app/app_b2/app_b2.h"
 
+#ifdef BUILD_BOOTLOADER
+#include "../lib/app/app_boot/app_boot.h"
 #else
-    #error "Please select a board configuration (BUILD_BOARD_1, BUILD_BOARD_2, or BUILD_EXAMPLE)"
+#include "../lib/app/app_node/app_node.h"
 #endif
 
 
@@ -44,22 +40,18 @@
 
 int main(void)
 {
-#ifdef BUILD_BOARD_1
-    /* Board 1: ADC Sampling Board */
-    if (APP_B1_Init() != APP_B1_SUCCESS) {
+#ifdef BUILD_BOOTLOADER
+    if (APP_BOOT_Init() != APP_BOOT_SUCCESS) {
         /* Initialization failed */
         while (1);
     }
-    APP_B1_Run();  /* Never returns */
-    
-#elif defined(BUILD_BOARD_2)
-    /* Board 2: Gateway Board */
-    if (APP_B2_Init() != APP_B2_SUCCESS) {
+    APP_BOOT_Run();  /* Never returns */
+#else
+    if (APP_NODE_Init() != APP_NODE_SUCCESS) {
         /* Initialization failed */
         while (1);
     }
-    APP_B2_Run();  /* Never returns */
-    
+    APP_NODE_Run();  /* Never returns */
 #endif
 
     return 0;
@@ -0,0 +1,248 @@
+/**
+ * @file    bench.c
+ * @brief   Host Hot Path Benchmark - time budgets
+ * @details Host counterpart of lib/example_srv/hotpath_bench_ex.c: times
+ *          the per-sample, per-frame and per-byte calls of the release
+ *          build against the simulated register maps and compares each
+ *          against a budget, so a change that makes one of them slower
+ *          fails `make bench` before it reaches the target.
+ *
+ * The peripherals are brought up with the behavioural models on, then the
+ * models are turned off so every register is plain RAM and only driver
+ * code is timed. Registers the timed calls poll are preset once (TDRE
+ * comes out of reset set, COCO and the RX mailbox flag are poked).
+ *
+ * Each entry runs HOST_BENCH_BATCH times per sample through a wrapper; the
+ * cost of an empty wrapper is subtracted and the fastest of
+ * HOST_BENCH_REPEAT samples is kept, so scheduler noise does not count.
+ * Budgets are host nanoseconds with ample margin: they catch a path that
+ * grows a loop or a lock, not a few instructions.
+ *
+ * Expected Behavior:
+ * - One line per entry: name, ns per call, budget
+ * - Exit code is the number of entries over budget (0 = pass)
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "sim.h"
+#include "gpio_srv.h"
+#include "gpio_fast.h"
+#include "uart_srv.h"
+#include "uart_fast.h"
+#include "can_srv.h"
+#include "can_fast.h"
+#include "adc_srv.h"
+#include "lpit_srv.h"
+#include "clock_srv.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOST_BENCH_REPEAT       (32U)
+#define HOST_BENCH_BATCH        (1000U)
+
+#define HOST_BENCH_GPIO_PORT    (3U)        /* Port D */
+#define HOST_BENCH_GPIO_PIN     (0U)        /* PTD0, blue LED */
+#define HOST_BENCH_UART         (UART_SRV_INSTANCE_1)
+#define HOST_BENCH_CAN_RX_MB    (16U)
+#define HOST_BENCH_CAN_TX_MB    (CAN_TX_MB_START)   /* Shared mailbox of CAN_SRV_Send */
+#define HOST_BENCH_ADC_CHANNEL  (12U)
+
+/**
+ * @brief One timed call
+ */
+typedef struct {
+    const char *name;
+    void (*run)(void);
+    uint32_t budget;                /**< Nanoseconds, wrapper cost excluded */
+} host_bench_entry_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static can_srv_message_t s_frame;
+static can_message_t s_rx_frame;
+static adc_srv_config_t s_adc = { .channel = HOST_BENCH_ADC_CHANNEL };
+static lpit_srv_config_t s_lpit = { .channel = 0U, .period_us = 1000U };
+static volatile uint32_t s_sink;
+
+/*******************************************************************************
+ * Timed calls
+ ******************************************************************************/
+
+static void Bench_Empty(void)
+{
+}
+
+static void Bench_GpioToggle(void)
+{
+    GPIO_SRV_Toggle(HOST_BENCH_GPIO_PORT, HOST_BENCH_GPIO_PIN);
+}
+
+static void Bench_GpioRead(void)
+{
+    s_sink = GPIO_SRV_Read(HOST_BENCH_GPIO_PORT, HOST_BENCH_GPIO_PIN);
+}
+
+static void Bench_GpioFastToggle(void)
+{
+    PTD_FastToggle(HOST_BENCH_GPIO_PIN);
+}
+
+static void Bench_UartSendByte(void)
+{
+    s_sink = (uint32_t)UART_SRV_SendByte(HOST_BENCH_UART, 'x');
+}
+
+static void Bench_UartFastPut(void)
+{
+    LPUART1_FastPutByte('x');
+}
+
+static void Bench_CanSend(void)
+{
+    /* No bus with the models off: free the mailbox as transmission would */
+    CAN0->RAMn[HOST_BENCH_CAN_TX_MB * 4U] = CAN_CS_CODE_TX_INACTIVE << CAN_CS_CODE_SHIFT;
+    s_sink = (uint32_t)CAN_SRV_Send(&s_frame);
+}
+
+static void Bench_CanFastReceive(void)
+{
+    s_sink = (uint32_t)CAN0_FastReceive(HOST_BENCH_CAN_RX_MB, &s_rx_frame);
+}
+
+static void Bench_AdcConvert(void)
+{
+    s_sink = (uint32_t)ADC_SRV_Start(&s_adc);
+}
+
+static void Bench_LpitSetPeriod(void)
+{
+    s_sink = (uint32_t)LPIT_SRV_SetPeriod(&s_lpit, 1000U);
+}
+
+static const host_bench_entry_t s_entries[] = {
+    { "gpio_toggle",       Bench_GpioToggle,      50U  },
+    { "gpio_read",         Bench_GpioRead,        50U  },
+    { "gpio_fast_toggle",  Bench_GpioFastToggle,  20U  },
+    { "uart_send_byte",    Bench_UartSendByte,    50U  },
+    { "uart_fast_put",     Bench_UartFastPut,     20U  },
+    { "can_send",          Bench_CanSend,         100U },
+    { "can_fast_receive",  Bench_CanFastReceive,  100U },
+    { "adc_convert",       Bench_AdcConvert,      100U },
+    { "lpit_set_period",   Bench_LpitSetPeriod,   50U  },
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint64_t Bench_Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Fewest nanoseconds of one call over HOST_BENCH_REPEAT batches
+ */
+static uint32_t Bench_Measure(void (*run)(void))
+{
+    uint64_t start;
+    uint64_t ns;
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t i = 0; i < HOST_BENCH_REPEAT; i++) {
+        start = Bench_Now();
+        for (uint32_t n = 0; n < HOST_BENCH_BATCH; n++) {
+            run();
+        }
+        ns = (Bench_Now() - start) / HOST_BENCH_BATCH;
+        if (ns < best) {
+            best = ns;
+        }
+    }
+
+    return (uint32_t)best;
+}
+
+/**
+ * @brief Bring up every timed peripheral, models on
+ */
+static void Bench_Setup(void)
+{
+    can_srv_config_t can = {
+        .baudrate = 500000U,
+        .filter_id = 0x123U,
+        .filter_mask = 0x7FFU,
+        .mode = CAN_MODE_LOOPBACK,
+    };
+    bool ok = true;
+
+    ok = ok && (CLOCK_SRV_InitPreset(RUN_80MHz) == CLOCK_SRV_SUCCESS);
+    ok = ok && (CLOCK_SRV_EnablePeripheral(CLOCK_SRV_LPUART1, CLOCK_SRV_PCS_SOSCDIV2) == CLOCK_SRV_SUCCESS);
+    ok = ok && (UART_SRV_Init(HOST_BENCH_UART, 115200U) == UART_SRV_SUCCESS);
+    ok = ok && (GPIO_SRV_Init() == GPIO_SRV_SUCCESS);
+    ok = ok && (GPIO_SRV_ConfigOutput(HOST_BENCH_GPIO_PORT, HOST_BENCH_GPIO_PIN) == GPIO_SRV_SUCCESS);
+    ok = ok && (CAN_SRV_Init(&can) == CAN_SRV_SUCCESS);
+    ok = ok && (ADC_SRV_Init() == ADC_SRV_SUCCESS);
+    ok = ok && (LPIT_SRV_Init() == LPIT_SRV_SUCCESS);
+    ok = ok && (LPIT_SRV_Config(&s_lpit, NULL) == LPIT_SRV_SUCCESS);
+    if (!ok) {
+        fprintf(stderr, "bench: peripheral setup failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    s_frame.id = 0x123U;
+    s_frame.dlc = 8U;
+    for (uint8_t i = 0; i < 8U; i++) {
+        s_frame.data[i] = (uint8_t)(0x11U * i);
+    }
+
+    SIM_SetModels(false);
+
+    /* Conversion always complete, a frame always waiting */
+    SIM_Poke(&ADC0->SC1[0], SIM_Peek(&ADC0->SC1[0]) | ADC_SC1_COCO_MASK);
+    SIM_Poke(&CAN0->RAMn[HOST_BENCH_CAN_RX_MB * 4U], CAN_CS_CODE_RX_FULL << CAN_CS_CODE_SHIFT);
+    SIM_Poke(&CAN0->IFLAG1, 1UL << HOST_BENCH_CAN_RX_MB);
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(void)
+{
+    uint32_t overhead;
+    uint32_t ns;
+    uint32_t failed = 0;
+
+    SIM_Init();
+    Bench_Setup();
+
+    overhead = Bench_Measure(Bench_Empty);
+
+    printf("Hot path ns: name  ns  budget\n");
+
+    for (uint32_t i = 0; i < sizeof(s_entries) / sizeof(s_entries[0]); i++) {
+        ns = Bench_Measure(s_entries[i].run);
+        ns = (ns > overhead) ? (ns - overhead) : 0U;
+
+        if (ns > s_entries[i].budget) {
+            failed++;
+        }
+
+        printf("%s %u %u%s\n", s_entries[i].name, (unsigned)ns, (unsigned)s_entries[i].budget,
+               (ns > s_entries[i].budget) ? " OVER" : "");
+    }
+
+    return (int)failed;
+}
@@ -0,0 +1,1247 @@
+/**
+ * @file    sim.c
+ * @brief   Host Simulator - register maps and behavioural models
+ * @details The peripheral and private peripheral regions are backed by
+ *          memfd RAM mapped twice: once at the device address, where the
+ *          drivers access it, and once anywhere, where the models and
+ *          SIM_Peek()/SIM_Poke() access it without faulting.
+ *
+ * A page holding modelled registers is PROT_NONE. An access to it raises
+ * SIGSEGV; the handler runs the read hook, opens the page and sets the
+ * trap flag. After the instruction, SIGTRAP closes the page again and
+ * runs the write hook with the old and new value of the word, which is
+ * where W1C flags, set/clear/toggle registers and the CAN mailbox state
+ * machine are applied. The faulting byte address and the operand size of
+ * the store are kept for the models of 8-bit registers and byte lanes.
+ */
+
+#define _GNU_SOURCE
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "sim.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "The register simulator single-steps with the x86_64 trap flag on Linux"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SIM_PAGE_SIZE           (0x1000UL)
+#define SIM_PAGE_MASK           (~(SIM_PAGE_SIZE - 1UL))
+
+#define SIM_AIPS_BASE           (0x40000000UL)
+#define SIM_PPB_BASE            (0xE0000000UL)
+#define SIM_REGION_SIZE         (0x100000UL)
+
+#define SIM_EFLAGS_TF           (0x100UL)
+#define SIM_PF_WRITE            (0x2UL)
+
+/* LPUART */
+#define LPUART_STAT             (0x14U)
+#define LPUART_CTRL             (0x18U)
+#define LPUART_DATA             (0x1CU)
+#define LPUART_STAT_RESET       (0x00C00000U)   /* TDRE | TC */
+#define LPUART_STAT_RDRF        (0x00200000U)
+#define LPUART_STAT_W1C         (0xC01FC000U)
+#define LPUART_STAT_RO          (0x01E00000U)
+#define LPUART_STAT_RW          (0x3E000000U)
+#define LPUART_CTRL_TE          (0x00080000U)
+
+/* ADC */
+#define ADC_SLOTS               (16U)
+#define ADC_SC1(n)              ((uint32_t)(n) * 4U)
+#define ADC_CFG1                (0x40U)
+#define ADC_R(n)                (0x48U + ((uint32_t)(n) * 4U))
+#define ADC_SC2                 (0x90U)
+#define ADC_SC1_COCO            (0x80U)
+#define ADC_SC1_ADCH            (0x3FU)
+#define ADC_SC2_ADTRG           (0x40U)
+#define ADC_CFG1_MODE(x)        (((x) >> 2) & 0x3U)
+
+/* LPIT */
+#define LPIT_CHANNELS           (4U)
+#define LPIT_MSR                (0x0CU)
+#define LPIT_SETTEN             (0x14U)
+#define LPIT_CLRTEN             (0x18U)
+#define LPIT_TMR(n)             (0x20U + ((uint32_t)(n) * 0x10U))
+#define LPIT_TVAL               (0x0U)
+#define LPIT_CVAL               (0x4U)
+#define LPIT_TCTRL              (0x8U)
+#define LPIT_TCTRL_T_EN         (0x1U)
+#define LPIT_CH_MASK            (0xFU)
+
+/* GPIO, all five ports on one page */
+#define GPIO_PORTS              (5U)
+#define GPIO_STRIDE             (0x40U)
+#define GPIO_PDOR               (0x00U)
+#define GPIO_PSOR               (0x04U)
+#define GPIO_PCOR               (0x08U)
+#define GPIO_PTOR               (0x0CU)
+#define GPIO_PDIR               (0x10U)
+#define GPIO_PDDR               (0x14U)
+
+/* PORT */
+#define PORT_PINS               (32U)
+#define PORT_PCR(n)             ((uint32_t)(n) * 4U)
+#define PORT_ISFR               (0xA0U)
+#define PORT_PCR_IRQC(x)        (((x) >> 16) & 0xFU)
+#define PORT_PCR_ISF            (0x01000000U)
+
+/* SCG */
+#define SCG_CSR                 (0x010U)
+#define SCG_RCCR                (0x014U)
+#define SCG_SOSCCSR             (0x100U)
+#define SCG_SIRCCSR             (0x200U)
+#define SCG_FIRCCSR             (0x300U)
+#define SCG_SPLLCSR             (0x600U)
+#define SCG_XCSR_EN             (0x00000001U)
+#define SCG_XCSR_VLD            (0x01000000U)
+
+/* FlexCAN */
+#define CAN_MCR                 (0x00U)
+#define CAN_CTRL1               (0x04U)
+#define CAN_TIMER               (0x08U)
+#define CAN_RXMGMASK            (0x10U)
+#define CAN_IFLAG1              (0x30U)
+#define CAN_RAM                 (0x80U)
+#define CAN_RXIMR(n)            (0x880U + ((uint32_t)(n) * 4U))
+#define CAN_MB_COUNT            (32U)
+#define CAN_MB_SIZE             (16U)
+#define CAN_MB_CS(n)            (CAN_RAM + ((uint32_t)(n) * CAN_MB_SIZE))
+#define CAN_MB_ID(n)            (CAN_MB_CS(n) + 4U)
+#define CAN_MB_DATA0(n)         (CAN_MB_CS(n) + 8U)
+#define CAN_MB_DATA1(n)         (CAN_MB_CS(n) + 12U)
+
+#define CAN_MCR_RESET           (0xD890000FU)
+#define CAN_MCR_MDIS            (0x80000000U)
+#define CAN_MCR_FRZ             (0x40000000U)
+#define CAN_MCR_HALT            (0x10000000U)
+#define CAN_MCR_NOTRDY          (0x08000000U)
+#define CAN_MCR_SOFTRST         (0x02000000U)
+#define CAN_MCR_FRZACK          (0x01000000U)
+#define CAN_MCR_LPMACK          (0x00100000U)
+#define CAN_MCR_SRXDIS          (0x00020000U)
+#define CAN_MCR_IRMQ            (0x00010000U)
+#define CAN_MCR_MAXMB(x)        ((x) & 0x7FU)
+#define CAN_CTRL1_LPB           (0x00001000U)
+
+#define CAN_CS_CODE(x)          (((x) >> 24) & 0xFU)
+#define CAN_CS_IDE              (0x00200000U)
+#define CAN_CS_RTR              (0x00100000U)
+#define CAN_CS_DLC(x)           (((x) >> 16) & 0xFU)
+#define CAN_CS_FLAGS            (0x007F0000U)  /* SRR | IDE | RTR | DLC */
+#define CAN_ID_STD_SHIFT        (18U)
+#define CAN_ID_MASK             (0x1FFFFFFFU)
+
+#define CAN_CODE_RX_FULL        (0x2U)
+#define CAN_CODE_RX_EMPTY       (0x4U)
+#define CAN_CODE_RX_OVERRUN     (0x6U)
+#define CAN_CODE_TX_INACTIVE    (0x8U)
+#define CAN_CODE_TX_DATA        (0xCU)
+
+/* CRC */
+#define CRC_DATA                (0x0U)
+#define CRC_GPOLY               (0x4U)
+#define CRC_CTRL                (0x8U)
+#define CRC_CTRL_TOT(x)         (((x) >> 30) & 0x3U)
+#define CRC_CTRL_TOTR(x)        (((x) >> 28) & 0x3U)
+#define CRC_CTRL_FXOR           (0x04000000U)
+#define CRC_CTRL_WAS            (0x02000000U)
+#define CRC_CTRL_TCRC           (0x01000000U)
+
+/* eDMA: 8-bit command registers, TCDs on the next page (plain RAM) */
+#define DMA_CHANNELS            (16U)
+#define DMA_ERQ                 (0x0CU)
+#define DMA_CERQ                (0x1AU)
+#define DMA_SERQ                (0x1BU)
+#define DMA_CDNE                (0x1CU)
+#define DMA_CERR                (0x1EU)
+#define DMA_CINT                (0x1FU)
+#define DMA_INT                 (0x24U)
+#define DMA_ERR                 (0x2CU)
+#define DMA_CMD_ALL             (0x40U)
+#define DMA_CMD_CH(x)           ((x) & 0x0FU)
+#define DMA_TCD_BASE            (0x40009000UL)
+#define DMA_TCD_SIZE            (0x20U)
+#define DMA_TCD_SADDR           (0x00U)
+#define DMA_TCD_SOFF            (0x04U)
+#define DMA_TCD_ATTR            (0x06U)
+#define DMA_TCD_NBYTES          (0x08U)
+#define DMA_TCD_SLAST           (0x0CU)
+#define DMA_TCD_DADDR           (0x10U)
+#define DMA_TCD_DOFF            (0x14U)
+#define DMA_TCD_CITER           (0x16U)
+#define DMA_TCD_DLASTSGA        (0x18U)
+#define DMA_TCD_CSR             (0x1CU)
+#define DMA_TCD_BITER           (0x1EU)
+#define DMA_TCD_CSR_DREQ        (0x0008U)
+#define DMA_TCD_CSR_DONE        (0x0080U)
+#define DMA_ATTR_SIZE(x)        (1U << ((x) & 0x7U))
+#define DMAMUX_BASE             (0x40021000UL)
+#define DMAMUX_CHCFG(n)         (((n) & ~3U) + 3U - ((n) & 3U))
+#define DMAMUX_CHCFG_ENBL       (0x80U)
+#define DMAMUX_CHCFG_SOURCE(x)  ((x) & 0x3FU)
+#define DMAMUX_ALWAYS_ON_FIRST  (62U)
+
+/**
+ * @brief One page of modelled registers
+ */
+typedef struct {
+    uintptr_t base;                 /**< Device address, page aligned */
+    uint8_t instance;
+    void (*reset)(uint8_t instance, uint32_t *regs);
+    void (*read)(uint8_t instance, uint32_t *regs, uint32_t offset);
+    void (*write)(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value);
+} sim_block_t;
+
+/**
+ * @brief Byte or frame FIFO
+ */
+typedef struct {
+    uint32_t head;
+    uint32_t count;
+} sim_queue_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint8_t *s_aips;             /* Alias of 0x40000000 */
+static uint8_t *s_ppb;              /* Alias of 0xE0000000 */
+static bool s_models = true;
+
+/* Access between the fault and the single step */
+static const sim_block_t *s_pending;
+static uint32_t s_pending_offset;
+static uint32_t s_pending_old;
+static bool s_pending_write;
+static uint32_t s_pending_lane;     /* Byte address & 3 */
+static uint32_t s_pending_size;     /* Store operand size in bytes */
+
+static sim_queue_t s_uart_rx_q[3];
+static sim_queue_t s_uart_tx_q[3];
+static uint8_t s_uart_rx[3][SIM_QUEUE_DEPTH];
+static uint8_t s_uart_tx[3][SIM_QUEUE_DEPTH];
+
+static sim_queue_t s_can_tx_q[3];
+static sim_can_frame_t s_can_tx[3][SIM_QUEUE_DEPTH];
+
+static uint16_t s_adc_input[2][SIM_ADC_INPUTS];
+static uint32_t s_gpio_input[GPIO_PORTS];
+
+static uint32_t s_crc_state;        /* Engine register, before TOTR/FXOR */
+
+/*******************************************************************************
+ * Queues
+ ******************************************************************************/
+
+/**
+ * @brief Reserve the tail slot
+ * @return Slot index, or SIM_QUEUE_DEPTH when full
+ */
+static uint32_t Sim_QueuePush(sim_queue_t *q)
+{
+    uint32_t slot;
+
+    if (q->count == SIM_QUEUE_DEPTH) {
+        return SIM_QUEUE_DEPTH;
+    }
+
+    slot = (q->head + q->count) % SIM_QUEUE_DEPTH;
+    q->count++;
+    return slot;
+}
+
+/**
+ * @brief Release the head slot
+ * @return Slot index, or SIM_QUEUE_DEPTH when empty
+ */
+static uint32_t Sim_QueuePop(sim_queue_t *q)
+{
+    uint32_t slot;
+
+    if (q->count == 0U) {
+        return SIM_QUEUE_DEPTH;
+    }
+
+    slot = q->head;
+    q->head = (q->head + 1U) % SIM_QUEUE_DEPTH;
+    q->count--;
+    return slot;
+}
+
+/*******************************************************************************
+ * Register space
+ ******************************************************************************/
+
+static uint32_t *Sim_Alias(uintptr_t addr)
+{
+    if (addr - SIM_AIPS_BASE < SIM_REGION_SIZE) {
+        return (uint32_t *)(void *)(s_aips + (addr - SIM_AIPS_BASE));
+    }
+    if (addr - SIM_PPB_BASE < SIM_REGION_SIZE) {
+        return (uint32_t *)(void *)(s_ppb + (addr - SIM_PPB_BASE));
+    }
+
+    fprintf(stderr, "sim: 0x%08lx is outside the simulated register space\n", (unsigned long)addr);
+    abort();
+}
+
+#define REG(regs, offset)       ((regs)[(offset) / 4U])
+
+/*******************************************************************************
+ * LPUART: TDRE always set, DATA writes go to the TX log, RDRF while the
+ * RX queue has bytes, W1C status flags
+ ******************************************************************************/
+
+static void Sim_UartReset(uint8_t instance, uint32_t *regs)
+{
+    (void)instance;
+    REG(regs, LPUART_STAT) = LPUART_STAT_RESET;
+}
+
+static void Sim_UartRead(uint8_t instance, uint32_t *regs, uint32_t offset)
+{
+    uint32_t slot;
+
+    if (offset != LPUART_DATA) {
+        return;
+    }
+
+    slot = Sim_QueuePop(&s_uart_rx_q[instance]);
+    if (slot != SIM_QUEUE_DEPTH) {
+        REG(regs, LPUART_DATA) = s_uart_rx[instance][slot];
+    }
+
+    if (s_uart_rx_q[instance].count == 0U) {
+        REG(regs, LPUART_STAT) &= ~LPUART_STAT_RDRF;
+    }
+}
+
+static void Sim_UartWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    uint32_t slot;
+
+    if (offset == LPUART_STAT) {
+        REG(regs, LPUART_STAT) = (old & (LPUART_STAT_W1C | LPUART_STAT_RO) & ~(value & LPUART_STAT_W1C)) |
+                                 (value & LPUART_STAT_RW);
+    } else if (offset == LPUART_DATA) {
+        if ((REG(regs, LPUART_CTRL) & LPUART_CTRL_TE) != 0U) {
+            slot = Sim_QueuePush(&s_uart_tx_q[instance]);
+            if (slot != SIM_QUEUE_DEPTH) {
+                s_uart_tx[instance][slot] = (uint8_t)value;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * ADC: a software-triggered write of SC1[0] converts at once; reading R[n]
+ * clears COCO of SC1[n]; hardware triggers via SIM_AdcHwTrigger()
+ ******************************************************************************/
+
+static void Sim_AdcReset(uint8_t instance, uint32_t *regs)
+{
+    (void)instance;
+    for (uint32_t n = 0; n < ADC_SLOTS; n++) {
+        REG(regs, ADC_SC1(n)) = ADC_SC1_ADCH;
+    }
+}
+
+static void Sim_AdcConvert(uint8_t instance, uint32_t *regs, uint32_t slot)
+{
+    uint32_t channel = REG(regs, ADC_SC1(slot)) & ADC_SC1_ADCH;
+    uint32_t value = (channel < SIM_ADC_INPUTS) ? s_adc_input[instance][channel] : 0U;
+
+    switch (ADC_CFG1_MODE(REG(regs, ADC_CFG1))) {
+    case 0U:
+        value >>= 4;        /* 8-bit */
+        break;
+    case 2U:
+        value >>= 2;        /* 10-bit */
+        break;
+    default:
+        break;              /* 12-bit */
+    }
+
+    REG(regs, ADC_R(slot)) = value;
+    REG(regs, ADC_SC1(slot)) |= ADC_SC1_COCO;
+}
+
+static void Sim_AdcRead(uint8_t instance, uint32_t *regs, uint32_t offset)
+{
+    (void)instance;
+    if (offset >= ADC_R(0) && offset < ADC_R(ADC_SLOTS)) {
+        REG(regs, ADC_SC1((offset - ADC_R(0)) / 4U)) &= ~ADC_SC1_COCO;
+    }
+}
+
+static void Sim_AdcWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)old;
+    if (offset >= ADC_SC1(ADC_SLOTS)) {
+        return;
+    }
+
+    REG(regs, offset) = value & ~ADC_SC1_COCO;
+
+    if (offset == ADC_SC1(0) && (REG(regs, ADC_SC2) & ADC_SC2_ADTRG) == 0U &&
+        (value & ADC_SC1_ADCH) != ADC_SC1_ADCH) {
+        Sim_AdcConvert(instance, regs, 0U);
+    }
+}
+
+/*******************************************************************************
+ * LPIT: W1C MSR, SETTEN/CLRTEN set and clear the enable bits mirrored in
+ * TCTRL.T_EN, SIM_LpitExpire() raises TIF
+ ******************************************************************************/
+
+static void Sim_LpitSetEnables(uint32_t *regs, uint32_t enables)
+{
+    REG(regs, LPIT_SETTEN) = enables;
+    for (uint32_t n = 0; n < LPIT_CHANNELS; n++) {
+        if ((enables & (1UL << n)) != 0U) {
+            REG(regs, LPIT_TMR(n) + LPIT_TCTRL) |= LPIT_TCTRL_T_EN;
+        } else {
+            REG(regs, LPIT_TMR(n) + LPIT_TCTRL) &= ~LPIT_TCTRL_T_EN;
+        }
+    }
+}
+
+static void Sim_LpitWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)instance;
+    if (offset == LPIT_MSR) {
+        REG(regs, LPIT_MSR) = old & ~(value & LPIT_CH_MASK);
+    } else if (offset == LPIT_SETTEN) {
+        Sim_LpitSetEnables(regs, old | (value & LPIT_CH_MASK));
+    } else if (offset == LPIT_CLRTEN) {
+        REG(regs, LPIT_CLRTEN) = 0U;
+        Sim_LpitSetEnables(regs, REG(regs, LPIT_SETTEN) & ~(value & LPIT_CH_MASK));
+    } else if (offset >= LPIT_TMR(0) && offset < LPIT_TMR(LPIT_CHANNELS) &&
+               ((offset - LPIT_TMR(0)) % 0x10U) == LPIT_TCTRL) {
+        uint32_t bit = 1UL << ((offset - LPIT_TMR(0)) / 0x10U);
+
+        if ((value & LPIT_TCTRL_T_EN) != 0U) {
+            REG(regs, LPIT_SETTEN) |= bit;
+        } else {
+            REG(regs, LPIT_SETTEN) &= ~bit;
+        }
+    }
+}
+
+/*******************************************************************************
+ * GPIO: PSOR/PCOR/PTOR act on PDOR and read as 0; PDIR shows the driven
+ * level of outputs and SIM_GpioSetInput() for inputs
+ ******************************************************************************/
+
+static void Sim_GpioRead(uint8_t instance, uint32_t *regs, uint32_t offset)
+{
+    uint32_t port = offset / GPIO_STRIDE;
+    uint32_t *gpio = &regs[(port * GPIO_STRIDE) / 4U];
+
+    (void)instance;
+    if (port < GPIO_PORTS && (offset % GPIO_STRIDE) == GPIO_PDIR) {
+        REG(gpio, GPIO_PDIR) = (s_gpio_input[port] & ~REG(gpio, GPIO_PDDR)) |
+                               (REG(gpio, GPIO_PDOR) & REG(gpio, GPIO_PDDR));
+    }
+}
+
+static void Sim_GpioWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    uint32_t port = offset / GPIO_STRIDE;
+    uint32_t *gpio = &regs[(port * GPIO_STRIDE) / 4U];
+
+    (void)instance;
+    (void)old;
+    if (port >= GPIO_PORTS) {
+        return;
+    }
+
+    switch (offset % GPIO_STRIDE) {
+    case GPIO_PSOR:
+        REG(gpio, GPIO_PDOR) |= value;
+        break;
+    case GPIO_PCOR:
+        REG(gpio, GPIO_PDOR) &= ~value;
+        break;
+    case GPIO_PTOR:
+        REG(gpio, GPIO_PDOR) ^= value;
+        break;
+    case GPIO_PDIR:
+        REG(gpio, GPIO_PDIR) = old;     /* Read-only */
+        return;
+    default:
+        return;
+    }
+
+    REG(gpio, offset % GPIO_STRIDE) = 0U;
+}
+
+/*******************************************************************************
+ * PORT: PCR.ISF and ISFR are the same W1C flags
+ ******************************************************************************/
+
+static void Sim_PortWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)instance;
+    if (offset < PORT_PCR(PORT_PINS)) {
+        uint32_t pin = offset / 4U;
+        uint32_t isf = old & PORT_PCR_ISF & ~value;
+
+        REG(regs, offset) = (value & ~PORT_PCR_ISF) | isf;
+        if (isf == 0U) {
+            REG(regs, PORT_ISFR) &= ~(1UL << pin);
+        }
+    } else if (offset == PORT_ISFR) {
+        REG(regs, PORT_ISFR) = old & ~value;
+        for (uint32_t pin = 0; pin < PORT_PINS; pin++) {
+            if ((old & value & (1UL << pin)) != 0U) {
+                REG(regs, PORT_PCR(pin)) &= ~PORT_PCR_ISF;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * SCG: every oscillator is valid as soon as it is enabled, the requested
+ * system clock is reported at once
+ ******************************************************************************/
+
+static void Sim_ScgReset(uint8_t instance, uint32_t *regs)
+{
+    (void)instance;
+    REG(regs, SCG_CSR) = 0x03000001U;
+    REG(regs, SCG_RCCR) = 0x03000001U;
+    REG(regs, SCG_SIRCCSR) = 0x01000005U;
+    REG(regs, SCG_FIRCCSR) = 0x03000001U;
+}
+
+static void Sim_ScgWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)instance;
+    (void)old;
+    switch (offset) {
+    case SCG_SOSCCSR:
+    case SCG_SIRCCSR:
+    case SCG_FIRCCSR:
+    case SCG_SPLLCSR:
+        REG(regs, offset) = (value & ~SCG_XCSR_VLD) |
+                            (((value & SCG_XCSR_EN) != 0U) ? SCG_XCSR_VLD : 0U);
+        break;
+    case SCG_RCCR:
+        REG(regs, SCG_CSR) = value;
+        break;
+    default:
+        break;
+    }
+}
+
+/*******************************************************************************
+ * FlexCAN: MCR handshakes, W1C IFLAG1, free-running TIMER, and the mailbox
+ * codes: TX_DATA transmits at once, EMPTY mailboxes take matching frames
+ ******************************************************************************/
+
+static void Sim_CanReset(uint8_t instance, uint32_t *regs)
+{
+    (void)instance;
+    REG(regs, CAN_MCR) = CAN_MCR_RESET;
+}
+
+static void Sim_CanRead(uint8_t instance, uint32_t *regs, uint32_t offset)
+{
+    (void)instance;
+    if (offset == CAN_TIMER) {
+        REG(regs, CAN_TIMER) = (REG(regs, CAN_TIMER) + 1U) & 0xFFFFU;
+    }
+}
+
+static uint32_t Sim_CanIdWord(const sim_can_frame_t *frame)
+{
+    return frame->ext ? (frame->id & CAN_ID_MASK) : ((frame->id & 0x7FFU) << CAN_ID_STD_SHIFT);
+}
+
+/**
+ * @brief Deliver a frame to the first free receive mailbox it matches
+ */
+static bool Sim_CanDeliver(uint32_t *regs, const sim_can_frame_t *frame)
+{
+    uint32_t mcr = REG(regs, CAN_MCR);
+    uint32_t last = CAN_MCR_MAXMB(mcr);
+    uint32_t idw = Sim_CanIdWord(frame);
+    uint32_t ide = frame->ext ? CAN_CS_IDE : 0U;
+    uint32_t overrun = CAN_MB_COUNT;
+    uint32_t target = CAN_MB_COUNT;
+
+    if ((mcr & CAN_MCR_NOTRDY) != 0U) {
+        return false;
+    }
+
+    if (last >= CAN_MB_COUNT) {
+        last = CAN_MB_COUNT - 1U;
+    }
+
+    for (uint32_t mb = 0; mb <= last; mb++) {
+        uint32_t cs = REG(regs, CAN_MB_CS(mb));
+        uint32_t code = CAN_CS_CODE(cs);
+        uint32_t mask = ((mcr & CAN_MCR_IRMQ) != 0U) ? REG(regs, CAN_RXIMR(mb)) : REG(regs, CAN_RXMGMASK);
+
+        if ((code != CAN_CODE_RX_EMPTY && code != CAN_CODE_RX_FULL) || (cs & CAN_CS_IDE) != ide ||
+            ((idw ^ REG(regs, CAN_MB_ID(mb))) & mask & CAN_ID_MASK) != 0U) {
+            continue;
+        }
+
+        if (code == CAN_CODE_RX_EMPTY) {
+            target = mb;
+            break;
+        }
+        if (overrun == CAN_MB_COUNT) {
+            overrun = mb;
+        }
+    }
+
+    if (target == CAN_MB_COUNT) {
+        if (overrun == CAN_MB_COUNT) {
+            return false;
+        }
+        target = overrun;
+    }
+
+    REG(regs, CAN_MB_ID(target)) = idw;
+    REG(regs, CAN_MB_DATA0(target)) = ((uint32_t)frame->data[0] << 24) | ((uint32_t)frame->data[1] << 16) |
+                                      ((uint32_t)frame->data[2] << 8) | frame->data[3];
+    REG(regs, CAN_MB_DATA1(target)) = ((uint32_t)frame->data[4] << 24) | ((uint32_t)frame->data[5] << 16) |
+                                      ((uint32_t)frame->data[6] << 8) | frame->data[7];
+    REG(regs, CAN_MB_CS(target)) = ((target == overrun ? CAN_CODE_RX_OVERRUN : CAN_CODE_RX_FULL) << 24) |
+                                   ide | (frame->rtr ? CAN_CS_RTR : 0U) |
+                                   ((uint32_t)(frame->dlc & 0xFU) << 16) | (REG(regs, CAN_TIMER) & 0xFFFFU);
+    REG(regs, CAN_IFLAG1) |= 1UL << target;
+    return true;
+}
+
+static void Sim_CanTransmit(uint8_t instance, uint32_t *regs, uint32_t mb, uint32_t cs)
+{
+    sim_can_frame_t frame;
+    uint32_t idw = REG(regs, CAN_MB_ID(mb));
+    uint32_t data0 = REG(regs, CAN_MB_DATA0(mb));
+    uint32_t data1 = REG(regs, CAN_MB_DATA1(mb));
+    uint32_t slot;
+
+    frame.ext = (cs & CAN_CS_IDE) != 0U;
+    frame.rtr = (cs & CAN_CS_RTR) != 0U;
+    frame.id = frame.ext ? (idw & CAN_ID_MASK) : ((idw >> CAN_ID_STD_SHIFT) & 0x7FFU);
+    frame.dlc = (uint8_t)CAN_CS_DLC(cs);
+    for (uint32_t i = 0; i < 4U; i++) {
+        frame.data[i] = (uint8_t)(data0 >> (24U - (8U * i)));
+        frame.data[4U + i] = (uint8_t)(data1 >> (24U - (8U * i)));
+    }
+
+    slot = Sim_QueuePush(&s_can_tx_q[instance]);
+    if (slot != SIM_QUEUE_DEPTH) {
+        s_can_tx[instance][slot] = frame;
+    }
+
+    REG(regs, CAN_MB_CS(mb)) = (CAN_CODE_TX_INACTIVE << 24) | (cs & CAN_CS_FLAGS) |
+                               (REG(regs, CAN_TIMER) & 0xFFFFU);
+    REG(regs, CAN_IFLAG1) |= 1UL << mb;
+
+    /* Loopback, or self-reception on the bus */
+    if ((REG(regs, CAN_CTRL1) & CAN_CTRL1_LPB) != 0U || (REG(regs, CAN_MCR) & CAN_MCR_SRXDIS) == 0U) {
+        (void)Sim_CanDeliver(regs, &frame);
+    }
+}
+
+static void Sim_CanWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    if (offset == CAN_MCR) {
+        uint32_t mcr = value & ~(CAN_MCR_SOFTRST | CAN_MCR_FRZACK | CAN_MCR_NOTRDY | CAN_MCR_LPMACK);
+
+        if ((mcr & (CAN_MCR_FRZ | CAN_MCR_HALT | CAN_MCR_MDIS)) == (CAN_MCR_FRZ | CAN_MCR_HALT)) {
+            mcr |= CAN_MCR_FRZACK;
+        }
+        if ((mcr & (CAN_MCR_MDIS | CAN_MCR_FRZACK)) != 0U) {
+            mcr |= CAN_MCR_NOTRDY;
+        }
+        if ((mcr & CAN_MCR_MDIS) != 0U) {
+            mcr |= CAN_MCR_LPMACK;
+        }
+        REG(regs, CAN_MCR) = mcr;
+    } else if (offset == CAN_IFLAG1) {
+        REG(regs, CAN_IFLAG1) = old & ~value;
+    } else if (offset >= CAN_RAM && offset < CAN_MB_CS(CAN_MB_COUNT) && ((offset - CAN_RAM) % CAN_MB_SIZE) == 0U) {
+        uint32_t mb = (offset - CAN_RAM) / CAN_MB_SIZE;
+
+        if (CAN_CS_CODE(value) == CAN_CODE_TX_DATA && (REG(regs, CAN_MCR) & CAN_MCR_NOTRDY) == 0U &&
+            mb <= CAN_MCR_MAXMB(REG(regs, CAN_MCR))) {
+            Sim_CanTransmit(instance, regs, mb, value);
+        }
+    }
+}
+
+/*******************************************************************************
+ * CRC: the engine runs on every DATA write of the width and byte lane
+ * written, after the TOT transposition; DATA then reads back the engine
+ * register through TOTR and FXOR. A write with CTRL.WAS set loads the seed.
+ ******************************************************************************/
+
+static uint32_t Sim_Reverse(uint32_t value)
+{
+    uint32_t out = 0U;
+
+    for (uint32_t i = 0; i < 32U; i++) {
+        out = (out << 1) | ((value >> i) & 1U);
+    }
+    return out;
+}
+
+static uint32_t Sim_ByteSwap(uint32_t value)
+{
+    return (value >> 24) | ((value >> 8) & 0xFF00U) | ((value << 8) & 0xFF0000U) | (value << 24);
+}
+
+/**
+ * @brief TOT/TOTR: none, bits in bytes, bits and bytes, bytes
+ */
+static uint32_t Sim_CrcTranspose(uint32_t value, uint32_t type)
+{
+    switch (type) {
+    case 1U:
+        return Sim_ByteSwap(Sim_Reverse(value));
+    case 2U:
+        return Sim_Reverse(value);
+    case 3U:
+        return Sim_ByteSwap(value);
+    default:
+        return value;
+    }
+}
+
+static void Sim_CrcShowResult(uint32_t *regs)
+{
+    uint32_t ctrl = REG(regs, CRC_CTRL);
+    uint32_t result = s_crc_state;
+
+    if ((ctrl & CRC_CTRL_FXOR) != 0U) {
+        result ^= ((ctrl & CRC_CTRL_TCRC) != 0U) ? 0xFFFFFFFFU : 0xFFFFU;
+    }
+    REG(regs, CRC_DATA) = Sim_CrcTranspose(result, CRC_CTRL_TOTR(ctrl));
+}
+
+/**
+ * @brief Shift data through the engine, most significant bit first
+ */
+static void Sim_CrcFeed(uint32_t *regs, uint32_t data, uint32_t bits)
+{
+    bool wide = (REG(regs, CRC_CTRL) & CRC_CTRL_TCRC) != 0U;
+    uint32_t poly = wide ? REG(regs, CRC_GPOLY) : (REG(regs, CRC_GPOLY) & 0xFFFFU);
+    uint32_t top = wide ? 31U : 15U;
+
+    for (uint32_t i = bits; i-- > 0U;) {
+        uint32_t feedback = ((s_crc_state >> top) ^ (data >> i)) & 1U;
+
+        s_crc_state <<= 1;
+        if (feedback != 0U) {
+            s_crc_state ^= poly;
+        }
+    }
+
+    if (!wide) {
+        s_crc_state &= 0xFFFFU;
+    }
+}
+
+static void Sim_CrcWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    uint32_t ctrl = REG(regs, CRC_CTRL);
+
+    (void)instance;
+    (void)old;
+    if (offset == CRC_DATA) {
+        uint32_t bits = 8U * s_pending_size;
+        uint32_t lanes = (bits >= 32U) ? 0xFFFFFFFFU : (((1UL << bits) - 1U) << (8U * s_pending_lane));
+        uint32_t data = Sim_CrcTranspose(value & lanes, CRC_CTRL_TOT(ctrl)) & lanes;
+
+        if ((ctrl & CRC_CTRL_WAS) != 0U) {
+            s_crc_state = ((ctrl & CRC_CTRL_TCRC) != 0U) ? data : (data & 0xFFFFU);
+        } else {
+            Sim_CrcFeed(regs, data >> (8U * s_pending_lane), (bits >= 32U) ? 32U : bits);
+        }
+    } else if (offset != CRC_GPOLY && offset != CRC_CTRL) {
+        return;
+    }
+
+    Sim_CrcShowResult(regs);
+}
+
+/*******************************************************************************
+ * Block table
+ ******************************************************************************/
+
+static void Sim_DmaWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value);
+
+static const sim_block_t s_blocks[] = {
+    { 0x40024000UL, 0U, Sim_CanReset,  Sim_CanRead,  Sim_CanWrite  },   /* CAN0 */
+    { 0x40025000UL, 1U, Sim_CanReset,  Sim_CanRead,  Sim_CanWrite  },   /* CAN1 */
+    { 0x4002B000UL, 2U, Sim_CanReset,  Sim_CanRead,  Sim_CanWrite  },   /* CAN2 */
+    { 0x4006A000UL, 0U, Sim_UartReset, Sim_UartRead, Sim_UartWrite },   /* LPUART0 */
+    { 0x4006B000UL, 1U, Sim_UartReset, Sim_UartRead, Sim_UartWrite },   /* LPUART1 */
+    { 0x4006C000UL, 2U, Sim_UartReset, Sim_UartRead, Sim_UartWrite },   /* LPUART2 */
+    { 0x4003B000UL, 0U, Sim_AdcReset,  Sim_AdcRead,  Sim_AdcWrite  },   /* ADC0 */
+    { 0x40027000UL, 1U, Sim_AdcReset,  Sim_AdcRead,  Sim_AdcWrite  },   /* ADC1 */
+    { 0x40037000UL, 0U, NULL,          NULL,         Sim_LpitWrite },   /* LPIT0 */
+    { 0x40049000UL, 0U, NULL,          NULL,         Sim_PortWrite },   /* PORTA */
+    { 0x4004A000UL, 1U, NULL,          NULL,         Sim_PortWrite },   /* PORTB */
+    { 0x4004B000UL, 2U, NULL,          NULL,         Sim_PortWrite },   /* PORTC */
+    { 0x4004C000UL, 3U, NULL,          NULL,         Sim_PortWrite },   /* PORTD */
+    { 0x4004D000UL, 4U, NULL,          NULL,         Sim_PortWrite },   /* PORTE */
+    { 0x400FF000UL, 0U, NULL,          Sim_GpioRead, Sim_GpioWrite },   /* PTA-PTE */
+    { 0x40064000UL, 0U, Sim_ScgReset,  NULL,         Sim_ScgWrite  },   /* SCG */
+    { 0x40032000UL, 0U, NULL,          NULL,         Sim_CrcWrite  },   /* CRC */
+    { 0x40008000UL, 0U, NULL,          NULL,         Sim_DmaWrite  },   /* DMA */
+};
+
+#define SIM_BLOCK_COUNT         (sizeof(s_blocks) / sizeof(s_blocks[0]))
+
+#define SIM_BLOCK_CAN(n)        (&s_blocks[0U + (n)])
+#define SIM_BLOCK_ADC(n)        (&s_blocks[6U + (n)])
+#define SIM_BLOCK_LPIT          (&s_blocks[8U])
+#define SIM_BLOCK_PORT(n)       (&s_blocks[9U + (n)])
+
+static uint32_t *Sim_BlockRegs(const sim_block_t *block)
+{
+    return Sim_Alias(block->base);
+}
+
+static const sim_block_t *Sim_FindBlock(uintptr_t addr)
+{
+    for (uint32_t i = 0; i < SIM_BLOCK_COUNT; i++) {
+        if (s_blocks[i].base == (addr & SIM_PAGE_MASK)) {
+            return &s_blocks[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bus access of a DMA master: simulated registers through the
+ *        alias, anything else is host memory at the 32-bit address
+ */
+static uint8_t *Sim_BusAddress(uint32_t addr)
+{
+    if ((uintptr_t)addr - SIM_AIPS_BASE < SIM_REGION_SIZE || (uintptr_t)addr - SIM_PPB_BASE < SIM_REGION_SIZE) {
+        return (uint8_t *)(void *)Sim_Alias(addr & ~3U) + (addr & 3U);
+    }
+    return (uint8_t *)(uintptr_t)addr;
+}
+
+static void Sim_BusWrite(uint32_t addr, uint32_t value, uint32_t size)
+{
+    const sim_block_t *block = s_models ? Sim_FindBlock(addr) : NULL;
+    uint32_t offset = (addr & ~SIM_PAGE_MASK) & ~3U;
+    uint32_t old = 0U;
+
+    if (block != NULL) {
+        old = REG(Sim_BlockRegs(block), offset);
+    }
+
+    memcpy(Sim_BusAddress(addr), &value, size);
+
+    if (block != NULL && block->write != NULL) {
+        s_pending_lane = addr & 3U;
+        s_pending_size = size;
+        block->write(block->instance, Sim_BlockRegs(block), offset, old, REG(Sim_BlockRegs(block), offset));
+    }
+}
+
+/*******************************************************************************
+ * eDMA: CERQ/SERQ/CDNE/CERR/CINT commands; a channel enabled with an
+ * always-on DMAMUX source runs its whole major loop when SERQ is written
+ ******************************************************************************/
+
+static uint8_t *Sim_DmaTcd(uint32_t channel)
+{
+    return (uint8_t *)(void *)Sim_Alias(DMA_TCD_BASE + (channel * DMA_TCD_SIZE));
+}
+
+static void Sim_DmaRun(uint32_t *regs, uint32_t channel)
+{
+    uint8_t *tcd = Sim_DmaTcd(channel);
+    uint8_t chcfg = ((const uint8_t *)(void *)Sim_Alias(DMAMUX_BASE))[DMAMUX_CHCFG(channel)];
+    uint32_t saddr, daddr, nbytes, slast, dlast;
+    int16_t soff, doff;
+    uint16_t attr, citer, biter, csr;
+    uint32_t ssize, dsize;
+
+    if ((chcfg & DMAMUX_CHCFG_ENBL) == 0U || DMAMUX_CHCFG_SOURCE(chcfg) < DMAMUX_ALWAYS_ON_FIRST) {
+        return;
+    }
+
+    memcpy(&saddr, tcd + DMA_TCD_SADDR, 4U);
+    memcpy(&soff, tcd + DMA_TCD_SOFF, 2U);
+    memcpy(&attr, tcd + DMA_TCD_ATTR, 2U);
+    memcpy(&nbytes, tcd + DMA_TCD_NBYTES, 4U);
+    memcpy(&slast, tcd + DMA_TCD_SLAST, 4U);
+    memcpy(&daddr, tcd + DMA_TCD_DADDR, 4U);
+    memcpy(&doff, tcd + DMA_TCD_DOFF, 2U);
+    memcpy(&citer, tcd + DMA_TCD_CITER, 2U);
+    memcpy(&dlast, tcd + DMA_TCD_DLASTSGA, 4U);
+    memcpy(&csr, tcd + DMA_TCD_CSR, 2U);
+    memcpy(&biter, tcd + DMA_TCD_BITER, 2U);
+
+    ssize = DMA_ATTR_SIZE(attr >> 8);
+    dsize = DMA_ATTR_SIZE(attr);
+    if (ssize != dsize || ssize > 4U || citer == 0U) {
+        REG(regs, DMA_ERR) |= 1UL << channel;
+        return;
+    }
+
+    for (; citer > 0U; citer--) {
+        for (uint32_t n = 0; n < nbytes; n += ssize) {
+            uint32_t value = 0U;
+
+            memcpy(&value, Sim_BusAddress(saddr), ssize);
+            Sim_BusWrite(daddr, value, dsize);
+            saddr += (uint32_t)(int32_t)soff;
+            daddr += (uint32_t)(int32_t)doff;
+        }
+    }
+
+    saddr += slast;
+    daddr += dlast;
+    csr |= DMA_TCD_CSR_DONE;
+    memcpy(tcd + DMA_TCD_SADDR, &saddr, 4U);
+    memcpy(tcd + DMA_TCD_DADDR, &daddr, 4U);
+    memcpy(tcd + DMA_TCD_CITER, &biter, 2U);
+    memcpy(tcd + DMA_TCD_CSR, &csr, 2U);
+
+    if ((csr & DMA_TCD_CSR_DREQ) != 0U) {
+        REG(regs, DMA_ERQ) &= ~(1UL << channel);
+    }
+}
+
+static void Sim_DmaWrite(uint8_t instance, uint32_t *regs, uint32_t offset, uint32_t old, uint32_t value)
+{
+    uint32_t reg = offset + s_pending_lane;
+    uint32_t cmd = (value >> (8U * s_pending_lane)) & 0xFFU;
+    uint32_t mask = ((cmd & DMA_CMD_ALL) != 0U) ? ((1UL << DMA_CHANNELS) - 1U) : (1UL << DMA_CMD_CH(cmd));
+
+    (void)instance;
+    (void)old;
+    if (s_pending_size != 1U) {
+        return;
+    }
+
+    switch (reg) {
+    case DMA_CERQ:
+        REG(regs, DMA_ERQ) &= ~mask;
+        break;
+    case DMA_SERQ:
+        REG(regs, DMA_ERQ) |= mask;
+        for (uint32_t ch = 0; ch < DMA_CHANNELS; ch++) {
+            if ((mask & (1UL << ch)) != 0U) {
+                Sim_DmaRun(regs, ch);
+            }
+        }
+        break;
+    case DMA_CDNE:
+        for (uint32_t ch = 0; ch < DMA_CHANNELS; ch++) {
+            if ((mask & (1UL << ch)) != 0U) {
+                uint16_t csr;
+
+                memcpy(&csr, Sim_DmaTcd(ch) + DMA_TCD_CSR, 2U);
+                csr &= (uint16_t)~DMA_TCD_CSR_DONE;
+                memcpy(Sim_DmaTcd(ch) + DMA_TCD_CSR, &csr, 2U);
+            }
+        }
+        break;
+    case DMA_CERR:
+        REG(regs, DMA_ERR) &= ~mask;
+        break;
+    case DMA_CINT:
+        REG(regs, DMA_INT) &= ~mask;
+        break;
+    default:
+        break;
+    }
+}
+
+/*******************************************************************************
+ * Fault handling
+ ******************************************************************************/
+
+/**
+ * @brief Operand size of the faulting instruction
+ * @details Enough of the x86_64 encoding for the stores the drivers compile
+ *          to: 0x88/0xC6/0x80 are byte stores, 0x89/0xC7 word stores with
+ *          an optional 0x66 (16-bit) or REX.W (64-bit) prefix.
+ */
+static uint32_t Sim_StoreSize(const uint8_t *ip)
+{
+    uint32_t size = 4U;
+
+    for (; *ip == 0x66U || (*ip & 0xF0U) == 0x40U; ip++) {
+        if (*ip == 0x66U) {
+            size = 2U;
+        } else if ((*ip & 0x08U) != 0U) {
+            size = 8U;
+        }
+    }
+
+    return (*ip == 0x88U || *ip == 0xC6U || *ip == 0x80U) ? 1U : size;
+}
+
+static void Sim_Protect(const sim_block_t *block, int prot)
+{
+    if (mprotect((void *)block->base, SIM_PAGE_SIZE, prot) != 0) {
+        abort();
+    }
+}
+
+static void Sim_OnSegv(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    uintptr_t addr = (uintptr_t)info->si_addr;
+    const sim_block_t *block = Sim_FindBlock(addr);
+
+    if (block == NULL || s_pending != NULL) {
+        /* Not a register access: fault again with the default action */
+        signal(sig, SIG_DFL);
+        return;
+    }
+
+    s_pending = block;
+    s_pending_offset = (uint32_t)(addr - block->base) & ~3U;
+    s_pending_write = ((uint64_t)uc->uc_mcontext.gregs[REG_ERR] & SIM_PF_WRITE) != 0U;
+    s_pending_lane = (uint32_t)addr & 3U;
+    s_pending_size = Sim_StoreSize((const uint8_t *)(uintptr_t)uc->uc_mcontext.gregs[REG_RIP]);
+    s_pending_old = REG(Sim_BlockRegs(block), s_pending_offset);
+
+    if (!s_pending_write && block->read != NULL) {
+        block->read(block->instance, Sim_BlockRegs(block), s_pending_offset);
+    }
+
+    Sim_Protect(block, PROT_READ | PROT_WRITE);
+    uc->uc_mcontext.gregs[REG_EFL] |= SIM_EFLAGS_TF;
+}
+
+static void Sim_OnTrap(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    const sim_block_t *block = s_pending;
+    uint32_t *regs;
+
+    (void)info;
+    if (block == NULL) {
+        signal(sig, SIG_DFL);
+        return;
+    }
+
+    uc->uc_mcontext.gregs[REG_EFL] &= ~SIM_EFLAGS_TF;
+    s_pending = NULL;
+    Sim_Protect(block, s_models ? PROT_NONE : (PROT_READ | PROT_WRITE));
+
+    if (s_pending_write && block->write != NULL) {
+        regs = Sim_BlockRegs(block);
+        block->write(block->instance, regs, s_pending_offset, s_pending_old, REG(regs, s_pending_offset));
+    }
+}
+
+/**
+ * @brief Map one region at its device address and at an alias
+ */
+static uint8_t *Sim_MapRegion(uintptr_t base, const char *name)
+{
+    int fd = memfd_create(name, 0);
+    void *dev;
+    void *alias;
+
+    if (fd < 0 || ftruncate(fd, (off_t)SIM_REGION_SIZE) != 0) {
+        perror("sim: memfd");
+        abort();
+    }
+
+    dev = mmap((void *)base, SIM_REGION_SIZE, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+    alias = mmap(NULL, SIM_REGION_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (dev != (void *)base || alias == MAP_FAILED) {
+        fprintf(stderr, "sim: cannot map %s at 0x%08lx\n", name, (unsigned long)base);
+        abort();
+    }
+
+    close(fd);
+    return (uint8_t *)alias;
+}
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+void SIM_Init(void)
+{
+    struct sigaction sa;
+
+    s_aips = Sim_MapRegion(SIM_AIPS_BASE, "sim_aips");
+    s_ppb = Sim_MapRegion(SIM_PPB_BASE, "sim_ppb");
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_sigaction = Sim_OnSegv;
+    sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = Sim_OnTrap;
+    sigaction(SIGTRAP, &sa, NULL);
+
+    SIM_Reset();
+    SIM_SetModels(true);
+}
+
+void SIM_Reset(void)
+{
+    memset(s_aips, 0, SIM_REGION_SIZE);
+    memset(s_ppb, 0, SIM_REGION_SIZE);
+
+    for (uint32_t i = 0; i < SIM_BLOCK_COUNT; i++) {
+        if (s_blocks[i].reset != NULL) {
+            s_blocks[i].reset(s_blocks[i].instance, Sim_BlockRegs(&s_blocks[i]));
+        }
+    }
+
+    memset(s_uart_rx_q, 0, sizeof(s_uart_rx_q));
+    memset(s_uart_tx_q, 0, sizeof(s_uart_tx_q));
+    memset(s_can_tx_q, 0, sizeof(s_can_tx_q));
+    memset(s_adc_input, 0, sizeof(s_adc_input));
+    memset(s_gpio_input, 0, sizeof(s_gpio_input));
+    s_crc_state = 0U;
+}
+
+void SIM_SetModels(bool enable)
+{
+    s_models = enable;
+    for (uint32_t i = 0; i < SIM_BLOCK_COUNT; i++) {
+        Sim_Protect(&s_blocks[i], enable ? PROT_NONE : (PROT_READ | PROT_WRITE));
+    }
+}
+
+uint32_t SIM_Peek(const volatile void *reg)
+{
+    return *Sim_Alias((uintptr_t)reg);
+}
+
+void SIM_Poke(const volatile void *reg, uint32_t value)
+{
+    *Sim_Alias((uintptr_t)reg) = value;
+}
+
+void SIM_UartPushRx(uint8_t instance, uint8_t data)
+{
+    uint32_t slot = Sim_QueuePush(&s_uart_rx_q[instance]);
+    uint32_t *regs = Sim_BlockRegs(&s_blocks[3U + instance]);
+
+    if (slot != SIM_QUEUE_DEPTH) {
+        s_uart_rx[instance][slot] = data;
+        REG(regs, LPUART_STAT) |= LPUART_STAT_RDRF;
+    }
+}
+
+bool SIM_UartTakeTx(uint8_t instance, uint8_t *data)
+{
+    uint32_t slot = Sim_QueuePop(&s_uart_tx_q[instance]);
+
+    if (slot == SIM_QUEUE_DEPTH) {
+        return false;
+    }
+
+    *data = s_uart_tx[instance][slot];
+    return true;
+}
+
+void SIM_AdcSetInput(uint8_t instance, uint8_t channel, uint16_t value)
+{
+    s_adc_input[instance][channel % SIM_ADC_INPUTS] = value & 0xFFFU;
+}
+
+bool SIM_AdcHwTrigger(uint8_t instance, uint8_t slot)
+{
+    uint32_t *regs = Sim_BlockRegs(SIM_BLOCK_ADC(instance));
+
+    if ((REG(regs, ADC_SC2) & ADC_SC2_ADTRG) == 0U ||
+        (REG(regs, ADC_SC1(slot)) & ADC_SC1_ADCH) == ADC_SC1_ADCH) {
+        return false;
+    }
+
+    Sim_AdcConvert(instance, regs, slot);
+    return true;
+}
+
+bool SIM_CanInject(uint8_t instance, const sim_can_frame_t *frame)
+{
+    return Sim_CanDeliver(Sim_BlockRegs(SIM_BLOCK_CAN(instance)), frame);
+}
+
+bool SIM_CanTakeTx(uint8_t instance, sim_can_frame_t *frame)
+{
+    uint32_t slot = Sim_QueuePop(&s_can_tx_q[instance]);
+
+    if (slot == SIM_QUEUE_DEPTH) {
+        return false;
+    }
+
+    *frame = s_can_tx[instance][slot];
+    return true;
+}
+
+void SIM_GpioSetInput(uint8_t port, uint8_t pin, bool level)
+{
+    if (level) {
+        s_gpio_input[port] |= 1UL << pin;
+    } else {
+        s_gpio_input[port] &= ~(1UL << pin);
+    }
+}
+
+bool SIM_PortRaise(uint8_t port, uint8_t pin)
+{
+    uint32_t *regs = Sim_BlockRegs(SIM_BLOCK_PORT(port));
+
+    if (PORT_PCR_IRQC(REG(regs, PORT_PCR(pin))) == 0U) {
+        return false;
+    }
+
+    REG(regs, PORT_PCR(pin)) |= PORT_PCR_ISF;
+    REG(regs, PORT_ISFR) |= 1UL << pin;
+    return true;
+}
+
+void *SIM_DmaAlloc(size_t size)
+{
+    void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+
+    if (mem == MAP_FAILED) {
+        perror("sim: dma buffer");
+        abort();
+    }
+    return mem;
+}
+
+bool SIM_LpitExpire(uint8_t channel)
+{
+    uint32_t *regs = Sim_BlockRegs(SIM_BLOCK_LPIT);
+
+    if ((REG(regs, LPIT_SETTEN) & (1UL << channel)) == 0U) {
+        return false;
+    }
+
+    REG(regs, LPIT_TMR(channel) + LPIT_CVAL) = REG(regs, LPIT_TMR(channel) + LPIT_TVAL);
+    REG(regs, LPIT_MSR) |= 1UL << channel;
+    return true;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file    sim.h
+ * @brief   Host Simulator - RAM-backed S32K144 register maps
+ * @details Maps RAM at the real peripheral (0x40000000) and private
+ *          peripheral bus (0xE0000000) addresses, so lib/driver and
+ *          lib/service compile unchanged on a Linux host and every
+ *          CAN0, LPUART1, ADC0, ... access lands in simulated registers.
+ *
+ * Registers with side effects (W1C flags, TDRE/RDRF, COCO, SETTEN/CLRTEN,
+ * PSOR/PCOR/PTOR, FRZACK, the CAN message buffers, the CRC engine, the eDMA
+ * commands) live on pages that are kept inaccessible while the behavioural
+ * models are on. Each access faults, is single-stepped, and the owning
+ * model then sees the old and new value of the word. All other blocks
+ * (PCC, NVIC, DWT, DMA TCDs, ...) are plain RAM.
+ *
+ * SIM_SetModels(false) opens every page, so benchmarks time the driver
+ * code rather than the fault handling.
+ *
+ * @note x86_64 Linux only.
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/** @brief Frames and bytes buffered per simulated bus */
+#define SIM_QUEUE_DEPTH         (64U)
+
+/** @brief ADC inputs per instance (external channels 0-15) */
+#define SIM_ADC_INPUTS          (16U)
+
+/**
+ * @brief CAN frame on the simulated bus
+ */
+typedef struct {
+    uint32_t id;                /**< 11-bit or 29-bit identifier */
+    bool ext;                   /**< Extended identifier */
+    bool rtr;                   /**< Remote frame */
+    uint8_t dlc;                /**< Data length (0-8) */
+    uint8_t data[8];
+} sim_can_frame_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Map the register space and install the fault handlers
+ * @note Call once, before any driver call. Aborts if the fixed mapping fails.
+ */
+void SIM_Init(void);
+
+/**
+ * @brief Zero every register, load the reset values and empty the queues
+ */
+void SIM_Reset(void);
+
+/**
+ * @brief Turn the behavioural models on or off
+ * @param enable false: every register is plain RAM (for timing)
+ */
+void SIM_SetModels(bool enable);
+
+/**
+ * @brief Read a register without running its model
+ */
+uint32_t SIM_Peek(const volatile void *reg);
+
+/**
+ * @brief Write a register without running its model
+ */
+void SIM_Poke(const volatile void *reg, uint32_t value);
+
+/**
+ * @brief Queue a byte for the receiver of an LPUART
+ * @param instance 0-2
+ */
+void SIM_UartPushRx(uint8_t instance, uint8_t data);
+
+/**
+ * @brief Take the oldest byte sent by an LPUART
+ * @return true if a byte was available
+ */
+bool SIM_UartTakeTx(uint8_t instance, uint8_t *data);
+
+/**
+ * @brief Set the 12-bit value an ADC channel converts to
+ * @param instance 0-1
+ * @param channel 0-15
+ */
+void SIM_AdcSetInput(uint8_t instance, uint8_t channel, uint16_t value);
+
+/**
+ * @brief Complete the conversion armed in SC1[slot] by a hardware trigger
+ * @return false if SC2.ADTRG is clear or the slot has no channel
+ */
+bool SIM_AdcHwTrigger(uint8_t instance, uint8_t slot);
+
+/**
+ * @brief Put a frame on the bus of a FlexCAN instance
+ * @return true if a receive mailbox took it
+ */
+bool SIM_CanInject(uint8_t instance, const sim_can_frame_t *frame);
+
+/**
+ * @brief Take the oldest frame transmitted by a FlexCAN instance
+ * @return true if a frame was available
+ */
+bool SIM_CanTakeTx(uint8_t instance, sim_can_frame_t *frame);
+
+/**
+ * @brief Drive the level of an input pin
+ * @param port 0-4 (A-E)
+ */
+void SIM_GpioSetInput(uint8_t port, uint8_t pin, bool level);
+
+/**
+ * @brief Latch the interrupt flag of a pin, as an edge matching IRQC would
+ * @return false if the pin has no interrupt configured
+ */
+bool SIM_PortRaise(uint8_t port, uint8_t pin);
+
+/**
+ * @brief Allocate memory an eDMA transfer can address
+ * @details The drivers pass 32-bit addresses to the TCD, so a buffer the
+ *          eDMA model reads must be mapped below 4 GB. Never freed.
+ */
+void *SIM_DmaAlloc(size_t size);
+
+/**
+ * @brief Let an LPIT channel time out
+ * @return false if the channel is not enabled
+ */
+bool SIM_LpitExpire(uint8_t channel);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,22 @@
+/**
+ * @file    sim_assert.h
+ * @brief   Host Simulator - DEV_ASSERT for the checked host build
+ * @details Selected with -DCUSTOM_DEVASSERT='"sim_assert.h"', see
+ *          include/devassert.h. A failed check reports its location to
+ *          SIM_AssertFailed(), which the unit tests implement so that
+ *          UNIT_EXPECT_ASSERT() can catch it.
+ */
+
+#ifndef SIM_ASSERT_H_
+#define SIM_ASSERT_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Handle a failed DEV_ASSERT; does not return
+ */
+void SIM_AssertFailed(const char *file, uint32_t line) __attribute__((noreturn));
+
+#define DEV_ASSERT(x)               ((x) ? (void)0 : SIM_AssertFailed(__FILE__, (uint32_t)__LINE__))
+
+#endif /* SIM_ASSERT_H_ */
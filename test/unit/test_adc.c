@@ -0,0 +1,144 @@
+/**
+ * @file    test_adc.c
+ * @brief   ADC driver and service against the simulated ADC0
+ */
+
+#include "unit.h"
+#include "sim.h"
+#include "adc_srv.h"
+#include "adc.h"
+#include "adc_irq.h"
+#include "nvic.h"
+
+#define TEST_ADC_CHANNEL        (5U)
+#define TEST_ADC_MID_SCALE      (2048U)     /* 2500 mV of the 5000 mV reference */
+
+static uint8_t s_cb_channel;
+static uint16_t s_cb_raw;
+static uint32_t s_cb_mv;
+static uint32_t s_cb_count;
+
+static uint16_t s_seq_results[4];
+static uint8_t s_seq_count;
+
+static void Test_Callback(uint8_t channel, uint16_t rawValue, uint32_t voltageMv)
+{
+    s_cb_channel = channel;
+    s_cb_raw = rawValue;
+    s_cb_mv = voltageMv;
+    s_cb_count++;
+}
+
+static void Test_SequenceCallback(ADC_Type *adc, const uint16_t *results, uint8_t count)
+{
+    (void)adc;
+    for (uint8_t i = 0; i < count && i < 4U; i++) {
+        s_seq_results[i] = results[i];
+    }
+    s_seq_count = count;
+}
+
+static void Test_Init(void)
+{
+    adc_srv_config_t config = { .channel = TEST_ADC_CHANNEL };
+
+    UNIT_CHECK_EQ(ADC_SRV_Start(&config), ADC_SRV_NOT_INITIALIZED);
+    UNIT_CHECK_EQ(ADC_SRV_Init(), ADC_SRV_SUCCESS);
+
+    UNIT_CHECK_EQ((SIM_Peek(&ADC0->CFG1) & ADC_CFG1_MODE_MASK) >> ADC_CFG1_MODE_SHIFT, ADC_MODE_12_BIT);
+    UNIT_CHECK(SIM_Peek(&NVIC->ISER[ADC0_IRQn / 32]) & (1UL << (ADC0_IRQn % 32)));
+}
+
+static void Test_PolledConversion(void)
+{
+    adc_srv_config_t config = { .channel = TEST_ADC_CHANNEL,
+                                .interrupt = ADC_CONVERSION_INTERRUPT_DISABLE };
+
+    SIM_AdcSetInput(0U, TEST_ADC_CHANNEL, TEST_ADC_MID_SCALE);
+    UNIT_CHECK_EQ(ADC_SRV_Start(&config), ADC_SRV_SUCCESS);
+    UNIT_CHECK_EQ(config.raw_value, TEST_ADC_MID_SCALE);
+
+    /* Reading R[0] cleared COCO */
+    UNIT_CHECK_EQ(SIM_Peek(&ADC0->SC1[0]) & ADC_SC1_COCO_MASK, 0U);
+
+    UNIT_CHECK_EQ(ADC_SRV_Read(&config), ADC_SRV_SUCCESS);
+    UNIT_CHECK_EQ(config.voltage_mv, 2500U);
+    UNIT_CHECK_EQ(ADC_SRV_Read(NULL), ADC_SRV_ERROR);
+}
+
+static void Test_DriverCompletion(void)
+{
+    SIM_AdcSetInput(0U, 2U, 4095U);
+
+    UNIT_CHECK_EQ(ADC_ConvertAnalog(ADC0, ADC_CHANNEL_2), ADC_STATUS_SUCCESS);
+    UNIT_CHECK_EQ(ADC_InterruptCheck(ADC0), ADC_STATUS_CONVERSION_COMPLETED);
+    UNIT_CHECK_EQ(ADC_ReadRaw(ADC0), 4095U);
+    UNIT_CHECK_EQ(ADC_InterruptCheck(ADC0), ADC_STATUS_CONVERSION_WAITING);
+}
+
+static void Test_InterruptCallback(void)
+{
+    SIM_AdcSetInput(0U, TEST_ADC_CHANNEL, 1024U);
+    UNIT_CHECK_EQ(ADC_SRV_RegisterCallback(Test_Callback), ADC_SRV_SUCCESS);
+
+    UNIT_CHECK_EQ(ADC_InterruptConfig(ADC0, ADC_CONVERSION_INTERRUPT_ENABLE), ADC_STATUS_SUCCESS);
+    UNIT_CHECK_EQ(ADC_ConvertAnalog(ADC0, (adc_channel_t)TEST_ADC_CHANNEL), ADC_STATUS_SUCCESS);
+    UNIT_CHECK(SIM_Peek(&ADC0->SC1[0]) & ADC_SC1_AIEN_MASK);
+
+    s_cb_count = 0;
+    ADC0_IRQHandler();
+
+    UNIT_CHECK_EQ(s_cb_count, 1U);
+    UNIT_CHECK_EQ(s_cb_channel, TEST_ADC_CHANNEL);
+    UNIT_CHECK_EQ(s_cb_raw, 1024U);
+    UNIT_CHECK_EQ(s_cb_mv, 1250U);
+    UNIT_CHECK_EQ(SIM_Peek(&ADC0->SC1[0]) & ADC_SC1_COCO_MASK, 0U);
+
+    /* Nothing pending: no call */
+    ADC0_IRQHandler();
+    UNIT_CHECK_EQ(s_cb_count, 1U);
+}
+
+static void Test_HardwareTriggeredSequence(void)
+{
+    SIM_AdcSetInput(0U, 3U, 100U);
+    SIM_AdcSetInput(0U, 4U, 200U);
+
+    UNIT_CHECK_EQ(ADC_SetHardwareTrigger(ADC0, true), ADC_STATUS_SUCCESS);
+    UNIT_CHECK_EQ(ADC_ConfigSlot(ADC0, 0U, 3U, ADC_CONVERSION_INTERRUPT_DISABLE), ADC_STATUS_SUCCESS);
+    UNIT_CHECK_EQ(ADC_ConfigSlot(ADC0, 1U, 4U, ADC_CONVERSION_INTERRUPT_ENABLE), ADC_STATUS_SUCCESS);
+    UNIT_CHECK_EQ(ADC_RegisterSequenceCallback(ADC0, 2U, Test_SequenceCallback), ADC_STATUS_SUCCESS);
+
+    /* Writing SC1[0] with ADTRG set does not convert */
+    UNIT_CHECK_EQ(SIM_Peek(&ADC0->SC1[0]) & ADC_SC1_COCO_MASK, 0U);
+
+    s_seq_count = 0;
+    UNIT_CHECK(SIM_AdcHwTrigger(0U, 0U));
+    ADC0_IRQHandler();
+    UNIT_CHECK_EQ(s_seq_count, 0U);     /* Last slot not done yet */
+
+    UNIT_CHECK(SIM_AdcHwTrigger(0U, 1U));
+    ADC0_IRQHandler();
+    UNIT_CHECK_EQ(s_seq_count, 2U);
+    UNIT_CHECK_EQ(s_seq_results[0], 100U);
+    UNIT_CHECK_EQ(s_seq_results[1], 200U);
+
+    UNIT_CHECK_EQ(ADC_ConfigSlot(ADC0, 16U, 0U, ADC_CONVERSION_INTERRUPT_DISABLE), ADC_STATUS_INVALID_PARAM);
+
+    UNIT_CHECK_EQ(ADC_RegisterSequenceCallback(ADC0, 0U, NULL), ADC_STATUS_SUCCESS);
+    UNIT_CHECK_EQ(ADC_SetHardwareTrigger(ADC0, false), ADC_STATUS_SUCCESS);
+}
+
+static const unit_case_t s_cases[] = {
+    { "init",                          Test_Init },
+    { "polled_conversion",             Test_PolledConversion },
+    { "driver_completion",             Test_DriverCompletion },
+    { "interrupt_callback",            Test_InterruptCallback },
+    { "hardware_triggered_sequence",   Test_HardwareTriggeredSequence },
+};
+
+int main(void)
+{
+    SIM_Init();
+    return UNIT_Run("adc", s_cases, UNIT_COUNT(s_cases));
+}
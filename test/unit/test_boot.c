@@ -0,0 +1,476 @@
+/**
+ * @file    test_boot.c
+ * @brief   Bootloader service against a RAM flash model and the simulated FlexCAN0
+ */
+
+#include "unit.h"
+#include "sim.h"
+#include "boot_srv.h"
+#include "can_srv.h"
+#include "can_irq.h"
+#include "nvm_srv.h"
+#include "crc_srv.h"
+
+#include <string.h>
+
+#define TEST_FLASH_SIZE         (8192U)
+#define TEST_SECTOR_SIZE        (4096U)
+#define TEST_IMAGE_SIZE         (4100U)     /* Last block is one short frame */
+#define TEST_BLOCK_COUNT        ((TEST_IMAGE_SIZE + BOOT_SRV_BLOCK_SIZE - 1U) / BOOT_SRV_BLOCK_SIZE)
+#define TEST_PHRASE_COUNT       ((TEST_IMAGE_SIZE + 7U) / 8U)
+#define TEST_FRAMES_PER_BLOCK   (BOOT_SRV_BLOCK_SIZE / 8U)
+#define TEST_BOOT_TX_MB         (CAN_TX_MB_START + 1U)  /* After the shared one of CAN_SRV_Init */
+
+/*
+ * RAM flash model: programming needs an erased, phrase-aligned location,
+ * every call is counted so the erase/program pattern can be checked.
+ */
+static uint8_t s_flash[TEST_FLASH_SIZE];
+static uint32_t s_erase_count;
+static uint32_t s_program_count;
+static uint32_t s_violations;
+
+static uint8_t s_image[TEST_IMAGE_SIZE];
+
+static bool Flash_Erase(uint32_t address)
+{
+    uint32_t offset = address - BOOT_SRV_APP_BASE;
+
+    if ((offset % TEST_SECTOR_SIZE) != 0U || offset >= TEST_FLASH_SIZE) {
+        s_violations++;
+        return false;
+    }
+
+    memset(&s_flash[offset], 0xFF, TEST_SECTOR_SIZE);
+    s_erase_count++;
+    return true;
+}
+
+static bool Flash_Program(uint32_t address, const uint8_t *data)
+{
+    uint32_t offset = address - BOOT_SRV_APP_BASE;
+
+    if ((offset & 7U) != 0U || offset >= TEST_FLASH_SIZE) {
+        s_violations++;
+        return false;
+    }
+
+    for (uint8_t i = 0; i < 8U; i++) {
+        if (s_flash[offset + i] != 0xFFU) {
+            s_violations++;
+            return false;
+        }
+    }
+
+    memcpy(&s_flash[offset], data, 8U);
+    s_program_count++;
+    return true;
+}
+
+static void Flash_Read(uint32_t address, uint8_t *data, uint32_t length)
+{
+    uint32_t offset = address - BOOT_SRV_APP_BASE;
+
+    if (offset + length > TEST_FLASH_SIZE) {
+        memset(data, 0xFF, length);
+        return;
+    }
+
+    memcpy(data, &s_flash[offset], length);
+}
+
+static const boot_srv_flash_ops_t s_flash_ops = {
+    Flash_Erase,
+    Flash_Program,
+    Flash_Read,
+    TEST_SECTOR_SIZE
+};
+
+/*
+ * nvm_srv stand-in: FlexRAM is not simulated and boot_srv only needs the
+ * key/value contract. libhost.a carries no nvm_srv, so these are the
+ * definitions boot_srv links against.
+ */
+static uint32_t s_nvm_value[NVM_SRV_KEY_COUNT];
+static bool s_nvm_valid[NVM_SRV_KEY_COUNT];
+
+nvm_srv_status_t NVM_SRV_Read(nvm_srv_key_t key, uint32_t *value)
+{
+    if (key >= NVM_SRV_KEY_COUNT || value == NULL) {
+        return NVM_SRV_INVALID_PARAM;
+    }
+
+    if (!s_nvm_valid[key]) {
+        return NVM_SRV_NOT_FOUND;
+    }
+
+    *value = s_nvm_value[key];
+    return NVM_SRV_SUCCESS;
+}
+
+uint32_t NVM_SRV_ReadOrDefault(nvm_srv_key_t key, uint32_t defaultValue)
+{
+    uint32_t value;
+
+    return (NVM_SRV_Read(key, &value) == NVM_SRV_SUCCESS) ? value : defaultValue;
+}
+
+nvm_srv_status_t NVM_SRV_Write(nvm_srv_key_t key, uint32_t value)
+{
+    if (key >= NVM_SRV_KEY_COUNT) {
+        return NVM_SRV_INVALID_PARAM;
+    }
+
+    s_nvm_value[key] = value;
+    s_nvm_valid[key] = true;
+    return NVM_SRV_SUCCESS;
+}
+
+nvm_srv_status_t NVM_SRV_Flush(void)
+{
+    return NVM_SRV_SUCCESS;
+}
+
+/**
+ * @brief Service every flagged mailbox, one per interrupt as on target
+ */
+static void Test_ServiceInterrupts(void)
+{
+    for (uint32_t i = 0; i < 32U && SIM_Peek(&CAN0->IFLAG1) != 0U; i++) {
+        CAN0_ORed_0_15_MB_IRQHandler();
+    }
+}
+
+/**
+ * @brief One main loop pass: pipeline step, then the TX completions
+ */
+static void Test_Process(void)
+{
+    BOOT_SRV_Process();
+    Test_ServiceInterrupts();
+}
+
+static bool Test_Inject(uint32_t id, const uint8_t *data, uint8_t dlc)
+{
+    sim_can_frame_t frame = { .id = id, .dlc = dlc };
+    bool taken;
+
+    memcpy(frame.data, data, dlc);
+    taken = SIM_CanInject(0U, &frame);
+    Test_ServiceInterrupts();
+
+    return taken;
+}
+
+static void Test_Command(uint8_t cmd, uint32_t value)
+{
+    uint8_t data[5] = { cmd, (uint8_t)(value >> 24), (uint8_t)(value >> 16),
+                        (uint8_t)(value >> 8), (uint8_t)value };
+
+    UNIT_CHECK(Test_Inject(BOOT_SRV_CMD_ID, data, sizeof(data)));
+}
+
+/**
+ * @brief Stream frames [first, last) of a block, sequence numbers as the host sends them
+ */
+static void Test_SendFrames(uint32_t block, uint32_t first, uint32_t last)
+{
+    uint32_t offset;
+    uint32_t end = (block + 1U) * BOOT_SRV_BLOCK_SIZE;
+
+    if (end > TEST_IMAGE_SIZE) {
+        end = TEST_IMAGE_SIZE;
+    }
+
+    for (uint32_t frame = first; frame < last; frame++) {
+        offset = (block * BOOT_SRV_BLOCK_SIZE) + (frame * 8U);
+        if (offset >= end) {
+            break;
+        }
+        UNIT_CHECK(Test_Inject(BOOT_SRV_DATA_ID_BASE + (frame & 0x0FU), &s_image[offset],
+                               (uint8_t)(((end - offset) < 8U) ? (end - offset) : 8U)));
+    }
+}
+
+static void Test_SendBlock(uint32_t block)
+{
+    Test_SendFrames(block, 0U, TEST_FRAMES_PER_BLOCK);
+}
+
+/**
+ * @brief Take the next response; data[0] is 0 if none was sent
+ */
+static sim_can_frame_t Test_Response(void)
+{
+    sim_can_frame_t frame;
+
+    memset(&frame, 0, sizeof(frame));
+    if (SIM_CanTakeTx(0U, &frame)) {
+        UNIT_CHECK_EQ(frame.id, BOOT_SRV_RSP_ID);
+    }
+
+    return frame;
+}
+
+static void Test_ExpectBlock(uint8_t code, uint32_t block)
+{
+    sim_can_frame_t rsp = Test_Response();
+
+    UNIT_CHECK_EQ(rsp.data[0], code);
+    UNIT_CHECK_EQ(((uint32_t)rsp.data[1] << 8) | rsp.data[2], block);
+}
+
+static void Test_ExpectNegative(uint8_t cmd, uint8_t reason)
+{
+    sim_can_frame_t rsp = Test_Response();
+
+    UNIT_CHECK_EQ(rsp.data[0], BOOT_SRV_RSP_NEGATIVE);
+    UNIT_CHECK_EQ(rsp.data[1], cmd);
+    UNIT_CHECK_EQ(rsp.data[2], reason);
+}
+
+/**
+ * @brief START and run the erase until the positive response
+ */
+static void Test_Start(void)
+{
+    s_erase_count = 0;
+    s_program_count = 0;
+
+    Test_Command(BOOT_SRV_CMD_START, TEST_IMAGE_SIZE);
+    for (uint32_t i = 0; i < 8U && BOOT_SRV_GetState() != BOOT_SRV_STATE_RECEIVING; i++) {
+        Test_Process();
+    }
+
+    UNIT_CHECK_EQ(BOOT_SRV_GetState(), BOOT_SRV_STATE_RECEIVING);
+    UNIT_CHECK_EQ(Test_Response().data[0], BOOT_SRV_CMD_START | BOOT_SRV_RSP_POSITIVE);
+}
+
+static void Test_Init(void)
+{
+    can_srv_config_t can = {
+        .baudrate = 500000U,
+        .filter_id = 0x123U,
+        .filter_mask = 0x7FFU,
+        .mode = CAN_MODE_NORMAL,
+    };
+
+    /* Image: valid SP / reset vector followed by a pattern */
+    for (uint32_t i = 0; i < TEST_IMAGE_SIZE; i++) {
+        s_image[i] = (uint8_t)(i * 7U);
+    }
+    s_image[0] = 0x00; s_image[1] = 0x70; s_image[2] = 0x00; s_image[3] = 0x20;   /* 0x20007000 */
+    s_image[4] = 0x01; s_image[5] = 0x81; s_image[6] = 0x00; s_image[7] = 0x00;   /* 0x00008101 */
+
+    memset(s_flash, 0x00, sizeof(s_flash));     /* Not erased */
+
+    UNIT_CHECK_EQ(CAN_SRV_Init(&can), CAN_SRV_SUCCESS);
+    BOOT_SRV_SetFlashOps(&s_flash_ops);
+    UNIT_CHECK_EQ(BOOT_SRV_Init(), BOOT_SRV_SUCCESS);
+    UNIT_CHECK_EQ(BOOT_SRV_GetState(), BOOT_SRV_STATE_IDLE);
+    UNIT_CHECK(!BOOT_SRV_IsAppValid());
+}
+
+static void Test_CommandOutOfSequence(void)
+{
+    Test_Command(BOOT_SRV_CMD_END, 0U);
+    Test_Process();
+    Test_ExpectNegative(BOOT_SRV_CMD_END, BOOT_SRV_NRC_SEQUENCE);
+
+    Test_Command(BOOT_SRV_CMD_GO, 0U);
+    Test_Process();
+    Test_ExpectNegative(BOOT_SRV_CMD_GO, BOOT_SRV_NRC_NO_IMAGE);
+    UNIT_CHECK(!BOOT_SRV_IsStartRequested());
+
+    /* Data outside a transfer is dropped */
+    Test_SendFrames(0U, 0U, 1U);
+    Test_Process();
+    UNIT_CHECK_EQ(Test_Response().data[0], 0U);
+}
+
+static void Test_StartErases(void)
+{
+    Test_Start();
+
+    UNIT_CHECK_EQ(s_erase_count, 2U);
+    UNIT_CHECK_EQ(s_flash[0], 0xFFU);
+    UNIT_CHECK_EQ(s_flash[TEST_FLASH_SIZE - 1U], 0xFFU);
+    UNIT_CHECK_EQ(NVM_SRV_ReadOrDefault(NVM_SRV_KEY_BOOT_IMAGE_SIZE, 1U), 0U);
+}
+
+static void Test_PipelinedBlocks(void)
+{
+    /* A full window lands in the buffers before anything is programmed */
+    Test_SendBlock(0U);
+    Test_SendBlock(1U);
+    UNIT_CHECK_EQ(s_program_count, 0U);
+    UNIT_CHECK_EQ(Test_Response().data[0], 0U);
+
+    Test_Process();
+    UNIT_CHECK_EQ(s_program_count, TEST_FRAMES_PER_BLOCK);
+    Test_ExpectBlock(BOOT_SRV_RSP_BLOCK_ACK, 1U);
+    UNIT_CHECK(memcmp(s_flash, s_image, BOOT_SRV_BLOCK_SIZE) == 0);
+
+    /* Block 2 goes into the freed buffer while block 1 waits */
+    Test_SendBlock(2U);
+    Test_Process();
+    Test_ExpectBlock(BOOT_SRV_RSP_BLOCK_ACK, 2U);
+    Test_Process();
+    Test_ExpectBlock(BOOT_SRV_RSP_BLOCK_ACK, 3U);
+
+    /* Nothing buffered: no response */
+    Test_Process();
+    UNIT_CHECK_EQ(Test_Response().data[0], 0U);
+    UNIT_CHECK_EQ(s_program_count, 3U * TEST_FRAMES_PER_BLOCK);
+    UNIT_CHECK(memcmp(s_flash, s_image, 3U * BOOT_SRV_BLOCK_SIZE) == 0);
+}
+
+static void Test_SequenceGapNaks(void)
+{
+    /* Frame 5 lost: frame 6 carries the wrong sequence number */
+    Test_SendFrames(3U, 0U, 5U);
+    Test_SendFrames(3U, 6U, 8U);
+
+    /* Mailbox still busy: the NAK waits in the queue */
+    SIM_Poke(&CAN0->RAMn[TEST_BOOT_TX_MB * 4U], CAN_CS_CODE_TX_DATA << CAN_CS_CODE_SHIFT);
+    Test_Process();
+    UNIT_CHECK_EQ(Test_Response().data[0], 0U);
+    SIM_Poke(&CAN0->RAMn[TEST_BOOT_TX_MB * 4U], CAN_CS_CODE_TX_INACTIVE << CAN_CS_CODE_SHIFT);
+    Test_Process();
+    Test_ExpectBlock(BOOT_SRV_RSP_BLOCK_NAK, 3U);
+    UNIT_CHECK_EQ(s_program_count, 3U * TEST_FRAMES_PER_BLOCK);
+
+    /* Frames still in flight are dropped until the block restarts */
+    Test_SendFrames(3U, 8U, 10U);
+    Test_SendBlock(3U);
+    Test_Process();
+    Test_ExpectBlock(BOOT_SRV_RSP_BLOCK_ACK, 4U);
+
+    Test_SendBlock(4U);
+    Test_Process();
+    Test_ExpectBlock(BOOT_SRV_RSP_BLOCK_ACK, 5U);
+
+    UNIT_CHECK_EQ(s_program_count, TEST_PHRASE_COUNT);
+    UNIT_CHECK_EQ(s_violations, 0U);
+    UNIT_CHECK(memcmp(s_flash, s_image, TEST_IMAGE_SIZE) == 0);
+}
+
+static void Test_CrcMismatchRejected(void)
+{
+    uint32_t crc = CRC_SRV_Compute(CRC_SRV_CRC32, s_image, TEST_IMAGE_SIZE);
+
+    Test_Command(BOOT_SRV_CMD_END, crc ^ 1U);
+    Test_Process();
+    Test_ExpectNegative(BOOT_SRV_CMD_END, BOOT_SRV_NRC_CRC);
+
+    UNIT_CHECK_EQ(BOOT_SRV_GetState(), BOOT_SRV_STATE_ERROR);
+    UNIT_CHECK_EQ(NVM_SRV_ReadOrDefault(NVM_SRV_KEY_BOOT_IMAGE_SIZE, 1U), 0U);
+    UNIT_CHECK(!BOOT_SRV_IsAppValid());
+}
+
+static void Test_FullUpdate(void)
+{
+    uint32_t acked = 0;
+    sim_can_frame_t rsp;
+
+    Test_Start();
+
+    /* Host side: block b may go once b < ACK + WINDOW */
+    for (uint32_t block = 0; block < TEST_BLOCK_COUNT; block++) {
+        for (uint32_t i = 0; i < 8U && block >= acked + BOOT_SRV_WINDOW; i++) {
+            Test_Process();
+            rsp = Test_Response();
+            if (rsp.data[0] == BOOT_SRV_RSP_BLOCK_ACK) {
+                acked = ((uint32_t)rsp.data[1] << 8) | rsp.data[2];
+            }
+        }
+        Test_SendBlock(block);
+    }
+
+    Test_Command(BOOT_SRV_CMD_END, CRC_SRV_Compute(CRC_SRV_CRC32, s_image, TEST_IMAGE_SIZE));
+    for (uint32_t i = 0; i < 8U && BOOT_SRV_GetState() != BOOT_SRV_STATE_DONE; i++) {
+        Test_Process();
+    }
+
+    UNIT_CHECK_EQ(BOOT_SRV_GetState(), BOOT_SRV_STATE_DONE);
+    do {
+        rsp = Test_Response();
+    } while (rsp.data[0] == BOOT_SRV_RSP_BLOCK_ACK);
+    UNIT_CHECK_EQ(rsp.data[0], BOOT_SRV_CMD_END | BOOT_SRV_RSP_POSITIVE);
+
+    /* 2 sectors erased, every phrase written exactly once */
+    UNIT_CHECK_EQ(s_erase_count, 2U);
+    UNIT_CHECK_EQ(s_program_count, TEST_PHRASE_COUNT);
+    UNIT_CHECK_EQ(s_violations, 0U);
+    UNIT_CHECK(memcmp(s_flash, s_image, TEST_IMAGE_SIZE) == 0);
+    UNIT_CHECK_EQ(NVM_SRV_ReadOrDefault(NVM_SRV_KEY_BOOT_IMAGE_SIZE, 0U), TEST_IMAGE_SIZE);
+}
+
+static void Test_AppValid(void)
+{
+    uint32_t crc;
+
+    UNIT_CHECK(BOOT_SRV_IsAppValid());
+
+    /* One flipped bit fails the CRC */
+    s_flash[100] ^= 0x01U;
+    UNIT_CHECK(!BOOT_SRV_IsAppValid());
+    s_flash[100] ^= 0x01U;
+
+    /* Reset handler without the Thumb bit, stored CRC matching */
+    s_flash[4] = 0x00U;
+    crc = CRC_SRV_Compute(CRC_SRV_CRC32, s_flash, TEST_IMAGE_SIZE);
+    UNIT_CHECK_EQ(NVM_SRV_Write(NVM_SRV_KEY_BOOT_IMAGE_CRC, crc), NVM_SRV_SUCCESS);
+    UNIT_CHECK(!BOOT_SRV_IsAppValid());
+
+    /* Stack pointer outside SRAM */
+    s_flash[4] = 0x01U;
+    s_flash[3] = 0x30U;
+    crc = CRC_SRV_Compute(CRC_SRV_CRC32, s_flash, TEST_IMAGE_SIZE);
+    UNIT_CHECK_EQ(NVM_SRV_Write(NVM_SRV_KEY_BOOT_IMAGE_CRC, crc), NVM_SRV_SUCCESS);
+    UNIT_CHECK(!BOOT_SRV_IsAppValid());
+
+    s_flash[3] = 0x20U;
+    crc = CRC_SRV_Compute(CRC_SRV_CRC32, s_flash, TEST_IMAGE_SIZE);
+    UNIT_CHECK_EQ(NVM_SRV_Write(NVM_SRV_KEY_BOOT_IMAGE_CRC, crc), NVM_SRV_SUCCESS);
+    UNIT_CHECK(BOOT_SRV_IsAppValid());
+
+    Test_Command(BOOT_SRV_CMD_GO, 0U);
+    Test_Process();
+    UNIT_CHECK_EQ(Test_Response().data[0], BOOT_SRV_CMD_GO | BOOT_SRV_RSP_POSITIVE);
+    UNIT_CHECK(BOOT_SRV_IsStartRequested());
+}
+
+static void Test_StartRequestCleared(void)
+{
+    /* Consumed by the caller: a failed start is not retried */
+    UNIT_CHECK(BOOT_SRV_IsStartRequested());
+    BOOT_SRV_ClearStartRequest();
+    UNIT_CHECK(!BOOT_SRV_IsStartRequested());
+
+    /* A new transfer drops a GO that was not acted on */
+    Test_Command(BOOT_SRV_CMD_GO, 0U);
+    Test_Process();
+    UNIT_CHECK_EQ(Test_Response().data[0], BOOT_SRV_CMD_GO | BOOT_SRV_RSP_POSITIVE);
+    UNIT_CHECK(BOOT_SRV_IsStartRequested());
+    Test_Start();
+    UNIT_CHECK(!BOOT_SRV_IsStartRequested());
+}
+
+static const unit_case_t s_cases[] = {
+    { "init",                      Test_Init },
+    { "command_out_of_sequence",   Test_CommandOutOfSequence },
+    { "start_erases",              Test_StartErases },
+    { "pipelined_blocks",          Test_PipelinedBlocks },
+    { "sequence_gap_naks",         Test_SequenceGapNaks },
+    { "crc_mismatch_rejected",     Test_CrcMismatchRejected },
+    { "full_update",               Test_FullUpdate },
+    { "app_valid",                 Test_AppValid },
+    { "start_request_cleared",     Test_StartRequestCleared },
+};
+
+int main(void)
+{
+    SIM_Init();
+    return UNIT_Run("boot", s_cases, UNIT_COUNT(s_cases));
+}
@@ -0,0 +1,224 @@
+/**
+ * @file    test_can.c
+ * @brief   CAN driver and service against the simulated FlexCAN0
+ */
+
+#include "unit.h"
+#include "sim.h"
+#include "can_srv.h"
+#include "can_fast.h"
+#include "can_irq.h"
+#include "nvic.h"
+
+#include <string.h>
+
+#define TEST_CAN_ID             (0x123U)
+#define TEST_CAN_EXT_ID         (0x18FF1234U)
+#define TEST_CAN_RX_MB          (16U)       /* First RX mailbox handed out by res_srv */
+#define TEST_CAN_TX_MB          (CAN_TX_MB_START)   /* Shared TX mailbox of CAN_SRV_Send */
+
+static can_srv_event_t s_events[8];
+static can_srv_message_t s_messages[8];
+static uint32_t s_event_count;
+
+static void Test_Callback(uint8_t instance, can_srv_event_t event, const can_srv_message_t *message)
+{
+    (void)instance;
+    if (s_event_count < 8U) {
+        s_events[s_event_count] = event;
+        if (message != NULL) {
+            s_messages[s_event_count] = *message;
+        }
+        s_event_count++;
+    }
+}
+
+/**
+ * @brief Service every flagged mailbox, one per interrupt as on target
+ */
+static void Test_ServiceInterrupts(void)
+{
+    for (uint32_t i = 0; i < 32U && SIM_Peek(&CAN0->IFLAG1) != 0U; i++) {
+        CAN0_ORed_0_15_MB_IRQHandler();
+    }
+}
+
+static void Test_InitLoopback(void)
+{
+    can_srv_config_t config = {
+        .baudrate = 500000U,
+        .filter_id = TEST_CAN_ID,
+        .filter_mask = 0x7FFU,
+        .filter_extended = false,
+        .mode = CAN_MODE_LOOPBACK,
+    };
+
+    UNIT_CHECK_EQ(CAN_SRV_Init(&config), CAN_SRV_SUCCESS);
+    UNIT_CHECK_EQ(CAN_SRV_RegisterCallback(Test_Callback), CAN_SRV_SUCCESS);
+
+    /* Out of freeze and running */
+    UNIT_CHECK_EQ(SIM_Peek(&CAN0->MCR) & (CAN_MCR_FRZACK_MASK | CAN_MCR_NOTRDY_MASK | CAN_MCR_MDIS_MASK), 0U);
+    UNIT_CHECK(SIM_Peek(&CAN0->CTRL1) & CAN_CTRL1_LPB_MASK);
+    UNIT_CHECK(SIM_Peek(&CAN0->MCR) & CAN_MCR_IRMQ_MASK);
+
+    /* Filter programmed in mailbox 16 with its own mask */
+    UNIT_CHECK_EQ(SIM_Peek(&CAN0->RAMn[TEST_CAN_RX_MB * 4U + 1U]), TEST_CAN_ID << CAN_ID_STD_SHIFT);
+    UNIT_CHECK_EQ(SIM_Peek(&CAN0->RXIMR[TEST_CAN_RX_MB]), 0x7FFU << CAN_ID_STD_SHIFT);
+    UNIT_CHECK_EQ(SIM_Peek(&CAN0->RAMn[TEST_CAN_RX_MB * 4U]) >> CAN_CS_CODE_SHIFT, CAN_CS_CODE_RX_EMPTY);
+    UNIT_CHECK(SIM_Peek(&CAN0->IMASK1) & (1UL << TEST_CAN_RX_MB));
+
+    /* Both mailbox interrupt lines enabled */
+    UNIT_CHECK(SIM_Peek(&NVIC->ISER[CAN0_ORed_0_15_MB_IRQn / 32]) & (1UL << (CAN0_ORed_0_15_MB_IRQn % 32)));
+    UNIT_CHECK(SIM_Peek(&NVIC->ISER[CAN0_ORed_16_31_MB_IRQn / 32]) & (1UL << (CAN0_ORed_16_31_MB_IRQn % 32)));
+}
+
+static void Test_SendIsTransmitted(void)
+{
+    can_srv_message_t msg = { .id = TEST_CAN_ID, .dlc = 4U, .data = { 0xDE, 0xAD, 0xBE, 0xEF } };
+    sim_can_frame_t frame;
+
+    UNIT_CHECK_EQ(CAN_SRV_Send(&msg), CAN_SRV_SUCCESS);
+
+    UNIT_CHECK(SIM_CanTakeTx(0U, &frame));
+    UNIT_CHECK_EQ(frame.id, TEST_CAN_ID);
+    UNIT_CHECK(!frame.ext);
+    UNIT_CHECK_EQ(frame.dlc, 4U);
+    UNIT_CHECK(memcmp(frame.data, msg.data, 4U) == 0);
+    UNIT_CHECK(!SIM_CanTakeTx(0U, &frame));
+}
+
+static void Test_LoopbackCompletesTxThenRx(void)
+{
+    s_event_count = 0;
+    Test_ServiceInterrupts();
+
+    UNIT_CHECK_EQ(s_event_count, 2U);
+    UNIT_CHECK_EQ(s_events[0], CAN_SRV_EVENT_TX_COMPLETE);
+    UNIT_CHECK_EQ(s_messages[0].id, TEST_CAN_ID);
+    UNIT_CHECK_EQ(s_events[1], CAN_SRV_EVENT_RX_COMPLETE);
+    UNIT_CHECK_EQ(s_messages[1].id, TEST_CAN_ID);
+    UNIT_CHECK_EQ(s_messages[1].dlc, 4U);
+    UNIT_CHECK_EQ(s_messages[1].data[0], 0xDEU);
+    UNIT_CHECK_EQ(s_messages[1].data[3], 0xEFU);
+    UNIT_CHECK(!s_messages[1].isExtended);
+
+    /* Flags cleared, receive mailbox re-armed */
+    UNIT_CHECK_EQ(SIM_Peek(&CAN0->IFLAG1), 0U);
+    UNIT_CHECK_EQ(SIM_Peek(&CAN0->RAMn[TEST_CAN_RX_MB * 4U]) >> CAN_CS_CODE_SHIFT, CAN_CS_CODE_RX_EMPTY);
+}
+
+static void Test_FilterRejectsOtherIds(void)
+{
+    sim_can_frame_t frame = { .id = TEST_CAN_ID + 1U, .dlc = 1U };
+
+    UNIT_CHECK(!SIM_CanInject(0U, &frame));
+    UNIT_CHECK_EQ(SIM_Peek(&CAN0->IFLAG1), 0U);
+
+    /* Same 11 bits as an extended ID: IDE is always compared */
+    frame.id = TEST_CAN_ID;
+    frame.ext = true;
+    UNIT_CHECK(!SIM_CanInject(0U, &frame));
+}
+
+static void Test_ExtendedFilter(void)
+{
+    sim_can_frame_t frame = { .id = TEST_CAN_EXT_ID, .ext = true, .dlc = 8U,
+                              .data = { 1, 2, 3, 4, 5, 6, 7, 8 } };
+
+    UNIT_CHECK_EQ(CAN_SRV_AddRxFilter(0x18FF0000U, 0x1FFF0000U, true), CAN_SRV_SUCCESS);
+    UNIT_CHECK(SIM_CanInject(0U, &frame));
+
+    s_event_count = 0;
+    Test_ServiceInterrupts();
+
+    UNIT_CHECK_EQ(s_event_count, 1U);
+    UNIT_CHECK_EQ(s_events[0], CAN_SRV_EVENT_RX_COMPLETE);
+    UNIT_CHECK(s_messages[0].isExtended);
+    UNIT_CHECK_EQ(s_messages[0].id, TEST_CAN_EXT_ID);
+    UNIT_CHECK_EQ(s_messages[0].dlc, 8U);
+    UNIT_CHECK_EQ(s_messages[0].data[7], 8U);
+}
+
+static void Test_FastReceive(void)
+{
+    sim_can_frame_t frame = { .id = TEST_CAN_ID, .dlc = 2U, .data = { 0x55, 0xAA } };
+    can_message_t msg;
+
+    UNIT_CHECK(!CAN0_FastReceive(TEST_CAN_RX_MB, &msg));
+    UNIT_CHECK(SIM_CanInject(0U, &frame));
+    UNIT_CHECK(CAN0_FastReceive(TEST_CAN_RX_MB, &msg));
+
+    UNIT_CHECK_EQ(msg.id, TEST_CAN_ID);
+    UNIT_CHECK_EQ(msg.idType, CAN_ID_STD);
+    UNIT_CHECK_EQ(msg.dataLength, 2U);
+    UNIT_CHECK_EQ(msg.data[1], 0xAAU);
+    UNIT_CHECK_EQ(SIM_Peek(&CAN0->IFLAG1) & (1UL << TEST_CAN_RX_MB), 0U);
+
+    /* FastReceive leaves re-arming to the caller */
+    SIM_Poke(&CAN0->RAMn[TEST_CAN_RX_MB * 4U], CAN_CS_CODE_RX_EMPTY << CAN_CS_CODE_SHIFT);
+}
+
+static void Test_TimerAdvances(void)
+{
+    uint16_t first;
+    uint16_t second;
+
+    UNIT_CHECK_EQ(CAN_SRV_GetTimer(&first), CAN_SRV_SUCCESS);
+    UNIT_CHECK_EQ(CAN_SRV_GetTimer(&second), CAN_SRV_SUCCESS);
+    UNIT_CHECK(second != first);
+}
+
+static void Test_SendRejectsBadLength(void)
+{
+    can_srv_message_t msg = { .id = TEST_CAN_ID, .dlc = 9U };
+    sim_can_frame_t frame;
+
+    UNIT_CHECK_EQ(CAN_SRV_Send(&msg), CAN_SRV_ERROR);
+    UNIT_CHECK_EQ(CAN_SRV_Send(NULL), CAN_SRV_ERROR);
+    UNIT_CHECK(!SIM_CanTakeTx(0U, &frame));
+}
+
+static void Test_SendReportsBusyMailbox(void)
+{
+    can_srv_message_t msg = { .id = TEST_CAN_ID, .dlc = 1U };
+    sim_can_frame_t frame;
+    uint32_t cs = SIM_Peek(&CAN0->RAMn[TEST_CAN_TX_MB * 4U]);
+
+    /* Previous frame still waiting for the bus */
+    SIM_Poke(&CAN0->RAMn[TEST_CAN_TX_MB * 4U], CAN_CS_CODE_TX_DATA << CAN_CS_CODE_SHIFT);
+    UNIT_CHECK_EQ(CAN_SRV_Send(&msg), CAN_SRV_BUSY);
+    UNIT_CHECK(!SIM_CanTakeTx(0U, &frame));
+
+    SIM_Poke(&CAN0->RAMn[TEST_CAN_TX_MB * 4U], cs);
+    UNIT_CHECK_EQ(CAN_SRV_Send(&msg), CAN_SRV_SUCCESS);
+    UNIT_CHECK(SIM_CanTakeTx(0U, &frame));
+    Test_ServiceInterrupts();
+}
+
+static void Test_DriverAssertsMailbox(void)
+{
+    can_message_t msg = { .id = TEST_CAN_ID, .dataLength = 1U };
+
+    /* Mailbox 3 is neither a TX nor an RX mailbox */
+    UNIT_EXPECT_ASSERT(CAN_Send(0U, 3U, &msg));
+    UNIT_EXPECT_ASSERT(CAN_Send(0U, CAN_RX_MB_START, &msg));
+}
+
+static const unit_case_t s_cases[] = {
+    { "init_loopback",             Test_InitLoopback },
+    { "send_is_transmitted",       Test_SendIsTransmitted },
+    { "loopback_tx_then_rx",       Test_LoopbackCompletesTxThenRx },
+    { "filter_rejects_other_ids",  Test_FilterRejectsOtherIds },
+    { "extended_filter",           Test_ExtendedFilter },
+    { "fast_receive",              Test_FastReceive },
+    { "timer_advances",            Test_TimerAdvances },
+    { "send_rejects_bad_length",   Test_SendRejectsBadLength },
+    { "send_reports_busy_mailbox", Test_SendReportsBusyMailbox },
+    { "driver_asserts_mailbox",    Test_DriverAssertsMailbox },
+};
+
+int main(void)
+{
+    SIM_Init();
+    return UNIT_Run("can", s_cases, UNIT_COUNT(s_cases));
+}
@@ -0,0 +1,242 @@
+/**
+ * @file    test_crc.c
+ * @brief   CRC driver and service: software table, CPU-fed and DMA-fed
+ *          peripheral against the simulated CRC engine and eDMA
+ */
+
+#include "unit.h"
+#include "sim.h"
+#include "crc_srv.h"
+#include "crc.h"
+#include "dma.h"
+#include "clock_srv.h"
+
+#include <string.h>
+
+#define TEST_CHECK_CRC32        (0xCBF43926U)   /* "123456789" */
+#define TEST_CHECK_CRC16        (0x29B1U)       /* CRC-16/CCITT-FALSE */
+#define TEST_BUF_SIZE           (1024U)
+#define TEST_DMA_LENGTH         (CRC_SRV_DMA_MIN_BYTES + 44U)
+
+static const uint8_t s_check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+static uint8_t *s_buf;              /* Below 4 GB, addressable by the eDMA */
+static uint8_t s_dma_channel;
+
+/**
+ * @brief Bitwise references, independent of the service tables
+ */
+static uint32_t Test_RefCrc32(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+
+    while (length-- > 0U) {
+        crc ^= *data++;
+        for (uint32_t bit = 0; bit < 8U; bit++) {
+            crc = (crc >> 1) ^ (((crc & 1U) != 0U) ? 0xEDB88320U : 0U);
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t Test_RefCrc16(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFU;
+
+    while (length-- > 0U) {
+        crc ^= (uint32_t)*data++ << 8;
+        for (uint32_t bit = 0; bit < 8U; bit++) {
+            crc = (((crc & 0x8000U) != 0U) ? ((crc << 1) ^ 0x1021U) : (crc << 1)) & 0xFFFFU;
+        }
+    }
+    return crc;
+}
+
+static uint32_t Test_Ref(crc_srv_algo_t algo, const uint8_t *data, uint32_t length)
+{
+    return (algo == CRC_SRV_CRC32) ? Test_RefCrc32(data, length) : Test_RefCrc16(data, length);
+}
+
+static uint32_t Test_Crc(crc_srv_algo_t algo, const uint8_t *data, uint32_t length, crc_srv_path_t path)
+{
+    crc_srv_ctx_t ctx;
+
+    CRC_SRV_Begin(&ctx, algo);
+    CRC_SRV_UpdatePath(&ctx, data, length, path);
+    return CRC_SRV_Finish(&ctx);
+}
+
+/**
+ * @brief Every path and both algorithms agree with the reference
+ */
+static void Test_AllPaths(const uint8_t *data, uint32_t length)
+{
+    for (uint32_t algo = 0; algo < CRC_SRV_ALGO_COUNT; algo++) {
+        uint32_t expected = Test_Ref((crc_srv_algo_t)algo, data, length);
+
+        UNIT_CHECK_EQ(Test_Crc((crc_srv_algo_t)algo, data, length, CRC_SRV_PATH_SW), expected);
+        UNIT_CHECK_EQ(Test_Crc((crc_srv_algo_t)algo, data, length, CRC_SRV_PATH_HW), expected);
+        UNIT_CHECK_EQ(Test_Crc((crc_srv_algo_t)algo, data, length, CRC_SRV_PATH_DMA), expected);
+    }
+}
+
+/**
+ * @brief Path picked by CRC_SRV_Update() for a length
+ * @details The software path leaves CTRL alone, the DMA path moves the
+ *          source address of the channel's TCD.
+ */
+static crc_srv_path_t Test_AutoPath(uint32_t length)
+{
+    crc_srv_ctx_t ctx;
+
+    SIM_Poke(&CRC->CTRL, 0U);
+    SIM_Poke(&DMA->TCD[s_dma_channel].SADDR, 0U);
+
+    CRC_SRV_Begin(&ctx, CRC_SRV_CRC32);
+    CRC_SRV_Update(&ctx, s_buf, length);
+    UNIT_CHECK_EQ(CRC_SRV_Finish(&ctx), Test_RefCrc32(s_buf, length));
+
+    if (SIM_Peek(&DMA->TCD[s_dma_channel].SADDR) != 0U) {
+        return CRC_SRV_PATH_DMA;
+    }
+    return (SIM_Peek(&CRC->CTRL) != 0U) ? CRC_SRV_PATH_HW : CRC_SRV_PATH_SW;
+}
+
+static void Test_SoftwareBeforeInit(void)
+{
+    UNIT_CHECK_EQ(Test_RefCrc32(s_check, sizeof(s_check)), TEST_CHECK_CRC32);
+    UNIT_CHECK_EQ(Test_RefCrc16(s_check, sizeof(s_check)), TEST_CHECK_CRC16);
+
+    UNIT_CHECK_EQ(CRC_SRV_Compute(CRC_SRV_CRC32, s_check, sizeof(s_check)), TEST_CHECK_CRC32);
+    UNIT_CHECK_EQ(CRC_SRV_Compute(CRC_SRV_CRC16_CCITT, s_check, sizeof(s_check)), TEST_CHECK_CRC16);
+
+    /* Peripheral paths fall back to software */
+    UNIT_CHECK_EQ(Test_Crc(CRC_SRV_CRC32, s_check, sizeof(s_check), CRC_SRV_PATH_HW), TEST_CHECK_CRC32);
+    UNIT_CHECK_EQ(SIM_Peek(&CRC->CTRL), 0U);
+}
+
+static void Test_Init(void)
+{
+    uint8_t chcfg = 0U;
+
+    UNIT_CHECK_EQ(CLOCK_SRV_InitPreset(RUN_80MHz), CLOCK_SRV_SUCCESS);
+    UNIT_CHECK_EQ(CRC_SRV_Init(), CRC_SRV_SUCCESS);
+
+    /* The channel res_srv handed out, routed to an always-on request */
+    for (s_dma_channel = 0; s_dma_channel < 16U; s_dma_channel++) {
+        chcfg = DMAMUX->CHCFG[DMAMUX_CHCFG_IDX(s_dma_channel)];
+        if ((chcfg & DMAMUX_CHCFG_ENBL_MASK) != 0U) {
+            break;
+        }
+    }
+    UNIT_CHECK(s_dma_channel < 16U);
+    UNIT_CHECK_EQ(chcfg & DMAMUX_CHCFG_SOURCE_MASK, DMA_REQ_ALWAYS_ON0);
+}
+
+static void Test_CheckValues(void)
+{
+    static const crc_srv_path_t paths[] = { CRC_SRV_PATH_SW, CRC_SRV_PATH_HW, CRC_SRV_PATH_DMA };
+
+    for (uint32_t i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        UNIT_CHECK_EQ(Test_Crc(CRC_SRV_CRC32, s_check, sizeof(s_check), paths[i]), TEST_CHECK_CRC32);
+        UNIT_CHECK_EQ(Test_Crc(CRC_SRV_CRC16_CCITT, s_check, sizeof(s_check), paths[i]), TEST_CHECK_CRC16);
+    }
+}
+
+/* Head and tail bytes go through DATA_8.LL, the body through DATA */
+static void Test_UnalignedLengths(void)
+{
+    static const uint32_t lengths[] = { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U };
+
+    for (uint32_t offset = 0; offset < 4U; offset++) {
+        for (uint32_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+            Test_AllPaths(&s_buf[offset], lengths[i]);
+        }
+    }
+}
+
+static void Test_DmaTransfers(void)
+{
+    static const uint32_t tails[] = { 0U, 1U, 2U, 3U, 5U, 6U, 7U };
+
+    for (uint32_t offset = 0; offset < 4U; offset++) {
+        for (uint32_t i = 0; i < sizeof(tails) / sizeof(tails[0]); i++) {
+            SIM_Poke(&DMA->TCD[s_dma_channel].SADDR, 0U);
+            Test_AllPaths(&s_buf[offset], TEST_DMA_LENGTH + tails[i]);
+            UNIT_CHECK(SIM_Peek(&DMA->TCD[s_dma_channel].SADDR) != 0U);
+        }
+    }
+}
+
+static void Test_ContextAcrossPaths(void)
+{
+    crc_srv_ctx_t ctx;
+
+    /* One context continued on each engine in turn */
+    CRC_SRV_Begin(&ctx, CRC_SRV_CRC32);
+    CRC_SRV_UpdatePath(&ctx, &s_buf[0], 5U, CRC_SRV_PATH_SW);
+    CRC_SRV_UpdatePath(&ctx, &s_buf[5], 300U, CRC_SRV_PATH_DMA);
+    CRC_SRV_UpdatePath(&ctx, &s_buf[305], 7U, CRC_SRV_PATH_HW);
+    CRC_SRV_UpdatePath(&ctx, &s_buf[312], 3U, CRC_SRV_PATH_SW);
+    UNIT_CHECK_EQ(CRC_SRV_Finish(&ctx), Test_RefCrc32(s_buf, 315U));
+
+    CRC_SRV_Begin(&ctx, CRC_SRV_CRC16_CCITT);
+    CRC_SRV_UpdatePath(&ctx, &s_buf[0], 7U, CRC_SRV_PATH_HW);
+    CRC_SRV_UpdatePath(&ctx, &s_buf[7], 298U, CRC_SRV_PATH_DMA);
+    CRC_SRV_UpdatePath(&ctx, &s_buf[305], 10U, CRC_SRV_PATH_SW);
+    UNIT_CHECK_EQ(CRC_SRV_Finish(&ctx), Test_RefCrc16(s_buf, 315U));
+}
+
+static void Test_Thresholds(void)
+{
+    /* Defaults: SW up to 12 bytes, DMA from 256 */
+    UNIT_CHECK_EQ(Test_AutoPath(CRC_SRV_SW_MAX_BYTES), CRC_SRV_PATH_SW);
+    UNIT_CHECK_EQ(Test_AutoPath(CRC_SRV_SW_MAX_BYTES + 1U), CRC_SRV_PATH_HW);
+    UNIT_CHECK_EQ(Test_AutoPath(CRC_SRV_DMA_MIN_BYTES - 1U), CRC_SRV_PATH_HW);
+    UNIT_CHECK_EQ(Test_AutoPath(CRC_SRV_DMA_MIN_BYTES), CRC_SRV_PATH_DMA);
+
+    CRC_SRV_SetThresholds(4U, 128U);
+    UNIT_CHECK_EQ(Test_AutoPath(4U), CRC_SRV_PATH_SW);
+    UNIT_CHECK_EQ(Test_AutoPath(5U), CRC_SRV_PATH_HW);
+    UNIT_CHECK_EQ(Test_AutoPath(127U), CRC_SRV_PATH_HW);
+    UNIT_CHECK_EQ(Test_AutoPath(128U), CRC_SRV_PATH_DMA);
+
+    CRC_SRV_SetThresholds(CRC_SRV_SW_MAX_BYTES, CRC_SRV_DMA_MIN_BYTES);
+}
+
+static void Test_Async(void)
+{
+    uint32_t result = 0U;
+
+    UNIT_CHECK_EQ(CRC_SRV_ComputeAsync(CRC_SRV_CRC32, &s_buf[1], TEST_DMA_LENGTH + 3U), CRC_SRV_SUCCESS);
+    UNIT_CHECK_EQ(CRC_SRV_ComputeAsync(CRC_SRV_CRC32, s_buf, 16U), CRC_SRV_BUSY);
+
+    /* Peripheral owned by the async computation: Update falls back to software */
+    UNIT_CHECK_EQ(Test_Crc(CRC_SRV_CRC16_CCITT, s_check, sizeof(s_check), CRC_SRV_PATH_HW), TEST_CHECK_CRC16);
+
+    UNIT_CHECK_EQ(CRC_SRV_Poll(&result), CRC_SRV_SUCCESS);
+    UNIT_CHECK_EQ(result, Test_RefCrc32(&s_buf[1], TEST_DMA_LENGTH + 3U));
+    UNIT_CHECK_EQ(CRC_SRV_Poll(&result), CRC_SRV_ERROR);
+}
+
+static const unit_case_t s_cases[] = {
+    { "software_before_init",  Test_SoftwareBeforeInit },
+    { "init",                  Test_Init },
+    { "check_values",          Test_CheckValues },
+    { "unaligned_lengths",     Test_UnalignedLengths },
+    { "dma_transfers",         Test_DmaTransfers },
+    { "context_across_paths",  Test_ContextAcrossPaths },
+    { "thresholds",            Test_Thresholds },
+    { "async",                 Test_Async },
+};
+
+int main(void)
+{
+    SIM_Init();
+
+    s_buf = SIM_DmaAlloc(TEST_BUF_SIZE);
+    for (uint32_t i = 0; i < TEST_BUF_SIZE; i++) {
+        s_buf[i] = (uint8_t)((i * 131U) ^ (i >> 3));
+    }
+
+    return UNIT_Run("crc", s_cases, UNIT_COUNT(s_cases));
+}
@@ -0,0 +1,164 @@
+/**
+ * @file    test_gpio.c
+ * @brief   GPIO/PORT drivers and GPIO service against the simulated PTx/PORTx
+ */
+
+#include "unit.h"
+#include "sim.h"
+#include "gpio_srv.h"
+#include "gpio_fast.h"
+#include "port.h"
+
+#define TEST_PORT_D             (3U)
+#define TEST_PORT_C             (2U)
+#define TEST_OUT_PIN            (0U)        /* PTD0 */
+#define TEST_IN_PIN             (1U)        /* PTD1 */
+#define TEST_IRQ_PIN            (12U)       /* PTC12 */
+#define TEST_IRQ_PIN2           (13U)       /* PTC13 */
+
+static uint8_t s_cb_port;
+static uint8_t s_cb_pin;
+static uint32_t s_cb_count;
+
+static void Test_Callback(uint8_t port, uint8_t pin)
+{
+    s_cb_port = port;
+    s_cb_pin = pin;
+    s_cb_count++;
+}
+
+static void Test_Config(void)
+{
+    UNIT_CHECK_EQ(GPIO_SRV_ConfigOutput(TEST_PORT_D, TEST_OUT_PIN), GPIO_SRV_NOT_INITIALIZED);
+    UNIT_CHECK_EQ(GPIO_SRV_Write(TEST_PORT_D, TEST_OUT_PIN, 1U), GPIO_SRV_NOT_INITIALIZED);
+    UNIT_CHECK_EQ(GPIO_SRV_Toggle(TEST_PORT_D, TEST_OUT_PIN), GPIO_SRV_NOT_INITIALIZED);
+    UNIT_CHECK_EQ(GPIO_SRV_Init(), GPIO_SRV_SUCCESS);
+
+    UNIT_CHECK_EQ(GPIO_SRV_ConfigOutput(TEST_PORT_D, TEST_OUT_PIN), GPIO_SRV_SUCCESS);
+    UNIT_CHECK_EQ(GPIO_SRV_ConfigInput(TEST_PORT_D, TEST_IN_PIN), GPIO_SRV_SUCCESS);
+    UNIT_CHECK_EQ(GPIO_SRV_ConfigOutput(5U, TEST_OUT_PIN), GPIO_SRV_ERROR);
+
+    UNIT_CHECK_EQ(SIM_Peek(&PTD->PDDR) & 0x3U, 1UL << TEST_OUT_PIN);
+}
+
+static void Test_WriteAndToggle(void)
+{
+    UNIT_CHECK_EQ(GPIO_SRV_Write(TEST_PORT_D, TEST_OUT_PIN, 1U), GPIO_SRV_SUCCESS);
+    UNIT_CHECK(SIM_Peek(&PTD->PDOR) & (1UL << TEST_OUT_PIN));
+    UNIT_CHECK_EQ(SIM_Peek(&PTD->PSOR), 0U);
+    UNIT_CHECK_EQ(GPIO_SRV_Read(TEST_PORT_D, TEST_OUT_PIN), 1U);
+
+    UNIT_CHECK_EQ(GPIO_SRV_Toggle(TEST_PORT_D, TEST_OUT_PIN), GPIO_SRV_SUCCESS);
+    UNIT_CHECK_EQ(GPIO_SRV_Read(TEST_PORT_D, TEST_OUT_PIN), 0U);
+    UNIT_CHECK_EQ(GPIO_SRV_Toggle(TEST_PORT_D, TEST_OUT_PIN), GPIO_SRV_SUCCESS);
+    UNIT_CHECK_EQ(GPIO_SRV_Read(TEST_PORT_D, TEST_OUT_PIN), 1U);
+
+    UNIT_CHECK_EQ(GPIO_SRV_Write(TEST_PORT_D, TEST_OUT_PIN, 0U), GPIO_SRV_SUCCESS);
+    UNIT_CHECK_EQ(SIM_Peek(&PTD->PDOR) & (1UL << TEST_OUT_PIN), 0U);
+    UNIT_CHECK_EQ(SIM_Peek(&PTD->PCOR), 0U);
+}
+
+static void Test_ReadInput(void)
+{
+    SIM_GpioSetInput(TEST_PORT_D, TEST_IN_PIN, true);
+    UNIT_CHECK_EQ(GPIO_SRV_Read(TEST_PORT_D, TEST_IN_PIN), 1U);
+    SIM_GpioSetInput(TEST_PORT_D, TEST_IN_PIN, false);
+    UNIT_CHECK_EQ(GPIO_SRV_Read(TEST_PORT_D, TEST_IN_PIN), 0U);
+
+    /* An output pin reads back what it drives, not the input level */
+    SIM_GpioSetInput(TEST_PORT_D, TEST_OUT_PIN, true);
+    UNIT_CHECK_EQ(GPIO_SRV_Read(TEST_PORT_D, TEST_OUT_PIN), 0U);
+}
+
+static void Test_FastPaths(void)
+{
+    PTD_FastSet(TEST_OUT_PIN);
+    UNIT_CHECK_EQ(PTD_FastRead(TEST_OUT_PIN), 1U);
+    PTD_FastToggle(TEST_OUT_PIN);
+    UNIT_CHECK_EQ(PTD_FastRead(TEST_OUT_PIN), 0U);
+    PTD_FastWrite(TEST_OUT_PIN, 1U);
+    UNIT_CHECK_EQ(PTD_FastRead(TEST_OUT_PIN), 1U);
+    PTD_FastClear(TEST_OUT_PIN);
+    UNIT_CHECK_EQ(PTD_FastRead(TEST_OUT_PIN), 0U);
+}
+
+static void Test_PinInterrupt(void)
+{
+    UNIT_CHECK(!SIM_PortRaise(TEST_PORT_C, TEST_IRQ_PIN));     /* IRQC still 0 */
+
+    UNIT_CHECK_EQ(GPIO_SRV_EnableInterrupt(TEST_PORT_C, TEST_IRQ_PIN, GPIO_SRV_INT_FALLING_EDGE, Test_Callback),
+                  GPIO_SRV_SUCCESS);
+    UNIT_CHECK_EQ((SIM_Peek(&PORTC->PCR[TEST_IRQ_PIN]) & PORT_PCR_IRQC_MASK) >> PORT_PCR_IRQC_SHIFT,
+                  PORT_INTERRUPT_FALL_EDGE);
+
+    UNIT_CHECK(!GPIO_SRV_IsInterruptPending(TEST_PORT_C, TEST_IRQ_PIN));
+    UNIT_CHECK(SIM_PortRaise(TEST_PORT_C, TEST_IRQ_PIN));
+    UNIT_CHECK(GPIO_SRV_IsInterruptPending(TEST_PORT_C, TEST_IRQ_PIN));
+
+    s_cb_count = 0;
+    GPIO_SRV_PORTC_IRQHandler();
+
+    UNIT_CHECK_EQ(s_cb_count, 1U);
+    UNIT_CHECK_EQ(s_cb_port, TEST_PORT_C);
+    UNIT_CHECK_EQ(s_cb_pin, TEST_IRQ_PIN);
+    UNIT_CHECK(!GPIO_SRV_IsInterruptPending(TEST_PORT_C, TEST_IRQ_PIN));
+    UNIT_CHECK_EQ(SIM_Peek(&PORTC->PCR[TEST_IRQ_PIN]) & PORT_PCR_ISF_MASK, 0U);
+}
+
+static void Test_TwoPinsPending(void)
+{
+    UNIT_CHECK_EQ(GPIO_SRV_EnableInterrupt(TEST_PORT_C, TEST_IRQ_PIN2, GPIO_SRV_INT_RISING_EDGE, Test_Callback),
+                  GPIO_SRV_SUCCESS);
+    UNIT_CHECK(SIM_PortRaise(TEST_PORT_C, TEST_IRQ_PIN));
+    UNIT_CHECK(SIM_PortRaise(TEST_PORT_C, TEST_IRQ_PIN2));
+
+    /* Clearing the first flag must not drop the second */
+    UNIT_CHECK_EQ(GPIO_SRV_ClearInterrupt(TEST_PORT_C, TEST_IRQ_PIN), GPIO_SRV_SUCCESS);
+    UNIT_CHECK(GPIO_SRV_IsInterruptPending(TEST_PORT_C, TEST_IRQ_PIN2));
+
+    UNIT_CHECK(SIM_PortRaise(TEST_PORT_C, TEST_IRQ_PIN));
+    s_cb_count = 0;
+    GPIO_SRV_PORTC_IRQHandler();
+
+    UNIT_CHECK_EQ(s_cb_count, 2U);
+    UNIT_CHECK_EQ(s_cb_pin, TEST_IRQ_PIN2);
+    UNIT_CHECK_EQ(SIM_Peek(&PORTC->ISFR), 0U);
+    UNIT_CHECK_EQ(GPIO_SRV_DisableInterrupt(TEST_PORT_C, TEST_IRQ_PIN2), GPIO_SRV_SUCCESS);
+}
+
+static void Test_DisableInterrupt(void)
+{
+    UNIT_CHECK_EQ(GPIO_SRV_DisableInterrupt(TEST_PORT_C, TEST_IRQ_PIN), GPIO_SRV_SUCCESS);
+    UNIT_CHECK_EQ(SIM_Peek(&PORTC->PCR[TEST_IRQ_PIN]) & PORT_PCR_IRQC_MASK, 0U);
+    UNIT_CHECK(!SIM_PortRaise(TEST_PORT_C, TEST_IRQ_PIN));
+    UNIT_CHECK_EQ(GPIO_SRV_EnableInterrupt(TEST_PORT_C, 32U, GPIO_SRV_INT_RISING_EDGE, Test_Callback),
+                  GPIO_SRV_ERROR);
+}
+
+static void Test_RejectsBadArguments(void)
+{
+    UNIT_CHECK_EQ(GPIO_SRV_Write(5U, TEST_OUT_PIN, 1U), GPIO_SRV_ERROR);
+    UNIT_CHECK_EQ(GPIO_SRV_Toggle(5U, TEST_OUT_PIN), GPIO_SRV_ERROR);
+    UNIT_CHECK_EQ(GPIO_SRV_Read(5U, TEST_OUT_PIN), 0U);
+
+    UNIT_CHECK_EQ(GPIO_SRV_Write(TEST_PORT_D, 32U, 1U), GPIO_SRV_ERROR);
+    UNIT_CHECK_EQ(GPIO_SRV_Toggle(TEST_PORT_D, 32U), GPIO_SRV_ERROR);
+    UNIT_CHECK_EQ(GPIO_SRV_Read(TEST_PORT_D, 32U), 0U);
+}
+
+static const unit_case_t s_cases[] = {
+    { "config",                Test_Config },
+    { "write_and_toggle",      Test_WriteAndToggle },
+    { "read_input",            Test_ReadInput },
+    { "fast_paths",            Test_FastPaths },
+    { "pin_interrupt",         Test_PinInterrupt },
+    { "two_pins_pending",      Test_TwoPinsPending },
+    { "disable_interrupt",     Test_DisableInterrupt },
+    { "rejects_bad_arguments", Test_RejectsBadArguments },
+};
+
+int main(void)
+{
+    SIM_Init();
+    return UNIT_Run("gpio", s_cases, UNIT_COUNT(s_cases));
+}
@@ -0,0 +1,139 @@
+/**
+ * @file    test_lpit.c
+ * @brief   LPIT driver and service against the simulated LPIT0
+ */
+
+#include "unit.h"
+#include "sim.h"
+#include "lpit_srv.h"
+#include "lpit.h"
+#include "pcc.h"
+#include "nvic.h"
+
+#define TEST_LPIT_TICKS_PER_US  (24U)       /* FIRCDIV2 */
+
+/* Channel handlers live in lpit_srv.c and have no header */
+void LPIT0_Ch0_IRQHandler(void);
+void LPIT0_Ch1_IRQHandler(void);
+
+static lpit_srv_config_t s_timer0 = { .channel = 0U, .period_us = 1000U };
+static lpit_srv_config_t s_timer1 = { .channel = 1U, .period_us = 2000U };
+static uint32_t s_ticks0;
+static uint32_t s_ticks1;
+
+static void Test_Tick0(void)
+{
+    s_ticks0++;
+}
+
+static void Test_Tick1(void)
+{
+    s_ticks1++;
+}
+
+static void Test_Config(void)
+{
+    uint32_t pcc;
+
+    UNIT_CHECK_EQ(LPIT_SRV_Config(&s_timer0, Test_Tick0), LPIT_SRV_NOT_INITIALIZED);
+    UNIT_CHECK_EQ(LPIT_SRV_Init(), LPIT_SRV_SUCCESS);
+    UNIT_CHECK_EQ(LPIT_SRV_Config(&s_timer0, Test_Tick0), LPIT_SRV_SUCCESS);
+    UNIT_CHECK(!s_timer0.is_running);
+
+    /* One period is TVAL + 1 ticks */
+    UNIT_CHECK_EQ(SIM_Peek(&LPIT0->TMR[0].TVAL), 1000U * TEST_LPIT_TICKS_PER_US - 1U);
+
+    pcc = SIM_Peek(&PCC->PCCn[PCC_LPIT_INDEX]);
+    UNIT_CHECK(pcc & PCC_PCCn_CGC_MASK);
+    UNIT_CHECK_EQ((pcc & PCC_PCCn_PCS_MASK) >> PCC_PCCn_PCS_SHIFT, LPIT_FIRCDIV2_CLK_SOURCE);
+    UNIT_CHECK(SIM_Peek(&LPIT0->MCR) & LPIT_MCR_M_CEN_MASK);
+    UNIT_CHECK(SIM_Peek(&NVIC->ISER[LPIT0_Ch0_IRQn / 32]) & (1UL << (LPIT0_Ch0_IRQn % 32)));
+}
+
+static void Test_Start(void)
+{
+    UNIT_CHECK_EQ(LPIT_SRV_Start(&s_timer0), LPIT_SRV_SUCCESS);
+    UNIT_CHECK(s_timer0.is_running);
+    UNIT_CHECK(SIM_Peek(&LPIT0->MIER) & LPIT_MIER_TIE0_MASK);
+    UNIT_CHECK(SIM_Peek(&LPIT0->TMR[0].TCTRL) & LPIT_TMR_TCTRL_T_EN_MASK);
+}
+
+static void Test_TimeoutRunsCallback(void)
+{
+    s_ticks0 = 0;
+    UNIT_CHECK(SIM_LpitExpire(0U));
+    UNIT_CHECK(SIM_Peek(&LPIT0->MSR) & LPIT_MSR_TIF0_MASK);
+
+    LPIT0_Ch0_IRQHandler();
+
+    UNIT_CHECK_EQ(s_ticks0, 1U);
+    UNIT_CHECK_EQ(SIM_Peek(&LPIT0->MSR) & LPIT_MSR_TIF0_MASK, 0U);
+}
+
+static void Test_ClearKeepsOtherFlags(void)
+{
+    UNIT_CHECK_EQ(LPIT_SRV_Config(&s_timer1, Test_Tick1), LPIT_SRV_SUCCESS);
+    UNIT_CHECK_EQ(LPIT_SRV_Start(&s_timer1), LPIT_SRV_SUCCESS);
+
+    s_ticks0 = 0;
+    s_ticks1 = 0;
+    UNIT_CHECK(SIM_LpitExpire(0U));
+    UNIT_CHECK(SIM_LpitExpire(1U));
+
+    LPIT0_Ch0_IRQHandler();
+    UNIT_CHECK_EQ(SIM_Peek(&LPIT0->MSR), LPIT_MSR_TIF1_MASK);
+
+    LPIT0_Ch1_IRQHandler();
+    UNIT_CHECK_EQ(SIM_Peek(&LPIT0->MSR), 0U);
+    UNIT_CHECK_EQ(s_ticks0, 1U);
+    UNIT_CHECK_EQ(s_ticks1, 1U);
+}
+
+static void Test_Stop(void)
+{
+    UNIT_CHECK_EQ(LPIT_SRV_Stop(&s_timer1), LPIT_SRV_SUCCESS);
+    UNIT_CHECK(!s_timer1.is_running);
+    UNIT_CHECK_EQ(SIM_Peek(&LPIT0->TMR[1].TCTRL) & LPIT_TMR_TCTRL_T_EN_MASK, 0U);
+    UNIT_CHECK_EQ(SIM_Peek(&LPIT0->MIER) & LPIT_MIER_TIE1_MASK, 0U);
+    UNIT_CHECK(!SIM_LpitExpire(1U));
+
+    /* Channel 0 keeps running */
+    UNIT_CHECK(SIM_Peek(&LPIT0->TMR[0].TCTRL) & LPIT_TMR_TCTRL_T_EN_MASK);
+}
+
+static void Test_SetPeriod(void)
+{
+    UNIT_CHECK_EQ(LPIT_SRV_SetPeriod(&s_timer0, 500U), LPIT_SRV_SUCCESS);
+    UNIT_CHECK_EQ(s_timer0.period_us, 500U);
+    UNIT_CHECK_EQ(SIM_Peek(&LPIT0->TMR[0].TVAL), 500U * TEST_LPIT_TICKS_PER_US - 1U);
+}
+
+static void Test_RejectsBadArguments(void)
+{
+    lpit_srv_config_t bad = { .channel = 4U, .period_us = 1000U };
+
+    UNIT_CHECK_EQ(LPIT_SRV_Config(&bad, Test_Tick0), LPIT_SRV_ERROR);
+    UNIT_CHECK_EQ(LPIT_SRV_Start(&bad), LPIT_SRV_ERROR);
+    UNIT_CHECK_EQ(LPIT_SRV_Config(NULL, Test_Tick0), LPIT_SRV_ERROR);
+
+    /* Zero, and more than 2^32 ticks */
+    UNIT_CHECK_EQ(LPIT_SRV_SetPeriod(&s_timer0, 0U), LPIT_SRV_ERROR);
+    UNIT_CHECK_EQ(LPIT_SRV_SetPeriod(&s_timer0, 0xFFFFFFFFU / TEST_LPIT_TICKS_PER_US + 1U), LPIT_SRV_ERROR);
+    UNIT_CHECK_EQ(s_timer0.period_us, 500U);
+}
+
+static const unit_case_t s_cases[] = {
+    { "config",                    Test_Config },
+    { "start",                     Test_Start },
+    { "timeout_runs_callback",     Test_TimeoutRunsCallback },
+    { "clear_keeps_other_flags",   Test_ClearKeepsOtherFlags },
+    { "stop",                      Test_Stop },
+    { "set_period",                Test_SetPeriod },
+    { "rejects_bad_arguments",     Test_RejectsBadArguments },
+};
+
+int main(void)
+{
+    SIM_Init();
+    return UNIT_Run("lpit", s_cases, UNIT_COUNT(s_cases));
+}
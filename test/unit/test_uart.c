@@ -0,0 +1,143 @@
+/**
+ * @file    test_uart.c
+ * @brief   LPUART driver and service against the simulated LPUART1
+ */
+
+#include "unit.h"
+#include "sim.h"
+#include "uart_srv.h"
+#include "uart.h"
+#include "uart_fast.h"
+#include "clock_srv.h"
+#include "port.h"
+
+#include <string.h>
+
+#define TEST_UART               (UART_SRV_INSTANCE_1)
+#define TEST_UART_BAUD          (115200U)
+#define TEST_UART_CLOCK_HZ      (8000000U)      /* SOSCDIV2 after the RUN_80MHz preset */
+
+/**
+ * @brief Collect what the transmitter sent
+ */
+static uint32_t Test_TakeTx(char *out, uint32_t size)
+{
+    uint32_t count = 0;
+    uint8_t byte;
+
+    while (count + 1U < size && SIM_UartTakeTx(1U, &byte)) {
+        out[count++] = (char)byte;
+    }
+    out[count] = '\0';
+    return count;
+}
+
+static void Test_InitNeedsClock(void)
+{
+    UNIT_CHECK_EQ(UART_SRV_Init(TEST_UART, TEST_UART_BAUD), UART_SRV_ERROR);
+    UNIT_CHECK_EQ(UART_SRV_SendByte(TEST_UART, 'x'), UART_SRV_NOT_INITIALIZED);
+}
+
+static void Test_Init(void)
+{
+    uint32_t baud;
+    uint32_t osr;
+    uint32_t sbr;
+    uint32_t actual;
+
+    UNIT_CHECK_EQ(CLOCK_SRV_InitPreset(RUN_80MHz), CLOCK_SRV_SUCCESS);
+    UNIT_CHECK_EQ(CLOCK_SRV_EnablePeripheral(CLOCK_SRV_LPUART1, CLOCK_SRV_PCS_SOSCDIV2), CLOCK_SRV_SUCCESS);
+    UNIT_CHECK_EQ(UART_SRV_Init(TEST_UART, TEST_UART_BAUD), UART_SRV_SUCCESS);
+
+    /* Baud rate within 2 % of the request */
+    baud = SIM_Peek(&LPUART1->BAUD);
+    osr = ((baud & LPUART_BAUD_OSR_MASK) >> LPUART_BAUD_OSR_SHIFT) + 1U;
+    sbr = (baud & LPUART_BAUD_SBR_MASK) >> LPUART_BAUD_SBR_SHIFT;
+    UNIT_CHECK(sbr != 0U);
+    actual = TEST_UART_CLOCK_HZ / (osr * sbr);
+    UNIT_CHECK(actual * 50U > TEST_UART_BAUD * 49U && actual * 50U < TEST_UART_BAUD * 51U);
+
+    /* PTC6/PTC7 on ALT2, transmitter and receiver on */
+    UNIT_CHECK_EQ((SIM_Peek(&PORTC->PCR[6]) & PORT_PCR_MUX_MASK) >> PORT_PCR_MUX_SHIFT, 2U);
+    UNIT_CHECK_EQ((SIM_Peek(&PORTC->PCR[7]) & PORT_PCR_MUX_MASK) >> PORT_PCR_MUX_SHIFT, 2U);
+    UNIT_CHECK_EQ(SIM_Peek(&LPUART1->CTRL) & (LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK),
+                  LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+
+    /* A second call is a no-op */
+    UNIT_CHECK_EQ(UART_SRV_Init(TEST_UART, TEST_UART_BAUD), UART_SRV_SUCCESS);
+}
+
+static void Test_SendByte(void)
+{
+    char out[8];
+
+    UNIT_CHECK_EQ(UART_SRV_SendByte(TEST_UART, 'A'), UART_SRV_SUCCESS);
+    UNIT_CHECK_EQ(Test_TakeTx(out, sizeof(out)), 1U);
+    UNIT_CHECK_EQ(out[0], 'A');
+}
+
+static void Test_SendStringAndPrintf(void)
+{
+    char out[32];
+
+    UNIT_CHECK_EQ(UART_SRV_SendString(TEST_UART, "hello"), UART_SRV_SUCCESS);
+    UNIT_CHECK_EQ(UART_SRV_Printf(TEST_UART, " %u-%s", 42U, "ok"), UART_SRV_SUCCESS);
+    Test_TakeTx(out, sizeof(out));
+    UNIT_CHECK(strcmp(out, "hello 42-ok") == 0);
+}
+
+static void Test_ReceiveByte(void)
+{
+    uint8_t data = 0;
+
+    SIM_UartPushRx(1U, 0x5AU);
+    SIM_UartPushRx(1U, 0xA5U);
+
+    UNIT_CHECK_EQ(UART_SRV_ReceiveByte(TEST_UART, &data), UART_SRV_SUCCESS);
+    UNIT_CHECK_EQ(data, 0x5AU);
+    UNIT_CHECK(SIM_Peek(&LPUART1->STAT) & LPUART_STAT_RDRF_MASK);
+    UNIT_CHECK_EQ(UART_SRV_ReceiveByte(TEST_UART, &data), UART_SRV_SUCCESS);
+    UNIT_CHECK_EQ(data, 0xA5U);
+    UNIT_CHECK_EQ(SIM_Peek(&LPUART1->STAT) & LPUART_STAT_RDRF_MASK, 0U);
+}
+
+static void Test_FastPaths(void)
+{
+    uint8_t data = 0;
+    char out[8];
+
+    UNIT_CHECK(!LPUART1_FastTryGetByte(&data));
+    SIM_UartPushRx(1U, 'z');
+    UNIT_CHECK(LPUART1_FastTryGetByte(&data));
+    UNIT_CHECK_EQ(data, 'z');
+
+    LPUART1_FastWrite((const uint8_t *)"abc", 3U);
+    UNIT_CHECK_EQ(Test_TakeTx(out, sizeof(out)), 3U);
+    UNIT_CHECK(strcmp(out, "abc") == 0);
+}
+
+static void Test_RejectsBadArguments(void)
+{
+    UNIT_CHECK_EQ(UART_SRV_SendByte(UART_SRV_INSTANCE_2, 'x'), UART_SRV_NOT_INITIALIZED);
+    UNIT_CHECK_EQ(UART_SRV_ReceiveByte(TEST_UART, NULL), UART_SRV_ERROR);
+    UNIT_CHECK_EQ(UART_SRV_Init(TEST_UART, 0U), UART_SRV_INVALID_BAUDRATE);
+
+    UNIT_EXPECT_ASSERT(UART_SendByte(NULL, 'x'));
+    UNIT_EXPECT_ASSERT(UART_ReceiveByte(LPUART1, NULL));
+}
+
+static const unit_case_t s_cases[] = {
+    { "init_needs_clock",          Test_InitNeedsClock },
+    { "init",                      Test_Init },
+    { "send_byte",                 Test_SendByte },
+    { "send_string_and_printf",    Test_SendStringAndPrintf },
+    { "receive_byte",              Test_ReceiveByte },
+    { "fast_paths",                Test_FastPaths },
+    { "rejects_bad_arguments",     Test_RejectsBadArguments },
+};
+
+int main(void)
+{
+    SIM_Init();
+    return UNIT_Run("uart", s_cases, UNIT_COUNT(s_cases));
+}
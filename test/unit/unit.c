@@ -0,0 +1,85 @@
+/**
+ * @file    unit.c
+ * @brief   Minimal unit test runner for the host build
+ */
+
+#include "unit.h"
+#include "sim.h"
+#include "sim_assert.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static jmp_buf s_case_env;
+static jmp_buf s_assert_env;
+static bool s_assert_armed;
+static bool s_assert_fired;
+
+void UNIT_Fail(const char *file, int line, const char *expr)
+{
+    printf("    %s:%d: check failed: %s\n", file, line, expr);
+    longjmp(s_case_env, 1);
+}
+
+void UNIT_FailValues(const char *file, int line, const char *expr,
+                     unsigned long long actual, unsigned long long expected)
+{
+    printf("    %s:%d: %s is 0x%llx, expected 0x%llx\n", file, line, expr, actual, expected);
+    longjmp(s_case_env, 1);
+}
+
+void SIM_AssertFailed(const char *file, uint32_t line)
+{
+    if (s_assert_armed) {
+        s_assert_armed = false;
+        s_assert_fired = true;
+        longjmp(s_assert_env, 1);
+    }
+
+    printf("    %s:%u: DEV_ASSERT failed\n", file, (unsigned)line);
+    longjmp(s_case_env, 1);
+}
+
+jmp_buf *UNIT_AssertArm(void)
+{
+    s_assert_armed = true;
+    s_assert_fired = false;
+    return &s_assert_env;
+}
+
+bool UNIT_AssertDisarm(void)
+{
+    s_assert_armed = false;
+    return s_assert_fired;
+}
+
+/**
+ * @brief Run one case, catching a failed check
+ */
+static bool Unit_RunCase(const unit_case_t *test)
+{
+    if (setjmp(s_case_env) != 0) {
+        s_assert_armed = false;
+        return false;
+    }
+
+    test->run();
+    return true;
+}
+
+int UNIT_Run(const char *suite, const unit_case_t *cases, uint32_t count)
+{
+    uint32_t failed = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        bool passed = Unit_RunCase(&cases[i]);
+
+        if (!passed) {
+            failed++;
+        }
+        printf("%-5s %s.%s\n", passed ? "PASS" : "FAIL", suite, cases[i].name);
+    }
+
+    printf("%s: %u of %u passed\n", suite, (unsigned)(count - failed), (unsigned)count);
+    return (failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
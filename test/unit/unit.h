@@ -0,0 +1,82 @@
+/**
+ * @file    unit.h
+ * @brief   Minimal unit test runner for the host build
+ * @details A suite is a table of cases run in order against one simulator
+ *          instance; a case sees the peripheral state the previous ones
+ *          left, the way the application would. A failed check ends the
+ *          case and the suite carries on with the next one.
+ */
+
+#ifndef UNIT_H_
+#define UNIT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <setjmp.h>
+
+/**
+ * @brief One test case
+ */
+typedef struct {
+    const char *name;
+    void (*run)(void);
+} unit_case_t;
+
+/**
+ * @brief Record a failed check and leave the case
+ */
+void UNIT_Fail(const char *file, int line, const char *expr) __attribute__((noreturn));
+
+/**
+ * @brief Record a failed comparison and leave the case
+ */
+void UNIT_FailValues(const char *file, int line, const char *expr,
+                     unsigned long long actual, unsigned long long expected) __attribute__((noreturn));
+
+/**
+ * @brief Arm the DEV_ASSERT catcher; returns again (non-zero) when one fires
+ */
+jmp_buf *UNIT_AssertArm(void);
+
+/**
+ * @brief Disarm the DEV_ASSERT catcher
+ * @return true if a DEV_ASSERT fired since UNIT_AssertArm()
+ */
+bool UNIT_AssertDisarm(void);
+
+/**
+ * @brief Run every case of a suite and print one line per case
+ * @return int 0 if all cases passed, 1 otherwise (process exit code)
+ */
+int UNIT_Run(const char *suite, const unit_case_t *cases, uint32_t count);
+
+#define UNIT_CHECK(expr)                                                        \
+    do {                                                                        \
+        if (!(expr)) {                                                          \
+            UNIT_Fail(__FILE__, __LINE__, #expr);                               \
+        }                                                                       \
+    } while (0)
+
+#define UNIT_CHECK_EQ(actual, expected)                                         \
+    do {                                                                        \
+        unsigned long long unit_a_ = (unsigned long long)(actual);              \
+        unsigned long long unit_e_ = (unsigned long long)(expected);            \
+        if (unit_a_ != unit_e_) {                                               \
+            UNIT_FailValues(__FILE__, __LINE__, #actual, unit_a_, unit_e_);     \
+        }                                                                       \
+    } while (0)
+
+/**
+ * @brief Check that a statement fails a DEV_ASSERT (checked build only)
+ */
+#define UNIT_EXPECT_ASSERT(stmt)                                                \
+    do {                                                                        \
+        if (setjmp(*UNIT_AssertArm()) == 0) {                                   \
+            stmt;                                                               \
+        }                                                                       \
+        UNIT_CHECK(UNIT_AssertDisarm());                                        \
+    } while (0)
+
+#define UNIT_COUNT(cases)       ((uint32_t)(sizeof(cases) / sizeof((cases)[0])))
+
+#endif /* UNIT_H_ */